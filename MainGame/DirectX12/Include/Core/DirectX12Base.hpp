@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12Config.hpp"
 #include "DirectX12BufferAllocator.hpp"
+#include "DirectX12UploadArena.hpp"
 #include "GameCore/Include/Screen.hpp"
 #include <Windows.h>
 
@@ -65,9 +66,17 @@ public:
 
 	INT  GetCbvSrvUavDescriptorHeapSize() const;
 	UINT IssueViewID(HeapType heapType);
+	DescriptorHandle IssueViewHandle(HeapType heapType, UINT count = 1);
+	DescriptorHandle IssueTransientViewHandle(HeapType heapType, UINT count = 1);
+	void ReleaseViewHandle(HeapType heapType, const DescriptorHandle& handle);
+	DescriptorAllocator::Statistics GetViewStatistics(HeapType heapType) const;
+	/* upload memory valid until this frame is drawn (256 byte aligned) */
+	UploadArena& GetFrameUploadArena() { return _frameUploadArena; }
+	Resource*    GetFrameUploadBuffer() const { return _frameUploadBuffer.Get(); } // for the placed footprints of the texture copies
 	D3D12_VIEWPORT GetViewport()     const;
 	D3D12_RECT     GetScissorRect()  const;
 	INT  GetCurrentFrameIndex()      const;
+	UINT64 GetFrameCount()           const { return _frameCount; } // number of presented frames
 	INT  GetCurrentBackBufferIndex() const;
 
 	bool Get4xMsaaState() const;
@@ -111,6 +120,9 @@ private:
 	void BuildRenderTargetView();
 	void BuildDepthStencilView();
 	void BuildResourceAllocator();
+	void BuildFrameUploadArena();
+	ResourceAllocator&       GetResourceAllocator(HeapType heapType);
+	const ResourceAllocator& GetResourceAllocator(HeapType heapType) const;
 
 #pragma endregion View
 
@@ -163,10 +175,13 @@ private:
 	ConstantBufferViewAllocator  _cbvAllocator;
 	ShaderResourceViewAllocator  _srvAllocator;
 	UnorderedAccessViewAllocator _uavAllocator;
+	ResourceComPtr               _frameUploadBuffer;  /// Persistently mapped upload heap of the frame upload arena
+	UploadArena                  _frameUploadArena;
 	UINT _rtvDescriptorSize       = 0;
 	UINT _dsvDescriptorSize       = 0;
 	UINT _cbvSrvUavDescriptorSize = 0;
 	INT  _currentFrameIndex       = 0;
+	UINT64 _frameCount            = 0;
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC _defaultPSODesc = D3D12_GRAPHICS_PIPELINE_STATE_DESC();
 
@@ -192,4 +207,64 @@ private:
 	bool _isHDRSupport  = true;
 };
 
+/****************************************************************************
+*				  			ResourceViewHandle
+*************************************************************************//**
+*  @class     ResourceViewHandle
+*  @brief     Owner of a persistent descriptor range (released in the destructor).
+*             Move only, so a moved object does not release the range of the new owner.
+*****************************************************************************/
+class ResourceViewHandle
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	inline bool Issue(HeapType heapType, UINT count = 1)
+	{
+		Release();
+		_heapType = heapType;
+		_handle   = DirectX12::Instance().IssueViewHandle(heapType, count);
+		return _handle.IsValid();
+	}
+	inline void Release()
+	{
+		if (_handle.IsValid()) { DirectX12::Instance().ReleaseViewHandle(_heapType, _handle); }
+		_handle = DescriptorHandle();
+	}
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	inline UINT GetIndex(UINT offset = 0) const { return _handle.Index + offset; }
+	inline UINT GetCount()                const { return _handle.Count; }
+	inline bool IsValid()                 const { return _handle.IsValid(); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	ResourceViewHandle() = default;
+	~ResourceViewHandle() { Release(); }
+	ResourceViewHandle(const ResourceViewHandle&)            = delete;
+	ResourceViewHandle& operator=(const ResourceViewHandle&) = delete;
+	ResourceViewHandle(ResourceViewHandle&& other) noexcept : _heapType(other._heapType), _handle(other._handle) { other._handle = DescriptorHandle(); }
+	ResourceViewHandle& operator=(ResourceViewHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			_heapType     = other._heapType;
+			_handle       = other._handle;
+			other._handle = DescriptorHandle();
+		}
+		return *this;
+	}
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	HeapType         _heapType = HeapType::CBV;
+	DescriptorHandle _handle;
+};
+
 #endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12Texture.hpp"
+#include "DirectX12Base.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -103,8 +104,10 @@ public:
 		return _uploadBuffer.Get();
 	}
 
+	/* the upload heap is mapped on the first CopyStart and kept mapped (no Map / Unmap per copy) */
 	inline void CopyStart()
 	{
+		if (_mappedData != nullptr) { return; }
 		ThrowIfFailed(_uploadBuffer->Map(0, nullptr, reinterpret_cast<void**>(&_mappedData)));
 	}
 
@@ -120,7 +123,13 @@ public:
 
 	inline void CopyEnd()
 	{
-		_uploadBuffer->Unmap(0, nullptr);
+		// keep mapped. the resource is released mapped, which is allowed for the upload heap.
+	}
+
+	/* mapped pointer after CopyStart (only for the non constant buffer, whose stride is sizeof(T)). */
+	inline T* GetMappedData() const
+	{
+		return reinterpret_cast<T*>(_mappedData);
 	}
 
 private:
@@ -197,7 +206,7 @@ private:
 	**                Private Member Variables
 	*****************************************************************************/
 	Texture _colorBuffer;
-	UINT    _resourceID[(int)ResourceID::CountOfResourceType]; 
+	ResourceViewHandle _resourceView[(int)ResourceID::CountOfResourceType]; // released in the destructor
 	DXGI_FORMAT _format;
 	float       _clearColor[4];
 	bool        _isInitialzed = false;
@@ -264,7 +273,7 @@ private:
 	UINT  _elementByteSize = 0;
 	UINT  _elementCount    = 0;
 	bool _isInitialized    = false;
-	UINT _resourceID[(int)ResourceID::CountOfResourceType];
+	ResourceViewHandle _resourceView[(int)ResourceID::CountOfResourceType]; // released in the destructor
 };
 
 
@@ -12,6 +12,8 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12BaseStruct.hpp"
+#include "DirectX12DescriptorAllocator.hpp"
+#include <algorithm>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                             Define
@@ -35,6 +37,10 @@ enum class HeapType
 *************************************************************************//**
 *  @class     Resource View
 *  @brief     Resource View
+*             The indices are managed by DescriptorAllocator.
+*             IssueID            : persistent index which is never released (legacy)
+*             IssueHandle        : persistent range, released with ReleaseHandle
+*             IssueTransientHandle : range valid only in the current frame
 *****************************************************************************/
 class ResourceAllocator
 {
@@ -59,18 +65,33 @@ public:
 	*****************************************************************************/
 	inline UINT IssueID()
 	{
-		if (_currentID + 1 > _maxDescriptorCount) { MessageBox(NULL, L"The number of IDs has exceeded the expected number. ", L"Warning", MB_ICONWARNING); }
-		
-		_currentID++; return _currentID; 
+		const DescriptorHandle handle = IssueHandle(1);
+		return handle.IsValid() ? handle.Index : static_cast<UINT>(INVALID_ID);
 	}
+	inline DescriptorHandle IssueHandle(UINT count = 1)
+	{
+		const DescriptorHandle handle = _allocator.Allocate(count);
+		if (!handle.IsValid()) { MessageBox(NULL, L"The number of IDs has exceeded the expected number. ", L"Warning", MB_ICONWARNING); }
+		return handle;
+	}
+	/* the range is reused after BeginFrame(completedFence >= retireFence) */
+	inline bool ReleaseHandle(const DescriptorHandle& handle, UINT64 retireFence) { return _allocator.Free(handle, retireFence); }
+	inline DescriptorHandle IssueTransientHandle(UINT count = 1)                  { return _allocator.AllocateTransient(count); }
+	inline void BeginFrame(UINT frameIndex, UINT64 completedFence)                { _allocator.BeginFrame(frameIndex, completedFence); }
+	inline bool IsAlive(const DescriptorHandle& handle) const                     { return _allocator.IsAlive(handle); }
+	inline DescriptorAllocator::Statistics GetStatistics() const                  { return _allocator.GetStatistics(); }
 	inline UINT GetHeapSize()  const { return _maxDescriptorCount * _descriptorSize; }
-	inline void SetResourceAllocator(UINT maxDescriptorCount, UINT descriptorSize, D3D12_CPU_DESCRIPTOR_HANDLE cpuHeapPtr, D3D12_GPU_DESCRIPTOR_HANDLE gpuHeapPtr)
+	/* the last transientCountPerFrame * frameCount descriptors are used as the transient range */
+	inline void SetResourceAllocator(UINT maxDescriptorCount, UINT descriptorSize, D3D12_CPU_DESCRIPTOR_HANDLE cpuHeapPtr, D3D12_GPU_DESCRIPTOR_HANDLE gpuHeapPtr,
+		UINT transientCountPerFrame = 0, UINT frameCount = 1)
 	{
 		_maxDescriptorCount  = maxDescriptorCount;
 		_descriptorSize      = descriptorSize;
 		_cpuHeapPtr          = cpuHeapPtr;
 		_gpuHeapPtr          = gpuHeapPtr;
-		_currentID           = INVALID_ID;
+
+		const UINT transientCount = (std::min)(transientCountPerFrame * frameCount, maxDescriptorCount);
+		_allocator.Initialize(maxDescriptorCount - transientCount, frameCount == 0 ? 0 : transientCount / frameCount, frameCount);
 	}
 
 	/****************************************************************************
@@ -95,7 +116,7 @@ private:
 	D3D12_GPU_DESCRIPTOR_HANDLE _gpuHeapPtr         = D3D12_GPU_DESCRIPTOR_HANDLE();
 	UINT                        _descriptorSize     = 0;
 	UINT                        _maxDescriptorCount = 0;
-	UINT                        _currentID          = INVALID_ID;
+	DescriptorAllocator         _allocator;
 }; 
 
 class RenderTargetViewAllocator    final : public ResourceAllocator{};
@@ -14,6 +14,25 @@
 #define UAV_DESC_COUNT 1000
 #define DSV_DESC_COUNT 100
 #define RTV_DESC_COUNT 1000
+// per frame transient descriptors (taken from the end of each range above)
+#define CBV_TRANSIENT_DESC_COUNT 32
+#define SRV_TRANSIENT_DESC_COUNT 128
+#define UAV_TRANSIENT_DESC_COUNT 32
+
+// per frame constants (DirectX12::GetFrameUploadArena)
+#define FRAME_UPLOAD_ARENA_SIZE  (16 * 1024 * 1024)
+#define FRAME_UPLOAD_CHUNK_SIZE  (64 * 1024)
+
+// cooked textures with the mip chain (.png .jpg .bmp .tga, DirectX12TextureCooker)
+#define TEXTURE_COOK_CACHE_DIRECTORY L"Resources/Cache/Texture"
+#define TEXTURE_COOK_COMPRESSION     TextureCompression::None
+
+// mip streaming of the PMX diffuse textures (DirectX12TextureStreamer)
+#define TEXTURE_STREAMING_BUDGET           (512ull * 1024 * 1024) // video memory of the streaming textures (tail mips included)
+#define TEXTURE_STREAMING_UPLOAD_SIZE      (8 * 1024 * 1024)      // uploaded bytes per frame (at least one mip)
+#define TEXTURE_STREAMING_TAIL_SIZE        64                     // mips of this size or smaller are always resident
+#define TEXTURE_STREAMING_MAX_PENDING_LOAD 4
+#define TEXTURE_STREAMING_MIP_BIAS         0.0f                   // > 0 : request blurrier mips
 
 #define OFF_SCREEN_TEXTURE_NUM 4
 #define USE_HDR 
@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12DescriptorAllocator.hpp
+///             @brief  Recyclable descriptor index allocator (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_DESCRIPTOR_ALLOCATOR_HPP
+#define DIRECTX12_DESCRIPTOR_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			DescriptorHandle
+*************************************************************************//**
+*  @struct    DescriptorHandle
+*  @brief     Range of the descriptor indices [Index, Index + Count).
+*             Generation is checked on the release, so a stale (already released) handle is rejected.
+*             Generation 0 : transient range (valid only in the frame it was issued)
+*****************************************************************************/
+struct DescriptorHandle
+{
+	static constexpr std::uint32_t INVALID_INDEX = 0xffffffff;
+	std::uint32_t Index      = INVALID_INDEX;
+	std::uint32_t Count      = 0;
+	std::uint32_t Generation = 0;
+
+	bool IsValid    () const { return Index != INVALID_INDEX && Count != 0; }
+	bool IsTransient() const { return IsValid() && Generation == 0; }
+};
+
+/****************************************************************************
+*				  			DescriptorAllocator
+*************************************************************************//**
+*  @class     DescriptorAllocator
+*  @brief     Index allocator of one descriptor heap range.
+*             [0, persistentCount)                       : persistent (best fit free list, neighbors are merged on the release)
+*             [persistentCount, + transientCount * frame) : transient  (linear per frame, reset in BeginFrame)
+*             A released range is reused only after the fence value given to Free has been completed,
+*             because the GPU may still read the descriptor in the frames in flight.
+*             The fence value can be any increasing counter (e.g. the presented frame count).
+*****************************************************************************/
+class DescriptorAllocator
+{
+public:
+	struct Statistics
+	{
+		std::uint32_t PersistentCount    = 0;
+		std::uint32_t AllocatedCount     = 0; // persistent descriptors in use
+		std::uint32_t PeakAllocatedCount = 0;
+		std::uint32_t PendingCount       = 0; // released, but waiting for the fence
+		std::uint32_t FreeCount          = 0;
+		std::uint32_t FreeBlockCount     = 0;
+		std::uint32_t LargestFreeBlock   = 0;
+		float         Fragmentation      = 0.0f; // 1 - LargestFreeBlock / FreeCount (0 : no fragmentation)
+		std::uint32_t TransientCount     = 0;    // per frame
+		std::uint32_t TransientUsed      = 0;    // in the current frame
+		std::uint32_t TransientPeak      = 0;
+		std::uint64_t FailedCount        = 0;    // allocations which could not be served
+	};
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Initialize(std::uint32_t persistentCount, std::uint32_t transientCountPerFrame = 0, std::uint32_t frameCount = 1);
+	void Finalize();
+
+	/* persistent */
+	DescriptorHandle Allocate(std::uint32_t count = 1);
+	/* retireFence : the range is reused after ReleaseCompleted(completedFence >= retireFence). false : stale or invalid handle */
+	bool Free(const DescriptorHandle& handle, std::uint64_t retireFence);
+	void ReleaseCompleted(std::uint64_t completedFence);
+
+	/* transient */
+	void BeginFrame(std::uint32_t frameIndex, std::uint64_t completedFence);
+	DescriptorHandle AllocateTransient(std::uint32_t count = 1);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool IsAlive(const DescriptorHandle& handle) const;
+	Statistics GetStatistics() const;
+	std::uint32_t GetTotalCount() const { return _persistentCount + _transientCount * _frameCount; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	DescriptorAllocator()  = default;
+	~DescriptorAllocator() = default;
+	DescriptorAllocator(const DescriptorAllocator&)            = delete;
+	DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+	DescriptorAllocator(DescriptorAllocator&&)                 = default;
+	DescriptorAllocator& operator=(DescriptorAllocator&&)      = default;
+private:
+	struct PendingRange
+	{
+		std::uint32_t Index;
+		std::uint32_t Count;
+		std::uint64_t RetireFence;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void InsertFreeRange(std::uint32_t index, std::uint32_t count);
+	void EraseFreeRange (std::map<std::uint32_t, std::uint32_t>::iterator range);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::map<std::uint32_t, std::uint32_t>              _freeByIndex; // index -> count
+	std::set<std::pair<std::uint32_t, std::uint32_t>>   _freeBySize;  // (count, index)
+	std::vector<std::uint32_t> _generations;    // [index] current generation of the range starting at index
+	std::vector<std::uint32_t> _allocatedCount; // [index] count of the live range starting at index (0 : not a head)
+	std::vector<PendingRange>  _pendingRanges;
+
+	std::uint32_t _persistentCount    = 0;
+	std::uint32_t _transientCount     = 0; // per frame
+	std::uint32_t _frameCount         = 1;
+	std::uint32_t _frameIndex         = 0;
+	std::uint32_t _transientOffset    = 0;
+	std::uint32_t _transientPeak      = 0;
+	std::uint32_t _allocatedTotal     = 0;
+	std::uint32_t _peakAllocated      = 0;
+	std::uint32_t _pendingTotal       = 0;
+	std::uint64_t _failedCount        = 0;
+};
+#endif
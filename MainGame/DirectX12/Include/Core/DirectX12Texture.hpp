@@ -12,7 +12,10 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12BaseStruct.hpp"
+#include "DirectX12TextureCooker.hpp"
+#include "DirectX12TextureStreamer.hpp"
 #include "GameMath/Include/GMVector.hpp"
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <DirectXTex/DirectXTex.h>
 #include <unordered_map>
 #pragma warning(disable : 26495)
@@ -26,6 +29,7 @@ struct Texture
 	DXGI_FORMAT       Format;
 	GPU_DESC_HANDLER  GPUHandler;
 	gm::Float2        ImageSize;
+	std::uint32_t     StreamID = TextureStreamer::INVALID_ID; // INVALID_ID : all mips are resident
 	~Texture();
 };
 
@@ -70,18 +74,19 @@ public:
 	*****************************************************************************/
 	void ClearTextureTable()
 	{
-		for (auto& table : TextureTable)
+		TextureStreamer::Instance().Clear();
+		TextureTable.ForEach([](const std::wstring&, std::unique_ptr<Texture>& texture)
 		{
-			table.second.get()->Resource = nullptr;
-		}
-		TextureTable.clear(); 
+			texture.get()->Resource = nullptr;
+		});
+		TextureTable.Clear();
 		ID = 0;
 	}
 
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
-	std::unordered_map<std::wstring, std::unique_ptr<Texture>> TextureTable;
+	gm::FlatHashMap<std::wstring, std::unique_ptr<Texture>> TextureTable; // file path -> texture
 	int ID = 0;
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -123,6 +128,8 @@ public:
 	**                Public Function
 	*****************************************************************************/
 	void LoadTexture(const std::wstring& filePath, Texture& texture, TextureType type = TextureType::Texture2D );
+	/* 2D texture whose higher mips are streamed by TextureStreamer (loaded as LoadTexture when it cannot be streamed) */
+	void LoadStreamingTexture(const std::wstring& filePath, Texture& texture);
 
 	/****************************************************************************
 	**                Public Member Variables
@@ -136,6 +143,10 @@ private:
 	**                Private Function
 	*****************************************************************************/
 	void CreateTextureFromImageData(Device* device, const DirectX::Image* image, ResourceComPtr& textureBuffer, bool isDiscreteGPU, const DirectX::TexMetadata* metadata);
+	void CreateTextureFromCookedData(Device* device, const CookedTexture& cookedTexture, ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& outSubResources, std::uint32_t firstMip = 0);
+	bool LoadCookedTexture(const std::wstring& filePath, const std::wstring& extension, CookedTexture& outTexture, std::filesystem::path* outCookedFilePath = nullptr);
+	void UploadTexture  (const ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& subResources);
+	void RegisterTexture(const std::wstring& filePath, Texture& texture, TextureType type, const DirectX::XMFLOAT2& imageSize);
 	/****************************************************************************
 	**                Private Member Variables
 	*****************************************************************************/
@@ -0,0 +1,200 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureCooker.hpp
+///             @brief  Mip chain, block compression and cooked texture cache (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_TEXTURE_COOKER_HPP
+#define DIRECTX12_TEXTURE_COOKER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <filesystem>
+#include <cstddef>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define COOKED_TEXTURE_MAGIC   0x58455450 // "PTEX"
+#define COOKED_TEXTURE_VERSION 1
+#define COOKED_TEXTURE_FLAG_SRGB_FORMAT 0x1 // create the resource as *_SRGB
+
+enum class TextureMipFilter : std::uint32_t
+{
+	Box    = 0, // area average (odd sizes are weighted by the coverage)
+	Kaiser = 1, // kaiser windowed sinc (sharper, 12 taps per axis)
+};
+
+enum class TextureCompression : std::uint32_t
+{
+	None = 0, // R8G8B8A8
+	BC1  = 1, // 1 bit alpha
+	BC3  = 2, // interpolated alpha
+	BC7  = 3, // mode 6 only (single subset RGBA)
+};
+
+/****************************************************************************
+*				  			TextureCookSettings
+*************************************************************************//**
+*  @struct    TextureCookSettings
+*  @brief     Cook options (a part of the cache key)
+*****************************************************************************/
+struct TextureCookSettings
+{
+	TextureMipFilter   Filter          = TextureMipFilter::Box;
+	TextureCompression Compression     = TextureCompression::None; // ignored when the size is not a multiple of 4
+	bool               IsSRGB          = true;  // filter in linear space (the texels stay sRGB encoded)
+	bool               IsAlphaWeighted = true;  // premultiply before filtering, so that transparent texels do not bleed
+	std::uint32_t      MaxMipCount     = 0;     // 0 : full chain
+	bool               IsSRGBFormat    = false; // the decoded source was *_SRGB (decided by the source, so not a part of the key)
+};
+
+/****************************************************************************
+*				  			CookedTextureHeader
+*************************************************************************//**
+*  @struct    CookedTextureHeader
+*  @brief     Head of the cooked texture file. The mip table (CookedTextureMip x MipCount) follows it,
+*             and then the mip data (16 byte aligned, largest mip first).
+*****************************************************************************/
+struct CookedTextureHeader
+{
+	std::uint32_t Magic       = COOKED_TEXTURE_MAGIC;
+	std::uint32_t Version     = COOKED_TEXTURE_VERSION;
+	std::uint64_t SourceHash  = 0;
+	std::uint32_t Width       = 0;
+	std::uint32_t Height      = 0;
+	std::uint32_t MipCount    = 0;
+	std::uint32_t Compression = 0; // TextureCompression
+	std::uint32_t Flags       = 0; // COOKED_TEXTURE_FLAG_XXX
+	std::uint32_t Reserved    = 0;
+};
+
+struct CookedTextureMip
+{
+	std::uint32_t Width    = 0;
+	std::uint32_t Height   = 0;
+	std::uint32_t RowPitch = 0; // bytes of a texel row (a block row for BC)
+	std::uint32_t RowCount = 0; // texel rows (block rows for BC)
+	std::uint64_t Offset   = 0; // from the head of the file
+	std::uint64_t Size     = 0;
+};
+
+/****************************************************************************
+*				  			CookedTexture
+*************************************************************************//**
+*  @struct    CookedTexture
+*  @brief     Cooked texture in memory. Data is the file image itself, so it is saved and loaded as it is.
+*****************************************************************************/
+struct CookedTexture
+{
+	std::vector<std::uint8_t>     Data;   // header | mip table | mip data
+	CookedTextureHeader           Header;
+	std::vector<CookedTextureMip> Mips;
+
+	bool IsValid() const { return !Mips.empty(); }
+	bool IsSRGBFormat() const { return (Header.Flags & COOKED_TEXTURE_FLAG_SRGB_FORMAT) != 0; }
+	TextureCompression  GetCompression() const { return static_cast<TextureCompression>(Header.Compression); }
+	const std::uint8_t* GetMipData(std::uint32_t mip) const { return Data.data() + Mips[mip].Offset; }
+};
+
+/****************************************************************************
+*				  			TextureCooker
+*************************************************************************//**
+*  @class     TextureCooker
+*  @brief     Build the mip chain of R8G8B8A8 texels and pack it into the cooked texture.
+*             The chain is filtered in linear (premultiplied) float with SSE, one level from the previous one.
+*             Mip 0 is stored as it is (or compressed). The work buffers are kept for the next Cook.
+*****************************************************************************/
+class TextureCooker
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* rgba : R8G8B8A8 texels (rowPitch bytes per row). sourceHash : HashSource of the source file */
+	bool Cook(const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch,
+		std::uint64_t sourceHash, const TextureCookSettings& settings, CookedTexture& outTexture);
+	/* check the file image and build the mip table (data is moved into the texture) */
+	static bool Parse(std::vector<std::uint8_t>&& data, CookedTexture& outTexture);
+	/* hash of the source file bytes and the cook settings */
+	static std::uint64_t HashSource(const void* data, std::size_t size, const TextureCookSettings& settings);
+	static std::uint32_t GetFullMipCount(std::uint32_t width, std::uint32_t height);
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	TextureCooker()  = default;
+	~TextureCooker() = default;
+	TextureCooker(const TextureCooker&)            = delete;
+	TextureCooker& operator=(const TextureCooker&) = delete;
+	TextureCooker(TextureCooker&&)                 = default;
+	TextureCooker& operator=(TextureCooker&&)      = default;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	/* taps of each destination texel along one axis */
+	struct FilterTaps
+	{
+		std::vector<std::int32_t> Index;   // [destination * Stride + tap]
+		std::vector<float>        Weight;  // [destination * Stride + tap]
+		std::vector<std::int32_t> First;   // lowest source index of each destination
+		std::int32_t              Stride = 0;
+	};
+	static void BuildTaps(TextureMipFilter filter, std::uint32_t sourceSize, std::uint32_t destinationSize, FilterTaps& outTaps);
+	void DecodeRow    (const std::uint8_t* rgba, std::uint32_t width, const TextureCookSettings& settings, float* outRow) const;
+	void EncodeLevel  (const float* linear, std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, std::uint8_t* outRGBA) const;
+	void ResampleLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, const float* linear, std::uint32_t sourceWidth, std::uint32_t sourceHeight,
+		std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, float* outLinear);
+	static void CompressLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, std::uint32_t width, std::uint32_t height, TextureCompression compression, std::uint8_t* outBlocks);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	FilterTaps         _horizontalTaps;
+	FilterTaps         _verticalTaps;
+	std::vector<float> _sourceRow;     // decoded source row (mip 0 is read as 8 bit)
+	std::vector<float> _filteredRows;  // horizontally filtered rows (ring of _verticalTaps.Stride rows)
+	std::vector<float> _levels[2];     // previous and current level (linear, premultiplied)
+	std::vector<std::uint8_t> _texels; // current level encoded as R8G8B8A8
+};
+
+/****************************************************************************
+*				  			TextureCookCache
+*************************************************************************//**
+*  @class     TextureCookCache
+*  @brief     Cooked textures saved as <directory>/<source hash>.ptex
+*             A cached texture is loaded with a single read.
+*****************************************************************************/
+class TextureCookCache
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void SetDirectory(const std::filesystem::path& directory) { _directory = directory; }
+	bool Load(std::uint64_t sourceHash, CookedTexture& outTexture) const;
+	/* written to a temporary file and renamed, so that a broken file is never left */
+	bool Save(const CookedTexture& texture) const;
+	std::filesystem::path GetFilePath(std::uint64_t sourceHash) const;
+	/* read the whole file with one read */
+	static bool ReadFile(const std::filesystem::path& filePath, std::vector<std::uint8_t>& outData);
+	/* read [offset, offset + size) with one read (e.g. some mips of a cooked texture) */
+	static bool ReadRange(const std::filesystem::path& filePath, std::uint64_t offset, std::uint64_t size, std::vector<std::uint8_t>& outData);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const std::filesystem::path& GetDirectory() const { return _directory; }
+
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::filesystem::path _directory;
+};
+#endif
@@ -0,0 +1,146 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureResidency.hpp
+///             @brief  Residency and priority of the streaming textures (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_TEXTURE_RESIDENCY_HPP
+#define DIRECTX12_TEXTURE_RESIDENCY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			TextureResidencyChange
+*************************************************************************//**
+*  @struct    TextureResidencyChange
+*  @brief     Make the mips [TargetMip, MipCount) of the texture resident.
+*             Load : TargetMip is finer than the resident mip (read the new mips and call OnLoaded)
+*             Trim : TargetMip is coarser than the resident mip (already applied to the residency)
+*****************************************************************************/
+struct TextureResidencyChange
+{
+	std::uint32_t TextureID   = 0;
+	std::uint32_t ResidentMip = 0; // before the change
+	std::uint32_t TargetMip   = 0;
+};
+
+/****************************************************************************
+*				  			TextureResidency
+*************************************************************************//**
+*  @class     TextureResidency
+*  @brief     Decide which mips of the streaming textures are resident within a fixed byte budget.
+*             Each frame, the renderer requests the finest mip each texture needs (with a priority),
+*             and Update turns the requests into loads (highest priority first, at most maxPendingLoads in flight).
+*             When a load does not fit into the budget, the textures are trimmed in LRU order:
+*             textures not requested this frame drop to their tail mip, and requested ones only drop
+*             the mips finer than they requested. A load which still does not fit is reduced to a coarser mip.
+*             The tail mips (given on Register) are always resident and are a part of the budget.
+*****************************************************************************/
+class TextureResidency
+{
+public:
+	static constexpr std::uint32_t MAX_MIP_COUNT = 16;
+	static constexpr std::uint32_t INVALID_ID    = UINT32_MAX;
+	struct Statistics
+	{
+		std::uint64_t Budget        = 0;
+		std::uint64_t ResidentBytes = 0;
+		std::uint64_t PendingBytes  = 0; // bytes added when the pending loads finish
+		std::uint64_t TextureCount  = 0;
+		std::uint64_t PendingCount  = 0;
+		std::uint64_t LoadCount     = 0; // issued so far
+		std::uint64_t TrimCount     = 0;
+		std::uint64_t ReducedCount  = 0; // loads issued at a coarser mip than requested (budget)
+		std::uint64_t DeniedCount   = 0; // requests which could not load any mip (budget)
+	};
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Initialize(std::uint64_t budgetBytes, std::uint32_t maxPendingLoads);
+	void Clear();
+
+	/* mipBytes : bytes of each mip (finest first). tailMip : the mips [tailMip, mipCount) are resident from the start */
+	std::uint32_t Register  (const std::uint64_t* mipBytes, std::uint32_t mipCount, std::uint32_t tailMip);
+	void          Unregister(std::uint32_t textureID);
+
+	/* the requests after BeginFrame(frame) belong to the frame */
+	void BeginFrame(std::uint64_t frame);
+	void Request(std::uint32_t textureID, std::uint32_t mip, float priority);
+	/* decide the loads and trims with the requests of the current frame */
+	void Update(std::vector<TextureResidencyChange>& outLoads, std::vector<TextureResidencyChange>& outTrims);
+
+	/* result of a load (the texture may be unregistered in the meantime) */
+	void OnLoaded    (std::uint32_t textureID, std::uint32_t mip);
+	void OnLoadFailed(std::uint32_t textureID);
+
+	/* finest mip needed to draw a width x height texture over screenSize pixels (bias > 0 : blurrier) */
+	static std::uint32_t ComputeRequiredMip(std::uint32_t width, std::uint32_t height, std::uint32_t mipCount, float screenSize, float bias = 0.0f);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool          IsRegistered  (std::uint32_t textureID) const { return textureID < _entries.size() && _entries[textureID].IsActive; }
+	std::uint32_t GetResidentMip(std::uint32_t textureID) const { return _entries[textureID].ResidentMip; }
+	std::uint32_t GetPendingMip (std::uint32_t textureID) const { return _entries[textureID].PendingMip; }
+	std::uint64_t GetResidentBytes() const { return _residentBytes; }
+	std::uint64_t GetBudget       () const { return _budget; }
+	Statistics    GetStatistics   () const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	TextureResidency()  = default;
+	~TextureResidency() = default;
+	TextureResidency(const TextureResidency&)            = delete;
+	TextureResidency& operator=(const TextureResidency&) = delete;
+	TextureResidency(TextureResidency&&)                 = default;
+	TextureResidency& operator=(TextureResidency&&)      = default;
+private:
+	struct Entry
+	{
+		std::uint64_t SuffixBytes[MAX_MIP_COUNT + 1] = {}; // bytes of the mips [mip, MipCount)
+		std::uint32_t MipCount      = 0;
+		std::uint32_t TailMip       = 0; // never trimmed coarser than this
+		std::uint32_t ResidentMip   = 0;
+		std::uint32_t PendingMip    = 0; // == ResidentMip : no load in flight
+		std::uint32_t RequestedMip  = 0; // valid while LastUsedFrame == _frame
+		float         Priority      = 0.0f;
+		std::uint64_t LastUsedFrame = 0;
+		bool          IsActive      = false;
+
+		bool IsPending() const { return PendingMip != ResidentMip; }
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	bool IsUsed(const Entry& entry) const { return entry.LastUsedFrame == _frame; }
+	/* trim the other textures until extraBytes fit into the budget (return false when it does not fit) */
+	bool MakeRoom(std::uint64_t extraBytes, std::uint32_t loadingID, std::vector<TextureResidencyChange>& outTrims);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<Entry>         _entries;
+	std::vector<std::uint32_t> _freeIDs;
+	std::vector<std::uint32_t> _candidates; // work list of Update
+	std::vector<std::uint32_t> _victims;    // trim order (LRU), built once per Update when needed
+	std::size_t   _victimCursor    = 0;
+	bool          _isVictimBuilt   = false;
+	std::uint64_t _budget          = 0;
+	std::uint32_t _maxPendingLoads = 1;
+	std::uint64_t _frame           = 1;
+	std::uint64_t _residentBytes   = 0;
+	std::uint64_t _pendingBytes    = 0;
+	std::uint32_t _pendingCount    = 0;
+	std::uint32_t _textureCount    = 0;
+	Statistics    _counters;
+};
+#endif
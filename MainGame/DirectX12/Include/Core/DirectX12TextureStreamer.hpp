@@ -0,0 +1,165 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureStreamer.hpp
+///             @brief  Mip streaming of the cooked textures
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_TEXTURE_STREAMER_HPP
+#define DIRECTX12_TEXTURE_STREAMER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12BaseStruct.hpp"
+#include "DirectX12Config.hpp"
+#include "DirectX12TextureCooker.hpp"
+#include "DirectX12TextureResidency.hpp"
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			TextureStreamer
+*************************************************************************//**
+*  @class     TextureStreamer
+*  @brief     Stream the mips of the cooked textures within TEXTURE_STREAMING_BUDGET.
+*             A texture starts with its tail mips (TEXTURE_STREAMING_TAIL_SIZE), and the renderer requests
+*             the mip it needs from the screen size every frame. TextureResidency decides the loads and trims.
+*             Load : the new mips are read on the reader thread with one read (they are contiguous in the file),
+*                    uploaded over several frames (TEXTURE_STREAMING_UPLOAD_SIZE per frame, coarsest first)
+*                    into a new resource, and the resident mips are copied on the GPU.
+*             Trim : the kept mips are copied into a smaller resource on the GPU.
+*             Then the SRV is rewritten in place (the materials keep the same descriptor),
+*             and the former resource is released FRAME_BUFFER_COUNT frames later. Nothing waits for the GPU.
+*****************************************************************************/
+class TextureStreamer
+{
+public:
+	static constexpr std::uint32_t INVALID_ID = TextureResidency::INVALID_ID;
+	struct Statistics
+	{
+		TextureResidency::Statistics Residency;
+		std::uint64_t FrameUploadedBytes = 0;
+		std::uint64_t ReadBytes          = 0; // read from the files so far
+		std::uint64_t UploadJobCount     = 0; // read and waiting for (or in) the upload
+		std::uint64_t RetiredCount       = 0; // resources waiting for the GPU
+	};
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Initialize(std::uint64_t budgetBytes = TEXTURE_STREAMING_BUDGET);
+	void Finalize();
+	/* unregister all textures (scene exit) */
+	void Clear();
+
+	/* resource : the mips [tailMip, MipCount) of the cooked file (COPY_DEST state). srvID : the SRV of the resource */
+	std::uint32_t Register(const std::filesystem::path& cookedFilePath, const CookedTexture& cookedTexture,
+		const ResourceComPtr& resource, std::uint32_t tailMip, UINT srvID);
+	/* screenSize : pixels covered by the texture along its longer side (FLT_MAX : full resolution) */
+	void Request(std::uint32_t streamID, float screenSize);
+	/* call once per frame before drawing the streaming textures (the requests of the last frame are used) */
+	void Update();
+
+	/* first mip kept resident (the longer side is TEXTURE_STREAMING_TAIL_SIZE or less) */
+	static std::uint32_t GetTailMip(const CookedTexture& cookedTexture);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool       IsInitialized() const { return _isInitialized; }
+	Statistics GetStatistics() const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	static TextureStreamer& Instance()
+	{
+		static TextureStreamer textureStreamer;
+		return textureStreamer;
+	}
+	TextureStreamer(const TextureStreamer&)            = delete;
+	TextureStreamer& operator=(const TextureStreamer&) = delete;
+	TextureStreamer(TextureStreamer&&)                 = delete;
+	TextureStreamer& operator=(TextureStreamer&&)      = delete;
+private:
+	struct StreamTexture
+	{
+		std::filesystem::path         FilePath;
+		std::vector<CookedTextureMip> Mips;
+		ResourceComPtr                Resource;     // mips [ResidentMip, MipCount)
+		D3D12_RESOURCE_STATES         State        = D3D12_RESOURCE_STATE_COPY_DEST;
+		std::uint32_t                 ResidentMip  = 0;
+		UINT                          SRVID        = 0;
+		std::uint64_t                 Generation   = 0;
+		bool                          IsStreamable = true; // false : a read failed, the texture keeps its mips
+	};
+	struct ReadJob
+	{
+		std::uint32_t             StreamID    = 0;
+		std::uint64_t             Generation  = 0;
+		std::uint32_t             ResidentMip = 0;
+		std::uint32_t             TargetMip   = 0;
+		std::filesystem::path     FilePath;
+		std::uint64_t             Offset      = 0; // file offset of the mip TargetMip
+		std::uint64_t             Size        = 0;
+		std::vector<std::uint8_t> Data;            // mips [TargetMip, ResidentMip)
+		bool                      IsSucceeded = false;
+	};
+	struct UploadJob
+	{
+		ReadJob        Read;
+		ResourceComPtr Resource;           // mips [TargetMip, MipCount)
+		std::uint32_t  UploadedMip = 0;    // mips [UploadedMip, ResidentMip) are uploaded
+	};
+	struct RetiredResource
+	{
+		ResourceComPtr Resource;
+		std::uint64_t  Fence = 0; // released when the frame count reaches this
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	TextureStreamer() = default;
+	~TextureStreamer();
+	void ReaderLoop();
+	void FinishReads();
+	void UploadMips();
+	bool UploadMip(UploadJob& job, std::uint32_t mip, std::uint64_t& uploadedBytes);
+	void Trim(const TextureResidencyChange& trim);
+	ResourceComPtr CreateResource(const StreamTexture& texture, std::uint32_t firstMip);
+	/* copy the resident mips into the new resource, rewrite the SRV and retire the former resource */
+	void SwapResource(StreamTexture& texture, const ResourceComPtr& resource, std::uint32_t firstMip);
+	void Retire(const ResourceComPtr& resource);
+	bool IsCurrent(std::uint32_t streamID, std::uint64_t generation) const;
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	TextureResidency                    _residency;
+	std::vector<StreamTexture>          _textures; // [stream ID]
+	std::vector<TextureResidencyChange> _loads;
+	std::vector<TextureResidencyChange> _trims;
+	std::deque<UploadJob>               _uploadJobs;
+	std::vector<RetiredResource>        _retiredResources;
+	std::uint64_t _generation         = 0;
+	std::uint64_t _frame              = 0;
+	std::uint64_t _frameUploadedBytes = 0;
+	std::uint64_t _readBytes          = 0;
+	bool          _isInitialized      = false;
+
+	/*-------------------------------------------------------------------
+	-           Reader thread
+	---------------------------------------------------------------------*/
+	std::thread             _reader;
+	std::mutex              _mutex;
+	std::condition_variable _condition;
+	std::deque<ReadJob>     _readRequests;
+	std::vector<ReadJob>    _readResults;
+	bool                    _isQuit = false;
+};
+#endif
@@ -0,0 +1,181 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12UploadArena.hpp
+///             @brief  Per frame upload ring for the constants (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_UPLOAD_ARENA_HPP
+#define DIRECTX12_UPLOAD_ARENA_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class UploadArena;
+
+/****************************************************************************
+*				  			UploadAllocation
+*************************************************************************//**
+*  @struct    UploadAllocation
+*  @brief     Mapped memory (CPU) and its address (GPU). Valid until the frame is retired.
+*****************************************************************************/
+struct UploadAllocation
+{
+	void*         CPU  = nullptr;
+	std::uint64_t GPU  = 0;
+	std::uint64_t Size = 0;
+
+	bool IsValid() const { return CPU != nullptr; }
+};
+
+/****************************************************************************
+*				  			UploadArenaWriter
+*************************************************************************//**
+*  @class     UploadArenaWriter
+*  @brief     Bump allocator over a chunk taken from the arena.
+*             One writer per thread, so the threads write their constants without locking.
+*             The chunk is dropped when the arena frame changes.
+*****************************************************************************/
+class UploadArenaWriter
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* the size is rounded up to 256 bytes (constant buffer alignment) */
+	UploadAllocation Allocate(std::uint64_t size, std::uint64_t alignment = 256);
+	template<class T>
+	UploadAllocation Upload(const T& data)
+	{
+		UploadAllocation allocation = Allocate(sizeof(T));
+		if (allocation.IsValid()) { std::memcpy(allocation.CPU, &data, sizeof(T)); }
+		return allocation;
+	}
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	explicit UploadArenaWriter(UploadArena& arena) : _arena(&arena) {}
+	~UploadArenaWriter() = default;
+	UploadArenaWriter(const UploadArenaWriter&)            = delete;
+	UploadArenaWriter& operator=(const UploadArenaWriter&) = delete;
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	UploadArena*     _arena       = nullptr;
+	UploadAllocation _chunk;
+	std::uint64_t    _offset      = 0;
+	std::uint64_t    _frameSerial = 0;
+};
+
+/****************************************************************************
+*				  			UploadArena
+*************************************************************************//**
+*  @class     UploadArena
+*  @brief     Ring over one persistently mapped upload buffer.
+*             The memory is handed out in chunks (thread safe), and each frame is closed by EndFrame with a fence value.
+*             The memory of a frame is reused after ReleaseCompleted(completedFence >= the fence of the frame).
+*             Allocate / Upload of the arena itself use the writer of the render thread.
+*             EndFrame must not be called while the other writers are allocating.
+*****************************************************************************/
+class UploadArena
+{
+public:
+	static constexpr std::uint64_t CONSTANT_BUFFER_ALIGNMENT = 256;
+	struct Statistics
+	{
+		std::uint64_t Capacity               = 0;
+		std::uint64_t InFlightBytes          = 0; // ring range which is not released yet
+		std::uint64_t FrameUploadedBytes     = 0; // allocated in the current frame (aligned)
+		std::uint64_t FrameAllocationCount   = 0;
+		std::uint64_t FrameChunkCount        = 0;
+		std::uint64_t LastFrameUploadedBytes = 0;
+		std::uint64_t PeakFrameUploadedBytes = 0;
+		std::uint64_t FailedCount            = 0; // the ring was full
+	};
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* cpuBase and gpuBase must be 256 byte aligned */
+	void Initialize(void* cpuBase, std::uint64_t gpuBase, std::uint64_t capacity, std::uint64_t chunkSize = 64 * 1024);
+	void Finalize();
+
+	/* thread safe. returns at least minSize bytes (invalid when the ring is full) */
+	UploadAllocation AllocateChunk(std::uint64_t minSize);
+
+	/* render thread only */
+	UploadAllocation Allocate(std::uint64_t size, std::uint64_t alignment = 256) { return _writer.Allocate(size, alignment); }
+	template<class T>
+	UploadAllocation Upload(const T& data) { return _writer.Upload(data); }
+
+	void EndFrame(std::uint64_t retireFence);
+	void ReleaseCompleted(std::uint64_t completedFence);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::uint64_t GetFrameSerial() const { return _frameSerial.load(std::memory_order_acquire); }
+	std::uint64_t GetCapacity   () const { return _capacity; }
+	bool          IsInitialized () const { return _cpuBase != nullptr; }
+	Statistics    GetStatistics () const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	UploadArena() : _writer(*this) {}
+	~UploadArena() = default;
+	UploadArena(const UploadArena&)            = delete;
+	UploadArena& operator=(const UploadArena&) = delete;
+	UploadArena(UploadArena&&)                 = delete;
+	UploadArena& operator=(UploadArena&&)      = delete;
+private:
+	friend class UploadArenaWriter;
+	struct FrameRecord
+	{
+		std::uint64_t RetireFence;
+		std::uint64_t Head;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void AddAllocation(std::uint64_t size)
+	{
+		_frameUploadedBytes  .fetch_add(size, std::memory_order_relaxed);
+		_frameAllocationCount.fetch_add(1   , std::memory_order_relaxed);
+	}
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::uint8_t*           _cpuBase   = nullptr;
+	std::uint64_t           _gpuBase   = 0;
+	std::uint64_t           _capacity  = 0;
+	std::uint64_t           _chunkSize = 0;
+	std::uint64_t           _head      = 0; // virtual offsets (the physical offset is % _capacity)
+	std::uint64_t           _tail      = 0;
+	std::deque<FrameRecord> _frames;
+	mutable std::mutex      _mutex;
+	std::atomic<std::uint64_t> _frameSerial = 1;
+	UploadArenaWriter       _writer;
+
+	/*-------------------------------------------------------------------
+	-           Counter
+	---------------------------------------------------------------------*/
+	std::atomic<std::uint64_t> _frameUploadedBytes   = 0;
+	std::atomic<std::uint64_t> _frameAllocationCount = 0;
+	std::uint64_t              _frameChunkCount      = 0;
+	std::uint64_t              _lastFrameUploaded    = 0;
+	std::uint64_t              _peakFrameUploaded    = 0;
+	std::uint64_t              _failedCount          = 0;
+};
+#endif
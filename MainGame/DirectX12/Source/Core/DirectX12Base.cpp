@@ -121,6 +121,8 @@ void DirectX12::OnResize()
 void DirectX12::Finalize()
 {
 	FinalizeShaderBlendData();
+	_frameUploadArena.Finalize();
+	if (_frameUploadBuffer)  { _frameUploadBuffer  = nullptr; }
 	if (_depthStencilBuffer) { _depthStencilBuffer = nullptr;}
 	for (auto& renderTarget : _renderTargetList) 
 	{ 
@@ -171,6 +173,16 @@ void DirectX12::ClearScreen()
 	---------------------------------------------------------------------*/
 	ResetCommandList();
 
+	/*-------------------------------------------------------------------
+	-   Recycle the released descriptors and reset the transient range.
+	-   CompleteRendering waits for the GPU, so all presented frames are completed.
+	---------------------------------------------------------------------*/
+	for (int i = 0; i < (int)HeapType::HEAP_TYPE_COUNT; ++i)
+	{
+		GetResourceAllocator((HeapType)i).BeginFrame(_currentFrameIndex, _frameCount);
+	}
+	_frameUploadArena.ReleaseCompleted(_frameCount);
+
 	/*-------------------------------------------------------------------
 	-       Indicate a state transition (Present -> Render Target)
 	---------------------------------------------------------------------*/
@@ -231,6 +243,8 @@ void DirectX12::CompleteRendering()
 	---------------------------------------------------------------------*/
 	ThrowIfFailed(_swapchain->Present(VSYNC, 0));
 	_currentFrameIndex = (_currentFrameIndex + 1) % FRAME_BUFFER_COUNT;
+	_frameCount++;
+	_frameUploadArena.EndFrame(_frameCount); // reused after this frame is completed
 
 	FlushCommandQueue();
 }
@@ -310,6 +324,7 @@ void DirectX12::LoadPipeLine()
 	---------------------------------------------------------------------*/
 	CreateDescriptorHeap();
 	BuildResourceAllocator();
+	BuildFrameUploadArena();
 	for(int i = 0; i <FRAME_BUFFER_COUNT; ++i){ IssueViewID(HeapType::RTV); }
 	IssueViewID(HeapType::DSV);
 
@@ -634,7 +649,7 @@ void DirectX12::BuildResourceAllocator()
 	---------------------------------------------------------------------*/
 	auto cbvCpuHandler = _cbvSrvUavHeap->GetCPUDescriptorHandleForHeapStart();
 	auto cbvGpuHandler = _cbvSrvUavHeap->GetGPUDescriptorHandleForHeapStart();
-	_cbvAllocator.SetResourceAllocator(CBV_DESC_COUNT, _cbvSrvUavDescriptorSize, cbvCpuHandler, cbvGpuHandler);
+	_cbvAllocator.SetResourceAllocator(CBV_DESC_COUNT, _cbvSrvUavDescriptorSize, cbvCpuHandler, cbvGpuHandler, CBV_TRANSIENT_DESC_COUNT, FRAME_BUFFER_COUNT);
 
 	/*-------------------------------------------------------------------
 	-			     Set SRV Heap
@@ -643,7 +658,7 @@ void DirectX12::BuildResourceAllocator()
 	srvCpuHandler.ptr += (UINT64)CBV_DESC_COUNT * _cbvSrvUavDescriptorSize;
 	auto srvGpuHandler = _cbvSrvUavHeap->GetGPUDescriptorHandleForHeapStart();
 	srvGpuHandler.ptr += (UINT64)CBV_DESC_COUNT * _cbvSrvUavDescriptorSize;
-	_srvAllocator.SetResourceAllocator(SRV_DESC_COUNT, _cbvSrvUavDescriptorSize, srvCpuHandler, srvGpuHandler);
+	_srvAllocator.SetResourceAllocator(SRV_DESC_COUNT, _cbvSrvUavDescriptorSize, srvCpuHandler, srvGpuHandler, SRV_TRANSIENT_DESC_COUNT, FRAME_BUFFER_COUNT);
 
 	/*-------------------------------------------------------------------
 	-			     Set UAV Heap
@@ -652,8 +667,35 @@ void DirectX12::BuildResourceAllocator()
 	uavCpuHandler.ptr += (UINT64)(CBV_DESC_COUNT + SRV_DESC_COUNT) * _cbvSrvUavDescriptorSize;
 	auto uavGpuHandler = _cbvSrvUavHeap->GetGPUDescriptorHandleForHeapStart();
 	uavGpuHandler.ptr += (UINT64)(CBV_DESC_COUNT + SRV_DESC_COUNT) * _cbvSrvUavDescriptorSize;
-	_uavAllocator.SetResourceAllocator(UAV_DESC_COUNT, _cbvSrvUavDescriptorSize, uavCpuHandler, uavGpuHandler);
+	_uavAllocator.SetResourceAllocator(UAV_DESC_COUNT, _cbvSrvUavDescriptorSize, uavCpuHandler, uavGpuHandler, UAV_TRANSIENT_DESC_COUNT, FRAME_BUFFER_COUNT);
+
+}
+
+/****************************************************************************
+*							BuildFrameUploadArena
+*************************************************************************//**
+*  @fn        void DirectX12::BuildFrameUploadArena()
+*  @brief     Create the upload heap shared by the per frame constants.
+*             It is kept mapped (upload heaps do not need Unmap).
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void DirectX12::BuildFrameUploadArena()
+{
+	auto heapProp = HEAP_PROPERTY(D3D12_HEAP_TYPE_UPLOAD);
+	auto buffer   = RESOURCE_DESC::Buffer(FRAME_UPLOAD_ARENA_SIZE);
+	ThrowIfFailed(_device->CreateCommittedResource(
+		&heapProp,
+		D3D12_HEAP_FLAG_NONE,
+		&buffer,
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		IID_PPV_ARGS(_frameUploadBuffer.ReleaseAndGetAddressOf())));
+	_frameUploadBuffer->SetName(L"DirectX12::FrameUploadArena");
 
+	void* mappedData = nullptr;
+	ThrowIfFailed(_frameUploadBuffer->Map(0, nullptr, &mappedData));
+	_frameUploadArena.Initialize(mappedData, _frameUploadBuffer->GetGPUVirtualAddress(), FRAME_UPLOAD_ARENA_SIZE, FRAME_UPLOAD_CHUNK_SIZE);
 }
 
 /****************************************************************************
@@ -821,6 +863,7 @@ void DirectX12::CompleteInitialize()
 	---------------------------------------------------------------------*/
 	ThrowIfFailed(_swapchain->Present(VSYNC, 0));
 	_currentFrameIndex = (_currentFrameIndex + 1) % FRAME_BUFFER_COUNT;
+	_frameCount++;
 
 }
 
@@ -1459,6 +1502,92 @@ UINT DirectX12::IssueViewID(HeapType heapType)
 			return _uavAllocator.IssueID();
 	}
 }
+
+/****************************************************************************
+*                        IssueViewHandle
+*************************************************************************//**
+*  @fn        DescriptorHandle DirectX12::IssueViewHandle(HeapType heapType, UINT count)
+*  @brief     Issue contiguous persistent views, which are returned with ReleaseViewHandle
+*  @param[in] HeapType heapType
+*  @param[in] UINT count
+*  @return @@DescriptorHandle
+*****************************************************************************/
+DescriptorHandle DirectX12::IssueViewHandle(HeapType heapType, UINT count)
+{
+	return GetResourceAllocator(heapType).IssueHandle(count);
+}
+
+/****************************************************************************
+*                        IssueTransientViewHandle
+*************************************************************************//**
+*  @fn        DescriptorHandle DirectX12::IssueTransientViewHandle(HeapType heapType, UINT count)
+*  @brief     Issue contiguous views valid only until this frame is drawn (no release)
+*  @param[in] HeapType heapType
+*  @param[in] UINT count
+*  @return @@DescriptorHandle (invalid when the transient range of this frame is full)
+*****************************************************************************/
+DescriptorHandle DirectX12::IssueTransientViewHandle(HeapType heapType, UINT count)
+{
+	return GetResourceAllocator(heapType).IssueTransientHandle(count);
+}
+
+/****************************************************************************
+*                        ReleaseViewHandle
+*************************************************************************//**
+*  @fn        void DirectX12::ReleaseViewHandle(HeapType heapType, const DescriptorHandle& handle)
+*  @brief     Return the views. They are reused after the frames in flight have been completed.
+*             A stale handle (already released) is ignored.
+*  @param[in] HeapType heapType
+*  @param[in] const DescriptorHandle& handle
+*  @return @@void
+*****************************************************************************/
+void DirectX12::ReleaseViewHandle(HeapType heapType, const DescriptorHandle& handle)
+{
+	GetResourceAllocator(heapType).ReleaseHandle(handle, _frameCount + FRAME_BUFFER_COUNT);
+}
+
+/****************************************************************************
+*                        GetViewStatistics
+*************************************************************************//**
+*  @fn        DescriptorAllocator::Statistics DirectX12::GetViewStatistics(HeapType heapType) const
+*  @brief     Usage and fragmentation of the view range
+*  @param[in] HeapType heapType
+*  @return @@DescriptorAllocator::Statistics
+*****************************************************************************/
+DescriptorAllocator::Statistics DirectX12::GetViewStatistics(HeapType heapType) const
+{
+	return GetResourceAllocator(heapType).GetStatistics();
+}
+
+/****************************************************************************
+*                        GetResourceAllocator
+*************************************************************************//**
+*  @fn        ResourceAllocator& DirectX12::GetResourceAllocator(HeapType heapType)
+*  @brief     Get the allocator of the heap type
+*  @param[in] HeapType heapType
+*  @return @@ResourceAllocator&
+*****************************************************************************/
+ResourceAllocator& DirectX12::GetResourceAllocator(HeapType heapType)
+{
+	return const_cast<ResourceAllocator&>(static_cast<const DirectX12*>(this)->GetResourceAllocator(heapType));
+}
+
+const ResourceAllocator& DirectX12::GetResourceAllocator(HeapType heapType) const
+{
+	switch (heapType)
+	{
+		case HeapType::RTV:
+			return _rtvAllocator;
+		case HeapType::DSV:
+			return _dsvAllocator;
+		case HeapType::CBV:
+			return _cbvAllocator;
+		case HeapType::SRV:
+			return _srvAllocator;
+		default:
+			return _uavAllocator;
+	}
+}
 /****************************************************************************
 *                           Get4xMsaaState
 *************************************************************************//**
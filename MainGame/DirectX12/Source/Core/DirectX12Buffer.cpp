@@ -235,7 +235,7 @@ bool ColorBuffer::TransitionResourceState(D3D12_RESOURCE_STATES after)
 *****************************************************************************/
 D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPUSRV() const
 {
-	return DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]);
+	return DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex());
 }
 /****************************************************************************
 *                       GetCPURTV
@@ -247,7 +247,7 @@ D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPUSRV() const
 *****************************************************************************/
 D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPURTV() const
 {
-	return DirectX12::Instance().GetCPUResourceView(HeapType::RTV, _resourceID[(int)ResourceID::RTV]);
+	return DirectX12::Instance().GetCPUResourceView(HeapType::RTV, _resourceView[(int)ResourceID::RTV].GetIndex());
 }
 /****************************************************************************
 *                       GetCPUUAV
@@ -259,7 +259,7 @@ D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPURTV() const
 *****************************************************************************/
 D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPUUAV() const
 {
-	return DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]);
+	return DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex());
 }
 /****************************************************************************
 *                       GetGPUSRV
@@ -271,7 +271,7 @@ D3D12_CPU_DESCRIPTOR_HANDLE ColorBuffer::GetCPUUAV() const
 *****************************************************************************/
 D3D12_GPU_DESCRIPTOR_HANDLE ColorBuffer::GetGPUSRV() const
 {
-	return DirectX12::Instance().GetGPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]);
+	return DirectX12::Instance().GetGPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex());
 }
 /****************************************************************************
 *                       GetGPURTV
@@ -283,7 +283,7 @@ D3D12_GPU_DESCRIPTOR_HANDLE ColorBuffer::GetGPUSRV() const
 *****************************************************************************/
 D3D12_GPU_DESCRIPTOR_HANDLE ColorBuffer::GetGPURTV() const
 {
-	return DirectX12::Instance().GetGPUResourceView(HeapType::RTV, _resourceID[(int)ResourceID::RTV]);
+	return DirectX12::Instance().GetGPUResourceView(HeapType::RTV, _resourceView[(int)ResourceID::RTV].GetIndex());
 }
 /****************************************************************************
 *                       GetGPUUAV
@@ -295,7 +295,7 @@ D3D12_GPU_DESCRIPTOR_HANDLE ColorBuffer::GetGPURTV() const
 *****************************************************************************/
 D3D12_GPU_DESCRIPTOR_HANDLE ColorBuffer::GetGPUUAV() const
 {
-	return DirectX12::Instance().GetGPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]);
+	return DirectX12::Instance().GetGPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex());
 }
 #pragma endregion Public Function
 #pragma region Private Function
@@ -307,9 +307,9 @@ bool ColorBuffer::CreateDescriptorHeap()
 
 bool ColorBuffer::IssueViewID()
 {
-	_resourceID[(int)ResourceID::RTV] = DirectX12::Instance().IssueViewID(HeapType::RTV);
-	_resourceID[(int)ResourceID::SRV] = DirectX12::Instance().IssueViewID(HeapType::SRV);
-	_resourceID[(int)ResourceID::UAV] = DirectX12::Instance().IssueViewID(HeapType::UAV);
+	if (!_resourceView[(int)ResourceID::RTV].Issue(HeapType::RTV)) { return false; }
+	if (!_resourceView[(int)ResourceID::SRV].Issue(HeapType::SRV)) { return false; }
+	if (!_resourceView[(int)ResourceID::UAV].Issue(HeapType::UAV)) { return false; }
 	return true;
 }
 /****************************************************************************
@@ -360,7 +360,7 @@ bool ColorBuffer::CreateTexture(int width, int height, DXGI_FORMAT format, float
 	_colorBuffer.ImageSize.x = static_cast<float>(width);
 	_colorBuffer.ImageSize.y = static_cast<float>(height);
 	_colorBuffer.GPUHandler  = DirectX12::Instance().GetGPUResourceView
-	(HeapType::SRV, _resourceID[(int)ResourceID::SRV]);
+	(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex());
 	return true;
 }
 
@@ -383,7 +383,7 @@ bool ColorBuffer::CreateDescriptor(DXGI_FORMAT format)
 	colorBufferDesc.Format        = format;
 	DirectX12::Instance().GetDevice()->CreateRenderTargetView(
 		_colorBuffer.Resource.Get(), &colorBufferDesc,
-		DirectX12::Instance().GetCPUResourceView(HeapType::RTV, _resourceID[(int)ResourceID::RTV]));
+		DirectX12::Instance().GetCPUResourceView(HeapType::RTV, _resourceView[(int)ResourceID::RTV].GetIndex()));
 
 	/*-------------------------------------------------------------------
 	-      Create descriptor for srv
@@ -399,7 +399,7 @@ bool ColorBuffer::CreateDescriptor(DXGI_FORMAT format)
 
 	DirectX12::Instance().GetDevice()->CreateShaderResourceView(
 		_colorBuffer.Resource.Get(), &srvDesc,
-		DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]));
+		DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex()));
 
 	/*-------------------------------------------------------------------
 	-      Create descriptor for uav
@@ -413,7 +413,7 @@ bool ColorBuffer::CreateDescriptor(DXGI_FORMAT format)
 	DirectX12::Instance().GetDevice()->CreateUnorderedAccessView(
 		_colorBuffer.Resource.Get(), nullptr,
 		&uavDesc, 
-		DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]));
+		DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex()));
 	return true;
 }
 #pragma endregion Private Function
@@ -474,29 +474,29 @@ bool RWStructuredBuffer::OnResize(int elementCount)
 
 D3D12_CPU_DESCRIPTOR_HANDLE RWStructuredBuffer::GetCPUSRV() const
 {
-	return DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]);
+	return DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex());
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE RWStructuredBuffer::GetCPUUAV() const
 {
-	return DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]);
+	return DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex());
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE RWStructuredBuffer::GetGPUSRV() const
 {
-	return DirectX12::Instance().GetGPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]);
+	return DirectX12::Instance().GetGPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex());
 }
 D3D12_GPU_DESCRIPTOR_HANDLE RWStructuredBuffer::GetGPUUAV() const
 {
-	return DirectX12::Instance().GetGPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]);
+	return DirectX12::Instance().GetGPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex());
 }
 #pragma endregion Public Function
 #pragma region Private Function
 bool RWStructuredBuffer::IssueViewID()
 {
 	if (_isInitialized) { return true; }
-	_resourceID[(int)ResourceID::SRV] = DirectX12::Instance().IssueViewID(HeapType::SRV);
-	_resourceID[(int)ResourceID::UAV] = DirectX12::Instance().IssueViewID(HeapType::UAV);
+	if (!_resourceView[(int)ResourceID::SRV].Issue(HeapType::SRV)) { return false; }
+	if (!_resourceView[(int)ResourceID::UAV].Issue(HeapType::UAV)) { return false; }
 	return true;
 }
 
@@ -539,7 +539,7 @@ bool RWStructuredBuffer::PrepareDescriptor()
 
 	DirectX12::Instance().GetDevice()->CreateShaderResourceView(
 		_buffer.Get(), &srvDesc,
-		DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceID[(int)ResourceID::SRV]));
+		DirectX12::Instance().GetCPUResourceView(HeapType::SRV, _resourceView[(int)ResourceID::SRV].GetIndex()));
 
 	/*-------------------------------------------------------------------
 	-      Create descriptor for uav
@@ -554,7 +554,7 @@ bool RWStructuredBuffer::PrepareDescriptor()
 	DirectX12::Instance().GetDevice()->CreateUnorderedAccessView(
 		_buffer.Get(), nullptr,
 		&uavDesc, 
-		DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceID[(int)ResourceID::UAV]));
+		DirectX12::Instance().GetCPUResourceView(HeapType::UAV, _resourceView[(int)ResourceID::UAV].GetIndex()));
 	return true;
 }
 #pragma endregion Private Function
@@ -0,0 +1,278 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12DescriptorAllocator.cpp
+///             @brief  Recyclable descriptor index allocator (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12DescriptorAllocator.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        void DescriptorAllocator::Initialize(std::uint32_t persistentCount, std::uint32_t transientCountPerFrame, std::uint32_t frameCount)
+*  @brief     Make all persistent descriptors free and reset the transient ranges
+*  @param[in] std::uint32_t persistentCount
+*  @param[in] std::uint32_t transientCountPerFrame
+*  @param[in] std::uint32_t frameCount (frames in flight)
+*  @return @@void
+*****************************************************************************/
+void DescriptorAllocator::Initialize(std::uint32_t persistentCount, std::uint32_t transientCountPerFrame, std::uint32_t frameCount)
+{
+	Finalize();
+	_persistentCount = persistentCount;
+	_transientCount  = transientCountPerFrame;
+	_frameCount      = (std::max)(frameCount, 1u);
+
+	/*-------------------------------------------------------------------
+	-           Generation starts at 1 (0 is used by the transient range)
+	---------------------------------------------------------------------*/
+	_generations   .assign(persistentCount, 1);
+	_allocatedCount.assign(persistentCount, 0);
+	if (persistentCount > 0) { InsertFreeRange(0, persistentCount); }
+}
+
+void DescriptorAllocator::Finalize()
+{
+	_freeByIndex.clear();
+	_freeBySize .clear();
+	_generations   .clear(); _generations   .shrink_to_fit();
+	_allocatedCount.clear(); _allocatedCount.shrink_to_fit();
+	_pendingRanges .clear();
+	_persistentCount = 0;
+	_transientCount  = 0;
+	_frameCount      = 1;
+	_frameIndex      = 0;
+	_transientOffset = 0;
+	_transientPeak   = 0;
+	_allocatedTotal  = 0;
+	_peakAllocated   = 0;
+	_pendingTotal    = 0;
+	_failedCount     = 0;
+}
+
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        DescriptorHandle DescriptorAllocator::Allocate(std::uint32_t count)
+*  @brief     Issue a contiguous persistent range from the smallest free block that fits
+*             (the lowest index of the block is used, so a fresh allocator issues 0, 1, 2, ...)
+*  @param[in] std::uint32_t count
+*  @return @@DescriptorHandle (invalid when there is no free block large enough)
+*****************************************************************************/
+DescriptorHandle DescriptorAllocator::Allocate(std::uint32_t count)
+{
+	if (count == 0) { return DescriptorHandle(); }
+
+	auto bySize = _freeBySize.lower_bound(std::make_pair(count, 0u));
+	if (bySize == _freeBySize.end()) { ++_failedCount; return DescriptorHandle(); }
+
+	/*-------------------------------------------------------------------
+	-           Cut the head of the block
+	---------------------------------------------------------------------*/
+	const std::uint32_t index     = bySize->second;
+	const std::uint32_t freeCount = bySize->first;
+	EraseFreeRange(_freeByIndex.find(index));
+	if (freeCount > count) { InsertFreeRange(index + count, freeCount - count); }
+
+	_allocatedCount[index] = count;
+	_allocatedTotal       += count;
+	_peakAllocated         = (std::max)(_peakAllocated, _allocatedTotal);
+
+	DescriptorHandle handle;
+	handle.Index      = index;
+	handle.Count      = count;
+	handle.Generation = _generations[index];
+	return handle;
+}
+
+/****************************************************************************
+*                       Free
+*************************************************************************//**
+*  @fn        bool DescriptorAllocator::Free(const DescriptorHandle& handle, std::uint64_t retireFence)
+*  @brief     Invalidate the handle at once, and return the range to the free list after retireFence is completed.
+*             Releasing the same handle twice, a moved handle or a transient handle does nothing.
+*  @param[in] const DescriptorHandle& handle
+*  @param[in] std::uint64_t retireFence
+*  @return @@bool (true : the range will be reused)
+*****************************************************************************/
+bool DescriptorAllocator::Free(const DescriptorHandle& handle, std::uint64_t retireFence)
+{
+	if (!IsAlive(handle)) { return false; }
+
+	/*-------------------------------------------------------------------
+	-           Advance the generation (0 is skipped on the wrap around)
+	---------------------------------------------------------------------*/
+	std::uint32_t& generation = _generations[handle.Index];
+	if (++generation == 0) { generation = 1; }
+	_allocatedCount[handle.Index] = 0;
+	_allocatedTotal -= handle.Count;
+
+	_pendingRanges.push_back({ handle.Index, handle.Count, retireFence });
+	_pendingTotal += handle.Count;
+	return true;
+}
+
+/****************************************************************************
+*                       ReleaseCompleted
+*************************************************************************//**
+*  @fn        void DescriptorAllocator::ReleaseCompleted(std::uint64_t completedFence)
+*  @brief     Return the pending ranges whose fence has been completed to the free list
+*  @param[in] std::uint64_t completedFence
+*  @return @@void
+*****************************************************************************/
+void DescriptorAllocator::ReleaseCompleted(std::uint64_t completedFence)
+{
+	for (size_t i = 0; i < _pendingRanges.size();)
+	{
+		const PendingRange range = _pendingRanges[i];
+		if (range.RetireFence > completedFence) { ++i; continue; }
+
+		InsertFreeRange(range.Index, range.Count);
+		_pendingTotal -= range.Count;
+		_pendingRanges[i] = _pendingRanges.back();
+		_pendingRanges.pop_back();
+	}
+}
+
+/****************************************************************************
+*                       BeginFrame
+*************************************************************************//**
+*  @fn        void DescriptorAllocator::BeginFrame(std::uint32_t frameIndex, std::uint64_t completedFence)
+*  @brief     Release the completed ranges and reset the transient range of the frame.
+*             Call this after the GPU has finished the previous use of frameIndex.
+*  @param[in] std::uint32_t frameIndex
+*  @param[in] std::uint64_t completedFence
+*  @return @@void
+*****************************************************************************/
+void DescriptorAllocator::BeginFrame(std::uint32_t frameIndex, std::uint64_t completedFence)
+{
+	ReleaseCompleted(completedFence);
+	_frameIndex      = frameIndex % _frameCount;
+	_transientOffset = 0;
+}
+
+/****************************************************************************
+*                       AllocateTransient
+*************************************************************************//**
+*  @fn        DescriptorHandle DescriptorAllocator::AllocateTransient(std::uint32_t count)
+*  @brief     Issue a range which is valid until the next BeginFrame of the same frame index (no release)
+*  @param[in] std::uint32_t count
+*  @return @@DescriptorHandle (invalid when the range of this frame is full)
+*****************************************************************************/
+DescriptorHandle DescriptorAllocator::AllocateTransient(std::uint32_t count)
+{
+	if (count == 0) { return DescriptorHandle(); }
+	if (count > _transientCount - _transientOffset) { ++_failedCount; return DescriptorHandle(); }
+
+	DescriptorHandle handle;
+	handle.Index      = _persistentCount + _frameIndex * _transientCount + _transientOffset;
+	handle.Count      = count;
+	handle.Generation = 0;
+	_transientOffset += count;
+	_transientPeak    = (std::max)(_transientPeak, _transientOffset);
+	return handle;
+}
+
+/****************************************************************************
+*                       IsAlive
+*************************************************************************//**
+*  @fn        bool DescriptorAllocator::IsAlive(const DescriptorHandle& handle) const
+*  @brief     Whether the persistent handle has been issued and not released yet
+*  @param[in] const DescriptorHandle& handle
+*  @return @@bool
+*****************************************************************************/
+bool DescriptorAllocator::IsAlive(const DescriptorHandle& handle) const
+{
+	if (!handle.IsValid() || handle.IsTransient()) { return false; }
+	if (handle.Index >= _persistentCount)          { return false; }
+	return _allocatedCount[handle.Index] == handle.Count && _generations[handle.Index] == handle.Generation;
+}
+
+/****************************************************************************
+*                       GetStatistics
+*************************************************************************//**
+*  @fn        DescriptorAllocator::Statistics DescriptorAllocator::GetStatistics() const
+*  @brief     Usage and fragmentation of the heap range (walks the free list)
+*  @param[in] void
+*  @return @@Statistics
+*****************************************************************************/
+DescriptorAllocator::Statistics DescriptorAllocator::GetStatistics() const
+{
+	Statistics statistics;
+	statistics.PersistentCount    = _persistentCount;
+	statistics.AllocatedCount     = _allocatedTotal;
+	statistics.PeakAllocatedCount = _peakAllocated;
+	statistics.PendingCount       = _pendingTotal;
+	statistics.FreeBlockCount     = static_cast<std::uint32_t>(_freeByIndex.size());
+	statistics.LargestFreeBlock   = _freeBySize.empty() ? 0 : _freeBySize.rbegin()->first;
+	for (const auto& range : _freeByIndex) { statistics.FreeCount += range.second; }
+	statistics.Fragmentation      = statistics.FreeCount == 0 ? 0.0f
+		: 1.0f - static_cast<float>(statistics.LargestFreeBlock) / static_cast<float>(statistics.FreeCount);
+	statistics.TransientCount     = _transientCount;
+	statistics.TransientUsed      = _transientOffset;
+	statistics.TransientPeak      = _transientPeak;
+	statistics.FailedCount        = _failedCount;
+	return statistics;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       InsertFreeRange
+*************************************************************************//**
+*  @fn        void DescriptorAllocator::InsertFreeRange(std::uint32_t index, std::uint32_t count)
+*  @brief     Add the range to the free list and merge it with the adjacent free blocks
+*  @param[in] std::uint32_t index
+*  @param[in] std::uint32_t count
+*  @return @@void
+*****************************************************************************/
+void DescriptorAllocator::InsertFreeRange(std::uint32_t index, std::uint32_t count)
+{
+	/*-------------------------------------------------------------------
+	-           Merge with the next block
+	---------------------------------------------------------------------*/
+	auto next = _freeByIndex.lower_bound(index);
+	if (next != _freeByIndex.end() && next->first == index + count)
+	{
+		count += next->second;
+		EraseFreeRange(next);
+	}
+
+	/*-------------------------------------------------------------------
+	-           Merge with the previous block
+	---------------------------------------------------------------------*/
+	auto previous = _freeByIndex.lower_bound(index);
+	if (previous != _freeByIndex.begin())
+	{
+		--previous;
+		if (previous->first + previous->second == index)
+		{
+			index  = previous->first;
+			count += previous->second;
+			EraseFreeRange(previous);
+		}
+	}
+
+	_freeByIndex.emplace(index, count);
+	_freeBySize .emplace(count, index);
+}
+
+void DescriptorAllocator::EraseFreeRange(std::map<std::uint32_t, std::uint32_t>::iterator range)
+{
+	_freeBySize .erase(std::make_pair(range->second, range->first));
+	_freeByIndex.erase(range);
+}
+#pragma endregion Private Function
@@ -19,6 +19,20 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	DXGI_FORMAT GetCookedTextureFormat(const CookedTexture& cookedTexture)
+	{
+		const bool isSRGB = cookedTexture.IsSRGBFormat();
+		switch (cookedTexture.GetCompression())
+		{
+			case TextureCompression::BC1: return isSRGB ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+			case TextureCompression::BC3: return isSRGB ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+			case TextureCompression::BC7: return isSRGB ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+			default:                      return isSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+		}
+	}
+}
 //////////////////////////////////////////////////////////////////////////////////
 //                              Texture 
 //////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +47,7 @@ Texture::~Texture()
 *************************************************************************//**
 *  @fn         void TextureLoader::LoadTexture(const std::wstring& filePath, ResourceComPtr& texture)
 *  @brief      Load Texture (.tga, .dds, ,png, .jpg, .bmp, .hdr, .sph, .spa)
+*              2D textures except .dds and .hdr are loaded from the cooked texture (with the mip chain).
 *  @param[out] DirectX12& directX12,
 *  @param[in]  const std::wstring& filePath
 *  @param[out] Texture& texture
@@ -44,106 +59,208 @@ void TextureLoader::LoadTexture(const std::wstring& filePath, Texture& texture,
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_textureTableManager.Instance().TextureTable.find(filePath) != _textureTableManager.Instance().TextureTable.end())
+	const std::unique_ptr<Texture>* cached = _textureTableManager.Instance().TextureTable.Find(filePath);
+	if (cached != nullptr)
 	{
-		texture = *_textureTableManager.Instance().TextureTable[filePath].get();
+		texture = *cached->get();
 		return;
 	}
 
 	/*-------------------------------------------------------------------
 	-                Choose Extension and Load Texture Data
 	---------------------------------------------------------------------*/
-	TexMetadata  metaData     = {};
-	ScratchImage scratchImage = {};
-	bool isDXT                = false;
-	std::wstring extension    = GetExtension(filePath);
-	
-	/*-------------------------------------------------------------------
-	-    Select the appropriate texture loading function for each extension
-	---------------------------------------------------------------------*/
-	if (extension == L"tga")
+	TexMetadata   metaData      = {};
+	ScratchImage  scratchImage  = {};
+	CookedTexture cookedTexture = {};
+	bool isDXT                  = false;
+	std::wstring extension      = GetExtension(filePath);
+	std::vector<D3D12_SUBRESOURCE_DATA> subResources;
+
+	if (type == TextureType::Texture2D && extension != L"dds" && extension != L"hdr" && LoadCookedTexture(filePath, extension, cookedTexture))
 	{
-		ThrowIfFailed(LoadFromTGAFile(filePath.c_str(), TGA_FLAGS_NONE, &metaData, scratchImage));
+		/*-------------------------------------------------------------------
+		-    Cooked texture (all mips are uploaded)
+		---------------------------------------------------------------------*/
+		CreateTextureFromCookedData(directX12.GetDevice(), cookedTexture, texture.Resource, subResources);
 	}
-	else if (extension == L"dds")
+	else
 	{
-		ThrowIfFailed(LoadFromDDSFile(filePath.c_str(),DDS_FLAGS_NONE, &metaData, scratchImage));
-		isDXT = true;
+		/*-------------------------------------------------------------------
+		-    Select the appropriate texture loading function for each extension
+		---------------------------------------------------------------------*/
+		if (extension == L"tga")
+		{
+			ThrowIfFailed(LoadFromTGAFile(filePath.c_str(), TGA_FLAGS_NONE, &metaData, scratchImage));
+		}
+		else if (extension == L"dds")
+		{
+			ThrowIfFailed(LoadFromDDSFile(filePath.c_str(),DDS_FLAGS_NONE, &metaData, scratchImage));
+			isDXT = true;
+		}
+		else if (extension == L"hdr")
+		{
+			ThrowIfFailed(LoadFromHDRFile(filePath.c_str(), &metaData, scratchImage));
+		}
+		else
+		{
+			ThrowIfFailed(LoadFromWICFile(filePath.c_str(), WIC_FLAGS_NONE, &metaData, scratchImage));
+		}
+		auto image      = scratchImage.GetImage(0, 0, 0);
+		bool isDiscrete = true;
+
+		CreateTextureFromImageData(directX12.GetDevice(), image, texture.Resource, isDiscrete, &metaData);
+
+		/*-------------------------------------------------------------------
+		-                 Transmit texture buffer to GPU
+		---------------------------------------------------------------------*/
+		if (!isDiscrete)
+		{
+			ThrowIfFailed(texture.Resource->WriteToSubresource(
+				0,
+				nullptr,
+				image->pixels,
+				static_cast<UINT>(image->rowPitch),
+				static_cast<UINT>(image->slicePitch)));
+		}
+		else
+		{
+			/*-------------------------------------------------------------------
+			-                 Prepare Upload Buffer Setting
+			---------------------------------------------------------------------*/
+			ThrowIfFailed(PrepareUpload(directX12.GetDevice(), image, scratchImage.GetImageCount(), metaData, subResources));
+		}
 	}
-	else if (extension == L"hdr")
+
+	if (!subResources.empty()) { UploadTexture(texture.Resource, subResources); }
+
+	const D3D12_RESOURCE_DESC resourceDesc = texture.Resource.Get()->GetDesc();
+	RegisterTexture(filePath, texture, type, DirectX::XMFLOAT2((float)resourceDesc.Width, (float)resourceDesc.Height));
+}
+
+/****************************************************************************
+*							  LoadStreamingTexture
+*************************************************************************//**
+*  @fn         void TextureLoader::LoadStreamingTexture(const std::wstring& filePath, Texture& texture)
+*  @brief      Load only the tail mips of the cooked texture and register it to the TextureStreamer,
+*              which loads the higher mips when they are visible on the screen.
+*              Textures which cannot be streamed (.dds, .hdr, small or not cooked) are loaded by LoadTexture.
+*  @param[in]  const std::wstring& filePath
+*  @param[out] Texture& texture (texture.StreamID : stream ID for TextureStreamer::Request)
+*  @return @@ void
+*****************************************************************************/
+void TextureLoader::LoadStreamingTexture(const std::wstring& filePath, Texture& texture)
+{
+	DirectX12& directX12 = DirectX12::Instance();
+	/*-------------------------------------------------------------------
+	-               If the file is loaded once, read from it
+	---------------------------------------------------------------------*/
+	const std::unique_ptr<Texture>* cached = _textureTableManager.Instance().TextureTable.Find(filePath);
+	if (cached != nullptr)
 	{
-		ThrowIfFailed(LoadFromHDRFile(filePath.c_str(), &metaData, scratchImage));
+		texture = *cached->get();
+		return;
 	}
-	else
+
+	/*-------------------------------------------------------------------
+	-               Cooked texture which is saved in the cache
+	---------------------------------------------------------------------*/
+	TextureStreamer&      streamer        = TextureStreamer::Instance();
+	CookedTexture         cookedTexture   = {};
+	std::filesystem::path cookedFilePath;
+	const std::wstring    extension       = GetExtension(filePath);
+	if (!streamer.IsInitialized() || extension == L"dds" || extension == L"hdr"
+		|| !LoadCookedTexture(filePath, extension, cookedTexture, &cookedFilePath))
 	{
-		ThrowIfFailed(LoadFromWICFile(filePath.c_str(), WIC_FLAGS_NONE, &metaData, scratchImage));
+		LoadTexture(filePath, texture);
+		return;
 	}
-	auto image      = scratchImage.GetImage(0, 0, 0);
-	bool isDiscrete = true;
 
-	CreateTextureFromImageData(directX12.GetDevice(), image, texture.Resource, isDiscrete, &metaData);
+	/*-------------------------------------------------------------------
+	-               Upload the tail mips (all mips of a small texture)
+	---------------------------------------------------------------------*/
+	const std::uint32_t tailMip = cookedFilePath.empty() ? 0 : TextureStreamer::GetTailMip(cookedTexture);
+	std::vector<D3D12_SUBRESOURCE_DATA> subResources;
+	CreateTextureFromCookedData(directX12.GetDevice(), cookedTexture, texture.Resource, subResources, tailMip);
+	UploadTexture(texture.Resource, subResources);
 
 	/*-------------------------------------------------------------------
-	-                 Transmit texture buffer to GPU
+	-               Register (the image size is the size of the mip 0)
 	---------------------------------------------------------------------*/
-	if (!isDiscrete)
+	RegisterTexture(filePath, texture, TextureType::Texture2D, DirectX::XMFLOAT2((float)cookedTexture.Header.Width, (float)cookedTexture.Header.Height));
+	if (tailMip > 0)
 	{
-		ThrowIfFailed(texture.Resource->WriteToSubresource(
-			0,
-			nullptr,
-			image->pixels,
-			static_cast<UINT>(image->rowPitch),
-			static_cast<UINT>(image->slicePitch)));
+		texture.StreamID = streamer.Register(cookedFilePath, cookedTexture, texture.Resource, tailMip, _textureTableManager.Instance().ID);
+		_textureTableManager.Instance().TextureTable[filePath]->StreamID = texture.StreamID;
 	}
-	else
-	{
-		/*-------------------------------------------------------------------
-		-                 Prepare Upload Buffer Setting
-		---------------------------------------------------------------------*/
-		std::vector<D3D12_SUBRESOURCE_DATA> subResources;
-		ThrowIfFailed(PrepareUpload(directX12.GetDevice(), image, scratchImage.GetImageCount(), metaData, subResources));
+}
 
-		/*-------------------------------------------------------------------
-		-                 Calculate Upload Buffer Size
-		---------------------------------------------------------------------*/
-		const UINT64 uploadBufferSize = GetRequiredIntermediateSize(
-			texture.Resource.Get(), 0, static_cast<UINT>(subResources.size()));
+/****************************************************************************
+*							  UploadTexture
+*************************************************************************//**
+*  @fn         void TextureLoader::UploadTexture(const ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& subResources)
+*  @brief      Copy the sub resources into the texture buffer (waits for the GPU)
+*  @param[in]  const ResourceComPtr& textureBuffer
+*  @param[in]  std::vector<D3D12_SUBRESOURCE_DATA>& subResources
+*  @return @@ void
+*****************************************************************************/
+void TextureLoader::UploadTexture(const ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& subResources)
+{
+	DirectX12& directX12 = DirectX12::Instance();
+	/*-------------------------------------------------------------------
+	-                 Calculate Upload Buffer Size
+	---------------------------------------------------------------------*/
+	const UINT64 uploadBufferSize = GetRequiredIntermediateSize(
+		textureBuffer.Get(), 0, static_cast<UINT>(subResources.size()));
 
-		/*-------------------------------------------------------------------
-		-                 Create Upload Buffer
-		---------------------------------------------------------------------*/
-		D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_UPLOAD);
-		D3D12_RESOURCE_DESC   resourceDesc = RESOURCE_DESC::Buffer(uploadBufferSize);
-		
-		ResourceComPtr uploadBuffer = nullptr;
-		ThrowIfFailed(directX12.GetDevice()->CreateCommittedResource(
-			&heapProperty,
-			D3D12_HEAP_FLAG_NONE,
-			&resourceDesc,
-			D3D12_RESOURCE_STATE_GENERIC_READ,
-			nullptr,
-			IID_PPV_ARGS(uploadBuffer.ReleaseAndGetAddressOf())));
+	/*-------------------------------------------------------------------
+	-                 Create Upload Buffer
+	---------------------------------------------------------------------*/
+	D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_UPLOAD);
+	D3D12_RESOURCE_DESC   resourceDesc = RESOURCE_DESC::Buffer(uploadBufferSize);
+	
+	ResourceComPtr uploadBuffer = nullptr;
+	ThrowIfFailed(directX12.GetDevice()->CreateCommittedResource(
+		&heapProperty,
+		D3D12_HEAP_FLAG_NONE,
+		&resourceDesc,
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		IID_PPV_ARGS(uploadBuffer.ReleaseAndGetAddressOf())));
 
-		/*-------------------------------------------------------------------
-		-                 Copy Texture Data 
-		---------------------------------------------------------------------*/
-		UpdateSubresources(directX12.GetCommandList(),
-			texture.Resource.Get(), uploadBuffer.Get(),
-			0, 0, static_cast<unsigned int>(subResources.size()),
-			subResources.data());
+	/*-------------------------------------------------------------------
+	-                 Copy Texture Data 
+	---------------------------------------------------------------------*/
+	UpdateSubresources(directX12.GetCommandList(),
+		textureBuffer.Get(), uploadBuffer.Get(),
+		0, 0, static_cast<unsigned int>(subResources.size()),
+		subResources.data());
 
-		/*-------------------------------------------------------------------
-		-                Execute Command List
-		---------------------------------------------------------------------*/
-		directX12.GetCommandList()->Close();
-		ID3D12CommandList* commandLists[] = { directX12.GetCommandList() };
-		directX12.GetCommandQueue()->ExecuteCommandLists(_countof(commandLists), commandLists);
-		directX12.FlushCommandQueue();
-		directX12.ResetCommandList();
+	/*-------------------------------------------------------------------
+	-                Execute Command List
+	---------------------------------------------------------------------*/
+	directX12.GetCommandList()->Close();
+	ID3D12CommandList* commandLists[] = { directX12.GetCommandList() };
+	directX12.GetCommandQueue()->ExecuteCommandLists(_countof(commandLists), commandLists);
+	directX12.FlushCommandQueue();
+	directX12.ResetCommandList();
 
-		uploadBuffer = nullptr;
-	}
+	uploadBuffer = nullptr;
+}
 
+/****************************************************************************
+*							  RegisterTexture
+*************************************************************************//**
+*  @fn         void TextureLoader::RegisterTexture(const std::wstring& filePath, Texture& texture, TextureType type, const DirectX::XMFLOAT2& imageSize)
+*  @brief      Create the SRV and add the texture to the texture table
+*  @param[in]  const std::wstring& filePath
+*  @param[out] Texture& texture
+*  @param[in]  TextureType type
+*  @param[in]  const DirectX::XMFLOAT2& imageSize
+*  @return @@ void
+*****************************************************************************/
+void TextureLoader::RegisterTexture(const std::wstring& filePath, Texture& texture, TextureType type, const DirectX::XMFLOAT2& imageSize)
+{
+	DirectX12& directX12 = DirectX12::Instance();
 	/*-------------------------------------------------------------------
 	-                    Create SRV Desc
 	---------------------------------------------------------------------*/
@@ -155,7 +272,7 @@ void TextureLoader::LoadTexture(const std::wstring& filePath, Texture& texture,
 			srvDesc.Format                        = texture.Resource.Get()->GetDesc().Format;
 			srvDesc.Shader4ComponentMapping       = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 			srvDesc.ViewDimension                 = D3D12_SRV_DIMENSION_TEXTURE2D;
-			srvDesc.Texture2D.MipLevels           = 1;
+			srvDesc.Texture2D.MipLevels           = texture.Resource.Get()->GetDesc().MipLevels;
 			srvDesc.Texture2D.PlaneSlice          = 0;
 			srvDesc.Texture2D.MostDetailedMip     = 0;
 			srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
@@ -183,7 +300,7 @@ void TextureLoader::LoadTexture(const std::wstring& filePath, Texture& texture,
 	addTexture.Resource   = texture.Resource;
 	addTexture.Format     = texture.Resource.Get()->GetDesc().Format;
 	addTexture.GPUHandler = directX12.GetGPUResourceView(HeapType::SRV, _textureTableManager.Instance().ID);
-	addTexture.ImageSize  = DirectX::XMFLOAT2((float)image->width, (float)image->height);
+	addTexture.ImageSize  = imageSize;
 	addTexture.Resource->SetName(filePath.c_str());
 	/*-------------------------------------------------------------------
 	-                    Add texture table
@@ -246,4 +363,121 @@ void TextureLoader::CreateTextureFromImageData(Device* device, const DirectX::Im
 			IID_PPV_ARGS(textureBuffer.ReleaseAndGetAddressOf())));
 	}
 	
+}
+/****************************************************************************
+*					    CreateTextureFromCookedData
+*************************************************************************//**
+*  @fn         void TextureLoader::CreateTextureFromCookedData(Device* device, const CookedTexture& cookedTexture, ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& outSubResources, std::uint32_t firstMip)
+*  @brief      Create the texture with the mips [firstMip, MipCount) of the cooked texture, and point the sub resources at the mip data
+*  @param[out] Device* device
+*  @param[in]  const CookedTexture& cookedTexture
+*  @param[out] ResourceComPtr& textureBuffer
+*  @param[out] std::vector<D3D12_SUBRESOURCE_DATA>& outSubResources (valid while the cooked texture lives)
+*  @param[in]  std::uint32_t firstMip (the mip 0 of the texture)
+*  @return @@ void
+*****************************************************************************/
+void TextureLoader::CreateTextureFromCookedData(Device* device, const CookedTexture& cookedTexture, ResourceComPtr& textureBuffer, std::vector<D3D12_SUBRESOURCE_DATA>& outSubResources, std::uint32_t firstMip)
+{
+	const CookedTextureMip& top       = cookedTexture.Mips[firstMip];
+	const UINT              mipLevels = cookedTexture.Header.MipCount - firstMip;
+	D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_DEFAULT);
+	D3D12_RESOURCE_DESC   resourceDesc = RESOURCE_DESC::Texture2D(GetCookedTextureFormat(cookedTexture), (UINT64)top.Width, (UINT)top.Height, 1, (UINT16)mipLevels);
+
+	ThrowIfFailed(device->CreateCommittedResource(
+		&heapProperty,
+		D3D12_HEAP_FLAG_NONE,
+		&resourceDesc,
+		D3D12_RESOURCE_STATE_COPY_DEST,
+		nullptr,
+		IID_PPV_ARGS(textureBuffer.ReleaseAndGetAddressOf())));
+
+	outSubResources.resize(mipLevels);
+	for (UINT i = 0; i < mipLevels; ++i)
+	{
+		outSubResources[i].pData      = cookedTexture.GetMipData(firstMip + i);
+		outSubResources[i].RowPitch   = static_cast<LONG_PTR>(cookedTexture.Mips[firstMip + i].RowPitch);
+		outSubResources[i].SlicePitch = static_cast<LONG_PTR>(cookedTexture.Mips[firstMip + i].Size);
+	}
+}
+
+/****************************************************************************
+*					    LoadCookedTexture
+*************************************************************************//**
+*  @fn         bool TextureLoader::LoadCookedTexture(const std::wstring& filePath, const std::wstring& extension, CookedTexture& outTexture, std::filesystem::path* outCookedFilePath)
+*  @brief      Load the cooked texture of the source file from TEXTURE_COOK_CACHE_DIRECTORY.
+*              When it is not cooked yet, decode the source, build the mip chain and save it for the next launch.
+*  @param[in]  const std::wstring& filePath
+*  @param[in]  const std::wstring& extension
+*  @param[out] CookedTexture& outTexture
+*  @param[out] std::filesystem::path* outCookedFilePath (the cache file, empty when it could not be saved)
+*  @return @@ bool (false : unsupported format, load it as before)
+*****************************************************************************/
+bool TextureLoader::LoadCookedTexture(const std::wstring& filePath, const std::wstring& extension, CookedTexture& outTexture, std::filesystem::path* outCookedFilePath)
+{
+	/*-------------------------------------------------------------------
+	-                 Source hash
+	---------------------------------------------------------------------*/
+	std::vector<std::uint8_t> source;
+	if (!TextureCookCache::ReadFile(filePath, source)) { return false; }
+
+	TextureCookSettings settings;
+	settings.Compression = TEXTURE_COOK_COMPRESSION;
+	const std::uint64_t sourceHash = TextureCooker::HashSource(source.data(), source.size(), settings);
+
+	TextureCookCache cache;
+	cache.SetDirectory(TEXTURE_COOK_CACHE_DIRECTORY);
+	if (outCookedFilePath != nullptr) { outCookedFilePath->clear(); }
+	if (cache.Load(sourceHash, outTexture))
+	{
+		if (outCookedFilePath != nullptr) { *outCookedFilePath = cache.GetFilePath(sourceHash); }
+		return true;
+	}
+
+	/*-------------------------------------------------------------------
+	-                 Decode the source bytes
+	---------------------------------------------------------------------*/
+	TexMetadata  metaData     = {};
+	ScratchImage scratchImage = {};
+	const HRESULT result = extension == L"tga"
+		? LoadFromTGAMemory(source.data(), source.size(), TGA_FLAGS_NONE, &metaData, scratchImage)
+		: LoadFromWICMemory(source.data(), source.size(), WIC_FLAGS_NONE, &metaData, scratchImage);
+	if (FAILED(result)) { return false; }
+
+	/*-------------------------------------------------------------------
+	-     Only 8 bit RGBA (BGRA is swizzled). Other formats keep the former path.
+	---------------------------------------------------------------------*/
+	const Image* image = scratchImage.GetImage(0, 0, 0);
+	bool isSRGB = false;
+	switch (image->format)
+	{
+		case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB: case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB: case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+			isSRGB = true;
+			break;
+		case DXGI_FORMAT_R8G8B8A8_UNORM: case DXGI_FORMAT_B8G8R8A8_UNORM: case DXGI_FORMAT_B8G8R8X8_UNORM:
+			break;
+		default:
+			return false;
+	}
+
+	ScratchImage convertedImage = {};
+	const DXGI_FORMAT format = isSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+	if (image->format != format)
+	{
+		if (FAILED(Convert(*image, format, TEX_FILTER_DEFAULT, TEX_THRESHOLD_DEFAULT, convertedImage))) { return false; }
+		image = convertedImage.GetImage(0, 0, 0);
+	}
+
+	/*-------------------------------------------------------------------
+	-                 Cook and save
+	---------------------------------------------------------------------*/
+	settings.IsSRGBFormat = isSRGB;
+	TextureCooker cooker;
+	if (!cooker.Cook(image->pixels, static_cast<std::uint32_t>(image->width), static_cast<std::uint32_t>(image->height),
+		static_cast<std::uint32_t>(image->rowPitch), sourceHash, settings, outTexture))
+	{
+		return false;
+	}
+	// a read only directory only costs the cook on the next launch
+	if (cache.Save(outTexture) && outCookedFilePath != nullptr) { *outCookedFilePath = cache.GetFilePath(sourceHash); }
+	return true;
 }
\ No newline at end of file
@@ -0,0 +1,1027 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureCooker.cpp
+///             @brief  Mip chain, block compression and cooked texture cache (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12TextureCooker.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <atomic>
+#include <cstring>
+#include <climits>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr float        KAISER_WIDTH      = 3.0f;   // radius in destination texels
+	constexpr float        KAISER_ALPHA      = 4.0f;
+	constexpr std::int32_t ENCODE_TABLE_SIZE = 65536;  // linear [0, 1] -> 8 bit
+	constexpr std::uint64_t DATA_ALIGNMENT   = 16;
+
+	std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+	/*-------------------------------------------------------------------
+	-               Color conversion tables
+	---------------------------------------------------------------------*/
+	struct ColorTable
+	{
+		float        SRGBToLinear [256];
+		float        UNormToLinear[256];
+		std::uint8_t LinearToSRGB [ENCODE_TABLE_SIZE];
+	};
+
+	void BuildColorTable(ColorTable& table)
+	{
+		for (int i = 0; i < 256; ++i)
+		{
+			const double value = i / 255.0;
+			table.SRGBToLinear [i] = static_cast<float>(value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4));
+			table.UNormToLinear[i] = static_cast<float>(value);
+		}
+		for (int i = 0; i < ENCODE_TABLE_SIZE; ++i)
+		{
+			const double linear = static_cast<double>(i) / (ENCODE_TABLE_SIZE - 1);
+			const double srgb   = linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+			table.LinearToSRGB[i] = static_cast<std::uint8_t>((std::min)(255.0, srgb * 255.0 + 0.5));
+		}
+	}
+
+	/* built once (thread safe static initialization) */
+	const ColorTable& GetColorTable()
+	{
+		static ColorTable table;
+		static const bool isBuilt = []() { BuildColorTable(table); return true; }();
+		(void)isBuilt;
+		return table;
+	}
+
+	/*-------------------------------------------------------------------
+	-               Kaiser window
+	---------------------------------------------------------------------*/
+	double BesselI0(double x)
+	{
+		double sum  = 1.0;
+		double term = 1.0;
+		for (int k = 1; k < 32; ++k)
+		{
+			term *= (x * 0.5 / k) * (x * 0.5 / k);
+			sum  += term;
+			if (term < sum * 1e-12) { break; }
+		}
+		return sum;
+	}
+
+	double KaiserSinc(double x)
+	{
+		const double ratio = x / KAISER_WIDTH;
+		if (ratio * ratio >= 1.0) { return 0.0; }
+		const double pi     = 3.14159265358979323846;
+		const double sinc   = std::fabs(x) < 1e-6 ? 1.0 : std::sin(pi * x) / (pi * x);
+		return sinc * BesselI0(KAISER_ALPHA * std::sqrt(1.0 - ratio * ratio)) / BesselI0(KAISER_ALPHA);
+	}
+
+	/*-------------------------------------------------------------------
+	-               Block compression helpers
+	---------------------------------------------------------------------*/
+	using Block = std::uint8_t[16][4];
+
+	/* principal axis of the pixels (power iteration on the covariance) */
+	void FitAxis(const Block& block, const bool* isUsed, int channelCount, float* outMean, float* outAxis)
+	{
+		float mean[4] = {}; int count = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			if (!isUsed[i]) { continue; }
+			for (int c = 0; c < channelCount; ++c) { mean[c] += block[i][c]; }
+			++count;
+		}
+		for (int c = 0; c < channelCount; ++c) { mean[c] /= (std::max)(count, 1); }
+
+		float covariance[4][4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			if (!isUsed[i]) { continue; }
+			float d[4] = {};
+			for (int c = 0; c < channelCount; ++c) { d[c] = block[i][c] - mean[c]; }
+			for (int r = 0; r < channelCount; ++r)
+			{
+				for (int c = 0; c < channelCount; ++c) { covariance[r][c] += d[r] * d[c]; }
+			}
+		}
+
+		/*--- - start from the row of the largest variance ---*/
+		int largest = 0;
+		for (int c = 1; c < channelCount; ++c) { if (covariance[c][c] > covariance[largest][largest]) { largest = c; } }
+		float axis[4] = {};
+		for (int c = 0; c < channelCount; ++c) { axis[c] = covariance[largest][c]; }
+		for (int iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[4] = {}; float length = 0.0f;
+			for (int r = 0; r < channelCount; ++r)
+			{
+				for (int c = 0; c < channelCount; ++c) { next[r] += covariance[r][c] * axis[c]; }
+				length += next[r] * next[r];
+			}
+			if (length <= 1e-12f) { break; }
+			length = 1.0f / std::sqrt(length);
+			for (int c = 0; c < channelCount; ++c) { axis[c] = next[c] * length; }
+		}
+		for (int c = 0; c < 4; ++c) { outMean[c] = c < channelCount ? mean[c] : 0.0f; outAxis[c] = c < channelCount ? axis[c] : 0.0f; }
+	}
+
+	/* both ends of the pixels projected on the axis */
+	void FitEndPoints(const Block& block, const bool* isUsed, int channelCount, float* outStart, float* outEnd)
+	{
+		float mean[4], axis[4];
+		FitAxis(block, isUsed, channelCount, mean, axis);
+		float minimum = 0.0f, maximum = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			if (!isUsed[i]) { continue; }
+			float t = 0.0f;
+			for (int c = 0; c < channelCount; ++c) { t += (block[i][c] - mean[c]) * axis[c]; }
+			minimum = (std::min)(minimum, t);
+			maximum = (std::max)(maximum, t);
+		}
+		for (int c = 0; c < channelCount; ++c)
+		{
+			outStart[c] = std::clamp(mean[c] + minimum * axis[c], 0.0f, 255.0f);
+			outEnd  [c] = std::clamp(mean[c] + maximum * axis[c], 0.0f, 255.0f);
+		}
+	}
+
+	/* least squares end points for the fixed indices (weight : ratio of the end) */
+	bool RefineEndPoints(const Block& block, const bool* isUsed, const int* indices, const float* weights, int channelCount, float* outStart, float* outEnd)
+	{
+		float a = 0.0f, b = 0.0f, c = 0.0f, x[4] = {}, y[4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			if (!isUsed[i]) { continue; }
+			const float t = weights[indices[i]];
+			const float s = 1.0f - t;
+			a += s * s; b += s * t; c += t * t;
+			for (int k = 0; k < channelCount; ++k) { x[k] += s * block[i][k]; y[k] += t * block[i][k]; }
+		}
+		const float determinant = a * c - b * b;
+		if (std::fabs(determinant) < 1e-6f) { return false; }
+		for (int k = 0; k < channelCount; ++k)
+		{
+			outStart[k] = std::clamp((c * x[k] - b * y[k]) / determinant, 0.0f, 255.0f);
+			outEnd  [k] = std::clamp((a * y[k] - b * x[k]) / determinant, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	/*-------------------------------------------------------------------
+	-               BC1 color block
+	---------------------------------------------------------------------*/
+	std::uint16_t ToRGB565(const float* color)
+	{
+		const int r = static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f);
+		const int g = static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f);
+		const int b = static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f);
+		return static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	void FromRGB565(std::uint16_t value, int* outColor)
+	{
+		const int r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+		outColor[0] = (r << 3) | (r >> 2);
+		outColor[1] = (g << 2) | (g >> 4);
+		outColor[2] = (b << 3) | (b >> 2);
+	}
+
+	/* return the squared error. isThreeColor : palette (c0, c1, 1/2, transparent) */
+	int AssignColorIndices(const Block& block, const bool* isUsed, std::uint16_t color0, std::uint16_t color1, bool isThreeColor, int* outIndices)
+	{
+		int palette[4][3];
+		FromRGB565(color0, palette[0]);
+		FromRGB565(color1, palette[1]);
+		for (int c = 0; c < 3; ++c)
+		{
+			if (isThreeColor) { palette[2][c] = (palette[0][c] + palette[1][c]) / 2; palette[3][c] = 0; }
+			else              { palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3; palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3; }
+		}
+
+		const int paletteCount = isThreeColor ? 3 : 4;
+		int totalError = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			if (!isUsed[i]) { outIndices[i] = 3; continue; }
+			int bestError = INT32_MAX;
+			for (int p = 0; p < paletteCount; ++p)
+			{
+				int error = 0;
+				for (int c = 0; c < 3; ++c) { const int d = block[i][c] - palette[p][c]; error += d * d; }
+				if (error < bestError) { bestError = error; outIndices[i] = p; }
+			}
+			totalError += bestError;
+		}
+		return totalError;
+	}
+
+	/* isThreeColor : pixels with alpha < 128 are transparent (BC1 only) */
+	void EncodeColorBlock(const Block& block, bool isThreeColor, std::uint8_t* out)
+	{
+		bool isUsed[16]; int usedCount = 0;
+		for (int i = 0; i < 16; ++i) { isUsed[i] = !isThreeColor || block[i][3] >= 128; usedCount += isUsed[i]; }
+
+		std::uint16_t color0 = 0, color1 = 0;
+		int indices[16] = {};
+		if (usedCount == 0) { for (int i = 0; i < 16; ++i) { indices[i] = 3; } }
+		else
+		{
+			/*--- - fit the axis, then refine the end points with the indices ---*/
+			float start[4], end[4];
+			FitEndPoints(block, isUsed, 3, start, end);
+			color0 = ToRGB565(start);
+			color1 = ToRGB565(end);
+			int bestError = AssignColorIndices(block, isUsed, color0, color1, isThreeColor, indices);
+
+			const float fourWeights [4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+			const float threeWeights[4] = { 0.0f, 1.0f, 0.5f, 0.0f };
+			for (int iteration = 0; iteration < 2 && bestError > 0; ++iteration)
+			{
+				if (!RefineEndPoints(block, isUsed, indices, isThreeColor ? threeWeights : fourWeights, 3, start, end)) { break; }
+				const std::uint16_t newColor0 = ToRGB565(start);
+				const std::uint16_t newColor1 = ToRGB565(end);
+				int newIndices[16];
+				const int error = AssignColorIndices(block, isUsed, newColor0, newColor1, isThreeColor, newIndices);
+				if (error >= bestError) { break; }
+				bestError = error; color0 = newColor0; color1 = newColor1;
+				std::memcpy(indices, newIndices, sizeof(indices));
+			}
+
+			/*--- - the order of the end points selects the mode (four colors : c0 > c1) ---*/
+			const bool isSwap = isThreeColor ? color0 > color1 : color0 < color1;
+			if (isSwap)
+			{
+				std::swap(color0, color1);
+				for (int i = 0; i < 16; ++i)
+				{
+					if      (indices[i] < 2)  { indices[i] ^= 1; }
+					else if (!isThreeColor)   { indices[i] ^= 1; } // 2 <-> 3
+				}
+			}
+			if (!isThreeColor && color0 == color1) { for (int i = 0; i < 16; ++i) { indices[i] = 0; } }
+		}
+
+		std::uint32_t bits = 0;
+		for (int i = 0; i < 16; ++i) { bits |= static_cast<std::uint32_t>(indices[i]) << (i * 2); }
+		out[0] = static_cast<std::uint8_t>(color0); out[1] = static_cast<std::uint8_t>(color0 >> 8);
+		out[2] = static_cast<std::uint8_t>(color1); out[3] = static_cast<std::uint8_t>(color1 >> 8);
+		std::memcpy(out + 4, &bits, sizeof(bits));
+	}
+
+	/*-------------------------------------------------------------------
+	-               BC3 alpha block
+	---------------------------------------------------------------------*/
+	void EncodeAlphaBlock(const Block& block, std::uint8_t* out)
+	{
+		int alpha0 = 0, alpha1 = 255;
+		for (int i = 0; i < 16; ++i) { alpha0 = (std::max)(alpha0, static_cast<int>(block[i][3])); alpha1 = (std::min)(alpha1, static_cast<int>(block[i][3])); }
+
+		/*--- - eight interpolated values (alpha0 > alpha1) ---*/
+		int palette[8] = { alpha0, alpha1 };
+		for (int i = 2; i < 8; ++i) { palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7; }
+
+		std::uint64_t bits = 0;
+		for (int i = 0; i < 16 && alpha0 != alpha1; ++i)
+		{
+			int best = 0, bestError = INT32_MAX;
+			for (int p = 0; p < 8; ++p)
+			{
+				const int error = std::abs(block[i][3] - palette[p]);
+				if (error < bestError) { bestError = error; best = p; }
+			}
+			bits |= static_cast<std::uint64_t>(best) << (i * 3);
+		}
+		out[0] = static_cast<std::uint8_t>(alpha0);
+		out[1] = static_cast<std::uint8_t>(alpha1);
+		for (int i = 0; i < 6; ++i) { out[2 + i] = static_cast<std::uint8_t>(bits >> (i * 8)); }
+	}
+
+	/*-------------------------------------------------------------------
+	-               BC7 mode 6 (RGBA 7 bit + p bit end points, 4 bit indices)
+	---------------------------------------------------------------------*/
+	constexpr int BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	/* 7 bit + shared p bit which is the closest to the color */
+	void QuantizeBC7EndPoint(const float* color, int* outQuantized, int* outPBit)
+	{
+		float bestError = 1e30f;
+		for (int pBit = 0; pBit < 2; ++pBit)
+		{
+			int quantized[4]; float error = 0.0f;
+			for (int c = 0; c < 4; ++c)
+			{
+				quantized[c] = std::clamp(static_cast<int>((color[c] - pBit) * 0.5f + 0.5f), 0, 127);
+				const float d = static_cast<float>((quantized[c] << 1) | pBit) - color[c];
+				error += d * d;
+			}
+			if (error < bestError) { bestError = error; *outPBit = pBit; std::memcpy(outQuantized, quantized, sizeof(quantized)); }
+		}
+	}
+
+	int AssignBC7Indices(const Block& block, const int* quantized0, int pBit0, const int* quantized1, int pBit1, int* outIndices)
+	{
+		int palette[16][4];
+		for (int c = 0; c < 4; ++c)
+		{
+			const int e0 = (quantized0[c] << 1) | pBit0;
+			const int e1 = (quantized1[c] << 1) | pBit1;
+			for (int p = 0; p < 16; ++p) { palette[p][c] = ((64 - BC7_WEIGHTS[p]) * e0 + BC7_WEIGHTS[p] * e1 + 32) >> 6; }
+		}
+		int totalError = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			int bestError = INT32_MAX;
+			for (int p = 0; p < 16; ++p)
+			{
+				int error = 0;
+				for (int c = 0; c < 4; ++c) { const int d = block[i][c] - palette[p][c]; error += d * d; }
+				if (error < bestError) { bestError = error; outIndices[i] = p; }
+			}
+			totalError += bestError;
+		}
+		return totalError;
+	}
+
+	struct BitWriter
+	{
+		std::uint64_t Bits[2] = {};
+		int           Offset  = 0;
+		void Write(std::uint32_t value, int count)
+		{
+			for (int i = 0; i < count; ++i, ++Offset)
+			{
+				if ((value >> i) & 1) { Bits[Offset >> 6] |= 1ull << (Offset & 63); }
+			}
+		}
+	};
+
+	void EncodeBC7Block(const Block& block, std::uint8_t* out)
+	{
+		bool isUsed[16];
+		for (int i = 0; i < 16; ++i) { isUsed[i] = true; }
+
+		float start[4], end[4];
+		FitEndPoints(block, isUsed, 4, start, end);
+		int quantized[2][4], pBit[2], indices[16];
+		QuantizeBC7EndPoint(start, quantized[0], &pBit[0]);
+		QuantizeBC7EndPoint(end  , quantized[1], &pBit[1]);
+		int bestError = AssignBC7Indices(block, quantized[0], pBit[0], quantized[1], pBit[1], indices);
+
+		float weights[16];
+		for (int p = 0; p < 16; ++p) { weights[p] = BC7_WEIGHTS[p] / 64.0f; }
+		for (int iteration = 0; iteration < 2 && bestError > 0; ++iteration)
+		{
+			if (!RefineEndPoints(block, isUsed, indices, weights, 4, start, end)) { break; }
+			int newQuantized[2][4], newPBit[2], newIndices[16];
+			QuantizeBC7EndPoint(start, newQuantized[0], &newPBit[0]);
+			QuantizeBC7EndPoint(end  , newQuantized[1], &newPBit[1]);
+			const int error = AssignBC7Indices(block, newQuantized[0], newPBit[0], newQuantized[1], newPBit[1], newIndices);
+			if (error >= bestError) { break; }
+			bestError = error;
+			std::memcpy(quantized, newQuantized, sizeof(quantized));
+			std::memcpy(pBit, newPBit, sizeof(pBit));
+			std::memcpy(indices, newIndices, sizeof(indices));
+		}
+
+		/*--- - the msb of the first index is implicit 0 ---*/
+		if (indices[0] & 8)
+		{
+			std::swap(quantized[0], quantized[1]);
+			std::swap(pBit[0], pBit[1]);
+			for (int i = 0; i < 16; ++i) { indices[i] = 15 - indices[i]; }
+		}
+
+		BitWriter writer;
+		writer.Write(1 << 6, 7); // mode 6
+		for (int c = 0; c < 4; ++c)
+		{
+			writer.Write(quantized[0][c], 7);
+			writer.Write(quantized[1][c], 7);
+		}
+		writer.Write(pBit[0], 1);
+		writer.Write(pBit[1], 1);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < 16; ++i) { writer.Write(indices[i], 4); }
+		std::memcpy(out, writer.Bits, 16);
+	}
+
+	std::uint32_t GetBlockSize(TextureCompression compression)
+	{
+		return compression == TextureCompression::BC1 ? 8 : 16;
+	}
+
+	/*-------------------------------------------------------------------
+	-               Hash (murmur3 style, 8 bytes per step)
+	---------------------------------------------------------------------*/
+	std::uint64_t RotateLeft(std::uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+	struct Hasher
+	{
+		std::uint64_t Value = 0x9E3779B97F4A7C15ull;
+		void Mix(std::uint64_t block)
+		{
+			block *= 0x87C37B91114253D5ull;
+			block  = RotateLeft(block, 31);
+			block *= 0x4CF5AD432745937Full;
+			Value ^= block;
+			Value  = RotateLeft(Value, 27) * 5 + 0x52DCE729;
+		}
+		std::uint64_t Finish()
+		{
+			std::uint64_t hash = Value;
+			hash ^= hash >> 33; hash *= 0xFF51AFD7ED558CCDull;
+			hash ^= hash >> 33; hash *= 0xC4CEB9FE1A85EC53ull;
+			hash ^= hash >> 33;
+			return hash;
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region TextureCooker
+/****************************************************************************
+*                       Cook
+*************************************************************************//**
+*  @fn        bool TextureCooker::Cook(const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch, std::uint64_t sourceHash, const TextureCookSettings& settings, CookedTexture& outTexture)
+*  @brief     Build the mip chain and the file image.
+*             Each level is resampled from the previous linear level (mip 1 from the 8 bit texels).
+*  @param[in] const std::uint8_t* rgba (R8G8B8A8)
+*  @param[in] std::uint32_t width
+*  @param[in] std::uint32_t height
+*  @param[in] std::uint32_t rowPitch
+*  @param[in] std::uint64_t sourceHash
+*  @param[in] const TextureCookSettings& settings
+*  @param[out]CookedTexture& outTexture
+*  @return @@bool
+*****************************************************************************/
+bool TextureCooker::Cook(const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch,
+	std::uint64_t sourceHash, const TextureCookSettings& settings, CookedTexture& outTexture)
+{
+	if (rgba == nullptr || width == 0 || height == 0 || rowPitch < width * 4) { return false; }
+
+	/*-------------------------------------------------------------------
+	-              Layout of the file
+	---------------------------------------------------------------------*/
+	TextureCompression compression = settings.Compression;
+	if (width % 4 != 0 || height % 4 != 0) { compression = TextureCompression::None; } // D3D12 needs the block aligned top mip
+	std::uint32_t mipCount = GetFullMipCount(width, height);
+	if (settings.MaxMipCount != 0) { mipCount = (std::min)(mipCount, settings.MaxMipCount); }
+
+	CookedTextureHeader header;
+	header.SourceHash  = sourceHash;
+	header.Width       = width;
+	header.Height      = height;
+	header.MipCount    = mipCount;
+	header.Compression = static_cast<std::uint32_t>(compression);
+	header.Flags       = settings.IsSRGBFormat ? COOKED_TEXTURE_FLAG_SRGB_FORMAT : 0;
+
+	std::vector<CookedTextureMip> mips(mipCount);
+	std::uint64_t offset = AlignUp(sizeof(CookedTextureHeader) + sizeof(CookedTextureMip) * mipCount, DATA_ALIGNMENT);
+	for (std::uint32_t i = 0; i < mipCount; ++i)
+	{
+		CookedTextureMip& mip = mips[i];
+		mip.Width  = (std::max)(width  >> i, 1u);
+		mip.Height = (std::max)(height >> i, 1u);
+		if (compression == TextureCompression::None)
+		{
+			mip.RowPitch = mip.Width * 4;
+			mip.RowCount = mip.Height;
+		}
+		else
+		{
+			mip.RowPitch = ((mip.Width + 3) / 4) * GetBlockSize(compression);
+			mip.RowCount = (mip.Height + 3) / 4;
+		}
+		mip.Offset = offset;
+		mip.Size   = static_cast<std::uint64_t>(mip.RowPitch) * mip.RowCount;
+		offset     = AlignUp(offset + mip.Size, DATA_ALIGNMENT);
+	}
+
+	outTexture.Data.assign(offset, 0);
+	std::memcpy(outTexture.Data.data(), &header, sizeof(header));
+	std::memcpy(outTexture.Data.data() + sizeof(header), mips.data(), sizeof(CookedTextureMip) * mipCount);
+	outTexture.Header = header;
+	outTexture.Mips   = std::move(mips);
+
+	/*-------------------------------------------------------------------
+	-              Mip 0 (the source texels as they are)
+	---------------------------------------------------------------------*/
+	std::uint8_t* destination = outTexture.Data.data() + outTexture.Mips[0].Offset;
+	if (compression == TextureCompression::None)
+	{
+		for (std::uint32_t y = 0; y < height; ++y) { std::memcpy(destination + static_cast<std::size_t>(y) * width * 4, rgba + static_cast<std::size_t>(y) * rowPitch, static_cast<std::size_t>(width) * 4); }
+	}
+	else
+	{
+		CompressLevel(rgba, rowPitch, width, height, compression, destination);
+	}
+
+	/*-------------------------------------------------------------------
+	-              Lower mips
+	---------------------------------------------------------------------*/
+	for (std::uint32_t i = 1; i < mipCount; ++i)
+	{
+		const CookedTextureMip& source = outTexture.Mips[i - 1];
+		const CookedTextureMip& mip    = outTexture.Mips[i];
+		std::vector<float>& current    = _levels[i & 1];
+		current.resize(static_cast<std::size_t>(mip.Width) * mip.Height * 4);
+		ResampleLevel(i == 1 ? rgba : nullptr, rowPitch, i == 1 ? nullptr : _levels[(i - 1) & 1].data(),
+			source.Width, source.Height, mip.Width, mip.Height, settings, current.data());
+
+		destination = outTexture.Data.data() + mip.Offset;
+		if (compression == TextureCompression::None)
+		{
+			EncodeLevel(current.data(), mip.Width, mip.Height, settings, destination);
+		}
+		else
+		{
+			_texels.resize(static_cast<std::size_t>(mip.Width) * mip.Height * 4);
+			EncodeLevel(current.data(), mip.Width, mip.Height, settings, _texels.data());
+			CompressLevel(_texels.data(), mip.Width * 4, mip.Width, mip.Height, compression, destination);
+		}
+	}
+	return true;
+}
+
+/****************************************************************************
+*                       Parse
+*************************************************************************//**
+*  @fn        bool TextureCooker::Parse(std::vector<std::uint8_t>&& data, CookedTexture& outTexture)
+*  @brief     Check the header and the mip table, then keep the file image in the texture
+*  @param[in] std::vector<std::uint8_t>&& data
+*  @param[out]CookedTexture& outTexture
+*  @return @@bool (false : broken or old file)
+*****************************************************************************/
+bool TextureCooker::Parse(std::vector<std::uint8_t>&& data, CookedTexture& outTexture)
+{
+	CookedTextureHeader header;
+	if (data.size() < sizeof(header)) { return false; }
+	std::memcpy(&header, data.data(), sizeof(header));
+	if (header.Magic != COOKED_TEXTURE_MAGIC || header.Version != COOKED_TEXTURE_VERSION) { return false; }
+	if (header.Width == 0 || header.Height == 0 || header.MipCount == 0 || header.MipCount > GetFullMipCount(header.Width, header.Height)) { return false; }
+	if (header.Compression > static_cast<std::uint32_t>(TextureCompression::BC7)) { return false; }
+	if (data.size() < sizeof(header) + sizeof(CookedTextureMip) * header.MipCount) { return false; }
+
+	std::vector<CookedTextureMip> mips(header.MipCount);
+	std::memcpy(mips.data(), data.data() + sizeof(header), sizeof(CookedTextureMip) * header.MipCount);
+	for (std::uint32_t i = 0; i < header.MipCount; ++i)
+	{
+		const CookedTextureMip& mip = mips[i];
+		if (mip.Width != (std::max)(header.Width >> i, 1u) || mip.Height != (std::max)(header.Height >> i, 1u)) { return false; }
+		if (mip.Size != static_cast<std::uint64_t>(mip.RowPitch) * mip.RowCount)                                 { return false; }
+		if (mip.Offset > data.size() || mip.Size > data.size() - mip.Offset)                                     { return false; }
+	}
+
+	outTexture.Header = header;
+	outTexture.Mips   = std::move(mips);
+	outTexture.Data   = std::move(data);
+	return true;
+}
+
+/****************************************************************************
+*                       HashSource
+*************************************************************************//**
+*  @fn        std::uint64_t TextureCooker::HashSource(const void* data, std::size_t size, const TextureCookSettings& settings)
+*  @brief     Cache key of the source file. The settings and the file version are mixed,
+*             so that changing them does not hit the old files.
+*  @param[in] const void* data
+*  @param[in] std::size_t size
+*  @param[in] const TextureCookSettings& settings
+*  @return @@std::uint64_t
+*****************************************************************************/
+std::uint64_t TextureCooker::HashSource(const void* data, std::size_t size, const TextureCookSettings& settings)
+{
+	Hasher hasher;
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+	std::size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		std::uint64_t block;
+		std::memcpy(&block, bytes + i, sizeof(block));
+		hasher.Mix(block);
+	}
+	std::uint64_t tail = 0;
+	for (std::size_t k = 0; i + k < size; ++k) { tail |= static_cast<std::uint64_t>(bytes[i + k]) << (k * 8); }
+	hasher.Mix(tail);
+	hasher.Mix(static_cast<std::uint64_t>(size));
+	hasher.Mix(static_cast<std::uint64_t>(settings.Filter) | (static_cast<std::uint64_t>(settings.Compression) << 8)
+		| (static_cast<std::uint64_t>(settings.IsSRGB) << 16) | (static_cast<std::uint64_t>(settings.IsAlphaWeighted) << 17)
+		| (static_cast<std::uint64_t>(settings.MaxMipCount) << 24) | (static_cast<std::uint64_t>(COOKED_TEXTURE_VERSION) << 32));
+	return hasher.Finish();
+}
+
+std::uint32_t TextureCooker::GetFullMipCount(std::uint32_t width, std::uint32_t height)
+{
+	std::uint32_t size  = (std::max)(width, height);
+	std::uint32_t count = 1;
+	while (size > 1) { size >>= 1; ++count; }
+	return count;
+}
+
+#pragma region Private Function
+/****************************************************************************
+*                       BuildTaps
+*************************************************************************//**
+*  @fn        void TextureCooker::BuildTaps(TextureMipFilter filter, std::uint32_t sourceSize, std::uint32_t destinationSize, FilterTaps& outTaps)
+*  @brief     Normalized weights of the source texels for each destination texel.
+*             Out of range texels are clamped to the edge. Short tap lists are padded with zero weights.
+*  @param[in] TextureMipFilter filter
+*  @param[in] std::uint32_t sourceSize
+*  @param[in] std::uint32_t destinationSize
+*  @param[out]FilterTaps& outTaps
+*  @return @@void
+*****************************************************************************/
+void TextureCooker::BuildTaps(TextureMipFilter filter, std::uint32_t sourceSize, std::uint32_t destinationSize, FilterTaps& outTaps)
+{
+	const double scale    = static_cast<double>(sourceSize) / destinationSize;
+	const double support  = filter == TextureMipFilter::Box ? scale * 0.5 : KAISER_WIDTH * scale;
+	const int    maxTaps  = static_cast<int>(std::ceil(support * 2.0)) + 2;
+	const int    lastTexel = static_cast<int>(sourceSize) - 1;
+
+	outTaps.Index .assign(static_cast<std::size_t>(destinationSize) * maxTaps, 0);
+	outTaps.Weight.assign(static_cast<std::size_t>(destinationSize) * maxTaps, 0.0f);
+	outTaps.First .assign(destinationSize, 0);
+	outTaps.Stride = 0;
+
+	std::vector<double> weights(maxTaps);
+	for (std::uint32_t i = 0; i < destinationSize; ++i)
+	{
+		const double center = (i + 0.5) * scale;
+		const int    begin  = static_cast<int>(std::floor(center - support));
+		const int    end    = static_cast<int>(std::ceil (center + support));
+
+		/*--- - weights of the unclamped texels ---*/
+		int    count = 0;
+		double total = 0.0;
+		for (int j = begin; j < end && count < maxTaps; ++j)
+		{
+			double weight = 0.0;
+			if (filter == TextureMipFilter::Box)
+			{
+				weight = (std::min)(center + support, j + 1.0) - (std::max)(center - support, static_cast<double>(j));
+				weight = (std::max)(weight, 0.0);
+			}
+			else
+			{
+				weight = KaiserSinc((j + 0.5 - center) / scale);
+			}
+			weights[count++] = weight;
+			total += weight;
+		}
+
+		const std::size_t base = static_cast<std::size_t>(i) * maxTaps;
+		outTaps.First[i] = std::clamp(begin, 0, lastTexel);
+		for (int k = 0; k < count; ++k)
+		{
+			outTaps.Index [base + k] = std::clamp(begin + k, 0, lastTexel);
+			outTaps.Weight[base + k] = static_cast<float>(weights[k] / total);
+		}
+		for (int k = count; k < maxTaps; ++k) { outTaps.Index[base + k] = outTaps.First[i]; }
+		outTaps.Stride = (std::max)(outTaps.Stride, count);
+	}
+
+	/*--- - pack with the real stride ---*/
+	if (outTaps.Stride == maxTaps) { return; }
+	for (std::uint32_t i = 0; i < destinationSize; ++i)
+	{
+		for (int k = 0; k < outTaps.Stride; ++k)
+		{
+			outTaps.Index [static_cast<std::size_t>(i) * outTaps.Stride + k] = outTaps.Index [static_cast<std::size_t>(i) * maxTaps + k];
+			outTaps.Weight[static_cast<std::size_t>(i) * outTaps.Stride + k] = outTaps.Weight[static_cast<std::size_t>(i) * maxTaps + k];
+		}
+	}
+	outTaps.Index .resize(static_cast<std::size_t>(destinationSize) * outTaps.Stride);
+	outTaps.Weight.resize(static_cast<std::size_t>(destinationSize) * outTaps.Stride);
+}
+
+/****************************************************************************
+*                       DecodeRow
+*************************************************************************//**
+*  @fn        void TextureCooker::DecodeRow(const std::uint8_t* rgba, std::uint32_t width, const TextureCookSettings& settings, float* outRow) const
+*  @brief     8 bit texels -> linear float (rgb is premultiplied when IsAlphaWeighted)
+*  @param[in] const std::uint8_t* rgba
+*  @param[in] std::uint32_t width
+*  @param[in] const TextureCookSettings& settings
+*  @param[out]float* outRow (width * 4)
+*  @return @@void
+*****************************************************************************/
+void TextureCooker::DecodeRow(const std::uint8_t* rgba, std::uint32_t width, const TextureCookSettings& settings, float* outRow) const
+{
+	const ColorTable& colorTable = GetColorTable();
+	const float*      table      = settings.IsSRGB ? colorTable.SRGBToLinear : colorTable.UNormToLinear;
+	for (std::uint32_t x = 0; x < width; ++x, rgba += 4, outRow += 4)
+	{
+		const float  alpha  = colorTable.UNormToLinear[rgba[3]];
+		const float  weight = settings.IsAlphaWeighted ? alpha : 1.0f;
+		const __m128 color  = _mm_set_ps(alpha, table[rgba[2]], table[rgba[1]], table[rgba[0]]);
+		_mm_storeu_ps(outRow, _mm_mul_ps(color, _mm_set_ps(1.0f, weight, weight, weight)));
+	}
+}
+
+/****************************************************************************
+*                       EncodeLevel
+*************************************************************************//**
+*  @fn        void TextureCooker::EncodeLevel(const float* linear, std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, std::uint8_t* outRGBA) const
+*  @brief     Linear float -> 8 bit texels (unpremultiplied and clamped, the negative lobes of kaiser are cut)
+*  @param[in] const float* linear
+*  @param[in] std::uint32_t width
+*  @param[in] std::uint32_t height
+*  @param[in] const TextureCookSettings& settings
+*  @param[out]std::uint8_t* outRGBA
+*  @return @@void
+*****************************************************************************/
+void TextureCooker::EncodeLevel(const float* linear, std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, std::uint8_t* outRGBA) const
+{
+	const ColorTable& colorTable = GetColorTable();
+	const __m128 zero       = _mm_setzero_ps();
+	const __m128 one        = _mm_set1_ps(1.0f);
+	const __m128 minAlpha   = _mm_set1_ps(0.5f / 255.0f);
+	const __m128 colorScale = _mm_set1_ps(settings.IsSRGB ? static_cast<float>(ENCODE_TABLE_SIZE - 1) : 255.0f);
+	const __m128 alphaScale = _mm_set1_ps(255.0f);
+	const __m128 half       = _mm_set1_ps(0.5f);
+
+	const std::size_t texelCount = static_cast<std::size_t>(width) * height;
+	alignas(16) std::int32_t color[4];
+	alignas(16) std::int32_t alpha[4];
+	for (std::size_t i = 0; i < texelCount; ++i, linear += 4, outRGBA += 4)
+	{
+		__m128 value      = _mm_loadu_ps(linear);
+		__m128 alphaValue = _mm_min_ps(_mm_max_ps(_mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3)), zero), one);
+		if (settings.IsAlphaWeighted)
+		{
+			/*--- - unpremultiply (nearly transparent texels become black) ---*/
+			const __m128 isVisible = _mm_cmpge_ps(alphaValue, minAlpha);
+			value = _mm_and_ps(_mm_div_ps(value, _mm_max_ps(alphaValue, minAlpha)), isVisible);
+		}
+		value = _mm_min_ps(_mm_max_ps(value, zero), one);
+		_mm_store_si128(reinterpret_cast<__m128i*>(color), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value     , colorScale), half)));
+		_mm_store_si128(reinterpret_cast<__m128i*>(alpha), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(alphaValue, alphaScale), half)));
+
+		if (settings.IsSRGB)
+		{
+			outRGBA[0] = colorTable.LinearToSRGB[color[0]];
+			outRGBA[1] = colorTable.LinearToSRGB[color[1]];
+			outRGBA[2] = colorTable.LinearToSRGB[color[2]];
+		}
+		else
+		{
+			outRGBA[0] = static_cast<std::uint8_t>(color[0]);
+			outRGBA[1] = static_cast<std::uint8_t>(color[1]);
+			outRGBA[2] = static_cast<std::uint8_t>(color[2]);
+		}
+		outRGBA[3] = static_cast<std::uint8_t>(alpha[3]);
+	}
+}
+
+/****************************************************************************
+*                       ResampleLevel
+*************************************************************************//**
+*  @fn        void TextureCooker::ResampleLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, const float* linear, std::uint32_t sourceWidth, std::uint32_t sourceHeight, std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, float* outLinear)
+*  @brief     Separable resampling. Each source row is filtered horizontally once and kept in a ring,
+*             and the vertical pass sums the rows with SSE (one texel = one __m128).
+*  @param[in] const std::uint8_t* rgba (8 bit source, nullptr : use linear)
+*  @param[in] std::uint32_t rowPitch
+*  @param[in] const float* linear (linear source)
+*  @param[in] std::uint32_t sourceWidth, std::uint32_t sourceHeight
+*  @param[in] std::uint32_t width, std::uint32_t height
+*  @param[in] const TextureCookSettings& settings
+*  @param[out]float* outLinear
+*  @return @@void
+*****************************************************************************/
+void TextureCooker::ResampleLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, const float* linear, std::uint32_t sourceWidth, std::uint32_t sourceHeight,
+	std::uint32_t width, std::uint32_t height, const TextureCookSettings& settings, float* outLinear)
+{
+	BuildTaps(settings.Filter, sourceWidth , width , _horizontalTaps);
+	BuildTaps(settings.Filter, sourceHeight, height, _verticalTaps);
+
+	const std::size_t rowSize   = static_cast<std::size_t>(width) * 4;
+	const int         ringCount = _verticalTaps.Stride;
+	_filteredRows.resize(rowSize * ringCount);
+	if (rgba != nullptr) { _sourceRow.resize(static_cast<std::size_t>(sourceWidth) * 4); }
+	std::vector<std::int32_t> ringRows(ringCount, -1);
+
+	const std::int32_t* horizontalIndex  = _horizontalTaps.Index.data();
+	const float*        horizontalWeight = _horizontalTaps.Weight.data();
+	const int           horizontalStride = _horizontalTaps.Stride;
+	for (std::uint32_t y = 0; y < height; ++y)
+	{
+		float* destination = outLinear + y * rowSize;
+		for (int tap = 0; tap < _verticalTaps.Stride; ++tap)
+		{
+			const std::size_t  tapIndex = static_cast<std::size_t>(y) * _verticalTaps.Stride + tap;
+			const std::int32_t row      = _verticalTaps.Index[tapIndex];
+			const int          slot     = row % ringCount;
+			float*             filtered = _filteredRows.data() + slot * rowSize;
+
+			/*-------------------------------------------------------------------
+			-              Horizontal pass (once per source row)
+			---------------------------------------------------------------------*/
+			if (ringRows[slot] != row)
+			{
+				const float* source = _sourceRow.data();
+				if (rgba != nullptr) { DecodeRow(rgba + static_cast<std::size_t>(row) * rowPitch, sourceWidth, settings, _sourceRow.data()); }
+				else                 { source = linear + static_cast<std::size_t>(row) * sourceWidth * 4; }
+				for (std::uint32_t x = 0; x < width; ++x)
+				{
+					const std::int32_t* index  = horizontalIndex  + static_cast<std::size_t>(x) * horizontalStride;
+					const float*        weight = horizontalWeight + static_cast<std::size_t>(x) * horizontalStride;
+					__m128 sum = _mm_setzero_ps();
+					for (int k = 0; k < horizontalStride; ++k)
+					{
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weight[k]), _mm_loadu_ps(source + index[k] * 4)));
+					}
+					_mm_storeu_ps(filtered + x * 4, sum);
+				}
+				ringRows[slot] = row;
+			}
+
+			/*-------------------------------------------------------------------
+			-              Vertical pass
+			---------------------------------------------------------------------*/
+			const __m128 weight = _mm_set1_ps(_verticalTaps.Weight[tapIndex]);
+			if (tap == 0)
+			{
+				for (std::size_t x = 0; x < rowSize; x += 4) { _mm_storeu_ps(destination + x, _mm_mul_ps(weight, _mm_loadu_ps(filtered + x))); }
+			}
+			else
+			{
+				for (std::size_t x = 0; x < rowSize; x += 4)
+				{
+					_mm_storeu_ps(destination + x, _mm_add_ps(_mm_loadu_ps(destination + x), _mm_mul_ps(weight, _mm_loadu_ps(filtered + x))));
+				}
+			}
+		}
+	}
+}
+
+/****************************************************************************
+*                       CompressLevel
+*************************************************************************//**
+*  @fn        void TextureCooker::CompressLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, std::uint32_t width, std::uint32_t height, TextureCompression compression, std::uint8_t* outBlocks)
+*  @brief     4x4 blocks (the edge texels are repeated for the partial blocks)
+*  @param[in] const std::uint8_t* rgba
+*  @param[in] std::uint32_t rowPitch
+*  @param[in] std::uint32_t width
+*  @param[in] std::uint32_t height
+*  @param[in] TextureCompression compression
+*  @param[out]std::uint8_t* outBlocks
+*  @return @@void
+*****************************************************************************/
+void TextureCooker::CompressLevel(const std::uint8_t* rgba, std::uint32_t rowPitch, std::uint32_t width, std::uint32_t height, TextureCompression compression, std::uint8_t* outBlocks)
+{
+	const std::uint32_t blockSize = GetBlockSize(compression);
+	for (std::uint32_t by = 0; by < height; by += 4)
+	{
+		for (std::uint32_t bx = 0; bx < width; bx += 4, outBlocks += blockSize)
+		{
+			Block block;
+			for (std::uint32_t i = 0; i < 16; ++i)
+			{
+				const std::uint32_t x = (std::min)(bx + (i & 3), width  - 1);
+				const std::uint32_t y = (std::min)(by + (i >> 2), height - 1);
+				std::memcpy(block[i], rgba + static_cast<std::size_t>(y) * rowPitch + x * 4, 4);
+			}
+
+			switch (compression)
+			{
+				case TextureCompression::BC1:
+					EncodeColorBlock(block, true, outBlocks);
+					break;
+				case TextureCompression::BC3:
+					EncodeAlphaBlock(block, outBlocks);
+					EncodeColorBlock(block, false, outBlocks + 8);
+					break;
+				case TextureCompression::BC7:
+					EncodeBC7Block(block, outBlocks);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+}
+#pragma endregion Private Function
+#pragma endregion TextureCooker
+
+#pragma region TextureCookCache
+/****************************************************************************
+*                       Load
+*************************************************************************//**
+*  @fn        bool TextureCookCache::Load(std::uint64_t sourceHash, CookedTexture& outTexture) const
+*  @brief     Read the cooked file of the source hash (false : not cooked yet or broken)
+*  @param[in] std::uint64_t sourceHash
+*  @param[out]CookedTexture& outTexture
+*  @return @@bool
+*****************************************************************************/
+bool TextureCookCache::Load(std::uint64_t sourceHash, CookedTexture& outTexture) const
+{
+	std::vector<std::uint8_t> data;
+	if (!ReadFile(GetFilePath(sourceHash), data)) { return false; }
+
+	CookedTexture texture;
+	if (!TextureCooker::Parse(std::move(data), texture) || texture.Header.SourceHash != sourceHash) { return false; }
+	outTexture = std::move(texture);
+	return true;
+}
+
+/****************************************************************************
+*                       Save
+*************************************************************************//**
+*  @fn        bool TextureCookCache::Save(const CookedTexture& texture) const
+*  @brief     Write the file image to <directory>/<source hash>.ptex
+*  @param[in] const CookedTexture& texture
+*  @return @@bool
+*****************************************************************************/
+bool TextureCookCache::Save(const CookedTexture& texture) const
+{
+	static std::atomic<std::uint32_t> temporaryID = 0;
+	if (!texture.IsValid()) { return false; }
+
+	std::error_code error;
+	std::filesystem::create_directories(_directory, error);
+
+	const std::filesystem::path filePath      = GetFilePath(texture.Header.SourceHash);
+	std::filesystem::path       temporaryPath = filePath;
+	temporaryPath += L"." + std::to_wstring(temporaryID.fetch_add(1)) + L".tmp";
+	{
+		std::ofstream stream(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!stream) { return false; }
+		stream.write(reinterpret_cast<const char*>(texture.Data.data()), static_cast<std::streamsize>(texture.Data.size()));
+		if (!stream) { stream.close(); std::filesystem::remove(temporaryPath, error); return false; }
+	}
+
+	std::filesystem::rename(temporaryPath, filePath, error);
+	if (error) { std::filesystem::remove(temporaryPath, error); return false; }
+	return true;
+}
+
+std::filesystem::path TextureCookCache::GetFilePath(std::uint64_t sourceHash) const
+{
+	wchar_t name[32] = {};
+	const wchar_t* digits = L"0123456789abcdef";
+	for (int i = 0; i < 16; ++i) { name[i] = digits[(sourceHash >> ((15 - i) * 4)) & 15]; }
+	return _directory / (std::wstring(name) + L".ptex");
+}
+
+/****************************************************************************
+*                       ReadFile
+*************************************************************************//**
+*  @fn        bool TextureCookCache::ReadFile(const std::filesystem::path& filePath, std::vector<std::uint8_t>& outData)
+*  @brief     Read the whole file with one read
+*  @param[in] const std::filesystem::path& filePath
+*  @param[out]std::vector<std::uint8_t>& outData
+*  @return @@bool
+*****************************************************************************/
+bool TextureCookCache::ReadFile(const std::filesystem::path& filePath, std::vector<std::uint8_t>& outData)
+{
+	std::ifstream stream(filePath, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!stream) { return false; }
+	const std::streamoff size = stream.tellg();
+	if (size <= 0) { return false; }
+	stream.seekg(0, std::ios::beg);
+
+	outData.resize(static_cast<std::size_t>(size));
+	stream.read(reinterpret_cast<char*>(outData.data()), size);
+	return static_cast<bool>(stream);
+}
+
+/****************************************************************************
+*                       ReadRange
+*************************************************************************//**
+*  @fn        bool TextureCookCache::ReadRange(const std::filesystem::path& filePath, std::uint64_t offset, std::uint64_t size, std::vector<std::uint8_t>& outData)
+*  @brief     Read the byte range with one seek and one read
+*  @param[in] const std::filesystem::path& filePath
+*  @param[in] std::uint64_t offset
+*  @param[in] std::uint64_t size
+*  @param[out]std::vector<std::uint8_t>& outData
+*  @return @@bool (false : the file is shorter than the range)
+*****************************************************************************/
+bool TextureCookCache::ReadRange(const std::filesystem::path& filePath, std::uint64_t offset, std::uint64_t size, std::vector<std::uint8_t>& outData)
+{
+	std::ifstream stream(filePath, std::ios::in | std::ios::binary);
+	if (!stream || size == 0) { return false; }
+	stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+	if (!stream) { return false; }
+
+	outData.resize(static_cast<std::size_t>(size));
+	stream.read(reinterpret_cast<char*>(outData.data()), static_cast<std::streamsize>(size));
+	return static_cast<bool>(stream);
+}
+#pragma endregion TextureCookCache
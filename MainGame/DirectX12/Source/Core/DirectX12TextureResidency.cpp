@@ -0,0 +1,375 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureResidency.cpp
+///             @brief  Residency and priority of the streaming textures (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12TextureResidency.hpp"
+#include <algorithm>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        void TextureResidency::Initialize(std::uint64_t budgetBytes, std::uint32_t maxPendingLoads)
+*  @brief     Set the budget (all textures are cleared)
+*  @param[in] std::uint64_t budgetBytes
+*  @param[in] std::uint32_t maxPendingLoads (loads in flight at the same time)
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::Initialize(std::uint64_t budgetBytes, std::uint32_t maxPendingLoads)
+{
+	Clear();
+	_budget          = budgetBytes;
+	_maxPendingLoads = (std::max)(maxPendingLoads, 1u);
+}
+
+/****************************************************************************
+*                       Clear
+*************************************************************************//**
+*  @fn        void TextureResidency::Clear()
+*  @brief     Unregister all textures
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::Clear()
+{
+	_entries.clear();
+	_freeIDs.clear();
+	_candidates.clear();
+	_victims.clear();
+	_isVictimBuilt = false;
+	_residentBytes = 0;
+	_pendingBytes  = 0;
+	_pendingCount  = 0;
+	_textureCount  = 0;
+	_counters      = Statistics();
+}
+
+/****************************************************************************
+*                       Register
+*************************************************************************//**
+*  @fn        std::uint32_t TextureResidency::Register(const std::uint64_t* mipBytes, std::uint32_t mipCount, std::uint32_t tailMip)
+*  @brief     Add the texture whose tail mips are resident
+*  @param[in] const std::uint64_t* mipBytes (finest first)
+*  @param[in] std::uint32_t mipCount (MAX_MIP_COUNT at most)
+*  @param[in] std::uint32_t tailMip
+*  @return @@std::uint32_t texture ID (INVALID_ID : no mip)
+*****************************************************************************/
+std::uint32_t TextureResidency::Register(const std::uint64_t* mipBytes, std::uint32_t mipCount, std::uint32_t tailMip)
+{
+	if (mipCount == 0 || mipCount > MAX_MIP_COUNT) { return INVALID_ID; }
+
+	std::uint32_t textureID = 0;
+	if (!_freeIDs.empty()) { textureID = _freeIDs.back(); _freeIDs.pop_back(); }
+	else                   { textureID = static_cast<std::uint32_t>(_entries.size()); _entries.emplace_back(); }
+
+	Entry& entry = _entries[textureID];
+	entry = Entry();
+	entry.MipCount = mipCount;
+	entry.SuffixBytes[mipCount] = 0;
+	for (std::uint32_t mip = mipCount; mip > 0; --mip)
+	{
+		entry.SuffixBytes[mip - 1] = entry.SuffixBytes[mip] + mipBytes[mip - 1];
+	}
+	entry.TailMip     = (std::min)(tailMip, mipCount - 1);
+	entry.ResidentMip = entry.TailMip;
+	entry.PendingMip  = entry.TailMip;
+	entry.IsActive    = true;
+
+	_residentBytes += entry.SuffixBytes[entry.ResidentMip];
+	++_textureCount;
+	return textureID;
+}
+
+/****************************************************************************
+*                       Unregister
+*************************************************************************//**
+*  @fn        void TextureResidency::Unregister(std::uint32_t textureID)
+*  @brief     Remove the texture (a pending load is forgotten)
+*  @param[in] std::uint32_t textureID
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::Unregister(std::uint32_t textureID)
+{
+	if (!IsRegistered(textureID)) { return; }
+
+	Entry& entry = _entries[textureID];
+	if (entry.IsPending())
+	{
+		_pendingBytes -= entry.SuffixBytes[entry.PendingMip] - entry.SuffixBytes[entry.ResidentMip];
+		--_pendingCount;
+	}
+	_residentBytes -= entry.SuffixBytes[entry.ResidentMip];
+	entry.IsActive = false;
+	_freeIDs.push_back(textureID);
+	--_textureCount;
+}
+
+/****************************************************************************
+*                       BeginFrame
+*************************************************************************//**
+*  @fn        void TextureResidency::BeginFrame(std::uint64_t frame)
+*  @brief     Start collecting the requests of the frame
+*  @param[in] std::uint64_t frame (increasing, > 0)
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::BeginFrame(std::uint64_t frame)
+{
+	_frame = frame;
+}
+
+/****************************************************************************
+*                       Request
+*************************************************************************//**
+*  @fn        void TextureResidency::Request(std::uint32_t textureID, std::uint32_t mip, float priority)
+*  @brief     Request the mip for this frame. Several requests of a texture keep the finest mip and the highest priority.
+*  @param[in] std::uint32_t textureID
+*  @param[in] std::uint32_t mip
+*  @param[in] float priority (e.g. the screen size)
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::Request(std::uint32_t textureID, std::uint32_t mip, float priority)
+{
+	if (!IsRegistered(textureID)) { return; }
+
+	Entry& entry = _entries[textureID];
+	mip = (std::min)(mip, entry.TailMip);
+	if (!IsUsed(entry))
+	{
+		entry.RequestedMip  = mip;
+		entry.Priority      = priority;
+		entry.LastUsedFrame = _frame;
+	}
+	else
+	{
+		entry.RequestedMip = (std::min)(entry.RequestedMip, mip);
+		entry.Priority     = (std::max)(entry.Priority, priority);
+	}
+}
+
+/****************************************************************************
+*                       Update
+*************************************************************************//**
+*  @fn        void TextureResidency::Update(std::vector<TextureResidencyChange>& outLoads, std::vector<TextureResidencyChange>& outTrims)
+*  @brief     Turn the requests of the current frame into loads (highest priority first) and trims (LRU)
+*  @param[out] std::vector<TextureResidencyChange>& outLoads (pending until OnLoaded / OnLoadFailed)
+*  @param[out] std::vector<TextureResidencyChange>& outTrims (already resident as trimmed)
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::Update(std::vector<TextureResidencyChange>& outLoads, std::vector<TextureResidencyChange>& outTrims)
+{
+	outLoads.clear();
+	outTrims.clear();
+	_isVictimBuilt = false;
+
+	/*-------------------------------------------------------------------
+	-           Textures which need finer mips
+	---------------------------------------------------------------------*/
+	_candidates.clear();
+	for (std::uint32_t id = 0; id < static_cast<std::uint32_t>(_entries.size()); ++id)
+	{
+		const Entry& entry = _entries[id];
+		if (!entry.IsActive || !IsUsed(entry) || entry.IsPending()) { continue; }
+		if (entry.RequestedMip < entry.ResidentMip) { _candidates.push_back(id); }
+	}
+	std::sort(_candidates.begin(), _candidates.end(), [this](std::uint32_t a, std::uint32_t b)
+	{
+		if (_entries[a].Priority != _entries[b].Priority) { return _entries[a].Priority > _entries[b].Priority; }
+		return a < b;
+	});
+
+	/*-------------------------------------------------------------------
+	-           Issue the loads within the budget
+	---------------------------------------------------------------------*/
+	for (std::uint32_t id : _candidates)
+	{
+		if (_pendingCount >= _maxPendingLoads) { break; }
+
+		Entry& entry = _entries[id];
+		std::uint32_t targetMip = entry.RequestedMip;
+		if (!MakeRoom(entry.SuffixBytes[targetMip] - entry.SuffixBytes[entry.ResidentMip], id, outTrims))
+		{
+			/*--- - load the finest mip which still fits ---*/
+			const std::uint64_t committed = _residentBytes + _pendingBytes;
+			const std::uint64_t available = _budget > committed ? _budget - committed : 0;
+			while (targetMip < entry.ResidentMip && entry.SuffixBytes[targetMip] - entry.SuffixBytes[entry.ResidentMip] > available) { ++targetMip; }
+			if (targetMip == entry.ResidentMip) { ++_counters.DeniedCount; continue; }
+			++_counters.ReducedCount;
+		}
+
+		TextureResidencyChange load;
+		load.TextureID   = id;
+		load.ResidentMip = entry.ResidentMip;
+		load.TargetMip   = targetMip;
+		outLoads.push_back(load);
+
+		entry.PendingMip = targetMip;
+		_pendingBytes   += entry.SuffixBytes[targetMip] - entry.SuffixBytes[entry.ResidentMip];
+		++_pendingCount;
+		++_counters.LoadCount;
+	}
+}
+
+/****************************************************************************
+*                       OnLoaded
+*************************************************************************//**
+*  @fn        void TextureResidency::OnLoaded(std::uint32_t textureID, std::uint32_t mip)
+*  @brief     The pending load finished and the mips [mip, MipCount) are resident
+*  @param[in] std::uint32_t textureID
+*  @param[in] std::uint32_t mip
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::OnLoaded(std::uint32_t textureID, std::uint32_t mip)
+{
+	if (!IsRegistered(textureID)) { return; }
+
+	Entry& entry = _entries[textureID];
+	if (!entry.IsPending()) { return; }
+
+	_pendingBytes  -= entry.SuffixBytes[entry.PendingMip] - entry.SuffixBytes[entry.ResidentMip];
+	--_pendingCount;
+	mip             = (std::min)(mip, entry.ResidentMip);
+	_residentBytes += entry.SuffixBytes[mip] - entry.SuffixBytes[entry.ResidentMip];
+	entry.ResidentMip = mip;
+	entry.PendingMip  = mip;
+}
+
+/****************************************************************************
+*                       OnLoadFailed
+*************************************************************************//**
+*  @fn        void TextureResidency::OnLoadFailed(std::uint32_t textureID)
+*  @brief     The pending load was dropped (the texture stays at its resident mip)
+*  @param[in] std::uint32_t textureID
+*  @return @@void
+*****************************************************************************/
+void TextureResidency::OnLoadFailed(std::uint32_t textureID)
+{
+	if (!IsRegistered(textureID)) { return; }
+
+	Entry& entry = _entries[textureID];
+	if (!entry.IsPending()) { return; }
+
+	_pendingBytes -= entry.SuffixBytes[entry.PendingMip] - entry.SuffixBytes[entry.ResidentMip];
+	--_pendingCount;
+	entry.PendingMip = entry.ResidentMip;
+}
+
+/****************************************************************************
+*                       ComputeRequiredMip
+*************************************************************************//**
+*  @fn        std::uint32_t TextureResidency::ComputeRequiredMip(std::uint32_t width, std::uint32_t height, std::uint32_t mipCount, float screenSize, float bias)
+*  @brief     One texel per pixel : mip = floor(log2(texture size / screen size) + bias)
+*  @param[in] std::uint32_t width
+*  @param[in] std::uint32_t height
+*  @param[in] std::uint32_t mipCount
+*  @param[in] float screenSize (pixels covered by the texture along its longer side)
+*  @param[in] float bias
+*  @return @@std::uint32_t mip in [0, mipCount)
+*****************************************************************************/
+std::uint32_t TextureResidency::ComputeRequiredMip(std::uint32_t width, std::uint32_t height, std::uint32_t mipCount, float screenSize, float bias)
+{
+	if (mipCount == 0) { return 0; }
+	if (!(screenSize > 0.0f)) { return mipCount - 1; }
+
+	const float level = std::log2(static_cast<float>((std::max)(width, height)) / screenSize) + bias;
+	if (!(level > 0.0f)) { return 0; }
+	return (std::min)(static_cast<std::uint32_t>(level), mipCount - 1);
+}
+
+/****************************************************************************
+*                       GetStatistics
+*************************************************************************//**
+*  @fn        TextureResidency::Statistics TextureResidency::GetStatistics() const
+*  @brief     Current bytes and the counters
+*  @param[in] void
+*  @return @@Statistics
+*****************************************************************************/
+TextureResidency::Statistics TextureResidency::GetStatistics() const
+{
+	Statistics statistics    = _counters;
+	statistics.Budget        = _budget;
+	statistics.ResidentBytes = _residentBytes;
+	statistics.PendingBytes  = _pendingBytes;
+	statistics.TextureCount  = _textureCount;
+	statistics.PendingCount  = _pendingCount;
+	return statistics;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       MakeRoom
+*************************************************************************//**
+*  @fn        bool TextureResidency::MakeRoom(std::uint64_t extraBytes, std::uint32_t loadingID, std::vector<TextureResidencyChange>& outTrims)
+*  @brief     Trim the textures in LRU order until the extra bytes fit into the budget.
+*             Unused textures drop to the tail mip, used ones (lowest priority first) drop only the mips they did not request.
+*  @param[in] std::uint64_t extraBytes
+*  @param[in] std::uint32_t loadingID (never trimmed)
+*  @param[out] std::vector<TextureResidencyChange>& outTrims
+*  @return @@bool (true : the extra bytes fit)
+*****************************************************************************/
+bool TextureResidency::MakeRoom(std::uint64_t extraBytes, std::uint32_t loadingID, std::vector<TextureResidencyChange>& outTrims)
+{
+	if (_residentBytes + _pendingBytes + extraBytes <= _budget) { return true; }
+
+	/*-------------------------------------------------------------------
+	-           Trim order (built once per Update)
+	---------------------------------------------------------------------*/
+	if (!_isVictimBuilt)
+	{
+		_victims.clear();
+		for (std::uint32_t id = 0; id < static_cast<std::uint32_t>(_entries.size()); ++id)
+		{
+			const Entry& entry = _entries[id];
+			if (entry.IsActive && entry.ResidentMip < entry.TailMip) { _victims.push_back(id); }
+		}
+		std::sort(_victims.begin(), _victims.end(), [this](std::uint32_t a, std::uint32_t b)
+		{
+			const Entry& left  = _entries[a];
+			const Entry& right = _entries[b];
+			if (IsUsed(left) != IsUsed(right))              { return !IsUsed(left); }
+			if (left.LastUsedFrame != right.LastUsedFrame) { return left.LastUsedFrame < right.LastUsedFrame; }
+			if (left.Priority != right.Priority)           { return left.Priority < right.Priority; }
+			return a < b;
+		});
+		_victimCursor  = 0;
+		_isVictimBuilt = true;
+	}
+
+	/*-------------------------------------------------------------------
+	-           Trim
+	---------------------------------------------------------------------*/
+	for (; _victimCursor < _victims.size(); ++_victimCursor)
+	{
+		if (_residentBytes + _pendingBytes + extraBytes <= _budget) { return true; }
+
+		const std::uint32_t id = _victims[_victimCursor];
+		Entry& entry = _entries[id];
+		if (id == loadingID || entry.IsPending()) { continue; }
+
+		const std::uint32_t targetMip = IsUsed(entry) ? (std::min)((std::max)(entry.RequestedMip, entry.ResidentMip), entry.TailMip) : entry.TailMip;
+		if (targetMip <= entry.ResidentMip) { continue; }
+
+		TextureResidencyChange trim;
+		trim.TextureID   = id;
+		trim.ResidentMip = entry.ResidentMip;
+		trim.TargetMip   = targetMip;
+		outTrims.push_back(trim);
+
+		_residentBytes   -= entry.SuffixBytes[entry.ResidentMip] - entry.SuffixBytes[targetMip];
+		entry.ResidentMip = targetMip;
+		entry.PendingMip  = targetMip;
+		++_counters.TrimCount;
+	}
+	return _residentBytes + _pendingBytes + extraBytes <= _budget;
+}
+#pragma endregion Private Function
@@ -0,0 +1,564 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12TextureStreamer.cpp
+///             @brief  Mip streaming of the cooked textures
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12TextureStreamer.hpp"
+#include "DirectX12/Include/Core/DirectX12Base.hpp"
+#include "GameCore/Include/Profiler.hpp"
+#include <algorithm>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr D3D12_RESOURCE_STATES SHADER_RESOURCE_STATE = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isQuit = true;
+	}
+	_condition.notify_all();
+	if (_reader.joinable()) { _reader.join(); }
+}
+
+#pragma region Public Function
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool TextureStreamer::Initialize(std::uint64_t budgetBytes)
+*  @brief     Start the reader thread
+*  @param[in] std::uint64_t budgetBytes (video memory of the streaming textures)
+*  @return @@bool
+*****************************************************************************/
+bool TextureStreamer::Initialize(std::uint64_t budgetBytes)
+{
+	if (_isInitialized) { return true; }
+
+	_residency.Initialize(budgetBytes, TEXTURE_STREAMING_MAX_PENDING_LOAD);
+	_isQuit        = false;
+	_reader        = std::thread(&TextureStreamer::ReaderLoop, this);
+	_isInitialized = true;
+	return true;
+}
+
+/****************************************************************************
+*                       Finalize
+*************************************************************************//**
+*  @fn        void TextureStreamer::Finalize()
+*  @brief     Release all textures and stop the reader thread (after the GPU is flushed)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Finalize()
+{
+	if (!_isInitialized) { return; }
+	Clear();
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isQuit = true;
+	}
+	_condition.notify_all();
+	if (_reader.joinable()) { _reader.join(); }
+
+	_readResults.clear();
+	_retiredResources.clear(); _retiredResources.shrink_to_fit();
+	_textures.shrink_to_fit();
+	_isInitialized = false;
+}
+
+/****************************************************************************
+*                       Clear
+*************************************************************************//**
+*  @fn        void TextureStreamer::Clear()
+*  @brief     Unregister all textures. The resources are retired, and the reads in flight are dropped.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Clear()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_readRequests.clear();
+		_readResults.clear(); // a read in progress is dropped by the generation
+	}
+	for (auto& texture : _textures) { if (texture.Resource) { Retire(texture.Resource); } }
+	for (auto& job     : _uploadJobs) { Retire(job.Resource); }
+	_textures.clear();
+	_uploadJobs.clear();
+	_residency.Clear();
+}
+
+/****************************************************************************
+*                       Register
+*************************************************************************//**
+*  @fn        std::uint32_t TextureStreamer::Register(const std::filesystem::path& cookedFilePath, const CookedTexture& cookedTexture,
+*             const ResourceComPtr& resource, std::uint32_t tailMip, UINT srvID)
+*  @brief     Start streaming the texture whose tail mips are in the resource
+*  @param[in] const std::filesystem::path& cookedFilePath (the higher mips are read from this file)
+*  @param[in] const CookedTexture& cookedTexture (only the header and the mip table are used)
+*  @param[in] const ResourceComPtr& resource
+*  @param[in] std::uint32_t tailMip
+*  @param[in] UINT srvID
+*  @return @@std::uint32_t stream ID (INVALID_ID : not streamed)
+*****************************************************************************/
+std::uint32_t TextureStreamer::Register(const std::filesystem::path& cookedFilePath, const CookedTexture& cookedTexture,
+	const ResourceComPtr& resource, std::uint32_t tailMip, UINT srvID)
+{
+	if (!_isInitialized || !cookedTexture.IsValid() || !resource) { return INVALID_ID; }
+
+	std::uint64_t mipBytes[TextureResidency::MAX_MIP_COUNT] = {};
+	const std::uint32_t mipCount = static_cast<std::uint32_t>(cookedTexture.Mips.size());
+	if (mipCount > TextureResidency::MAX_MIP_COUNT) { return INVALID_ID; }
+	for (std::uint32_t i = 0; i < mipCount; ++i) { mipBytes[i] = cookedTexture.Mips[i].Size; }
+
+	const std::uint32_t streamID = _residency.Register(mipBytes, mipCount, tailMip);
+	if (streamID == INVALID_ID) { return INVALID_ID; }
+
+	if (streamID >= _textures.size()) { _textures.resize(static_cast<size_t>(streamID) + 1); }
+	StreamTexture& texture = _textures[streamID];
+	texture             = StreamTexture();
+	texture.FilePath    = cookedFilePath;
+	texture.Mips        = cookedTexture.Mips;
+	texture.Resource    = resource;
+	texture.State       = D3D12_RESOURCE_STATE_COPY_DEST;
+	texture.ResidentMip = _residency.GetResidentMip(streamID);
+	texture.SRVID       = srvID;
+	texture.Generation  = ++_generation;
+	return streamID;
+}
+
+/****************************************************************************
+*                       Request
+*************************************************************************//**
+*  @fn        void TextureStreamer::Request(std::uint32_t streamID, float screenSize)
+*  @brief     Request the mip for the screen size (one texel per pixel) in this frame
+*  @param[in] std::uint32_t streamID
+*  @param[in] float screenSize (pixels)
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Request(std::uint32_t streamID, float screenSize)
+{
+	if (streamID >= _textures.size() || !_textures[streamID].IsStreamable) { return; }
+
+	const StreamTexture& texture = _textures[streamID];
+	const std::uint32_t  mip     = TextureResidency::ComputeRequiredMip(texture.Mips[0].Width, texture.Mips[0].Height,
+		static_cast<std::uint32_t>(texture.Mips.size()), screenSize, TEXTURE_STREAMING_MIP_BIAS);
+	_residency.Request(streamID, mip, screenSize);
+}
+
+/****************************************************************************
+*                       Update
+*************************************************************************//**
+*  @fn        void TextureStreamer::Update()
+*  @brief     Release the retired resources, upload the finished reads, and start the loads and trims
+*             decided from the requests of the last frame. The commands are recorded on the current command list.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Update()
+{
+	PROFILE_FUNCTION();
+	if (!_isInitialized) { return; }
+
+	/*-------------------------------------------------------------------
+	-           Release the resources the GPU does not use any more
+	---------------------------------------------------------------------*/
+	const std::uint64_t frameCount = DirectX12::Instance().GetFrameCount();
+	_retiredResources.erase(std::remove_if(_retiredResources.begin(), _retiredResources.end(),
+		[frameCount](const RetiredResource& retired) { return retired.Fence <= frameCount; }), _retiredResources.end());
+
+	/*-------------------------------------------------------------------
+	-           Upload the mips read so far
+	---------------------------------------------------------------------*/
+	FinishReads();
+	UploadMips();
+
+	/*-------------------------------------------------------------------
+	-           Decide the next loads and trims
+	---------------------------------------------------------------------*/
+	_residency.Update(_loads, _trims);
+	for (const auto& trim : _trims) { Trim(trim); }
+	if (!_loads.empty())
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (const auto& load : _loads)
+			{
+				const StreamTexture&    texture = _textures[load.TextureID];
+				const CookedTextureMip& last    = texture.Mips[load.ResidentMip - 1];
+
+				/*--- - the mips [TargetMip, ResidentMip) are contiguous in the file ---*/
+				ReadJob job;
+				job.StreamID    = load.TextureID;
+				job.Generation  = texture.Generation;
+				job.ResidentMip = load.ResidentMip;
+				job.TargetMip   = load.TargetMip;
+				job.FilePath    = texture.FilePath;
+				job.Offset      = texture.Mips[load.TargetMip].Offset;
+				job.Size        = last.Offset + last.Size - job.Offset;
+				_readRequests.push_back(std::move(job));
+			}
+		}
+		_condition.notify_one();
+	}
+	_residency.BeginFrame(++_frame);
+}
+
+/****************************************************************************
+*                       GetTailMip
+*************************************************************************//**
+*  @fn        std::uint32_t TextureStreamer::GetTailMip(const CookedTexture& cookedTexture)
+*  @brief     First mip whose longer side is TEXTURE_STREAMING_TAIL_SIZE or less.
+*             A block compressed resource must start with a multiple of 4, so the tail stops before such a mip.
+*  @param[in] const CookedTexture& cookedTexture
+*  @return @@std::uint32_t (0 : the texture is small, load all mips)
+*****************************************************************************/
+std::uint32_t TextureStreamer::GetTailMip(const CookedTexture& cookedTexture)
+{
+	const std::vector<CookedTextureMip>& mips = cookedTexture.Mips;
+	const bool isBlockCompressed = cookedTexture.GetCompression() != TextureCompression::None;
+
+	std::uint32_t tailMip = 0;
+	while (tailMip + 1 < mips.size() && (std::max)(mips[tailMip].Width, mips[tailMip].Height) > TEXTURE_STREAMING_TAIL_SIZE)
+	{
+		const CookedTextureMip& next = mips[tailMip + 1];
+		if (isBlockCompressed && (next.Width % 4 != 0 || next.Height % 4 != 0)) { break; }
+		++tailMip;
+	}
+	return (std::min)(tailMip, static_cast<std::uint32_t>(TextureResidency::MAX_MIP_COUNT - 1));
+}
+
+/****************************************************************************
+*                       GetStatistics
+*************************************************************************//**
+*  @fn        TextureStreamer::Statistics TextureStreamer::GetStatistics() const
+*  @brief     Residency and the upload counters
+*  @param[in] void
+*  @return @@Statistics
+*****************************************************************************/
+TextureStreamer::Statistics TextureStreamer::GetStatistics() const
+{
+	Statistics statistics;
+	statistics.Residency          = _residency.GetStatistics();
+	statistics.FrameUploadedBytes = _frameUploadedBytes;
+	statistics.ReadBytes          = _readBytes;
+	statistics.UploadJobCount     = _uploadJobs.size();
+	statistics.RetiredCount       = _retiredResources.size();
+	return statistics;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       ReaderLoop
+*************************************************************************//**
+*  @fn        void TextureStreamer::ReaderLoop()
+*  @brief     Read the requested byte range of the cooked file (one seek and one read per load)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::ReaderLoop()
+{
+	PROFILE_THREAD("TextureStreamer Reader");
+	for (;;)
+	{
+		ReadJob job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this]() { return _isQuit || !_readRequests.empty(); });
+			if (_isQuit) { return; }
+			job = std::move(_readRequests.front());
+			_readRequests.pop_front();
+		}
+
+		{
+			PROFILE_SCOPE("TextureCookCache::ReadRange");
+			job.IsSucceeded = TextureCookCache::ReadRange(job.FilePath, job.Offset, job.Size, job.Data);
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		_readResults.push_back(std::move(job));
+	}
+}
+
+/****************************************************************************
+*                       FinishReads
+*************************************************************************//**
+*  @fn        void TextureStreamer::FinishReads()
+*  @brief     Create the resource of each finished read and queue its upload
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::FinishReads()
+{
+	std::vector<ReadJob> results;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		results.swap(_readResults);
+	}
+
+	for (auto& read : results)
+	{
+		if (!IsCurrent(read.StreamID, read.Generation)) { continue; }
+
+		StreamTexture& texture = _textures[read.StreamID];
+		if (!read.IsSucceeded || texture.ResidentMip != read.ResidentMip)
+		{
+			/*--- - a broken cache file is not read every frame ---*/
+			if (!read.IsSucceeded) { texture.IsStreamable = false; }
+			_residency.OnLoadFailed(read.StreamID);
+			continue;
+		}
+		_readBytes += read.Data.size();
+
+		UploadJob job;
+		job.Resource    = CreateResource(texture, read.TargetMip);
+		job.UploadedMip = read.ResidentMip;
+		job.Read        = std::move(read);
+		_uploadJobs.push_back(std::move(job));
+	}
+}
+
+/****************************************************************************
+*                       UploadMips
+*************************************************************************//**
+*  @fn        void TextureStreamer::UploadMips()
+*  @brief     Upload TEXTURE_STREAMING_UPLOAD_SIZE bytes per frame (at least one mip), coarsest mip first.
+*             When all new mips of a load are uploaded, the texture is switched to the new resource.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::UploadMips()
+{
+	_frameUploadedBytes = 0;
+	while (!_uploadJobs.empty())
+	{
+		UploadJob&     job     = _uploadJobs.front();
+		StreamTexture& texture = _textures[job.Read.StreamID];
+		while (job.UploadedMip > job.Read.TargetMip)
+		{
+			const std::uint32_t mip = job.UploadedMip - 1;
+			if (_frameUploadedBytes > 0 && _frameUploadedBytes + texture.Mips[mip].Size > TEXTURE_STREAMING_UPLOAD_SIZE) { return; }
+			if (!UploadMip(job, mip, _frameUploadedBytes)) { return; }
+			job.UploadedMip = mip;
+		}
+
+		SwapResource(texture, job.Resource, job.Read.TargetMip);
+		_residency.OnLoaded(job.Read.StreamID, job.Read.TargetMip);
+		_uploadJobs.pop_front();
+	}
+}
+
+/****************************************************************************
+*                       UploadMip
+*************************************************************************//**
+*  @fn        bool TextureStreamer::UploadMip(UploadJob& job, std::uint32_t mip, std::uint64_t& uploadedBytes)
+*  @brief     Copy one mip into the new resource. The mip goes through the frame upload arena,
+*             and a mip larger than TEXTURE_STREAMING_UPLOAD_SIZE has its own upload buffer (retired after the frame).
+*  @param[in] UploadJob& job
+*  @param[in] std::uint32_t mip
+*  @param[out]std::uint64_t& uploadedBytes
+*  @return @@bool (false : the arena is full in this frame)
+*****************************************************************************/
+bool TextureStreamer::UploadMip(UploadJob& job, std::uint32_t mip, std::uint64_t& uploadedBytes)
+{
+	DirectX12& directX12 = DirectX12::Instance();
+	const CookedTextureMip& mipInfo     = _textures[job.Read.StreamID].Mips[mip];
+	const UINT              subresource = mip - job.Read.TargetMip;
+
+	D3D12_RESOURCE_DESC                resourceDesc = job.Resource->GetDesc();
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint    = {};
+	UINT   rowCount   = 0;
+	UINT64 rowSize    = 0;
+	UINT64 totalBytes = 0;
+	directX12.GetDevice()->GetCopyableFootprints(&resourceDesc, subresource, 1, 0, &footprint, &rowCount, &rowSize, &totalBytes);
+
+	/*-------------------------------------------------------------------
+	-           Upload memory
+	---------------------------------------------------------------------*/
+	std::uint8_t*  destination    = nullptr;
+	Resource*      uploadResource = nullptr;
+	ResourceComPtr uploadBuffer   = nullptr;
+	if (totalBytes <= TEXTURE_STREAMING_UPLOAD_SIZE)
+	{
+		const UploadAllocation allocation = directX12.GetFrameUploadArena().Allocate(totalBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+		if (!allocation.IsValid()) { return false; }
+		uploadResource   = directX12.GetFrameUploadBuffer();
+		destination      = static_cast<std::uint8_t*>(allocation.CPU);
+		footprint.Offset = allocation.GPU - uploadResource->GetGPUVirtualAddress();
+	}
+	else
+	{
+		D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_UPLOAD);
+		D3D12_RESOURCE_DESC   bufferDesc   = RESOURCE_DESC::Buffer(totalBytes);
+		ThrowIfFailed(directX12.GetDevice()->CreateCommittedResource(
+			&heapProperty,
+			D3D12_HEAP_FLAG_NONE,
+			&bufferDesc,
+			D3D12_RESOURCE_STATE_GENERIC_READ,
+			nullptr,
+			IID_PPV_ARGS(uploadBuffer.ReleaseAndGetAddressOf())));
+
+		void* mappedData = nullptr;
+		ThrowIfFailed(uploadBuffer->Map(0, nullptr, &mappedData));
+		uploadResource = uploadBuffer.Get();
+		destination    = static_cast<std::uint8_t*>(mappedData);
+	}
+
+	/*-------------------------------------------------------------------
+	-           Rows (the footprint rows are 256 byte aligned)
+	---------------------------------------------------------------------*/
+	const std::uint8_t* source   = job.Read.Data.data() + (mipInfo.Offset - job.Read.Offset);
+	const size_t        copySize = static_cast<size_t>((std::min)(rowSize, static_cast<UINT64>(mipInfo.RowPitch)));
+	const UINT          rows     = (std::min)(rowCount, mipInfo.RowCount);
+	for (UINT row = 0; row < rows; ++row)
+	{
+		std::memcpy(destination + static_cast<size_t>(row) * footprint.Footprint.RowPitch, source + static_cast<size_t>(row) * mipInfo.RowPitch, copySize);
+	}
+	if (uploadBuffer) { uploadBuffer->Unmap(0, nullptr); Retire(uploadBuffer); }
+
+	/*-------------------------------------------------------------------
+	-           Copy
+	---------------------------------------------------------------------*/
+	TEXTURE_COPY_LOCATION destinationLocation(job.Resource.Get(), subresource);
+	TEXTURE_COPY_LOCATION sourceLocation(uploadResource, footprint);
+	directX12.GetCommandList()->CopyTextureRegion(&destinationLocation, 0, 0, 0, &sourceLocation, nullptr);
+	uploadedBytes += totalBytes;
+	return true;
+}
+
+/****************************************************************************
+*                       Trim
+*************************************************************************//**
+*  @fn        void TextureStreamer::Trim(const TextureResidencyChange& trim)
+*  @brief     Drop the mips finer than trim.TargetMip (GPU copy into a smaller resource)
+*  @param[in] const TextureResidencyChange& trim
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Trim(const TextureResidencyChange& trim)
+{
+	StreamTexture& texture = _textures[trim.TextureID];
+	if (texture.ResidentMip >= trim.TargetMip) { return; }
+	SwapResource(texture, CreateResource(texture, trim.TargetMip), trim.TargetMip);
+}
+
+/****************************************************************************
+*                       CreateResource
+*************************************************************************//**
+*  @fn        ResourceComPtr TextureStreamer::CreateResource(const StreamTexture& texture, std::uint32_t firstMip)
+*  @brief     Texture with the mips [firstMip, MipCount) in the COPY_DEST state
+*  @param[in] const StreamTexture& texture
+*  @param[in] std::uint32_t firstMip
+*  @return @@ResourceComPtr
+*****************************************************************************/
+ResourceComPtr TextureStreamer::CreateResource(const StreamTexture& texture, std::uint32_t firstMip)
+{
+	const CookedTextureMip& top    = texture.Mips[firstMip];
+	const DXGI_FORMAT       format = texture.Resource->GetDesc().Format;
+	const UINT16 mipLevels = static_cast<UINT16>(texture.Mips.size() - firstMip);
+
+	D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_DEFAULT);
+	D3D12_RESOURCE_DESC   resourceDesc = RESOURCE_DESC::Texture2D(format, (UINT64)top.Width, (UINT)top.Height, 1, mipLevels);
+
+	ResourceComPtr resource = nullptr;
+	ThrowIfFailed(DirectX12::Instance().GetDevice()->CreateCommittedResource(
+		&heapProperty,
+		D3D12_HEAP_FLAG_NONE,
+		&resourceDesc,
+		D3D12_RESOURCE_STATE_COPY_DEST,
+		nullptr,
+		IID_PPV_ARGS(resource.ReleaseAndGetAddressOf())));
+	resource->SetName(texture.FilePath.c_str());
+	return resource;
+}
+
+/****************************************************************************
+*                       SwapResource
+*************************************************************************//**
+*  @fn        void TextureStreamer::SwapResource(StreamTexture& texture, const ResourceComPtr& resource, std::uint32_t firstMip)
+*  @brief     Copy the mips both resources have, point the SRV at the new resource and retire the former one.
+*             The descriptor is rewritten while recording, so every draw of this frame uses the new resource.
+*  @param[in] StreamTexture& texture
+*  @param[in] const ResourceComPtr& resource (mips [firstMip, MipCount), COPY_DEST state)
+*  @param[in] std::uint32_t firstMip
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::SwapResource(StreamTexture& texture, const ResourceComPtr& resource, std::uint32_t firstMip)
+{
+	DirectX12&   directX12   = DirectX12::Instance();
+	CommandList* commandList = directX12.GetCommandList();
+	const std::uint32_t mipCount = static_cast<std::uint32_t>(texture.Mips.size());
+
+	/*-------------------------------------------------------------------
+	-           Copy the shared mips on the GPU
+	---------------------------------------------------------------------*/
+	if (texture.State != D3D12_RESOURCE_STATE_COPY_SOURCE)
+	{
+		const BARRIER barrier = BARRIER::Transition(texture.Resource.Get(), texture.State, D3D12_RESOURCE_STATE_COPY_SOURCE);
+		commandList->ResourceBarrier(1, &barrier);
+		texture.State = D3D12_RESOURCE_STATE_COPY_SOURCE;
+	}
+	for (std::uint32_t mip = (std::max)(firstMip, texture.ResidentMip); mip < mipCount; ++mip)
+	{
+		TEXTURE_COPY_LOCATION destinationLocation(resource.Get(), mip - firstMip);
+		TEXTURE_COPY_LOCATION sourceLocation(texture.Resource.Get(), mip - texture.ResidentMip);
+		commandList->CopyTextureRegion(&destinationLocation, 0, 0, 0, &sourceLocation, nullptr);
+	}
+	const BARRIER barrier = BARRIER::Transition(resource.Get(), D3D12_RESOURCE_STATE_COPY_DEST, SHADER_RESOURCE_STATE);
+	commandList->ResourceBarrier(1, &barrier);
+
+	/*-------------------------------------------------------------------
+	-           Rewrite the SRV in place
+	---------------------------------------------------------------------*/
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+	ZeroMemory(&srvDesc, sizeof(srvDesc));
+	srvDesc.Format                        = resource->GetDesc().Format;
+	srvDesc.Shader4ComponentMapping       = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.ViewDimension                 = D3D12_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Texture2D.MipLevels           = mipCount - firstMip;
+	srvDesc.Texture2D.MostDetailedMip     = 0;
+	srvDesc.Texture2D.PlaneSlice          = 0;
+	srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
+	directX12.GetDevice()->CreateShaderResourceView(resource.Get(), &srvDesc, directX12.GetCPUResourceView(HeapType::SRV, texture.SRVID));
+
+	Retire(texture.Resource);
+	texture.Resource    = resource;
+	texture.State       = SHADER_RESOURCE_STATE;
+	texture.ResidentMip = firstMip;
+}
+
+/****************************************************************************
+*                       Retire
+*************************************************************************//**
+*  @fn        void TextureStreamer::Retire(const ResourceComPtr& resource)
+*  @brief     Keep the resource until the frames recorded so far are completed
+*  @param[in] const ResourceComPtr& resource
+*  @return @@void
+*****************************************************************************/
+void TextureStreamer::Retire(const ResourceComPtr& resource)
+{
+	RetiredResource retired;
+	retired.Resource = resource;
+	retired.Fence    = DirectX12::Instance().GetFrameCount() + FRAME_BUFFER_COUNT;
+	_retiredResources.push_back(std::move(retired));
+}
+
+bool TextureStreamer::IsCurrent(std::uint32_t streamID, std::uint64_t generation) const
+{
+	return streamID < _textures.size() && _textures[streamID].Generation == generation;
+}
+#pragma endregion Private Function
@@ -0,0 +1,212 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12UploadArena.cpp
+///             @brief  Per frame upload ring for the constants (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12UploadArena.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	inline std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region UploadArenaWriter
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        UploadAllocation UploadArenaWriter::Allocate(std::uint64_t size, std::uint64_t alignment)
+*  @brief     Bump allocation in the current chunk (a new chunk is taken when it is full or the frame changed)
+*  @param[in] std::uint64_t size
+*  @param[in] std::uint64_t alignment (power of 2)
+*  @return @@UploadAllocation (invalid when the ring is full)
+*****************************************************************************/
+UploadAllocation UploadArenaWriter::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0 || !_arena->IsInitialized()) { return UploadAllocation(); }
+	alignment                      = (std::max)(alignment, UploadArena::CONSTANT_BUFFER_ALIGNMENT);
+	const std::uint64_t alignedSize = AlignUp(size, UploadArena::CONSTANT_BUFFER_ALIGNMENT);
+
+	/*-------------------------------------------------------------------
+	-           The chunk of the former frame may be reused by the GPU
+	---------------------------------------------------------------------*/
+	const std::uint64_t frameSerial = _arena->GetFrameSerial();
+	if (_frameSerial != frameSerial) { _chunk = UploadAllocation(); _frameSerial = frameSerial; }
+
+	std::uint64_t offset = _chunk.IsValid() ? AlignUp(_chunk.GPU + _offset, alignment) - _chunk.GPU : 0;
+	if (!_chunk.IsValid() || offset + alignedSize > _chunk.Size)
+	{
+		_chunk  = _arena->AllocateChunk(alignedSize + alignment - UploadArena::CONSTANT_BUFFER_ALIGNMENT);
+		_offset = 0;
+		if (!_chunk.IsValid()) { return UploadAllocation(); }
+		offset  = AlignUp(_chunk.GPU, alignment) - _chunk.GPU;
+	}
+
+	UploadAllocation allocation;
+	allocation.CPU  = static_cast<std::uint8_t*>(_chunk.CPU) + offset;
+	allocation.GPU  = _chunk.GPU + offset;
+	allocation.Size = alignedSize;
+	_offset         = offset + alignedSize;
+	_arena->AddAllocation(alignedSize);
+	return allocation;
+}
+#pragma endregion UploadArenaWriter
+
+#pragma region UploadArena
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        void UploadArena::Initialize(void* cpuBase, std::uint64_t gpuBase, std::uint64_t capacity, std::uint64_t chunkSize)
+*  @brief     Use [cpuBase, cpuBase + capacity) as the ring
+*  @param[in] void* cpuBase (mapped pointer)
+*  @param[in] std::uint64_t gpuBase (GPU virtual address of cpuBase)
+*  @param[in] std::uint64_t capacity
+*  @param[in] std::uint64_t chunkSize
+*  @return @@void
+*****************************************************************************/
+void UploadArena::Initialize(void* cpuBase, std::uint64_t gpuBase, std::uint64_t capacity, std::uint64_t chunkSize)
+{
+	Finalize();
+	std::scoped_lock lock(_mutex);
+	_cpuBase   = static_cast<std::uint8_t*>(cpuBase);
+	_gpuBase   = gpuBase;
+	_capacity  = capacity / CONSTANT_BUFFER_ALIGNMENT * CONSTANT_BUFFER_ALIGNMENT;
+	_chunkSize = (std::min)(AlignUp((std::max)(chunkSize, CONSTANT_BUFFER_ALIGNMENT), CONSTANT_BUFFER_ALIGNMENT), _capacity);
+}
+
+void UploadArena::Finalize()
+{
+	std::scoped_lock lock(_mutex);
+	_cpuBase   = nullptr;
+	_gpuBase   = 0;
+	_capacity  = 0;
+	_chunkSize = 0;
+	_head      = 0;
+	_tail      = 0;
+	_frames.clear();
+	_frameSerial.fetch_add(1, std::memory_order_acq_rel); // drop the chunks of the writers
+	_frameUploadedBytes   = 0;
+	_frameAllocationCount = 0;
+	_frameChunkCount      = 0;
+	_lastFrameUploaded    = 0;
+	_peakFrameUploaded    = 0;
+	_failedCount          = 0;
+}
+
+/****************************************************************************
+*                       AllocateChunk
+*************************************************************************//**
+*  @fn        UploadAllocation UploadArena::AllocateChunk(std::uint64_t minSize)
+*  @brief     Take a contiguous chunk from the head of the ring (thread safe).
+*             The tail of the buffer is skipped when the chunk does not fit before the end.
+*  @param[in] std::uint64_t minSize
+*  @return @@UploadAllocation (invalid when the ring is full)
+*****************************************************************************/
+UploadAllocation UploadArena::AllocateChunk(std::uint64_t minSize)
+{
+	std::scoped_lock lock(_mutex);
+	if (_cpuBase == nullptr) { return UploadAllocation(); }
+
+	const std::uint64_t size     = (std::max)(_chunkSize, AlignUp(minSize, CONSTANT_BUFFER_ALIGNMENT));
+	std::uint64_t       physical = _head % _capacity;
+	if (_head == _tail && physical + size > _capacity)
+	{
+		/* nothing is in flight : start the next lap instead of counting the tail of the buffer as used */
+		_head     += _capacity - physical;
+		_tail      = _head;
+		physical   = 0;
+	}
+	const std::uint64_t padding  = physical + size > _capacity ? _capacity - physical : 0;
+	if (size > _capacity || _head + padding + size - _tail > _capacity)
+	{
+		++_failedCount;
+		return UploadAllocation();
+	}
+
+	_head += padding;
+	const std::uint64_t offset = _head % _capacity;
+	_head += size;
+	++_frameChunkCount;
+
+	UploadAllocation chunk;
+	chunk.CPU  = _cpuBase + offset;
+	chunk.GPU  = _gpuBase + offset;
+	chunk.Size = size;
+	return chunk;
+}
+
+/****************************************************************************
+*                       EndFrame
+*************************************************************************//**
+*  @fn        void UploadArena::EndFrame(std::uint64_t retireFence)
+*  @brief     Close the frame. Its memory is reused after retireFence is completed.
+*  @param[in] std::uint64_t retireFence
+*  @return @@void
+*****************************************************************************/
+void UploadArena::EndFrame(std::uint64_t retireFence)
+{
+	std::scoped_lock lock(_mutex);
+	_frames.push_back({ retireFence, _head });
+
+	_lastFrameUploaded = _frameUploadedBytes.exchange(0, std::memory_order_relaxed);
+	_peakFrameUploaded = (std::max)(_peakFrameUploaded, _lastFrameUploaded);
+	_frameAllocationCount.store(0, std::memory_order_relaxed);
+	_frameChunkCount = 0;
+	_frameSerial.fetch_add(1, std::memory_order_acq_rel);
+}
+
+/****************************************************************************
+*                       ReleaseCompleted
+*************************************************************************//**
+*  @fn        void UploadArena::ReleaseCompleted(std::uint64_t completedFence)
+*  @brief     Move the tail of the ring over the frames whose fence has been completed
+*  @param[in] std::uint64_t completedFence
+*  @return @@void
+*****************************************************************************/
+void UploadArena::ReleaseCompleted(std::uint64_t completedFence)
+{
+	std::scoped_lock lock(_mutex);
+	while (!_frames.empty() && _frames.front().RetireFence <= completedFence)
+	{
+		_tail = (std::max)(_tail, _frames.front().Head); // an empty ring may have skipped to the next lap
+		_frames.pop_front();
+	}
+}
+
+/****************************************************************************
+*                       GetStatistics
+*************************************************************************//**
+*  @fn        UploadArena::Statistics UploadArena::GetStatistics() const
+*  @brief     Bytes uploaded in this frame and the usage of the ring
+*  @param[in] void
+*  @return @@Statistics
+*****************************************************************************/
+UploadArena::Statistics UploadArena::GetStatistics() const
+{
+	std::scoped_lock lock(_mutex);
+	Statistics statistics;
+	statistics.Capacity               = _capacity;
+	statistics.InFlightBytes          = _head - _tail;
+	statistics.FrameUploadedBytes     = _frameUploadedBytes  .load(std::memory_order_relaxed);
+	statistics.FrameAllocationCount   = _frameAllocationCount.load(std::memory_order_relaxed);
+	statistics.FrameChunkCount        = _frameChunkCount;
+	statistics.LastFrameUploadedBytes = _lastFrameUploaded;
+	statistics.PeakFrameUploadedBytes = _peakFrameUploaded;
+	statistics.FailedCount            = _failedCount;
+	return statistics;
+}
+#pragma endregion UploadArena
@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   AudioMixer.hpp
+///             @brief  Software audio mixer (CPU mixing, resampling and 3D attenuation)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef AUDIO_MIXER_HPP
+#define AUDIO_MIXER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMVector.hpp"
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class AudioSink;
+
+using AudioVoiceHandle = std::uint32_t; // low 16 bit : voice index, high 16 bit : generation
+constexpr AudioVoiceHandle INVALID_AUDIO_VOICE = 0;
+
+enum class AudioInterpolation : std::uint8_t
+{
+	Linear, // 2 taps
+	Cubic   // 4 taps (Catmull-Rom)
+};
+
+/****************************************************************************
+*				  			AudioMixerClip
+*************************************************************************//**
+*  @class     AudioMixerClip
+*  @brief     Decoded sound for the software mixer (interleaved float, mono or stereo)
+*****************************************************************************/
+class AudioMixerClip
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool LoadFromFile(const std::wstring& filePath);
+	bool Create(const float* samples, std::uint64_t frameCount, std::uint32_t channelCount, std::uint32_t sampleRate);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const float*  GetSamples     () const { return _samples.data(); }
+	std::uint64_t GetFrameCount  () const { return _frameCount; }
+	std::uint32_t GetChannelCount() const { return _channelCount; }
+	std::uint32_t GetSampleRate  () const { return _sampleRate; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	AudioMixerClip()  = default;
+	~AudioMixerClip() = default;
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<float> _samples;
+	std::uint64_t _frameCount   = 0;
+	std::uint32_t _channelCount = 0;
+	std::uint32_t _sampleRate   = 0;
+};
+
+/****************************************************************************
+*				  			AudioMixerPlayDesc
+*************************************************************************//**
+*  @struct    AudioMixerPlayDesc
+*  @brief     Initial parameters of a voice
+*****************************************************************************/
+struct AudioMixerPlayDesc
+{
+	float Volume = 1.0f;
+	float Pan    = 0.0f; // -1 : left, 1 : right
+	float Pitch  = 1.0f; // frequency ratio
+	bool  IsLoop = false;
+	AudioInterpolation Interpolation = AudioInterpolation::Linear;
+};
+
+/****************************************************************************
+*				  			AudioMixerListener
+*************************************************************************//**
+*  @struct    AudioMixerListener
+*  @brief     Listener (same meaning as AudioListener of AudioSource3D, left handed)
+*****************************************************************************/
+struct AudioMixerListener
+{
+	gm::Float3 Front    = gm::Float3(0.0f, 0.0f, 1.0f);
+	gm::Float3 Up       = gm::Float3(0.0f, 1.0f, 0.0f);
+	gm::Float3 Position = gm::Float3(0.0f, 0.0f, 0.0f);
+	gm::Float3 Velocity = gm::Float3(0.0f, 0.0f, 0.0f);
+};
+
+/****************************************************************************
+*				  			AudioMixerEmitter
+*************************************************************************//**
+*  @struct    AudioMixerEmitter
+*  @brief     Emitter (same meaning as AudioEmitter of AudioSource3D)
+*             Volume : CurveDistanceScaler / max(distance, CurveDistanceScaler) (X3DAudio default curve)
+*             Pitch  : (c - DopplerScaler * listenerVelocity) / (c - DopplerScaler * emitterVelocity)
+*****************************************************************************/
+struct AudioMixerEmitter
+{
+	gm::Float3 Position = gm::Float3(0.0f, 0.0f, 0.0f);
+	gm::Float3 Velocity = gm::Float3(0.0f, 0.0f, 0.0f);
+	float InnerRadius         = 1.0f; // inside this radius the sound is panned to the center
+	float CurveDistanceScaler = 1.0f;
+	float DopplerScaler       = 1.0f;
+};
+
+/****************************************************************************
+*				  			AudioMixer
+*************************************************************************//**
+*  @class     AudioMixer
+*  @brief     Optional CPU mixer with a fixed voice pool and stereo float output.
+*             It doesn't depend on XAudio2, so it also runs headless with NullAudioSink / WavFileAudioSink.
+*             When all voices are used, the oldest one-shot voice is stolen (looping voices are never stolen).
+*             Not thread safe: call the voice functions and Mix / Render from the same thread.
+*****************************************************************************/
+class AudioMixer
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Initialize(std::uint32_t sampleRate = 48000, std::uint32_t voiceCount = 64, std::uint32_t blockFrameCount = 256, AudioSink* sink = nullptr);
+	void Finalize();
+
+	AudioVoiceHandle Play(const std::shared_ptr<const AudioMixerClip>& clip, const AudioMixerPlayDesc& desc = AudioMixerPlayDesc());
+	void Stop   (AudioVoiceHandle handle);
+	void StopAll();
+
+	void Mix   (float* output, size_t frameCount); // interleaved stereo
+	bool Render(size_t frameCount);                 // mix and write to the sink
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool IsPlaying(AudioVoiceHandle handle) const { return FindVoice(handle) != nullptr; }
+	void SetVolume(AudioVoiceHandle handle, float volume);
+	void SetPan   (AudioVoiceHandle handle, float pan);
+	void SetPitch (AudioVoiceHandle handle, float pitch);
+	void SetEmitter(AudioVoiceHandle handle, const AudioMixerEmitter& emitter); // enables 3D
+	void SetListener(const AudioMixerListener& listener) { _listener = listener; }
+	void SetMasterVolume(float volume) { _masterVolume = volume; }
+	void SetSink(AudioSink* sink);
+
+	std::uint32_t GetSampleRate      () const { return _sampleRate; }
+	std::uint32_t GetChannelCount    () const { return 2; }
+	std::uint32_t GetVoiceCount      () const { return static_cast<std::uint32_t>(_voices.size()); }
+	std::uint32_t GetActiveVoiceCount() const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	AudioMixer() = default;
+	~AudioMixer();
+	AudioMixer(const AudioMixer&)            = delete;
+	AudioMixer& operator=(const AudioMixer&) = delete;
+private:
+	struct Voice
+	{
+		std::shared_ptr<const AudioMixerClip> Clip = nullptr;
+		std::uint64_t Position   = 0;     // 32.32 fixed point frame
+		std::uint64_t StartOrder = 0;
+		float Volume = 1.0f;
+		float Pan    = 0.0f;
+		float Pitch  = 1.0f;
+		float CurrentGain[2] = { 0.0f, 0.0f }; // ramped per block
+		AudioMixerEmitter  Emitter;
+		AudioInterpolation Interpolation = AudioInterpolation::Linear;
+		std::uint16_t Generation = 1;
+		bool IsActive = false;
+		bool IsLoop   = false;
+		bool Is3D     = false;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void MixBlock(float* output, size_t frameCount);
+	void CalculateGain(const Voice& voice, float& left, float& right, float& doppler) const;
+	Voice*       FindVoice(AudioVoiceHandle handle);
+	const Voice* FindVoice(AudioVoiceHandle handle) const;
+	void ReleaseVoice(Voice& voice);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<Voice> _voices;
+	std::vector<float> _voiceBuffer; // resampled samples of one voice
+	std::vector<float> _mixBuffer;   // for Render
+	AudioMixerListener _listener;
+	AudioSink*    _sink            = nullptr;
+	std::uint32_t _sampleRate      = 0;
+	std::uint32_t _blockFrameCount = 0;
+	std::uint64_t _playCounter     = 0;
+	float         _masterVolume    = 1.0f;
+};
+#endif
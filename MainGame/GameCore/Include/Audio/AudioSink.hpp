@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   AudioSink.hpp
+///             @brief  Output destination of the software audio mixer
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef AUDIO_SINK_HPP
+#define AUDIO_SINK_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+/****************************************************************************
+*				  			AudioSink
+*************************************************************************//**
+*  @class     AudioSink
+*  @brief     AudioSink Abstract Class (receives interleaved 32bit float frames)
+*****************************************************************************/
+class AudioSink
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	virtual bool Open (std::uint32_t sampleRate, std::uint32_t channelCount) = 0;
+	virtual bool Write(const float* samples, size_t frameCount)               = 0;
+	virtual void Close() {};
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	virtual ~AudioSink() = default;
+};
+
+/****************************************************************************
+*				  			NullAudioSink
+*************************************************************************//**
+*  @class     NullAudioSink
+*  @brief     Discard the output (headless run, profiling)
+*****************************************************************************/
+class NullAudioSink : public AudioSink
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Open (std::uint32_t sampleRate, std::uint32_t channelCount) override;
+	bool Write(const float* samples, size_t frameCount) override;
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::uint64_t GetWrittenFrameCount() const { return _writtenFrameCount; }
+	float         GetPeak() const { return _peak; } // max absolute sample since Open
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	NullAudioSink()  = default;
+	~NullAudioSink() = default;
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::uint32_t _channelCount      = 0;
+	std::uint64_t _writtenFrameCount = 0;
+	float         _peak              = 0.0f;
+};
+
+/****************************************************************************
+*				  			WavFileAudioSink
+*************************************************************************//**
+*  @class     WavFileAudioSink
+*  @brief     Write the output to a 32bit float wave file (the sizes are fixed at Close)
+*****************************************************************************/
+class WavFileAudioSink : public AudioSink
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Open (std::uint32_t sampleRate, std::uint32_t channelCount) override;
+	bool Write(const float* samples, size_t frameCount) override;
+	void Close() override;
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::uint64_t GetWrittenFrameCount() const { return _writtenFrameCount; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	explicit WavFileAudioSink(const std::wstring& filePath) : _filePath(filePath) {};
+	~WavFileAudioSink();
+	WavFileAudioSink(const WavFileAudioSink&)            = delete;
+	WavFileAudioSink& operator=(const WavFileAudioSink&) = delete;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void WriteHeader(std::uint32_t dataSize);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::wstring  _filePath;
+	std::ofstream _stream;
+	std::uint32_t _sampleRate        = 0;
+	std::uint32_t _channelCount      = 0;
+	std::uint64_t _writtenFrameCount = 0;
+};
+#endif
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "AudioClip.hpp"
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <unordered_map>
 
 
@@ -31,12 +32,12 @@ public:
 	/****************************************************************************
 	**                Public Function
 	*****************************************************************************/
-	void ClearAudioTable() { AudioTable.clear(); }
+	void ClearAudioTable() { AudioTable.Clear(); }
 
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
-	std::unordered_map<std::wstring, std::shared_ptr<AudioClip>> AudioTable;
+	gm::FlatHashMap<std::wstring, std::shared_ptr<AudioClip>> AudioTable; // file path -> clip
 
 	/***************************************************************************
 	**                Constructor and Destructor
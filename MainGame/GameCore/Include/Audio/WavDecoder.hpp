@@ -12,15 +12,45 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include <string>
-#include <Windows.h>
 #include <memory>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+#define WAV_FORMAT_PCM        (0x0001)
+#define WAV_FORMAT_IEEE_FLOAT (0x0003)
+#define WAV_FORMAT_EXTENSIBLE (0xFFFE)
+
+/****************************************************************************
+*				  			WavFormat
+*************************************************************************//**
+*  @struct    WavFormat
+*  @brief     Platform independent format of the wave data.
+*             FormatTag is PCM or IEEE float (the sub format of WAVE_FORMAT_EXTENSIBLE is resolved).
+*****************************************************************************/
+struct WavFormat
+{
+	std::uint16_t FormatTag          = 0;
+	std::uint16_t Channels           = 0;
+	std::uint32_t SamplesPerSecond   = 0;
+	std::uint32_t AverageBytesPerSecond = 0;
+	std::uint16_t BlockAlign         = 0; // byte size of one frame (all channels)
+	std::uint16_t BitsPerSample      = 0; // container size
+	std::uint16_t ValidBitsPerSample = 0; // <= BitsPerSample (extensible only)
+	std::uint32_t ChannelMask        = 0; // speaker positions (extensible only)
+	bool          IsExtensible       = false;
+};
 
 /*************************************************************************//**
 *  @class     WavFile
-*  @brief     Wave File write and read
+*  @brief     RIFF / WAVE decoder (PCM 8, 16, 24, 32bit, IEEE float 32, 64bit and WAVE_FORMAT_EXTENSIBLE)
+*             LoadFromFile reads the whole wave data. For the long tracks, OpenStream only parses the
+*             header, and ReadFrames / ReadFramesAsFloat decode the data chunk by chunk (SeekFrame for scrubbing).
 *****************************************************************************/
 class WavDecoder
 {
@@ -30,37 +60,63 @@ public:
 	*****************************************************************************/
 	bool LoadFromFile(const std::wstring& filePath);
 
+	/* streaming */
+	bool   OpenStream(const std::wstring& filePath);
+	size_t ReadFrames       (void*  destination, size_t frameCount); // as stored in the file
+	size_t ReadFramesAsFloat(float* destination, size_t frameCount); // interleaved [-1, 1]
+	bool   SeekFrame(std::uint64_t frame);
+	bool   Close();
+
+	const WavFormat&               GetFormat()       const { return _format; }
+#ifdef _WIN32
 	const WAVEFORMATEX&            GetFileFormatEx() const;
+#endif
 	const std::wstring&            GetFilePath()     const;
-	const std::shared_ptr<BYTE[]>& GetWaveData()     const;
-	const size_t                   GetWaveSize()     const;
+	const std::shared_ptr<std::uint8_t[]>& GetWaveData() const;
+	size_t                         GetWaveSize()     const;
 
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	std::uint64_t GetFrameCount  () const { return _frameCount; }
+	std::uint64_t GetCurrentFrame() const { return _currentFrame; }
+	bool          IsEndOfStream  () const { return _currentFrame >= _frameCount; }
+	bool          IsOpened       () const { return _stream.is_open(); }
 
 	/****************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
 	WavDecoder();
 	~WavDecoder() = default;
+	WavDecoder(const WavDecoder&)            = delete;
+	WavDecoder& operator=(const WavDecoder&) = delete;
+	WavDecoder(WavDecoder&&)                 = default;
+	WavDecoder& operator=(WavDecoder&&)      = default;
 private:
 	/****************************************************************************
 	**                Private Function
 	*****************************************************************************/
 	bool Open(const std::wstring& filePath);
-	bool CreateWaveFormatEx(size_t formatChunk);
+	bool ReadChunks();
+	bool CreateWavFormat(const std::uint8_t* formatChunk, size_t formatChunkSize);
 	bool CreateWaveData(size_t dataSize);
-	bool CheckChunk(MMCKINFO* chunkNext, MMCKINFO* chunkPrev, char c0, char c1, char c2, char c3, UINT flag);
-	bool Close();
+	void ReportError(const wchar_t* message) const;
 	/****************************************************************************
 	**                Private Member Variables
 	*****************************************************************************/
-	HMMIO _handle                     = nullptr;
-	std::shared_ptr<BYTE[]> _waveData = nullptr;
+	std::ifstream _stream;
+	std::shared_ptr<std::uint8_t[]> _waveData = nullptr;
 	size_t _waveDataSize              = 0;
 	std::wstring _filePath            = L"";
+	WavFormat    _format;
+#ifdef _WIN32
 	WAVEFORMATEX _waveFormatEx;
+#endif
+
+	std::uint64_t _dataOffset   = 0; // byte offset of the data chunk body in the file
+	std::uint64_t _frameCount   = 0;
+	std::uint64_t _currentFrame = 0;
+	std::vector<std::uint8_t> _decodeBuffer; // raw frames for ReadFramesAsFloat
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   WavStream.hpp
+///             @brief  Chunked wave playback data (ring of fixed size buffers)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef WAV_STREAM_HPP
+#define WAV_STREAM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/WavDecoder.hpp"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+/****************************************************************************
+*				  			WavStream
+*************************************************************************//**
+*  @class     WavStream
+*  @brief     Streaming wave data for the long tracks (BGM).
+*             Only bufferCount * bufferByteSize bytes are resident, and the playback can start
+*             after the first buffer. ReadNextBuffer overwrites the oldest buffer of the ring,
+*             so submit at most (bufferCount - 1) buffers to the source voice at the same time.
+*****************************************************************************/
+class WavStream
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Open(const std::wstring& filePath, size_t bufferByteSize = 64 * 1024, size_t bufferCount = 3, bool isLoop = false);
+	const std::uint8_t* ReadNextBuffer(size_t& outByteSize);
+	bool SeekFrame(std::uint64_t frame);
+	bool SeekTime (double second);
+	void Close();
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool IsEndOfStream() const { return !_isLoop && _decoder.IsEndOfStream(); }
+	bool IsLoop       () const { return _isLoop; }
+	void SetLoop(bool isLoop)  { _isLoop = isLoop; }
+	size_t GetBufferByteSize() const { return _bufferByteSize; }
+	size_t GetBufferCount   () const { return _buffers.size(); }
+	const WavFormat&  GetFormat () const { return _decoder.GetFormat(); }
+	const WavDecoder& GetDecoder() const { return _decoder; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	WavStream() = default;
+	~WavStream() = default;
+	WavStream(const WavStream&)            = delete;
+	WavStream& operator=(const WavStream&) = delete;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	WavDecoder _decoder;
+	std::vector<std::vector<std::uint8_t>> _buffers;
+	size_t _bufferByteSize = 0; // multiple of BlockAlign
+	size_t _bufferIndex    = 0; // next buffer to fill
+	bool   _isLoop         = false;
+};
+
+#endif
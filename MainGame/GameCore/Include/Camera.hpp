@@ -35,6 +35,20 @@ struct Frustum
 	float NearWindowHeight;
 	float FarWindowHeight;
 };
+
+/****************************************************************************
+*				  			FrustumPlanes
+*************************************************************************//**
+*  @struct    FrustumPlanes
+*  @brief     Six planes (a, b, c, d) of the view frustum in world space (left, right, bottom, top, near, far).
+*             The normal (a, b, c) is normalized and points inside,
+*             so a point p is inside when a * p.x + b * p.y + c * p.z + d >= 0.
+*****************************************************************************/
+struct FrustumPlanes
+{
+	static constexpr int PLANE_COUNT = 6;
+	gm::Float4 Planes[PLANE_COUNT];
+};
 /****************************************************************************
 *				  			Camera
 *************************************************************************//**
@@ -88,6 +102,13 @@ public:
 	gm::Float4x4  GetViewMatrix4x4f()       const;
 	gm::Float4x4  GetProjectionMatrix4x4f() const;
 
+	// Get frustum planes (world space)
+	FrustumPlanes GetFrustumPlanes() const;
+	static FrustumPlanes ExtractFrustumPlanes(const gm::Float4x4& viewProjection);
+
+	// Get world space ray through the screen pixel (mouse picking)
+	void GetScreenRay(float screenX, float screenY, gm::Float3& outOrigin, gm::Float3& outDirection) const;
+
 
 	// Set frusum
 	void SetLens(float fovVertical, float aspect, float nearZ, float farZ);
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameMath/Include/GMVector.hpp"
+#include <DirectXMath.h>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
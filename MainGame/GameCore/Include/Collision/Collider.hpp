@@ -66,17 +66,19 @@ public:
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	struct Circle
+	{
+		float radius;
+	};
+	struct Rectangle
+	{
+		float width;
+		float height;
+	};
 	union
 	{
-		struct Circle
-		{
-			float radius;
-		} circle;
-		struct Rectangle
-		{
-			float width;
-			float height;
-		} rectangle;
+		Circle    circle;
+		Rectangle rectangle;
 	};
 	void SetCenterPosition(gm::Float2& center);
 	gm::Float3 centerPosition;
@@ -17,6 +17,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 struct Collider2D;
 struct Collider3D;
+namespace gm { struct Float2; }
 
 //////////////////////////////////////////////////////////////////////////////////
 //								Class
@@ -38,6 +39,10 @@ public:
 	static bool OnCollision3D(const Collider3D& first, const Collider3D& second);
 	static bool IsContainedObjectInFrustum(const Collider3D& frustum, const Collider3D& object);
 
+	// continuous collision detection (first moves by displacement, second is at rest)
+	static bool       OnSweepCollision2D(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact);
+	static Collider2D GetSweptBounds2D  (const Collider2D& collider, const gm::Float2& displacement);
+
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
@@ -54,6 +59,10 @@ private:
 	static bool Rect_vs_Circle  (const Collider2D& first, const Collider2D& second);
 	static bool Circle_vs_Rect  (const Collider2D& first, const Collider2D& second);
 	static bool Rect_vs_Rect    (const Collider2D& first, const Collider2D& second);
+	static bool Sweep_Circle_vs_Circle(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact);
+	static bool Sweep_Circle_vs_Rect  (const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact);
+	static bool Sweep_Rect_vs_Circle  (const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact);
+	static bool Sweep_Rect_vs_Rect    (const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact);
 #pragma endregion 2D
 
 #pragma region 3D
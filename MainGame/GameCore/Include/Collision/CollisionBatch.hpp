@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CollisionBatch.hpp
+///             @brief  Batched Collision Detection (one collider vs SoA collider arrays)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef COLLISION_BATCH_HPP
+#define COLLISION_BATCH_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+struct Collider2D;
+struct Collider3D;
+
+// every SoA array is padded to this lane count so that the SIMD kernels never need a scalar tail.
+#define COLLISION_BATCH_LANE_COUNT 8
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			CircleColliderArray
+*************************************************************************//**
+*  @class     CircleColliderArray
+*  @brief     Circle colliders (2D) stored as structure of arrays.
+*             Collider2D keeps a 3D center and Circle_vs_Circle measures the distance
+*             with z, so z is stored too (0 for the colliders added with x, y only).
+*****************************************************************************/
+struct CircleColliderArray
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Add(const Collider2D& circle);
+	void Add(float centerX, float centerY, float radius);
+	void Add(float centerX, float centerY, float centerZ, float radius);
+	void Clear();
+	void Reserve(size_t count);
+	size_t Size() const { return _count; }
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> CenterZ;
+	std::vector<float> Radius;
+
+private:
+	size_t _count = 0;
+};
+
+/****************************************************************************
+*				  			RectangleColliderArray
+*************************************************************************//**
+*  @class     RectangleColliderArray
+*  @brief     Rectangle colliders (2D) stored as structure of arrays
+*****************************************************************************/
+struct RectangleColliderArray
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Add(const Collider2D& rectangle);
+	void Add(float centerX, float centerY, float width, float height);
+	void Clear();
+	void Reserve(size_t count);
+	size_t Size() const { return _count; }
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> Width;
+	std::vector<float> Height;
+
+private:
+	size_t _count = 0;
+};
+
+/****************************************************************************
+*				  			SphereColliderArray
+*************************************************************************//**
+*  @class     SphereColliderArray
+*  @brief     Sphere colliders (3D) stored as structure of arrays
+*****************************************************************************/
+struct SphereColliderArray
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Add(const Collider3D& sphere);
+	void Add(float centerX, float centerY, float centerZ, float radius);
+	void Clear();
+	void Reserve(size_t count);
+	size_t Size() const { return _count; }
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> CenterZ;
+	std::vector<float> Radius;
+
+private:
+	size_t _count = 0;
+};
+
+/****************************************************************************
+*				  			AABBColliderArray
+*************************************************************************//**
+*  @class     AABBColliderArray
+*  @brief     Axis aligned box colliders (3D) stored as structure of arrays
+*****************************************************************************/
+struct AABBColliderArray
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void Add(const Collider3D& box);
+	void Add(float centerX, float centerY, float centerZ, float extentX, float extentY, float extentZ);
+	void Clear();
+	void Reserve(size_t count);
+	size_t Size() const { return _count; }
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> CenterZ;
+	std::vector<float> ExtentX;
+	std::vector<float> ExtentY;
+	std::vector<float> ExtentZ;
+
+private:
+	size_t _count = 0;
+};
+
+/****************************************************************************
+*				  			CollisionBatch
+*************************************************************************//**
+*  @class     CollisionBatch
+*  @brief     Test one collider against N colliders with SSE/AVX.
+*             The result is written to outHitMask (bit i of word i / 32 is set when
+*             the i-th collider is hit). Results are bit-exact with Collision::OnCollision2D/3D.
+*****************************************************************************/
+class CollisionBatch
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	static size_t GetHitMaskWordCount(size_t colliderCount) { return (colliderCount + 31) / 32; }
+	static bool   IsHit(const std::uint32_t* hitMask, size_t index) { return (hitMask[index / 32] >> (index % 32)) & 1u; }
+
+#pragma region 2D
+	static void CircleVsCircles      (const Collider2D& circle   , const CircleColliderArray&    circles   , std::uint32_t* outHitMask);
+	static void CircleVsRectangles   (const Collider2D& circle   , const RectangleColliderArray& rectangles, std::uint32_t* outHitMask);
+	static void RectangleVsCircles   (const Collider2D& rectangle, const CircleColliderArray&    circles   , std::uint32_t* outHitMask);
+	static void RectangleVsRectangles(const Collider2D& rectangle, const RectangleColliderArray& rectangles, std::uint32_t* outHitMask);
+#pragma endregion 2D
+
+#pragma region 3D
+	static void SphereVsSpheres(const Collider3D& sphere, const SphereColliderArray& spheres, std::uint32_t* outHitMask);
+	static void SphereVsAABBs  (const Collider3D& sphere, const AABBColliderArray&   boxes  , std::uint32_t* outHitMask);
+	static void AABBVsSpheres  (const Collider3D& box   , const SphereColliderArray& spheres, std::uint32_t* outHitMask);
+	static void AABBVsAABBs    (const Collider3D& box   , const AABBColliderArray&   boxes  , std::uint32_t* outHitMask);
+#pragma endregion 3D
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+};
+
+#endif
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DynamicAABBTree.hpp
+///             @brief  Dynamic bounding volume hierarchy for 3D scene queries
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DYNAMIC_AABB_TREE_HPP
+#define DYNAMIC_AABB_TREE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/Collider.hpp"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class GameActor;
+
+#define AABB_TREE_NULL_NODE (-1)
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			AABB
+*************************************************************************//**
+*  @struct    AABB
+*  @brief     Min / Max axis aligned bounding box used by the tree nodes
+*****************************************************************************/
+struct AABB
+{
+	gm::Float3 Min;
+	gm::Float3 Max;
+
+	bool  Contains   (const AABB& other) const;
+	bool  Overlaps   (const AABB& other) const;
+	float SurfaceArea() const;
+	static AABB Union      (const AABB& a, const AABB& b);
+	static bool FromCollider(const Collider3D& collider, AABB& outAABB);
+};
+
+/****************************************************************************
+*				  			DynamicAABBTreeRaycastHit
+*************************************************************************//**
+*  @struct    DynamicAABBTreeRaycastHit
+*  @brief     Closest hit of DynamicAABBTree::Raycast
+*****************************************************************************/
+struct DynamicAABBTreeRaycastHit
+{
+	GameActor* Actor    = nullptr;
+	int        ProxyID  = AABB_TREE_NULL_NODE;
+	float      Distance = 0.0f;
+};
+
+/****************************************************************************
+*				  			DynamicAABBTree
+*************************************************************************//**
+*  @class     DynamicAABBTree
+*  @brief     Dynamic AABB tree (fattened leaves, incremental refit, tree rotations).
+*             Each leaf (proxy) keeps a Collider3D and the owner actor handle.
+*             Mouse picking (Raycast), trigger volumes (QueryOverlap) and culling (QueryFrustum)
+*             share this one index. Queries reuse an internal stack, so they are not thread safe.
+*****************************************************************************/
+class DynamicAABBTree
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	int  CreateProxy (const Collider3D& collider, GameActor* actor);
+	void DestroyProxy(int proxyID);
+	bool MoveProxy   (int proxyID, const Collider3D& collider, const gm::Float3& displacement = gm::Float3(0.0f, 0.0f, 0.0f));
+	void Clear();
+
+	void QueryOverlap(const Collider3D& volume , std::vector<GameActor*>& outActors) const;
+	void QueryFrustum(const Collider3D& frustum, std::vector<GameActor*>& outActors) const;
+	/* a leaf enclosing the origin is hit at distance 0 unless isContainingSkipped */
+	bool Raycast     (const gm::Float3& origin, const gm::Float3& direction, float maxDistance, DynamicAABBTreeRaycastHit& outHit, bool isContainingSkipped = false) const;
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	GameActor*        GetActor   (int proxyID) const { return _nodes[proxyID].Actor; }
+	const Collider3D& GetCollider(int proxyID) const { return _nodes[proxyID].Collider; }
+	const AABB&       GetFatAABB (int proxyID) const { return _nodes[proxyID].Box; }
+	bool WasMoved   (int proxyID) const { return _nodes[proxyID].Moved; }
+	void ClearMoved (int proxyID)       { _nodes[proxyID].Moved = false; }
+	int  GetHeight  () const { return (_root == AABB_TREE_NULL_NODE) ? 0 : _nodes[_root].Height; }
+	int  GetProxyCount() const { return _proxyCount; }
+	bool Validate   () const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	DynamicAABBTree(float fatMargin = 0.1f, float displacementMultiplier = 2.0f);
+	DynamicAABBTree(const DynamicAABBTree&)            = default;
+	DynamicAABBTree& operator=(const DynamicAABBTree&) = default;
+	DynamicAABBTree(DynamicAABBTree&&)                 = default;
+	DynamicAABBTree& operator=(DynamicAABBTree&&)      = default;
+	~DynamicAABBTree() = default;
+
+private:
+	struct Node
+	{
+		AABB       Box;
+		Collider3D Collider;
+		GameActor* Actor   = nullptr;
+		int        Parent  = AABB_TREE_NULL_NODE; // next free node when the node is in the free list
+		int        Child1  = AABB_TREE_NULL_NODE;
+		int        Child2  = AABB_TREE_NULL_NODE;
+		int        Height  = -1;                  // leaf = 0, free node = -1
+		bool       Moved   = false;
+
+		bool IsLeaf() const { return Child1 == AABB_TREE_NULL_NODE; }
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	int  AllocateNode();
+	void FreeNode    (int nodeID);
+	void InsertLeaf  (int leaf);
+	void RemoveLeaf  (int leaf);
+	int  Balance     (int nodeID);
+	void Refit       (int nodeID);
+	void FattenAABB  (const AABB& tight, const gm::Float3& displacement, AABB& outFat) const;
+	void CollectLeaves(int nodeID, std::vector<GameActor*>& outActors) const;
+	bool ValidateStructure(int nodeID) const;
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<Node> _nodes;
+	mutable std::vector<int> _stack;
+	int   _root       = AABB_TREE_NULL_NODE;
+	int   _freeList   = AABB_TREE_NULL_NODE;
+	int   _proxyCount = 0;
+	float _fatMargin;
+	float _displacementMultiplier;
+};
+#endif
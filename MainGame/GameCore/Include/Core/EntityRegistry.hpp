@@ -0,0 +1,349 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   EntityRegistry.hpp
+///             @brief  Archetype based entity storage (components, name / tag index)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ENTITY_REGISTRY_HPP
+#define ENTITY_REGISTRY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMFlatHashMap.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <atomic>
+#include <new>
+#include <cstdint>
+#include <cassert>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define ENTITY_INVALID_INDEX        (0xFFFFFFFFu)
+#define ENTITY_MAX_COMPONENT_TYPES  (64) // archetypes are identified by a 64 bit mask
+
+/****************************************************************************
+*				  			Entity
+*************************************************************************//**
+*  @struct    Entity
+*  @brief     Entity handle (index + generation). A destroyed entity's handle stays stale
+*             even after the index is reused, so it is safe to keep instead of a raw pointer.
+*****************************************************************************/
+struct Entity
+{
+	std::uint32_t Index      = ENTITY_INVALID_INDEX;
+	std::uint32_t Generation = 0;
+
+	bool IsNull() const { return Index == ENTITY_INVALID_INDEX; }
+	bool operator==(const Entity& other) const { return Index == other.Index && Generation == other.Generation; }
+	bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+namespace entity_detail
+{
+	using ComponentTypeID = std::uint32_t;
+
+	/****************************************************************************
+	*				  			ComponentTypeInfo
+	*************************************************************************//**
+	*  @struct    ComponentTypeInfo
+	*  @brief     Type erased operations of a component column
+	*****************************************************************************/
+	struct ComponentTypeInfo
+	{
+		ComponentTypeID ID;
+		size_t Size;
+		size_t Alignment;
+		void (*MoveConstruct)(void* destination, void* source);
+		void (*Destroy)(void* object);
+	};
+
+	inline ComponentTypeID CreateComponentTypeID()
+	{
+		static std::atomic<ComponentTypeID> counter = 0;
+		const ComponentTypeID id = counter.fetch_add(1);
+		assert(id < ENTITY_MAX_COMPONENT_TYPES);
+		return id;
+	}
+
+	template<class T>
+	ComponentTypeID GetComponentTypeID()
+	{
+		static const ComponentTypeID id = CreateComponentTypeID();
+		return id;
+	}
+
+	template<class T>
+	const ComponentTypeInfo* GetComponentTypeInfo()
+	{
+		static const ComponentTypeInfo info =
+		{
+			GetComponentTypeID<T>(), sizeof(T), alignof(T),
+			[](void* destination, void* source) { new (destination) T(std::move(*static_cast<T*>(source))); },
+			[](void* object) { static_cast<T*>(object)->~T(); }
+		};
+		return &info;
+	}
+
+	template<class... Ts>
+	std::uint64_t GetComponentMask() { return (0ull | ... | (1ull << GetComponentTypeID<Ts>())); }
+
+	/****************************************************************************
+	*				  			Archetype
+	*************************************************************************//**
+	*  @struct    Archetype
+	*  @brief     All entities with the same component set. Each component type is one
+	*             contiguous column, and row i of every column belongs to Entities[i].
+	*****************************************************************************/
+	struct Archetype
+	{
+		struct Column
+		{
+			const ComponentTypeInfo* Info = nullptr;
+			std::uint8_t*            Data = nullptr;
+		};
+
+		std::uint64_t       Mask = 0;
+		std::vector<Column> Columns; // sorted by type id
+		std::vector<Entity> Entities;
+		size_t              Capacity = 0;
+		std::int8_t         ColumnIndex[ENTITY_MAX_COMPONENT_TYPES]; // -1 : not included
+		std::uint32_t       AddEdge   [ENTITY_MAX_COMPONENT_TYPES]; // archetype after adding the type (cache)
+		std::uint32_t       RemoveEdge[ENTITY_MAX_COMPONENT_TYPES]; // archetype after removing the type (cache)
+
+		void*       GetComponent(size_t column, size_t row)       { return Columns[column].Data + Columns[column].Info->Size * row; }
+		template<class T> T* GetColumnData()
+		{
+			const std::int8_t column = ColumnIndex[GetComponentTypeID<T>()];
+			return column < 0 ? nullptr : reinterpret_cast<T*>(Columns[column].Data);
+		}
+
+		size_t PushRow(Entity entity);        // column memory of the new row is not constructed
+		Entity RemoveRow(size_t row);         // returns the entity moved into row (null : none)
+
+		explicit Archetype(const std::vector<const ComponentTypeInfo*>& types);
+		~Archetype();
+		Archetype(const Archetype&)            = delete;
+		Archetype& operator=(const Archetype&) = delete;
+	};
+}
+
+/****************************************************************************
+*				  			EntityRegistry
+*************************************************************************//**
+*  @class     EntityRegistry
+*  @brief     Entity storage grouped by archetype (component set).
+*             - Components of the same type are contiguous, and ForEach<Ts...> visits only the
+*               archetypes which have all of Ts (the matching list is cached per query).
+*             - Name and tag lookups are hashed; tag buckets are removed by swap in O(1).
+*             - Adding / removing a component moves the entity to another archetype, so component
+*               pointers are valid only until the next structural change.
+*             Do not create / destroy / add / remove inside ForEach; use DestroyDeferred there.
+*****************************************************************************/
+class EntityRegistry
+{
+	using Archetype = entity_detail::Archetype;
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	Entity Create(std::string_view name = std::string_view(), std::string_view tag = std::string_view());
+	template<class... Ts> Entity CreateWith(std::string_view name, std::string_view tag, Ts&&... components);
+	bool   Destroy(Entity entity);
+	void   DestroyDeferred(Entity entity) { if (IsAlive(entity)) { _destroyQueue.push_back(entity); } }
+	void   FlushDestroyed();
+	void   Clear();
+
+	template<class T, class... Args> T& AddComponent   (Entity entity, Args&&... args); // overwrite if it exists
+	template<class T>                bool RemoveComponent(Entity entity);
+	template<class T>                T*   GetComponent   (Entity entity);
+	template<class T>                bool HasComponent   (Entity entity) const;
+
+	/* function(Entity, Ts&...) */
+	template<class... Ts, class Function> void ForEach(Function&& function);
+
+	Entity                     Find          (std::string_view name) const;
+	const std::vector<Entity>& FindAllWithTag(std::string_view tag)  const;
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool IsAlive(Entity entity) const
+	{
+		return entity.Index < _records.size() && _records[entity.Index].Generation == entity.Generation && _records[entity.Index].Archetype != ENTITY_INVALID_INDEX;
+	}
+	const std::string& GetName(Entity entity) const;
+	const std::string& GetTag (Entity entity) const;
+	void SetName(Entity entity, std::string_view name);
+	void SetTag (Entity entity, std::string_view tag);
+
+	size_t GetEntityCount   () const { return _records.size() - _freeIndices.size(); }
+	size_t GetArchetypeCount() const { return _archetypes.size(); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	EntityRegistry();
+	~EntityRegistry() = default;
+	EntityRegistry(const EntityRegistry&)            = delete;
+	EntityRegistry& operator=(const EntityRegistry&) = delete;
+private:
+	struct EntityRecord
+	{
+		std::uint32_t Archetype  = ENTITY_INVALID_INDEX; // invalid : free
+		std::uint32_t Row        = 0;
+		std::uint32_t Generation = 0;
+		std::uint32_t NameSlot   = ENTITY_INVALID_INDEX; // position in the name bucket
+		std::uint32_t TagSlot    = ENTITY_INVALID_INDEX; // position in the tag bucket
+		std::string   Name;
+		std::string   Tag;
+	};
+	using Index = gm::FlatHashMap<std::string, std::vector<Entity>>;
+
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	Entity        AllocateEntity();
+	std::uint32_t FindOrCreateArchetype(std::uint64_t mask, const std::vector<const entity_detail::ComponentTypeInfo*>& types);
+	std::uint32_t GetAddArchetype   (std::uint32_t source, const entity_detail::ComponentTypeInfo* type);
+	std::uint32_t GetRemoveArchetype(std::uint32_t source, entity_detail::ComponentTypeID type);
+	void          MoveEntity(Entity entity, std::uint32_t destination); // moves the shared columns
+	void          RemoveFromArchetype(EntityRecord& record);
+	const std::vector<std::uint32_t>& GetQueryArchetypes(std::uint64_t mask);
+
+	static void AddToIndex     (Index& index, std::string& key, std::string_view value, std::uint32_t& slot, Entity entity);
+	static void RemoveFromIndex(Index& index, const std::string& key, std::uint32_t& slot, std::vector<EntityRecord>& records, bool isTag);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<EntityRecord>               _records;
+	std::vector<std::uint32_t>              _freeIndices;
+	std::vector<std::unique_ptr<Archetype>> _archetypes;
+	gm::FlatHashMap<std::uint64_t, std::uint32_t>              _archetypeIndex; // mask -> archetype
+	gm::FlatHashMap<std::uint64_t, std::unique_ptr<std::vector<std::uint32_t>>> _queryCache; // query mask -> archetypes (stable for nested ForEach)
+	Index               _nameIndex;
+	Index               _tagIndex;
+	std::vector<Entity> _destroyQueue;
+};
+
+#pragma region Template Function
+/****************************************************************************
+*                       CreateWith
+*************************************************************************//**
+*  @fn        template<class... Ts> Entity EntityRegistry::CreateWith(std::string_view name, std::string_view tag, Ts&&... components)
+*  @brief     Create an entity directly in the archetype of Ts (no intermediate moves)
+*  @param[in] std::string_view name
+*  @param[in] std::string_view tag
+*  @param[in] Ts&&... components
+*  @return 　　Entity
+*****************************************************************************/
+template<class... Ts>
+Entity EntityRegistry::CreateWith(std::string_view name, std::string_view tag, Ts&&... components)
+{
+	using namespace entity_detail;
+	const std::uint64_t mask = GetComponentMask<std::decay_t<Ts>...>();
+	std::uint32_t* found = _archetypeIndex.Find(mask);
+	const std::uint32_t archetypeIndex = found != nullptr ? *found
+		: FindOrCreateArchetype(mask, { GetComponentTypeInfo<std::decay_t<Ts>>()... });
+
+	Entity entity = Create(name, tag);
+	EntityRecord& record = _records[entity.Index];
+	RemoveFromArchetype(record);
+
+	Archetype& archetype = *_archetypes[archetypeIndex];
+	const size_t row = archetype.PushRow(entity);
+	(new (archetype.GetComponent(archetype.ColumnIndex[GetComponentTypeID<std::decay_t<Ts>>()], row)) std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+	record.Archetype = archetypeIndex;
+	record.Row       = static_cast<std::uint32_t>(row);
+	return entity;
+}
+
+/****************************************************************************
+*                       AddComponent
+*************************************************************************//**
+*  @fn        template<class T, class... Args> T& EntityRegistry::AddComponent(Entity entity, Args&&... args)
+*  @brief     Add (or overwrite) the component. The entity moves to the archetype with T.
+*  @param[in] Entity entity (must be alive)
+*  @param[in] Args&&... args
+*  @return 　　T&
+*****************************************************************************/
+template<class T, class... Args>
+T& EntityRegistry::AddComponent(Entity entity, Args&&... args)
+{
+	using namespace entity_detail;
+	assert(IsAlive(entity));
+	if (T* component = GetComponent<T>(entity))
+	{
+		*component = T(std::forward<Args>(args)...);
+		return *component;
+	}
+
+	const std::uint32_t destination = GetAddArchetype(_records[entity.Index].Archetype, GetComponentTypeInfo<T>());
+	MoveEntity(entity, destination);
+
+	const EntityRecord& record = _records[entity.Index];
+	Archetype& archetype = *_archetypes[record.Archetype];
+	return *new (archetype.GetComponent(archetype.ColumnIndex[GetComponentTypeID<T>()], record.Row)) T(std::forward<Args>(args)...);
+}
+
+template<class T>
+bool EntityRegistry::RemoveComponent(Entity entity)
+{
+	if (!HasComponent<T>(entity)) { return false; }
+	MoveEntity(entity, GetRemoveArchetype(_records[entity.Index].Archetype, entity_detail::GetComponentTypeID<T>()));
+	return true;
+}
+
+template<class T>
+T* EntityRegistry::GetComponent(Entity entity)
+{
+	if (!IsAlive(entity)) { return nullptr; }
+	const EntityRecord& record = _records[entity.Index];
+	Archetype& archetype = *_archetypes[record.Archetype];
+	const std::int8_t column = archetype.ColumnIndex[entity_detail::GetComponentTypeID<T>()];
+	return column < 0 ? nullptr : static_cast<T*>(archetype.GetComponent(column, record.Row));
+}
+
+template<class T>
+bool EntityRegistry::HasComponent(Entity entity) const
+{
+	if (!IsAlive(entity)) { return false; }
+	return (_archetypes[_records[entity.Index].Archetype]->Mask & entity_detail::GetComponentMask<T>()) != 0;
+}
+
+/****************************************************************************
+*                       ForEach
+*************************************************************************//**
+*  @fn        template<class... Ts, class Function> void EntityRegistry::ForEach(Function&& function)
+*  @brief     Call function(Entity, Ts&...) for every entity which has all of Ts.
+*             Rows are visited column by column in memory order. No allocation after the first call.
+*  @param[in] Function&& function
+*  @return 　　void
+*****************************************************************************/
+template<class... Ts, class Function>
+void EntityRegistry::ForEach(Function&& function)
+{
+	const std::vector<std::uint32_t>& archetypes = GetQueryArchetypes(entity_detail::GetComponentMask<Ts...>());
+	for (const std::uint32_t index : archetypes)
+	{
+		Archetype& archetype = *_archetypes[index];
+		const size_t count = archetype.Entities.size();
+		if (count == 0) { continue; }
+
+		const std::tuple<Ts*...> columns(archetype.GetColumnData<Ts>()...);
+		const Entity* entities = archetype.Entities.data();
+		for (size_t row = 0; row < count; ++row)
+		{
+			function(entities[row], std::get<Ts*>(columns)[row]...);
+		}
+	}
+}
+#pragma endregion Template Function
+#endif
@@ -15,6 +15,7 @@
 #include "DirectX12/Include/Core/DirectX12BlendState.hpp"
 #include "GameCore/Include/Sprite/SpriteRenderer.hpp"
 #include"GameMath/Include/GMTransform.hpp"
+#include "GameCore/Include/Core/EntityRegistry.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -55,6 +56,7 @@ public:
 
 	static std::vector<GameObject*> GameObjectsWithTag(const std::string& tag);
 	static size_t CountGameObjects() { return _gameObjects.size(); }
+	static void UpdateWorldMatrices();
 
 	
 	/****************************************************************************
@@ -68,16 +70,16 @@ public:
 	bool           IsActive     () const  { return _isActive; }
 	int            GetChildCount() const  { return static_cast<int>(_children.size()); }
 	
-	GameObject* GetChild(int index) { return (index < _children.size()) ? _children[index] : nullptr; }
+	GameObject* GetChild(int index) { return (0 <= index && index < GetChildCount()) ? _children[index] : nullptr; }
 	static GameObject* GetGameObjectList(int index) { return _gameObjects[index]; }
 
 	bool RemoveChild(GameObject* child);
 	void ClearChildren();
 
-	void SetName(const std::string& name) { _name = name; }
-	void SetTag (const std::string& name) { _tag  = name; }
+	void SetName(const std::string& name);
+	void SetTag (const std::string& name);
 	void SetActive(bool isActive)       { _isActive   = isActive; }
-	void SetParent(GameObject* parent)  { _parent     = parent; }
+	void SetParent(GameObject* parent);
 	void SetChild (GameObject* child)   { _children.push_back(child); }
 	void SetPosition(float x, float y, float z);
 	void SetPosition(const gm::Float3& position);
@@ -128,11 +130,21 @@ protected:
 	static bool IsUpdating;
 
 private:
+	struct GameObjectReference { GameObject* Object = nullptr; }; // entity component which points back to the gameObject
 	int GetLayerBit(const std::string& layer);
+	bool IsRegistered() const { return _listIndex < _gameObjects.size() && _gameObjects[_listIndex] == this; }
+	static void Unregister(GameObject* gameObject);
 
+	static GameObject* ToGameObject(Entity entity);
+
+	size_t _listIndex = 0; // position in _gameObjects (swap remove)
+	Entity _entity;        // name / tag entry in _registry
 	static std::vector<GameObject*> _gameObjects;
+	static EntityRegistry           _registry; // name / tag index of the gameObjects
 	static std::vector<GameObject*> _destroyGameObjects;
 	static std::vector<std::string> _layerList;
+	static gm::TransformHierarchy   _transformHierarchy; // all transforms, parents before children
+	static bool                     _isHierarchyDirty;   // an object was added / removed or re-parented
 };
 
 template<typename T> T* GameObject::Create()
@@ -145,13 +157,13 @@ template<typename T> T GameObject::GetComponent() const
 {
 	for (auto it = _components.begin(); it != _components.end(); ++it)
 	{
-		if (typeid(*it) == T)
+		if (T component = dynamic_cast<T>(*it))
 		{
-			return (T)(*it);
+			return component;
 		}
 	}
 
-	return NULL;
+	return nullptr;
 }
 
 template<typename T> std::vector<T> GameObject::GetComponents() const
@@ -159,11 +171,11 @@ template<typename T> std::vector<T> GameObject::GetComponents() const
 	std::vector<T> componentList;
 	for (auto it = _components.begin(); it != _components.end(); ++it)
 	{
-		if (typeid(*it) == T)
+		if (T component = dynamic_cast<T>(*it))
 		{
-			componentList.emplace_back((T)(*it));
+			componentList.emplace_back(component);
 		}
 	}
-	return std::move(componentList);
+	return componentList;
 }
 #endif
\ No newline at end of file
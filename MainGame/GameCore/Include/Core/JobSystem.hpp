@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   JobSystem.hpp
+///             @brief  Worker threads shared by the engine passes (parallel for)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			JobSystem
+*************************************************************************//**
+*  @class     JobSystem
+*  @brief     One pool of worker threads for the whole engine (kept during Initialize - Finalize).
+*             ParallelFor runs job(index) for every index of [0, jobCount) on the calling thread and the workers,
+*             and returns when all of them have finished. The jobs are taken one by one with an atomic counter.
+*             Calls from several threads are executed one after another. A job must not call ParallelFor.
+*****************************************************************************/
+class JobSystem
+{
+public:
+	using JobFunction = void(*)(void* context, size_t index);
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* workerCount < 0 : hardware_concurrency - 1 */
+	bool Initialize(int workerCount = -1);
+	void Finalize();
+
+	void ParallelFor(size_t jobCount, JobFunction function, void* context);
+	/* job : void(size_t index). It is not copied, and it must be callable from several threads at once */
+	template<class Job>
+	void ParallelFor(size_t jobCount, Job&& job)
+	{
+		using JobType = std::remove_reference_t<Job>;
+		ParallelFor(jobCount, [](void* context, size_t index) { (*static_cast<JobType*>(context))(index); },
+			const_cast<void*>(static_cast<const void*>(&job)));
+	}
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	int GetWorkerCount() const { return static_cast<int>(_workers.size()); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	JobSystem() = default;
+	~JobSystem();
+	JobSystem(const JobSystem&)            = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+	JobSystem(JobSystem&&)                 = delete;
+	JobSystem& operator=(JobSystem&&)      = delete;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void WorkerLoop(std::uint64_t generation);
+	void ExecuteJobs();
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<std::thread> _workers;
+	std::mutex               _executeMutex;   // one ParallelFor at a time
+	std::mutex               _mutex;
+	std::condition_variable  _startCondition;
+	std::condition_variable  _endCondition;
+	JobFunction              _function      = nullptr;
+	void*                    _context       = nullptr;
+	std::atomic<size_t>      _nextJob       = 0;
+	size_t                   _jobCount      = 0;
+	size_t                   _activeWorkers = 0;
+	std::uint64_t            _jobGeneration = 0;
+	bool                     _isQuit        = false;
+};
+#endif
@@ -14,6 +14,7 @@
 #include "GameCore/Include/Core/RenderingEngineStruct.hpp"
 #include "DirectX12/Include/Core/DirectX12Buffer.hpp"
 #include "GameCore/Include/Sprite/Font.hpp"
+#include <unordered_map>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -26,6 +27,13 @@ class GameActor;
 class SSAO;
 class TextRenderer;
 class SpriteRenderer;
+class Camera;
+class VisibilityCulling;
+class ClusteredLighting;
+class JobSystem;
+class DynamicAABBTree;
+struct VisibilityBoundsArray;
+struct VisibilityBox;
 struct TextString;
 struct TextNumber;
 
@@ -49,8 +57,22 @@ class RenderingEngine
 	using SSAOPtr           = std::unique_ptr<SSAO>;
 	using TextRendererPtr   = std::unique_ptr<TextRenderer>;
 	using SpriteRendererPtr = std::unique_ptr<SpriteRenderer>;
+	using VisibilityPtr     = std::unique_ptr<VisibilityCulling>;
+	using BoundsArrayPtr    = std::unique_ptr<VisibilityBoundsArray>;
+	using ClusteredLightingPtr = std::unique_ptr<ClusteredLighting>;
+	using JobSystemPtr      = std::unique_ptr<JobSystem>;
+	using PickingTreePtr    = std::unique_ptr<DynamicAABBTree>;
 	using SceneGPUAddress   = D3D12_GPU_VIRTUAL_ADDRESS;
 public:
+	/* clustered light buffers of the current frame (frame upload arena, 0 : not built or empty) */
+	struct ClusteredLightAddress
+	{
+		SceneGPUAddress Constants    = 0; // ClusterConstants
+		SceneGPUAddress PointLights  = 0; // StructuredBuffer<PointLight>
+		SceneGPUAddress SpotLights   = 0; // StructuredBuffer<SpotLight>
+		SceneGPUAddress LightRanges  = 0; // StructuredBuffer<ClusterLightRange> [cluster]
+		SceneGPUAddress LightIndices = 0; // StructuredBuffer<uint>
+	};
 	/****************************************************************************
 	**                Public Function
 	*****************************************************************************/
@@ -83,6 +105,8 @@ public:
 	---------------------------------------------------------------------*/
 #pragma region renderConfig
 	void EnableSSAO(bool enabled);
+	/* off by default : the forward pass does not bind the cluster buffers yet */
+	void EnableClusteredLighting(bool enabled);
 #pragma endregion renderConfig
 #pragma region Property
 	/*-------------------------------------------------------------------
@@ -91,9 +115,23 @@ public:
 	bool SetDirectionalLight(int lightID, const DirectionalLight& directionalLight);
 	bool SetPointLight      (int lightID, const PointLight&       pointLight);
 	bool SetSpotLight       (int lightID, const SpotLight&        spotLight);
+	/* lights only binned into the clusters, after the scene lights (no count limit, cleared on the scene transition) */
+	int  AddClusteredPointLight(const PointLight& pointLight);
+	int  AddClusteredSpotLight (const SpotLight&  spotLight);
+	void ClearClusteredLights();
+	const ClusteredLightAddress& GetClusteredLightAddress() const { return _clusteredLightAddress; }
 	void SetSceneGPUAddress(D3D12_GPU_VIRTUAL_ADDRESS sceneAddress);
+	/* camera for the frustum culling of the forward rendering actors (nullptr : draw all actors) */
+	void SetCamera         (const Camera* camera) { _camera = camera; }
 #pragma endregion Property
 
+	/*-------------------------------------------------------------------
+	-               Picking
+	---------------------------------------------------------------------*/
+	/* closest forward rendering actor under the screen pixel (nullptr : no hit or no camera).
+	   The actors are the ones drawn (with bounds) in the last frame. */
+	GameActor* PickForwardRenderingActor(float screenX, float screenY) const;
+
 	/*-------------------------------------------------------------------
 	-               AddObject  Renderer Function
 	---------------------------------------------------------------------*/
@@ -137,6 +175,17 @@ private:
 	RenderingEngine();
 	~RenderingEngine();
 
+	/* visibility of a forward rendering actor (same index as _forwardRenderingActors) */
+	struct CullingActor
+	{
+		UINT32 BoundIndex         = 0;
+		UINT32 MaterialBoundIndex = 0;
+		UINT32 MaterialCount      = 0;
+		bool   IsCulled           = false; // false : the actor has no bounds and is always drawn
+		bool   IsVisible          = true;
+		std::vector<UINT32> VisibleMaterials; // only for the PMX model
+	};
+
 	/****************************************************************************
 	**                Private Function
 	*****************************************************************************/
@@ -144,8 +193,13 @@ private:
 	void CopyToGPUSceneLightsBuffer();
 
 	bool DrawShadowMap();
+	void CullForwardRenderingActors();
+	void UpdatePickingProxy (GameActor* gameActor, const VisibilityBox& worldBox);
+	void DestroyPickingProxy(const GameActor* gameActor);
+	void RequestStreamingTextures();
+	void BuildClusteredLights();
 	bool DrawForwardRenderingAllModel();
-	bool DrawForwardRenderingPMXModel      (GameActor* gameActor);
+	bool DrawForwardRenderingPMXModel      (GameActor* gameActor, const CullingActor& culling);
 	bool DrawForwardRenderingPrimitiveModel(GameActor* gameActor);
 
 	/****************************************************************************
@@ -166,6 +220,36 @@ private:
 	bool _isMappedLight = false;
 	int _renderEffectFlag = 0;
 
+	/*-------------------------------------------------------------------
+	-               Worker threads (shared by the culling and the light binning)
+	---------------------------------------------------------------------*/
+	JobSystemPtr _jobSystem = nullptr;
+
+	/*-------------------------------------------------------------------
+	-               Visibility culling
+	---------------------------------------------------------------------*/
+	const Camera*             _camera            = nullptr;
+	VisibilityPtr             _visibilityCulling = nullptr;
+	BoundsArrayPtr            _visibilityBounds  = nullptr;
+	std::vector<CullingActor> _cullingActors;
+	std::vector<std::uint8_t> _isVisibleBound;
+
+	/*-------------------------------------------------------------------
+	-               Picking (world boxes of the forward rendering actors)
+	---------------------------------------------------------------------*/
+	PickingTreePtr _pickingTree = nullptr;
+	std::unordered_map<const GameActor*, int> _pickingProxies; // actor -> proxy ID
+
+	/*-------------------------------------------------------------------
+	-               Clustered lighting
+	---------------------------------------------------------------------*/
+	ClusteredLightingPtr    _clusteredLighting = nullptr;
+	std::vector<PointLight> _addedPointLights;
+	std::vector<SpotLight>  _addedSpotLights;
+	std::vector<PointLight> _clusteredPointLights; // scene lights + added lights (every frame)
+	std::vector<SpotLight>  _clusteredSpotLights;
+	ClusteredLightAddress   _clusteredLightAddress;
+
 };
 
 #endif
\ No newline at end of file
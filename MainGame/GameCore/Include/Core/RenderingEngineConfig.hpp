@@ -21,7 +21,8 @@
 
 enum class RenderEffectFlag
 {
-	AllowSSAO = 0x0001
+	AllowSSAO              = 0x0001,
+	AllowClusteredLighting = 0x0002  // build and upload the clustered light lists (no shader reads them yet)
 };
 
 #endif
\ No newline at end of file
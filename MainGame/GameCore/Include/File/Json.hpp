@@ -14,6 +14,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <cstddef>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -40,7 +41,8 @@ enum class JsonValueType
 	Number,
 	Object,
 	Array,
-	Bool
+	Bool,
+	Null
 };
 
 /****************************************************************************
@@ -48,6 +50,8 @@ enum class JsonValueType
 *************************************************************************//**
 *  @class     JsonValue
 *  @brief     json file parser and writer.
+*             Parse is built on JsonDocument. Use JsonDocument directly for the large files
+*             (JsonValue copies every string into std::map / std::vector).
 *****************************************************************************/
 class JsonValue
 {
@@ -76,6 +80,8 @@ public:
 	JsonValue();
 	~JsonValue();
 	JsonValue(const JsonValue& jsonValue);
+	JsonValue(JsonValue&& jsonValue) noexcept;
+	JsonValue(std::nullptr_t);
 	JsonValue(const std::string& str);
 	JsonValue(double value);
 	JsonValue(const Object& obj);
@@ -85,7 +91,7 @@ public:
 	template<typename T>
 	JsonValue& operator=(const T& value)
 	{
-		(*this).~JsonValue;
+		(*this).~JsonValue();
 		new(this) JsonValue(value);
 		return *this;
 	}
@@ -95,13 +101,6 @@ private:
 	/****************************************************************************
 	**                Private Function
 	*****************************************************************************/
-	JsonValue ParseJsonValue(const char*& data);
-	JsonValue ParseString(const char*& data);
-	JsonValue ParseNumber(const char*& data);
-	JsonValue ParseObject(const char*& data);
-	JsonValue ParseArray (const char*& data);
-	JsonValue ParseBool  (const char*& data);
-	void SkipSpace(const char*& data);
 
 	/****************************************************************************
 	**                Private Member Variables
@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   JsonDocument.hpp
+///             @brief  Arena based json parser (DOM and SAX)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef JSON_DOCUMENT_HPP
+#define JSON_DOCUMENT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define JSON_LINEAR_SEARCH_COUNT (8)   // objects with more members than this get a hash index
+#define JSON_MAX_DEPTH           (512)
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class, enum
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			JsonArena
+*************************************************************************//**
+*  @class     JsonArena
+*  @brief     Bump allocator for the json nodes. Memory is released only by Reset / destructor.
+*****************************************************************************/
+class JsonArena
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	void* Allocate(size_t byteSize, size_t alignment = alignof(std::max_align_t));
+	void  Reset();
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	size_t GetUsedByteSize    () const { return _usedByteSize; }
+	size_t GetReservedByteSize() const { return _reservedByteSize; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	explicit JsonArena(size_t blockByteSize = 64 * 1024) : _blockByteSize(blockByteSize) {};
+	~JsonArena() = default;
+	JsonArena(const JsonArena&)            = delete;
+	JsonArena& operator=(const JsonArena&) = delete;
+	JsonArena(JsonArena&&)                 = default;
+	JsonArena& operator=(JsonArena&&)      = default;
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<std::unique_ptr<std::uint8_t[]>> _blocks;
+	std::uint8_t* _current          = nullptr;
+	size_t        _restByteSize     = 0;
+	size_t        _blockByteSize    = 0;
+	size_t        _usedByteSize     = 0;
+	size_t        _reservedByteSize = 0;
+};
+
+/****************************************************************************
+*				  			JsonNodeType
+*************************************************************************//**
+*  @enum      JsonNodeType
+*  @brief     Json node type
+*****************************************************************************/
+enum class JsonNodeType : std::uint8_t
+{
+	Null,
+	Bool,
+	Number,
+	String,
+	Array,
+	Object
+};
+
+struct JsonMember;
+
+/****************************************************************************
+*				  			JsonNode
+*************************************************************************//**
+*  @class     JsonNode
+*  @brief     Json value placed in the arena (16 bytes, trivially copyable).
+*             Strings are views into the source buffer. When HasEscape() is true,
+*             the view still contains the escape sequences and GetString() (or JsonDocument::GetString) unescapes it.
+*             Array elements and object members are stored contiguously.
+*****************************************************************************/
+class JsonNode
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	const JsonNode*   Find(std::string_view key) const; // object member (nullptr : not found)
+	const JsonNode&   operator[](size_t index) const;   // array element or object member value
+	const JsonMember& GetMember(size_t index)  const;
+	std::string       GetString() const;               // unescaped copy
+
+	static std::string Unescape(std::string_view raw);
+	static size_t      Unescape(std::string_view raw, char* destination); // destination needs raw.size() bytes
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	JsonNodeType GetType() const { return _type; }
+	bool IsNull  () const { return _type == JsonNodeType::Null; }
+	bool IsBool  () const { return _type == JsonNodeType::Bool; }
+	bool IsNumber() const { return _type == JsonNodeType::Number; }
+	bool IsString() const { return _type == JsonNodeType::String; }
+	bool IsArray () const { return _type == JsonNodeType::Array; }
+	bool IsObject() const { return _type == JsonNodeType::Object; }
+
+	bool             GetBool      (bool   defaultValue = false) const { return IsBool  () ? _boolean : defaultValue; }
+	double           GetNumber    (double defaultValue = 0.0)   const { return IsNumber() ? _number  : defaultValue; }
+	std::string_view GetStringView() const { return IsString() ? std::string_view(_string, _count) : std::string_view(); }
+	bool             HasEscape    () const { return _hasEscape; }
+	std::uint32_t    Size         () const { return (IsArray() || IsObject()) ? _count : 0; }
+	const JsonNode*  GetElements  () const { return IsArray () ? _elements : nullptr; }
+	const JsonMember*GetMembers   () const { return IsObject() ? _members  : nullptr; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	JsonNode() : _number(0.0) {};
+	static JsonNode CreateNull  ()              { JsonNode node; node._type = JsonNodeType::Null;   return node; }
+	static JsonNode CreateBool  (bool value)    { JsonNode node; node._type = JsonNodeType::Bool;   node._boolean = value; return node; }
+	static JsonNode CreateNumber(double value)  { JsonNode node; node._type = JsonNodeType::Number; node._number  = value; return node; }
+	static JsonNode CreateString(const char* data, std::uint32_t length, bool hasEscape)
+	{
+		JsonNode node; node._type = JsonNodeType::String; node._string = data; node._count = length; node._hasEscape = hasEscape; return node;
+	}
+	static JsonNode CreateArray (JsonNode*   elements, std::uint32_t count) { JsonNode node; node._type = JsonNodeType::Array;  node._elements = elements; node._count = count; return node; }
+	static JsonNode CreateObject(JsonMember* members,  std::uint32_t count) { JsonNode node; node._type = JsonNodeType::Object; node._members  = members;  node._count = count; return node; }
+
+private:
+	friend class JsonDocument;
+	const std::uint32_t* GetHashIndex(std::uint32_t& capacity) const;
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	union
+	{
+		double      _number;
+		bool        _boolean;
+		const char* _string;
+		JsonNode*   _elements;
+		JsonMember* _members; // followed by the hash index when _count > JSON_LINEAR_SEARCH_COUNT
+	};
+	std::uint32_t _count     = 0; // string length or element count
+	JsonNodeType  _type      = JsonNodeType::Null;
+	bool          _hasEscape = false;
+};
+
+/****************************************************************************
+*				  			JsonMember
+*************************************************************************//**
+*  @struct    JsonMember
+*  @brief     Object member (keys are always unescaped)
+*****************************************************************************/
+struct JsonMember
+{
+	const char*   Key       = nullptr;
+	std::uint32_t KeyLength = 0;
+	std::uint32_t KeyHash   = 0;
+	JsonNode      Value;
+
+	std::string_view GetKey() const { return std::string_view(Key, KeyLength); }
+	static std::uint32_t Hash(std::string_view key); // FNV-1a
+};
+
+/****************************************************************************
+*				  			JsonHandler
+*************************************************************************//**
+*  @class     JsonHandler
+*  @brief     SAX callbacks (return false to stop parsing).
+*             String / key views point into the source buffer and still contain the escape sequences when hasEscape is true.
+*****************************************************************************/
+class JsonHandler
+{
+public:
+	virtual bool OnNull  ()             { return true; }
+	virtual bool OnBool  (bool value)   { (void)value; return true; }
+	virtual bool OnNumber(double value) { (void)value; return true; }
+	virtual bool OnString(std::string_view value, bool hasEscape) { (void)value; (void)hasEscape; return true; }
+	virtual bool OnKey   (std::string_view key  , bool hasEscape) { (void)key;   (void)hasEscape; return true; }
+	virtual bool OnStartObject() { return true; }
+	virtual bool OnEndObject(std::uint32_t memberCount)  { (void)memberCount;  return true; }
+	virtual bool OnStartArray () { return true; }
+	virtual bool OnEndArray (std::uint32_t elementCount) { (void)elementCount; return true; }
+
+	virtual ~JsonHandler() = default;
+};
+
+/****************************************************************************
+*				  			JsonDocument
+*************************************************************************//**
+*  @class     JsonDocument
+*  @brief     Json DOM. Every node lives in one arena and strings are not copied,
+*             so the source buffer must outlive the document (LoadFromFile keeps its own buffer).
+*****************************************************************************/
+class JsonDocument
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool LoadFromFile(const std::wstring& filePath);
+	bool Parse(const char* data, size_t byteSize);
+	bool Parse(std::string_view text) { return Parse(text.data(), text.size()); }
+	std::string_view GetString(const JsonNode& node); // unescape once into the arena and cache
+	void Clear();
+
+	static bool ParseSax(const char* data, size_t byteSize, JsonHandler& handler, std::string* errorMessage = nullptr, size_t* errorOffset = nullptr);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const JsonNode&    GetRoot        () const { return _root; }
+	const std::string& GetErrorMessage() const { return _errorMessage; }
+	size_t             GetErrorOffset () const { return _errorOffset; }
+	size_t             GetArenaByteSize() const { return _arena.GetUsedByteSize(); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	JsonDocument()  = default;
+	~JsonDocument() = default;
+	JsonDocument(const JsonDocument&)            = delete;
+	JsonDocument& operator=(const JsonDocument&) = delete;
+	JsonDocument(JsonDocument&&)                 = default;
+	JsonDocument& operator=(JsonDocument&&)      = default;
+private:
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	JsonArena   _arena;
+	JsonNode    _root;
+	std::unique_ptr<char[]> _source = nullptr; // LoadFromFile only
+	std::string _errorMessage;
+	size_t      _errorOffset = 0;
+};
+#endif
@@ -13,9 +13,9 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Include/Model/ModelFile.hpp"
 #include "PMDConfig.hpp"
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <vector>
 #include <array>
-#include <map>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -29,7 +29,6 @@
 class PMDData final : public ModelData
 {
 	using PMDBoneNodeAddressList = PMDBoneNode*;
-	using PMDBoneNodeIterator    = std::map<std::string, PMDBoneNode>::iterator;
 public:
 	/****************************************************************************
 	**                Public Function
@@ -41,19 +40,19 @@ public:
 	inline const  UINT16*       GetIndex()               const { return _indices.data();  }
 	inline const  PMDMaterial*  GetMaterial()            const { return _materials.data(); }
 	inline const  PMDTexture    GetTextureList(int index)const { return _textures[index]; }
-	inline        PMDBoneNode*  GetBoneNode(const std::string& boneName){ return &_boneNodeTable.at(boneName); }
-	inline        PMDBoneNodeIterator FindBoneNode(const std::string& boneName) { return _boneNodeTable.find(boneName); }
+	inline        PMDBoneNode*  GetBoneNode(std::string_view boneName)  { const int index = FindBoneIndex(boneName); return index >= 0 ? &_boneNodes[index] : nullptr; }
+	inline        int           FindBoneIndex(std::string_view boneName) const { const int* index = _boneNodeIndex.Find(boneName); return index != nullptr ? *index : -1; }
 	inline        PMDBoneIK*    GetBoneIK()                    { return _boneIKs.data(); }
 	inline        std::string*  GetBoneNames()                 { return _boneNames.data(); }
 	inline const  UINT32*       GetKneeIndex()           const { return _kneeIndices.data(); }
 	inline const  std::vector<UINT32>& GetKneeIndexList()const { return _kneeIndices; }
 	inline const  std::vector<PMDBoneNode*>& GetBoneAddressList() { return _boneNodeAddress; }
-	inline const  std::map<std::string, PMDBoneNode>& GetBoneNodeTable() const {return _boneNodeTable; }
+	inline const  std::vector<PMDBoneNode>& GetBoneNodes() const { return _boneNodes; }
 
 	inline size_t GetVertexCount()              { return _vertices.size(); }
 	inline size_t GetTotalIndexCount()          { return _indices.size();}
 	inline size_t GetMaterialCount()            { return _materials.size(); }
-	inline size_t GetBoneCount()                { return _boneNodeTable.size(); }
+	inline size_t GetBoneCount()                { return _boneNodes.size(); }
 	inline size_t GetBoneIKCount()              { return _boneIKs.size(); }
 	inline size_t GetKneeIndexCount()           { return _kneeIndices.size(); }
 	inline size_t GetBoneNodeAddressListCount() { return _boneNodeAddress.size(); }
@@ -95,7 +94,8 @@ private:
 	std::vector<UINT16>                 _indices;
 	std::vector<PMDMaterial>            _materials;
 	std::vector<PMDTexture>             _textures;
-	std::map<std::string, PMDBoneNode>  _boneNodeTable;
+	std::vector<PMDBoneNode>            _boneNodes;     // bone index order (the addresses do not change after loading)
+	gm::FlatHashMap<std::string, int>   _boneNodeIndex; // bone name -> bone index
 	std::vector<std::string>            _boneNames;
 	std::vector<PMDBoneNode*>           _boneNodeAddress;
 	std::vector<UINT32>                 _kneeIndices;
@@ -14,6 +14,7 @@
 #include "PMXConfig.hpp"
 #include "GameCore/Include/Model/ModelFile.hpp"
 #include "GameCore/Include/Model/ModelMaterial.hpp"
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <map>
 #include <array>
 //////////////////////////////////////////////////////////////////////////////////
@@ -25,7 +26,6 @@
 //////////////////////////////////////////////////////////////////////////////////
 class PMXData final : public ModelData
 {
-	using PMXBoneNodeIterator = std::map<std::string, PMXBoneNode>::iterator;
 	using PMXMorphIterator    = std::map<std::string, PMXMorph>::iterator;
 public:
 	/****************************************************************************
@@ -41,27 +41,28 @@ public:
 	inline const PMXMaterial*        GetMaterial()   const     { return _materials.data(); }
 	inline const PBRMaterial*        GetPBRMaterial() const { return _pbrMaterials.data(); }
 	inline const PMXTexture          GetTextureList(int index) { return _textures[index]; }
-	inline       PMXBoneNode*        GetBoneNode (const std::string& boneName) { return &_boneNodeTable.at(boneName); }
-	inline       PMXBoneNodeIterator FindBoneNode(const std::string& boneName) { return _boneNodeTable.find(boneName); }
+	inline       std::uint32_t       GetTextureStreamID(int index) const { return _textures[index].Texture.StreamID; }
+	inline       PMXBoneNode*        GetBoneNode (std::string_view boneName)   { const int index = FindBoneIndex(boneName); return index >= 0 ? &_boneNodes[index] : nullptr; }
+	inline       int                 FindBoneIndex(std::string_view boneName) const { const int* index = _boneNodeIndex.Find(boneName); return index != nullptr ? *index : -1; }
 	inline       PMXMorphIterator    FindMorph(const std::string& morphName)   { return _morphingMap.find(morphName); }
 	inline       PMXBoneIK*          GetBoneIK()                               { return _boneIKs.data(); }
 	inline       std::string*        GetBoneNames()                            { return _boneNames.data(); }
 	inline const std::vector<PMXBoneNode*>& GetBoneAddressList()               { return _boneNodeAddress; }
 	inline const std::vector<pmx::PMXRigidBody>& GetRigidBodyList() const { return _rigidBodies; }
 	inline const std::vector<pmx::PMXJoint>& GetJointList() const { return _joints; }
-	std::map<std::string, PMXBoneNode>& GetBoneNodeTable()  { return _boneNodeTable; }
+	std::vector<PMXBoneNode>&           GetBoneNodes()      { return _boneNodes; }
 	std::map<std::string, PMXMorph>   & GetMorphingMap()    { return _morphingMap; }
-	std::map<std::string, PMXBoneNode> CopyBoneNodeTable()  { return _boneNodeTable; }
+	std::vector<PMXBoneNode>           CopyBoneNodes()      { return _boneNodes; }
 	std::vector<PBRMaterial>           CopyPBRMaterials() { return _pbrMaterials; }
 
 	inline size_t GetVertexCount()   { return _vertices.size(); }
 	inline size_t GetIndexCount()    { return _indices.size(); }
 	inline size_t GetMaterialCount() { return _materials.size(); }
-	inline size_t GetBoneCount()     { return _boneNodeTable.size(); }
+	inline size_t GetBoneCount()     { return _boneNodes.size(); }
 	inline size_t GetBoneIKCount()   { return _boneIKs.size(); }
 	inline size_t GetBoneNodeAddressListCount()      { return _boneNodeAddress.size(); }
 	inline UINT  GetIndexCountForMaterial(int index) { return _materials[index].PolygonNum; }
-	inline int    GetMaterialNameIndex(const std::string& string) { return _materialNameIndex.at(string); }
+	inline int    GetMaterialNameIndex(std::string_view string) const { const int* index = _materialNameIndex.Find(string); return index != nullptr ? *index : -1; }
 	inline std::string GetMaterialName(int index) { return _materialNameList[index]; }
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -99,8 +100,9 @@ private:
 	std::vector<PMXMaterial>                 _materials;
 	std::vector<PBRMaterial>                 _pbrMaterials;
 	std::vector<std::string>                 _materialNameList;
-	std::map<std::string, int>               _materialNameIndex;
-	std::map<std::string, PMXBoneNode>       _boneNodeTable;
+	gm::FlatHashMap<std::string, int>        _materialNameIndex;
+	std::vector<PMXBoneNode>                 _boneNodes;     // bone index order (the addresses do not change after loading)
+	gm::FlatHashMap<std::string, int>        _boneNodeIndex; // bone name -> bone index
 	std::vector<std::string>                 _boneNames;
 	std::vector<PMXBoneNode*>                _boneNodeAddress;
 	std::vector<PMXBoneIK>                   _boneIKs;
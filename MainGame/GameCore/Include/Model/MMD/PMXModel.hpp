@@ -14,6 +14,7 @@
 #include "GameCore/Include/Model/Model.hpp"
 #include "GameCore/Include/Model/MMD/PMXFile.hpp"
 #include "GameCore/Include/GameConstantBufferConfig.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
 #include <future>
 #include <Windows.h>
 #include <unordered_map>
@@ -71,6 +72,8 @@ public:
 	virtual bool Initialize(const std::wstring& filePath, const std::wstring& addName = L"");
 	virtual bool Update();
 	virtual bool Draw(SceneGPUAddress scene, LightGPUAddress light);
+	/* visibleMaterials : material indices to draw (e.g. the result of VisibilityCulling) */
+	bool Draw(SceneGPUAddress scene, LightGPUAddress light, const std::vector<UINT32>& visibleMaterials);
 	virtual void Finalize();
 
 	bool StartAnimation(const std::wstring& motionName);
@@ -85,10 +88,15 @@ public:
 	void ResetAnimationTimer()  { _currentTime = 0; };
 	PMXData* GetPMXData() const { return _pmxData.get(); }
 	UploadBuffer<PMXBoneParameter>* GetBoneBuffer      () const  { return _boneBuffer.get(); }
+	/* bone constants of this frame (uploaded again when the model was not updated in this frame) */
+	D3D12_GPU_VIRTUAL_ADDRESS       GetBoneAddress     ();
 	UploadBuffer<PBRMaterial     >* GetMaterialBuffer  ()  const { return _materialBuffer.get(); }
 	const std::vector<std::string>& GetRootBoneNodeName() const  { return _rootBoneNodeNames; }
-	PMXBoneNode* GetRootBoneNode(std::string rootBoneName)       {  return &_boneMap.get()->at(rootBoneName);}
+	PMXBoneNode* GetRootBoneNode(std::string rootBoneName)       {  return FindBoneNode(rootBoneName);}
 	PMXPhysicsManager* GetPMXPhysicsManager() { return &_physicsManager; }
+	/* world space boxes of the skinned model (updated in Update) */
+	const VisibilityBox&              GetWorldBox()           const { return _worldBox; }
+	const std::vector<VisibilityBox>& GetMaterialWorldBoxes() const { return _materialWorldBoxes; }
 
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -112,6 +120,7 @@ protected:
 	bool PrepareBoneIK();
 	bool PreparePMXObject();
 	bool PreparePhysics();
+	bool PrepareMaterialBoxes();
 #pragma endregion Prepare
 #pragma region Update 
 	void UpdateTotalAnimation(); // morph, motion
@@ -123,6 +132,7 @@ protected:
 	void UpdatePhysicsAnimation(float deltaTime);
 	void ResetPhysics();
 	virtual bool UpdateGPUData();
+	void UpdateWorldBoxes();
 	void SetUpParallelUpdate();
 
 #pragma endregion Update
@@ -130,7 +140,11 @@ protected:
 	
 	void ClearBoneMatrices();
 	void WriteBoneParameterToBuffer();
+	/* bone node of this model (nullptr: the model has no bone of this name) */
+	PMXBoneNode* FindBoneNode(std::string_view boneName) { const int index = _pmxData->FindBoneIndex(boneName); return index >= 0 ? &_boneNodes->at(index) : nullptr; }
 #pragma endregion Bone Function
+	void SetDrawCommand(SceneGPUAddress scene, LightGPUAddress light);
+	void DrawMaterial  (UINT32 materialIndex);
 	
 	UINT32 CalculateAnimationFrameNo();
 
@@ -145,7 +159,10 @@ protected:
 	VertexBuffer              _vertexBuffer[FRAME_BUFFER_COUNT];
 	MaterialBuffer            _materialBuffer;
 	BoneBuffer                _boneBuffer;
-	std::vector<UINT>         _materialView;
+	ResourceViewHandle        _materialView; // CBV of each material (contiguous)
+	ResourceViewHandle        _boneView;
+	D3D12_GPU_VIRTUAL_ADDRESS _boneAddress     = 0; // frame upload arena (or _boneBuffer when the arena is full)
+	std::uint64_t             _boneFrameSerial = 0;
 	int _currentFrameIndex = 0;
 	int _parallelUpdateCount = 0;
 	std::vector<std::thread> _threads;
@@ -167,7 +184,7 @@ protected:
 	std::unique_ptr<std::vector<gm::Float3>> _bonePosition;
 	std::unique_ptr<std::vector<gm::Float4>> _boneQuaternion;
 	std::unique_ptr<PMXVertex[]>   _vertices;
-	std::unique_ptr<std::map<std::string, PMXBoneNode>> _boneMap;
+	std::unique_ptr<std::vector<PMXBoneNode>>           _boneNodes; // copy of the PMXData bone nodes (same index)
 	std::unique_ptr<std::vector<PMXBoneNode*>>          _boneNodeAddress;
 	std::unique_ptr<std::vector<PMXBoneNode*>>          _sortedBoneNodeAddress;
 	std::vector<std::string>                            _rootBoneNodeNames; //쒆SƑSĂ̐e{[
@@ -175,6 +192,21 @@ protected:
 
 	std::vector<std::pair<int, int>> _semiStandardBoneMap;
 	PMXPhysicsManager                _physicsManager;
+
+	/*-------------------------------------------------------------------
+	-           Culling
+	---------------------------------------------------------------------*/
+	struct MaterialBoneBox
+	{
+		INT32         Bone;
+		VisibilityBox Box;  // bind pose box of the material vertices which this bone moves
+	};
+	std::vector<UINT32>          _materialIndexOffsets;   // start index of each material
+	std::vector<MaterialBoneBox> _materialBoneBoxes;
+	std::vector<UINT32>          _materialBoneBoxOffsets; // [material] - [material + 1]
+	std::vector<gm::Float4x4>    _boneWorldMatrices;      // bone matrix * world
+	std::vector<VisibilityBox>   _materialWorldBoxes;
+	VisibilityBox                _worldBox;
 };
 
 #endif
\ No newline at end of file
@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12/Include/Core/DirectX12Core.hpp"
 #include <string>
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <unordered_map>
 #include <memory>
 //////////////////////////////////////////////////////////////////////////////////
@@ -40,10 +41,10 @@ public:
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
-	std::unordered_map<std::wstring, std::shared_ptr<PMDData>> ModelTablePMD;
-	std::unordered_map<std::wstring, std::shared_ptr<PMXData>> ModelTablePMX;
-	std::unordered_map<std::wstring, std::shared_ptr<OBJData>> ModelTableObj;
-	std::unordered_map<std::wstring, std::shared_ptr<FBXData>> ModelTableFbx;
+	gm::FlatHashMap<std::wstring, std::shared_ptr<PMDData>> ModelTablePMD; // file path -> model
+	gm::FlatHashMap<std::wstring, std::shared_ptr<PMXData>> ModelTablePMX;
+	gm::FlatHashMap<std::wstring, std::shared_ptr<OBJData>> ModelTableObj;
+	gm::FlatHashMap<std::wstring, std::shared_ptr<FBXData>> ModelTableFbx;
 	/***************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12/Include/Core/DirectX12Core.hpp"
 #include <string>
+#include "GameMath/Include/GMFlatHashMap.hpp"
 #include <unordered_map>
 #include <memory>
 //////////////////////////////////////////////////////////////////////////////////
@@ -31,12 +32,12 @@ public:
 	/****************************************************************************
 	**                Public Function
 	*****************************************************************************/
-	void Clear() { MotionTableVMD.clear(); }
+	void Clear() { MotionTableVMD.Clear(); }
 
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
-	std::unordered_map<std::wstring, std::shared_ptr<VMDFile>> MotionTableVMD;
+	gm::FlatHashMap<std::wstring, std::shared_ptr<VMDFile>> MotionTableVMD; // file path -> motion
 
 	/***************************************************************************
 	**                Constructor and Destructor
@@ -14,6 +14,7 @@
 #include "GameCore/Include/Model/Model.hpp"
 #include "GameCore/Include/GameConstantBufferConfig.hpp"
 #include "DirectX12/Include/DirectX12PrimitiveGeometry.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -69,6 +70,8 @@ public:
 	int  GetVertexCount() { return (int)_meshData.Vertices.size(); }
 	int  GetIndexCount()  { return (int)_meshData.Indices.size(); }
 	UploadBuffer<PBRMaterial>* GetMaterialBuffer() const { return _materialBuffer.get(); }
+	/* world bounding box (uses the world matrix of the last Update) */
+	VisibilityBox GetWorldBox() const { return _localBox.Transform(_worldInfo.World); }
 	
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -97,8 +100,10 @@ protected:
 	MeshData       _meshData;
 	VertexBuffer   _vertexBuffer[FRAME_BUFFER_COUNT];
 	MaterialBuffer _materialBuffer;
+	ResourceViewHandle _materialView;
 	Texture        _texture;
 	MaterialPtr    _material;
+	VisibilityBox  _localBox;
 	int  _currentFrameIndex = 0;
 	bool _isInitialized = false;
 	
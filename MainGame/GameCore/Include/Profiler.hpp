@@ -0,0 +1,243 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Profiler.hpp
+///             @brief  Hierarchical CPU profiler (scoped markers, per frame statistics, Chrome trace export)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <iosfwd>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+// The markers are compiled in the debug build. Define USE_PROFILER=1 to profile the release build.
+#ifndef USE_PROFILER
+	#ifdef _DEBUG
+		#define USE_PROFILER 1
+	#else
+		#define USE_PROFILER 0
+	#endif
+#endif
+
+#define PROFILER_EVENT_CAPACITY 8192 // events per thread not collected yet by EndFrame
+#define PROFILER_MAX_DEPTH      32   // deeper scopes are not recorded
+#define PROFILER_HISTORY_FRAMES 120  // frames of the statistics and the trace
+
+#if USE_PROFILER
+	#define PROFILE_CONCAT_INNER(a, b) a##b
+	#define PROFILE_CONCAT(a, b)       PROFILE_CONCAT_INNER(a, b)
+	/* name : string literal (the marker is identified by the pointer) */
+	#define PROFILE_SCOPE(name)        ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(name)
+	#define PROFILE_FUNCTION()         PROFILE_SCOPE(__FUNCTION__) // MSVC : Class::Function
+	#define PROFILE_THREAD(name)       Profiler::Instance().SetThreadName(name)
+	#define PROFILE_END_FRAME()        Profiler::Instance().EndFrame()
+#else
+	#define PROFILE_SCOPE(name)        ((void)0)
+	#define PROFILE_FUNCTION()         ((void)0)
+	#define PROFILE_THREAD(name)       ((void)0)
+	#define PROFILE_END_FRAME()        ((void)0)
+#endif
+
+/****************************************************************************
+*				  			ProfileEvent
+*************************************************************************//**
+*  @struct    ProfileEvent
+*  @brief     One finished scope
+*****************************************************************************/
+struct ProfileEvent
+{
+	const char*   Name     = nullptr;
+	std::uint64_t PathID   = 0; // thread and marker names from the root scope of the thread
+	std::uint64_t ParentID = 0; // 0 : root scope
+	std::int64_t  Begin    = 0; // [ns] since the profiler was created
+	std::int64_t  End      = 0;
+	std::uint32_t Thread   = 0;
+	std::uint32_t Depth    = 0;
+};
+
+/****************************************************************************
+*				  			ProfileStatistics
+*************************************************************************//**
+*  @struct    ProfileStatistics
+*  @brief     Time of a scope (a marker under a call path) per frame.
+*             Min / Average / Max are taken over the history frames in which the scope ran.
+*****************************************************************************/
+struct ProfileStatistics
+{
+	std::string   Name;
+	std::string   ThreadName;
+	std::uint32_t Thread       = 0;
+	std::uint32_t Depth        = 0;
+	std::uint64_t PathID       = 0;
+	std::uint64_t ParentID     = 0;
+	double        LastMs       = 0.0; // last frame
+	double        MinMs        = 0.0;
+	double        AverageMs    = 0.0;
+	double        MaxMs        = 0.0;
+	double        AverageCalls = 0.0;
+	std::uint32_t FrameCount   = 0;   // history frames in which the scope ran
+};
+
+struct ProfileFrameStatistics
+{
+	double        LastMs            = 0.0;
+	double        MinMs             = 0.0;
+	double        AverageMs         = 0.0;
+	double        MaxMs             = 0.0;
+	std::uint32_t FrameCount        = 0; // frames in the history
+	std::uint64_t TotalFrameCount   = 0;
+	std::uint64_t DroppedEventCount = 0; // the buffer of the thread was full
+};
+
+/****************************************************************************
+*				  			Profiler
+*************************************************************************//**
+*  @class     Profiler
+*  @brief     Each thread writes its finished scopes into its own ring buffer without locking.
+*             EndFrame (once per frame, one thread) collects the buffers, adds the scope times into
+*             the tree of call paths and keeps the last PROFILER_HISTORY_FRAMES frames for the
+*             statistics and the Chrome trace (chrome://tracing, ui.perfetto.dev).
+*             It depends only on the standard library, so the headless tools can use it.
+*****************************************************************************/
+class Profiler
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* name of the calling thread in the statistics and the trace */
+	void SetThreadName(const std::string& name);
+	/* close the frame: collect the events and update the statistics */
+	void EndFrame();
+	/* clear the statistics and the trace */
+	void Reset();
+
+	/* statistics in depth first order of the call paths (per thread) */
+	std::vector<ProfileStatistics> GetStatistics() const;
+	ProfileFrameStatistics         GetFrameStatistics() const;
+	/* statistics as an indented text table */
+	std::string GetReport() const;
+
+	/* trace event format (JSON) of the history frames and the events not collected yet */
+	void WriteChromeTrace (std::ostream& stream);
+	bool ExportChromeTrace(const std::wstring& filePath);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	void SetEnabled(bool isEnabled) { _isEnabled.store(isEnabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return _isEnabled.load(std::memory_order_relaxed); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	static Profiler& Instance()
+	{
+		static Profiler profiler;
+		return profiler;
+	}
+	Profiler(const Profiler&)            = delete;
+	Profiler& operator=(const Profiler&) = delete;
+	Profiler(Profiler&&)                 = delete;
+	Profiler& operator=(Profiler&&)      = delete;
+private:
+	friend class ProfileScope;
+	/* written by the owner thread, read by EndFrame (single producer, single consumer) */
+	struct ThreadBuffer
+	{
+		std::unique_ptr<ProfileEvent[]> Events;
+		std::atomic<std::uint64_t>      WriteCount = 0;
+		std::atomic<std::uint64_t>      ReadCount  = 0;
+		std::atomic<std::uint64_t>      DropCount  = 0;
+		std::atomic<bool>               IsReleased = false;     // the thread has exited
+		std::uint64_t                   PathStack[PROFILER_MAX_DEPTH] = {}; // owner thread only
+		std::uint32_t                   Depth      = 0;
+		std::uint32_t                   Index      = 0;
+		std::string                     Name;                   // _mutex
+		bool                            IsFree     = false;     // _mutex : drained after the release
+	};
+	struct FrameSample
+	{
+		std::int64_t  Time  = 0; // [ns]
+		std::uint32_t Calls = 0;
+	};
+	struct Node
+	{
+		const char*              Name     = nullptr;
+		std::uint64_t            PathID   = 0;
+		std::uint64_t            ParentID = 0;
+		std::uint32_t            Thread   = 0;
+		std::uint32_t            Depth    = 0;
+		std::vector<FrameSample> History;  // [frame % PROFILER_HISTORY_FRAMES]
+		FrameSample              Current;  // frame not closed yet
+	};
+	struct FrameRecord
+	{
+		std::int64_t              Begin  = 0;
+		std::int64_t              End    = 0;
+		std::uint32_t             Thread = 0;
+		std::vector<ProfileEvent> Events;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	Profiler();
+	~Profiler() = default;
+	ThreadBuffer* GetThreadBuffer();
+	ThreadBuffer* AcquireThreadBuffer();
+	/* nullptr : the scope is not recorded */
+	ThreadBuffer* BeginScope(const char* name, std::int64_t& begin);
+	void          EndScope  (ThreadBuffer* buffer, const char* name, std::int64_t begin);
+	/* move the events of the thread buffers into the current frame (_mutex) */
+	void          CollectEvents();
+	void          AddEvent(const ProfileEvent& event);
+	std::int64_t  Now() const;
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::atomic<bool>  _isEnabled = true;
+	std::int64_t       _epoch     = 0; // steady clock [ns]
+	mutable std::mutex _mutex;
+
+	std::vector<std::unique_ptr<ThreadBuffer>> _threadBuffers;
+
+	std::vector<Node>                                _nodes;       // in the order of the first event
+	std::unordered_map<std::uint64_t, std::uint32_t> _nodeIndices; // path id -> _nodes
+	std::vector<FrameRecord>                         _frames;      // [frame % PROFILER_HISTORY_FRAMES]
+	FrameRecord                                      _currentFrame;
+	std::uint64_t                                    _frameCount = 0;
+};
+
+/****************************************************************************
+*				  			ProfileScope
+*************************************************************************//**
+*  @class     ProfileScope
+*  @brief     Record the time from the construction to the destruction (use PROFILE_SCOPE)
+*****************************************************************************/
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name) : _name(name) { _buffer = Profiler::Instance().BeginScope(name, _begin); }
+	~ProfileScope() { if (_buffer != nullptr) { Profiler::Instance().EndScope(_buffer, _name, _begin); } }
+	ProfileScope(const ProfileScope&)            = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+private:
+	Profiler::ThreadBuffer* _buffer = nullptr;
+	const char*             _name   = nullptr;
+	std::int64_t            _begin  = 0;
+};
+#endif
@@ -14,41 +14,12 @@
 #include "GameMath/Include/GMMatrix.hpp"
 #include "GameCore/Include/Core/GameActor.hpp"
 #include "DirectX12/Include/Core/DirectX12Shader.hpp"
-#include <array>
+#include "GameCore/Include/Rendering/CascadeShadowMapMatrix.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
-enum class ShadowViewType
-{
-	Near,
-	Medium,
-	Far,
-	CountOfShadowViewType
-};
-
-class Camera;
-//////////////////////////////////////////////////////////////////////////////////
-//								Camera 
-//////////////////////////////////////////////////////////////////////////////////
-/****************************************************************************
-*				  			CascadeShadowMapMatrix
-*************************************************************************//**
-*  @struct    CascadeShadowMapMatrix
-*  @brief     CascadeShadowMapMatrix
-*****************************************************************************/
-struct CascadeShadowMapMatrix
-{
-public:
-	void CalculateLightViewProjectionCropMatrix(const Camera& camera, const gm::Vector3& lightDirection, const gm::Vector4& plane = gm::Vector4(0,1,0,0));
-	const gm::Matrix4& GetLightViewProjectionCropMatrix(int shadowMapID) 
-	{ 
-		return _lightViewMatrix[shadowMapID]; 
-	}
-private:
-	std::array<gm::Matrix4, (int)ShadowViewType::CountOfShadowViewType> _lightViewMatrix;
-};
-
 namespace shadow
 {
 	struct ShadowCameraInfo
@@ -65,12 +36,12 @@ namespace shadow
 /****************************************************************************
 *				  			CascadeShadowMapMatrix
 *************************************************************************//**
-*  @struct    CascadeShadowMapMatrix
-*  @brief     CascadeShadowMapMatrix
+*  @class     CascadeShadowMap
+*  @brief     Cascade shadow map of one directional light.
+*             Only the casters which touch the crop box of the cascade are drawn to it.
 *****************************************************************************/
 class CascadeShadowMap
 {
-	using CameraPtr              = std::unique_ptr<Camera>;
 	using ColorBuffers           = std::vector<ColorBuffer>;
 	using PipelineStateComPtrs   = std::vector<PipelineStateComPtr>;
 	using SimpleGraphicPipelines = std::vector<SimpleGraphicPipeline>;
@@ -82,12 +53,15 @@ public:
 	*****************************************************************************/
 	bool Initialize();
 	void AddActor(GameActor* nearActor, GameActor* mediumActor, GameActor* farActor); // near, medium, far
-	bool Execute(const gm::Vector3& lightDirection);
+	/* camera : the scene camera. culling : used to cull the casters of all cascades at once (on its worker threads) */
+	bool Execute(const gm::Float3& lightDirection, const Camera& camera, VisibilityCulling& culling);
 	void Finalize();
 
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	CascadeShadowMapMatrix& GetCascadeMatrix() { return _cascadeShadowMapMatrix; }
+	int GetDrawCount(int shadowType) const { return static_cast<int>(_visibleCasters[shadowType].size()); } // casters drawn in the last Execute
 
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -102,13 +76,13 @@ protected:
 	bool PrepareResources();
 	bool PrepareRootSignature();
 	bool PreparePipelineState();
-	bool PrepareCamera();
 	bool PrepareConstantBuffer();
 
-	bool UpdateLightCamera(const gm::Vector3& lightDirection);
+	bool UpdateLightCamera(const gm::Float3& lightDirection, const Camera& camera);
+	void CullShadowCasters(VisibilityCulling& culling);
 
-	bool DrawPMXActor(int shadowType, int modelIndex);
-	bool DrawPrimitiveActor(int shadowType, int modelIndex);
+	bool DrawPMXActor(GameActor* gameActor);
+	bool DrawPrimitiveActor(GameActor* gameActor);
 	/****************************************************************************
 	**                Private Member Variables
 	*****************************************************************************/
@@ -117,10 +91,21 @@ protected:
 	RootSignatureComPtr     _rootSignature = nullptr;
 	PipelineStateComPtrs    _pipelines;
 	SimpleGraphicPipelines  _shader;
-	GameActors              _actors[(int)ShadowViewType::CountOfShadowViewType];
-	CameraPtr _lightCamera = nullptr;
 	ShadowBuffer            _shadowBuffers[(int)ShadowViewType::CountOfShadowViewType];
 	bool _isInitialized = false;
 
+	/*-------------------------------------------------------------------
+	-           Shadow casters
+	---------------------------------------------------------------------*/
+	struct ShadowCaster
+	{
+		GameActor* Actor       = nullptr;
+		UINT32     CascadeMask = 0; // bit : ShadowViewType
+	};
+	std::vector<ShadowCaster> _casters;
+	GameActors                _visibleCasters[(int)ShadowViewType::CountOfShadowViewType];
+	VisibilityBoundsArray     _casterBounds;
+	std::vector<INT32>        _casterBoundIndices; // [caster] -> bound index (-1 : no bounds, always drawn)
+
 };
 #endif
\ No newline at end of file
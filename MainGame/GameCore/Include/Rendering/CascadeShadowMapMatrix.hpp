@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CascadeShadowMapMatrix.hpp
+///             @brief  Split, fitting and texel snap of the cascade shadow map crop boxes
+///                     (no GPU resource, so it is built apart from CascadeShadowMap)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef CASCADE_SHADOW_MAP_MATRIX_HPP
+#define CASCADE_SHADOW_MAP_MATRIX_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMMatrix.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
+#include <array>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+enum class ShadowViewType
+{
+	Near,
+	Medium,
+	Far,
+	CountOfShadowViewType
+};
+
+class Camera;
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			CascadeShadowMapMatrix
+*************************************************************************//**
+*  @struct    CascadeShadowMapMatrix
+*  @brief     Light view projection crop matrix of each cascade.
+*             The view is split by the practical split scheme (blend of the logarithmic and the linear split),
+*             and each cascade is fitted to the bounding sphere of its frustum slice.
+*             The crop box is snapped to the shadow map texels, so the shadow does not shimmer while the camera moves.
+*             The crop box is open toward the light, so that the casters in front of it can be kept.
+*****************************************************************************/
+struct CascadeShadowMapMatrix
+{
+public:
+	static constexpr int CASCADE_COUNT = (int)ShadowViewType::CountOfShadowViewType;
+
+	/* resolution : shadow map size of each cascade */
+	void CalculateLightViewProjectionCropMatrix(const Camera& camera, const gm::Float3& lightDirection, const int resolution[CASCADE_COUNT]);
+	/* pull the near plane of the cascade toward the light to the given light view z (the x, y range is not changed) */
+	void ExtendNearPlane(int shadowMapID, float lightViewZ);
+
+	const gm::Matrix4& GetLightViewProjectionCropMatrix(int shadowMapID) 
+	{ 
+		return _lightViewMatrix[shadowMapID]; 
+	}
+	/* world space planes of the crop box (the near plane always passes) */
+	const FrustumPlanes& GetCasterPlanes(int shadowMapID) const { return _casterPlanes[shadowMapID]; }
+	const gm::Float3&    GetLightForward()                const { return _lightForward; }
+	float GetSplitDistance(int shadowMapID) const { return _splitDistances[shadowMapID]; } // view depth of the far side of the cascade
+
+	/* 0 : linear split, 1 : logarithmic split */
+	void SetSplitLambda   (float lambda)   { _splitLambda    = lambda; }
+	/* 0 : camera far z */
+	void SetShadowDistance(float distance) { _shadowDistance = distance; }
+private:
+	void UpdateCropMatrix(int shadowMapID);
+
+	struct CropBox
+	{
+		gm::Float3 Min = gm::Float3(0.0f, 0.0f, 0.0f);
+		gm::Float3 Max = gm::Float3(0.0f, 0.0f, 0.0f);
+	};
+	std::array<gm::Matrix4, CASCADE_COUNT> _lightViewMatrix;
+	std::array<FrustumPlanes, CASCADE_COUNT> _casterPlanes;
+	std::array<CropBox, CASCADE_COUNT> _cropBoxes;      // light view space
+	std::array<float, CASCADE_COUNT>   _splitDistances = {};
+	gm::Float3 _lightRight   = gm::Float3(1.0f, 0.0f, 0.0f);
+	gm::Float3 _lightUp      = gm::Float3(0.0f, 1.0f, 0.0f);
+	gm::Float3 _lightForward = gm::Float3(0.0f, 0.0f, 1.0f);
+	float _splitLambda    = 0.5f;
+	float _shadowDistance = 0.0f;
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   ClusteredLighting.hpp
+///             @brief  CPU clustered light binning (froxel grid, SIMD, worker threads)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef CLUSTERED_LIGHTING_HPP
+#define CLUSTERED_LIGHTING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/LightType.hpp"
+#include <vector>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+// default froxel grid (screen tiles x screen tiles x exponential depth slices)
+#define CLUSTER_COUNT_X 16
+#define CLUSTER_COUNT_Y 9
+#define CLUSTER_COUNT_Z 24
+
+class JobSystem;
+
+/****************************************************************************
+*				  			ClusterConstants
+*************************************************************************//**
+*  @struct    ClusterConstants
+*  @brief     Grid parameters for the shaders (same layout as Shader/Lighting/ShaderClusteredLighting.hlsli).
+*             slice = floor(log(viewZ) * SliceScale + SliceBias)
+*****************************************************************************/
+struct ClusterConstants
+{
+	std::uint32_t CountX          = 0;
+	std::uint32_t CountY          = 0;
+	std::uint32_t CountZ          = 0;
+	std::uint32_t PointLightCount = 0;
+	std::uint32_t SpotLightCount  = 0;
+	float         NearZ           = 0.0f;
+	float         SliceScale      = 0.0f;
+	float         SliceBias       = 0.0f;
+};
+
+/****************************************************************************
+*				  			ClusterLightRange
+*************************************************************************//**
+*  @struct    ClusterLightRange
+*  @brief     Lights of a cluster in the light index list:
+*             [Offset, Offset + PointCount) are point light indices, and the next SpotCount are spot light indices.
+*****************************************************************************/
+struct ClusterLightRange
+{
+	std::uint32_t Offset     = 0;
+	std::uint32_t PointCount = 0;
+	std::uint32_t SpotCount  = 0;
+	std::uint32_t Padding    = 0;
+};
+
+/****************************************************************************
+*				  			ClusterView
+*************************************************************************//**
+*  @struct    ClusterView
+*  @brief     Camera of the froxel grid (left handed view space, perspective projection)
+*****************************************************************************/
+struct ClusterView
+{
+	gm::Float4x4 ViewMatrix;          // world to view (p' = p * ViewMatrix)
+	float        NearZ       = 1.0f;
+	float        FarZ        = 1000.0f;
+	float        TanHalfFovX = 1.0f;
+	float        TanHalfFovY = 1.0f;
+};
+
+/****************************************************************************
+*				  			ClusteredLighting
+*************************************************************************//**
+*  @class     ClusteredLighting
+*  @brief     Bin the point and spot lights into the clusters (froxels) of the camera, and output a compact
+*             light index list with a range per cluster. There is no limit of the light count.
+*             The lights are transformed into the view space and binned into the depth slices first,
+*             and then each slice tests its lights against its clusters (simd, one slice per job).
+*             Point light : sphere vs cluster box. Spot light : cone vs cluster sphere, and cone bounding sphere vs cluster box.
+*             The slices are run as the jobs of the shared JobSystem (the same workers as VisibilityCulling).
+*             BuildReference outputs the same lists with scalar code on the calling thread (headless validation).
+*****************************************************************************/
+class ClusteredLighting
+{
+public:
+	static constexpr size_t PARALLEL_MIN_COUNT = 256; // fewer lights are binned on the calling thread
+	struct Statistics
+	{
+		std::uint64_t PointLightCount      = 0;
+		std::uint64_t SpotLightCount       = 0;
+		std::uint64_t VisibleLightCount    = 0; // lights in one cluster at least
+		std::uint64_t IndexCount           = 0;
+		std::uint64_t NonEmptyClusterCount = 0;
+		std::uint64_t MaxClusterLightCount = 0;
+	};
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* jobSystem : shared worker threads (nullptr : calling thread only). It must outlive Finalize. */
+	bool Initialize(JobSystem* jobSystem = nullptr, std::uint32_t countX = CLUSTER_COUNT_X, std::uint32_t countY = CLUSTER_COUNT_Y, std::uint32_t countZ = CLUSTER_COUNT_Z);
+	void Finalize();
+
+	/* lights are in the world space */
+	void Build         (const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount);
+	void BuildReference(const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount);
+
+	/* cluster of a view space position (UINT32_MAX : outside of the grid) */
+	std::uint32_t GetClusterIndex(float viewX, float viewY, float viewZ) const;
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const std::vector<ClusterLightRange>& GetLightRanges () const { return _lightRanges; } // [cluster]
+	const std::vector<std::uint32_t>&     GetLightIndices() const { return _lightIndices; }
+	const ClusterConstants& GetConstants  () const { return _constants; }
+	std::uint32_t           GetClusterCount() const { return _countX * _countY * _countZ; }
+	Statistics              GetStatistics () const;
+	int GetWorkerCount() const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	ClusteredLighting() = default;
+	~ClusteredLighting();
+	ClusteredLighting(const ClusteredLighting&)            = delete;
+	ClusteredLighting& operator=(const ClusteredLighting&) = delete;
+	ClusteredLighting(ClusteredLighting&&)                 = delete;
+	ClusteredLighting& operator=(ClusteredLighting&&)      = delete;
+private:
+	/* view space lights (structure of arrays) */
+	struct PointLightArray
+	{
+		std::vector<float> X, Y, Z, Radius; // radius <= 0 : the light is skipped
+		void Resize(size_t count);
+		/* this[i] = source[indices[i]] (padded to the lane count) */
+		void Gather(const PointLightArray& source, const std::vector<std::uint32_t>& indices);
+	};
+	struct SpotLightArray
+	{
+		std::vector<float> X, Y, Z, DirectionX, DirectionY, DirectionZ, Range, Cos, Sin;
+		std::vector<float> SphereX, SphereY, SphereZ, SphereRadius; // bounding sphere of the cone (radius <= 0 : skipped)
+		void Resize(size_t count);
+		void Gather(const SpotLightArray& source, const std::vector<std::uint32_t>& indices);
+	};
+	struct ClusterBox
+	{
+		float MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+		float CenterX, CenterY, CenterZ, Radius;
+	};
+	/* lights and output of a depth slice (one job). The lights of the slice are narrowed down per tile row. */
+	struct Slice
+	{
+		std::vector<std::uint32_t>     PointLights;    // index of the input array (ascending)
+		std::vector<std::uint32_t>     SpotLights;
+		PointLightArray                Points;         // gathered for the simd tests
+		SpotLightArray                 Spots;
+		std::vector<std::uint32_t>     RowPointLights; // index of Points, then of the input array
+		std::vector<std::uint32_t>     RowSpotLights;
+		PointLightArray                RowPoints;
+		SpotLightArray                 RowSpots;
+		std::vector<ClusterLightRange> Ranges;         // offset in Indices
+		std::vector<std::uint32_t>     Indices;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void SetView(const ClusterView& view);
+	void PrepareLights(const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount);
+	void BinLights();
+	void ConcatenateSlices();
+	void BuildSlice(std::uint32_t z);
+	void CullRow(Slice& slice, std::uint32_t y, std::uint32_t z);
+	/* box of the tiles [beginX, endX) x [beginY, endY) in the slice z */
+	ClusterBox GetClusterBox(std::uint32_t beginX, std::uint32_t endX, std::uint32_t beginY, std::uint32_t endY, std::uint32_t z) const;
+	/* -1 : nearer than the grid, _countZ : farther */
+	int  GetSlice(float viewZ) const;
+	/* false : the sphere is out of the depth range of the grid */
+	bool IsInDepthRange(float viewZ, float radius) const { return radius > 0.0f && viewZ + radius >= _view.NearZ && viewZ - radius <= _view.FarZ; }
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::uint32_t _countX = 0;
+	std::uint32_t _countY = 0;
+	std::uint32_t _countZ = 0;
+	ClusterView             _view;
+	ClusterConstants        _constants;
+	std::vector<float>      _sliceDepths; // [z] near depth of the slice, [_countZ] far
+	std::vector<ClusterBox> _sliceBoxes;  // [z] box of the whole slice
+
+	PointLightArray    _pointLights; // view space, same index as the input array
+	SpotLightArray     _spotLights;
+	std::vector<Slice> _slices;      // [z]
+
+	std::vector<ClusterLightRange> _lightRanges;
+	std::vector<std::uint32_t>     _lightIndices;
+	std::uint64_t                  _binnedLightCount = 0; // lights added to one slice at least
+	JobSystem*                     _jobSystem        = nullptr;
+};
+#endif
@@ -0,0 +1,146 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VisibilityCulling.hpp
+///             @brief  CPU frustum culling (SoA bounds, SIMD, worker threads)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef VISIBILITY_CULLING_HPP
+#define VISIBILITY_CULLING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Camera.hpp"
+#include <vector>
+#include <cstdint>
+#include <cfloat>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+// every SoA array is padded to this lane count so that the SIMD kernels never read out of the arrays.
+#define VISIBILITY_LANE_COUNT 8
+
+class JobSystem;
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			VisibilityBox
+*************************************************************************//**
+*  @struct    VisibilityBox
+*  @brief     Min max box to build the bounds (empty while Min > Max)
+*****************************************************************************/
+struct VisibilityBox
+{
+	gm::Float3 Min = gm::Float3( FLT_MAX,  FLT_MAX,  FLT_MAX);
+	gm::Float3 Max = gm::Float3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	bool IsEmpty() const { return Min.x > Max.x; }
+	void Merge (const gm::Float3& position);
+	void Merge (const VisibilityBox& box);
+	void Expand(float margin);
+	/* bounding box of the transformed box (affine matrix for the row vector) */
+	VisibilityBox Transform(const gm::Float4x4& matrix) const;
+};
+
+/****************************************************************************
+*				  			VisibilityBoundsArray
+*************************************************************************//**
+*  @class     VisibilityBoundsArray
+*  @brief     World space bounds stored as structure of arrays.
+*             Each bound has both a sphere (Center, Radius) and a box (Center, Extent),
+*             and it is visible only when both of them touch the frustum.
+*****************************************************************************/
+struct VisibilityBoundsArray
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* box (the sphere is the bounding sphere of the box) */
+	void Add(const gm::Float3& center, const gm::Float3& extent);
+	void Add(const gm::Float3& center, const gm::Float3& extent, float radius);
+	void AddMinMax(const gm::Float3& minPosition, const gm::Float3& maxPosition);
+	void Add(const VisibilityBox& box) { AddMinMax(box.Min, box.Max); }
+	/* sphere (the box is the bounding box of the sphere) */
+	void AddSphere(const gm::Float3& center, float radius);
+	void Clear();
+	void Reserve(size_t count);
+	size_t Size() const { return _count; }
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> CenterZ;
+	std::vector<float> Radius;
+	std::vector<float> ExtentX;
+	std::vector<float> ExtentY;
+	std::vector<float> ExtentZ;
+
+private:
+	size_t _count = 0;
+};
+
+/****************************************************************************
+*				  			VisibilityCulling
+*************************************************************************//**
+*  @class     VisibilityCulling
+*  @brief     Test all bounds against all registered views and output the visible bound indices of each view
+*             (ascending order). The bounds are split into chunks, which are run as the jobs of the shared JobSystem.
+*             Small arrays (or no job system) are culled on the calling thread.
+*****************************************************************************/
+class VisibilityCulling
+{
+public:
+	static constexpr size_t CHUNK_SIZE         = 4096; // bounds per job
+	static constexpr size_t PARALLEL_MIN_COUNT = 8192; // fewer bounds are culled on the calling thread
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* jobSystem : shared worker threads (nullptr : calling thread only). It must outlive Finalize. */
+	bool Initialize(JobSystem* jobSystem = nullptr);
+	void Finalize();
+
+	/* return the view index */
+	int  AddView(const FrustumPlanes& frustum);
+	void ClearViews();
+	void Execute(const VisibilityBoundsArray& bounds);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const std::vector<std::uint32_t>& GetVisibleList(int viewIndex) const { return _visibleLists[viewIndex]; }
+	int GetViewCount  () const { return static_cast<int>(_views.size()); }
+	int GetWorkerCount() const;
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	VisibilityCulling() = default;
+	~VisibilityCulling();
+	VisibilityCulling(const VisibilityCulling&)            = delete;
+	VisibilityCulling& operator=(const VisibilityCulling&) = delete;
+	VisibilityCulling(VisibilityCulling&&)                 = delete;
+	VisibilityCulling& operator=(VisibilityCulling&&)      = delete;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void CullChunk(size_t chunk);
+	void CullRange(size_t begin, size_t end, std::vector<std::uint32_t>* outLists) const;
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<FrustumPlanes>              _views;
+	std::vector<std::vector<std::uint32_t>> _visibleLists; // [view]
+	std::vector<std::vector<std::uint32_t>> _chunkLists;   // [chunk * viewCount + view]
+	const VisibilityBoundsArray*            _bounds    = nullptr;
+	JobSystem*                              _jobSystem = nullptr;
+};
+#endif
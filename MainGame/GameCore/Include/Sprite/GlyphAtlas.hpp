@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GlyphAtlas.hpp
+///             @brief  Dynamic glyph atlas (shelf packing, GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GLYPH_ATLAS_HPP
+#define GLYPH_ATLAS_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMFlatHashMap.hpp"
+#include <vector>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			GlyphRect
+*************************************************************************//**
+*  @struct    GlyphRect
+*  @brief     Glyph cell in the atlas (pixel). The cell is advance x line height,
+*             so every glyph of a font is drawn as the same height quad.
+*****************************************************************************/
+struct GlyphRect
+{
+	std::uint16_t X      = 0;
+	std::uint16_t Y      = 0;
+	std::uint16_t Width  = 0;
+	std::uint16_t Height = 0;
+};
+
+/****************************************************************************
+*				  			GlyphCoverage
+*************************************************************************//**
+*  @struct    GlyphCoverage
+*  @brief     Rasterized glyph (8 bit coverage, 0 - MaxValue) placed in the cell at (OffsetX, OffsetY)
+*****************************************************************************/
+struct GlyphCoverage
+{
+	const std::uint8_t* Pixels = nullptr; // nullptr : blank glyph (e.g. space)
+	int Pitch    = 0; // byte size of one row
+	int Width    = 0;
+	int Height   = 0;
+	int OffsetX  = 0;
+	int OffsetY  = 0;
+	int MaxValue = 255;
+};
+
+/****************************************************************************
+*				  			GlyphAtlas
+*************************************************************************//**
+*  @class     GlyphAtlas
+*  @brief     Packs the glyph cells into shelves (rows of the same height) of an RGBA8 image
+*             (white, coverage in alpha). The modified rows are recorded for the texture upload.
+*             When the atlas is full, its height is doubled up to maxHeight and then it is cleared.
+*             Both change the uv of the glyphs, so GetGeneration() is incremented.
+*****************************************************************************/
+class GlyphAtlas
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool Initialize(int width, int height, int maxHeight);
+	void Finalize();
+	/* remove all glyphs */
+	void Reset();
+
+	const GlyphRect* Find(std::uint32_t fontID, std::uint32_t codePoint) const;
+	/* pack a cellWidth x cellHeight cell and draw the coverage into it. nullptr : larger than the atlas */
+	const GlyphRect* Insert(std::uint32_t fontID, std::uint32_t codePoint, int cellWidth, int cellHeight, const GlyphCoverage& coverage);
+
+	/* rows modified since the last ClearDirtyRows [begin, end) */
+	bool HasDirtyRows   () const { return _dirtyRowBegin < _dirtyRowEnd; }
+	int  GetDirtyRowBegin() const { return _dirtyRowBegin; }
+	int  GetDirtyRowEnd  () const { return _dirtyRowEnd; }
+	void ClearDirtyRows ();
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	const std::uint32_t* GetPixels() const { return _pixels.data(); }
+	int           GetWidth     () const { return _width; }
+	int           GetHeight    () const { return _height; }
+	std::uint32_t GetGeneration() const { return _generation; }
+	std::size_t   GetGlyphCount() const { return _glyphs.Size(); }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	GlyphAtlas() = default;
+	~GlyphAtlas() = default;
+	GlyphAtlas(const GlyphAtlas&)            = delete;
+	GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+	GlyphAtlas(GlyphAtlas&&)                 = default;
+	GlyphAtlas& operator=(GlyphAtlas&&)      = default;
+private:
+	struct Shelf
+	{
+		int Y;
+		int Height;
+		int UsedWidth;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	bool Allocate(int width, int height, int& outX, int& outY);
+	void DrawCoverage(int x, int y, int cellWidth, int cellHeight, const GlyphCoverage& coverage);
+	void MarkDirty(int rowBegin, int rowEnd);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	gm::FlatHashMap<std::uint64_t, GlyphRect> _glyphs; // (fontID << 32 | codePoint)
+	std::vector<Shelf>         _shelves;
+	std::vector<std::uint32_t> _pixels; // RGBA8
+	int _width         = 0;
+	int _height        = 0;
+	int _maxHeight     = 0;
+	int _shelfBottom   = 0; // top of the free area
+	int _dirtyRowBegin = 0;
+	int _dirtyRowEnd   = 0;
+	std::uint32_t _generation = 0;
+};
+#endif
@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SpriteBatcher.hpp
+///             @brief  Sprite draw command sort / merge and vertex staging (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef SPRITE_BATCHER_HPP
+#define SPRITE_BATCHER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12VertexTypes.hpp"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define SPRITE_VERTEX_COUNT (4)
+
+/****************************************************************************
+*				  			SpriteSortMode
+*************************************************************************//**
+*  @enum      SpriteSortMode
+*  @brief     Deferred : submission order is kept (only adjacent draws with the same state are merged)
+*             Texture  : stable sort by blend state and texture, then merge.
+*                        Overlapping sprites of different textures may change the drawing order.
+*****************************************************************************/
+enum class SpriteSortMode : std::uint8_t
+{
+	Deferred,
+	Texture
+};
+
+/****************************************************************************
+*				  			SpriteDrawBatch
+*************************************************************************//**
+*  @struct    SpriteDrawBatch
+*  @brief     One draw call after sort / merge (sprites are contiguous in the output vertices)
+*****************************************************************************/
+struct SpriteDrawBatch
+{
+	std::uint64_t TextureKey  = 0;
+	std::uint32_t TextureSlot = 0; // caller defined (e.g. index of the texture list)
+	std::uint32_t BlendType   = 0;
+	std::uint32_t FirstSprite = 0;
+	std::uint32_t SpriteCount = 0;
+};
+
+/****************************************************************************
+*				  			SpriteBatcher
+*************************************************************************//**
+*  @class     SpriteBatcher
+*  @brief     Collects sprite vertices and draw states, and merges the draws with the same state.
+*             - Deferred with a direct destination : vertices are streamed straight into the destination
+*               (the mapped GPU buffer) in Add, and End only returns the batches.
+*             - Otherwise : vertices are staged in CPU memory and End writes them in the batch order.
+*             The staging buffer grows automatically and is reused (no allocation in the steady state).
+*****************************************************************************/
+class SpriteBatcher
+{
+public:
+	using Vertex = VertexPositionNormalColorTexture;
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* directDestination : used only by Deferred. The caller guarantees the capacity for every Reserve / Add. */
+	void Begin(SpriteSortMode sortMode = SpriteSortMode::Deferred, Vertex* directDestination = nullptr);
+	/* return the area of spriteCount sprites (SPRITE_VERTEX_COUNT vertices each). Valid until the next Reserve / Allocate / Add. */
+	Vertex* Reserve(size_t spriteCount);
+	/* add the draw command of the first spriteCount sprites written into the last Reserve */
+	void    Commit(size_t spriteCount, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType);
+	Vertex* Allocate(size_t spriteCount, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType); // Reserve + Commit
+	/* copy sprites. spriteByteStride : byte distance between the first vertices of two sprites (e.g. sizeof(Sprite)) */
+	void    Add(const Vertex* firstVertex, size_t spriteCount, size_t spriteByteStride, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType);
+	/* sort / merge and write GetSpriteCount() * SPRITE_VERTEX_COUNT vertices to destination (ignored in the direct mode) */
+	const std::vector<SpriteDrawBatch>& End(Vertex* destination = nullptr);
+
+	/* non temporal copies for the write combined memory */
+	static void CopyVertices(void* destination, const void* source, size_t byteSize);
+	static void CopySprites (void* destination, const void* source, size_t spriteCount, size_t spriteByteStride);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool   IsDirect       () const { return _direct != nullptr; }
+	size_t GetSpriteCount () const { return _spriteCount; }
+	size_t GetCommandCount() const { return _commands.size(); }
+	SpriteSortMode GetSortMode() const { return _sortMode; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	SpriteBatcher()  = default;
+	~SpriteBatcher() = default;
+	SpriteBatcher(const SpriteBatcher&)            = delete;
+	SpriteBatcher& operator=(const SpriteBatcher&) = delete;
+	SpriteBatcher(SpriteBatcher&&)                 = default;
+	SpriteBatcher& operator=(SpriteBatcher&&)      = default;
+private:
+	struct Command
+	{
+		std::uint64_t TextureKey;
+		std::uint32_t TextureSlot;
+		std::uint32_t BlendType;
+		std::uint32_t FirstSprite; // in the staging buffer
+		std::uint32_t SpriteCount;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void ReserveStaging(size_t spriteCount);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	Vertex*                      _direct  = nullptr;
+	std::unique_ptr<Vertex[]>    _staging = nullptr; // not value initialized
+	size_t                       _stagingCapacity = 0; // sprite count
+	size_t                       _spriteCount     = 0;
+	std::vector<Command>         _commands;
+	std::vector<std::uint32_t>   _order;
+	std::vector<SpriteDrawBatch> _batches;
+	SpriteSortMode               _sortMode = SpriteSortMode::Deferred;
+};
+#endif
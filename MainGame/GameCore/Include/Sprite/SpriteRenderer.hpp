@@ -20,6 +20,7 @@
 #include "Sprite.hpp"
 #include "GameMath/Include/GMMatrix.hpp"
 #include "GameCore/Include/Effect/PostEffect.hpp"
+#include "GameCore/Include/Sprite/SpriteBatcher.hpp"
 #include <memory>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +31,10 @@
 *************************************************************************//**
 *  @struct    SpriteRenderer
 *  @brief     SpriteRenderer (screen center is origin point. and x, y, from -1 to 1)
+*             The vertices go to the persistently mapped vertex ring of the current frame (SpriteBatcher).
+*             Deferred : Draw streams the vertices into the ring, and adjacent draws with the same state are merged.
+*             Texture  : Draw stages the vertices, and DrawEnd sorts / merges the draws by blend state and texture.
+*             When the ring is full, the sprites so far are drawn and a larger ring is used.
 *****************************************************************************/
 class SpriteRenderer
 {
@@ -37,9 +42,13 @@ public:
 	/****************************************************************************
 	**                Public Function
 	*****************************************************************************/
-	bool Initialize(FastBlendStateType type = FastBlendStateType::Normal, const std::wstring& addName = L"");
-	bool DrawStart();
+	bool Initialize(FastBlendStateType type = FastBlendStateType::Normal, const std::wstring& addName = L"", int initialSpriteCount = MaxSpriteCount);
+	bool DrawStart(SpriteSortMode sortMode = SpriteSortMode::Deferred);
 	bool Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix);
+	bool Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix, FastBlendStateType blendType);
+	/* write the vertices directly (BeginVertexWrite -> write 4 vertices / sprite -> EndVertexWrite) */
+	VertexPositionNormalColorTexture* BeginVertexWrite(int& outWritableSpriteCount, int requestSpriteCount = 0);
+	bool EndVertexWrite(int writtenSpriteCount, const Texture& texture, const gm::Matrix4& matrix);
 	
 	bool DrawEnd();
 	virtual bool Finalize();
@@ -47,7 +56,10 @@ public:
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
-	
+	int GetMaxSpriteCount() const { return _maxSpriteCount; } // initial capacity of the vertex ring (it grows)
+	static const int MaxSpriteCount;
+	static const int MaxDrawSpriteCount; // sprites per draw call (16 bit index buffer)
+
 	/****************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
@@ -66,24 +78,40 @@ private:
 	bool PrepareVertexBuffer(const std::wstring& name);
 	bool PrepareIndexBuffer(const std::wstring& name);
 	bool PrepareConstantBuffer(const std::wstring& name);
+	bool CreateVertexBuffer(int frameIndex, int spriteCapacity);
+	void UpdateMatrix(const gm::Matrix4& matrix);
+	std::uint32_t RegisterTexture(const Texture& texture);
+	VertexPositionNormalColorTexture* GetRingDestination() const;
+	bool ReserveRing(int spriteCount);
+	bool FlushBatches();
 
 	/****************************************************************************
 	**                Private Member Variables
 	*****************************************************************************/
-	PipelineStateComPtr     _pipelineState = nullptr;
+	using VertexBufferPtr = std::unique_ptr<UploadBuffer<VertexPositionNormalColorTexture>>;
+	PipelineStateComPtr     _pipelineStates[(int)FastBlendStateType::CountOfFastBlendStateType]; // created on first use
 	RootSignatureComPtr     _rootSignature = nullptr;
 	std::vector<MeshBuffer> _meshBuffer;
 	DescriptorHeapComPtr    _textureDescHeap = nullptr;
-	std::vector<Texture>    _textures;
-	std::vector<VertexPositionNormalColorTexture> _vertices;
+	std::vector<Texture>    _textures;          // texture slot of the batches
+	SpriteBatcher           _batcher;
+	SpriteSortMode          _sortMode = SpriteSortMode::Deferred;
 	gm::Matrix4       _projectionViewMatrix;
-	std::unique_ptr<UploadBuffer<VertexPositionNormalColorTexture>> _dynamicVertexBuffer[FRAME_BUFFER_COUNT];
-	std::unique_ptr<UploadBuffer<gm::Matrix4>> _constantBuffer = nullptr;
-	
-	int _spriteStackCount = 0;
-	int _drawCallNum = 0;
-	std::vector<int> _spriteCountList;
-	static const int MaxSpriteCount;
+	std::unique_ptr<UploadBuffer<gm::Matrix4>> _constantBuffer = nullptr; // persistently mapped
+
+	/*-------------------------------------------------------------------
+	-           vertex ring (persistently mapped, one per frame)
+	---------------------------------------------------------------------*/
+	VertexBufferPtr              _dynamicVertexBuffer[FRAME_BUFFER_COUNT];
+	std::vector<VertexBufferPtr> _retiredVertexBuffers[FRAME_BUFFER_COUNT]; // replaced by growth, released next time the frame comes
+	int    _vertexBufferCapacity[FRAME_BUFFER_COUNT] = {}; // sprite count
+	int    _ringOffset     = 0;          // used sprite count of the current frame
+	UINT64 _ringFrameCount = UINT64_MAX;
+
+	std::wstring       _name;
+	FastBlendStateType _blendType = FastBlendStateType::Normal;
+	int  _maxSpriteCount = 0;
+	bool _isWritingVertices = false;
 };
 
 
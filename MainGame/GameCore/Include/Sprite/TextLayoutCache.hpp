@@ -0,0 +1,273 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TextLayoutCache.hpp
+///             @brief  Cache of the text quads (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEXT_LAYOUT_CACHE_HPP
+#define TEXT_LAYOUT_CACHE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12VertexTypes.hpp"
+#include "GameMath/Include/GMFlatHashMap.hpp"
+#include "Text.hpp"
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			TextGlyph
+*************************************************************************//**
+*  @struct    TextGlyph
+*  @brief     uv of one character and its quad width (ratio to SizePerChar.x)
+*****************************************************************************/
+struct TextGlyph
+{
+	gm::Float2 U          = gm::Float2(0.0f, 0.0f);
+	gm::Float2 V          = gm::Float2(0.0f, 1.0f);
+	float      WidthScale = 1.0f;
+};
+
+/****************************************************************************
+*				  			TextLayout
+*************************************************************************//**
+*  @struct    TextLayout
+*  @brief     Ready made quads (4 vertices / character, same order as Sprite).
+*             Vertices     : relative to the start position (white)
+*             DrawVertices : moved to the last start position and colored, which can be copied as it is.
+*****************************************************************************/
+struct TextLayout
+{
+	std::vector<VertexPositionNormalColorTexture> Vertices;
+	std::vector<VertexPositionNormalColorTexture> DrawVertices;
+	std::vector<std::uint8_t> Digits;        // only for the number
+	UINT                      Number = 0;    // only for the number
+	gm::Float3    DrawOffset    = gm::Float3(0.0f, 0.0f, 0.0f);
+	gm::Float4    DrawColor     = gm::Float4(0.0f, 0.0f, 0.0f, 0.0f);
+	std::uint32_t Generation    = 0;
+	std::uint64_t LastUsedFrame = 0;
+	bool          IsBuilt       = false;
+	bool          IsDrawReady   = false;
+
+	int GetCharCount() const { return static_cast<int>(Vertices.size() / 4); }
+};
+
+/****************************************************************************
+*				  			TextLayoutCache
+*************************************************************************//**
+*  @class     TextLayoutCache
+*  @brief     Text quads keyed on (string, font, size, space), so that unchanged text is not rebuilt.
+*             Numbers are keyed on (font, digit, size, space, position), and only the uv of the changed digits is updated.
+*             The draw vertices are rewritten only when the position or the color changed,
+*             so unchanged text costs a lookup and a copy per frame.
+*             generation : version of the glyph uv (e.g. GlyphAtlas::GetGeneration). A layout of another generation is rebuilt.
+*             Layouts not used for CACHE_LIFE_FRAME frames are removed.
+*****************************************************************************/
+class TextLayoutCache
+{
+public:
+	using Vertex = VertexPositionNormalColorTexture;
+	static constexpr std::uint64_t CACHE_LIFE_FRAME = 120;
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* frame : increasing frame number (used for the eviction) */
+	void BeginFrame(std::uint64_t frame);
+	void Clear();
+
+	/* glyphFunction : bool(wchar_t character, TextGlyph& outGlyph). false : the character is skipped */
+	template<class GlyphFunction>
+	const TextLayout& GetString(std::uint32_t fontID, std::uint32_t generation, const TextString& text, const gm::Float4& color, GlyphFunction&& glyphFunction);
+	/* glyphFunction : bool(int digit, TextGlyph& outGlyph) */
+	template<class GlyphFunction>
+	const TextLayout& GetNumber(std::uint32_t fontID, std::uint32_t generation, const TextNumber& number, const gm::Float4& color, GlyphFunction&& glyphFunction);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	std::size_t GetLayoutCount() const { return _layouts.Size(); }
+	std::size_t GetBuildCount () const { return _buildCount; } // layouts built (or digits updated) so far
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	TextLayoutCache()  = default;
+	~TextLayoutCache() = default;
+	TextLayoutCache(const TextLayoutCache&)            = delete;
+	TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+	TextLayoutCache(TextLayoutCache&&)                 = default;
+	TextLayoutCache& operator=(TextLayoutCache&&)      = default;
+private:
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	template<class T>
+	void AppendKey(const T& value) { _key.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+	TextLayout& FindOrAdd();
+	static void PrepareDrawVertices(TextLayout& layout, const gm::Float3& startPosition, const gm::Float4& color);
+	static void SetQuad(Vertex* vertices, float left, float right, float bottom, float top, const TextGlyph& glyph);
+	static void SetQuadUV(Vertex* vertices, const TextGlyph& glyph);
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	gm::FlatHashMap<std::string, TextLayout> _layouts;
+	std::string              _key;         // key bytes of the current lookup (reused)
+	std::vector<std::string> _expiredKeys;
+	std::uint64_t _frame      = 0;
+	std::uint64_t _lastSweep  = 0;
+	std::size_t   _buildCount = 0;
+};
+
+/****************************************************************************
+*                       GetString
+*************************************************************************//**
+*  @fn        const TextLayout& TextLayoutCache::GetString(std::uint32_t fontID, std::uint32_t generation, const TextString& text, const gm::Float4& color, GlyphFunction&& glyphFunction)
+*  @brief     Return the layout of the text (build it only when it is not cached)
+*             The quad of the i-th character has the same position as the former TextRenderer::DrawString.
+*  @param[in] std::uint32_t fontID
+*  @param[in] std::uint32_t generation
+*  @param[in] const TextString& text (StartPosition is not a part of the key)
+*  @param[in] const gm::Float4& color
+*  @param[in] GlyphFunction&& glyphFunction
+*  @return @@const TextLayout& (valid until the next Get)
+*****************************************************************************/
+template<class GlyphFunction>
+const TextLayout& TextLayoutCache::GetString(std::uint32_t fontID, std::uint32_t generation, const TextString& text, const gm::Float4& color, GlyphFunction&& glyphFunction)
+{
+	/*-------------------------------------------------------------------
+	-              Make the key
+	---------------------------------------------------------------------*/
+	_key.clear();
+	_key.push_back('S');
+	AppendKey(fontID);
+	AppendKey(text.SizePerChar);
+	AppendKey(text.Space);
+	_key.append(reinterpret_cast<const char*>(text.String.data()), text.String.size() * sizeof(wchar_t));
+
+	TextLayout& layout = FindOrAdd();
+	if (layout.IsBuilt && layout.Generation == generation)
+	{
+		PrepareDrawVertices(layout, text.StartPosition, color);
+		return layout;
+	}
+
+	/*-------------------------------------------------------------------
+	-              Build the quads
+	---------------------------------------------------------------------*/
+	layout.Vertices.resize(text.String.size() * 4);
+	layout.Generation = generation;
+	layout.IsBuilt    = true;
+	Vertex* vertices  = layout.Vertices.data();
+	float   left      = 0.0f;
+	int     count     = 0;
+	for (size_t i = 0; i < text.String.size(); ++i)
+	{
+		TextGlyph glyph;
+		if (!glyphFunction(text.String[i], glyph)) { continue; }
+
+		const float width = text.SizePerChar.x * glyph.WidthScale;
+		SetQuad(vertices + count * 4, left, left + width, -1.5f * text.SizePerChar.y, -0.5f * text.SizePerChar.y, glyph);
+		left += width + text.Space;
+		++count;
+	}
+	layout.Vertices.resize(static_cast<size_t>(count) * 4);
+	layout.IsDrawReady = false;
+	PrepareDrawVertices(layout, text.StartPosition, color);
+	++_buildCount;
+	return layout;
+}
+
+/****************************************************************************
+*                       GetNumber
+*************************************************************************//**
+*  @fn        const TextLayout& TextLayoutCache::GetNumber(std::uint32_t fontID, std::uint32_t generation, const TextNumber& number, const gm::Float4& color, GlyphFunction&& glyphFunction)
+*  @brief     Return the layout of the number. When only the value changed, the uv of the changed digits are rewritten.
+*  @param[in] std::uint32_t fontID
+*  @param[in] std::uint32_t generation
+*  @param[in] const TextNumber& number
+*  @param[in] const gm::Float4& color
+*  @param[in] GlyphFunction&& glyphFunction
+*  @return @@const TextLayout& (valid until the next Get)
+*****************************************************************************/
+template<class GlyphFunction>
+const TextLayout& TextLayoutCache::GetNumber(std::uint32_t fontID, std::uint32_t generation, const TextNumber& number, const gm::Float4& color, GlyphFunction&& glyphFunction)
+{
+	/*-------------------------------------------------------------------
+	-              Make the key
+	---------------------------------------------------------------------*/
+	_key.clear();
+	_key.push_back('N');
+	AppendKey(fontID);
+	AppendKey(number.Digit);
+	AppendKey(number.SizePerDigit);
+	AppendKey(number.Space);
+	AppendKey(number.StartPosition); // each counter on the screen has its own layout
+
+	TextLayout& layout  = FindOrAdd();
+	const int   digit   = (std::max)(number.Digit, 0);
+	const bool  rebuild = !layout.IsBuilt || layout.Generation != generation;
+	if (!rebuild && layout.Number == number.Number)
+	{
+		PrepareDrawVertices(layout, number.StartPosition, color);
+		return layout;
+	}
+
+	/*-------------------------------------------------------------------
+	-              Digits (the upper digits are 0)
+	---------------------------------------------------------------------*/
+	std::uint8_t values[16] = {};
+	std::vector<std::uint8_t> longValues;
+	std::uint8_t* digits = values;
+	if (digit > 16) { longValues.resize(digit); digits = longValues.data(); }
+	UINT tempValue = number.Number;
+	for (int i = digit - 1; i >= 0; --i)
+	{
+		digits[i] = static_cast<std::uint8_t>(tempValue % 10);
+		tempValue = tempValue / 10;
+	}
+
+	/*-------------------------------------------------------------------
+	-              Build the quads or update the changed digits
+	---------------------------------------------------------------------*/
+	if (rebuild)
+	{
+		layout.Vertices.resize(static_cast<size_t>(digit) * 4);
+		layout.Digits.assign(digits, digits + digit);
+		layout.Generation = generation;
+		layout.IsBuilt    = true;
+		for (int i = 0; i < digit; ++i)
+		{
+			TextGlyph glyph;
+			glyphFunction(static_cast<int>(digits[i]), glyph);
+			const float left = i * (number.SizePerDigit.x + number.Space);
+			SetQuad(layout.Vertices.data() + i * 4, left, left + number.SizePerDigit.x, -1.5f * number.SizePerDigit.y, -0.5f * number.SizePerDigit.y, glyph);
+		}
+		layout.IsDrawReady = false;
+	}
+	else
+	{
+		for (int i = 0; i < digit; ++i)
+		{
+			if (layout.Digits[i] == digits[i]) { continue; }
+			TextGlyph glyph;
+			glyphFunction(static_cast<int>(digits[i]), glyph);
+			SetQuadUV(layout.Vertices.data() + i * 4, glyph);
+			if (layout.IsDrawReady) { SetQuadUV(layout.DrawVertices.data() + i * 4, glyph); }
+			layout.Digits[i] = digits[i];
+		}
+	}
+	layout.Number = number.Number;
+	PrepareDrawVertices(layout, number.StartPosition, color);
+	++_buildCount;
+	return layout;
+}
+#endif
@@ -3,6 +3,7 @@
 ///             @brief  TextRenderer
 ///                     @ Initialize
 ///                     A DrawStart-> DrawString, DrawNum ->DrawEnd
+///                     (LoadSystemFont -> DrawString(fontIndex, ...) draws any character with the glyph atlas)
 ///             @author Toide Yutaro
 ///             @date   2021_03_16
 //////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +17,8 @@
 #include "SpriteRenderer.hpp"
 #include "Font.hpp"
 #include "Text.hpp"
+#include "GlyphAtlas.hpp"
+#include "TextLayoutCache.hpp"
 #include <unordered_map>
 #include <Windows.h>
 
@@ -31,6 +34,8 @@
 *************************************************************************//**
 *  @class     Text Renderer
 *  @brief     text rendering
+*             The quads are cached (TextLayoutCache), so unchanged text is only copied each frame.
+*             System fonts are rasterized on demand (GDI) into the glyph atlas texture.
 *****************************************************************************/
 class TextRenderer : public SpriteRenderer
 {
@@ -42,24 +47,57 @@ public:
 	bool DrawStart();
 	bool DrawString(FontType fontType, const TextString& text,   const gm::Float4& color, const gm::Matrix4& matrix);
 	bool DrawNumber(FontType fontType, const TextNumber& number, const gm::Float4& color, const gm::Matrix4& matrix);
+	/* text.SizePerChar.x : width of a glyph whose advance is the line height */
+	bool DrawString(int systemFontIndex, const TextString& text,   const gm::Float4& color, const gm::Matrix4& matrix);
+	bool DrawNumber(int systemFontIndex, const TextNumber& number, const gm::Float4& color, const gm::Matrix4& matrix);
 	bool DrawEnd();
 	bool Finalize() override;
 	bool ReloadFont();
+	/* return the system font index (-1 : failed) */
+	int  LoadSystemFont(const std::wstring& faceName, int pixelHeight, bool isBold = false);
+
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	const GlyphAtlas&      GetGlyphAtlas () const { return _glyphAtlas; }
+	const TextLayoutCache& GetLayoutCache() const { return _layoutCache; }
 
 	/****************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
 	~TextRenderer();
 private:
+	struct SystemFont
+	{
+		HFONT Handle      = nullptr;
+		int   PixelHeight = 0;
+		int   Ascent      = 0;
+		int   LineHeight  = 0;
+	};
 	/****************************************************************************
 	**                Private Function
 	*****************************************************************************/
+	bool DrawLayout(const TextLayout& layout, const Texture& texture, const gm::Matrix4& matrix);
+	bool GetSystemGlyph(int systemFontIndex, wchar_t character, TextGlyph& outGlyph);
+	bool UploadGlyphAtlas();
+	bool CreateAtlasTexture();
+	void ReleaseSystemFonts();
 
 	/****************************************************************************
 	**                Private Member Variables
 	*****************************************************************************/
+	TextLayoutCache         _layoutCache;
+	GlyphAtlas              _glyphAtlas;
+	std::vector<SystemFont> _systemFonts;
+	HDC                     _glyphDC = nullptr;
+	std::vector<std::uint8_t> _glyphBuffer;
+
+	/*-------------------------------------------------------------------
+	-     atlas texture (CPU writable. replaced when the atlas generation changes)
+	---------------------------------------------------------------------*/
+	Texture            _atlasTexture;
+	ResourceViewHandle _atlasView;               // SRV of the atlas (the former one is recycled after the frames in flight)
+	std::uint32_t      _atlasTextureGeneration = 0;
+	std::vector<std::pair<UINT64, ResourceComPtr>> _retiredAtlasTextures; // (frame count, texture) kept while the GPU may read it
 };
 #endif
\ No newline at end of file
@@ -48,7 +48,7 @@ bool AudioClip::LoadFromFile(const std::wstring& filePath)
 	if (extension == L"wav")
 	{
 		WavDecoder wavDecoder;
-		wavDecoder.LoadFromFile(filePath);
+		if (!wavDecoder.LoadFromFile(filePath)) { return false; }
 		_waveFormatEx = wavDecoder.GetFileFormatEx();
 		_filePath     = wavDecoder.GetFilePath();
 		_soundSize    = wavDecoder.GetWaveSize();
@@ -54,11 +54,11 @@ void AudioMaster::Finalize()
 	/*-------------------------------------------------------------------
 	-              Stop All Sound
 	---------------------------------------------------------------------*/
-	for (auto table : _audioTable.AudioTable)
+	_audioTable.AudioTable.ForEach([](const std::wstring&, std::shared_ptr<AudioClip>& clip)
 	{
-		table.second->Destroy();
-	}
-	_audioTable.AudioTable.clear();
+		clip->Destroy();
+	});
+	_audioTable.AudioTable.Clear();
 
 	/*-------------------------------------------------------------------
 	-              Destroy Master Voice
@@ -92,11 +92,11 @@ void AudioMaster::Finalize()
 *****************************************************************************/
 void AudioMaster::ClearSound()
 {
-	for (auto table : _audioTable.AudioTable)
+	_audioTable.AudioTable.ForEach([](const std::wstring&, std::shared_ptr<AudioClip>& clip)
 	{
-		table.second->Destroy();
-	}
-	_audioTable.AudioTable.clear();
+		clip->Destroy();
+	});
+	_audioTable.AudioTable.Clear();
 }
 
 /****************************************************************************
@@ -0,0 +1,623 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   AudioMixer.cpp
+///             @brief  Software audio mixer (CPU mixing, resampling and 3D attenuation)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/AudioMixer.hpp"
+#include "GameCore/Include/Audio/AudioSink.hpp"
+#include "GameCore/Include/Audio/WavDecoder.hpp"
+#include "GameMath/Include/GMSimdConfig.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(GM_SIMD_USE_SSE2)
+#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr float         SPEED_OF_SOUND    = 343.5f; // X3DAUDIO_SPEED_OF_SOUND
+	constexpr float         MAX_DOPPLER_RATIO = 2.0f;   // XAUDIO2_DEFAULT_FREQ_RATIO
+	constexpr float         MIN_DOPPLER_RATIO = 1.0f / MAX_DOPPLER_RATIO;
+	constexpr std::uint64_t FIXED_ONE         = 1ull << 32;
+	constexpr float         FIXED_TO_FLOAT    = 1.0f / 4294967296.0f;
+	constexpr float         QUARTER_PI        = 0.785398163f;
+
+	/*-------------------------------------------------------------------
+	-              Sample of the frame (out of range : wrap for loop, otherwise hold the edge / silence)
+	---------------------------------------------------------------------*/
+	template<int CHANNEL>
+	inline float FetchSample(const float* samples, std::int64_t frame, std::int64_t frameCount, int channel, bool isLoop)
+	{
+		if (frame < 0)                { frame = isLoop ? frame + frameCount : 0; }
+		else if (frame >= frameCount)
+		{
+			if (!isLoop) { return 0.0f; }
+			frame -= frameCount;
+			if (frame >= frameCount) { frame %= frameCount; }
+		}
+		return samples[frame * CHANNEL + channel];
+	}
+
+	inline float CatmullRom(float p0, float p1, float p2, float p3, float t)
+	{
+		const float a0 = -0.5f * p0 + 1.5f * p1 - 1.5f * p2 + 0.5f * p3;
+		const float a1 =         p0 - 2.5f * p1 + 2.0f * p2 - 0.5f * p3;
+		const float a2 = -0.5f * p0             + 0.5f * p2;
+		return ((a0 * t + a1) * t + a2) * t + p1;
+	}
+
+	/*-------------------------------------------------------------------
+	-              Resample the clip into destination (CHANNEL floats per frame)
+	-              return : written frame count (< frameCount at the end of one-shot)
+	---------------------------------------------------------------------*/
+	template<int CHANNEL, bool IS_CUBIC>
+	size_t ResampleVoice(float* destination, size_t frameCount, const AudioMixerClip& clip, std::uint64_t& position, std::uint64_t step, bool isLoop)
+	{
+		const float*       samples    = clip.GetSamples();
+		const std::int64_t clipFrames = static_cast<std::int64_t>(clip.GetFrameCount());
+		const std::uint64_t end       = static_cast<std::uint64_t>(clipFrames) << 32;
+
+		size_t frame = 0;
+		while (frame < frameCount)
+		{
+			if (position >= end)
+			{
+				if (!isLoop) { break; }
+				position %= end;
+			}
+
+			/*-------------------------------------------------------------------
+			-              Same rate : copy until the end of the clip
+			---------------------------------------------------------------------*/
+			if (step == FIXED_ONE && (position & (FIXED_ONE - 1)) == 0)
+			{
+				const std::uint64_t index = position >> 32;
+				const size_t count = static_cast<size_t>((std::min)(static_cast<std::uint64_t>(frameCount - frame), static_cast<std::uint64_t>(clipFrames) - index));
+				std::memcpy(destination + frame * CHANNEL, samples + index * CHANNEL, count * CHANNEL * sizeof(float));
+				frame    += count;
+				position += static_cast<std::uint64_t>(count) << 32;
+				continue;
+			}
+
+			const std::int64_t index = static_cast<std::int64_t>(position >> 32);
+			const float        t     = static_cast<float>(position & (FIXED_ONE - 1)) * FIXED_TO_FLOAT;
+			float* output = destination + frame * CHANNEL;
+
+			if (index >= 1 && index + 2 < clipFrames)
+			{
+				const float* p = samples + index * CHANNEL;
+				for (int c = 0; c < CHANNEL; ++c)
+				{
+					output[c] = IS_CUBIC ? CatmullRom(p[c - CHANNEL], p[c], p[c + CHANNEL], p[c + 2 * CHANNEL], t)
+						: p[c] + (p[c + CHANNEL] - p[c]) * t;
+				}
+			}
+			else
+			{
+				for (int c = 0; c < CHANNEL; ++c)
+				{
+					const float p1 = FetchSample<CHANNEL>(samples, index    , clipFrames, c, isLoop);
+					const float p2 = FetchSample<CHANNEL>(samples, index + 1, clipFrames, c, isLoop);
+					if (IS_CUBIC)
+					{
+						const float p0 = FetchSample<CHANNEL>(samples, index - 1, clipFrames, c, isLoop);
+						const float p3 = FetchSample<CHANNEL>(samples, index + 2, clipFrames, c, isLoop);
+						output[c] = CatmullRom(p0, p1, p2, p3, t);
+					}
+					else { output[c] = p1 + (p2 - p1) * t; }
+				}
+			}
+			position += step;
+			++frame;
+		}
+		return frame;
+	}
+
+	/*-------------------------------------------------------------------
+	-              output(stereo) += source * gain (gain is ramped linearly by delta per frame)
+	---------------------------------------------------------------------*/
+	void MixMonoToStereo(float* output, const float* source, size_t frameCount, float left, float right, float deltaLeft, float deltaRight)
+	{
+		size_t frame = 0;
+#if defined(GM_SIMD_USE_SSE2)
+		__m128 gain0 = _mm_setr_ps(left, right, left + deltaLeft, right + deltaRight);
+		__m128 gain1 = _mm_add_ps(gain0, _mm_setr_ps(2.0f * deltaLeft, 2.0f * deltaRight, 2.0f * deltaLeft, 2.0f * deltaRight));
+		const __m128 gainStep = _mm_setr_ps(4.0f * deltaLeft, 4.0f * deltaRight, 4.0f * deltaLeft, 4.0f * deltaRight);
+		for (; frame + 4 <= frameCount; frame += 4)
+		{
+			const __m128 mono = _mm_loadu_ps(source + frame);
+			const __m128 low  = _mm_unpacklo_ps(mono, mono); // s0 s0 s1 s1
+			const __m128 high = _mm_unpackhi_ps(mono, mono); // s2 s2 s3 s3
+			float* out = output + frame * 2;
+			_mm_storeu_ps(out    , _mm_add_ps(_mm_loadu_ps(out    ), _mm_mul_ps(low , gain0)));
+			_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(high, gain1)));
+			gain0 = _mm_add_ps(gain0, gainStep);
+			gain1 = _mm_add_ps(gain1, gainStep);
+		}
+		left  += deltaLeft  * static_cast<float>(frame);
+		right += deltaRight * static_cast<float>(frame);
+#endif
+		for (; frame < frameCount; ++frame)
+		{
+			output[frame * 2    ] += source[frame] * left;
+			output[frame * 2 + 1] += source[frame] * right;
+			left += deltaLeft; right += deltaRight;
+		}
+	}
+
+	void MixStereoToStereo(float* output, const float* source, size_t frameCount, float left, float right, float deltaLeft, float deltaRight)
+	{
+		size_t frame = 0;
+#if defined(GM_SIMD_USE_SSE2)
+		__m128 gain = _mm_setr_ps(left, right, left + deltaLeft, right + deltaRight);
+		const __m128 gainStep = _mm_setr_ps(2.0f * deltaLeft, 2.0f * deltaRight, 2.0f * deltaLeft, 2.0f * deltaRight);
+		for (; frame + 2 <= frameCount; frame += 2)
+		{
+			float* out = output + frame * 2;
+			_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_loadu_ps(source + frame * 2), gain)));
+			gain = _mm_add_ps(gain, gainStep);
+		}
+		left  += deltaLeft  * static_cast<float>(frame);
+		right += deltaRight * static_cast<float>(frame);
+#endif
+		for (; frame < frameCount; ++frame)
+		{
+			output[frame * 2    ] += source[frame * 2    ] * left;
+			output[frame * 2 + 1] += source[frame * 2 + 1] * right;
+			left += deltaLeft; right += deltaRight;
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-              output = clamp(output * volume, -1, 1)
+	---------------------------------------------------------------------*/
+	void ApplyMasterVolume(float* output, size_t sampleCount, float volume)
+	{
+		size_t i = 0;
+#if defined(GM_SIMD_USE_SSE2)
+		const __m128 scale = _mm_set1_ps(volume);
+		const __m128 upper = _mm_set1_ps( 1.0f);
+		const __m128 lower = _mm_set1_ps(-1.0f);
+		for (; i + 4 <= sampleCount; i += 4)
+		{
+			const __m128 value = _mm_mul_ps(_mm_loadu_ps(output + i), scale);
+			_mm_storeu_ps(output + i, _mm_min_ps(_mm_max_ps(value, lower), upper));
+		}
+#endif
+		for (; i < sampleCount; ++i)
+		{
+			output[i] = (std::min)((std::max)(output[i] * volume, -1.0f), 1.0f);
+		}
+	}
+
+	inline float Dot(const gm::Float3& a, const gm::Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region AudioMixerClip
+/****************************************************************************
+*                       LoadFromFile
+*************************************************************************//**
+*  @fn        bool AudioMixerClip::LoadFromFile(const std::wstring& filePath)
+*  @brief     Decode the wave file to float (mono or stereo)
+*  @param[in] const std::wstring& filePath
+*  @return @@bool
+*****************************************************************************/
+bool AudioMixerClip::LoadFromFile(const std::wstring& filePath)
+{
+	WavDecoder decoder;
+	if (!decoder.OpenStream(filePath)) { return false; }
+
+	const WavFormat& format = decoder.GetFormat();
+	if (format.Channels > 2) { return false; }
+
+	std::vector<float> samples(static_cast<size_t>(decoder.GetFrameCount()) * format.Channels);
+	const size_t frameCount = decoder.ReadFramesAsFloat(samples.data(), static_cast<size_t>(decoder.GetFrameCount()));
+	return Create(samples.data(), frameCount, format.Channels, format.SamplesPerSecond);
+}
+
+/****************************************************************************
+*                       Create
+*************************************************************************//**
+*  @fn        bool AudioMixerClip::Create(const float* samples, std::uint64_t frameCount, std::uint32_t channelCount, std::uint32_t sampleRate)
+*  @brief     Copy interleaved float samples
+*  @param[in] const float* samples
+*  @param[in] std::uint64_t frameCount
+*  @param[in] std::uint32_t channelCount (1 or 2)
+*  @param[in] std::uint32_t sampleRate
+*  @return @@bool
+*****************************************************************************/
+bool AudioMixerClip::Create(const float* samples, std::uint64_t frameCount, std::uint32_t channelCount, std::uint32_t sampleRate)
+{
+	if (samples == nullptr || frameCount == 0 || frameCount >= (1ull << 31) || (channelCount != 1 && channelCount != 2) || sampleRate == 0) { return false; }
+
+	_samples.assign(samples, samples + frameCount * channelCount);
+	_frameCount   = frameCount;
+	_channelCount = channelCount;
+	_sampleRate   = sampleRate;
+	return true;
+}
+#pragma endregion AudioMixerClip
+
+#pragma region AudioMixer
+AudioMixer::~AudioMixer()
+{
+	Finalize();
+}
+
+#pragma region Public Function
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool AudioMixer::Initialize(std::uint32_t sampleRate, std::uint32_t voiceCount, std::uint32_t blockFrameCount, AudioSink* sink)
+*  @brief     Allocate the voice pool and open the sink
+*  @param[in] std::uint32_t sampleRate
+*  @param[in] std::uint32_t voiceCount (<= 65535)
+*  @param[in] std::uint32_t blockFrameCount (mixing granularity, gain ramp length)
+*  @param[in] AudioSink* sink (not owned, nullptr : Mix only)
+*  @return @@bool
+*****************************************************************************/
+bool AudioMixer::Initialize(std::uint32_t sampleRate, std::uint32_t voiceCount, std::uint32_t blockFrameCount, AudioSink* sink)
+{
+	if (sampleRate == 0 || voiceCount == 0 || voiceCount > 0xFFFF || blockFrameCount == 0) { return false; }
+	Finalize();
+
+	_sampleRate      = sampleRate;
+	_blockFrameCount = blockFrameCount;
+	_voices.assign(voiceCount, Voice());
+	_voiceBuffer.resize(static_cast<size_t>(blockFrameCount) * 2);
+	_mixBuffer  .resize(static_cast<size_t>(blockFrameCount) * 2);
+	SetSink(sink);
+	return true;
+}
+
+/****************************************************************************
+*                       Finalize
+*************************************************************************//**
+*  @fn        void AudioMixer::Finalize()
+*  @brief     Stop all voices and close the sink
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::Finalize()
+{
+	StopAll();
+	SetSink(nullptr);
+	_voices.clear();
+	_voiceBuffer.clear();
+	_mixBuffer.clear();
+}
+
+/****************************************************************************
+*                       Play
+*************************************************************************//**
+*  @fn        AudioVoiceHandle AudioMixer::Play(const std::shared_ptr<const AudioMixerClip>& clip, const AudioMixerPlayDesc& desc)
+*  @brief     Start a voice from the pool
+*  @param[in] const std::shared_ptr<const AudioMixerClip>& clip
+*  @param[in] const AudioMixerPlayDesc& desc
+*  @return @@AudioVoiceHandle (INVALID_AUDIO_VOICE : all voices are looping)
+*****************************************************************************/
+AudioVoiceHandle AudioMixer::Play(const std::shared_ptr<const AudioMixerClip>& clip, const AudioMixerPlayDesc& desc)
+{
+	if (clip == nullptr || clip->GetFrameCount() == 0 || _voices.empty()) { return INVALID_AUDIO_VOICE; }
+
+	/*-------------------------------------------------------------------
+	-              Free voice, otherwise the oldest one-shot voice
+	---------------------------------------------------------------------*/
+	Voice* target = nullptr;
+	for (auto& voice : _voices)
+	{
+		if (!voice.IsActive) { target = &voice; break; }
+		if (voice.IsLoop)    { continue; }
+		if (target == nullptr || voice.StartOrder < target->StartOrder) { target = &voice; }
+	}
+	if (target == nullptr) { return INVALID_AUDIO_VOICE; }
+	if (target->IsActive)  { ReleaseVoice(*target); }
+
+	target->Clip          = clip;
+	target->Position      = 0;
+	target->StartOrder    = ++_playCounter;
+	target->Volume        = desc.Volume;
+	target->Pan           = desc.Pan;
+	target->Pitch         = desc.Pitch;
+	target->Interpolation = desc.Interpolation;
+	target->IsLoop        = desc.IsLoop;
+	target->Is3D          = false;
+	target->IsActive      = true;
+
+	float doppler = 1.0f;
+	CalculateGain(*target, target->CurrentGain[0], target->CurrentGain[1], doppler);
+
+	const std::uint32_t index = static_cast<std::uint32_t>(target - _voices.data());
+	return (static_cast<std::uint32_t>(target->Generation) << 16) | index;
+}
+
+/****************************************************************************
+*                       Stop
+*************************************************************************//**
+*  @fn        void AudioMixer::Stop(AudioVoiceHandle handle)
+*  @brief     Stop the voice (an expired handle is ignored)
+*  @param[in] AudioVoiceHandle handle
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::Stop(AudioVoiceHandle handle)
+{
+	if (Voice* voice = FindVoice(handle)) { ReleaseVoice(*voice); }
+}
+
+/****************************************************************************
+*                       StopAll
+*************************************************************************//**
+*  @fn        void AudioMixer::StopAll()
+*  @brief     Stop all voices
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::StopAll()
+{
+	for (auto& voice : _voices)
+	{
+		if (voice.IsActive) { ReleaseVoice(voice); }
+	}
+}
+
+/****************************************************************************
+*                       Mix
+*************************************************************************//**
+*  @fn        void AudioMixer::Mix(float* output, size_t frameCount)
+*  @brief     Mix all active voices into output (interleaved stereo, overwritten)
+*  @param[out] float* output
+*  @param[in] size_t frameCount
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::Mix(float* output, size_t frameCount)
+{
+	if (_blockFrameCount == 0) { return; }
+	while (frameCount > 0)
+	{
+		const size_t count = (std::min)(frameCount, static_cast<size_t>(_blockFrameCount));
+		MixBlock(output, count);
+		output     += count * 2;
+		frameCount -= count;
+	}
+}
+
+/****************************************************************************
+*                       Render
+*************************************************************************//**
+*  @fn        bool AudioMixer::Render(size_t frameCount)
+*  @brief     Mix frameCount frames and write them to the sink
+*  @param[in] size_t frameCount
+*  @return @@bool
+*****************************************************************************/
+bool AudioMixer::Render(size_t frameCount)
+{
+	if (_sink == nullptr || _blockFrameCount == 0) { return false; }
+	while (frameCount > 0)
+	{
+		const size_t count = (std::min)(frameCount, static_cast<size_t>(_blockFrameCount));
+		MixBlock(_mixBuffer.data(), count);
+		if (!_sink->Write(_mixBuffer.data(), count)) { return false; }
+		frameCount -= count;
+	}
+	return true;
+}
+
+#pragma region Property
+void AudioMixer::SetVolume(AudioVoiceHandle handle, float volume)
+{
+	if (Voice* voice = FindVoice(handle)) { voice->Volume = volume; }
+}
+
+void AudioMixer::SetPan(AudioVoiceHandle handle, float pan)
+{
+	if (Voice* voice = FindVoice(handle)) { voice->Pan = pan; }
+}
+
+void AudioMixer::SetPitch(AudioVoiceHandle handle, float pitch)
+{
+	if (Voice* voice = FindVoice(handle)) { voice->Pitch = pitch; }
+}
+
+void AudioMixer::SetEmitter(AudioVoiceHandle handle, const AudioMixerEmitter& emitter)
+{
+	if (Voice* voice = FindVoice(handle))
+	{
+		voice->Emitter = emitter;
+		voice->Is3D    = true;
+	}
+}
+
+/****************************************************************************
+*                       SetSink
+*************************************************************************//**
+*  @fn        void AudioMixer::SetSink(AudioSink* sink)
+*  @brief     Close the current sink and open the new one with the mixer format
+*  @param[in] AudioSink* sink
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::SetSink(AudioSink* sink)
+{
+	if (_sink != nullptr) { _sink->Close(); }
+	_sink = sink;
+	if (_sink != nullptr && !_sink->Open(_sampleRate, GetChannelCount())) { _sink = nullptr; }
+}
+
+std::uint32_t AudioMixer::GetActiveVoiceCount() const
+{
+	return static_cast<std::uint32_t>(std::count_if(_voices.begin(), _voices.end(), [](const Voice& voice) { return voice.IsActive; }));
+}
+#pragma endregion Property
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       MixBlock
+*************************************************************************//**
+*  @fn        void AudioMixer::MixBlock(float* output, size_t frameCount)
+*  @brief     Resample each voice into the voice buffer and accumulate with the ramped gain
+*  @param[out] float* output
+*  @param[in] size_t frameCount (<= block frame count)
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::MixBlock(float* output, size_t frameCount)
+{
+	std::memset(output, 0, frameCount * 2 * sizeof(float));
+
+	for (auto& voice : _voices)
+	{
+		if (!voice.IsActive) { continue; }
+		const AudioMixerClip& clip = *voice.Clip;
+
+		/*-------------------------------------------------------------------
+		-              Gain and frequency ratio of this block
+		---------------------------------------------------------------------*/
+		float left = 0.0f, right = 0.0f, doppler = 1.0f;
+		CalculateGain(voice, left, right, doppler);
+		const double ratio = static_cast<double>(voice.Pitch) * doppler * clip.GetSampleRate() / _sampleRate;
+		const std::uint64_t step = static_cast<std::uint64_t>((std::max)(ratio, 0.0) * static_cast<double>(FIXED_ONE) + 0.5);
+
+		/*-------------------------------------------------------------------
+		-              Resample
+		---------------------------------------------------------------------*/
+		const bool isCubic = voice.Interpolation == AudioInterpolation::Cubic;
+		size_t mixedFrames = 0;
+		if (clip.GetChannelCount() == 1)
+		{
+			mixedFrames = isCubic ? ResampleVoice<1, true >(_voiceBuffer.data(), frameCount, clip, voice.Position, step, voice.IsLoop)
+			                      : ResampleVoice<1, false>(_voiceBuffer.data(), frameCount, clip, voice.Position, step, voice.IsLoop);
+		}
+		else
+		{
+			mixedFrames = isCubic ? ResampleVoice<2, true >(_voiceBuffer.data(), frameCount, clip, voice.Position, step, voice.IsLoop)
+			                      : ResampleVoice<2, false>(_voiceBuffer.data(), frameCount, clip, voice.Position, step, voice.IsLoop);
+		}
+
+		/*-------------------------------------------------------------------
+		-              Accumulate (the gain moves to the target over the block to avoid zipper noise)
+		---------------------------------------------------------------------*/
+		const float deltaLeft  = (left  - voice.CurrentGain[0]) / static_cast<float>(frameCount);
+		const float deltaRight = (right - voice.CurrentGain[1]) / static_cast<float>(frameCount);
+		if (clip.GetChannelCount() == 1) { MixMonoToStereo  (output, _voiceBuffer.data(), mixedFrames, voice.CurrentGain[0], voice.CurrentGain[1], deltaLeft, deltaRight); }
+		else                             { MixStereoToStereo(output, _voiceBuffer.data(), mixedFrames, voice.CurrentGain[0], voice.CurrentGain[1], deltaLeft, deltaRight); }
+		voice.CurrentGain[0] = left;
+		voice.CurrentGain[1] = right;
+
+		if (mixedFrames < frameCount) { ReleaseVoice(voice); }
+	}
+
+	ApplyMasterVolume(output, frameCount * 2, _masterVolume);
+}
+
+/****************************************************************************
+*                       CalculateGain
+*************************************************************************//**
+*  @fn        void AudioMixer::CalculateGain(const Voice& voice, float& left, float& right, float& doppler) const
+*  @brief     Channel gains (pan and distance attenuation) and doppler ratio of the voice.
+*             Mono is panned with equal power, stereo with balance.
+*  @param[in] const Voice& voice
+*  @param[out] float& left
+*  @param[out] float& right
+*  @param[out] float& doppler
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::CalculateGain(const Voice& voice, float& left, float& right, float& doppler) const
+{
+	float volume = voice.Volume;
+	float pan    = voice.Pan;
+	doppler      = 1.0f;
+
+	if (voice.Is3D)
+	{
+		const AudioMixerEmitter& emitter = voice.Emitter;
+		const gm::Float3 toEmitter(emitter.Position.x - _listener.Position.x, emitter.Position.y - _listener.Position.y, emitter.Position.z - _listener.Position.z);
+		const float distance = std::sqrt(Dot(toEmitter, toEmitter));
+
+		/*-------------------------------------------------------------------
+		-              Distance attenuation (X3DAudio default curve)
+		---------------------------------------------------------------------*/
+		const float curveDistance = (std::max)(emitter.CurveDistanceScaler, 1e-6f);
+		volume *= curveDistance / (std::max)(distance, curveDistance);
+
+		if (distance > 1e-6f)
+		{
+			/*-------------------------------------------------------------------
+			-              Pan from the azimuth (left handed: right = up x front)
+			---------------------------------------------------------------------*/
+			const gm::Float3& f = _listener.Front;
+			const gm::Float3& u = _listener.Up;
+			gm::Float3 side(u.y * f.z - u.z * f.y, u.z * f.x - u.x * f.z, u.x * f.y - u.y * f.x);
+			const float sideLength = std::sqrt(Dot(side, side));
+			if (sideLength > 1e-6f)
+			{
+				pan  = Dot(toEmitter, side) / (sideLength * distance);
+				pan *= (std::min)(distance / (std::max)(emitter.InnerRadius, 1e-6f), 1.0f);
+			}
+
+			/*-------------------------------------------------------------------
+			-              Doppler (velocity components along emitter -> listener)
+			---------------------------------------------------------------------*/
+			const float inverseDistance   = 1.0f / distance;
+			const float limit             = SPEED_OF_SOUND * 0.99f;
+			const float listenerComponent = (std::min)(-Dot(_listener.Velocity, toEmitter) * inverseDistance * emitter.DopplerScaler, limit);
+			const float emitterComponent  = (std::min)(-Dot(emitter.Velocity  , toEmitter) * inverseDistance * emitter.DopplerScaler, limit);
+			doppler = (SPEED_OF_SOUND - listenerComponent) / (SPEED_OF_SOUND - emitterComponent);
+			doppler = (std::min)((std::max)(doppler, MIN_DOPPLER_RATIO), MAX_DOPPLER_RATIO);
+		}
+	}
+
+	pan = (std::min)((std::max)(pan, -1.0f), 1.0f);
+	if (voice.Clip != nullptr && voice.Clip->GetChannelCount() == 1)
+	{
+		const float angle = (pan + 1.0f) * QUARTER_PI;
+		left  = volume * std::cos(angle);
+		right = volume * std::sin(angle);
+	}
+	else
+	{
+		left  = volume * (std::min)(1.0f - pan, 1.0f);
+		right = volume * (std::min)(1.0f + pan, 1.0f);
+	}
+}
+
+AudioMixer::Voice* AudioMixer::FindVoice(AudioVoiceHandle handle)
+{
+	return const_cast<Voice*>(static_cast<const AudioMixer*>(this)->FindVoice(handle));
+}
+
+const AudioMixer::Voice* AudioMixer::FindVoice(AudioVoiceHandle handle) const
+{
+	const std::uint32_t index = handle & 0xFFFF;
+	if (handle == INVALID_AUDIO_VOICE || index >= _voices.size()) { return nullptr; }
+
+	const Voice& voice = _voices[index];
+	return (voice.IsActive && voice.Generation == (handle >> 16)) ? &voice : nullptr;
+}
+
+/****************************************************************************
+*                       ReleaseVoice
+*************************************************************************//**
+*  @fn        void AudioMixer::ReleaseVoice(Voice& voice)
+*  @brief     Return the voice to the pool (the old handles become invalid)
+*  @param[in] Voice& voice
+*  @return @@void
+*****************************************************************************/
+void AudioMixer::ReleaseVoice(Voice& voice)
+{
+	voice.Clip     = nullptr;
+	voice.IsActive = false;
+	voice.Is3D     = false;
+	if (++voice.Generation == 0) { voice.Generation = 1; }
+}
+#pragma endregion Private Function
+#pragma endregion AudioMixer
@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   AudioSink.cpp
+///             @brief  Output destination of the software audio mixer
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/AudioSink.hpp"
+#include <filesystem>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	inline void WriteLE16(std::uint8_t* p, std::uint16_t value) { p[0] = static_cast<std::uint8_t>(value); p[1] = static_cast<std::uint8_t>(value >> 8); }
+	inline void WriteLE32(std::uint8_t* p, std::uint32_t value) { WriteLE16(p, static_cast<std::uint16_t>(value)); WriteLE16(p + 2, static_cast<std::uint16_t>(value >> 16)); }
+	constexpr std::uint32_t WAV_HEADER_SIZE = 44;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region NullAudioSink
+/****************************************************************************
+*                       Open
+*************************************************************************//**
+*  @fn        bool NullAudioSink::Open(std::uint32_t sampleRate, std::uint32_t channelCount)
+*  @brief     Reset the counters
+*  @param[in] std::uint32_t sampleRate
+*  @param[in] std::uint32_t channelCount
+*  @return @@bool
+*****************************************************************************/
+bool NullAudioSink::Open(std::uint32_t sampleRate, std::uint32_t channelCount)
+{
+	(void)sampleRate;
+	_channelCount      = channelCount;
+	_writtenFrameCount = 0;
+	_peak              = 0.0f;
+	return true;
+}
+
+/****************************************************************************
+*                       Write
+*************************************************************************//**
+*  @fn        bool NullAudioSink::Write(const float* samples, size_t frameCount)
+*  @brief     Count the frames and keep the peak level
+*  @param[in] const float* samples
+*  @param[in] size_t frameCount
+*  @return @@bool
+*****************************************************************************/
+bool NullAudioSink::Write(const float* samples, size_t frameCount)
+{
+	const size_t sampleCount = frameCount * _channelCount;
+	for (size_t i = 0; i < sampleCount; ++i)
+	{
+		_peak = (std::max)(_peak, std::fabs(samples[i]));
+	}
+	_writtenFrameCount += frameCount;
+	return true;
+}
+#pragma endregion NullAudioSink
+
+#pragma region WavFileAudioSink
+WavFileAudioSink::~WavFileAudioSink()
+{
+	Close();
+}
+
+/****************************************************************************
+*                       Open
+*************************************************************************//**
+*  @fn        bool WavFileAudioSink::Open(std::uint32_t sampleRate, std::uint32_t channelCount)
+*  @brief     Create the file and write a temporary header
+*  @param[in] std::uint32_t sampleRate
+*  @param[in] std::uint32_t channelCount
+*  @return @@bool
+*****************************************************************************/
+bool WavFileAudioSink::Open(std::uint32_t sampleRate, std::uint32_t channelCount)
+{
+	Close();
+	_stream.open(std::filesystem::path(_filePath), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!_stream.is_open()) { return false; }
+
+	_sampleRate        = sampleRate;
+	_channelCount      = channelCount;
+	_writtenFrameCount = 0;
+	WriteHeader(0);
+	return _stream.good();
+}
+
+/****************************************************************************
+*                       Write
+*************************************************************************//**
+*  @fn        bool WavFileAudioSink::Write(const float* samples, size_t frameCount)
+*  @brief     Append the frames (little endian)
+*  @param[in] const float* samples
+*  @param[in] size_t frameCount
+*  @return @@bool
+*****************************************************************************/
+bool WavFileAudioSink::Write(const float* samples, size_t frameCount)
+{
+	if (!_stream.is_open()) { return false; }
+
+	std::uint8_t block[256 * sizeof(float)];
+	const size_t sampleCount = frameCount * _channelCount;
+	for (size_t offset = 0; offset < sampleCount; offset += 256)
+	{
+		const size_t count = (std::min)(sampleCount - offset, static_cast<size_t>(256));
+		for (size_t i = 0; i < count; ++i)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &samples[offset + i], sizeof(bits));
+			WriteLE32(block + i * sizeof(float), bits);
+		}
+		_stream.write(reinterpret_cast<const char*>(block), static_cast<std::streamsize>(count * sizeof(float)));
+	}
+	_writtenFrameCount += frameCount;
+	return _stream.good();
+}
+
+/****************************************************************************
+*                       Close
+*************************************************************************//**
+*  @fn        void WavFileAudioSink::Close()
+*  @brief     Fix the chunk sizes and close the file
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void WavFileAudioSink::Close()
+{
+	if (!_stream.is_open()) { return; }
+
+	const std::uint64_t dataSize = _writtenFrameCount * _channelCount * sizeof(float);
+	_stream.seekp(0, std::ios::beg);
+	WriteHeader(static_cast<std::uint32_t>((std::min)(dataSize, static_cast<std::uint64_t>(UINT32_MAX - WAV_HEADER_SIZE))));
+	_stream.close();
+}
+
+/****************************************************************************
+*                       WriteHeader
+*************************************************************************//**
+*  @fn        void WavFileAudioSink::WriteHeader(std::uint32_t dataSize)
+*  @brief     RIFF / fmt (IEEE float) / data header
+*  @param[in] std::uint32_t dataSize
+*  @return @@void
+*****************************************************************************/
+void WavFileAudioSink::WriteHeader(std::uint32_t dataSize)
+{
+	const std::uint16_t blockAlign = static_cast<std::uint16_t>(_channelCount * sizeof(float));
+
+	std::uint8_t header[WAV_HEADER_SIZE] = {};
+	std::memcpy(header +  0, "RIFF", 4); WriteLE32(header + 4, WAV_HEADER_SIZE - 8 + dataSize);
+	std::memcpy(header +  8, "WAVE", 4);
+	std::memcpy(header + 12, "fmt ", 4); WriteLE32(header + 16, 16);
+	WriteLE16(header + 20, 3); // IEEE float
+	WriteLE16(header + 22, static_cast<std::uint16_t>(_channelCount));
+	WriteLE32(header + 24, _sampleRate);
+	WriteLE32(header + 28, _sampleRate * blockAlign);
+	WriteLE16(header + 32, blockAlign);
+	WriteLE16(header + 34, 32);
+	std::memcpy(header + 36, "data", 4); WriteLE32(header + 40, dataSize);
+	_stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+#pragma endregion WavFileAudioSink
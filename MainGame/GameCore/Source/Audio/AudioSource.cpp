@@ -483,9 +483,10 @@ bool AudioSource::LoadAudioClip(const std::wstring& filePath)
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
 	AudioTableManager& audioTable = AudioTableManager::Instance();
-	if (audioTable.AudioTable.find(filePath) != audioTable.AudioTable.end())
+	const std::shared_ptr<AudioClip>* cached = audioTable.AudioTable.Find(filePath);
+	if (cached != nullptr)
 	{
-		_audioClip = audioTable.AudioTable[filePath];
+		_audioClip = *cached;
 		return true;
 	}
 
@@ -8,19 +8,70 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Include/Audio/WavDecoder.hpp"
-#include "DirectX12/Include/Core/DirectX12Debug.hpp"
+#include <filesystem>
+#include <algorithm>
+#include <cstring>
+#ifndef _WIN32
+#include <cstdio>
+#endif
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
-#pragma comment(lib,"winmm.lib")
+namespace
+{
+	/*-------------------------------------------------------------------
+	-              RIFF is little endian (read byte by byte for any host)
+	---------------------------------------------------------------------*/
+	inline std::uint16_t ReadLE16(const std::uint8_t* p) { return static_cast<std::uint16_t>(p[0] | (p[1] << 8)); }
+	inline std::uint32_t ReadLE32(const std::uint8_t* p)
+	{
+		return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+	}
+	inline bool IsFourCC(const std::uint8_t* p, const char* fourcc) { return std::memcmp(p, fourcc, 4) == 0; }
+
+	/*-------------------------------------------------------------------
+	-              Sample -> float [-1, 1]
+	---------------------------------------------------------------------*/
+	inline float DecodeSample(const std::uint8_t* p, std::uint16_t formatTag, std::uint16_t bitsPerSample)
+	{
+		if (formatTag == WAV_FORMAT_IEEE_FLOAT)
+		{
+			if (bitsPerSample == 32)
+			{
+				std::uint32_t bits = ReadLE32(p); float value;
+				std::memcpy(&value, &bits, sizeof(value));
+				return value;
+			}
+			std::uint64_t bits = static_cast<std::uint64_t>(ReadLE32(p)) | (static_cast<std::uint64_t>(ReadLE32(p + 4)) << 32); double value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return static_cast<float>(value);
+		}
+
+		switch (bitsPerSample)
+		{
+			case 8 : return (static_cast<float>(p[0]) - 128.0f) * (1.0f / 128.0f); // 8bit pcm is unsigned
+			case 16: return static_cast<float>(static_cast<std::int16_t>(ReadLE16(p))) * (1.0f / 32768.0f);
+			case 24:
+			{
+				std::int32_t value = static_cast<std::int32_t>((static_cast<std::uint32_t>(p[0]) << 8) | (static_cast<std::uint32_t>(p[1]) << 16) | (static_cast<std::uint32_t>(p[2]) << 24)) >> 8;
+				return static_cast<float>(value) * (1.0f / 8388608.0f);
+			}
+			default: return static_cast<float>(static_cast<double>(static_cast<std::int32_t>(ReadLE32(p))) * (1.0 / 2147483648.0));
+		}
+	}
+
+	constexpr size_t DECODE_BUFFER_FRAME_COUNT = 1024;
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Implement
 //////////////////////////////////////////////////////////////////////////////////
 WavDecoder::WavDecoder()
 {
+#ifdef _WIN32
 	ZeroMemory(&_waveFormatEx, sizeof(_waveFormatEx));
+#endif
 }
 
 #pragma region Public Function
@@ -28,64 +79,167 @@ WavDecoder::WavDecoder()
 *                       LoadFromFile
 *************************************************************************//**
 *  @fn        bool WavDecoder::LoadFromFile(const std::wstring& filePath)
-*  @brief     Open Wav File
+*  @brief     Load the whole wave data (for the short sound effects)
 *  @param[in] const std::wstring& filePath
 *  @return @@bool
 *****************************************************************************/
 bool WavDecoder::LoadFromFile(const std::wstring& filePath)
 {
-	MMCKINFO riffChunk, fmtChunk, dataChunk;
-	
-	/*-------------------------------------------------------------------
-	-              File open
-	---------------------------------------------------------------------*/
-	if (!Open(filePath)) { return false; }
-	/*-------------------------------------------------------------------
-	-              Check Wave Header
-	---------------------------------------------------------------------*/
-	if (!CheckChunk(&riffChunk, nullptr, 'W', 'A', 'V', 'E', MMIO_FINDRIFF)) { return false; }
 	/*-------------------------------------------------------------------
-	-              Check FMT Chunk
+	-              Parse RIFF header and move to the data chunk
 	---------------------------------------------------------------------*/
-	if (!CheckChunk(&fmtChunk, &riffChunk, 'f', 'm', 't', ' ', MMIO_FINDCHUNK)) { return false; }
-	/*-------------------------------------------------------------------
-	-              Read data to WAVEFORMATEX
-	---------------------------------------------------------------------*/
-	if (!CreateWaveFormatEx(fmtChunk.cksize)) { return false; }
-	/*-------------------------------------------------------------------
-	-              Return the reading position to the top.
-	---------------------------------------------------------------------*/
-	mmioAscend(_handle, &fmtChunk, SEEK_SET);
-	/*-------------------------------------------------------------------
-	-              Check DATA Chunk
-	---------------------------------------------------------------------*/
-	if (!CheckChunk(&dataChunk, &riffChunk, 'd', 'a', 't', 'a', MMIO_FINDCHUNK)) { return false; }
+	if (!OpenStream(filePath)) { return false; }
 	/*-------------------------------------------------------------------
 	-              Read WAVE Data
 	---------------------------------------------------------------------*/
-	if (!CreateWaveData(dataChunk.cksize)) { return false; }
-	
+	if (!CreateWaveData(_waveDataSize)) { Close(); return false; }
+
 	Close();
 	return true;
 }
 
+/****************************************************************************
+*                       OpenStream
+*************************************************************************//**
+*  @fn        bool WavDecoder::OpenStream(const std::wstring& filePath)
+*  @brief     Parse the header only. The data is read by ReadFrames / ReadFramesAsFloat.
+*  @param[in] const std::wstring& filePath
+*  @return @@bool
+*****************************************************************************/
+bool WavDecoder::OpenStream(const std::wstring& filePath)
+{
+	Close();
+	_waveData     = nullptr;
+	_waveDataSize = 0;
+	_frameCount   = 0;
+	_currentFrame = 0;
+
+	if (!Open(filePath)) { return false; }
+	if (!ReadChunks())   { Close(); return false; }
+	return true;
+}
+
+/****************************************************************************
+*                       ReadFrames
+*************************************************************************//**
+*  @fn        size_t WavDecoder::ReadFrames(void* destination, size_t frameCount)
+*  @brief     Read frames in the file format (frameCount * BlockAlign bytes)
+*  @param[out] void* destination
+*  @param[in] size_t frameCount
+*  @return @@size_t read frame count (0 : end of stream)
+*****************************************************************************/
+size_t WavDecoder::ReadFrames(void* destination, size_t frameCount)
+{
+	if (!_stream.is_open() || destination == nullptr) { return 0; }
+
+	const std::uint64_t restFrames = _frameCount - _currentFrame;
+	const size_t        readFrames = static_cast<size_t>((std::min)(static_cast<std::uint64_t>(frameCount), restFrames));
+	if (readFrames == 0) { return 0; }
+
+	_stream.read(reinterpret_cast<char*>(destination), static_cast<std::streamsize>(readFrames * _format.BlockAlign));
+
+	/*-------------------------------------------------------------------
+	-              Truncated file: only the complete frames are valid
+	---------------------------------------------------------------------*/
+	const size_t resultFrames = static_cast<size_t>(_stream.gcount()) / _format.BlockAlign;
+	_currentFrame += resultFrames;
+	if (resultFrames != readFrames) { _frameCount = _currentFrame; }
+	return resultFrames;
+}
+
+/****************************************************************************
+*                       ReadFramesAsFloat
+*************************************************************************//**
+*  @fn        size_t WavDecoder::ReadFramesAsFloat(float* destination, size_t frameCount)
+*  @brief     Read frames and convert to interleaved float (frameCount * Channels floats)
+*  @param[out] float* destination
+*  @param[in] size_t frameCount
+*  @return @@size_t read frame count (0 : end of stream)
+*****************************************************************************/
+size_t WavDecoder::ReadFramesAsFloat(float* destination, size_t frameCount)
+{
+	if (!_stream.is_open() || destination == nullptr) { return 0; }
+
+	const size_t bytesPerSample = _format.BitsPerSample / 8;
+	_decodeBuffer.resize(DECODE_BUFFER_FRAME_COUNT * _format.BlockAlign);
+
+	size_t totalFrames = 0;
+	while (totalFrames < frameCount)
+	{
+		const size_t requestFrames = (std::min)(frameCount - totalFrames, DECODE_BUFFER_FRAME_COUNT);
+		const size_t readFrames    = ReadFrames(_decodeBuffer.data(), requestFrames);
+		if (readFrames == 0) { break; }
+
+		/*-------------------------------------------------------------------
+		-              Convert each sample (ignore the padding of the extensible container)
+		---------------------------------------------------------------------*/
+		const size_t   sampleCount = readFrames * _format.Channels;
+		const std::uint8_t* source = _decodeBuffer.data();
+		float* output              = destination + totalFrames * _format.Channels;
+		for (size_t i = 0; i < sampleCount; ++i)
+		{
+			output[i] = DecodeSample(source + i * bytesPerSample, _format.FormatTag, _format.BitsPerSample);
+		}
+		totalFrames += readFrames;
+	}
+	return totalFrames;
+}
+
+/****************************************************************************
+*                       SeekFrame
+*************************************************************************//**
+*  @fn        bool WavDecoder::SeekFrame(std::uint64_t frame)
+*  @brief     Move the read position (sample frame index, clamped to the frame count)
+*  @param[in] std::uint64_t frame
+*  @return @@bool
+*****************************************************************************/
+bool WavDecoder::SeekFrame(std::uint64_t frame)
+{
+	if (!_stream.is_open()) { return false; }
+
+	frame = (std::min)(frame, _frameCount);
+	_stream.clear(); // reset eof
+	_stream.seekg(static_cast<std::streamoff>(_dataOffset + frame * _format.BlockAlign), std::ios::beg);
+	if (!_stream) { return false; }
+
+	_currentFrame = frame;
+	return true;
+}
+
+/****************************************************************************
+*                       Close
+*************************************************************************//**
+*  @fn        bool WavDecoder::Close()
+*  @brief     Close Wav File
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool WavDecoder::Close()
+{
+	if (!_stream.is_open()) { return true; }
+	_stream.close();
+	return !_stream.fail();
+}
+
 #pragma region Property
+#ifdef _WIN32
 const WAVEFORMATEX& WavDecoder::GetFileFormatEx() const
 {
 	return this->_waveFormatEx;
 }
+#endif
 
 const std::wstring& WavDecoder::GetFilePath() const
 {
 	return this->_filePath;
 }
 
-const std::shared_ptr<BYTE[]>&  WavDecoder::GetWaveData() const
+const std::shared_ptr<std::uint8_t[]>&  WavDecoder::GetWaveData() const
 {
 	return _waveData;
 }
 
-const size_t WavDecoder::GetWaveSize() const
+size_t WavDecoder::GetWaveSize() const
 {
 	return this->_waveDataSize;
 }
@@ -103,52 +257,170 @@ const size_t WavDecoder::GetWaveSize() const
 *****************************************************************************/
 bool WavDecoder::Open(const std::wstring& filePath)
 {
-	MMIOINFO mmioInfo;
-	memset(&mmioInfo, 0, sizeof(MMIOINFO));
+	_stream.open(std::filesystem::path(filePath), std::ios::in | std::ios::binary);
+	if (!_stream.is_open())
+	{
+		ReportError(L"can't open wavFile");
+		return false;
+	}
+
+	_filePath = filePath;
+	return true;
+}
 
+/****************************************************************************
+*                       ReadChunks
+*************************************************************************//**
+*  @fn        bool WavDecoder::ReadChunks()
+*  @brief     Check RIFF / WAVE header, read fmt chunk and find data chunk.
+*             Unknown chunks (LIST, fact, cue ...) are skipped.
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool WavDecoder::ReadChunks()
+{
 	/*-------------------------------------------------------------------
-	-              Is Wav File Path
+	-              File size (to clamp the broken chunk size)
 	---------------------------------------------------------------------*/
-	std::wstring extension = GetExtension(filePath);
-	if (extension != L"wav")
+	_stream.seekg(0, std::ios::end);
+	const std::uint64_t fileSize = static_cast<std::uint64_t>(_stream.tellg());
+	_stream.seekg(0, std::ios::beg);
+
+	/*-------------------------------------------------------------------
+	-              Check Wave Header
+	---------------------------------------------------------------------*/
+	std::uint8_t header[12] = {};
+	if (!_stream.read(reinterpret_cast<char*>(header), sizeof(header)) || !IsFourCC(header, "RIFF") || !IsFourCC(header + 8, "WAVE"))
 	{
-		MessageBox(NULL, L"can't read wavFile", L"Warning", MB_ICONWARNING);
+		ReportError(L"different chunk format.");
 		return false;
 	}
 
 	/*-------------------------------------------------------------------
-	-              File Open
+	-              Search fmt and data chunk
 	---------------------------------------------------------------------*/
-	LPWSTR path = (LPWSTR)filePath.c_str();
-	if (!(_handle = mmioOpen(path, &mmioInfo, MMIO_READ)))
+	bool          hasFormat = false;
+	bool          hasData   = false;
+	std::uint64_t dataSize  = 0;
+	std::uint64_t position  = sizeof(header);
+	while (position + 8 <= fileSize && !(hasFormat && hasData))
+	{
+		std::uint8_t chunkHeader[8] = {};
+		_stream.seekg(static_cast<std::streamoff>(position), std::ios::beg);
+		if (!_stream.read(reinterpret_cast<char*>(chunkHeader), sizeof(chunkHeader))) { break; }
+
+		const std::uint64_t chunkSize = ReadLE32(chunkHeader + 4);
+		const std::uint64_t bodyStart = position + 8;
+
+		if (IsFourCC(chunkHeader, "fmt "))
+		{
+			std::vector<std::uint8_t> formatChunk(static_cast<size_t>((std::min)(chunkSize, fileSize - bodyStart)));
+			_stream.read(reinterpret_cast<char*>(formatChunk.data()), static_cast<std::streamsize>(formatChunk.size()));
+			if (!CreateWavFormat(formatChunk.data(), static_cast<size_t>(_stream.gcount()))) { return false; }
+			hasFormat = true;
+		}
+		else if (IsFourCC(chunkHeader, "data"))
+		{
+			_dataOffset = bodyStart;
+			dataSize    = (std::min)(chunkSize, fileSize - bodyStart);
+			hasData     = true;
+		}
+		position = bodyStart + chunkSize + (chunkSize & 1); // chunks are word aligned
+	}
+
+	if (!hasFormat || !hasData)
 	{
-		MessageBox(NULL, L"can't create MMIO.", L"Warning", MB_ICONWARNING);
+		ReportError(L"couldn't find fmt or data chunk.");
 		return false;
 	}
 
-	_filePath = filePath;
-	return true;
+	/*-------------------------------------------------------------------
+	-              Move to the top of the wave data
+	---------------------------------------------------------------------*/
+	_frameCount   = dataSize / _format.BlockAlign;
+	_waveDataSize = static_cast<size_t>(_frameCount * _format.BlockAlign);
+	_stream.clear();
+	return SeekFrame(0);
 }
 
 /****************************************************************************
-*                       Open
+*                       CreateWavFormat
 *************************************************************************//**
-*  @fn        bool WavDecoder::CreateWaveFormatEx(size_t formatChunk)
-*  @brief     Create Wave Format Ex
-*  @param[in] size_t formatChunk
+*  @fn        bool WavDecoder::CreateWavFormat(const std::uint8_t* formatChunk, size_t formatChunkSize)
+*  @brief     Create WavFormat (and WAVEFORMATEX for XAudio2)
+*  @param[in] const std::uint8_t* formatChunk
+*  @param[in] size_t formatChunkSize
 *  @return @@bool
 *****************************************************************************/
-bool WavDecoder::CreateWaveFormatEx(size_t formatChunk)
+bool WavDecoder::CreateWavFormat(const std::uint8_t* formatChunk, size_t formatChunkSize)
 {
-	LONG readSize = -1;
-	readSize = static_cast<LONG>(mmioRead(_handle, reinterpret_cast<HPSTR>(&_waveFormatEx), static_cast<LONG>(formatChunk)));
+	if (formatChunkSize < 16)
+	{
+		ReportError(L"Loaded sizes do not match");
+		return false;
+	}
+
+	WavFormat format = {};
+	format.FormatTag             = ReadLE16(formatChunk + 0);
+	format.Channels              = ReadLE16(formatChunk + 2);
+	format.SamplesPerSecond      = ReadLE32(formatChunk + 4);
+	format.AverageBytesPerSecond = ReadLE32(formatChunk + 8);
+	format.BlockAlign            = ReadLE16(formatChunk + 12);
+	format.BitsPerSample         = ReadLE16(formatChunk + 14);
+	format.ValidBitsPerSample    = format.BitsPerSample;
 
-	if (readSize != formatChunk)
+	/*-------------------------------------------------------------------
+	-              WAVE_FORMAT_EXTENSIBLE : the first 2 bytes of the sub format GUID is the format tag
+	---------------------------------------------------------------------*/
+	if (format.FormatTag == WAV_FORMAT_EXTENSIBLE)
 	{
-		MessageBox(NULL, L"Loaded sizes do not match", L"Warning", MB_ICONWARNING);
+		if (formatChunkSize < 40)
+		{
+			ReportError(L"Loaded sizes do not match");
+			return false;
+		}
+		format.IsExtensible       = true;
+		format.ValidBitsPerSample = ReadLE16(formatChunk + 18);
+		format.ChannelMask        = ReadLE32(formatChunk + 20);
+		format.FormatTag          = ReadLE16(formatChunk + 24);
+		if (format.ValidBitsPerSample == 0) { format.ValidBitsPerSample = format.BitsPerSample; }
+	}
+
+	/*-------------------------------------------------------------------
+	-              Check the supported format
+	---------------------------------------------------------------------*/
+	const bool isPCM   = format.FormatTag == WAV_FORMAT_PCM
+		&& (format.BitsPerSample == 8 || format.BitsPerSample == 16 || format.BitsPerSample == 24 || format.BitsPerSample == 32);
+	const bool isFloat = format.FormatTag == WAV_FORMAT_IEEE_FLOAT
+		&& (format.BitsPerSample == 32 || format.BitsPerSample == 64);
+	if ((!isPCM && !isFloat) || format.Channels == 0 || format.SamplesPerSecond == 0)
+	{
+		ReportError(L"unsupported wave format.");
 		return false;
 	}
 
+	const std::uint16_t blockAlign = static_cast<std::uint16_t>(format.Channels * (format.BitsPerSample / 8));
+	if (format.BlockAlign != blockAlign)
+	{
+		ReportError(L"invalid block align.");
+		return false;
+	}
+	format.AverageBytesPerSecond = format.SamplesPerSecond * format.BlockAlign;
+	_format = format;
+
+#ifdef _WIN32
+	/*-------------------------------------------------------------------
+	-              XAudio2 format (extensible is resolved to the plain format tag)
+	---------------------------------------------------------------------*/
+	ZeroMemory(&_waveFormatEx, sizeof(_waveFormatEx));
+	_waveFormatEx.wFormatTag      = format.FormatTag;
+	_waveFormatEx.nChannels       = format.Channels;
+	_waveFormatEx.nSamplesPerSec  = format.SamplesPerSecond;
+	_waveFormatEx.nAvgBytesPerSec = format.AverageBytesPerSecond;
+	_waveFormatEx.nBlockAlign     = format.BlockAlign;
+	_waveFormatEx.wBitsPerSample  = format.BitsPerSample;
+	_waveFormatEx.cbSize          = 0;
+#endif
 	return true;
 }
 
@@ -156,73 +428,59 @@ bool WavDecoder::CreateWaveFormatEx(size_t formatChunk)
 *                       CreateWaveData
 *************************************************************************//**
 *  @fn        bool WavDecoder::CreateWaveData(size_t dataSize)
-*  @brief     CreateWaveData
+*  @brief     Read the whole wave data. 64bit float is converted to 32bit float (XAudio2 doesn't support it)
 *  @param[in] size_t dataSize
 *  @return @@bool
 *****************************************************************************/
 bool WavDecoder::CreateWaveData(size_t dataSize)
 {
-	_waveDataSize = dataSize;
-	std::unique_ptr<BYTE[]> data = std::make_unique<BYTE[]>(dataSize);
+	std::shared_ptr<std::uint8_t[]> data(new std::uint8_t[dataSize]);
 
-	if (mmioRead(_handle, reinterpret_cast<HPSTR>(data.get()), (LONG)_waveDataSize) != static_cast<LONG>(_waveDataSize))
+	const size_t frameCount = static_cast<size_t>(_frameCount);
+	if (ReadFrames(data.get(), frameCount) != frameCount)
 	{
-		MessageBox(NULL, L"couldn't read wave data.", L"Warning", MB_ICONWARNING);
+		ReportError(L"couldn't read wave data.");
 		return false;
 	}
 
-	_waveData = std::move(data);
-	return true;
-}
-
-/****************************************************************************
-*                       CheckChunk
-*************************************************************************//**
-*  @fn        bool WavDecoder::CheckChunk()
-*  @brief     Check Chunk
-*  @param[in] void
-*  @return @@bool
-*****************************************************************************/
-bool WavDecoder::CheckChunk(MMCKINFO* chunkNext, MMCKINFO* chunkPrev, char c0, char c1, char c2, char c3, UINT flag)
-{
-	FOURCC* fourcc = nullptr;
-	if (flag == MMIO_FINDRIFF)  
-	{ 
-		fourcc  = &chunkNext->fccType;
-		*fourcc = mmioFOURCC(c0, c1, c2, c3);
-	}
-	if (flag == MMIO_FINDCHUNK) 
-	{ 
-		fourcc  = &chunkNext->ckid; 
-		*fourcc = mmioFOURCC(c0, c1, c2, c3);
-	}
-	if (fourcc == nullptr)
+	if (_format.FormatTag == WAV_FORMAT_IEEE_FLOAT && _format.BitsPerSample == 64)
 	{
-		MessageBox(NULL, L"different chunk format.", L"Warning", MB_ICONWARNING);
-		return false;
+		const size_t sampleCount = frameCount * _format.Channels;
+		for (size_t i = 0; i < sampleCount; ++i)
+		{
+			const float value = DecodeSample(data.get() + i * sizeof(double), WAV_FORMAT_IEEE_FLOAT, 64);
+			std::memcpy(data.get() + i * sizeof(float), &value, sizeof(float)); // output never overtakes input
+		}
+		dataSize /= 2;
+		_format.BitsPerSample         = _format.ValidBitsPerSample = 32;
+		_format.BlockAlign            = static_cast<std::uint16_t>(_format.BlockAlign / 2);
+		_format.AverageBytesPerSecond = _format.SamplesPerSecond * _format.BlockAlign;
+#ifdef _WIN32
+		_waveFormatEx.wBitsPerSample  = _format.BitsPerSample;
+		_waveFormatEx.nBlockAlign     = _format.BlockAlign;
+		_waveFormatEx.nAvgBytesPerSec = _format.AverageBytesPerSecond;
+#endif
 	}
 
-	MMRESULT result = mmioDescend(_handle, chunkNext, chunkPrev, flag);
-	if (result != MMSYSERR_NOERROR)
-	{
-		return false;
-	}
+	_waveDataSize = dataSize;
+	_waveData     = std::move(data);
 	return true;
 }
+
 /****************************************************************************
-*                       Close
+*                       ReportError
 *************************************************************************//**
-*  @fn        bool WavDecoder::Close()
-*  @brief     Close Wav File
-*  @param[in] void
-*  @return @@bool
+*  @fn        void WavDecoder::ReportError(const wchar_t* message) const
+*  @brief     Show the warning message
+*  @param[in] const wchar_t* message
+*  @return @@void
 *****************************************************************************/
-bool WavDecoder::Close()
+void WavDecoder::ReportError(const wchar_t* message) const
 {
-	if (_handle == nullptr) { return true; }
-	if (mmioClose(_handle, 0) == MMIOERR_CANNOTWRITE) { return false; }
-
-	_handle = nullptr;
-	return true;
+#ifdef _WIN32
+	MessageBox(NULL, message, L"Warning", MB_ICONWARNING);
+#else
+	std::fwprintf(stderr, L"Warning: %ls\n", message);
+#endif
 }
-#pragma endregion Private Function
\ No newline at end of file
+#pragma endregion Private Function
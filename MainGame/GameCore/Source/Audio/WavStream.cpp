@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   WavStream.cpp
+///             @brief  Chunked wave playback data (ring of fixed size buffers)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/WavStream.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       Open
+*************************************************************************//**
+*  @fn        bool WavStream::Open(const std::wstring& filePath, size_t bufferByteSize, size_t bufferCount, bool isLoop)
+*  @brief     Parse the wave header and allocate the ring buffers
+*  @param[in] const std::wstring& filePath
+*  @param[in] size_t bufferByteSize (rounded down to the frame size)
+*  @param[in] size_t bufferCount (>= 2)
+*  @param[in] bool isLoop
+*  @return 　　bool
+*****************************************************************************/
+bool WavStream::Open(const std::wstring& filePath, size_t bufferByteSize, size_t bufferCount, bool isLoop)
+{
+	Close();
+	if (!_decoder.OpenStream(filePath)) { return false; }
+
+	/*-------------------------------------------------------------------
+	-              A buffer never splits a frame
+	---------------------------------------------------------------------*/
+	const size_t blockAlign = _decoder.GetFormat().BlockAlign;
+	_bufferByteSize = (std::max)(bufferByteSize / blockAlign, static_cast<size_t>(1)) * blockAlign;
+	_buffers.resize((std::max)(bufferCount, static_cast<size_t>(2)));
+	for (auto& buffer : _buffers) { buffer.resize(_bufferByteSize); }
+
+	_bufferIndex = 0;
+	_isLoop      = isLoop;
+	return true;
+}
+
+/****************************************************************************
+*                       ReadNextBuffer
+*************************************************************************//**
+*  @fn        const std::uint8_t* WavStream::ReadNextBuffer(size_t& outByteSize)
+*  @brief     Decode the next chunk into the oldest buffer of the ring.
+*             When loop is enabled, the buffer continues from the top of the track.
+*  @param[out] size_t& outByteSize (0 : end of stream)
+*  @return 　　const std::uint8_t* (valid until the ring comes around)
+*****************************************************************************/
+const std::uint8_t* WavStream::ReadNextBuffer(size_t& outByteSize)
+{
+	outByteSize = 0;
+	if (_buffers.empty()) { return nullptr; }
+
+	std::vector<std::uint8_t>& buffer = _buffers[_bufferIndex];
+	const size_t blockAlign  = _decoder.GetFormat().BlockAlign;
+	const size_t frameCount  = _bufferByteSize / blockAlign;
+
+	size_t readFrames = 0;
+	while (readFrames < frameCount)
+	{
+		const size_t frames = _decoder.ReadFrames(buffer.data() + readFrames * blockAlign, frameCount - readFrames);
+		readFrames += frames;
+		if (frames != 0) { continue; }
+
+		/*-------------------------------------------------------------------
+		-              End of the track
+		---------------------------------------------------------------------*/
+		if (!_isLoop || _decoder.GetFrameCount() == 0 || !_decoder.SeekFrame(0)) { break; }
+	}
+	if (readFrames == 0) { return nullptr; }
+
+	outByteSize  = readFrames * blockAlign;
+	_bufferIndex = (_bufferIndex + 1) % _buffers.size();
+	return buffer.data();
+}
+
+/****************************************************************************
+*                       SeekFrame
+*************************************************************************//**
+*  @fn        bool WavStream::SeekFrame(std::uint64_t frame)
+*  @brief     Move the decode position (sample frame). The buffers already read are not changed.
+*  @param[in] std::uint64_t frame
+*  @return 　　bool
+*****************************************************************************/
+bool WavStream::SeekFrame(std::uint64_t frame)
+{
+	return _decoder.SeekFrame(frame);
+}
+
+/****************************************************************************
+*                       SeekTime
+*************************************************************************//**
+*  @fn        bool WavStream::SeekTime(double second)
+*  @brief     Move the decode position (second). For the sync with the motion frame (frame / 30.0)
+*  @param[in] double second
+*  @return 　　bool
+*****************************************************************************/
+bool WavStream::SeekTime(double second)
+{
+	if (second < 0.0) { second = 0.0; }
+	return _decoder.SeekFrame(static_cast<std::uint64_t>(second * _decoder.GetFormat().SamplesPerSecond + 0.5));
+}
+
+/****************************************************************************
+*                       Close
+*************************************************************************//**
+*  @fn        void WavStream::Close()
+*  @brief     Close the file and release the buffers
+*  @param[in] void
+*  @return 　　void
+*****************************************************************************/
+void WavStream::Close()
+{
+	_decoder.Close();
+	_buffers.clear();
+	_buffers.shrink_to_fit();
+	_bufferByteSize = 0;
+	_bufferIndex    = 0;
+}
+#pragma endregion Public Function
@@ -473,4 +473,90 @@ Float4x4 Camera::GetProjectionMatrix4x4f() const
 {
 	return _proj;
 }
+
+/****************************************************************************
+*                       GetFrustumPlanes
+*************************************************************************//**
+*  @fn        FrustumPlanes Camera::GetFrustumPlanes() const
+*  @brief     World space frustum planes of the current view and projection
+*  @param[in] void
+*  @return @@FrustumPlanes
+*****************************************************************************/
+FrustumPlanes Camera::GetFrustumPlanes() const
+{
+	Matrix4 viewProjection = GetViewMatrix() * GetProjectionMatrix();
+	return ExtractFrustumPlanes(viewProjection.ToFloat4x4());
+}
+
+/****************************************************************************
+*                       ExtractFrustumPlanes
+*************************************************************************//**
+*  @fn        FrustumPlanes Camera::ExtractFrustumPlanes(const gm::Float4x4& viewProjection)
+*  @brief     Extract the planes from the columns of the matrix (Gribb / Hartmann).
+*             The matrix is for the row vector (clip = p * viewProjection), and the clip z range is [0, w] (Direct3D).
+*             The planes of a world * view * projection matrix are in the model space.
+*  @param[in] const gm::Float4x4& viewProjection
+*  @return @@FrustumPlanes
+*****************************************************************************/
+FrustumPlanes Camera::ExtractFrustumPlanes(const Float4x4& viewProjection)
+{
+	const auto& m = viewProjection.m;
+	const float column[4][4] =
+	{
+		{ m[0][0], m[1][0], m[2][0], m[3][0] },
+		{ m[0][1], m[1][1], m[2][1], m[3][1] },
+		{ m[0][2], m[1][2], m[2][2], m[3][2] },
+		{ m[0][3], m[1][3], m[2][3], m[3][3] }
+	};
+
+	float planes[FrustumPlanes::PLANE_COUNT][4];
+	for (int i = 0; i < 4; ++i)
+	{
+		planes[0][i] = column[3][i] + column[0][i]; // left   : -w <= x
+		planes[1][i] = column[3][i] - column[0][i]; // right  :  x <= w
+		planes[2][i] = column[3][i] + column[1][i]; // bottom : -w <= y
+		planes[3][i] = column[3][i] - column[1][i]; // top    :  y <= w
+		planes[4][i] = column[2][i];                // near   :  0 <= z
+		planes[5][i] = column[3][i] - column[2][i]; // far    :  z <= w
+	}
+
+	FrustumPlanes result;
+	for (int i = 0; i < FrustumPlanes::PLANE_COUNT; ++i)
+	{
+		const float length  = sqrtf(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+		const float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+		result.Planes[i] = Float4(planes[i][0] * inverse, planes[i][1] * inverse, planes[i][2] * inverse, planes[i][3] * inverse);
+	}
+	return result;
+}
+
+/****************************************************************************
+*                       GetScreenRay
+*************************************************************************//**
+*  @fn        void Camera::GetScreenRay(float screenX, float screenY, gm::Float3& outOrigin, gm::Float3& outDirection) const
+*  @brief     World space ray through the screen pixel (for the mouse picking, perspective lens only).
+*             The screen origin is the top left, and the direction is normalized.
+*  @param[in] float screenX (pixel)
+*  @param[in] float screenY (pixel)
+*  @param[out]gm::Float3& outOrigin
+*  @param[out]gm::Float3& outDirection
+*  @return @@void
+*****************************************************************************/
+void Camera::GetScreenRay(float screenX, float screenY, Float3& outOrigin, Float3& outDirection) const
+{
+	/*-------------------------------------------------------------------
+	-          Screen -> NDC -> view direction at z = 1
+	---------------------------------------------------------------------*/
+	const float ndcX  = 2.0f * screenX / static_cast<float>(Screen::GetScreenWidth())  - 1.0f;
+	const float ndcY  = 1.0f - 2.0f * screenY / static_cast<float>(Screen::GetScreenHeight());
+	const float viewX = ndcX * 0.5f * GetNearWindowWidth () / frustum.NearZ;
+	const float viewY = ndcY * 0.5f * GetNearWindowHeight() / frustum.NearZ;
+
+	/*-------------------------------------------------------------------
+	-          direction = look + viewX * right + viewY * up
+	---------------------------------------------------------------------*/
+	Vector3 direction = GetLook() + GetRight() * viewX + GetUp() * viewY;
+	outOrigin    = _position;
+	outDirection = Normalize(direction).ToFloat3();
+}
 #pragma endregion Property
\ No newline at end of file
@@ -27,7 +27,8 @@ Collider2D::Collider2D()
 
 Collider2D::Collider2D(const Collider2D& collider)
 {
-	this->shapeType2D = collider.shapeType2D;
+	this->shapeType2D    = collider.shapeType2D;
+	this->centerPosition = collider.centerPosition;
 	switch (this->shapeType2D)
 	{
 	case ColliderShape2D::Circle:
@@ -135,6 +136,7 @@ Collider3D::Collider3D(const Collider3D& collider)
 Collider3D Collider3D::CreateBoxCollider(const Float3& centerPosition, const Float3& boxSize)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Box;
 	collider.box.Center  = centerPosition;
 	collider.box.Extents = Float3(boxSize.x / 2, boxSize.y / 2, boxSize.z / 2);
 	return collider;
@@ -154,6 +156,7 @@ Collider3D Collider3D::CreateBoxCollider(const Float3& centerPosition, const Flo
 Collider3D Collider3D::CreateBoxCollider(const Float3& centerPosition, float width, float height, float depth)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Box;
 	collider.box.Center  = centerPosition;
 	collider.box.Extents = Float3(width / 2, height / 2, depth / 2);
 	return collider;
@@ -172,6 +175,7 @@ Collider3D Collider3D::CreateBoxCollider(const Float3& centerPosition, float wid
 Collider3D Collider3D::CreateOrientedBoxCollider(const Float3& centerPosition, const Float3& boxSize, const Float4& rotation)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::OrientedBox;
 	collider.orientedBox.Center      = centerPosition;
 	collider.orientedBox.Extents     = Float3 (boxSize.x / 2, boxSize.y / 2, boxSize.z / 2);
 	collider.orientedBox.Orientation = rotation; // unit rotation quaternion (object->world).
@@ -190,6 +194,7 @@ Collider3D Collider3D::CreateOrientedBoxCollider(const Float3& centerPosition, c
 Collider3D Collider3D::CreateSphereCollider(const Float3& centerPosition, float radius)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Sphere;
 	collider.sphere.Center = centerPosition;
 	collider.sphere.Radius = radius;
 	return collider;
@@ -210,12 +215,15 @@ Collider3D Collider3D::CreateSphereCollider(const Float3& centerPosition, float
 Collider3D Collider3D::CreateFrustumCollider(const Float3& originPosition, const Float4& orientation, const Float4& rltbSlope, float nearPlane, float farPlane)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Frustum;
 	collider.frustum.Origin      = originPosition;
 	collider.frustum.Orientation = orientation;
 	collider.frustum.RightSlope  = rltbSlope.x; // (z axis / x axis)
 	collider.frustum.LeftSlope   = rltbSlope.y; // (-z axis / x axis)
 	collider.frustum.TopSlope    = rltbSlope.z; // (z axis / y axis)
 	collider.frustum.BottomSlope = rltbSlope.w; // (-z axis / y axis)
+	collider.frustum.Near        = nearPlane;
+	collider.frustum.Far         = farPlane;
 	return collider;
 }
 
@@ -237,12 +245,15 @@ Collider3D Collider3D::CreateFrustumCollider(const Float3& originPosition, const
 Collider3D Collider3D::CreateFrustumCollider(const Float3& originPosition, const Float4& orientation, float rightSlope, float leftSlope, float topSlope, float bottomSlope, float nearPlane, float farPlane)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Frustum;
 	collider.frustum.Origin      = originPosition;
 	collider.frustum.Orientation = orientation;
 	collider.frustum.RightSlope  = rightSlope;
 	collider.frustum.LeftSlope   = leftSlope;
 	collider.frustum.TopSlope    = topSlope;
 	collider.frustum.BottomSlope = bottomSlope;
+	collider.frustum.Near        = nearPlane;
+	collider.frustum.Far         = farPlane;
 	return collider;
 }
 
@@ -259,6 +270,7 @@ Collider3D Collider3D::CreateFrustumCollider(const Float3& originPosition, const
 Collider3D Collider3D::CreatePlaneCollider(const Float3& pointA, const Float3& pointB, const Float3& pointC)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Plane;
 	collider.plane.CreatePlane(pointA, pointB, pointC);
 	return collider;
 }
@@ -275,6 +287,7 @@ Collider3D Collider3D::CreatePlaneCollider(const Float3& pointA, const Float3& p
 Collider3D Collider3D::CreatePlaneCollider(const Float3& planePoint, const Float3& planeNormal)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Plane;
 	collider.plane.CreatePlane(planePoint, planeNormal);
 	return collider;
 }
@@ -290,6 +303,7 @@ Collider3D Collider3D::CreatePlaneCollider(const Float3& planePoint, const Float
 Collider3D Collider3D::CreatePlaneCollider(const DirectX::BoundingTriangle& triangle)
 {
 	Collider3D collider;
+	collider.shapeType3D = ColliderShape3D::Plane;
 	collider.plane.CreatePlane(triangle);
 	return collider;
 }
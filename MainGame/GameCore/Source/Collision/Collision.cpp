@@ -10,6 +10,8 @@
 #include "GameCore/Include/Collision/Collision.hpp"
 #include "GameCore/Include/Collision/Collider.hpp"
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <Windows.h>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +22,71 @@
 #pragma warning(disable : 4805)
 
 using namespace gm;
+
+namespace
+{
+	/****************************************************************************
+	*							SegmentVsBox
+	*************************************************************************//**
+	*  @fn        bool SegmentVsBox(const Float2& origin, const Float2& displacement, const Float2& boxMin, const Float2& boxMax, float& outTime)
+	*  @brief     Slab test of the segment origin + displacement * t (t = [0, 1]) against the box
+	*  @return    bool
+	*****************************************************************************/
+	bool SegmentVsBox(const Float2& origin, const Float2& displacement, const Float2& boxMin, const Float2& boxMax, float& outTime)
+	{
+		const float o[2]     = { origin.x      , origin.y };
+		const float d[2]     = { displacement.x, displacement.y };
+		const float minV[2]  = { boxMin.x      , boxMin.y };
+		const float maxV[2]  = { boxMax.x      , boxMax.y };
+
+		float tMin = 0.0f;
+		float tMax = 1.0f;
+		for (int axis = 0; axis < 2; ++axis)
+		{
+			if (std::fabs(d[axis]) < FLT_EPSILON)
+			{
+				if (o[axis] < minV[axis] || o[axis] > maxV[axis]) { return false; }
+				continue;
+			}
+			const float inverse = 1.0f / d[axis];
+			float t1 = (minV[axis] - o[axis]) * inverse;
+			float t2 = (maxV[axis] - o[axis]) * inverse;
+			if (t1 > t2) { std::swap(t1, t2); }
+			tMin = (std::max)(tMin, t1);
+			tMax = (std::min)(tMax, t2);
+			if (tMin > tMax) { return false; }
+		}
+		outTime = tMin;
+		return true;
+	}
+
+	/****************************************************************************
+	*							SegmentVsCircle
+	*************************************************************************//**
+	*  @fn        bool SegmentVsCircle(const Float2& origin, const Float2& displacement, const Float2& center, float radius, float& outTime)
+	*  @brief     First time (t = [0, 1]) the segment origin + displacement * t enters the circle
+	*  @return    bool
+	*****************************************************************************/
+	bool SegmentVsCircle(const Float2& origin, const Float2& displacement, const Float2& center, float radius, float& outTime)
+	{
+		const float mx = origin.x - center.x;
+		const float my = origin.y - center.y;
+		const float c  = mx * mx + my * my - radius * radius;
+		if (c < 0.0f) { outTime = 0.0f; return true; } // already overlapped
+
+		const float a = displacement.x * displacement.x + displacement.y * displacement.y;
+		const float b = mx * displacement.x + my * displacement.y;
+		if (a <= 0.0f || b >= 0.0f) { return false; } // not moving or moving away
+
+		const float discriminant = b * b - a * c;
+		if (discriminant < 0.0f) { return false; }
+
+		const float t = (-b - std::sqrt(discriminant)) / a;
+		if (t > 1.0f) { return false; }
+		outTime = (std::max)(t, 0.0f);
+		return true;
+	}
+}
 //////////////////////////////////////////////////////////////////////////////////
 //								Implement
 //////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +162,54 @@ bool Collision::IsContainedObjectInFrustum(const Collider3D& frustum, const Coll
 	};
 	return functionList[static_cast<int>(object.shapeType3D)](frustum, object);
 }
+/****************************************************************************
+*							OnSweepCollision2D
+*************************************************************************//**
+*  @fn        bool Collision::OnSweepCollision2D(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+*  @brief     Continuous collider 2D detection. first moves from its current position
+*             by displacement during the frame, and second is at rest.
+*             (When both move, pass first.displacement - second.displacement)
+*  @param[in] const Collider2D& first (position at the beginning of the frame)
+*  @param[in] const gm::Float2& displacement
+*  @param[in] const Collider2D& second
+*  @param[out]float& outTimeOfImpact (0 - 1: ratio of the displacement at the first contact)
+*  @return    bool
+*****************************************************************************/
+bool Collision::OnSweepCollision2D(const Collider2D& first, const Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+{
+	static bool(* const functionList[(int)ColliderShape2D::MAX_SHAPE_COUNT][(int)ColliderShape2D::MAX_SHAPE_COUNT])
+		(const Collider2D&, const Float2&, const Collider2D&, float&) =
+	{
+		{Sweep_Circle_vs_Circle, Sweep_Circle_vs_Rect},
+		{Sweep_Rect_vs_Circle,   Sweep_Rect_vs_Rect},
+	};
+
+	return functionList[static_cast<int>(first.shapeType2D)][static_cast<int>(second.shapeType2D)](first, displacement, second, outTimeOfImpact);
+}
+
+/****************************************************************************
+*							GetSweptBounds2D
+*************************************************************************//**
+*  @fn        Collider2D Collision::GetSweptBounds2D(const Collider2D& collider, const gm::Float2& displacement)
+*  @brief     Rectangle enclosing the collider over the whole displacement (for the broad phase)
+*  @param[in] const Collider2D& collider (position at the beginning of the frame)
+*  @param[in] const gm::Float2& displacement
+*  @return    Collider2D (rectangle)
+*****************************************************************************/
+Collider2D Collision::GetSweptBounds2D(const Collider2D& collider, const Float2& displacement)
+{
+	const float halfWidth  = collider.shapeType2D == ColliderShape2D::Circle ? collider.circle.radius : collider.rectangle.width  / 2;
+	const float halfHeight = collider.shapeType2D == ColliderShape2D::Circle ? collider.circle.radius : collider.rectangle.height / 2;
+
+	const float left   = (std::min)(collider.centerPosition.x, collider.centerPosition.x + displacement.x) - halfWidth;
+	const float right  = (std::max)(collider.centerPosition.x, collider.centerPosition.x + displacement.x) + halfWidth;
+	const float bottom = (std::min)(collider.centerPosition.y, collider.centerPosition.y + displacement.y) - halfHeight;
+	const float top    = (std::max)(collider.centerPosition.y, collider.centerPosition.y + displacement.y) + halfHeight;
+
+	Float2 center((left + right) / 2, (bottom + top) / 2);
+	return Collider2D::CreateRectangleCollider(center, right - left, top - bottom);
+}
+
 #pragma endregion Public Function
 
 #pragma region Private Function
@@ -131,52 +246,30 @@ bool Collision::Circle_vs_Circle(const Collider2D& first, const Collider2D& seco
 *****************************************************************************/
 bool Collision::Rect_vs_Circle(const Collider2D& first, const Collider2D& second)
 {
-	const Float2 rectLeftTop(first.centerPosition.x - first.rectangle.width / 2, first.centerPosition.y + first.rectangle.height / 2);
-	const Float2 rectRightBottom (first.centerPosition.x  + first. rectangle.width / 2, first. centerPosition.y - first.rectangle.height / 2);
-	const Float2 circlePos    = Float2(second.centerPosition.x, second.centerPosition.y);
-	const Float2 dLeftTop     = Float2(circlePos.x - rectLeftTop.x,     circlePos.y - rectLeftTop.y);
-	const Float2 dRightBottom = Float2(circlePos.x - rectRightBottom.x, circlePos.y - rectRightBottom.y);
-	const float radius        = second.circle.radius;
+	const Float2 rectLeftBottom(first.centerPosition.x - first.rectangle.width / 2, first.centerPosition.y - first.rectangle.height / 2);
+	const Float2 rectRightTop  (first.centerPosition.x + first.rectangle.width / 2, first.centerPosition.y + first.rectangle.height / 2);
+	const Float2 circlePos     = Float2(second.centerPosition.x, second.centerPosition.y);
+	const float radius         = second.circle.radius;
 
 	/*-------------------------------------------------------------------
-	-        Rectangle Collision Detection
-	---------------------------------------------------------------------*/
-	if(rectLeftTop.x - radius > circlePos.x || rectRightBottom.x + radius < circlePos.x  ||
-		rectLeftTop.y < circlePos.y || rectRightBottom.y > circlePos.y)
-	{
-		return false;
-	}
-	/*-------------------------------------------------------------------
-	-        Upper Left Collision Detection
-	---------------------------------------------------------------------*/
-	if(rectLeftTop.x > circlePos.x && rectLeftTop.y < circlePos.y && 
-		!(dLeftTop.x * dLeftTop.x + dLeftTop.y * dLeftTop.y < radius * radius))
-	{
-		return false;
-	}
-	/*-------------------------------------------------------------------
-	-        Upper Right Collision Detection
+	-        Rectangle expanded by the radius
 	---------------------------------------------------------------------*/
-	if (rectRightBottom.x < circlePos.x && rectRightBottom.y < circlePos.y &&
-		!(dRightBottom.x * dRightBottom.x + dLeftTop.y * dLeftTop.y < radius * radius))
+	if (circlePos.x < rectLeftBottom.x - radius || circlePos.x > rectRightTop.x + radius ||
+		circlePos.y < rectLeftBottom.y - radius || circlePos.y > rectRightTop.y + radius)
 	{
 		return false;
 	}
 	/*-------------------------------------------------------------------
-	-        Lower Left Collision Detection
+	-        Corner region : the distance to the corner decides
+	-        (the same condition as OnSweepCollision2D with no displacement)
 	---------------------------------------------------------------------*/
-	if (rectLeftTop.x > circlePos.x && rectRightBottom.y > circlePos.y &&
-		!(dLeftTop.x * dLeftTop.x + dRightBottom.y * dRightBottom.y < radius * radius))
+	const bool outsideX = circlePos.x < rectLeftBottom.x || circlePos.x > rectRightTop.x;
+	const bool outsideY = circlePos.y < rectLeftBottom.y || circlePos.y > rectRightTop.y;
+	if (outsideX && outsideY)
 	{
-		return false;
-	}
-	/*-------------------------------------------------------------------
-	-        Lower Right Collision Detection
-	---------------------------------------------------------------------*/
-	if (rectRightBottom.x < circlePos.x && rectRightBottom.y > circlePos.y &&
-		!(dRightBottom.x * dRightBottom.x + dRightBottom.y * dRightBottom.y < radius * radius))
-	{
-		return false;
+		const float dx = circlePos.x - (circlePos.x < rectLeftBottom.x ? rectLeftBottom.x : rectRightTop.x);
+		const float dy = circlePos.y - (circlePos.y < rectLeftBottom.y ? rectLeftBottom.y : rectRightTop.y);
+		return dx * dx + dy * dy - radius * radius < 0.0f;
 	}
 	return true;
 }
@@ -206,6 +299,107 @@ bool Collision::Rect_vs_Rect(const Collider2D& first, const Collider2D& second)
 	if (firstRightBottom.y > secondLeftTop.y || firstLeftTop.y < secondRightBottom.y) { return false; }
 	return true;
 }
+/****************************************************************************
+*							Sweep_Circle_vs_Circle
+*************************************************************************//**
+*  @fn        bool Collision::Sweep_Circle_vs_Circle(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+*  @brief     Swept circle vs circle (segment vs circle of radius first.radius + second.radius)
+*  @param[in] const Collider2D& first
+*  @param[in] const gm::Float2& displacement
+*  @param[in] const Collider2D& second
+*  @param[out]float& outTimeOfImpact
+*  @return    bool
+*****************************************************************************/
+bool Collision::Sweep_Circle_vs_Circle(const Collider2D& first, const Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+{
+	const Float2 origin(first .centerPosition.x, first .centerPosition.y);
+	const Float2 center(second.centerPosition.x, second.centerPosition.y);
+	return SegmentVsCircle(origin, displacement, center, first.circle.radius + second.circle.radius, outTimeOfImpact);
+}
+
+/****************************************************************************
+*							Sweep_Circle_vs_Rect
+*************************************************************************//**
+*  @fn        bool Collision::Sweep_Circle_vs_Rect(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+*  @brief     Swept circle vs rect (segment vs rect rounded by the circle radius)
+*  @param[in] const Collider2D& first
+*  @param[in] const gm::Float2& displacement
+*  @param[in] const Collider2D& second
+*  @param[out]float& outTimeOfImpact
+*  @return    bool
+*****************************************************************************/
+bool Collision::Sweep_Circle_vs_Rect(const Collider2D& first, const Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+{
+	const Float2 origin(first.centerPosition.x, first.centerPosition.y);
+	const Float2 rectLeftBottom(second.centerPosition.x - second.rectangle.width / 2, second.centerPosition.y - second.rectangle.height / 2);
+	const Float2 rectRightTop  (second.centerPosition.x + second.rectangle.width / 2, second.centerPosition.y + second.rectangle.height / 2);
+	const float  radius = first.circle.radius;
+
+	/*-------------------------------------------------------------------
+	-        Segment vs rect expanded by the radius
+	---------------------------------------------------------------------*/
+	float time = 0.0f;
+	if (!SegmentVsBox(origin, displacement,
+		Float2(rectLeftBottom.x - radius, rectLeftBottom.y - radius),
+		Float2(rectRightTop.x   + radius, rectRightTop.y   + radius), time))
+	{
+		return false;
+	}
+
+	/*-------------------------------------------------------------------
+	-        In the corner region, the rounded corner decides the contact.
+	-        (the segment can not reach the edge region without crossing the corner circle)
+	---------------------------------------------------------------------*/
+	const Float2 point(origin.x + displacement.x * time, origin.y + displacement.y * time);
+	const bool outsideX = point.x < rectLeftBottom.x || point.x > rectRightTop.x;
+	const bool outsideY = point.y < rectLeftBottom.y || point.y > rectRightTop.y;
+	if (outsideX && outsideY)
+	{
+		const Float2 corner(point.x < rectLeftBottom.x ? rectLeftBottom.x : rectRightTop.x,
+			                point.y < rectLeftBottom.y ? rectLeftBottom.y : rectRightTop.y);
+		return SegmentVsCircle(origin, displacement, corner, radius, outTimeOfImpact);
+	}
+
+	outTimeOfImpact = time;
+	return true;
+}
+
+/****************************************************************************
+*							Sweep_Rect_vs_Circle
+*************************************************************************//**
+*  @fn        bool Collision::Sweep_Rect_vs_Circle(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+*  @brief     Swept rect vs circle (the circle moves by -displacement relative to the rect)
+*  @param[in] const Collider2D& first
+*  @param[in] const gm::Float2& displacement
+*  @param[in] const Collider2D& second
+*  @param[out]float& outTimeOfImpact
+*  @return    bool
+*****************************************************************************/
+bool Collision::Sweep_Rect_vs_Circle(const Collider2D& first, const Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+{
+	return Sweep_Circle_vs_Rect(second, Float2(-displacement.x, -displacement.y), first, outTimeOfImpact);
+}
+
+/****************************************************************************
+*							Sweep_Rect_vs_Rect
+*************************************************************************//**
+*  @fn        bool Collision::Sweep_Rect_vs_Rect(const Collider2D& first, const gm::Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+*  @brief     Swept rect vs rect (segment vs second rect expanded by the first rect size)
+*  @param[in] const Collider2D& first
+*  @param[in] const gm::Float2& displacement
+*  @param[in] const Collider2D& second
+*  @param[out]float& outTimeOfImpact
+*  @return    bool
+*****************************************************************************/
+bool Collision::Sweep_Rect_vs_Rect(const Collider2D& first, const Float2& displacement, const Collider2D& second, float& outTimeOfImpact)
+{
+	const float halfWidth  = (first.rectangle.width  + second.rectangle.width ) / 2;
+	const float halfHeight = (first.rectangle.height + second.rectangle.height) / 2;
+	return SegmentVsBox(
+		Float2(first.centerPosition.x, first.centerPosition.y), displacement,
+		Float2(second.centerPosition.x - halfWidth, second.centerPosition.y - halfHeight),
+		Float2(second.centerPosition.x + halfWidth, second.centerPosition.y + halfHeight), outTimeOfImpact);
+}
 #pragma endregion 2D
 #pragma region 3D
 
@@ -0,0 +1,532 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CollisionBatch.cpp
+///             @brief  Batched Collision Detection (one collider vs SoA collider arrays)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/CollisionBatch.hpp"
+#include "GameCore/Include/Collision/Collider.hpp"
+#include <immintrin.h>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*-------------------------------------------------------------------
+-    Each kernel reproduces the floating point operations (and their order)
+-    of the scalar version in Collision.cpp / DirectXCollision.inl,
+-    so the batched result is bit-exact with OnCollision2D / OnCollision3D.
+-    FMA is never used because the scalar path does not contract mul + add.
+---------------------------------------------------------------------*/
+namespace
+{
+#if defined(__AVX__)
+	using BatchVector = __m256;
+	constexpr size_t BATCH_WIDTH = 8;
+	INLINE BatchVector Load        (const float* p)                { return _mm256_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm256_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm256_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm256_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm256_mul_ps(a, b); }
+	INLINE BatchVector Sqrt        (BatchVector a)                 { return _mm256_sqrt_ps(a); }
+	INLINE BatchVector Less        (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	INLINE BatchVector Greater     (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	INLINE BatchVector NotLess     (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_NLT_UQ); }
+	INLINE BatchVector Or          (BatchVector a, BatchVector b)  { return _mm256_or_ps(a, b); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm256_and_ps(a, b); }
+	INLINE BatchVector AndNot      (BatchVector a, BatchVector b)  { return _mm256_andnot_ps(a, b); } // ~a & b
+	INLINE BatchVector Not         (BatchVector a)                 { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm256_movemask_ps(a)); }
+#else
+	using BatchVector = __m128;
+	constexpr size_t BATCH_WIDTH = 4;
+	INLINE BatchVector Load        (const float* p)                { return _mm_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm_mul_ps(a, b); }
+	INLINE BatchVector Sqrt        (BatchVector a)                 { return _mm_sqrt_ps(a); }
+	INLINE BatchVector Less        (BatchVector a, BatchVector b)  { return _mm_cmplt_ps(a, b); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm_cmple_ps(a, b); }
+	INLINE BatchVector Greater     (BatchVector a, BatchVector b)  { return _mm_cmpgt_ps(a, b); }
+	INLINE BatchVector NotLess     (BatchVector a, BatchVector b)  { return _mm_cmpnlt_ps(a, b); }
+	INLINE BatchVector Or          (BatchVector a, BatchVector b)  { return _mm_or_ps(a, b); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm_and_ps(a, b); }
+	INLINE BatchVector AndNot      (BatchVector a, BatchVector b)  { return _mm_andnot_ps(a, b); } // ~a & b
+	INLINE BatchVector Not         (BatchVector a)                 { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm_movemask_ps(a)); }
+#endif
+	static_assert(COLLISION_BATCH_LANE_COUNT % BATCH_WIDTH == 0, "Padding must be a multiple of the simd width.");
+
+	INLINE BatchVector Select(BatchVector a, BatchVector b, BatchVector mask) { return Or(AndNot(mask, a), And(mask, b)); }
+	INLINE BatchVector Half  () { return Splat(0.5f); }
+
+	/****************************************************************************
+	*							RunBatch
+	*************************************************************************//**
+	*  @fn        void RunBatch(size_t count, std::uint32_t* outHitMask, Kernel&& kernel)
+	*  @brief     Call kernel for each simd block and pack the lane masks into outHitMask
+	*  @param[in] size_t count (collider count)
+	*  @param[out]std::uint32_t* outHitMask
+	*  @param[in] Kernel kernel (size_t index -> BatchVector hit mask)
+	*  @return    void
+	*****************************************************************************/
+	template<typename Kernel>
+	void RunBatch(size_t count, std::uint32_t* outHitMask, Kernel&& kernel)
+	{
+		const size_t wordCount = CollisionBatch::GetHitMaskWordCount(count);
+		std::memset(outHitMask, 0, wordCount * sizeof(std::uint32_t));
+
+		for (size_t i = 0; i < count; i += BATCH_WIDTH)
+		{
+			outHitMask[i / 32] |= MoveMask(kernel(i)) << (i % 32);
+		}
+		/*-------------------------------------------------------------------
+		-        Clear the padding lanes
+		---------------------------------------------------------------------*/
+		if (count % 32 != 0) { outHitMask[wordCount - 1] &= (1u << (count % 32)) - 1u; }
+	}
+
+	/****************************************************************************
+	*							RectangleCircleKernel
+	*************************************************************************//**
+	*  @fn        BatchVector RectangleCircleKernel(...)
+	*  @brief     Same condition as Collision::Rect_vs_Circle
+	*  @return    BatchVector (hit mask)
+	*****************************************************************************/
+	INLINE BatchVector RectangleCircleKernel(BatchVector rectCenterX, BatchVector rectCenterY, BatchVector rectWidth, BatchVector rectHeight,
+		BatchVector circleX, BatchVector circleY, BatchVector radius)
+	{
+		const BatchVector halfWidth  = Mul(rectWidth , Half());
+		const BatchVector halfHeight = Mul(rectHeight, Half());
+		const BatchVector left       = Sub(rectCenterX, halfWidth);
+		const BatchVector bottom     = Sub(rectCenterY, halfHeight);
+		const BatchVector right      = Add(rectCenterX, halfWidth);
+		const BatchVector top        = Add(rectCenterY, halfHeight);
+
+		const BatchVector leftOut   = Less   (circleX, left);
+		const BatchVector rightOut  = Greater(circleX, right);
+		const BatchVector bottomOut = Less   (circleY, bottom);
+		const BatchVector topOut    = Greater(circleY, top);
+
+		/*-------------------------------------------------------------------
+		-        Rectangle expanded by the radius
+		---------------------------------------------------------------------*/
+		const BatchVector reject = Or(Or(Less(circleX, Sub(left  , radius)), Greater(circleX, Add(right, radius))),
+		                              Or(Less(circleY, Sub(bottom, radius)), Greater(circleY, Add(top  , radius))));
+		/*-------------------------------------------------------------------
+		-        Corner region : the distance to the corner decides
+		---------------------------------------------------------------------*/
+		const BatchVector dx       = Sub(circleX, Select(right, left  , leftOut));
+		const BatchVector dy       = Sub(circleY, Select(top  , bottom, bottomOut));
+		const BatchVector corner   = And(Or(leftOut, rightOut), Or(bottomOut, topOut));
+		const BatchVector inCorner = Less(Sub(Add(Mul(dx, dx), Mul(dy, dy)), Mul(radius, radius)), Splat(0.0f));
+		return AndNot(reject, Select(Not(corner), inCorner, corner));
+	}
+
+	/****************************************************************************
+	*							AABBSphereKernel
+	*************************************************************************//**
+	*  @fn        BatchVector AABBSphereKernel(...)
+	*  @brief     Same condition as DirectX::BoundingBox::Intersects(BoundingSphere)
+	*  @return    BatchVector (hit mask)
+	*****************************************************************************/
+	INLINE BatchVector AABBSphereAxis(BatchVector boxCenter, BatchVector boxExtent, BatchVector sphereCenter)
+	{
+		const BatchVector boxMin = Sub(boxCenter, boxExtent);
+		const BatchVector boxMax = Add(boxCenter, boxExtent);
+		BatchVector d = And(Less(sphereCenter, boxMin), Sub(sphereCenter, boxMin));
+		d = Select(d, Sub(sphereCenter, boxMax), Greater(sphereCenter, boxMax));
+		return d;
+	}
+
+	INLINE BatchVector AABBSphereKernel(BatchVector boxCenterX, BatchVector boxCenterY, BatchVector boxCenterZ,
+		BatchVector boxExtentX, BatchVector boxExtentY, BatchVector boxExtentZ,
+		BatchVector sphereX, BatchVector sphereY, BatchVector sphereZ, BatchVector radius)
+	{
+		const BatchVector dx = AABBSphereAxis(boxCenterX, boxExtentX, sphereX);
+		const BatchVector dy = AABBSphereAxis(boxCenterY, boxExtentY, sphereY);
+		const BatchVector dz = AABBSphereAxis(boxCenterZ, boxExtentZ, sphereZ);
+		const BatchVector distanceSq = Add(Add(Mul(dx, dx), Mul(dy, dy)), Mul(dz, dz));
+		return LessEqual(distanceSq, Mul(radius, radius));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Collider Array
+/*-------------------------------------------------------------------
+-        The arrays grow by COLLISION_BATCH_LANE_COUNT zero filled elements.
+---------------------------------------------------------------------*/
+void CircleColliderArray::Add(const Collider2D& circle)
+{
+	Add(circle.centerPosition.x, circle.centerPosition.y, circle.centerPosition.z, circle.circle.radius);
+}
+
+void CircleColliderArray::Add(float centerX, float centerY, float radius)
+{
+	Add(centerX, centerY, 0.0f, radius);
+}
+
+void CircleColliderArray::Add(float centerX, float centerY, float centerZ, float radius)
+{
+	if (_count == CenterX.size())
+	{
+		const size_t size = _count + COLLISION_BATCH_LANE_COUNT;
+		CenterX.resize(size); CenterY.resize(size); CenterZ.resize(size); Radius.resize(size);
+	}
+	CenterX[_count] = centerX;
+	CenterY[_count] = centerY;
+	CenterZ[_count] = centerZ;
+	Radius [_count] = radius;
+	_count++;
+}
+
+void CircleColliderArray::Clear()
+{
+	CenterX.clear(); CenterY.clear(); CenterZ.clear(); Radius.clear();
+	_count = 0;
+}
+
+void CircleColliderArray::Reserve(size_t count)
+{
+	count = gm::utils::AlignUp(count, COLLISION_BATCH_LANE_COUNT);
+	CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count); Radius.reserve(count);
+}
+
+void RectangleColliderArray::Add(const Collider2D& rectangle)
+{
+	Add(rectangle.centerPosition.x, rectangle.centerPosition.y, rectangle.rectangle.width, rectangle.rectangle.height);
+}
+
+void RectangleColliderArray::Add(float centerX, float centerY, float width, float height)
+{
+	if (_count == CenterX.size())
+	{
+		const size_t size = _count + COLLISION_BATCH_LANE_COUNT;
+		CenterX.resize(size); CenterY.resize(size); Width.resize(size); Height.resize(size);
+	}
+	CenterX[_count] = centerX;
+	CenterY[_count] = centerY;
+	Width  [_count] = width;
+	Height [_count] = height;
+	_count++;
+}
+
+void RectangleColliderArray::Clear()
+{
+	CenterX.clear(); CenterY.clear(); Width.clear(); Height.clear();
+	_count = 0;
+}
+
+void RectangleColliderArray::Reserve(size_t count)
+{
+	count = gm::utils::AlignUp(count, COLLISION_BATCH_LANE_COUNT);
+	CenterX.reserve(count); CenterY.reserve(count); Width.reserve(count); Height.reserve(count);
+}
+
+void SphereColliderArray::Add(const Collider3D& sphere)
+{
+	Add(sphere.sphere.Center.x, sphere.sphere.Center.y, sphere.sphere.Center.z, sphere.sphere.Radius);
+}
+
+void SphereColliderArray::Add(float centerX, float centerY, float centerZ, float radius)
+{
+	if (_count == CenterX.size())
+	{
+		const size_t size = _count + COLLISION_BATCH_LANE_COUNT;
+		CenterX.resize(size); CenterY.resize(size); CenterZ.resize(size); Radius.resize(size);
+	}
+	CenterX[_count] = centerX;
+	CenterY[_count] = centerY;
+	CenterZ[_count] = centerZ;
+	Radius [_count] = radius;
+	_count++;
+}
+
+void SphereColliderArray::Clear()
+{
+	CenterX.clear(); CenterY.clear(); CenterZ.clear(); Radius.clear();
+	_count = 0;
+}
+
+void SphereColliderArray::Reserve(size_t count)
+{
+	count = gm::utils::AlignUp(count, COLLISION_BATCH_LANE_COUNT);
+	CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count); Radius.reserve(count);
+}
+
+void AABBColliderArray::Add(const Collider3D& box)
+{
+	Add(box.box.Center.x, box.box.Center.y, box.box.Center.z, box.box.Extents.x, box.box.Extents.y, box.box.Extents.z);
+}
+
+void AABBColliderArray::Add(float centerX, float centerY, float centerZ, float extentX, float extentY, float extentZ)
+{
+	if (_count == CenterX.size())
+	{
+		const size_t size = _count + COLLISION_BATCH_LANE_COUNT;
+		CenterX.resize(size); CenterY.resize(size); CenterZ.resize(size);
+		ExtentX.resize(size); ExtentY.resize(size); ExtentZ.resize(size);
+	}
+	CenterX[_count] = centerX;
+	CenterY[_count] = centerY;
+	CenterZ[_count] = centerZ;
+	ExtentX[_count] = extentX;
+	ExtentY[_count] = extentY;
+	ExtentZ[_count] = extentZ;
+	_count++;
+}
+
+void AABBColliderArray::Clear()
+{
+	CenterX.clear(); CenterY.clear(); CenterZ.clear();
+	ExtentX.clear(); ExtentY.clear(); ExtentZ.clear();
+	_count = 0;
+}
+
+void AABBColliderArray::Reserve(size_t count)
+{
+	count = gm::utils::AlignUp(count, COLLISION_BATCH_LANE_COUNT);
+	CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count);
+	ExtentX.reserve(count); ExtentY.reserve(count); ExtentZ.reserve(count);
+}
+#pragma endregion Collider Array
+
+#pragma region 2D
+/****************************************************************************
+*							CircleVsCircles
+*************************************************************************//**
+*  @fn        void CollisionBatch::CircleVsCircles(const Collider2D& circle, const CircleColliderArray& circles, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Circle_vs_Circle(circle, circles[i])
+*  @param[in] const Collider2D& circle
+*  @param[in] const CircleColliderArray& circles
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(circles.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::CircleVsCircles(const Collider2D& circle, const CircleColliderArray& circles, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(circle.centerPosition.x);
+	const BatchVector centerY = Splat(circle.centerPosition.y);
+	const BatchVector centerZ = Splat(circle.centerPosition.z);
+	const BatchVector radius  = Splat(circle.circle.radius);
+
+	RunBatch(circles.Size(), outHitMask, [&](size_t i)
+	{
+		/*-------------------------------------------------------------------
+		-        distance = || (first.centerPos - second.centerPos) || (with z, as Norm(Vector3))
+		---------------------------------------------------------------------*/
+		const BatchVector dx       = Sub(centerX, Load(&circles.CenterX[i]));
+		const BatchVector dy       = Sub(centerY, Load(&circles.CenterY[i]));
+		const BatchVector dz       = Sub(centerZ, Load(&circles.CenterZ[i]));
+		const BatchVector distance = Sqrt(Add(Add(Mul(dx, dx), Mul(dy, dy)), Mul(dz, dz)));
+		return Less(distance, Add(radius, Load(&circles.Radius[i])));
+	});
+}
+
+/****************************************************************************
+*							CircleVsRectangles
+*************************************************************************//**
+*  @fn        void CollisionBatch::CircleVsRectangles(const Collider2D& circle, const RectangleColliderArray& rectangles, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Circle_vs_Rect(circle, rectangles[i])
+*  @param[in] const Collider2D& circle
+*  @param[in] const RectangleColliderArray& rectangles
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(rectangles.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::CircleVsRectangles(const Collider2D& circle, const RectangleColliderArray& rectangles, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(circle.centerPosition.x);
+	const BatchVector centerY = Splat(circle.centerPosition.y);
+	const BatchVector radius  = Splat(circle.circle.radius);
+
+	RunBatch(rectangles.Size(), outHitMask, [&](size_t i)
+	{
+		return RectangleCircleKernel(
+			Load(&rectangles.CenterX[i]), Load(&rectangles.CenterY[i]), Load(&rectangles.Width[i]), Load(&rectangles.Height[i]),
+			centerX, centerY, radius);
+	});
+}
+
+/****************************************************************************
+*							RectangleVsCircles
+*************************************************************************//**
+*  @fn        void CollisionBatch::RectangleVsCircles(const Collider2D& rectangle, const CircleColliderArray& circles, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Rect_vs_Circle(rectangle, circles[i])
+*  @param[in] const Collider2D& rectangle
+*  @param[in] const CircleColliderArray& circles
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(circles.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::RectangleVsCircles(const Collider2D& rectangle, const CircleColliderArray& circles, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(rectangle.centerPosition.x);
+	const BatchVector centerY = Splat(rectangle.centerPosition.y);
+	const BatchVector width   = Splat(rectangle.rectangle.width);
+	const BatchVector height  = Splat(rectangle.rectangle.height);
+
+	RunBatch(circles.Size(), outHitMask, [&](size_t i)
+	{
+		return RectangleCircleKernel(centerX, centerY, width, height,
+			Load(&circles.CenterX[i]), Load(&circles.CenterY[i]), Load(&circles.Radius[i]));
+	});
+}
+
+/****************************************************************************
+*							RectangleVsRectangles
+*************************************************************************//**
+*  @fn        void CollisionBatch::RectangleVsRectangles(const Collider2D& rectangle, const RectangleColliderArray& rectangles, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Rect_vs_Rect(rectangle, rectangles[i])
+*  @param[in] const Collider2D& rectangle
+*  @param[in] const RectangleColliderArray& rectangles
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(rectangles.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::RectangleVsRectangles(const Collider2D& rectangle, const RectangleColliderArray& rectangles, std::uint32_t* outHitMask)
+{
+	const float halfWidth  = rectangle.rectangle.width  / 2;
+	const float halfHeight = rectangle.rectangle.height / 2;
+	const BatchVector firstLeft   = Splat(rectangle.centerPosition.x - halfWidth);
+	const BatchVector firstTop    = Splat(rectangle.centerPosition.y + halfHeight);
+	const BatchVector firstRight  = Splat(rectangle.centerPosition.x + halfWidth);
+	const BatchVector firstBottom = Splat(rectangle.centerPosition.y - halfHeight);
+
+	RunBatch(rectangles.Size(), outHitMask, [&](size_t i)
+	{
+		const BatchVector centerX      = Load(&rectangles.CenterX[i]);
+		const BatchVector centerY      = Load(&rectangles.CenterY[i]);
+		const BatchVector halfWidths   = Mul(Load(&rectangles.Width [i]), Half());
+		const BatchVector halfHeights  = Mul(Load(&rectangles.Height[i]), Half());
+		const BatchVector secondLeft   = Sub(centerX, halfWidths);
+		const BatchVector secondTop    = Add(centerY, halfHeights);
+		const BatchVector secondRight  = Add(centerX, halfWidths);
+		const BatchVector secondBottom = Sub(centerY, halfHeights);
+
+		BatchVector reject = Or(Less(firstRight, secondLeft), Greater(firstLeft, secondRight));
+		reject = Or(reject, Or(Greater(firstBottom, secondTop), Less(firstTop, secondBottom)));
+		return Not(reject);
+	});
+}
+#pragma endregion 2D
+
+#pragma region 3D
+/****************************************************************************
+*							SphereVsSpheres
+*************************************************************************//**
+*  @fn        void CollisionBatch::SphereVsSpheres(const Collider3D& sphere, const SphereColliderArray& spheres, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Sphere_vs_Sphere(sphere, spheres[i])
+*  @param[in] const Collider3D& sphere
+*  @param[in] const SphereColliderArray& spheres
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(spheres.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::SphereVsSpheres(const Collider3D& sphere, const SphereColliderArray& spheres, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(sphere.sphere.Center.x);
+	const BatchVector centerY = Splat(sphere.sphere.Center.y);
+	const BatchVector centerZ = Splat(sphere.sphere.Center.z);
+	const BatchVector radius  = Splat(sphere.sphere.Radius);
+
+	RunBatch(spheres.Size(), outHitMask, [&](size_t i)
+	{
+		const BatchVector dx = Sub(Load(&spheres.CenterX[i]), centerX);
+		const BatchVector dy = Sub(Load(&spheres.CenterY[i]), centerY);
+		const BatchVector dz = Sub(Load(&spheres.CenterZ[i]), centerZ);
+		const BatchVector distanceSq = Add(Add(Mul(dx, dx), Mul(dy, dy)), Mul(dz, dz));
+		const BatchVector radiusSum  = Add(radius, Load(&spheres.Radius[i]));
+		return LessEqual(distanceSq, Mul(radiusSum, radiusSum));
+	});
+}
+
+/****************************************************************************
+*							SphereVsAABBs
+*************************************************************************//**
+*  @fn        void CollisionBatch::SphereVsAABBs(const Collider3D& sphere, const AABBColliderArray& boxes, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Sphere_vs_Box(sphere, boxes[i])
+*  @param[in] const Collider3D& sphere
+*  @param[in] const AABBColliderArray& boxes
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(boxes.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::SphereVsAABBs(const Collider3D& sphere, const AABBColliderArray& boxes, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(sphere.sphere.Center.x);
+	const BatchVector centerY = Splat(sphere.sphere.Center.y);
+	const BatchVector centerZ = Splat(sphere.sphere.Center.z);
+	const BatchVector radius  = Splat(sphere.sphere.Radius);
+
+	RunBatch(boxes.Size(), outHitMask, [&](size_t i)
+	{
+		return AABBSphereKernel(
+			Load(&boxes.CenterX[i]), Load(&boxes.CenterY[i]), Load(&boxes.CenterZ[i]),
+			Load(&boxes.ExtentX[i]), Load(&boxes.ExtentY[i]), Load(&boxes.ExtentZ[i]),
+			centerX, centerY, centerZ, radius);
+	});
+}
+
+/****************************************************************************
+*							AABBVsSpheres
+*************************************************************************//**
+*  @fn        void CollisionBatch::AABBVsSpheres(const Collider3D& box, const SphereColliderArray& spheres, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Box_vs_Sphere(box, spheres[i])
+*  @param[in] const Collider3D& box
+*  @param[in] const SphereColliderArray& spheres
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(spheres.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::AABBVsSpheres(const Collider3D& box, const SphereColliderArray& spheres, std::uint32_t* outHitMask)
+{
+	const BatchVector centerX = Splat(box.box.Center.x);
+	const BatchVector centerY = Splat(box.box.Center.y);
+	const BatchVector centerZ = Splat(box.box.Center.z);
+	const BatchVector extentX = Splat(box.box.Extents.x);
+	const BatchVector extentY = Splat(box.box.Extents.y);
+	const BatchVector extentZ = Splat(box.box.Extents.z);
+
+	RunBatch(spheres.Size(), outHitMask, [&](size_t i)
+	{
+		return AABBSphereKernel(centerX, centerY, centerZ, extentX, extentY, extentZ,
+			Load(&spheres.CenterX[i]), Load(&spheres.CenterY[i]), Load(&spheres.CenterZ[i]), Load(&spheres.Radius[i]));
+	});
+}
+
+/****************************************************************************
+*							AABBVsAABBs
+*************************************************************************//**
+*  @fn        void CollisionBatch::AABBVsAABBs(const Collider3D& box, const AABBColliderArray& boxes, std::uint32_t* outHitMask)
+*  @brief     Batched Collision::Box_vs_Box(box, boxes[i])
+*  @param[in] const Collider3D& box
+*  @param[in] const AABBColliderArray& boxes
+*  @param[out]std::uint32_t* outHitMask (GetHitMaskWordCount(boxes.Size()) words)
+*  @return    void
+*****************************************************************************/
+void CollisionBatch::AABBVsAABBs(const Collider3D& box, const AABBColliderArray& boxes, std::uint32_t* outHitMask)
+{
+	const BatchVector minX = Splat(box.box.Center.x - box.box.Extents.x);
+	const BatchVector minY = Splat(box.box.Center.y - box.box.Extents.y);
+	const BatchVector minZ = Splat(box.box.Center.z - box.box.Extents.z);
+	const BatchVector maxX = Splat(box.box.Center.x + box.box.Extents.x);
+	const BatchVector maxY = Splat(box.box.Center.y + box.box.Extents.y);
+	const BatchVector maxZ = Splat(box.box.Center.z + box.box.Extents.z);
+
+	RunBatch(boxes.Size(), outHitMask, [&](size_t i)
+	{
+		const BatchVector centerX = Load(&boxes.CenterX[i]), extentX = Load(&boxes.ExtentX[i]);
+		const BatchVector centerY = Load(&boxes.CenterY[i]), extentY = Load(&boxes.ExtentY[i]);
+		const BatchVector centerZ = Load(&boxes.CenterZ[i]), extentZ = Load(&boxes.ExtentZ[i]);
+
+		/*-------------------------------------------------------------------
+		-  for each axis: if a_min > b_max or b_min > a_max -> disjoint
+		---------------------------------------------------------------------*/
+		BatchVector disjoint = Or(Greater(minX, Add(centerX, extentX)), Greater(Sub(centerX, extentX), maxX));
+		disjoint = Or(disjoint, Or(Greater(minY, Add(centerY, extentY)), Greater(Sub(centerY, extentY), maxY)));
+		disjoint = Or(disjoint, Or(Greater(minZ, Add(centerZ, extentZ)), Greater(Sub(centerZ, extentZ), maxZ)));
+		return Not(disjoint);
+	});
+}
+#pragma endregion 3D
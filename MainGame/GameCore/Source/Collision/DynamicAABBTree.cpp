@@ -0,0 +1,798 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DynamicAABBTree.cpp
+///             @brief  Dynamic bounding volume hierarchy for 3D scene queries
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/DynamicAABBTree.hpp"
+#include "GameCore/Include/Collision/Collision.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <Windows.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace DirectX;
+
+namespace
+{
+	INLINE float GetAxis(const Float3& v, int axis) { return (&v.x)[axis]; }
+
+	INLINE AABB FromCorners(const XMFLOAT3* corners, int count)
+	{
+		AABB result;
+		result.Min = corners[0]; result.Max = corners[0];
+		for (int i = 1; i < count; ++i)
+		{
+			result.Min = Float3((std::min)(result.Min.x, corners[i].x), (std::min)(result.Min.y, corners[i].y), (std::min)(result.Min.z, corners[i].z));
+			result.Max = Float3((std::max)(result.Max.x, corners[i].x), (std::max)(result.Max.y, corners[i].y), (std::max)(result.Max.z, corners[i].z));
+		}
+		return result;
+	}
+
+	INLINE BoundingBox ToBoundingBox(const AABB& box)
+	{
+		return BoundingBox(
+			XMFLOAT3((box.Min.x + box.Max.x) * 0.5f, (box.Min.y + box.Max.y) * 0.5f, (box.Min.z + box.Max.z) * 0.5f),
+			XMFLOAT3((box.Max.x - box.Min.x) * 0.5f, (box.Max.y - box.Min.y) * 0.5f, (box.Max.z - box.Min.z) * 0.5f));
+	}
+
+	/****************************************************************************
+	*							RayVsAABB
+	*************************************************************************//**
+	*  @fn        bool RayVsAABB(const Float3& origin, const Float3& direction, float maxDistance, const AABB& box)
+	*  @brief     Slab test (ray segment [0, maxDistance] vs aabb)
+	*  @return    bool
+	*****************************************************************************/
+	bool RayVsAABB(const Float3& origin, const Float3& direction, float maxDistance, const AABB& box)
+	{
+		float tMin = 0.0f;
+		float tMax = maxDistance;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float o = GetAxis(origin, axis);
+			const float d = GetAxis(direction, axis);
+			const float boxMin = GetAxis(box.Min, axis);
+			const float boxMax = GetAxis(box.Max, axis);
+			if (std::fabs(d) < FLT_EPSILON)
+			{
+				if (o < boxMin || o > boxMax) { return false; }
+				continue;
+			}
+			const float inverse = 1.0f / d;
+			float t1 = (boxMin - o) * inverse;
+			float t2 = (boxMax - o) * inverse;
+			if (t1 > t2) { std::swap(t1, t2); }
+			tMin = (std::max)(tMin, t1);
+			tMax = (std::min)(tMax, t2);
+			if (tMin > tMax) { return false; }
+		}
+		return true;
+	}
+
+	/****************************************************************************
+	*							RayVsCollider
+	*************************************************************************//**
+	*  @fn        bool RayVsCollider(const Collider3D& collider, FXMVECTOR origin, FXMVECTOR direction, float& distance)
+	*  @brief     Exact ray test against the leaf shape (direction must be normalized).
+	*             A shape enclosing the origin is hit at distance 0
+	*             (the SDK returns a negative distance for boxes and the exit distance for spheres).
+	*  @return    bool
+	*****************************************************************************/
+	bool RayVsCollider(const Collider3D& collider, FXMVECTOR origin, FXMVECTOR direction, float& distance)
+	{
+		bool isHit = false;
+		switch (collider.shapeType3D)
+		{
+			case ColliderShape3D::Box:         { isHit = collider.box        .Intersects(origin, direction, distance); break; }
+			case ColliderShape3D::OrientedBox: { isHit = collider.orientedBox.Intersects(origin, direction, distance); break; }
+			case ColliderShape3D::Frustum:     { isHit = collider.frustum    .Intersects(origin, direction, distance); break; }
+			case ColliderShape3D::Sphere:
+			{
+				isHit = collider.sphere.Intersects(origin, direction, distance);
+				const XMVECTOR delta = XMVectorSubtract(origin, XMLoadFloat3(&collider.sphere.Center));
+				if (isHit && XMVectorGetX(XMVector3Dot(delta, delta)) <= collider.sphere.Radius * collider.sphere.Radius) { distance = 0.0f; }
+				break;
+			}
+			default: { return false; }
+		}
+		distance = (std::max)(distance, 0.0f);
+		return isHit;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region AABB
+bool AABB::Contains(const AABB& other) const
+{
+	return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z &&
+		   other.Max.x <= Max.x && other.Max.y <= Max.y && other.Max.z <= Max.z;
+}
+
+bool AABB::Overlaps(const AABB& other) const
+{
+	if (other.Min.x > Max.x || other.Max.x < Min.x) { return false; }
+	if (other.Min.y > Max.y || other.Max.y < Min.y) { return false; }
+	if (other.Min.z > Max.z || other.Max.z < Min.z) { return false; }
+	return true;
+}
+
+float AABB::SurfaceArea() const
+{
+	const float dx = Max.x - Min.x;
+	const float dy = Max.y - Min.y;
+	const float dz = Max.z - Min.z;
+	return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+AABB AABB::Union(const AABB& a, const AABB& b)
+{
+	AABB result;
+	result.Min = Float3((std::min)(a.Min.x, b.Min.x), (std::min)(a.Min.y, b.Min.y), (std::min)(a.Min.z, b.Min.z));
+	result.Max = Float3((std::max)(a.Max.x, b.Max.x), (std::max)(a.Max.y, b.Max.y), (std::max)(a.Max.z, b.Max.z));
+	return result;
+}
+
+/****************************************************************************
+*							FromCollider
+*************************************************************************//**
+*  @fn        bool AABB::FromCollider(const Collider3D& collider, AABB& outAABB)
+*  @brief     Compute the tight world aabb of the collider. (Plane is unbounded)
+*  @param[in] const Collider3D& collider
+*  @param[out]AABB& outAABB
+*  @return    bool
+*****************************************************************************/
+bool AABB::FromCollider(const Collider3D& collider, AABB& outAABB)
+{
+	XMFLOAT3 corners[8];
+	switch (collider.shapeType3D)
+	{
+		case ColliderShape3D::Box:
+		{
+			const XMFLOAT3& c = collider.box.Center;
+			const XMFLOAT3& e = collider.box.Extents;
+			outAABB.Min = Float3(c.x - e.x, c.y - e.y, c.z - e.z);
+			outAABB.Max = Float3(c.x + e.x, c.y + e.y, c.z + e.z);
+			return true;
+		}
+		case ColliderShape3D::OrientedBox:
+		{
+			collider.orientedBox.GetCorners(corners);
+			outAABB = FromCorners(corners, 8);
+			return true;
+		}
+		case ColliderShape3D::Sphere:
+		{
+			const XMFLOAT3& c = collider.sphere.Center;
+			const float     r = collider.sphere.Radius;
+			outAABB.Min = Float3(c.x - r, c.y - r, c.z - r);
+			outAABB.Max = Float3(c.x + r, c.y + r, c.z + r);
+			return true;
+		}
+		case ColliderShape3D::Frustum:
+		{
+			collider.frustum.GetCorners(corners);
+			outAABB = FromCorners(corners, 8);
+			return true;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+#pragma endregion AABB
+
+#pragma region Public Function
+DynamicAABBTree::DynamicAABBTree(float fatMargin, float displacementMultiplier)
+	: _fatMargin(fatMargin), _displacementMultiplier(displacementMultiplier)
+{
+	_stack.reserve(256);
+}
+
+/****************************************************************************
+*							CreateProxy
+*************************************************************************//**
+*  @fn        int DynamicAABBTree::CreateProxy(const Collider3D& collider, GameActor* actor)
+*  @brief     Insert the collider as a fattened leaf and return its proxy ID
+*  @param[in] const Collider3D& collider (box, orientedBox, sphere or frustum)
+*  @param[in] GameActor* actor
+*  @return    int proxyID (AABB_TREE_NULL_NODE: plane collider can not be inserted)
+*****************************************************************************/
+int DynamicAABBTree::CreateProxy(const Collider3D& collider, GameActor* actor)
+{
+	AABB tight;
+	if (!AABB::FromCollider(collider, tight))
+	{
+		::OutputDebugString(L"Error!: plane collider can not be inserted to the aabb tree.");
+		return AABB_TREE_NULL_NODE;
+	}
+
+	const int proxyID = AllocateNode();
+	Node& node    = _nodes[proxyID];
+	node.Collider = collider;
+	node.Actor    = actor;
+	node.Height   = 0;
+	node.Moved    = true;
+	FattenAABB(tight, Float3(0.0f, 0.0f, 0.0f), node.Box);
+
+	InsertLeaf(proxyID);
+	_proxyCount++;
+	return proxyID;
+}
+
+/****************************************************************************
+*							DestroyProxy
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::DestroyProxy(int proxyID)
+*  @brief     Remove the leaf from the tree
+*  @param[in] int proxyID
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::DestroyProxy(int proxyID)
+{
+	assert(0 <= proxyID && proxyID < static_cast<int>(_nodes.size()));
+	assert(_nodes[proxyID].IsLeaf());
+
+	RemoveLeaf(proxyID);
+	FreeNode(proxyID);
+	_proxyCount--;
+}
+
+/****************************************************************************
+*							MoveProxy
+*************************************************************************//**
+*  @fn        bool DynamicAABBTree::MoveProxy(int proxyID, const Collider3D& collider, const gm::Float3& displacement)
+*  @brief     Update the leaf collider. The leaf is re-inserted only when the
+*             tight aabb leaves the fat aabb (or the fat aabb became too large).
+*  @param[in] int proxyID
+*  @param[in] const Collider3D& collider
+*  @param[in] const gm::Float3& displacement (predicted movement for this frame)
+*  @return    bool (true: the leaf was re-inserted)
+*****************************************************************************/
+bool DynamicAABBTree::MoveProxy(int proxyID, const Collider3D& collider, const Float3& displacement)
+{
+	assert(0 <= proxyID && proxyID < static_cast<int>(_nodes.size()));
+	assert(_nodes[proxyID].IsLeaf());
+
+	AABB tight;
+	if (!AABB::FromCollider(collider, tight)) { return false; }
+
+	Node& node    = _nodes[proxyID];
+	node.Collider = collider;
+
+	AABB fat;
+	FattenAABB(tight, displacement, fat);
+
+	/*-------------------------------------------------------------------
+	-    Keep the old leaf while it still encloses the shape and is not
+	-    excessively large (4 x margin), so small motions do not touch the tree.
+	---------------------------------------------------------------------*/
+	if (node.Box.Contains(tight))
+	{
+		AABB huge = fat;
+		const float margin = 4.0f * _fatMargin;
+		huge.Min = Float3(huge.Min.x - margin, huge.Min.y - margin, huge.Min.z - margin);
+		huge.Max = Float3(huge.Max.x + margin, huge.Max.y + margin, huge.Max.z + margin);
+		if (huge.Contains(node.Box)) { return false; }
+	}
+
+	RemoveLeaf(proxyID);
+	_nodes[proxyID].Box   = fat;
+	InsertLeaf(proxyID);
+	_nodes[proxyID].Moved = true;
+	return true;
+}
+
+/****************************************************************************
+*							Clear
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::Clear()
+*  @brief     Remove all proxies (node memory is kept)
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::Clear()
+{
+	_nodes.clear();
+	_root       = AABB_TREE_NULL_NODE;
+	_freeList   = AABB_TREE_NULL_NODE;
+	_proxyCount = 0;
+}
+
+/****************************************************************************
+*							QueryOverlap
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::QueryOverlap(const Collider3D& volume, std::vector<GameActor*>& outActors) const
+*  @brief     Collect the actors whose collider intersects the volume (sphere / box trigger etc.)
+*             A plane volume has no aabb, so the nodes are culled by the plane itself
+*             (only the nodes straddling the plane are visited).
+*  @param[in] const Collider3D& volume
+*  @param[out]std::vector<GameActor*>& outActors (appended)
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::QueryOverlap(const Collider3D& volume, std::vector<GameActor*>& outActors) const
+{
+	if (_root == AABB_TREE_NULL_NODE) { return; }
+
+	const bool isPlane = volume.shapeType3D == ColliderShape3D::Plane;
+	AABB queryBox;
+	if (!isPlane && !AABB::FromCollider(volume, queryBox))
+	{
+		::OutputDebugString(L"Error!: the overlap volume is not assigned.");
+		return;
+	}
+
+	_stack.clear();
+	_stack.push_back(_root);
+	while (!_stack.empty())
+	{
+		const int nodeID = _stack.back(); _stack.pop_back();
+		const Node& node = _nodes[nodeID];
+		if (isPlane)
+		{
+			const XMVECTOR plane = XMLoadFloat4(&volume.plane.PlaneEquation);
+			if (ToBoundingBox(node.Box).Intersects(plane) != INTERSECTING) { continue; }
+		}
+		else if (!node.Box.Overlaps(queryBox)) { continue; }
+
+		if (node.IsLeaf())
+		{
+			if (Collision::OnCollision3D(volume, node.Collider)) { outActors.push_back(node.Actor); }
+		}
+		else
+		{
+			_stack.push_back(node.Child1);
+			_stack.push_back(node.Child2);
+		}
+	}
+}
+
+/****************************************************************************
+*							QueryFrustum
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::QueryFrustum(const Collider3D& frustum, std::vector<GameActor*>& outActors) const
+*  @brief     Collect the actors inside or intersecting the frustum.
+*             Subtrees fully contained in the frustum are added without further tests.
+*  @param[in] const Collider3D& frustum
+*  @param[out]std::vector<GameActor*>& outActors (appended)
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::QueryFrustum(const Collider3D& frustum, std::vector<GameActor*>& outActors) const
+{
+	if (frustum.shapeType3D != ColliderShape3D::Frustum)
+	{
+		::OutputDebugString(L"Error!: frustum is not assigned.");
+		return;
+	}
+	if (_root == AABB_TREE_NULL_NODE) { return; }
+
+	_stack.clear();
+	_stack.push_back(_root);
+	while (!_stack.empty())
+	{
+		const int nodeID = _stack.back(); _stack.pop_back();
+		const Node& node = _nodes[nodeID];
+
+		const ContainmentType containment = frustum.frustum.Contains(ToBoundingBox(node.Box));
+		if (containment == DISJOINT) { continue; }
+		if (containment == CONTAINS)
+		{
+			CollectLeaves(nodeID, outActors);
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			if (Collision::OnCollision3D(frustum, node.Collider)) { outActors.push_back(node.Actor); }
+		}
+		else
+		{
+			_stack.push_back(node.Child1);
+			_stack.push_back(node.Child2);
+		}
+	}
+}
+
+/****************************************************************************
+*							Raycast
+*************************************************************************//**
+*  @fn        bool DynamicAABBTree::Raycast(const gm::Float3& origin, const gm::Float3& direction, float maxDistance, DynamicAABBTreeRaycastHit& outHit, bool isContainingSkipped) const
+*  @brief     Find the closest leaf hit by the ray.
+*             A leaf enclosing the origin is hit at distance 0 (a trigger volume around the origin etc.).
+*             Mouse picking passes isContainingSkipped so that a large volume around the camera
+*             (the stage etc.) does not hide the actors inside it.
+*  @param[in] const gm::Float3& origin
+*  @param[in] const gm::Float3& direction (need not be normalized)
+*  @param[in] float maxDistance
+*  @param[out]DynamicAABBTreeRaycastHit& outHit
+*  @param[in] bool isContainingSkipped (ignore the leaves enclosing the origin)
+*  @return    bool
+*****************************************************************************/
+bool DynamicAABBTree::Raycast(const Float3& origin, const Float3& direction, float maxDistance, DynamicAABBTreeRaycastHit& outHit, bool isContainingSkipped) const
+{
+	outHit = DynamicAABBTreeRaycastHit();
+	if (_root == AABB_TREE_NULL_NODE) { return false; }
+
+	const XMVECTOR rayOrigin    = XMLoadFloat3(&origin);
+	const XMVECTOR rayDirection = XMVector3Normalize(XMLoadFloat3(&direction));
+	Float3 normalizedDirection;
+	XMStoreFloat3(&normalizedDirection, rayDirection);
+
+	float closest = maxDistance;
+	_stack.clear();
+	_stack.push_back(_root);
+	while (!_stack.empty())
+	{
+		const int nodeID = _stack.back(); _stack.pop_back();
+		const Node& node = _nodes[nodeID];
+		if (!RayVsAABB(origin, normalizedDirection, closest, node.Box)) { continue; }
+
+		if (node.IsLeaf())
+		{
+			float distance = 0.0f;
+			if (!RayVsCollider(node.Collider, rayOrigin, rayDirection, distance)) { continue; }
+			if (isContainingSkipped && distance <= 0.0f) { continue; }
+			if (distance <= closest)
+			{
+				closest         = distance;
+				outHit.Actor    = node.Actor;
+				outHit.ProxyID  = nodeID;
+				outHit.Distance = distance;
+			}
+		}
+		else
+		{
+			_stack.push_back(node.Child1);
+			_stack.push_back(node.Child2);
+		}
+	}
+	return outHit.ProxyID != AABB_TREE_NULL_NODE;
+}
+
+/****************************************************************************
+*							Validate
+*************************************************************************//**
+*  @fn        bool DynamicAABBTree::Validate() const
+*  @brief     Check parent links, heights and enclosing boxes (for debug)
+*  @param[in] void
+*  @return    bool
+*****************************************************************************/
+bool DynamicAABBTree::Validate() const
+{
+	if (_root == AABB_TREE_NULL_NODE) { return _proxyCount == 0; }
+	if (_nodes[_root].Parent != AABB_TREE_NULL_NODE) { return false; }
+	return ValidateStructure(_root);
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+int DynamicAABBTree::AllocateNode()
+{
+	if (_freeList == AABB_TREE_NULL_NODE)
+	{
+		_nodes.emplace_back();
+		return static_cast<int>(_nodes.size()) - 1;
+	}
+
+	const int nodeID = _freeList;
+	_freeList = _nodes[nodeID].Parent;
+	_nodes[nodeID] = Node();
+	return nodeID;
+}
+
+void DynamicAABBTree::FreeNode(int nodeID)
+{
+	_nodes[nodeID].Parent = _freeList;
+	_nodes[nodeID].Height = -1;
+	_nodes[nodeID].Actor  = nullptr;
+	_freeList = nodeID;
+}
+
+void DynamicAABBTree::FattenAABB(const AABB& tight, const Float3& displacement, AABB& outFat) const
+{
+	outFat.Min = Float3(tight.Min.x - _fatMargin, tight.Min.y - _fatMargin, tight.Min.z - _fatMargin);
+	outFat.Max = Float3(tight.Max.x + _fatMargin, tight.Max.y + _fatMargin, tight.Max.z + _fatMargin);
+
+	/*-------------------------------------------------------------------
+	-        Extend the box in the direction of motion
+	---------------------------------------------------------------------*/
+	const Float3 d(displacement.x * _displacementMultiplier, displacement.y * _displacementMultiplier, displacement.z * _displacementMultiplier);
+	if (d.x < 0.0f) { outFat.Min.x += d.x; } else { outFat.Max.x += d.x; }
+	if (d.y < 0.0f) { outFat.Min.y += d.y; } else { outFat.Max.y += d.y; }
+	if (d.z < 0.0f) { outFat.Min.z += d.z; } else { outFat.Max.z += d.z; }
+}
+
+/****************************************************************************
+*							InsertLeaf
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::InsertLeaf(int leaf)
+*  @brief     Find the best sibling with the surface area heuristic and refit upward
+*  @param[in] int leaf
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+	if (_root == AABB_TREE_NULL_NODE)
+	{
+		_root = leaf;
+		_nodes[_root].Parent = AABB_TREE_NULL_NODE;
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-        Find the best sibling
+	---------------------------------------------------------------------*/
+	const AABB leafBox = _nodes[leaf].Box;
+	int index = _root;
+	while (!_nodes[index].IsLeaf())
+	{
+		const int child1 = _nodes[index].Child1;
+		const int child2 = _nodes[index].Child2;
+
+		const float area         = _nodes[index].Box.SurfaceArea();
+		const float combinedArea = AABB::Union(_nodes[index].Box, leafBox).SurfaceArea();
+
+		// cost of creating a new parent for this node and the new leaf
+		const float cost = 2.0f * combinedArea;
+		// minimum cost of pushing the leaf further down the tree
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto descendCost = [&](int child)
+		{
+			const float newArea = AABB::Union(leafBox, _nodes[child].Box).SurfaceArea();
+			return _nodes[child].IsLeaf() ? newArea + inheritanceCost : (newArea - _nodes[child].Box.SurfaceArea()) + inheritanceCost;
+		};
+		const float cost1 = descendCost(child1);
+		const float cost2 = descendCost(child2);
+
+		if (cost < cost1 && cost < cost2) { break; }
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+	const int sibling = index;
+
+	/*-------------------------------------------------------------------
+	-        Create a new parent
+	---------------------------------------------------------------------*/
+	const int oldParent = _nodes[sibling].Parent;
+	const int newParent = AllocateNode();
+	_nodes[newParent].Parent = oldParent;
+	_nodes[newParent].Box    = AABB::Union(leafBox, _nodes[sibling].Box);
+	_nodes[newParent].Height = _nodes[sibling].Height + 1;
+	_nodes[newParent].Child1 = sibling;
+	_nodes[newParent].Child2 = leaf;
+	_nodes[sibling].Parent   = newParent;
+	_nodes[leaf].Parent      = newParent;
+
+	if (oldParent != AABB_TREE_NULL_NODE)
+	{
+		if (_nodes[oldParent].Child1 == sibling) { _nodes[oldParent].Child1 = newParent; }
+		else                                     { _nodes[oldParent].Child2 = newParent; }
+	}
+	else
+	{
+		_root = newParent;
+	}
+
+	/*-------------------------------------------------------------------
+	-        Walk back up the tree fixing heights and boxes
+	---------------------------------------------------------------------*/
+	Refit(_nodes[leaf].Parent);
+}
+
+/****************************************************************************
+*							RemoveLeaf
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::RemoveLeaf(int leaf)
+*  @brief     Replace the parent of the leaf with its sibling and refit upward
+*  @param[in] int leaf
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+	if (leaf == _root)
+	{
+		_root = AABB_TREE_NULL_NODE;
+		return;
+	}
+
+	const int parent      = _nodes[leaf].Parent;
+	const int grandParent = _nodes[parent].Parent;
+	const int sibling     = (_nodes[parent].Child1 == leaf) ? _nodes[parent].Child2 : _nodes[parent].Child1;
+
+	if (grandParent != AABB_TREE_NULL_NODE)
+	{
+		if (_nodes[grandParent].Child1 == parent) { _nodes[grandParent].Child1 = sibling; }
+		else                                      { _nodes[grandParent].Child2 = sibling; }
+		_nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+		Refit(grandParent);
+	}
+	else
+	{
+		_root = sibling;
+		_nodes[sibling].Parent = AABB_TREE_NULL_NODE;
+		FreeNode(parent);
+	}
+}
+
+/****************************************************************************
+*							Refit
+*************************************************************************//**
+*  @fn        void DynamicAABBTree::Refit(int nodeID)
+*  @brief     Incremental refit from nodeID to the root (rotating unbalanced nodes)
+*  @param[in] int nodeID
+*  @return    void
+*****************************************************************************/
+void DynamicAABBTree::Refit(int nodeID)
+{
+	int index = nodeID;
+	while (index != AABB_TREE_NULL_NODE)
+	{
+		index = Balance(index);
+
+		const int child1 = _nodes[index].Child1;
+		const int child2 = _nodes[index].Child2;
+		_nodes[index].Height = 1 + (std::max)(_nodes[child1].Height, _nodes[child2].Height);
+		_nodes[index].Box    = AABB::Union(_nodes[child1].Box, _nodes[child2].Box);
+
+		index = _nodes[index].Parent;
+	}
+}
+
+/****************************************************************************
+*							Balance
+*************************************************************************//**
+*  @fn        int DynamicAABBTree::Balance(int iA)
+*  @brief     Perform a left or right rotation if node A is imbalanced.
+*  @param[in] int nodeID (A)
+*  @return    int new root index of the subtree
+*****************************************************************************/
+int DynamicAABBTree::Balance(int iA)
+{
+	Node& A = _nodes[iA];
+	if (A.IsLeaf() || A.Height < 2) { return iA; }
+
+	const int iB = A.Child1;
+	const int iC = A.Child2;
+	Node& B = _nodes[iB];
+	Node& C = _nodes[iC];
+
+	const int balance = C.Height - B.Height;
+
+	/*-------------------------------------------------------------------
+	-        Rotate C up
+	---------------------------------------------------------------------*/
+	if (balance > 1)
+	{
+		const int iF = C.Child1;
+		const int iG = C.Child2;
+		Node& F = _nodes[iF];
+		Node& G = _nodes[iG];
+
+		C.Child1 = iA;
+		C.Parent = A.Parent;
+		A.Parent = iC;
+
+		if (C.Parent != AABB_TREE_NULL_NODE)
+		{
+			if (_nodes[C.Parent].Child1 == iA) { _nodes[C.Parent].Child1 = iC; }
+			else                               { _nodes[C.Parent].Child2 = iC; }
+		}
+		else
+		{
+			_root = iC;
+		}
+
+		if (F.Height > G.Height)
+		{
+			C.Child2 = iF;
+			A.Child2 = iG;
+			G.Parent = iA;
+			A.Box    = AABB::Union(B.Box, G.Box);
+			C.Box    = AABB::Union(A.Box, F.Box);
+			A.Height = 1 + (std::max)(B.Height, G.Height);
+			C.Height = 1 + (std::max)(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2 = iG;
+			A.Child2 = iF;
+			F.Parent = iA;
+			A.Box    = AABB::Union(B.Box, F.Box);
+			C.Box    = AABB::Union(A.Box, G.Box);
+			A.Height = 1 + (std::max)(B.Height, F.Height);
+			C.Height = 1 + (std::max)(A.Height, G.Height);
+		}
+		return iC;
+	}
+
+	/*-------------------------------------------------------------------
+	-        Rotate B up
+	---------------------------------------------------------------------*/
+	if (balance < -1)
+	{
+		const int iD = B.Child1;
+		const int iE = B.Child2;
+		Node& D = _nodes[iD];
+		Node& E = _nodes[iE];
+
+		B.Child1 = iA;
+		B.Parent = A.Parent;
+		A.Parent = iB;
+
+		if (B.Parent != AABB_TREE_NULL_NODE)
+		{
+			if (_nodes[B.Parent].Child1 == iA) { _nodes[B.Parent].Child1 = iB; }
+			else                               { _nodes[B.Parent].Child2 = iB; }
+		}
+		else
+		{
+			_root = iB;
+		}
+
+		if (D.Height > E.Height)
+		{
+			B.Child2 = iD;
+			A.Child1 = iE;
+			E.Parent = iA;
+			A.Box    = AABB::Union(C.Box, E.Box);
+			B.Box    = AABB::Union(A.Box, D.Box);
+			A.Height = 1 + (std::max)(C.Height, E.Height);
+			B.Height = 1 + (std::max)(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2 = iE;
+			A.Child1 = iD;
+			D.Parent = iA;
+			A.Box    = AABB::Union(C.Box, D.Box);
+			B.Box    = AABB::Union(A.Box, E.Box);
+			A.Height = 1 + (std::max)(C.Height, D.Height);
+			B.Height = 1 + (std::max)(A.Height, E.Height);
+		}
+		return iB;
+	}
+	return iA;
+}
+
+void DynamicAABBTree::CollectLeaves(int nodeID, std::vector<GameActor*>& outActors) const
+{
+	// _stack is in use by the caller, so the subtree is walked with its own tail of the stack.
+	const size_t base = _stack.size();
+	_stack.push_back(nodeID);
+	while (_stack.size() > base)
+	{
+		const int index = _stack.back(); _stack.pop_back();
+		const Node& node = _nodes[index];
+		if (node.IsLeaf()) { outActors.push_back(node.Actor); }
+		else
+		{
+			_stack.push_back(node.Child1);
+			_stack.push_back(node.Child2);
+		}
+	}
+}
+
+bool DynamicAABBTree::ValidateStructure(int nodeID) const
+{
+	const Node& node = _nodes[nodeID];
+	if (node.IsLeaf()) { return node.Height == 0; }
+
+	const Node& child1 = _nodes[node.Child1];
+	const Node& child2 = _nodes[node.Child2];
+	if (child1.Parent != nodeID || child2.Parent != nodeID)             { return false; }
+	if (node.Height != 1 + (std::max)(child1.Height, child2.Height))    { return false; }
+	if (!node.Box.Contains(child1.Box) || !node.Box.Contains(child2.Box)) { return false; }
+	return ValidateStructure(node.Child1) && ValidateStructure(node.Child2);
+}
+#pragma endregion Private Function
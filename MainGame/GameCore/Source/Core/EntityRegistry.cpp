@@ -0,0 +1,451 @@
+//////////////////////////////////////////////////////////////////////////////////
+//              Title:  EntityRegistry.cpp
+//            Content:  Archetype based entity storage
+//             Author:  Toide Yutaro
+//             Create:  2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Core/EntityRegistry.hpp"
+#include <algorithm>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace entity_detail;
+
+namespace
+{
+	constexpr size_t ARCHETYPE_MIN_CAPACITY = 16;
+
+	std::uint8_t* AllocateColumn(const ComponentTypeInfo* info, size_t capacity)
+	{
+		return static_cast<std::uint8_t*>(::operator new(info->Size * capacity, std::align_val_t(info->Alignment)));
+	}
+
+	void FreeColumn(const ComponentTypeInfo* info, std::uint8_t* data)
+	{
+		if (data != nullptr) { ::operator delete(data, std::align_val_t(info->Alignment)); }
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Archetype
+Archetype::Archetype(const std::vector<const ComponentTypeInfo*>& types)
+{
+	std::vector<const ComponentTypeInfo*> sortedTypes = types;
+	std::sort(sortedTypes.begin(), sortedTypes.end(), [](const ComponentTypeInfo* a, const ComponentTypeInfo* b) { return a->ID < b->ID; });
+
+	std::fill(std::begin(ColumnIndex), std::end(ColumnIndex), static_cast<std::int8_t>(-1));
+	std::fill(std::begin(AddEdge)    , std::end(AddEdge)    , ENTITY_INVALID_INDEX);
+	std::fill(std::begin(RemoveEdge) , std::end(RemoveEdge) , ENTITY_INVALID_INDEX);
+
+	Columns.resize(sortedTypes.size());
+	for (size_t i = 0; i < sortedTypes.size(); ++i)
+	{
+		Columns[i].Info = sortedTypes[i];
+		ColumnIndex[sortedTypes[i]->ID] = static_cast<std::int8_t>(i);
+		Mask |= 1ull << sortedTypes[i]->ID;
+	}
+}
+
+Archetype::~Archetype()
+{
+	for (Column& column : Columns)
+	{
+		for (size_t row = 0; row < Entities.size(); ++row)
+		{
+			column.Info->Destroy(column.Data + column.Info->Size * row);
+		}
+		FreeColumn(column.Info, column.Data);
+	}
+}
+
+/****************************************************************************
+*                       PushRow
+*************************************************************************//**
+*  @fn        size_t Archetype::PushRow(Entity entity)
+*  @brief     Append a row. Columns grow by doubling (existing components are moved).
+*             The caller constructs the components of the new row.
+*  @param[in] Entity entity
+*  @return @@size_t row
+*****************************************************************************/
+size_t Archetype::PushRow(Entity entity)
+{
+	const size_t count = Entities.size();
+	if (count == Capacity)
+	{
+		const size_t newCapacity = (std::max)(ARCHETYPE_MIN_CAPACITY, Capacity * 2);
+		for (Column& column : Columns)
+		{
+			const ComponentTypeInfo* info = column.Info;
+			std::uint8_t* newData = AllocateColumn(info, newCapacity);
+			for (size_t row = 0; row < count; ++row)
+			{
+				info->MoveConstruct(newData + info->Size * row, column.Data + info->Size * row);
+				info->Destroy(column.Data + info->Size * row);
+			}
+			FreeColumn(info, column.Data);
+			column.Data = newData;
+		}
+		Capacity = newCapacity;
+	}
+	Entities.push_back(entity);
+	return count;
+}
+
+/****************************************************************************
+*                       RemoveRow
+*************************************************************************//**
+*  @fn        Entity Archetype::RemoveRow(size_t row)
+*  @brief     Destroy the row and fill the hole with the last row (swap remove)
+*  @param[in] size_t row
+*  @return @@Entity moved into the row (null : the last row was removed)
+*****************************************************************************/
+Entity Archetype::RemoveRow(size_t row)
+{
+	const size_t last = Entities.size() - 1;
+	for (Column& column : Columns)
+	{
+		const ComponentTypeInfo* info = column.Info;
+		std::uint8_t* target = column.Data + info->Size * row;
+		info->Destroy(target);
+		if (row != last)
+		{
+			std::uint8_t* source = column.Data + info->Size * last;
+			info->MoveConstruct(target, source);
+			info->Destroy(source);
+		}
+	}
+
+	Entity moved = Entity();
+	if (row != last) { moved = Entities[last]; Entities[row] = moved; }
+	Entities.pop_back();
+	return moved;
+}
+#pragma endregion Archetype
+
+#pragma region Registry
+EntityRegistry::EntityRegistry()
+{
+	/*-------------------------------------------------------------------
+	-     Archetype 0 : entities without components
+	---------------------------------------------------------------------*/
+	FindOrCreateArchetype(0, {});
+}
+
+/****************************************************************************
+*                       Create
+*************************************************************************//**
+*  @fn        Entity EntityRegistry::Create(std::string_view name, std::string_view tag)
+*  @brief     Create an entity without components
+*  @param[in] std::string_view name
+*  @param[in] std::string_view tag
+*  @return @@Entity
+*****************************************************************************/
+Entity EntityRegistry::Create(std::string_view name, std::string_view tag)
+{
+	const Entity entity = AllocateEntity();
+	EntityRecord& record = _records[entity.Index];
+	record.Archetype = 0;
+	record.Row       = static_cast<std::uint32_t>(_archetypes[0]->PushRow(entity));
+	AddToIndex(_nameIndex, record.Name, name, record.NameSlot, entity);
+	AddToIndex(_tagIndex , record.Tag , tag , record.TagSlot , entity);
+	return entity;
+}
+
+/****************************************************************************
+*                       Destroy
+*************************************************************************//**
+*  @fn        bool EntityRegistry::Destroy(Entity entity)
+*  @brief     Destroy the entity and its components. The handle becomes stale.
+*  @param[in] Entity entity
+*  @return @@bool (false : already destroyed)
+*****************************************************************************/
+bool EntityRegistry::Destroy(Entity entity)
+{
+	if (!IsAlive(entity)) { return false; }
+
+	EntityRecord& record = _records[entity.Index];
+	RemoveFromIndex(_nameIndex, record.Name, record.NameSlot, _records, false);
+	RemoveFromIndex(_tagIndex , record.Tag , record.TagSlot , _records, true);
+	RemoveFromArchetype(record);
+	record.Name.clear();
+	record.Tag .clear();
+	record.Archetype = ENTITY_INVALID_INDEX;
+	record.Generation++;
+	_freeIndices.push_back(entity.Index);
+	return true;
+}
+
+void EntityRegistry::FlushDestroyed()
+{
+	for (const Entity entity : _destroyQueue) { Destroy(entity); }
+	_destroyQueue.clear();
+}
+
+/****************************************************************************
+*                       Clear
+*************************************************************************//**
+*  @fn        void EntityRegistry::Clear()
+*  @brief     Destroy all entities. Archetypes and query caches are kept for reuse,
+*             and generations are kept so that old handles stay stale.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void EntityRegistry::Clear()
+{
+	for (std::uint32_t index = 0; index < _records.size(); ++index)
+	{
+		EntityRecord& record = _records[index];
+		if (record.Archetype == ENTITY_INVALID_INDEX) { continue; }
+		Destroy(Entity{ index, record.Generation });
+	}
+	_destroyQueue.clear();
+}
+
+/****************************************************************************
+*                       Find
+*************************************************************************//**
+*  @fn        Entity EntityRegistry::Find(std::string_view name) const
+*  @brief     Return an entity with the name (null : not found). O(1)
+*  @param[in] std::string_view name
+*  @return @@Entity
+*****************************************************************************/
+Entity EntityRegistry::Find(std::string_view name) const
+{
+	const std::vector<Entity>* entities = _nameIndex.Find(name);
+	return (entities != nullptr && !entities->empty()) ? entities->front() : Entity();
+}
+
+/****************************************************************************
+*                       FindAllWithTag
+*************************************************************************//**
+*  @fn        const std::vector<Entity>& EntityRegistry::FindAllWithTag(std::string_view tag) const
+*  @brief     Return all entities with the tag (order is not kept). No allocation.
+*             The reference is valid until the next create / destroy / SetTag.
+*  @param[in] std::string_view tag
+*  @return @@const std::vector<Entity>&
+*****************************************************************************/
+const std::vector<Entity>& EntityRegistry::FindAllWithTag(std::string_view tag) const
+{
+	static const std::vector<Entity> empty;
+	const std::vector<Entity>* entities = _tagIndex.Find(tag);
+	return entities != nullptr ? *entities : empty;
+}
+
+const std::string& EntityRegistry::GetName(Entity entity) const
+{
+	static const std::string empty;
+	return IsAlive(entity) ? _records[entity.Index].Name : empty;
+}
+
+const std::string& EntityRegistry::GetTag(Entity entity) const
+{
+	static const std::string empty;
+	return IsAlive(entity) ? _records[entity.Index].Tag : empty;
+}
+
+void EntityRegistry::SetName(Entity entity, std::string_view name)
+{
+	if (!IsAlive(entity)) { return; }
+	EntityRecord& record = _records[entity.Index];
+	if (record.Name == name) { return; }
+	RemoveFromIndex(_nameIndex, record.Name, record.NameSlot, _records, false);
+	AddToIndex     (_nameIndex, record.Name, name, record.NameSlot, entity);
+}
+
+void EntityRegistry::SetTag(Entity entity, std::string_view tag)
+{
+	if (!IsAlive(entity)) { return; }
+	EntityRecord& record = _records[entity.Index];
+	if (record.Tag == tag) { return; }
+	RemoveFromIndex(_tagIndex, record.Tag, record.TagSlot, _records, true);
+	AddToIndex     (_tagIndex, record.Tag, tag, record.TagSlot, entity);
+}
+
+#pragma region Private Function
+Entity EntityRegistry::AllocateEntity()
+{
+	if (!_freeIndices.empty())
+	{
+		const std::uint32_t index = _freeIndices.back();
+		_freeIndices.pop_back();
+		return Entity{ index, _records[index].Generation };
+	}
+	_records.emplace_back();
+	return Entity{ static_cast<std::uint32_t>(_records.size() - 1), 0 };
+}
+
+/****************************************************************************
+*                       FindOrCreateArchetype
+*************************************************************************//**
+*  @fn        std::uint32_t EntityRegistry::FindOrCreateArchetype(std::uint64_t mask, const std::vector<const ComponentTypeInfo*>& types)
+*  @brief     Return the archetype of the mask. A new archetype is appended to the cached query lists which match it.
+*  @param[in] std::uint64_t mask
+*  @param[in] const std::vector<const ComponentTypeInfo*>& types (used only when created)
+*  @return @@std::uint32_t archetype index
+*****************************************************************************/
+std::uint32_t EntityRegistry::FindOrCreateArchetype(std::uint64_t mask, const std::vector<const ComponentTypeInfo*>& types)
+{
+	if (const std::uint32_t* found = _archetypeIndex.Find(mask)) { return *found; }
+
+	const std::uint32_t index = static_cast<std::uint32_t>(_archetypes.size());
+	_archetypes.emplace_back(std::make_unique<Archetype>(types));
+	_archetypeIndex.InsertOrAssign(mask, index);
+	_queryCache.ForEach([&](const std::uint64_t queryMask, std::unique_ptr<std::vector<std::uint32_t>>& archetypes)
+	{
+		if ((mask & queryMask) == queryMask) { archetypes->push_back(index); }
+	});
+	return index;
+}
+
+std::uint32_t EntityRegistry::GetAddArchetype(std::uint32_t source, const ComponentTypeInfo* type)
+{
+	Archetype& archetype = *_archetypes[source];
+	if (archetype.AddEdge[type->ID] != ENTITY_INVALID_INDEX) { return archetype.AddEdge[type->ID]; }
+
+	std::vector<const ComponentTypeInfo*> types;
+	types.reserve(archetype.Columns.size() + 1);
+	for (const Archetype::Column& column : archetype.Columns) { types.push_back(column.Info); }
+	types.push_back(type);
+
+	const std::uint32_t destination = FindOrCreateArchetype(archetype.Mask | (1ull << type->ID), types);
+	_archetypes[source]     ->AddEdge   [type->ID] = destination;
+	_archetypes[destination]->RemoveEdge[type->ID] = source;
+	return destination;
+}
+
+std::uint32_t EntityRegistry::GetRemoveArchetype(std::uint32_t source, ComponentTypeID type)
+{
+	Archetype& archetype = *_archetypes[source];
+	if (archetype.RemoveEdge[type] != ENTITY_INVALID_INDEX) { return archetype.RemoveEdge[type]; }
+
+	std::vector<const ComponentTypeInfo*> types;
+	types.reserve(archetype.Columns.size());
+	for (const Archetype::Column& column : archetype.Columns)
+	{
+		if (column.Info->ID != type) { types.push_back(column.Info); }
+	}
+
+	const std::uint32_t destination = FindOrCreateArchetype(archetype.Mask & ~(1ull << type), types);
+	_archetypes[source]     ->RemoveEdge[type] = destination;
+	_archetypes[destination]->AddEdge   [type] = source;
+	return destination;
+}
+
+/****************************************************************************
+*                       MoveEntity
+*************************************************************************//**
+*  @fn        void EntityRegistry::MoveEntity(Entity entity, std::uint32_t destination)
+*  @brief     Move the entity to the destination archetype. Components included in both archetypes
+*             are moved, and the components only in the destination are left unconstructed.
+*  @param[in] Entity entity
+*  @param[in] std::uint32_t destination
+*  @return @@void
+*****************************************************************************/
+void EntityRegistry::MoveEntity(Entity entity, std::uint32_t destination)
+{
+	EntityRecord& record = _records[entity.Index];
+	Archetype& from = *_archetypes[record.Archetype];
+	Archetype& to   = *_archetypes[destination];
+
+	const size_t newRow = to.PushRow(entity);
+	for (size_t column = 0; column < from.Columns.size(); ++column)
+	{
+		const std::int8_t toColumn = to.ColumnIndex[from.Columns[column].Info->ID];
+		if (toColumn < 0) { continue; }
+		from.Columns[column].Info->MoveConstruct(to.GetComponent(toColumn, newRow), from.GetComponent(column, record.Row));
+	}
+
+	RemoveFromArchetype(record);
+	record.Archetype = destination;
+	record.Row       = static_cast<std::uint32_t>(newRow);
+}
+
+void EntityRegistry::RemoveFromArchetype(EntityRecord& record)
+{
+	const Entity moved = _archetypes[record.Archetype]->RemoveRow(record.Row);
+	if (!moved.IsNull()) { _records[moved.Index].Row = record.Row; }
+}
+
+/****************************************************************************
+*                       GetQueryArchetypes
+*************************************************************************//**
+*  @fn        const std::vector<std::uint32_t>& EntityRegistry::GetQueryArchetypes(std::uint64_t mask)
+*  @brief     Return the archetypes which include all components of the mask (cached per mask)
+*  @param[in] std::uint64_t mask
+*  @return @@const std::vector<std::uint32_t>&
+*****************************************************************************/
+const std::vector<std::uint32_t>& EntityRegistry::GetQueryArchetypes(std::uint64_t mask)
+{
+	if (const std::unique_ptr<std::vector<std::uint32_t>>* cached = _queryCache.Find(mask)) { return **cached; }
+
+	auto archetypes = std::make_unique<std::vector<std::uint32_t>>();
+	for (std::uint32_t index = 0; index < _archetypes.size(); ++index)
+	{
+		if ((_archetypes[index]->Mask & mask) == mask) { archetypes->push_back(index); }
+	}
+	return *_queryCache.InsertOrAssign(mask, std::move(archetypes));
+}
+
+/****************************************************************************
+*                       AddToIndex
+*************************************************************************//**
+*  @fn        void EntityRegistry::AddToIndex(Index& index, std::string& key, std::string_view value, std::uint32_t& slot, Entity entity)
+*  @brief     Set the key and append the entity to its bucket. Empty keys are not indexed.
+*  @param[in,out] Index& index
+*  @param[out]    std::string& key (record name or tag)
+*  @param[in]     std::string_view value
+*  @param[out]    std::uint32_t& slot (position in the bucket)
+*  @param[in]     Entity entity
+*  @return @@void
+*****************************************************************************/
+void EntityRegistry::AddToIndex(Index& index, std::string& key, std::string_view value, std::uint32_t& slot, Entity entity)
+{
+	key.assign(value.data(), value.size());
+	if (key.empty()) { slot = ENTITY_INVALID_INDEX; return; }
+
+	std::vector<Entity>* bucket = index.Find(key);
+	if (bucket == nullptr) { bucket = index.TryEmplace(key).first; }
+	slot = static_cast<std::uint32_t>(bucket->size());
+	bucket->push_back(entity);
+}
+
+/****************************************************************************
+*                       RemoveFromIndex
+*************************************************************************//**
+*  @fn        void EntityRegistry::RemoveFromIndex(Index& index, const std::string& key, std::uint32_t& slot, std::vector<EntityRecord>& records, bool isTag)
+*  @brief     Swap remove the entity from its bucket in O(1) and fix the slot of the moved entity
+*  @param[in,out] Index& index
+*  @param[in]     const std::string& key
+*  @param[in,out] std::uint32_t& slot
+*  @param[in]     std::vector<EntityRecord>& records
+*  @param[in]     bool isTag
+*  @return @@void
+*****************************************************************************/
+void EntityRegistry::RemoveFromIndex(Index& index, const std::string& key, std::uint32_t& slot, std::vector<EntityRecord>& records, bool isTag)
+{
+	if (slot == ENTITY_INVALID_INDEX) { return; }
+
+	std::vector<Entity>* bucket = index.Find(key);
+	assert(bucket != nullptr && slot < bucket->size());
+
+	const Entity moved = bucket->back();
+	(*bucket)[slot] = moved;
+	bucket->pop_back();
+	if (slot < bucket->size())
+	{
+		EntityRecord& movedRecord = records[moved.Index];
+		(isTag ? movedRecord.TagSlot : movedRecord.NameSlot) = slot;
+	}
+	if (bucket->empty()) { index.Erase(key); }
+	slot = ENTITY_INVALID_INDEX;
+}
+#pragma endregion Private Function
+#pragma endregion Registry
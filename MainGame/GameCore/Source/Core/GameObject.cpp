@@ -11,6 +11,7 @@
 #include "GameCore/Include/Core/GameObject.hpp"
 #include "GameCore/Include/Core/GameComponent.hpp"
 #include <iostream>
+#include <algorithm>
 //////////////////////////////////////////////////////////////////////////////////
 //                             Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -21,44 +22,116 @@
 //////////////////////////////////////////////////////////////////////////////////
 std::vector<GameObject*> GameObject::_gameObjects;
 std::vector<GameObject*> GameObject::_destroyGameObjects;
+EntityRegistry           GameObject::_registry;
 std::vector<std::string> GameObject::_layerList;
+gm::TransformHierarchy   GameObject::_transformHierarchy;
+bool GameObject::_isHierarchyDirty = true;
 bool GameObject::IsUpdating = false;
 
 
 GameObject::GameObject()
 {
+	_listIndex = _gameObjects.size();
 	_gameObjects.emplace_back(this);
 	_tag      = "";
 	_name     = "";
 	_isActive = true;
 	_parent   = nullptr;
-
+	_entity   = _registry.CreateWith(_name, _tag, GameObjectReference{ this });
+	_isHierarchyDirty = true;
 }
 
 GameObject::~GameObject()
 {
-
+	/*-------------------------------------------------------------------
+	-     Objects deleted directly (or owned by a unique_ptr) must not
+	-     stay in the list and the name / tag index
+	---------------------------------------------------------------------*/
+	if (IsRegistered()) { Unregister(this); }
+
+	const auto pending = std::find(_destroyGameObjects.begin(), _destroyGameObjects.end(), this);
+	if (pending != _destroyGameObjects.end()) { _destroyGameObjects.erase(pending); }
 }
 
 /****************************************************************************
 *                          Find
 *************************************************************************//**
 *  @fn        GameObject* GameObject::Find(const std::string& name)
-*  @brief     This function returns the gameObject with the same name as the assign name.
+*  @brief     This function returns the gameObject with the same name as the assign name. (hashed)
 *  @param[in] std::string name
 *  @return @@GameObject* 
 *****************************************************************************/
 GameObject* GameObject::Find(const std::string& name)
 {
-	for (auto it = _gameObjects.begin(); it != _gameObjects.end(); ++it)
+	return ToGameObject(_registry.Find(name));
+}
+
+/****************************************************************************
+*                          UpdateWorldMatrices
+*************************************************************************//**
+*  @fn        void GameObject::UpdateWorldMatrices()
+*  @brief     Update the world matrices of all gameObjects once (parents before children).
+*             GetTransform().GetMatrix() after this call only reads the cached matrix.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void GameObject::UpdateWorldMatrices()
+{
+	if (_isHierarchyDirty)
 	{
-		
-		if ((*it)->_name == name)
+		std::vector<gm::Transform*> roots;
+		roots.reserve(_gameObjects.size());
+		for (GameObject* gameObject : _gameObjects)
 		{
-			return (*it);
+			if (gameObject->_transform.GetParent() == nullptr) { roots.push_back(&gameObject->_transform); }
 		}
+		_transformHierarchy.Build(roots);
+		_isHierarchyDirty = false;
 	}
-	return nullptr;
+	_transformHierarchy.UpdateWorldMatrices();
+}
+
+/****************************************************************************
+*                          SetParent
+*************************************************************************//**
+*  @fn        void GameObject::SetParent(GameObject* parent)
+*  @brief     Set parent. The transform follows the parent transform.
+*  @param[in] GameObject* parent (nullptr: root)
+*  @return @@void
+*****************************************************************************/
+void GameObject::SetParent(GameObject* parent)
+{
+	_parent = parent;
+	_transform.SetParent(parent != nullptr ? &parent->_transform : nullptr);
+	_isHierarchyDirty = true;
+}
+
+/****************************************************************************
+*                          SetName
+*************************************************************************//**
+*  @fn        void GameObject::SetName(const std::string& name)
+*  @brief     Set name and update the name index
+*  @param[in] std::string name
+*  @return @@void
+*****************************************************************************/
+void GameObject::SetName(const std::string& name)
+{
+	_name = name;
+	if (IsRegistered()) { _registry.SetName(_entity, _name); }
+}
+
+/****************************************************************************
+*                          SetTag
+*************************************************************************//**
+*  @fn        void GameObject::SetTag(const std::string& tag)
+*  @brief     Set tag and update the tag index
+*  @param[in] std::string tag
+*  @return @@void
+*****************************************************************************/
+void GameObject::SetTag(const std::string& tag)
+{
+	_tag = tag;
+	if (IsRegistered()) { _registry.SetTag(_entity, _tag); }
 }
 
 #pragma region Component Management
@@ -95,14 +168,11 @@ bool GameObject::RemoveComponent(Component* component)
 *****************************************************************************/
 std::vector<GameObject*> GameObject::GameObjectsWithTag(const std::string& tag)
 {
+	const std::vector<Entity>& entities = _registry.FindAllWithTag(tag);
+
 	std::vector<GameObject*> gameObjects;
-	for (auto it = _gameObjects.begin(); it != _gameObjects.end(); ++it)
-	{
-		if ((*it)->GetTag() == tag)
-		{
-			gameObjects.emplace_back((*it));
-		}
-	}
+	gameObjects.reserve(entities.size());
+	for (const Entity entity : entities) { gameObjects.push_back(ToGameObject(entity)); }
 	return gameObjects;
 }
 
@@ -121,22 +191,15 @@ bool GameObject::Destroy(GameObject* gameObject)
 
 	if (IsUpdating)
 	{
-		_destroyGameObjects.emplace_back(gameObject);
+		if (std::find(_destroyGameObjects.begin(), _destroyGameObjects.end(), gameObject) == _destroyGameObjects.end())
+		{
+			_destroyGameObjects.emplace_back(gameObject);
+		}
 		gameObject->SetActive(false);
 	}
 	else
 	{
-		for (auto it = _gameObjects.begin(); it != _gameObjects.end(); ++it)
-		{
-			if ((*it) == gameObject)
-			{
-				std::swap(*it, _gameObjects.back());
-				_gameObjects.pop_back(); 
-				_gameObjects.shrink_to_fit();         // memory free
-				delete gameObject;                    // delete object
-				return true;
-			}
-		}
+		return DestroyImmediate(gameObject);
 	}
 
 	return false;
@@ -154,19 +217,10 @@ bool GameObject::DestroyImmediate(GameObject* gameObject)
 {
 	if (gameObject == nullptr) { return false; }
 
-	for (auto it = _gameObjects.begin(); it != _gameObjects.end(); ++it)
-	{
-		if (*it == gameObject)
-		{
-			std::swap(*it, _gameObjects.back());
-			_gameObjects.pop_back();
-			_gameObjects.shrink_to_fit();         // memory free
-			delete gameObject;                    // delete object
-			return true;
-		}
-	}
+	if (!gameObject->IsRegistered()) { return false; }
 
-	return false;
+	delete gameObject;                    // delete object (unregistered in the destructor)
+	return true;
 }
 
 /****************************************************************************
@@ -179,24 +233,14 @@ bool GameObject::DestroyImmediate(GameObject* gameObject)
 *****************************************************************************/
 void GameObject::DestroyAllTagObject(const std::string& tag)
 {
-
-	for (auto it = _gameObjects.begin(); it != _gameObjects.end(); ++it)
+	/*-------------------------------------------------------------------
+	-     Destroy removes the object from the tag bucket, so copy it first
+	---------------------------------------------------------------------*/
+	const std::vector<GameObject*> gameObjects = GameObjectsWithTag(tag);
+	for (auto it = gameObjects.rbegin(); it != gameObjects.rend(); ++it)
 	{
-		if (( *it)->GetTag() == tag)
-		{
-			if (IsUpdating)
-			{
-				_destroyGameObjects.emplace_back(std::move(*it));
-				(*it)->SetActive(false);
-			}
-			else
-			{
-				_gameObjects.erase(it);
-				delete *it;
-			}
-		}
+		Destroy(*it);
 	}
-	_gameObjects.shrink_to_fit();
 }
 
 /****************************************************************************
@@ -220,13 +264,51 @@ void GameObject::DestroyWithChildren(GameObject* gameObject)
 
 void GameObject::ClearDestoyObjects()
 {
-	for (auto it = _destroyGameObjects.begin(); it != _destroyGameObjects.end(); ++it)
+	/*-------------------------------------------------------------------
+	-     The destructor removes the object from _destroyGameObjects,
+	-     so pop it before deleting
+	---------------------------------------------------------------------*/
+	while (!_destroyGameObjects.empty())
 	{
-		Destroy(*it);
+		GameObject* gameObject = _destroyGameObjects.back();
+		_destroyGameObjects.pop_back();
+		DestroyImmediate(gameObject);
 	}
-	_destroyGameObjects.clear();
-	_destroyGameObjects.shrink_to_fit();
 }
+
+/****************************************************************************
+*                          Unregister
+*************************************************************************//**
+*  @fn        void GameObject::Unregister(GameObject* gameObject)
+*  @brief     Remove the gameObject from the list (swap remove) and the name / tag index
+*  @param[in] GameObject* gameObject
+*  @return @@void
+*****************************************************************************/
+void GameObject::Unregister(GameObject* gameObject)
+{
+	const size_t index = gameObject->_listIndex;
+	_gameObjects[index] = _gameObjects.back();
+	_gameObjects[index]->_listIndex = index;
+	_gameObjects.pop_back();
+
+	_registry.Destroy(gameObject->_entity);
+	_isHierarchyDirty = true;
+}
+
+/****************************************************************************
+*                          ToGameObject
+*************************************************************************//**
+*  @fn        GameObject* GameObject::ToGameObject(Entity entity)
+*  @brief     Return the gameObject of the registry entity
+*  @param[in] Entity entity
+*  @return @@GameObject* (nullptr : null or destroyed entity)
+*****************************************************************************/
+GameObject* GameObject::ToGameObject(Entity entity)
+{
+	const GameObjectReference* reference = _registry.GetComponent<GameObjectReference>(entity);
+	return reference != nullptr ? reference->Object : nullptr;
+}
+
 #pragma endregion Destroy
 
 /****************************************************************************
@@ -269,6 +351,9 @@ bool GameObject::ClearAllGameObjects()
 {
 	_gameObjects.clear();
 	_gameObjects.shrink_to_fit();
+	_registry.Clear();
+	_transformHierarchy.Clear();
+	_isHierarchyDirty = true;
 	return true;
 }
 
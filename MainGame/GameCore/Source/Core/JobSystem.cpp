@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   JobSystem.cpp
+///             @brief  Worker threads shared by the engine passes (parallel for)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "GameCore/Include/Profiler.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+JobSystem::~JobSystem()
+{
+	Finalize();
+}
+
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool JobSystem::Initialize(int workerCount)
+*  @brief     Start the worker threads
+*  @param[in] int workerCount (< 0 : hardware_concurrency - 1)
+*  @return @@bool
+*****************************************************************************/
+bool JobSystem::Initialize(int workerCount)
+{
+	Finalize();
+	if (workerCount < 0)
+	{
+		workerCount = (std::max)(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0);
+	}
+
+	_isQuit = false;
+	_workers.reserve(workerCount);
+	for (int i = 0; i < workerCount; ++i)
+	{
+		_workers.emplace_back(&JobSystem::WorkerLoop, this, _jobGeneration);
+	}
+	return true;
+}
+
+/****************************************************************************
+*                       Finalize
+*************************************************************************//**
+*  @fn        void JobSystem::Finalize()
+*  @brief     Stop the worker threads
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void JobSystem::Finalize()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isQuit = true;
+	}
+	_startCondition.notify_all();
+	for (auto& worker : _workers) { worker.join(); }
+	_workers.clear();
+}
+
+/****************************************************************************
+*                       ParallelFor
+*************************************************************************//**
+*  @fn        void JobSystem::ParallelFor(size_t jobCount, JobFunction function, void* context)
+*  @brief     Run function(context, index) for every index of [0, jobCount) and wait for all of them.
+*             Without workers (or with one job) the jobs run on the calling thread in order.
+*  @param[in] size_t jobCount
+*  @param[in] JobFunction function
+*  @param[in] void* context
+*  @return @@void
+*****************************************************************************/
+void JobSystem::ParallelFor(size_t jobCount, JobFunction function, void* context)
+{
+	PROFILE_FUNCTION();
+	if (jobCount == 0) { return; }
+	if (_workers.empty() || jobCount == 1)
+	{
+		for (size_t i = 0; i < jobCount; ++i) { function(context, i); }
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-        Wake up the workers and join them
+	---------------------------------------------------------------------*/
+	std::lock_guard<std::mutex> executeLock(_executeMutex);
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_function      = function;
+		_context       = context;
+		_jobCount      = jobCount;
+		_nextJob       = 0;
+		_activeWorkers = _workers.size();
+		_jobGeneration++;
+	}
+	_startCondition.notify_all();
+
+	ExecuteJobs();
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_endCondition.wait(lock, [this]() { return _activeWorkers == 0; });
+		_function = nullptr;
+		_context  = nullptr;
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       WorkerLoop
+*************************************************************************//**
+*  @fn        void JobSystem::WorkerLoop(std::uint64_t generation)
+*  @brief     Wait for a ParallelFor, take the jobs until they run out and report the end
+*  @param[in] std::uint64_t generation (job generation when the thread was created.
+*             It is not read in the thread, because a job may be issued before the thread starts.)
+*  @return @@void
+*****************************************************************************/
+void JobSystem::WorkerLoop(std::uint64_t generation)
+{
+	PROFILE_THREAD("JobSystem Worker");
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_startCondition.wait(lock, [&]() { return _isQuit || _jobGeneration != generation; });
+			if (_isQuit) { return; }
+			generation = _jobGeneration;
+		}
+
+		ExecuteJobs();
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (--_activeWorkers == 0) { _endCondition.notify_one(); }
+		}
+	}
+}
+
+void JobSystem::ExecuteJobs()
+{
+	PROFILE_FUNCTION();
+	for (size_t job = _nextJob.fetch_add(1); job < _jobCount; job = _nextJob.fetch_add(1))
+	{
+		_function(_context, job);
+	}
+}
+#pragma endregion Private Function
@@ -20,14 +20,35 @@
 #include "GameCore/Include/Model/ModelPipelineState.hpp"
 #include "GameCore/Include/Rendering/GBuffer.hpp"
 #include "GameCore/Include/Rendering/SSAO.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
+#include "GameCore/Include/Rendering/ClusteredLighting.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "GameCore/Include/Collision/DynamicAABBTree.hpp"
+#include "GameCore/Include/Camera.hpp"
 #include "GameCore/Include/Sprite/TextRenderer.hpp"
 #include "GameCore/Include/Sprite/Sprite.hpp"
 #include "GameCore/Include/Sprite/Font.hpp"
 #include "DirectX12/Include/Core/DirectX12Buffer.hpp"
+#include "DirectX12/Include/Core/DirectX12TextureStreamer.hpp"
+#include "GameCore/Include/Profiler.hpp"
+#include <cfloat>
+#include <cstring>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
-
+namespace
+{
+	/* copy the array to the frame upload arena (0 : empty or the arena is full) */
+	template<class T>
+	D3D12_GPU_VIRTUAL_ADDRESS UploadArray(UploadArena& arena, const T* data, size_t count)
+	{
+		if (count == 0) { return 0; }
+		UploadAllocation allocation = arena.Allocate(sizeof(T) * count);
+		if (!allocation.IsValid()) { return 0; }
+		std::memcpy(allocation.CPU, data, sizeof(T) * count);
+		return allocation.GPU;
+	}
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Implement
@@ -45,6 +66,11 @@ RenderingEngine::RenderingEngine()
 	SSAOPtr         ssao             = std::make_unique<SSAO>();
 	TextRendererPtr textRenderer     = std::make_unique<TextRenderer>();
 	SpriteRendererPtr spriteRenderer = std::make_unique<SpriteRenderer>();
+	VisibilityPtr     visibility     = std::make_unique<VisibilityCulling>();
+	BoundsArrayPtr    bounds         = std::make_unique<VisibilityBoundsArray>();
+	ClusteredLightingPtr clustered   = std::make_unique<ClusteredLighting>();
+	PickingTreePtr       pickingTree = std::make_unique<DynamicAABBTree>();
+	JobSystemPtr         jobSystem   = std::make_unique<JobSystem>();
 
 	sceneLights.get()->PointLightNum = NUM_POINT_LIGHTS;
 	sceneLights.get()->SpotLightNum  = NUM_SPOT_LIGHTS;
@@ -59,6 +85,11 @@ RenderingEngine::RenderingEngine()
 	_ssao           = std::move(ssao);
 	_textRenderer   = std::move(textRenderer);
 	_spriteRenderer = std::move(spriteRenderer);
+	_visibilityCulling = std::move(visibility);
+	_visibilityBounds  = std::move(bounds);
+	_clusteredLighting = std::move(clustered);
+	_pickingTree       = std::move(pickingTree);
+	_jobSystem         = std::move(jobSystem);
 
 	for (int i = 0; i < NUM_DIRECTIONAL_LIGHTS; ++i)
 	{
@@ -103,12 +134,18 @@ bool RenderingEngine::Initialize(int width, int height)
 	_ssao          .get()->Initialize(width, height, _gBuffer.get()->GetGBuffer(GBufferType::Normal), _zPrepass.get()->GetFinalColorBuffer());
 	_textRenderer  .get()->Initialize();
 	_spriteRenderer.get()->Initialize();
+	_jobSystem        .get()->Initialize();
+	_visibilityCulling.get()->Initialize(_jobSystem.get());
+	_clusteredLighting.get()->Initialize(_jobSystem.get());
+	TextureStreamer::Instance().Initialize();
 	return true;
 }
 
 void RenderingEngine::OnAfterSceneTransition()
 {
 	_textRenderer.get()->ReloadFont();
+	_camera = nullptr;
+	ClearClusteredLights();
 }
 
 void RenderingEngine::Finalize()
@@ -123,12 +160,20 @@ void RenderingEngine::Finalize()
 	_ssao          .get()->Finalize();
 	_textRenderer  .get()->Finalize();
 	_spriteRenderer.get()->Finalize();
+	_visibilityCulling.get()->Finalize();
+	_clusteredLighting.get()->Finalize();
+	_jobSystem        .get()->Finalize();
+	TextureStreamer::Instance().Finalize();
 	_sceneLights.reset();
 
 	_sceneLightsBuffer.reset();
 
 	_forwardRenderingActors.clear();  _forwardRenderingActors.shrink_to_fit();
 	_differedRenderingActors.clear(); _differedRenderingActors.shrink_to_fit();
+	_cullingActors.clear();           _cullingActors.shrink_to_fit();
+	_pickingTree.get()->Clear();
+	_pickingProxies.clear();
+	_camera = nullptr;
 }
 /****************************************************************************
 *                       OnResize
@@ -156,9 +201,14 @@ bool RenderingEngine::OnResize(int newWidth, int newHeight)
 *****************************************************************************/
 bool RenderingEngine::Draw()
 {
+	PROFILE_FUNCTION();
 	CopyToGPUSceneLightsBuffer();
 	OnResize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
 	/*-------------------------------------------------------------------
+	-         Texture streaming (the mips requested in the last frame)
+	---------------------------------------------------------------------*/
+	TextureStreamer::Instance().Update();
+	/*-------------------------------------------------------------------
 	-         Is there a scene object
 	---------------------------------------------------------------------*/
 	if (_scene == NULL)                              { return false; }
@@ -182,6 +232,9 @@ bool RenderingEngine::Draw()
 	/*-------------------------------------------------------------------
 	-         Draw 3D model  (tile based forward rendering)
 	---------------------------------------------------------------------*/
+	CullForwardRenderingActors();
+	RequestStreamingTextures();
+	BuildClusteredLights();
 	if (!DrawForwardRenderingAllModel())             { return false; }
 	return true;
 }
@@ -299,6 +352,9 @@ bool RenderingEngine::ClearAllRenderingPass()
 	_gBuffer .get()->ClearActors();
 	_forwardRenderingActors .clear();
 	_differedRenderingActors.clear();
+	_pickingTree.get()->Clear();
+	_pickingProxies.clear();
+	_camera = nullptr;
 	return true;
 }
 /****************************************************************************
@@ -361,6 +417,8 @@ bool RenderingEngine::ClearGBufferActor(GameActor& gameActor)
 bool RenderingEngine::ClearForwardRenderingActors()
 {
 	_forwardRenderingActors.clear();
+	_pickingTree.get()->Clear();
+	_pickingProxies.clear();
 	return true;
 }
 /****************************************************************************
@@ -378,6 +436,7 @@ bool RenderingEngine::ClearForwardRenderingActor(GameActor& gameActor)
 		if (_forwardRenderingActors[i] == &gameActor)
 		{
 			std::erase(_forwardRenderingActors, _forwardRenderingActors[i]);
+			DestroyPickingProxy(&gameActor);
 			return true;
 		}
 	}
@@ -413,11 +472,12 @@ bool RenderingEngine::ClearDifferedRenderingActor(GameActor& gameActor)
 *****************************************************************************/
 void RenderingEngine::AddObjectToShadowMap(GameActor& gameActor, int directionalLightNo, bool useNear, bool useMedium, bool useFar)
 {
+	if (directionalLightNo < 0 || directionalLightNo >= NUM_DIRECTIONAL_LIGHTS) { return; }
 	GameActor* nearActor   = useNear   ? &gameActor : nullptr;
 	GameActor* mediumActor = useMedium ? &gameActor : nullptr;
 	GameActor* farActor    = useFar    ? &gameActor : nullptr;
 	
-	_cascadeShadowMaps->get()->AddActor(nearActor, mediumActor, farActor);
+	_cascadeShadowMaps[directionalLightNo].get()->AddActor(nearActor, mediumActor, farActor);
 }                                        
 
 /****************************************************************************
@@ -484,6 +544,18 @@ void RenderingEngine::EnableSSAO(bool enabled)
 		_renderEffectFlag = _renderEffectFlag & ~(UINT32)(RenderEffectFlag::AllowSSAO);
 	}
 }
+
+void RenderingEngine::EnableClusteredLighting(bool enabled)
+{
+	if (enabled)
+	{
+		_renderEffectFlag = _renderEffectFlag | (UINT32)RenderEffectFlag::AllowClusteredLighting;
+	}
+	else
+	{
+		_renderEffectFlag = _renderEffectFlag & ~(UINT32)(RenderEffectFlag::AllowClusteredLighting);
+	}
+}
 /****************************************************************************
 *                       SetDirectionalLight
 *************************************************************************//**
@@ -535,6 +607,48 @@ bool RenderingEngine::SetSpotLight(int lightID, const SpotLight& spotLight)
 	return true;
 }
 
+/****************************************************************************
+*                       AddClusteredPointLight
+*************************************************************************//**
+*  @fn        int RenderingEngine::AddClusteredPointLight(const PointLight& pointLight)
+*  @brief     Add a point light only for the clustered lighting (index in the cluster point light buffer)
+*  @param[in] PointLight& pointLight
+*  @return @@int
+*****************************************************************************/
+int RenderingEngine::AddClusteredPointLight(const PointLight& pointLight)
+{
+	_addedPointLights.push_back(pointLight);
+	return _sceneLights.get()->PointLightNum + static_cast<int>(_addedPointLights.size()) - 1;
+}
+
+/****************************************************************************
+*                       AddClusteredSpotLight
+*************************************************************************//**
+*  @fn        int RenderingEngine::AddClusteredSpotLight(const SpotLight& spotLight)
+*  @brief     Add a spot light only for the clustered lighting (index in the cluster spot light buffer)
+*  @param[in] SpotLight& spotLight
+*  @return @@int
+*****************************************************************************/
+int RenderingEngine::AddClusteredSpotLight(const SpotLight& spotLight)
+{
+	_addedSpotLights.push_back(spotLight);
+	return _sceneLights.get()->SpotLightNum + static_cast<int>(_addedSpotLights.size()) - 1;
+}
+
+/****************************************************************************
+*                       ClearClusteredLights
+*************************************************************************//**
+*  @fn        void RenderingEngine::ClearClusteredLights()
+*  @brief     Remove the lights added by AddClusteredPointLight / AddClusteredSpotLight
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::ClearClusteredLights()
+{
+	_addedPointLights.clear();
+	_addedSpotLights .clear();
+}
+
 /****************************************************************************
 *                       SetSceneGPUAddress
 *************************************************************************//**
@@ -581,12 +695,15 @@ void RenderingEngine::CopyToGPUSceneLightsBuffer()
 *****************************************************************************/
 bool RenderingEngine::DrawForwardRenderingAllModel()
 {
-	for (auto model : _forwardRenderingActors)
+	PROFILE_FUNCTION();
+	for (size_t i = 0; i < _forwardRenderingActors.size(); ++i)
 	{
+		GameActor* model = _forwardRenderingActors[i];
 		/*-------------------------------------------------------------------
-		-               Active check
+		-               Active and visibility check
 		---------------------------------------------------------------------*/
-		if (!model->IsActive()) { continue; }
+		if (!model->IsActive())            { continue; }
+		if (!_cullingActors[i].IsVisible)  { continue; }
 
 		/*-------------------------------------------------------------------
 		-               Draw forward rendering all model
@@ -595,7 +712,7 @@ bool RenderingEngine::DrawForwardRenderingAllModel()
 		{
 			case ActorType::PMX: 
 			{ 
-				if (!DrawForwardRenderingPMXModel(model)) { return false; }  break; 
+				if (!DrawForwardRenderingPMXModel(model, _cullingActors[i])) { return false; }  break; 
 			}
 			case ActorType::Primitive:
 			{
@@ -611,12 +728,13 @@ bool RenderingEngine::DrawForwardRenderingAllModel()
 /****************************************************************************
 *                       DrawForwardRenderingPMXModel
 *************************************************************************//**
-*  @fn        bool RenderingEngine::DrawForwardRenderingPrimitiveModel(GameActor* gameActor)
-*  @brief     draw PMX 3DModel
+*  @fn        bool RenderingEngine::DrawForwardRenderingPMXModel(GameActor* gameActor, const CullingActor& culling)
+*  @brief     draw PMX 3DModel (only the visible materials when the model has been culled)
 *  @param[in] GameActor* gameActor
+*  @param[in] const CullingActor& culling
 *  @return @@bool
 *****************************************************************************/
-bool RenderingEngine::DrawForwardRenderingPMXModel(GameActor* gameActor)
+bool RenderingEngine::DrawForwardRenderingPMXModel(GameActor* gameActor, const CullingActor& culling)
 {
 	/*-------------------------------------------------------------------
 	-               Get pmxModel
@@ -633,6 +751,10 @@ bool RenderingEngine::DrawForwardRenderingPMXModel(GameActor* gameActor)
 	commandList->SetGraphicsRootDescriptorTable(9,  _lightCulling.get()->GetPointLightList().GetGPUSRV()); // point light culling list 
 	commandList->SetGraphicsRootDescriptorTable(10, _lightCulling.get()->GetSpotLightList ().GetGPUSRV()); // spot  light culling list 
 	commandList->SetGraphicsRootDescriptorTable(11, _ssao.get()->GetFinalColorBuffer().GetGPUSRV());       // ssao
+	if (culling.IsCulled)
+	{
+		return actor->Draw(_scene, _sceneLightsBuffer.get()->Resource()->GetGPUVirtualAddress(), culling.VisibleMaterials);
+	}
 	return actor->Draw(_scene, _sceneLightsBuffer.get()->Resource()->GetGPUVirtualAddress());
 }
 
@@ -664,11 +786,264 @@ bool RenderingEngine::DrawForwardRenderingPrimitiveModel(GameActor* gameActor)
 	return actor->Draw(_scene, _sceneLightsBuffer.get()->Resource()->GetGPUVirtualAddress());
 }
 
+/****************************************************************************
+*                       CullForwardRenderingActors
+*************************************************************************//**
+*  @fn        void RenderingEngine::CullForwardRenderingActors()
+*  @brief     Test the world boxes of the forward rendering actors (and the PMX materials)
+*             against the camera frustum. Actors without bounds are always drawn.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::CullForwardRenderingActors()
+{
+	PROFILE_FUNCTION();
+	_cullingActors.resize(_forwardRenderingActors.size());
+	for (auto& culling : _cullingActors) { culling.IsCulled = false; culling.IsVisible = true; }
+	if (_camera == nullptr) { return; }
+
+	/*-------------------------------------------------------------------
+	-               Collect the bounds
+	---------------------------------------------------------------------*/
+	VisibilityBoundsArray& bounds = *_visibilityBounds.get();
+	bounds.Clear();
+	for (size_t i = 0; i < _forwardRenderingActors.size(); ++i)
+	{
+		GameActor* model      = _forwardRenderingActors[i];
+		CullingActor& culling = _cullingActors[i];
+		if (!model->IsActive()) { DestroyPickingProxy(model); continue; }
+
+		switch ((ActorType)model->GetActorType())
+		{
+			case ActorType::PMX:
+			{
+				PMXModel* actor = (PMXModel*)model;
+				if (actor->GetWorldBox().IsEmpty()) { DestroyPickingProxy(model); break; }
+				UpdatePickingProxy(model, actor->GetWorldBox());
+				const std::vector<VisibilityBox>& materialBoxes = actor->GetMaterialWorldBoxes();
+				culling.IsCulled           = true;
+				culling.BoundIndex         = static_cast<UINT32>(bounds.Size());
+				bounds.Add(actor->GetWorldBox());
+				culling.MaterialBoundIndex = static_cast<UINT32>(bounds.Size());
+				culling.MaterialCount      = static_cast<UINT32>(materialBoxes.size());
+				for (const auto& box : materialBoxes) { bounds.Add(box); }
+				break;
+			}
+			case ActorType::Primitive:
+			{
+				const VisibilityBox box = ((PrimitiveModel*)model)->GetWorldBox();
+				if (box.IsEmpty()) { DestroyPickingProxy(model); break; }
+				UpdatePickingProxy(model, box);
+				culling.IsCulled   = true;
+				culling.BoundIndex = static_cast<UINT32>(bounds.Size());
+				bounds.Add(box);
+				break;
+			}
+			default: { break; }
+		}
+	}
+	if (bounds.Size() == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-               Execute culling
+	---------------------------------------------------------------------*/
+	_visibilityCulling.get()->ClearViews();
+	_visibilityCulling.get()->AddView(_camera->GetFrustumPlanes());
+	_visibilityCulling.get()->Execute(bounds);
+
+	_isVisibleBound.assign(bounds.Size(), 0);
+	for (std::uint32_t index : _visibilityCulling.get()->GetVisibleList(0)) { _isVisibleBound[index] = 1; }
+
+	for (auto& culling : _cullingActors)
+	{
+		if (!culling.IsCulled) { continue; }
+		culling.IsVisible = _isVisibleBound[culling.BoundIndex] != 0;
+		culling.VisibleMaterials.clear();
+		for (UINT32 m = 0; m < culling.MaterialCount; ++m)
+		{
+			if (_isVisibleBound[culling.MaterialBoundIndex + m]) { culling.VisibleMaterials.push_back(m); }
+		}
+	}
+}
+
+/****************************************************************************
+*                       PickForwardRenderingActor
+*************************************************************************//**
+*  @fn        GameActor* RenderingEngine::PickForwardRenderingActor(float screenX, float screenY) const
+*  @brief     Cast the camera ray through the screen pixel into the picking tree
+*             and return the closest forward rendering actor (world box test).
+*             The boxes enclosing the camera (the stage etc.) are skipped, otherwise they would hide every actor inside.
+*  @param[in] float screenX (pixel)
+*  @param[in] float screenY (pixel)
+*  @return @@GameActor* (nullptr : no hit or no camera)
+*****************************************************************************/
+GameActor* RenderingEngine::PickForwardRenderingActor(float screenX, float screenY) const
+{
+	if (_camera == nullptr) { return nullptr; }
+
+	gm::Float3 origin, direction;
+	_camera->GetScreenRay(screenX, screenY, origin, direction);
+
+	DynamicAABBTreeRaycastHit hit;
+	if (!_pickingTree.get()->Raycast(origin, direction, _camera->GetFarZ(), hit, true)) { return nullptr; }
+	return hit.Actor;
+}
+
+/****************************************************************************
+*                       UpdatePickingProxy
+*************************************************************************//**
+*  @fn        void RenderingEngine::UpdatePickingProxy(GameActor* gameActor, const VisibilityBox& worldBox)
+*  @brief     Insert the world box of the actor into the picking tree, or move its proxy.
+*             The proxy is reinserted only when the box leaves the fattened box.
+*  @param[in] GameActor* gameActor
+*  @param[in] const VisibilityBox& worldBox
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::UpdatePickingProxy(GameActor* gameActor, const VisibilityBox& worldBox)
+{
+	const gm::Float3 center = gm::Float3(
+		0.5f * (worldBox.Min.x + worldBox.Max.x), 0.5f * (worldBox.Min.y + worldBox.Max.y), 0.5f * (worldBox.Min.z + worldBox.Max.z));
+	const gm::Float3 size   = gm::Float3(
+		worldBox.Max.x - worldBox.Min.x, worldBox.Max.y - worldBox.Min.y, worldBox.Max.z - worldBox.Min.z);
+	const Collider3D collider = Collider3D::CreateBoxCollider(center, size);
+
+	const auto proxy = _pickingProxies.find(gameActor);
+	if (proxy == _pickingProxies.end())
+	{
+		const int proxyID = _pickingTree.get()->CreateProxy(collider, gameActor);
+		if (proxyID != AABB_TREE_NULL_NODE) { _pickingProxies.emplace(gameActor, proxyID); }
+		return;
+	}
+	_pickingTree.get()->MoveProxy(proxy->second, collider);
+}
+
+/****************************************************************************
+*                       DestroyPickingProxy
+*************************************************************************//**
+*  @fn        void RenderingEngine::DestroyPickingProxy(const GameActor* gameActor)
+*  @brief     Remove the actor from the picking tree (no effect when the actor has no proxy)
+*  @param[in] const GameActor* gameActor
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::DestroyPickingProxy(const GameActor* gameActor)
+{
+	const auto proxy = _pickingProxies.find(gameActor);
+	if (proxy == _pickingProxies.end()) { return; }
+	_pickingTree.get()->DestroyProxy(proxy->second);
+	_pickingProxies.erase(proxy);
+}
+
+/****************************************************************************
+*                       RequestStreamingTextures
+*************************************************************************//**
+*  @fn        void RenderingEngine::RequestStreamingTextures()
+*  @brief     Request the texture mips of the visible PMX materials from their projected size
+*             (bounding sphere diameter on the screen). Without the camera, the full resolution is requested.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::RequestStreamingTextures()
+{
+	PROFILE_FUNCTION();
+	TextureStreamer& streamer = TextureStreamer::Instance();
+	if (!streamer.IsInitialized()) { return; }
+
+	/*-------------------------------------------------------------------
+	-               Pixels per world unit at distance 1
+	---------------------------------------------------------------------*/
+	gm::Float3 eye          = gm::Float3(0.0f, 0.0f, 0.0f);
+	float      pixelPerUnit = 0.0f;
+	if (_camera != nullptr)
+	{
+		eye          = _camera->GetPosition().ToFloat3();
+		pixelPerUnit = static_cast<float>(Screen::GetScreenHeight()) / (2.0f * std::tan(0.5f * _camera->GetFovVertical()));
+	}
+
+	const VisibilityBoundsArray& bounds = *_visibilityBounds.get();
+	for (size_t i = 0; i < _forwardRenderingActors.size(); ++i)
+	{
+		GameActor* model = _forwardRenderingActors[i];
+		const CullingActor& culling = _cullingActors[i];
+		if (!model->IsActive() || !culling.IsVisible)             { continue; }
+		if ((ActorType)model->GetActorType() != ActorType::PMX)   { continue; }
+
+		PMXData* data = ((PMXModel*)model)->GetPMXData();
+		if (!culling.IsCulled)
+		{
+			for (int m = 0; m < static_cast<int>(data->GetMaterialCount()); ++m) { streamer.Request(data->GetTextureStreamID(m), FLT_MAX); }
+			continue;
+		}
+
+		for (UINT32 m : culling.VisibleMaterials)
+		{
+			const UINT32 index  = culling.MaterialBoundIndex + m;
+			const float  x      = bounds.CenterX[index] - eye.x;
+			const float  y      = bounds.CenterY[index] - eye.y;
+			const float  z      = bounds.CenterZ[index] - eye.z;
+			const float  radius = bounds.Radius[index];
+			const float  distance = std::sqrt(x * x + y * y + z * z) - radius; // nearest point of the sphere
+			const float  screenSize = distance > 0.0f ? 2.0f * radius * pixelPerUnit / distance : FLT_MAX;
+			streamer.Request(data->GetTextureStreamID(static_cast<int>(m)), screenSize);
+		}
+	}
+}
+
+/****************************************************************************
+*                       BuildClusteredLights
+*************************************************************************//**
+*  @fn        void RenderingEngine::BuildClusteredLights()
+*  @brief     Bin the scene lights and the added lights into the clusters of the camera,
+*             and upload the light lists to the frame upload arena.
+*             Skipped unless EnableClusteredLighting(true), because no forward shader reads the lists yet.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void RenderingEngine::BuildClusteredLights()
+{
+	PROFILE_FUNCTION();
+	_clusteredLightAddress = ClusteredLightAddress();
+	if (!(_renderEffectFlag & (UINT32)RenderEffectFlag::AllowClusteredLighting)) { return; }
+	if (_camera == nullptr) { return; }
+
+	/*-------------------------------------------------------------------
+	-               Scene lights + added lights
+	---------------------------------------------------------------------*/
+	const SceneLightConstants& sceneLights = *_sceneLights.get();
+	_clusteredPointLights.assign(sceneLights.PointLights, sceneLights.PointLights + sceneLights.PointLightNum);
+	_clusteredPointLights.insert(_clusteredPointLights.end(), _addedPointLights.begin(), _addedPointLights.end());
+	_clusteredSpotLights .assign(sceneLights.SpotLights, sceneLights.SpotLights + sceneLights.SpotLightNum);
+	_clusteredSpotLights .insert(_clusteredSpotLights.end(), _addedSpotLights.begin(), _addedSpotLights.end());
+
+	/*-------------------------------------------------------------------
+	-               Bin the lights
+	---------------------------------------------------------------------*/
+	ClusterView view;
+	view.ViewMatrix  = _camera->GetViewMatrix4x4f();
+	view.NearZ       = _camera->GetNearZ();
+	view.FarZ        = _camera->GetFarZ();
+	view.TanHalfFovY = std::tan(0.5f * _camera->GetFovVertical());
+	view.TanHalfFovX = view.TanHalfFovY * _camera->GetAspect();
+
+	ClusteredLighting& clustered = *_clusteredLighting.get();
+	clustered.Build(view, _clusteredPointLights.data(), _clusteredPointLights.size(), _clusteredSpotLights.data(), _clusteredSpotLights.size());
+
+	/*-------------------------------------------------------------------
+	-               Upload (valid until the frame is retired)
+	---------------------------------------------------------------------*/
+	UploadArena& arena = DirectX12::Instance().GetFrameUploadArena();
+	_clusteredLightAddress.Constants    = arena.Upload(clustered.GetConstants()).GPU;
+	_clusteredLightAddress.PointLights  = UploadArray(arena, _clusteredPointLights.data(), _clusteredPointLights.size());
+	_clusteredLightAddress.SpotLights   = UploadArray(arena, _clusteredSpotLights.data() , _clusteredSpotLights.size());
+	_clusteredLightAddress.LightRanges  = UploadArray(arena, clustered.GetLightRanges().data() , clustered.GetLightRanges().size());
+	_clusteredLightAddress.LightIndices = UploadArray(arena, clustered.GetLightIndices().data(), clustered.GetLightIndices().size());
+}
+
 bool RenderingEngine::DrawShadowMap()
 {
+	if (_camera == nullptr) { return true; }
 	for (int i = 0; i < _countof(_cascadeShadowMaps); ++i)
 	{
-		_cascadeShadowMaps[i].get()->Execute(_sceneLights.get()->DirectionalLights[i].Direction);
+		_cascadeShadowMaps[i].get()->Execute(_sceneLights.get()->DirectionalLights[i].Direction, *_camera, *_visibilityCulling.get());
 	}
 	return true;
 }
@@ -0,0 +1,746 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   JsonDocument.cpp
+///             @brief  Arena based json parser (DOM and SAX)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/File/JsonDocument.hpp"
+#include <filesystem>
+#include <fstream>
+#include <charconv>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define JSON_PARSER_SSE2
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr std::uint32_t HASH_EMPTY           = 0xFFFFFFFFu;
+	constexpr size_t        MAX_ARENA_BLOCK_SIZE = 4 * 1024 * 1024;
+
+	inline std::uint32_t HashCapacity(std::uint32_t count)
+	{
+		std::uint32_t capacity = 16;
+		while (capacity < count * 2) { capacity <<= 1; }
+		return capacity;
+	}
+
+	inline int HexToInt(char c)
+	{
+		if (c >= '0' && c <= '9') { return c - '0'; }
+		if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+		if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+		return -1;
+	}
+
+	inline bool ReadHex4(const char* p, std::uint32_t& value)
+	{
+		value = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			const int digit = HexToInt(p[i]);
+			if (digit < 0) { return false; }
+			value = (value << 4) | static_cast<std::uint32_t>(digit);
+		}
+		return true;
+	}
+
+	inline size_t EncodeUTF8(std::uint32_t codePoint, char* destination)
+	{
+		if (codePoint < 0x80)    { destination[0] = static_cast<char>(codePoint); return 1; }
+		if (codePoint < 0x800)
+		{
+			destination[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+			destination[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+			return 2;
+		}
+		if (codePoint < 0x10000)
+		{
+			destination[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+			destination[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			destination[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+			return 3;
+		}
+		destination[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+		destination[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+		destination[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		destination[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 4;
+	}
+
+	/****************************************************************************
+	*				  			JsonParser
+	*************************************************************************//**
+	*  @class     JsonParser
+	*  @brief     Recursive descent parser which reports to Handler (DomBuilder or JsonHandler).
+	*             It never allocates: strings and keys are reported as views into the source.
+	*****************************************************************************/
+	template<class Handler>
+	class JsonParser
+	{
+	public:
+		bool Parse()
+		{
+			/*-------------------------------------------------------------------
+			-              Skip UTF-8 BOM
+			---------------------------------------------------------------------*/
+			if (_end - _current >= 3 && std::memcmp(_current, "\xEF\xBB\xBF", 3) == 0) { _current += 3; }
+
+			SkipSpace();
+			if (!ParseValue(0)) { return false; }
+			SkipSpace();
+			if (_current != _end && *_current != '\0') { return Error("unexpected data after the root value"); }
+			return true;
+		}
+
+		const char* GetErrorMessage() const { return _errorMessage; }
+		size_t      GetErrorOffset () const { return static_cast<size_t>(_current - _begin); }
+
+		JsonParser(const char* data, size_t byteSize, Handler& handler) : _begin(data), _current(data), _end(data + byteSize), _handler(handler) {};
+
+	private:
+		bool Error(const char* message) { _errorMessage = message; return false; }
+
+		void SkipSpace()
+		{
+			while (_current != _end && (*_current == ' ' || *_current == '\n' || *_current == '\r' || *_current == '\t')) { ++_current; }
+		}
+
+		bool ParseValue(int depth)
+		{
+			if (_current == _end) { return Error("unexpected end of data"); }
+			switch (*_current)
+			{
+				case '"':
+				{
+					const char* string = nullptr; size_t length = 0; bool hasEscape = false;
+					if (!ParseString(string, length, hasEscape)) { return false; }
+					return _handler.OnString(std::string_view(string, length), hasEscape) || Error("stopped by the handler");
+				}
+				case '{': return ParseObject(depth + 1);
+				case '[': return ParseArray (depth + 1);
+				case 't': return ParseLiteral("true" , 4) && (_handler.OnBool(true)  || Error("stopped by the handler"));
+				case 'f': return ParseLiteral("false", 5) && (_handler.OnBool(false) || Error("stopped by the handler"));
+				case 'n': return ParseLiteral("null" , 4) && (_handler.OnNull()      || Error("stopped by the handler"));
+				default : return ParseNumber();
+			}
+		}
+
+		bool ParseLiteral(const char* literal, size_t length)
+		{
+			if (static_cast<size_t>(_end - _current) < length || std::memcmp(_current, literal, length) != 0) { return Error("invalid literal"); }
+			_current += length;
+			return true;
+		}
+
+		/*-------------------------------------------------------------------
+		-              String : find the closing quote (16 bytes at a time with SSE2)
+		---------------------------------------------------------------------*/
+		bool ParseString(const char*& string, size_t& length, bool& hasEscape)
+		{
+			++_current; // skip first double quotation
+			const char* start = _current;
+			hasEscape = false;
+
+			while (true)
+			{
+#if defined(JSON_PARSER_SSE2)
+				const __m128i quote     = _mm_set1_epi8('"');
+				const __m128i backSlash = _mm_set1_epi8('\\');
+				while (_end - _current >= 16)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_current));
+					const int     mask  = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backSlash)));
+					if (mask != 0)
+					{
+						int offset = 0;
+						while (((mask >> offset) & 1) == 0) { ++offset; }
+						_current += offset;
+						break;
+					}
+					_current += 16;
+				}
+#endif
+				while (_current != _end && *_current != '"' && *_current != '\\') { ++_current; }
+				if (_current == _end) { return Error("unterminated string"); }
+				if (*_current == '"') { break; }
+
+				/*-------------------------------------------------------------------
+				-              Escape sequence (validated here, decoded lazily)
+				---------------------------------------------------------------------*/
+				hasEscape = true;
+				if (_end - _current < 2) { return Error("unterminated string"); }
+				switch (_current[1])
+				{
+					case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+						_current += 2;
+						break;
+					case 'u':
+					{
+						std::uint32_t codeUnit = 0;
+						if (_end - _current < 6 || !ReadHex4(_current + 2, codeUnit)) { return Error("invalid unicode escape"); }
+						_current += 6;
+						break;
+					}
+					default: return Error("invalid escape sequence");
+				}
+			}
+
+			string = start;
+			length = static_cast<size_t>(_current - start);
+			++_current; // skip last double quotation
+			return true;
+		}
+
+		/*-------------------------------------------------------------------
+		-              Number : integers up to 15 digits are converted directly
+		---------------------------------------------------------------------*/
+		bool ParseNumber()
+		{
+			const char* start = _current;
+			bool isNegative = false;
+			if (_current != _end && *_current == '-') { isNegative = true; ++_current; }
+
+			const char* integerStart = _current;
+			std::uint64_t integer = 0;
+			while (_current != _end && *_current >= '0' && *_current <= '9')
+			{
+				integer = integer * 10 + static_cast<std::uint64_t>(*_current - '0');
+				++_current;
+			}
+			const size_t digitCount = static_cast<size_t>(_current - integerStart);
+			if (digitCount == 0)                         { return Error("invalid value"); }
+			if (digitCount > 1 && *integerStart == '0')  { return Error("leading zero in number"); }
+
+			bool isInteger = true;
+			if (_current != _end && *_current == '.')
+			{
+				isInteger = false;
+				++_current;
+				const char* fractionStart = _current;
+				while (_current != _end && *_current >= '0' && *_current <= '9') { ++_current; }
+				if (_current == fractionStart) { return Error("invalid fraction"); }
+			}
+			if (_current != _end && (*_current == 'e' || *_current == 'E'))
+			{
+				isInteger = false;
+				++_current;
+				if (_current != _end && (*_current == '+' || *_current == '-')) { ++_current; }
+				const char* exponentStart = _current;
+				while (_current != _end && *_current >= '0' && *_current <= '9') { ++_current; }
+				if (_current == exponentStart) { return Error("invalid exponent"); }
+			}
+
+			double value = 0.0;
+			if (isInteger && digitCount <= 15)
+			{
+				value = static_cast<double>(integer);
+				if (isNegative) { value = -value; }
+			}
+			else
+			{
+				const auto result = std::from_chars(start, _current, value);
+				if (result.ec != std::errc() && result.ec != std::errc::result_out_of_range) { return Error("invalid number"); }
+			}
+			return _handler.OnNumber(value) || Error("stopped by the handler");
+		}
+
+		bool ParseArray(int depth)
+		{
+			if (depth > JSON_MAX_DEPTH)   { return Error("nesting is too deep"); }
+			if (!_handler.OnStartArray()) { return Error("stopped by the handler"); }
+
+			++_current; // skip first bracket
+			SkipSpace();
+			std::uint32_t count = 0;
+			if (_current != _end && *_current == ']')
+			{
+				++_current;
+				return _handler.OnEndArray(0) || Error("stopped by the handler");
+			}
+
+			while (true)
+			{
+				if (!ParseValue(depth)) { return false; }
+				++count;
+				SkipSpace();
+				if (_current == _end) { return Error("unterminated array"); }
+				if (*_current == ']') { ++_current; break; }
+				if (*_current != ',') { return Error("expected ',' or ']'"); }
+				++_current; // skip comma
+				SkipSpace();
+			}
+			return _handler.OnEndArray(count) || Error("stopped by the handler");
+		}
+
+		bool ParseObject(int depth)
+		{
+			if (depth > JSON_MAX_DEPTH)    { return Error("nesting is too deep"); }
+			if (!_handler.OnStartObject()) { return Error("stopped by the handler"); }
+
+			++_current; // skip first brace
+			SkipSpace();
+			std::uint32_t count = 0;
+			if (_current != _end && *_current == '}')
+			{
+				++_current;
+				return _handler.OnEndObject(0) || Error("stopped by the handler");
+			}
+
+			while (true)
+			{
+				if (_current == _end || *_current != '"') { return Error("expected a key"); }
+				const char* key = nullptr; size_t keyLength = 0; bool hasEscape = false;
+				if (!ParseString(key, keyLength, hasEscape)) { return false; }
+				if (!_handler.OnKey(std::string_view(key, keyLength), hasEscape)) { return Error("stopped by the handler"); }
+
+				SkipSpace();
+				if (_current == _end || *_current != ':') { return Error("expected ':'"); }
+				++_current; // skip colon
+				SkipSpace();
+
+				if (!ParseValue(depth)) { return false; }
+				++count;
+				SkipSpace();
+				if (_current == _end) { return Error("unterminated object"); }
+				if (*_current == '}') { ++_current; break; }
+				if (*_current != ',') { return Error("expected ',' or '}'"); }
+				++_current; // skip comma
+				SkipSpace();
+			}
+			return _handler.OnEndObject(count) || Error("stopped by the handler");
+		}
+
+		const char* _begin   = nullptr;
+		const char* _current = nullptr;
+		const char* _end     = nullptr;
+		Handler&    _handler;
+		const char* _errorMessage = "";
+	};
+
+	/****************************************************************************
+	*				  			DomBuilder
+	*************************************************************************//**
+	*  @class     DomBuilder
+	*  @brief     Handler which builds JsonNodes. Children wait on a stack until their container closes,
+	*             then they are copied into the arena as one contiguous array.
+	*****************************************************************************/
+	class DomBuilder
+	{
+	public:
+		bool OnNull  ()             { _nodes.push_back(JsonNode::CreateNull());        return true; }
+		bool OnBool  (bool value)   { _nodes.push_back(JsonNode::CreateBool(value));   return true; }
+		bool OnNumber(double value) { _nodes.push_back(JsonNode::CreateNumber(value)); return true; }
+		bool OnString(std::string_view value, bool hasEscape)
+		{
+			_nodes.push_back(JsonNode::CreateString(value.data(), static_cast<std::uint32_t>(value.size()), hasEscape));
+			return true;
+		}
+		bool OnKey(std::string_view key, bool hasEscape)
+		{
+			/*-------------------------------------------------------------------
+			-              Keys are compared in Find, so the rare escaped key is decoded now
+			---------------------------------------------------------------------*/
+			if (hasEscape)
+			{
+				char* decoded = static_cast<char*>(_arena.Allocate(key.size() + 1, 1));
+				key = std::string_view(decoded, JsonNode::Unescape(key, decoded));
+			}
+			JsonMember member;
+			member.Key       = key.data();
+			member.KeyLength = static_cast<std::uint32_t>(key.size());
+			member.KeyHash   = JsonMember::Hash(key);
+			_keys.push_back(member);
+			return true;
+		}
+		bool OnStartObject() { return true; }
+		bool OnStartArray () { return true; }
+
+		bool OnEndArray(std::uint32_t count)
+		{
+			JsonNode* elements = nullptr;
+			if (count > 0)
+			{
+				elements = static_cast<JsonNode*>(_arena.Allocate(sizeof(JsonNode) * count, alignof(JsonNode)));
+				std::copy(_nodes.end() - count, _nodes.end(), elements);
+				_nodes.resize(_nodes.size() - count);
+			}
+			_nodes.push_back(JsonNode::CreateArray(elements, count));
+			return true;
+		}
+
+		bool OnEndObject(std::uint32_t count)
+		{
+			JsonMember* members = nullptr;
+			if (count > 0)
+			{
+				/*-------------------------------------------------------------------
+				-              Members [+ open addressing index for the large objects]
+				---------------------------------------------------------------------*/
+				const std::uint32_t capacity = count > JSON_LINEAR_SEARCH_COUNT ? HashCapacity(count) : 0;
+				members = static_cast<JsonMember*>(_arena.Allocate(sizeof(JsonMember) * count + sizeof(std::uint32_t) * capacity, alignof(JsonMember)));
+
+				const size_t keyOffset  = _keys.size()  - count;
+				const size_t nodeOffset = _nodes.size() - count;
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					members[i]       = _keys[keyOffset + i];
+					members[i].Value = _nodes[nodeOffset + i];
+				}
+				_keys .resize(keyOffset);
+				_nodes.resize(nodeOffset);
+
+				if (capacity > 0)
+				{
+					std::uint32_t* index = reinterpret_cast<std::uint32_t*>(members + count);
+					std::fill(index, index + capacity, HASH_EMPTY);
+					for (std::uint32_t i = 0; i < count; ++i)
+					{
+						std::uint32_t slot = members[i].KeyHash & (capacity - 1);
+						while (index[slot] != HASH_EMPTY) { slot = (slot + 1) & (capacity - 1); }
+						index[slot] = i;
+					}
+				}
+			}
+			_nodes.push_back(JsonNode::CreateObject(members, count));
+			return true;
+		}
+
+		JsonNode GetRoot() const { return _nodes.empty() ? JsonNode() : _nodes.back(); }
+
+		explicit DomBuilder(JsonArena& arena) : _arena(arena) { _nodes.reserve(256); _keys.reserve(256); };
+
+	private:
+		JsonArena&              _arena;
+		std::vector<JsonNode>   _nodes;
+		std::vector<JsonMember> _keys;
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region JsonArena
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        void* JsonArena::Allocate(size_t byteSize, size_t alignment)
+*  @brief     Bump allocation. A new block is added when the current one is full (block size doubles up to 4MB)
+*  @param[in] size_t byteSize
+*  @param[in] size_t alignment (power of 2)
+*  @return @@void*
+*****************************************************************************/
+void* JsonArena::Allocate(size_t byteSize, size_t alignment)
+{
+	assert((alignment & (alignment - 1)) == 0);
+
+	size_t padding = (alignment - (reinterpret_cast<std::uintptr_t>(_current) & (alignment - 1))) & (alignment - 1);
+	if (_current == nullptr || padding + byteSize > _restByteSize)
+	{
+		const size_t blockSize = (std::max)(_blockByteSize, byteSize + alignment);
+		_blocks.emplace_back(new std::uint8_t[blockSize]);
+		_current           = _blocks.back().get();
+		_restByteSize      = blockSize;
+		_reservedByteSize += blockSize;
+		_blockByteSize     = (std::min)(_blockByteSize * 2, MAX_ARENA_BLOCK_SIZE);
+		padding = (alignment - (reinterpret_cast<std::uintptr_t>(_current) & (alignment - 1))) & (alignment - 1);
+	}
+
+	void* result   = _current + padding;
+	_current      += padding + byteSize;
+	_restByteSize -= padding + byteSize;
+	_usedByteSize += byteSize;
+	return result;
+}
+
+/****************************************************************************
+*                       Reset
+*************************************************************************//**
+*  @fn        void JsonArena::Reset()
+*  @brief     Release every block
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void JsonArena::Reset()
+{
+	_blocks.clear();
+	_current          = nullptr;
+	_restByteSize     = 0;
+	_usedByteSize     = 0;
+	_reservedByteSize = 0;
+}
+#pragma endregion JsonArena
+
+#pragma region JsonNode
+/****************************************************************************
+*                       Find
+*************************************************************************//**
+*  @fn        const JsonNode* JsonNode::Find(std::string_view key) const
+*  @brief     Object member lookup (linear search for the small objects, hash index for the others).
+*             With duplicated keys the first member is returned.
+*  @param[in] std::string_view key
+*  @return @@const JsonNode* (nullptr : not found or not object)
+*****************************************************************************/
+const JsonNode* JsonNode::Find(std::string_view key) const
+{
+	if (!IsObject()) { return nullptr; }
+
+	std::uint32_t capacity = 0;
+	const std::uint32_t* index = GetHashIndex(capacity);
+	if (index == nullptr)
+	{
+		for (std::uint32_t i = 0; i < _count; ++i)
+		{
+			if (_members[i].GetKey() == key) { return &_members[i].Value; }
+		}
+		return nullptr;
+	}
+
+	const std::uint32_t hash = JsonMember::Hash(key);
+	for (std::uint32_t slot = hash & (capacity - 1); index[slot] != HASH_EMPTY; slot = (slot + 1) & (capacity - 1))
+	{
+		const JsonMember& member = _members[index[slot]];
+		if (member.KeyHash == hash && member.GetKey() == key) { return &member.Value; }
+	}
+	return nullptr;
+}
+
+const JsonNode& JsonNode::operator[](size_t index) const
+{
+	assert(index < Size());
+	return IsArray() ? _elements[index] : _members[index].Value;
+}
+
+const JsonMember& JsonNode::GetMember(size_t index) const
+{
+	assert(IsObject() && index < _count);
+	return _members[index];
+}
+
+/****************************************************************************
+*                       GetString
+*************************************************************************//**
+*  @fn        std::string JsonNode::GetString() const
+*  @brief     Unescaped copy of the string (empty if not string)
+*  @param[in] void
+*  @return @@std::string
+*****************************************************************************/
+std::string JsonNode::GetString() const
+{
+	if (!IsString()) { return std::string(); }
+	return _hasEscape ? Unescape(GetStringView()) : std::string(GetStringView());
+}
+
+std::string JsonNode::Unescape(std::string_view raw)
+{
+	std::string result(raw.size(), '\0');
+	result.resize(Unescape(raw, result.data()));
+	return result;
+}
+
+/****************************************************************************
+*                       Unescape
+*************************************************************************//**
+*  @fn        size_t JsonNode::Unescape(std::string_view raw, char* destination)
+*  @brief     Decode the escape sequences (\uXXXX to UTF-8, surrogate pairs are joined).
+*             The result is never longer than the source.
+*  @param[in] std::string_view raw
+*  @param[out] char* destination
+*  @return @@size_t decoded byte size
+*****************************************************************************/
+size_t JsonNode::Unescape(std::string_view raw, char* destination)
+{
+	const char* p   = raw.data();
+	const char* end = raw.data() + raw.size();
+	char* output    = destination;
+	while (p != end)
+	{
+		if (*p != '\\' || end - p < 2) { *output++ = *p++; continue; }
+		switch (p[1])
+		{
+			case 'b': *output++ = '\b'; p += 2; break;
+			case 'f': *output++ = '\f'; p += 2; break;
+			case 'n': *output++ = '\n'; p += 2; break;
+			case 'r': *output++ = '\r'; p += 2; break;
+			case 't': *output++ = '\t'; p += 2; break;
+			case 'u':
+			{
+				std::uint32_t codePoint = 0;
+				if (end - p < 6 || !ReadHex4(p + 2, codePoint)) { *output++ = *p++; break; }
+				p += 6;
+
+				std::uint32_t low = 0;
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u'
+					&& ReadHex4(p + 2, low) && low >= 0xDC00 && low <= 0xDFFF)
+				{
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+					p += 6;
+				}
+				else if (codePoint >= 0xD800 && codePoint <= 0xDFFF) { codePoint = 0xFFFD; } // lone surrogate
+				output += EncodeUTF8(codePoint, output);
+				break;
+			}
+			default: *output++ = p[1]; p += 2; break; // \" \\ \/
+		}
+	}
+	return static_cast<size_t>(output - destination);
+}
+
+const std::uint32_t* JsonNode::GetHashIndex(std::uint32_t& capacity) const
+{
+	if (!IsObject() || _count <= JSON_LINEAR_SEARCH_COUNT) { capacity = 0; return nullptr; }
+	capacity = HashCapacity(_count);
+	return reinterpret_cast<const std::uint32_t*>(_members + _count);
+}
+
+std::uint32_t JsonMember::Hash(std::string_view key)
+{
+	std::uint32_t hash = 2166136261u;
+	for (const char c : key)
+	{
+		hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u;
+	}
+	return hash;
+}
+#pragma endregion JsonNode
+
+#pragma region JsonDocument
+/****************************************************************************
+*                       LoadFromFile
+*************************************************************************//**
+*  @fn        bool JsonDocument::LoadFromFile(const std::wstring& filePath)
+*  @brief     Read the whole file into the document owned buffer and parse it
+*  @param[in] const std::wstring& filePath
+*  @return @@bool
+*****************************************************************************/
+bool JsonDocument::LoadFromFile(const std::wstring& filePath)
+{
+	Clear();
+
+	std::ifstream stream(std::filesystem::path(filePath), std::ios::in | std::ios::binary);
+	if (!stream.is_open())
+	{
+		_errorMessage = "can't open the file";
+		return false;
+	}
+
+	stream.seekg(0, std::ios::end);
+	const size_t byteSize = static_cast<size_t>(stream.tellg());
+	stream.seekg(0, std::ios::beg);
+
+	std::unique_ptr<char[]> source(new char[byteSize + 1]);
+	if (!stream.read(source.get(), static_cast<std::streamsize>(byteSize)))
+	{
+		_errorMessage = "can't read the file";
+		return false;
+	}
+	source[byteSize] = '\0';
+
+	const bool result = Parse(source.get(), byteSize);
+	_source = std::move(source); // after Parse (Parse clears the buffer)
+	return result;
+}
+
+/****************************************************************************
+*                       Parse
+*************************************************************************//**
+*  @fn        bool JsonDocument::Parse(const char* data, size_t byteSize)
+*  @brief     Build the DOM. The strings refer to data, so keep it alive while the document is used.
+*  @param[in] const char* data
+*  @param[in] size_t byteSize
+*  @return @@bool
+*****************************************************************************/
+bool JsonDocument::Parse(const char* data, size_t byteSize)
+{
+	Clear();
+	if (data == nullptr) { _errorMessage = "data is null"; return false; }
+
+	DomBuilder builder(_arena);
+	JsonParser<DomBuilder> parser(data, byteSize, builder);
+	if (!parser.Parse())
+	{
+		_errorMessage = parser.GetErrorMessage();
+		_errorOffset  = parser.GetErrorOffset();
+		_arena.Reset();
+		return false;
+	}
+	_root = builder.GetRoot();
+	return true;
+}
+
+/****************************************************************************
+*                       ParseSax
+*************************************************************************//**
+*  @fn        bool JsonDocument::ParseSax(const char* data, size_t byteSize, JsonHandler& handler, std::string* errorMessage, size_t* errorOffset)
+*  @brief     Parse without building the DOM (callbacks only, no allocation)
+*  @param[in] const char* data
+*  @param[in] size_t byteSize
+*  @param[in] JsonHandler& handler
+*  @param[out] std::string* errorMessage (optional)
+*  @param[out] size_t* errorOffset (optional)
+*  @return @@bool
+*****************************************************************************/
+bool JsonDocument::ParseSax(const char* data, size_t byteSize, JsonHandler& handler, std::string* errorMessage, size_t* errorOffset)
+{
+	if (data == nullptr) { return false; }
+
+	JsonParser<JsonHandler> parser(data, byteSize, handler);
+	const bool result = parser.Parse();
+	if (!result)
+	{
+		if (errorMessage != nullptr) { *errorMessage = parser.GetErrorMessage(); }
+		if (errorOffset  != nullptr) { *errorOffset  = parser.GetErrorOffset(); }
+	}
+	return result;
+}
+
+/****************************************************************************
+*                       GetString
+*************************************************************************//**
+*  @fn        std::string_view JsonDocument::GetString(const JsonNode& node)
+*  @brief     Unescaped view of a string node of this document.
+*             The escaped string is decoded into the arena once, and the node refers to it afterwards.
+*  @param[in] const JsonNode& node
+*  @return @@std::string_view
+*****************************************************************************/
+std::string_view JsonDocument::GetString(const JsonNode& node)
+{
+	if (!node.IsString() || !node.HasEscape()) { return node.GetStringView(); }
+
+	const std::string_view raw = node.GetStringView();
+	char* decoded = static_cast<char*>(_arena.Allocate(raw.size() + 1, 1));
+	const size_t length = JsonNode::Unescape(raw, decoded);
+
+	JsonNode& target  = const_cast<JsonNode&>(node); // every node is owned by this document
+	target._string    = decoded;
+	target._count     = static_cast<std::uint32_t>(length);
+	target._hasEscape = false;
+	return std::string_view(decoded, length);
+}
+
+/****************************************************************************
+*                       Clear
+*************************************************************************//**
+*  @fn        void JsonDocument::Clear()
+*  @brief     Release the nodes and the source buffer
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void JsonDocument::Clear()
+{
+	_arena.Reset();
+	_root = JsonNode();
+	_source.reset();
+	_errorMessage.clear();
+	_errorOffset = 0;
+}
+#pragma endregion JsonDocument
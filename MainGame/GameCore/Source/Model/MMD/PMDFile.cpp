@@ -361,14 +361,17 @@ bool PMDData::LoadPMDBone(FILE* filePtr)
 	-       Build the correspondence between indexes and bone names
 	---------------------------------------------------------------------*/
 	_boneNames.resize(boneCount);
+	_boneNodes.resize(boneCount);
 	_boneNodeAddress.resize(boneCount);
+	_boneNodeIndex.Reserve(boneCount);
 	
 	// Load bone node data
 	for (int i = 0; i < boneCount; ++i)
 	{
 		_boneNames[i]   = bones[i].BoneName;
 
-		auto& boneNode = _boneNodeTable[bones[i].BoneName];    // acquire bone node
+		auto& boneNode = _boneNodes[i];                        // acquire bone node
+		_boneNodeIndex.TryEmplace(_boneNames[i], i);           // the first bone is found by a duplicated name
 		boneNode.SetBoneIndex(i);                              // order of loading
 		boneNode.SetBasePosition(bones[i].BoneHeadPosition);   // substitute base position of each bone
 		boneNode.SetBoneType((UINT32)bones[i].BoneType);
@@ -383,14 +386,14 @@ bool PMDData::LoadPMDBone(FILE* filePtr)
 	}
 
 	// Building parent-child relationships.
-	for (auto& bone : bones)
+	for (int i = 0; i < boneCount; ++i)
 	{
 		// overloading check:  parent index
+		const auto& bone = bones[i];
 		if (bone.ParentBoneID >= bones.size()) { continue; }
 
-		auto parentName = _boneNames[bone.ParentBoneID];
-		_boneNodeTable[bone.BoneName].SetParent(&_boneNodeTable[parentName]); // set parent bone 
-		_boneNodeTable[parentName].AddChild(&_boneNodeTable[bone.BoneName]);  // set child bone
+		_boneNodes[i].SetParent(&_boneNodes[bone.ParentBoneID]); // set parent bone 
+		_boneNodes[bone.ParentBoneID].AddChild(&_boneNodes[i]);  // set child bone
 
 	}
 
@@ -761,12 +764,7 @@ bool PMDData::DebugPMDBoneIKList()
 {
 	auto getNameFromIndex = [&](UINT16 index)->std::string
 	{
-		auto iterator = std::find_if(_boneNodeTable.begin(), _boneNodeTable.end(),
-			[index](std::pair<std::string, PMDBoneNode> boneNodeList)
-		{
-			return boneNodeList.second.GetBoneIndex() == index;
-		});
-		if (iterator != _boneNodeTable.end()) { return iterator->first; }
+		if (index < _boneNames.size()) { return _boneNames[index]; }
 		else { return ""; }
 	};
 
@@ -105,14 +105,14 @@ bool PMDModel::UpdateMotion()
 	for (auto& boneMotion : _motionData[_currentMotionName]->GetMotionMap())
 	{
 		std::string boneName  = boneMotion.first;
-		auto iteratorBoneNode = _pmdData->FindBoneNode(boneName);
+		const PMDBoneNode* foundBoneNode = _pmdData->GetBoneNode(boneName);
 
-		if (iteratorBoneNode == _pmdData->GetBoneNodeTable().end())
+		if (foundBoneNode == nullptr)
 		{
 			continue;
 		}
 
-		PMDBoneNode boneNode               = iteratorBoneNode->second;
+		PMDBoneNode boneNode               = *foundBoneNode;
 		std::vector<VMDKeyFrame> keyFrames = boneMotion.second;
 
 		// For each motion, select the obe closest to the desired frame number
@@ -282,14 +282,12 @@ bool PMDModel::StartAnimation(const std::wstring& motionName)
 	for (auto& boneMotion : _motionData[motionName]->GetMotionMap())
 	{
 		std::string boneName  = boneMotion.first;
-		auto iteratorBoneNode = _pmdData->FindBoneNode(boneName);
-
-		if (iteratorBoneNode == _pmdData->GetBoneNodeTable().end())
+		PMDBoneNode* boneNode      = _pmdData->GetBoneNode(boneName);
+		if (boneNode == nullptr)
 		{
 			continue;
 		}
 
-		PMDBoneNode* boneNode      = _pmdData->GetBoneNode(boneMotion.first);
 		Float3       basePosition  = boneNode->GetBasePosition();
 		Matrix4      boneTransform = 
 			  Translation(-basePosition.x, -basePosition.y, -basePosition.z)
@@ -562,14 +560,12 @@ bool PMDModel::PreparePMDObject()
 
 void PMDModel::WriteBoneParameterToBuffer()
 {
-	BoneParameter* boneParameter = new BoneParameter();
-	std::copy(_boneMatrices.get()->begin(), _boneMatrices.get()->end(), boneParameter->BoneMatrices);
+	const size_t boneCount = (std::min)(_boneMatrices.get()->size(), (size_t)PMD_BONE_MATRIX_SIZE);
 
 	auto boneObject = _boneBuffer.get();
 	boneObject->CopyStart();
-	boneObject->CopyData(0, *boneParameter);
+	std::copy_n(_boneMatrices.get()->begin(), boneCount, boneObject->GetMappedData()->BoneMatrices);
 	boneObject->CopyEnd();
-	delete boneParameter;
 }
 
 #pragma endregion Private Fucntion
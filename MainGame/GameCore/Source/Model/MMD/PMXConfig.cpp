@@ -11,6 +11,7 @@
 #include "GameCore/Include/Model/MMD/PMXFile.hpp"
 #include "GameCore/Include/Model/MMD/VMDFile.hpp"
 #include "GameCore/Include/Model/MMD/PMXModel.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <btBulletDynamicsCommon.h>
 #include <algorithm>
 
@@ -233,6 +234,7 @@ void PMXBoneNode::BeforeUpdateMatrix()
 #pragma region BoneIK
 void PMXBoneIK::SolveIK(int frameNo)
 {
+    PROFILE_FUNCTION();
     /*-------------------------------------------------------------------
     -             Initialize Child Node
     ---------------------------------------------------------------------*/
@@ -1312,6 +1314,7 @@ bool MMDPhysics::Create()
 *****************************************************************************/
 bool MMDPhysics::Update(float deltaTime)
 {
+    PROFILE_FUNCTION();
     if (_world != nullptr)
     {
         _fps = 1.0f/ deltaTime;
@@ -10,6 +10,7 @@
 #include "GameCore/Include/Model/MMD/PMXFile.hpp"
 #include "GameCore/Include/File/FileUtility.hpp"
 #include "GameCore/Include/File/UnicodeUtility.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <iomanip>
 #include <filesystem>
 
@@ -33,6 +34,7 @@ using namespace gm;
 *****************************************************************************/
 bool PMXData::Load3DModel(const std::wstring& filePath)
 {
+	PROFILE_FUNCTION();
 	using namespace pmx;
 
 	/*-------------------------------------------------------------------
@@ -578,7 +580,7 @@ bool PMXData::LoadPMXTextures(const pmx::PMXMaterial& material, int index)
 	/*-------------------------------------------------------------------
 	-             LoadTextures
 	---------------------------------------------------------------------*/
-	textureLoader.LoadTexture(file::AnsiToWString(textureName), _textures[index].Texture);
+	textureLoader.LoadStreamingTexture(file::AnsiToWString(textureName), _textures[index].Texture); // the higher mips follow the screen size
 	textureLoader.LoadTexture(file::AnsiToWString(sphName), _textures[index].SphereMultiply);
 	textureLoader.LoadTexture(file::AnsiToWString(spaName), _textures[index].SphereAddition);
 	textureLoader.LoadTexture(file::AnsiToWString(toonName), _textures[index].ToonTexture);
@@ -709,14 +711,17 @@ bool PMXData::LoadPMXBone(FILE* filePtr)
 	-             Load Bone Node
 	---------------------------------------------------------------------*/
 	_boneNames.resize(boneCount);
+	_boneNodes.resize(boneCount);
 	_boneNodeAddress.resize(boneCount);
+	_boneNodeIndex.Reserve(boneCount);
 
 	for (int i = 0; i < boneCount; ++i)
 	{
 		auto boneName = file::WStringToString(unicode::ToWString(bones[i].BoneName));
 		_boneNames[i] = boneName;
 
-		auto& boneNode = _boneNodeTable[_boneNames[i]]; // acquire bone node
+		auto& boneNode = _boneNodes[i]; // acquire bone node
+		_boneNodeIndex.TryEmplace(_boneNames[i], i); // the first bone is found by a duplicated name
 		boneNode.SetBoneName(boneName);
 		boneNode.SetBoneIndex(i);
 
@@ -724,15 +729,14 @@ bool PMXData::LoadPMXBone(FILE* filePtr)
 	}
 
 	// build parent  - child relationships
-	for (auto& bone : bones)
+	for (int i = 0; i < boneCount; ++i)
 	{
 		// overload check: parent index
+		const auto& bone = bones[i];
 		if (bone.ParentBoneIndex >= bones.size()) { continue; }
 
-		auto parentName = _boneNames[bone.ParentBoneIndex];
-		auto boneName   = file::WStringToString(unicode::ToWString(bone.BoneName));
-		_boneNodeTable[boneName].SetParent(&_boneNodeTable[parentName]); // set parent
-		_boneNodeTable[parentName].AddChild(&_boneNodeTable[boneName]);  // set child
+		_boneNodes[i].SetParent(&_boneNodes[bone.ParentBoneIndex]); // set parent
+		_boneNodes[bone.ParentBoneIndex].AddChild(&_boneNodes[i]);  // set child
 	}
 
 	/*-------------------------------------------------------------------
@@ -768,9 +772,8 @@ bool PMXData::LoadPMXBone(FILE* filePtr)
 		if ((appendRotate || appendTranslate) && (bones[i].AppendBoneIndex != -1))
 		{
 			bool appendLocal = ((uint16_t)bones[i].BoneFlag & (uint16_t)PMXBoneFlag::AppendLocal) != 0;
-			auto appendNode = _boneNodeTable[file::WStringToString(unicode::ToWString(bones[bones[i].AppendBoneIndex].BoneName))];
 			boneNode->EnableAppendLocal(appendLocal);
-			boneNode->SetAppendNode    (&appendNode);
+			boneNode->SetAppendNode    (&_boneNodes[bones[i].AppendBoneIndex]);
 
 			boneNode->SetAppendWeight  (bones[i].AppendWeight);
 		
@@ -1352,8 +1355,9 @@ PMXData::~PMXData()
 	_materials.clear();
 	_pbrMaterials.clear();
 	_materialNameList.clear();
-	_materialNameIndex.clear();
-	_boneNodeTable.clear();
+	_materialNameIndex.Clear();
+	_boneNodes.clear();
+	_boneNodeIndex.Clear();
 	_boneNames.clear();
 	_boneNodeAddress.clear();
 	_boneIKs.clear();
@@ -1370,6 +1374,7 @@ PMXData::~PMXData()
 	_pbrMaterials.shrink_to_fit();
 	_materialNameList.shrink_to_fit();
 	_boneNames.shrink_to_fit();
+	_boneNodes.shrink_to_fit();
 	_boneNodeAddress.shrink_to_fit();
 	_boneIKs.shrink_to_fit();
 	_displayFrames.shrink_to_fit();
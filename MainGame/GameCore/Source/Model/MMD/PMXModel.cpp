@@ -13,6 +13,7 @@
 #include "GameCore/Include/Model/MotionLoader.hpp"
 #include "GameCore/Include/Model/MMD/VMDAnimation.hpp"
 #include "GameCore/Include/GameTimer.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <thread>
 #include <chrono>
 #include <d3dcompiler.h>
@@ -91,6 +92,12 @@ bool PMXModel::Initialize(const std::wstring& filePath, const std::wstring& addN
 	---------------------------------------------------------------------*/
 	if (!PreparePhysics()) { MessageBox(NULL, L"BoneIK cannot be prepared.", L"Warning", MB_ICONWARNING); return false; }
 
+	/*-------------------------------------------------------------------
+	-             Prepare the boxes for the visibility culling
+	---------------------------------------------------------------------*/
+	if (!PrepareMaterialBoxes()) { MessageBox(NULL, L"Material boxes cannot be prepared.", L"Warning", MB_ICONWARNING); return false; }
+	UpdateWorldBoxes();
+
 	return true;
 }
 
@@ -114,14 +121,13 @@ void PMXModel::Finalize()
 	/*-------------------------------------------------------------------
 	-            Clear Map
 	---------------------------------------------------------------------*/
-	_boneMap.get()->clear();
+	_boneNodes.get()->clear();
 	_motionData.clear();
 
 	/*-------------------------------------------------------------------
 	-            Clear vector 
 	---------------------------------------------------------------------*/
 	_threads                     .clear(); _threads                     .shrink_to_fit();
-	_materialView                .clear(); _materialView                .shrink_to_fit();
 	_boneMatrices         .get()->clear(); _boneMatrices         .get()->shrink_to_fit();
 	_boneNodeAddress      .get()->clear(); _boneNodeAddress      .get()->shrink_to_fit();
 	_sortedBoneNodeAddress.get()->clear(); _sortedBoneNodeAddress.get()->shrink_to_fit();
@@ -136,7 +142,7 @@ void PMXModel::Finalize()
 	_boneMatrices         .reset();
 	_bonePosition         .reset();
 	_boneQuaternion       .reset();
-	_boneMap              .reset();
+	_boneNodes            .reset();
 	_boneNodeAddress      .reset();
 	_sortedBoneNodeAddress.reset();
 	_boneIKs.reset();
@@ -149,6 +155,12 @@ void PMXModel::Finalize()
 	_materialBuffer     .get()->Resource()->Release();
 	_boneBuffer          .get()->Resource()->Release();
 
+	/*-------------------------------------------------------------------
+	-            Release View (reused after the frames in flight)
+	---------------------------------------------------------------------*/
+	_materialView.Release();
+	_boneView    .Release();
+
 
 }
 /****************************************************************************
@@ -161,44 +173,37 @@ void PMXModel::Finalize()
 *****************************************************************************/
 bool PMXModel::Draw(SceneGPUAddress scene, LightGPUAddress light)
 {
-	/*-------------------------------------------------------------------
-	-               Prepare variable
-	---------------------------------------------------------------------*/
-	DirectX12& directX12                      = DirectX12::Instance();
-	CommandList* commandList                  = directX12.GetCommandList();
-	_currentFrameIndex                        = directX12.GetCurrentFrameIndex();
-	D3D12_VERTEX_BUFFER_VIEW vertexBufferView = _meshBuffer[_currentFrameIndex].VertexBufferView();
-	D3D12_INDEX_BUFFER_VIEW  indexBufferView  = _meshBuffer[_currentFrameIndex].IndexBufferView();
-
-	/*-------------------------------------------------------------------
-	-               Execute commandlist
-	---------------------------------------------------------------------*/
-	commandList->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
-	commandList->IASetIndexBuffer(&indexBufferView);
-	commandList->SetGraphicsRootConstantBufferView(0, _modelObject.get()->Resource()->GetGPUVirtualAddress());
-	commandList->SetGraphicsRootConstantBufferView(1, scene);
-	commandList->SetGraphicsRootConstantBufferView(3, light);
-	commandList->SetGraphicsRootConstantBufferView(4, _boneBuffer.get()->Resource()->GetGPUVirtualAddress());
+	SetDrawCommand(scene, light);
 
 	/*-------------------------------------------------------------------
 	-               Drawing process for each material
 	---------------------------------------------------------------------*/
-	auto address = _materialBuffer.get()->Resource()->GetGPUVirtualAddress();
-	UINT offset  = 0;
-	for (int i = 0; i < (int)_pmxData->GetMaterialCount(); ++i)
+	for (UINT32 i = 0; i < (UINT32)_pmxData->GetMaterialCount(); ++i)
 	{
-		commandList->SetGraphicsRootConstantBufferView(2, address);
-		commandList->SetGraphicsRootDescriptorTable(5, _pmxData->GetTextureList(i).Texture.GPUHandler);
-		commandList->SetGraphicsRootDescriptorTable(6, _pmxData->GetTextureList(i).SphereMultiply.GPUHandler);
-		commandList->SetGraphicsRootDescriptorTable(7, _pmxData->GetTextureList(i).SphereAddition.GPUHandler);
-		commandList->SetGraphicsRootDescriptorTable(8, _pmxData->GetTextureList(i).ToonTexture.GPUHandler);
-		commandList->DrawIndexedInstanced(_pmxData.get()->GetIndexCountForMaterial(i), 1, offset, _meshBuffer[_currentFrameIndex].BaseVertexLocation, 0);
-		offset  += _pmxData.get()->GetIndexCountForMaterial(i);
-		address += CalcConstantBufferByteSize(sizeof(PBRMaterial));
+		DrawMaterial(i);
 	}
+	return true;
+}
 
-	
+/****************************************************************************
+*                       Draw
+*************************************************************************//**
+*  @fn        bool PMXModel::Draw(SceneGPUAddress scene, LightGPUAddress light, const std::vector<UINT32>& visibleMaterials)
+*  @brief     Draw only the listed materials
+*  @param[in] SceneGPUAddress scene
+*  @param[in] LightGPUAddress light
+*  @param[in] const std::vector<UINT32>& visibleMaterials
+*  @return @@bool
+*****************************************************************************/
+bool PMXModel::Draw(SceneGPUAddress scene, LightGPUAddress light, const std::vector<UINT32>& visibleMaterials)
+{
+	if (visibleMaterials.empty()) { return true; }
+	SetDrawCommand(scene, light);
+
+	for (UINT32 material : visibleMaterials)
+	{
+		DrawMaterial(material);
+	}
 	return true;
 }
 
@@ -249,14 +254,12 @@ bool PMXModel::StartAnimation(const std::wstring& motionName)
 	for (auto& boneMotion : _motionData[motionName]->GetMotionMap())
 	{
 		std::string boneName  = boneMotion.first;
-		auto iteratorBoneNode = _pmxData->FindBoneNode(boneName);
-
-		if (iteratorBoneNode == _pmxData->GetBoneNodeTable().end())
+		PMXBoneNode* boneNode      = _pmxData->GetBoneNode(boneName);
+		if (boneNode == nullptr)
 		{
 			continue;
 		}
 
-		PMXBoneNode* boneNode      = _pmxData->GetBoneNode(boneMotion.first);
 		Vector3      basePosition = boneNode->GetTranslate();
 		Matrix4      boneTransform = 
 			  Translation(basePosition)
@@ -420,6 +423,7 @@ bool PMXModel::PrepareMaterialBuffer()
 	/*-------------------------------------------------------------------
 	-			Create Constant Buffer View
 	---------------------------------------------------------------------*/
+	if (materialCount > 0 && !_materialView.Issue(HeapType::CBV, materialCount)) { return false; }
 	for (int i = 0; i < materialCount; ++i)
 	{
 		/*-------------------------------------------------------------------
@@ -433,7 +437,7 @@ bool PMXModel::PrepareMaterialBuffer()
 		-			Create Constant Buffer View
 		---------------------------------------------------------------------*/
 		directX12.GetDevice()->CreateConstantBufferView(
-			&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, directX12.IssueViewID(HeapType::CBV)));
+			&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, _materialView.GetIndex(i)));
 	}
 
 	return true;
@@ -526,8 +530,9 @@ bool PMXModel::PrepareBoneBuffer()
 	cbvDesc.BufferLocation = _boneBuffer.get()->Resource()->GetGPUVirtualAddress();
 	cbvDesc.SizeInBytes    = CalcConstantBufferByteSize(sizeof(PMXBoneParameter));
 	
+	if (!_boneView.Issue(HeapType::CBV)) { delete boneParameter; return false; }
 	device->CreateConstantBufferView(
-		&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, directX12.IssueViewID(HeapType::CBV)));
+		&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, _boneView.GetIndex()));
 	
 	delete boneParameter;
 	return true;
@@ -545,13 +550,12 @@ bool PMXModel::PrepareBoneMap()
 	/*-------------------------------------------------------------------
 	-			Get Bone Map
 	---------------------------------------------------------------------*/
-	std::unique_ptr<std::map<std::string, PMXBoneNode>> bones    = std::make_unique<std::map<std::string, PMXBoneNode>>(_pmxData->CopyBoneNodeTable());
+	std::unique_ptr<std::vector<PMXBoneNode>> bones              = std::make_unique<std::vector<PMXBoneNode>>(_pmxData->CopyBoneNodes());
 	std::unique_ptr<std::vector<PMXBoneNode*>> nodeAddress       = std::make_unique<std::vector<PMXBoneNode*>>(_pmxData->GetBoneCount());
 	std::unique_ptr<std::vector<PMXBoneNode*>> sortedNodeAddress = std::make_unique<std::vector<PMXBoneNode*>>(_pmxData->GetBoneCount());
 	for (int i = 0; i < _pmxData->GetBoneCount(); ++i)
 	{
-		auto& boneName = _pmxData->GetBoneNames()[i];
-		auto& bone     = bones->at(boneName);
+		auto& bone     = bones->at(i);
 
 		/*-------------------------------------------------------------------
 		-			parent
@@ -559,8 +563,7 @@ bool PMXModel::PrepareBoneMap()
 		if (bone.GetParent() != nullptr)
 		{
 			auto parentIndex = bone.GetParent()->GetBoneIndex();
-			auto parentName  = _pmxData->GetBoneNames()[parentIndex];
-			bone.SetParent(&bones->at(parentName));
+			bone.SetParent(&bones->at(parentIndex));
 		}
 
 		/*-------------------------------------------------------------------
@@ -572,8 +575,7 @@ bool PMXModel::PrepareBoneMap()
 			for (auto& child : bone.GetChildren())
 			{
 				auto childIndex = child->GetBoneIndex();
-				auto childName  = _pmxData->GetBoneNames()[childIndex];
-				bone.SetChild(&bones->at(childName), count);
+				bone.SetChild(&bones->at(childIndex), count);
 				count++;
 			}
 		}
@@ -583,18 +585,18 @@ bool PMXModel::PrepareBoneMap()
 		---------------------------------------------------------------------*/
 		if (bone.GetAppendNode() != nullptr)
 		{
-			auto appendIndex = bone.GetParent()->GetBoneIndex();
-			auto appendName  = _pmxData->GetBoneNames()[appendIndex];
-			bone.SetAppendNode(&bones->at(appendName));
+			auto appendIndex = bone.GetAppendNode()->GetBoneIndex();
+			bone.SetAppendNode(&bones->at(appendIndex));
 		}
 
 		/*-------------------------------------------------------------------
 		-			semi default bone 
 		---------------------------------------------------------------------*/
-		if (bones.get()->find(bone.GetBoneName() + "D") != bones.get()->end())
+		const int semiStandardIndex = _pmxData->FindBoneIndex(bone.GetBoneName() + "D");
+		if (semiStandardIndex >= 0)
 		{
 			std::pair<int, int> pair;
-			pair.first  = bones.get()->at(bone.GetBoneName() + "D").GetBoneIndex(); // "D"bone
+			pair.first  = bones->at(semiStandardIndex).GetBoneIndex(); // "D"bone
 			pair.second = bone.GetBoneIndex(); // non "D"
 			_semiStandardBoneMap.push_back(pair);
 		}
@@ -621,7 +623,7 @@ bool PMXModel::PrepareBoneMap()
 		[](PMXBoneNode* x, PMXBoneNode* y) { return x->GetDeformationDepth() < y->GetDeformationDepth(); }
 	);
 
-	_boneMap               = std::move(bones);
+	_boneNodes             = std::move(bones);
 	_boneNodeAddress       = std::move(nodeAddress);
 	_sortedBoneNodeAddress = std::move(sortedNodeAddress);
 
@@ -652,23 +654,23 @@ bool PMXModel::PrepareBoneIK()
 		std::string targetName = pmxFileIK.GetTargetBoneNode()->GetBoneName();
 		for (auto& semiStandard : _semiStandardBoneMap)
 		{
-			if (semiStandard.second == _boneMap.get()->at(targetName).GetBoneIndex())
+			if (semiStandard.second == FindBoneNode(targetName)->GetBoneIndex())
 			{
 				targetName = targetName + "D";
-				_boneMap.get()->at(targetName).EnableIK(true);
+				FindBoneNode(targetName)->EnableIK(true);
 				break;
 			}
 		}
 
-		thisModelIK.SetIKBone    (&_boneMap.get()->at(ikName));
-		thisModelIK.SetTargetBone(&_boneMap.get()->at(targetName));
+		thisModelIK.SetIKBone    (FindBoneNode(ikName));
+		thisModelIK.SetTargetBone(FindBoneNode(targetName));
 		thisModelIK.SetIterationCount(pmxFileIK.GetIterationCount());
 		thisModelIK.SetLimitAngle(pmxFileIK.GetAngleLimit());
 
 		// save parent 
 		if (pmxFileIK.GetIKParentBoneNode() != nullptr)
 		{
-			thisModelIK.SetIKParentBone(&_boneMap.get()->at(pmxFileIK.GetIKParentBoneNode()->GetBoneName()));
+			thisModelIK.SetIKParentBone(FindBoneNode(pmxFileIK.GetIKParentBoneNode()->GetBoneName()));
 		}
 		
 		// save children
@@ -679,15 +681,15 @@ bool PMXModel::PrepareBoneIK()
 			std::string childName = pmxFileIK.GetChains()[j].IKBone->GetBoneName();
 			for (auto& semiStandard : _semiStandardBoneMap)
 			{
-				if (semiStandard.second == _boneMap.get()->at(childName).GetBoneIndex())
+				if (semiStandard.second == FindBoneNode(childName)->GetBoneIndex())
 				{
 					childName = childName + "D";
-					_boneMap.get()->at(childName).EnableIK(true);
+					FindBoneNode(childName)->EnableIK(true);
 					break;
 				}
 			}
 
-			tempIK[j].IKBone      = &_boneMap.get()->at(childName);
+			tempIK[j].IKBone      = FindBoneNode(childName);
 			tempIK[j].EnableLimit = pmxFileIK.GetChains()[j].EnableLimit;
 			tempIK[j].AngleMax    = pmxFileIK.GetChains()[j].AngleMax;
 			tempIK[j].AngleMin    = pmxFileIK.GetChains()[j].AngleMin;
@@ -697,16 +699,16 @@ bool PMXModel::PrepareBoneIK()
 		
 		if (ikName == "Eܐhj")
 		{
-			if (_boneMap.get()->find("EEX") != _boneMap.get()->end())
+			if (FindBoneNode("EEX") != nullptr)
 			{
-				thisModelIK.InsertIKChain(0, &_boneMap.get()->at("EEX"), false, Float3(0,0,0), Float3(0,0,0));
+				thisModelIK.InsertIKChain(0, FindBoneNode("EEX"), false, Float3(0,0,0), Float3(0,0,0));
 			}
 		}
 		else if (ikName == "ܐhj")
 		{
-			if (_boneMap.get()->find("EX") != _boneMap.get()->end())
+			if (FindBoneNode("EX") != nullptr)
 			{
-				thisModelIK.InsertIKChain(0, &_boneMap.get()->at("EX"), false, Float3(0, 0, 0), Float3(0, 0, 0));
+				thisModelIK.InsertIKChain(0, FindBoneNode("EX"), false, Float3(0, 0, 0), Float3(0, 0, 0));
 			}
 		}
 	}
@@ -714,24 +716,94 @@ bool PMXModel::PrepareBoneIK()
 	for (int i = 0; i < boneIK.get()->size(); ++i)
 	{
 		auto   boneName = boneIK.get()->at(i).GetIKName();
-		auto&  boneNode = _boneMap.get()->at(boneName);
+		auto&  boneNode = *FindBoneNode(boneName);
 		boneNode.SetBoneIK(&boneIK.get()->at(i));
 	}
 
 	_boneIKs = std::move(boneIK);
 	return true;
 }
+/****************************************************************************
+*                       WriteBoneParameterToBuffer
+*************************************************************************//**
+*  @fn        void PMXModel::WriteBoneParameterToBuffer()
+*  @brief     Write the bone matrices to the frame upload arena (directly to the mapped memory)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
 void PMXModel::WriteBoneParameterToBuffer()
 {
-	PMXBoneParameter* boneParameter = new PMXBoneParameter();
-	std::copy(_boneMatrices.get()->begin(), _boneMatrices.get()->end(), boneParameter->BoneMatrices);
+	UploadArena&  arena     = DirectX12::Instance().GetFrameUploadArena();
+	const size_t  boneCount = (std::min)(_boneMatrices.get()->size(), (size_t)PMX_BONE_MATRIX_SIZE);
+	_boneFrameSerial        = arena.GetFrameSerial();
+
+	UploadAllocation allocation = arena.Allocate(sizeof(PMXBoneParameter));
+	if (allocation.IsValid())
+	{
+		std::copy_n(_boneMatrices.get()->begin(), boneCount, static_cast<PMXBoneParameter*>(allocation.CPU)->BoneMatrices);
+		_boneAddress = allocation.GPU;
+		return;
+	}
 
+	/*-------------------------------------------------------------------
+	-    The arena is full: use the buffer of the model
+	---------------------------------------------------------------------*/
 	auto boneObject = _boneBuffer.get();
 	boneObject->CopyStart();
-	boneObject->CopyData(0, *boneParameter);
+	std::copy_n(_boneMatrices.get()->begin(), boneCount, boneObject->GetMappedData()->BoneMatrices);
 	boneObject->CopyEnd();
+	_boneAddress = boneObject->Resource()->GetGPUVirtualAddress();
+}
 
-	delete boneParameter;
+D3D12_GPU_VIRTUAL_ADDRESS PMXModel::GetBoneAddress()
+{
+	if (_boneFrameSerial != DirectX12::Instance().GetFrameUploadArena().GetFrameSerial()) { WriteBoneParameterToBuffer(); }
+	return _boneAddress;
+}
+
+/****************************************************************************
+*                       SetDrawCommand
+*************************************************************************//**
+*  @fn        void PMXModel::SetDrawCommand(SceneGPUAddress scene, LightGPUAddress light)
+*  @brief     Set the buffers shared by all materials
+*  @param[in] SceneGPUAddress scene
+*  @param[in] LightGPUAddress light
+*  @return @@void
+*****************************************************************************/
+void PMXModel::SetDrawCommand(SceneGPUAddress scene, LightGPUAddress light)
+{
+	/*-------------------------------------------------------------------
+	-               Prepare variable
+	---------------------------------------------------------------------*/
+	DirectX12& directX12                      = DirectX12::Instance();
+	CommandList* commandList                  = directX12.GetCommandList();
+	_currentFrameIndex                        = directX12.GetCurrentFrameIndex();
+	D3D12_VERTEX_BUFFER_VIEW vertexBufferView = _meshBuffer[_currentFrameIndex].VertexBufferView();
+	D3D12_INDEX_BUFFER_VIEW  indexBufferView  = _meshBuffer[_currentFrameIndex].IndexBufferView();
+
+	/*-------------------------------------------------------------------
+	-               Execute commandlist
+	---------------------------------------------------------------------*/
+	commandList->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
+	commandList->IASetIndexBuffer(&indexBufferView);
+	commandList->SetGraphicsRootConstantBufferView(0, _modelObject.get()->Resource()->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(1, scene);
+	commandList->SetGraphicsRootConstantBufferView(3, light);
+	commandList->SetGraphicsRootConstantBufferView(4, GetBoneAddress());
+}
+
+void PMXModel::DrawMaterial(UINT32 materialIndex)
+{
+	CommandList* commandList = DirectX12::Instance().GetCommandList();
+	auto address = _materialBuffer.get()->Resource()->GetGPUVirtualAddress() + materialIndex * CalcConstantBufferByteSize(sizeof(PBRMaterial));
+
+	commandList->SetGraphicsRootConstantBufferView(2, address);
+	commandList->SetGraphicsRootDescriptorTable(5, _pmxData->GetTextureList(materialIndex).Texture.GPUHandler);
+	commandList->SetGraphicsRootDescriptorTable(6, _pmxData->GetTextureList(materialIndex).SphereMultiply.GPUHandler);
+	commandList->SetGraphicsRootDescriptorTable(7, _pmxData->GetTextureList(materialIndex).SphereAddition.GPUHandler);
+	commandList->SetGraphicsRootDescriptorTable(8, _pmxData->GetTextureList(materialIndex).ToonTexture.GPUHandler);
+	commandList->DrawIndexedInstanced(_pmxData.get()->GetIndexCountForMaterial(materialIndex), 1, _materialIndexOffsets[materialIndex], _meshBuffer[_currentFrameIndex].BaseVertexLocation, 0);
 }
 /****************************************************************************
 *                       PreparePhysics
@@ -782,6 +854,94 @@ bool PMXModel::PreparePhysics()
 	return true;
 }
 
+/****************************************************************************
+*                       PrepareMaterialBoxes
+*************************************************************************//**
+*  @fn        bool PMXModel::PrepareMaterialBoxes()
+*  @brief     Prepare the bind pose box of each (material, bone) for the visibility culling.
+*             A skinned vertex is a weighted average of the vertex moved by each of its bones,
+*             so it is inside the union of the boxes moved by those bones.
+*             The boxes are expanded by the total position morph of the material vertices.
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool PMXModel::PrepareMaterialBoxes()
+{
+	const PMXVertex* vertices = _pmxData->GetVertex();
+	const UINT32*    indices  = _pmxData->GetIndex();
+	if (vertices == nullptr || indices == nullptr) { return false; }
+
+	const size_t vertexCount   = _pmxData->GetVertexCount();
+	const int    materialCount = (int)_pmxData->GetMaterialCount();
+	const int    boneCount     = (int)_pmxData->GetBoneCount();
+
+	/*-------------------------------------------------------------------
+	-			Morph offset of each vertex (all morphs at weight 1)
+	---------------------------------------------------------------------*/
+	std::vector<float> morphMargins(vertexCount, 0.0f);
+	for (const auto& morph : _pmxData->GetMorphingMap())
+	{
+		for (const auto& positionMorph : morph.second.PositionMorphs)
+		{
+			if (positionMorph.VertexIndex < 0 || (size_t)positionMorph.VertexIndex >= vertexCount) { continue; }
+			const Float3& offset = positionMorph.Position;
+			morphMargins[positionMorph.VertexIndex] += sqrtf(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-			Box of each (material, bone)
+	---------------------------------------------------------------------*/
+	std::vector<int> boneSlots(boneCount, -1); // bone -> index of _materialBoneBoxes (current material)
+	_materialIndexOffsets  .resize(materialCount);
+	_materialBoneBoxOffsets.resize(materialCount + 1);
+	_materialBoneBoxes     .clear();
+
+	UINT32 indexOffset = 0;
+	for (int material = 0; material < materialCount; ++material)
+	{
+		const UINT32 firstBox   = (UINT32)_materialBoneBoxes.size();
+		const UINT32 indexCount = _pmxData->GetIndexCountForMaterial(material);
+		_materialIndexOffsets  [material] = indexOffset;
+		_materialBoneBoxOffsets[material] = firstBox;
+
+		float margin = 0.0f;
+		for (UINT32 i = indexOffset; i < indexOffset + indexCount; ++i)
+		{
+			const PMXVertex& vertex = vertices[indices[i]];
+			margin = (std::max)(margin, morphMargins[indices[i]]);
+
+			// same bones as the vertex shader (0 : BDEF1, 2 : BDEF4, others : two bones)
+			const int influenceCount = vertex.WeightType == 0 ? 1 : vertex.WeightType == 2 ? 4 : 2;
+			for (int k = 0; k < influenceCount; ++k)
+			{
+				const INT32 bone = vertex.BoneIndices[k];
+				if (bone < 0 || bone >= boneCount)                           { continue; }
+				if (vertex.WeightType == 2 && vertex.BoneWeights[k] <= 0.0f) { continue; }
+
+				if (boneSlots[bone] < 0)
+				{
+					boneSlots[bone] = (int)_materialBoneBoxes.size();
+					_materialBoneBoxes.push_back(MaterialBoneBox{ bone, VisibilityBox() });
+				}
+				_materialBoneBoxes[boneSlots[bone]].Box.Merge(vertex.Vertex.Position);
+			}
+		}
+
+		for (UINT32 i = firstBox; i < (UINT32)_materialBoneBoxes.size(); ++i)
+		{
+			boneSlots[_materialBoneBoxes[i].Bone] = -1;
+			_materialBoneBoxes[i].Box.Expand(margin);
+		}
+		indexOffset += indexCount;
+	}
+	_materialBoneBoxOffsets[materialCount] = (UINT32)_materialBoneBoxes.size();
+
+	_boneWorldMatrices .resize(boneCount);
+	_materialWorldBoxes.resize(materialCount);
+	return true;
+}
+
 #pragma endregion Prepare
 #pragma region Update 
 /****************************************************************************
@@ -872,6 +1032,7 @@ void PMXModel::UpdateNodeAnimation(bool isAfterPhysics, int frameNo)
 *****************************************************************************/
 void PMXModel::UpdatePhysicsAnimation(float deltaTime)
 {
+	PROFILE_FUNCTION();
 	PMXPhysicsManager* physicsManager = GetPMXPhysicsManager();
 	MMDPhysics*        physics        = physicsManager->GetMMDPhysics();
 	if (physics == nullptr) { return; }
@@ -900,7 +1061,7 @@ void PMXModel::UpdatePhysicsAnimation(float deltaTime)
 	}
 	for (auto name : _rootBoneNodeNames)
 	{
-		_boneMap.get()->at(name).UpdateSelfandChildMatrix();
+		FindBoneNode(name)->UpdateSelfandChildMatrix();
 	}
 }
 
@@ -914,6 +1075,7 @@ void PMXModel::UpdatePhysicsAnimation(float deltaTime)
 *****************************************************************************/
 bool PMXModel::UpdateGPUData()
 {
+	PROFILE_FUNCTION();
 	/*-------------------------------------------------------------------
 	-               Map Model Object
 	---------------------------------------------------------------------*/
@@ -927,6 +1089,7 @@ bool PMXModel::UpdateGPUData()
 	-               Map Bone Matrix
 	---------------------------------------------------------------------*/
 	WriteBoneParameterToBuffer();
+	UpdateWorldBoxes();
 
 	auto morphVertex = _vertices.get();
 	auto vertexBuffer = _vertexBuffer[_currentFrameIndex].get();
@@ -936,6 +1099,35 @@ bool PMXModel::UpdateGPUData()
 	return true;
 }
 
+/****************************************************************************
+*                       UpdateWorldBoxes
+*************************************************************************//**
+*  @fn        void PMXModel::UpdateWorldBoxes()
+*  @brief     Move the (material, bone) boxes by the current bone matrices and the world matrix
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void PMXModel::UpdateWorldBoxes()
+{
+	Matrix4 world = Matrix4(_worldInfo.World);
+	for (size_t i = 0; i < _boneWorldMatrices.size(); ++i)
+	{
+		_boneWorldMatrices[i] = (_boneMatrices.get()->at(i) * world).ToFloat4x4();
+	}
+
+	_worldBox = VisibilityBox();
+	for (size_t material = 0; material < _materialWorldBoxes.size(); ++material)
+	{
+		VisibilityBox box;
+		for (UINT32 i = _materialBoneBoxOffsets[material]; i < _materialBoneBoxOffsets[material + 1]; ++i)
+		{
+			box.Merge(_materialBoneBoxes[i].Box.Transform(_boneWorldMatrices[_materialBoneBoxes[i].Bone]));
+		}
+		_materialWorldBoxes[material] = box;
+		_worldBox.Merge(box);
+	}
+}
+
 /****************************************************************************
 *                       UpdateTotalAnimation
 *************************************************************************//**
@@ -957,6 +1149,7 @@ void PMXModel::UpdateTotalAnimation()
 
 bool PMXModel::UpdateMorph(UINT32 frameNo)
 {
+	PROFILE_FUNCTION();
 	if (!_motionData[_currentMotionName]->IsExistedMorphingMap()) { return false; }
 	SetUpParallelUpdate();
 
@@ -1029,6 +1222,7 @@ bool PMXModel::UpdateMorph(UINT32 frameNo)
 			{
 				_threads[i] = std::thread([i, &ranges, &iteratorMorph, t, &vertices]
 				{
+					PROFILE_SCOPE("PMXModel::UpdateMorph::Thread");
 					for (int j = 0; j < ranges[i].VertexCount; ++j)
 					{
 						auto index = iteratorMorph->second.PositionMorphs[j + ranges[i].VertexOffset].VertexIndex;
@@ -1058,7 +1252,7 @@ bool PMXModel::UpdateMorph(UINT32 frameNo)
 
 void PMXModel::UpdateBoneNodeTransform(UINT32 frameNo)
 {
-	auto boneMap = _boneMap.get();
+	PROFILE_FUNCTION();
 
 	/*-------------------------------------------------------------------
 	-               Update Motion Data
@@ -1069,13 +1263,13 @@ void PMXModel::UpdateBoneNodeTransform(UINT32 frameNo)
 		std::vector<VMDKeyFrame> keyFrames = boneMotion.second;
 
 		// Find bone node
-		const auto iteratorBoneNode = boneMap->find(boneName);
-		if (iteratorBoneNode == boneMap->end()) { continue; }
+		PMXBoneNode* foundBoneNode = FindBoneNode(boneName);
+		if (foundBoneNode == nullptr) { continue; }
 
 		/*-------------------------------------------------------------------
 		-     Find bone node
 		---------------------------------------------------------------------*/
-		auto& boneNode = iteratorBoneNode->second;
+		auto& boneNode = *foundBoneNode;
 
 		/*-------------------------------------------------------------------
 		-      For each motion, select the closest to the desired frame number
@@ -1115,6 +1309,7 @@ void PMXModel::UpdateBoneNodeTransform(UINT32 frameNo)
 }
 bool PMXModel::UpdateMotion(UINT32 frameNo)
 {
+	PROFILE_FUNCTION();
 	if (!_isAnimation) { return false; }
 
 	ClearBoneMatrices();
@@ -1212,7 +1407,7 @@ void PMXModel::ResetPhysics()
 
 	for (auto& name : _rootBoneNodeNames)
 	{
-		_boneMap.get()->at(name).UpdateSelfandChildMatrix();
+		FindBoneNode(name)->UpdateSelfandChildMatrix();
 	}
 
 	for (auto& rigidBody : *rigidBodies)
@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Include/Model/MMD/VMDFile.hpp"
 #include "GameCore/Include/File/FileUtility.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <filesystem>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +65,7 @@ VMDFile::~VMDFile()
 *****************************************************************************/
 bool VMDFile::LoadVMDFile(const std::wstring& filePath)
 {
+	PROFILE_FUNCTION();
 	using namespace vmd;
 
 	/*-------------------------------------------------------------------
@@ -23,10 +23,10 @@
 //////////////////////////////////////////////////////////////////////////////////
 void ModelTableManager::Clear()
 {
-	ModelTablePMD.clear();
-	ModelTablePMX.clear();
-	ModelTableObj.clear();
-	ModelTableFbx.clear();
+	ModelTablePMD.Clear();
+	ModelTablePMX.Clear();
+	ModelTableObj.Clear();
+	ModelTableFbx.Clear();
 }
 /****************************************************************************
 *                       Load3DModel
@@ -42,9 +42,10 @@ void ModelLoader::Load3DModel(const std::wstring& filePath, std::shared_ptr<PMDD
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_modelTableManager.Instance().ModelTablePMD.find(filePath) != _modelTableManager.Instance().ModelTablePMD.end())
+	const std::shared_ptr<PMDData>* cached = _modelTableManager.Instance().ModelTablePMD.Find(filePath);
+	if (cached != nullptr)
 	{
-		*pmdData = _modelTableManager.Instance().ModelTablePMD[filePath];
+		*pmdData = *cached;
 		return;
 	}
 
@@ -84,9 +85,10 @@ void ModelLoader::Load3DModel(const std::wstring& filePath, std::shared_ptr<PMXD
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_modelTableManager.Instance().ModelTablePMX.find(filePath) != _modelTableManager.Instance().ModelTablePMX.end())
+	const std::shared_ptr<PMXData>* cached = _modelTableManager.Instance().ModelTablePMX.Find(filePath);
+	if (cached != nullptr)
 	{
-		*pmxData = _modelTableManager.Instance().ModelTablePMX[filePath];
+		*pmxData = *cached;
 		return;
 	}
 
@@ -127,9 +129,10 @@ void ModelLoader::Load3DModel(const std::wstring& filePath, std::shared_ptr<FBXD
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_modelTableManager.Instance().ModelTableFbx.find(filePath) != _modelTableManager.Instance().ModelTableFbx.end())
+	const std::shared_ptr<FBXData>* cached = _modelTableManager.Instance().ModelTableFbx.Find(filePath);
+	if (cached != nullptr)
 	{
-		*fbxData = _modelTableManager.Instance().ModelTableFbx[filePath];
+		*fbxData = *cached;
 		return;
 	}
 
@@ -167,9 +170,10 @@ void ModelLoader::Load3DModel(const std::wstring& filePath, std::shared_ptr<OBJD
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_modelTableManager.Instance().ModelTableObj.find(filePath) != _modelTableManager.Instance().ModelTableObj.end())
+	const std::shared_ptr<OBJData>* cached = _modelTableManager.Instance().ModelTableObj.Find(filePath);
+	if (cached != nullptr)
 	{
-		*objData = _modelTableManager.Instance().ModelTableObj[filePath];
+		*objData = *cached;
 		return;
 	}
 
@@ -33,9 +33,10 @@ void MotionLoader::LoadMotion(const std::wstring& filePath, std::shared_ptr<VMDF
 	/*-------------------------------------------------------------------
 	-               If the file is loaded once, read from it
 	---------------------------------------------------------------------*/
-	if (_motionTableManager.Instance().MotionTableVMD.find(filePath) != _motionTableManager.Instance().MotionTableVMD.end())
+	const std::shared_ptr<VMDFile>* cached = _motionTableManager.Instance().MotionTableVMD.Find(filePath);
+	if (cached != nullptr)
 	{
-		*vmdData = _motionTableManager.Instance().MotionTableVMD[filePath];
+		*vmdData = *cached;
 		return;
 	}
 
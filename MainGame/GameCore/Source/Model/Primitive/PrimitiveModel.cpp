@@ -144,6 +144,9 @@ bool PrimitiveModel::PrepareVertexBuffer()
 	int vertexCount    = static_cast<int>(_meshData.Vertices.size());
 	int vertexByteSize = sizeof(VertexPositionNormalTexture);
 
+	_localBox = VisibilityBox();
+	for (const auto& vertex : _meshData.Vertices) { _localBox.Merge(vertex.Position); }
+
 	/*-------------------------------------------------------------------
 	-			Build CPU and GPU Vertex Buffer
 	---------------------------------------------------------------------*/
@@ -236,8 +239,9 @@ bool PrimitiveModel::PrepareMaterialBuffer()
 	/*-------------------------------------------------------------------
 	-			Create Constant Buffer View
 	---------------------------------------------------------------------*/
+	if (!_materialView.Issue(HeapType::CBV)) { return false; }
 	directX12.GetDevice()->CreateConstantBufferView(
-		&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, directX12.IssueViewID(HeapType::CBV)));
+		&cbvDesc, directX12.GetCPUResourceView(HeapType::CBV, _materialView.GetIndex()));
 	return true;
 }
 bool PrimitiveModel::PrepareObjectBuffer()
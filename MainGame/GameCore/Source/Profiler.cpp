@@ -0,0 +1,509 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Profiler.cpp
+///             @brief  Hierarchical CPU profiler (scoped markers, per frame statistics, Chrome trace export)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Profiler.hpp"
+#include <chrono>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	std::uint64_t MixPath(std::uint64_t parent, std::uint64_t value)
+	{
+		/*--- splitmix64 finalizer ---*/
+		std::uint64_t x = parent ^ (value + 0x9E3779B97F4A7C15ull + (parent << 6) + (parent >> 2));
+		x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ull;
+		x ^= x >> 27; x *= 0x94D049BB133111EBull;
+		x ^= x >> 31;
+		return x == 0 ? 1 : x; // 0 is the parent of the root scopes
+	}
+
+	std::uint64_t GetThreadRoot(std::uint32_t thread)
+	{
+		return MixPath(0, static_cast<std::uint64_t>(thread) + 1);
+	}
+
+	void WriteJsonString(std::ostream& stream, const char* text)
+	{
+		stream << '"';
+		for (const char* c = text; *c != '\0'; ++c)
+		{
+			const unsigned char code = static_cast<unsigned char>(*c);
+			if      (code == '"' || code == '\\') { stream << '\\' << *c; }
+			else if (code < 0x20)
+			{
+				char escape[8];
+				std::snprintf(escape, sizeof(escape), "\\u%04x", code);
+				stream << escape;
+			}
+			else { stream << *c; }
+		}
+		stream << '"';
+	}
+
+	/* complete event ("X"), the time is in microseconds */
+	void WriteTraceEvent(std::ostream& stream, const char* name, const char* category, std::int64_t begin, std::int64_t end, std::uint32_t thread)
+	{
+		char time[96];
+		std::snprintf(time, sizeof(time), "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+			static_cast<double>(begin) / 1000.0, static_cast<double>(end - begin) / 1000.0, thread);
+		stream << ",\n{\"name\":";
+		WriteJsonString(stream, name);
+		stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\"," << time;
+	}
+
+	double ToMilliseconds(std::int64_t time) { return static_cast<double>(time) / 1000000.0; }
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+Profiler::Profiler()
+{
+	_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	_frames.resize(PROFILER_HISTORY_FRAMES);
+}
+
+#pragma region Public Function
+/****************************************************************************
+*                       SetThreadName
+*************************************************************************//**
+*  @fn        void Profiler::SetThreadName(const std::string& name)
+*  @brief     Set the name of the calling thread (statistics and trace)
+*  @param[in] const std::string& name
+*  @return @@void
+*****************************************************************************/
+void Profiler::SetThreadName(const std::string& name)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(_mutex);
+	buffer->Name = name;
+}
+
+/****************************************************************************
+*                       EndFrame
+*************************************************************************//**
+*  @fn        void Profiler::EndFrame()
+*  @brief     Collect the events of the threads, and move the frame times of the scopes into the history.
+*             Call once per frame from one thread.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void Profiler::EndFrame()
+{
+	const std::uint32_t thread = GetThreadBuffer()->Index;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	CollectEvents();
+
+	const size_t       slot = static_cast<size_t>(_frameCount % PROFILER_HISTORY_FRAMES);
+	const std::int64_t now  = Now();
+	for (Node& node : _nodes)
+	{
+		node.History[slot] = node.Current;
+		node.Current       = FrameSample();
+	}
+
+	/*-------------------------------------------------------------------
+	-               Keep the events for the trace (reuse the oldest frame)
+	---------------------------------------------------------------------*/
+	_currentFrame.End    = now;
+	_currentFrame.Thread = thread;
+	std::swap(_frames[slot], _currentFrame);
+	_currentFrame.Events.clear();
+	_currentFrame.Begin = now;
+	_frameCount++;
+}
+
+/****************************************************************************
+*                       Reset
+*************************************************************************//**
+*  @fn        void Profiler::Reset()
+*  @brief     Clear the statistics and the trace (the events not collected yet are discarded)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void Profiler::Reset()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	CollectEvents();
+	_nodes      .clear();
+	_nodeIndices.clear();
+	for (FrameRecord& frame : _frames) { frame.Events.clear(); }
+	_currentFrame.Events.clear();
+	_currentFrame.Begin = Now();
+	_frameCount = 0;
+}
+
+/****************************************************************************
+*                       GetStatistics
+*************************************************************************//**
+*  @fn        std::vector<ProfileStatistics> Profiler::GetStatistics() const
+*  @brief     Statistics of the scopes over the history frames.
+*             The scopes are in depth first order of the call paths, and the threads in the order of their first event.
+*  @param[in] void
+*  @return @@std::vector<ProfileStatistics>
+*****************************************************************************/
+std::vector<ProfileStatistics> Profiler::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	const size_t historyCount = static_cast<size_t>((std::min)(_frameCount, static_cast<std::uint64_t>(PROFILER_HISTORY_FRAMES)));
+	const size_t lastSlot     = static_cast<size_t>((_frameCount + PROFILER_HISTORY_FRAMES - 1) % PROFILER_HISTORY_FRAMES);
+
+	/*-------------------------------------------------------------------
+	-               Children of each node (a node whose parent has not
+	-               finished yet is listed as a root)
+	---------------------------------------------------------------------*/
+	std::vector<std::vector<std::uint32_t>> children(_nodes.size());
+	std::vector<std::uint32_t>              roots;
+	for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(_nodes.size()); ++i)
+	{
+		const auto parent = _nodeIndices.find(_nodes[i].ParentID);
+		if (parent == _nodeIndices.end()) { roots.push_back(i); }
+		else                              { children[parent->second].push_back(i); }
+	}
+	std::stable_sort(roots.begin(), roots.end(), [&](std::uint32_t a, std::uint32_t b) { return _nodes[a].Thread < _nodes[b].Thread; });
+
+	/*-------------------------------------------------------------------
+	-               Depth first
+	---------------------------------------------------------------------*/
+	std::vector<ProfileStatistics> statistics;
+	statistics.reserve(_nodes.size());
+	std::vector<std::uint32_t> stack(roots.rbegin(), roots.rend());
+	while (!stack.empty())
+	{
+		const std::uint32_t index = stack.back(); stack.pop_back();
+		const Node&         node  = _nodes[index];
+		stack.insert(stack.end(), children[index].rbegin(), children[index].rend());
+
+		ProfileStatistics result;
+		result.Name       = node.Name;
+		result.ThreadName = _threadBuffers[node.Thread]->Name;
+		result.Thread     = node.Thread;
+		result.Depth      = node.Depth;
+		result.PathID     = node.PathID;
+		result.ParentID   = node.ParentID;
+		result.LastMs     = historyCount > 0 ? ToMilliseconds(node.History[lastSlot].Time) : 0.0;
+
+		std::int64_t  minTime = INT64_MAX, maxTime = 0, totalTime = 0;
+		std::uint64_t calls   = 0;
+		for (size_t frame = 0; frame < historyCount; ++frame)
+		{
+			const FrameSample& sample = node.History[frame];
+			if (sample.Calls == 0) { continue; }
+			minTime    = (std::min)(minTime, sample.Time);
+			maxTime    = (std::max)(maxTime, sample.Time);
+			totalTime += sample.Time;
+			calls     += sample.Calls;
+			result.FrameCount++;
+		}
+		if (result.FrameCount > 0)
+		{
+			result.MinMs        = ToMilliseconds(minTime);
+			result.MaxMs        = ToMilliseconds(maxTime);
+			result.AverageMs    = ToMilliseconds(totalTime) / result.FrameCount;
+			result.AverageCalls = static_cast<double>(calls) / result.FrameCount;
+		}
+		statistics.push_back(std::move(result));
+	}
+	return statistics;
+}
+
+/****************************************************************************
+*                       GetFrameStatistics
+*************************************************************************//**
+*  @fn        ProfileFrameStatistics Profiler::GetFrameStatistics() const
+*  @brief     Frame time (between the EndFrame calls) over the history frames
+*  @param[in] void
+*  @return @@ProfileFrameStatistics
+*****************************************************************************/
+ProfileFrameStatistics Profiler::GetFrameStatistics() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	ProfileFrameStatistics statistics;
+	statistics.TotalFrameCount = _frameCount;
+	statistics.FrameCount      = static_cast<std::uint32_t>((std::min)(_frameCount, static_cast<std::uint64_t>(PROFILER_HISTORY_FRAMES)));
+	for (const auto& buffer : _threadBuffers) { statistics.DroppedEventCount += buffer->DropCount.load(std::memory_order_relaxed); }
+	if (statistics.FrameCount == 0) { return statistics; }
+
+	std::int64_t minTime = INT64_MAX, maxTime = 0, totalTime = 0;
+	for (std::uint32_t frame = 0; frame < statistics.FrameCount; ++frame)
+	{
+		const std::int64_t time = _frames[frame].End - _frames[frame].Begin;
+		minTime    = (std::min)(minTime, time);
+		maxTime    = (std::max)(maxTime, time);
+		totalTime += time;
+	}
+	const FrameRecord& last = _frames[static_cast<size_t>((_frameCount - 1) % PROFILER_HISTORY_FRAMES)];
+	statistics.LastMs    = ToMilliseconds(last.End - last.Begin);
+	statistics.MinMs     = ToMilliseconds(minTime);
+	statistics.MaxMs     = ToMilliseconds(maxTime);
+	statistics.AverageMs = ToMilliseconds(totalTime) / statistics.FrameCount;
+	return statistics;
+}
+
+/****************************************************************************
+*                       GetReport
+*************************************************************************//**
+*  @fn        std::string Profiler::GetReport() const
+*  @brief     Frame time and the scope statistics as a text table (the scopes are indented by the depth)
+*  @param[in] void
+*  @return @@std::string
+*****************************************************************************/
+std::string Profiler::GetReport() const
+{
+	const ProfileFrameStatistics         frame      = GetFrameStatistics();
+	const std::vector<ProfileStatistics> statistics = GetStatistics();
+
+	std::string report;
+	char line[256];
+	std::snprintf(line, sizeof(line), "Frame  last %.3f ms  min %.3f ms  avg %.3f ms  max %.3f ms  (%u frames, %llu dropped events)\n",
+		frame.LastMs, frame.MinMs, frame.AverageMs, frame.MaxMs, frame.FrameCount, static_cast<unsigned long long>(frame.DroppedEventCount));
+	report += line;
+	std::snprintf(line, sizeof(line), "%-56s %9s %9s %9s %9s %8s\n", "Scope [ms]", "Last", "Min", "Avg", "Max", "Calls");
+	report += line;
+
+	std::uint32_t thread = UINT32_MAX;
+	for (const ProfileStatistics& scope : statistics)
+	{
+		if (scope.Thread != thread)
+		{
+			thread  = scope.Thread;
+			report += "[" + scope.ThreadName + "]\n";
+		}
+		const std::string name = std::string(2 * (scope.Depth + 1), ' ') + scope.Name;
+		std::snprintf(line, sizeof(line), "%-56s %9.3f %9.3f %9.3f %9.3f %8.1f\n",
+			name.c_str(), scope.LastMs, scope.MinMs, scope.AverageMs, scope.MaxMs, scope.AverageCalls);
+		report += line;
+	}
+	return report;
+}
+
+/****************************************************************************
+*                       WriteChromeTrace
+*************************************************************************//**
+*  @fn        void Profiler::WriteChromeTrace(std::ostream& stream)
+*  @brief     Write the history frames and the current frame in the trace event format
+*             (chrome://tracing, ui.perfetto.dev). The frames are "Frame" events on the thread calling EndFrame.
+*  @param[in] std::ostream& stream
+*  @return @@void
+*****************************************************************************/
+void Profiler::WriteChromeTrace(std::ostream& stream)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	CollectEvents();
+
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"MainGame\"}}";
+	for (const auto& buffer : _threadBuffers)
+	{
+		stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->Index << ",\"args\":{\"name\":";
+		WriteJsonString(stream, buffer->Name.c_str());
+		stream << "}}";
+	}
+
+	/*-------------------------------------------------------------------
+	-               Oldest frame first
+	---------------------------------------------------------------------*/
+	const std::uint64_t historyCount = (std::min)(_frameCount, static_cast<std::uint64_t>(PROFILER_HISTORY_FRAMES));
+	for (std::uint64_t frame = _frameCount - historyCount; frame < _frameCount; ++frame)
+	{
+		const FrameRecord& record = _frames[static_cast<size_t>(frame % PROFILER_HISTORY_FRAMES)];
+		const std::string  name   = "Frame " + std::to_string(frame);
+		WriteTraceEvent(stream, name.c_str(), "frame", record.Begin, record.End, record.Thread);
+		for (const ProfileEvent& event : record.Events) { WriteTraceEvent(stream, event.Name, "cpu", event.Begin, event.End, event.Thread); }
+	}
+	for (const ProfileEvent& event : _currentFrame.Events) { WriteTraceEvent(stream, event.Name, "cpu", event.Begin, event.End, event.Thread); }
+	stream << "\n]}\n";
+}
+
+/****************************************************************************
+*                       ExportChromeTrace
+*************************************************************************//**
+*  @fn        bool Profiler::ExportChromeTrace(const std::wstring& filePath)
+*  @brief     Save the trace (WriteChromeTrace) as a JSON file
+*  @param[in] const std::wstring& filePath
+*  @return @@bool
+*****************************************************************************/
+bool Profiler::ExportChromeTrace(const std::wstring& filePath)
+{
+	std::ofstream stream(std::filesystem::path(filePath), std::ios::out | std::ios::trunc);
+	if (!stream) { return false; }
+	WriteChromeTrace(stream);
+	stream.flush();
+	return stream.good();
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       GetThreadBuffer
+*************************************************************************//**
+*  @fn        Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+*  @brief     Buffer of the calling thread (acquired at the first call, released when the thread exits)
+*  @param[in] void
+*  @return @@ThreadBuffer*
+*****************************************************************************/
+Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+{
+	struct ThreadOwner
+	{
+		ThreadBuffer* Buffer = nullptr;
+		~ThreadOwner() { if (Buffer != nullptr) { Buffer->IsReleased.store(true, std::memory_order_release); } }
+	};
+	static thread_local ThreadOwner owner;
+	if (owner.Buffer == nullptr) { owner.Buffer = AcquireThreadBuffer(); }
+	return owner.Buffer;
+}
+
+/****************************************************************************
+*                       AcquireThreadBuffer
+*************************************************************************//**
+*  @fn        Profiler::ThreadBuffer* Profiler::AcquireThreadBuffer()
+*  @brief     Reuse a buffer of an exited thread (the short lived threads keep the buffer count small),
+*             or create a new buffer.
+*  @param[in] void
+*  @return @@ThreadBuffer*
+*****************************************************************************/
+Profiler::ThreadBuffer* Profiler::AcquireThreadBuffer()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto& buffer : _threadBuffers)
+	{
+		if (!buffer->IsFree) { continue; }
+		buffer->IsFree = false;
+		buffer->IsReleased.store(false, std::memory_order_relaxed);
+		buffer->Depth  = 0;
+		buffer->Name   = "Thread " + std::to_string(buffer->Index);
+		return buffer.get();
+	}
+
+	auto buffer    = std::make_unique<ThreadBuffer>();
+	buffer->Events = std::make_unique<ProfileEvent[]>(PROFILER_EVENT_CAPACITY);
+	buffer->Index  = static_cast<std::uint32_t>(_threadBuffers.size());
+	buffer->Name   = "Thread " + std::to_string(buffer->Index);
+	_threadBuffers.push_back(std::move(buffer));
+	return _threadBuffers.back().get();
+}
+
+/****************************************************************************
+*                       BeginScope
+*************************************************************************//**
+*  @fn        Profiler::ThreadBuffer* Profiler::BeginScope(const char* name, std::int64_t& begin)
+*  @brief     Push the call path of the scope (the calling thread only)
+*  @param[in] const char* name
+*  @param[out]std::int64_t& begin
+*  @return @@ThreadBuffer* (nullptr : disabled or too deep)
+*****************************************************************************/
+Profiler::ThreadBuffer* Profiler::BeginScope(const char* name, std::int64_t& begin)
+{
+	if (!_isEnabled.load(std::memory_order_relaxed)) { return nullptr; }
+
+	ThreadBuffer* buffer = GetThreadBuffer();
+	if (buffer->Depth >= PROFILER_MAX_DEPTH) { return nullptr; }
+
+	const std::uint64_t parent = buffer->Depth == 0 ? GetThreadRoot(buffer->Index) : buffer->PathStack[buffer->Depth - 1];
+	buffer->PathStack[buffer->Depth++] = MixPath(parent, reinterpret_cast<std::uintptr_t>(name));
+	begin = Now();
+	return buffer;
+}
+
+/****************************************************************************
+*                       EndScope
+*************************************************************************//**
+*  @fn        void Profiler::EndScope(ThreadBuffer* buffer, const char* name, std::int64_t begin)
+*  @brief     Write the event into the buffer of the thread (dropped when the buffer is full)
+*  @param[in] ThreadBuffer* buffer
+*  @param[in] const char* name
+*  @param[in] std::int64_t begin
+*  @return @@void
+*****************************************************************************/
+void Profiler::EndScope(ThreadBuffer* buffer, const char* name, std::int64_t begin)
+{
+	const std::int64_t  end   = Now();
+	const std::uint32_t depth = --buffer->Depth;
+
+	const std::uint64_t write = buffer->WriteCount.load(std::memory_order_relaxed);
+	if (write - buffer->ReadCount.load(std::memory_order_acquire) >= PROFILER_EVENT_CAPACITY)
+	{
+		buffer->DropCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	ProfileEvent& event = buffer->Events[write % PROFILER_EVENT_CAPACITY];
+	event.Name     = name;
+	event.PathID   = buffer->PathStack[depth];
+	event.ParentID = depth == 0 ? 0 : buffer->PathStack[depth - 1];
+	event.Begin    = begin;
+	event.End      = end;
+	event.Thread   = buffer->Index;
+	event.Depth    = depth;
+	buffer->WriteCount.store(write + 1, std::memory_order_release);
+}
+
+/****************************************************************************
+*                       CollectEvents
+*************************************************************************//**
+*  @fn        void Profiler::CollectEvents()
+*  @brief     Read the events written since the last call (_mutex is locked by the caller).
+*             The buffer of an exited thread is freed after its last events are read.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void Profiler::CollectEvents()
+{
+	for (auto& buffer : _threadBuffers)
+	{
+		if (buffer->IsFree) { continue; }
+
+		/*--- the release is read first, so its last events are visible ---*/
+		const bool          isReleased = buffer->IsReleased.load(std::memory_order_acquire);
+		const std::uint64_t write      = buffer->WriteCount.load(std::memory_order_acquire);
+		for (std::uint64_t read = buffer->ReadCount.load(std::memory_order_relaxed); read < write; ++read)
+		{
+			AddEvent(buffer->Events[read % PROFILER_EVENT_CAPACITY]);
+		}
+		buffer->ReadCount.store(write, std::memory_order_release);
+		if (isReleased) { buffer->IsFree = true; }
+	}
+}
+
+void Profiler::AddEvent(const ProfileEvent& event)
+{
+	auto found = _nodeIndices.find(event.PathID);
+	if (found == _nodeIndices.end())
+	{
+		Node node;
+		node.Name     = event.Name;
+		node.PathID   = event.PathID;
+		node.ParentID = event.ParentID;
+		node.Thread   = event.Thread;
+		node.Depth    = event.Depth;
+		node.History.resize(PROFILER_HISTORY_FRAMES);
+		found = _nodeIndices.emplace(event.PathID, static_cast<std::uint32_t>(_nodes.size())).first;
+		_nodes.push_back(std::move(node));
+	}
+
+	FrameSample& sample = _nodes[found->second].Current;
+	sample.Time += event.End - event.Begin;
+	sample.Calls++;
+	_currentFrame.Events.push_back(event);
+}
+
+std::int64_t Profiler::Now() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - _epoch;
+}
+#pragma endregion Private Function
@@ -15,6 +15,7 @@
 #include "GameCore/Include/Model/Primitive/PrimitiveModel.hpp"
 #include "GameMath/Include/GMColor.hpp"
 #include <d3dcompiler.h>
+#include <algorithm>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -27,102 +28,12 @@ static const int g_Resolution[(int)ShadowViewType::CountOfShadowViewType] =
 	256,  // far    plane
 };
 
-#define CAMERA_WIDTH  (1000.0f)
-#define CAMERA_HEIGHT (1000.0f)
-#define CAMERA_FAR    (1000.0f)
-#define CAMERA_FOV    (0.25f * GM_PI)
-#define CAMERA_NEAR   (1.0f)
-
-
 //////////////////////////////////////////////////////////////////////////////////
 //                              Implement
 //////////////////////////////////////////////////////////////////////////////////
-void CascadeShadowMapMatrix::CalculateLightViewProjectionCropMatrix(const Camera& camera, const Vector3& lightDirection, const Vector4& plane)
-{
-	/*-------------------------------------------------------------------
-	-      Calculate shadow map
-	---------------------------------------------------------------------*/
-	Matrix4 lvpMatrix = Shadow(-lightDirection, plane); // direction light only
-
-	/*-------------------------------------------------------------------
-	-      Calculate light view projection
-	---------------------------------------------------------------------*/
-	float cascadeAreaTable[(int)ShadowViewType::CountOfShadowViewType] =
-	{
-		camera.GetFarZ() * 0.05f,
-		camera.GetFarZ() * 0.3f,
-		camera.GetFarZ()
-	};
-
-	// get camera vector
-	const auto& look  = camera.GetLook();
-	const auto& right = camera.GetRight();
-	const auto& up    = camera.GetUp();
-
-	float nearDepth = camera.GetNearZ();
-	for (int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
-	{
-		float nearY = tanf(camera.GetFovVertical() * 0.5f) * nearDepth;
-		float nearX = nearY * camera.GetAspect();
-		float farY  = tanf(camera.GetFovVertical() * 0.5f) * cascadeAreaTable[i];
-		float farX  = farY * camera.GetAspect();
-
-		/*-------------------------------------------------------------------
-		-      Get plane center position
-		---------------------------------------------------------------------*/
-		Vector3 nearPosition = camera.GetPosition() + look * nearDepth;
-		Vector3 farPosition  = camera.GetPosition() + look * cascadeAreaTable[i];
-
-		/*-------------------------------------------------------------------
-		-      Get vertex
-		---------------------------------------------------------------------*/
-		Vector3 vertex[8];
-		vertex[0] += nearPosition + up * (+nearY) + right * (+nearX);
-		vertex[1] += nearPosition + up * (+nearY) + right * (-nearX);
-		vertex[2] += nearPosition + up * (-nearY) + right * (+nearX);
-		vertex[3] += nearPosition + up * (-nearY) + right * (-nearX);
-		vertex[4] += nearPosition + up * (+farY ) + right * (+farX );
-		vertex[5] += nearPosition + up * (+farY ) + right * (-farX );
-		vertex[6] += nearPosition + up * (-farY ) + right * (+farX );
-		vertex[7] += nearPosition + up * (-farY ) + right * (-farX );
-
-		Vector3 vMax, vMin;
-		vMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
-		vMin = { FLT_MAX, FLT_MAX, FLT_MAX };
-		for (auto& v : vertex)
-		{
-			Vector4 temp = lvpMatrix * Vector4(v, 0);
-			v = Vector3(temp);
-			vMax = Max(vMax, v);
-			vMin = Min(vMin, v);
-		}
-		
-		/*-------------------------------------------------------------------
-		-      Calculate crop matrix
-		---------------------------------------------------------------------*/
-		float xScale = 2.0f / (vMax.GetX() - vMin.GetX());
-		float yScale = 2.0f / (vMax.GetY() - vMin.GetY());
-		float xOffset = (vMax.GetX() + vMin.GetX()) * (-0.5f) * xScale;
-		float yOffset = (vMax.GetY() + vMin.GetY()) * (-0.5f) * yScale;
-		Matrix4 clopMatrix;
-		clopMatrix.SetX(Vector4(xScale, 0, 0, 0));
-		clopMatrix.SetY(Vector4(0, yScale, 0, 0));
-		clopMatrix.SetW(Vector4(xOffset, yOffset, 0, 1));
-
-		/*-------------------------------------------------------------------
-		-      Multiply light view projection and crop matrix
-		---------------------------------------------------------------------*/
-		_lightViewMatrix[i] = lvpMatrix * clopMatrix;
-		nearDepth = cascadeAreaTable[i];
-	}
-
-	
-}
-
 CascadeShadowMap::CascadeShadowMap()
 {
-	CameraPtr camera = std::make_unique<Camera>();
-	_lightCamera = std::move(camera);
+
 }
 
 CascadeShadowMap::~CascadeShadowMap()
@@ -138,7 +49,6 @@ bool CascadeShadowMap::Initialize()
 	if (!PrepareRootSignature()) { return false; }
 	if (!PreparePipelineState())  { return false; }
 	if (!PrepareResources())     { return false; }
-	if (!PrepareCamera())        { return false; }
 	if (!PrepareConstantBuffer()) { return false; }
 	for (auto& buffer : _shadowBuffers)
 	{
@@ -163,7 +73,12 @@ void CascadeShadowMap::Finalize()
 		_shadowBuffers[i].get()->Resource()->Release();
 		_shadowBuffers[i].reset();
 	}
-	_lightCamera.reset();
+	/*-------------------------------------------------------------------
+	-                       Clear Casters
+	---------------------------------------------------------------------*/
+	_casters.clear(); _casters.shrink_to_fit();
+	for (auto& casters : _visibleCasters) { casters.clear(); }
+	_casterBounds.Clear();
 	/*-------------------------------------------------------------------
 	-                       Clear RootSignature
 	---------------------------------------------------------------------*/
@@ -175,18 +90,57 @@ void CascadeShadowMap::Finalize()
 	_pipelines.clear(); _pipelines.shrink_to_fit();
 }
 
+/****************************************************************************
+*                       AddActor
+*************************************************************************//**
+*  @fn        void CascadeShadowMap::AddActor(GameActor* nearActor, GameActor* mediumActor, GameActor* farActor)
+*  @brief     Register the casters of each cascade (nullptr : not added).
+*             The same actor is registered once, so its bounds are tested once for all cascades.
+*  @param[in] GameActor* nearActor
+*  @param[in] GameActor* mediumActor
+*  @param[in] GameActor* farActor
+*  @return @@void
+*****************************************************************************/
 void CascadeShadowMap::AddActor(GameActor* nearActor, GameActor* mediumActor, GameActor* farActor)
 {
-	if (nearActor   != nullptr) { _actors[(int)ShadowViewType::Near]  .push_back(nearActor); }
-	if (mediumActor != nullptr) { _actors[(int)ShadowViewType::Medium].push_back(mediumActor); }
-	if (farActor    != nullptr) { _actors[(int)ShadowViewType::Far]   .push_back(farActor); }
-}
+	GameActor* actors[(int)ShadowViewType::CountOfShadowViewType] = { nearActor, mediumActor, farActor };
+	for (int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
+	{
+		if (actors[i] == nullptr) { continue; }
 
+		auto caster = std::find_if(_casters.begin(), _casters.end(), [&](const ShadowCaster& c) { return c.Actor == actors[i]; });
+		if (caster == _casters.end())
+		{
+			_casters.push_back(ShadowCaster{ actors[i], 0 });
+			caster = _casters.end() - 1;
+		}
+		caster->CascadeMask |= 1u << i;
+	}
+}
 
-bool CascadeShadowMap::Execute(const gm::Vector3& lightDirection)
+/****************************************************************************
+*                       Execute
+*************************************************************************//**
+*  @fn        bool CascadeShadowMap::Execute(const gm::Float3& lightDirection, const Camera& camera, VisibilityCulling& culling)
+*  @brief     Fit the cascades to the camera, cull the casters and draw the shadow maps
+*  @param[in] const gm::Float3& lightDirection
+*  @param[in] const Camera& camera
+*  @param[in,out] VisibilityCulling& culling
+*  @return @@bool
+*****************************************************************************/
+bool CascadeShadowMap::Execute(const gm::Float3& lightDirection, const Camera& camera, VisibilityCulling& culling)
 {
-	if (gm::NormSquared(lightDirection) < 0.001f) { return true ; }
-	UpdateLightCamera(lightDirection);
+	if (lightDirection.x * lightDirection.x + lightDirection.y * lightDirection.y + lightDirection.z * lightDirection.z < 0.001f) { return true ; }
+	UpdateLightCamera(lightDirection, camera);
+	CullShadowCasters(culling);
+	for (int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
+	{
+		shadow::ShadowCameraInfo shadowInfo;
+		shadowInfo.ViewProjection = _cascadeShadowMapMatrix.GetLightViewProjectionCropMatrix(i);
+		_shadowBuffers[i].get()->CopyStart();
+		_shadowBuffers[i].get()->CopyData(0, shadowInfo);
+		_shadowBuffers[i].get()->CopyEnd();
+	}
 
 	/*-------------------------------------------------------------------
 	-               Set Valiables
@@ -214,13 +168,12 @@ bool CascadeShadowMap::Execute(const gm::Vector3& lightDirection)
 		commandList->ClearRenderTargetView(colorRTV, _colorBuffers[i].GetClearColor(), 0, nullptr);
 		commandList->OMSetRenderTargets(1, &colorRTV, true, nullptr);
 		commandList->SetGraphicsRootConstantBufferView(1, _shadowBuffers[i].get()->Resource()->GetGPUVirtualAddress());
-		for (int j = 0; j < _actors[i].size(); ++j)
+		for (GameActor* actor : _visibleCasters[i])
 		{
-			if (!_actors[i][j]->IsActive()) { continue; }
-			switch ((ActorType)_actors[i][j]->GetActorType())
+			switch ((ActorType)actor->GetActorType())
 			{
-				case ActorType::PMX: { DrawPMXActor(i, j); break; }
-				case ActorType::Primitive: { DrawPrimitiveActor(i, j); break; }
+				case ActorType::PMX: { DrawPMXActor(actor); break; }
+				case ActorType::Primitive: { DrawPrimitiveActor(actor); break; }
 				default: { break; }
 			}
 		}
@@ -336,14 +289,14 @@ bool CascadeShadowMap::PrepareResources()
 /****************************************************************************
 *							DrawPMXActor
 *************************************************************************//**
-*  @fn        bool ZPrepass::DrawPMXActor(int index)
-*  @brief     Draw pmx format actor (This function uses in Initialize)
-*  @param[in] int actor index
+*  @fn        bool CascadeShadowMap::DrawPMXActor(GameActor* gameActor)
+*  @brief     Draw pmx format actor
+*  @param[in] GameActor* gameActor
 *  @return @@bool
 *****************************************************************************/
-bool CascadeShadowMap::DrawPMXActor(int shadowType, int modelIndex)
+bool CascadeShadowMap::DrawPMXActor(GameActor* gameActor)
 {
-	PMXModel* actor = (PMXModel*)_actors[shadowType][modelIndex];
+	PMXModel* actor = (PMXModel*)gameActor;
 
 	/*-------------------------------------------------------------------
 	-               Prepare variable
@@ -363,7 +316,7 @@ bool CascadeShadowMap::DrawPMXActor(int shadowType, int modelIndex)
 	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 	commandList->IASetIndexBuffer(&indexBufferView);
 	commandList->SetGraphicsRootConstantBufferView(0, actor->GetModelWorldInfo()->Resource()->GetGPUVirtualAddress());
-	commandList->SetGraphicsRootConstantBufferView(3, actor->GetBoneBuffer()->Resource()->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(3, actor->GetBoneAddress());
 	commandList->DrawIndexedInstanced((UINT)actor->GetPMXData()->GetIndexCount(), 1, 0, 0, 0);
 
 
@@ -371,16 +324,16 @@ bool CascadeShadowMap::DrawPMXActor(int shadowType, int modelIndex)
 }
 
 /****************************************************************************
-*							DrawPMXActor
+*							DrawPrimitiveActor
 *************************************************************************//**
-*  @fn        bool ZPrepass::DrawPMXActor(int index)
-*  @brief     Draw pmx format actor (This function uses in Initialize)
-*  @param[in] int actor index
+*  @fn        bool CascadeShadowMap::DrawPrimitiveActor(GameActor* gameActor)
+*  @brief     Draw primitive actor
+*  @param[in] GameActor* gameActor
 *  @return @@bool
 *****************************************************************************/
-bool CascadeShadowMap::DrawPrimitiveActor(int shadowType, int modelIndex)
+bool CascadeShadowMap::DrawPrimitiveActor(GameActor* gameActor)
 {
-	PrimitiveModel* actor = (PrimitiveModel*)_actors[shadowType][modelIndex];
+	PrimitiveModel* actor = (PrimitiveModel*)gameActor;
 
 	/*-------------------------------------------------------------------
 	-               Prepare variable
@@ -406,13 +359,6 @@ bool CascadeShadowMap::DrawPrimitiveActor(int shadowType, int modelIndex)
 	return true;
 }
 
-bool CascadeShadowMap::PrepareCamera()
-{
-	auto camera = _lightCamera.get();
-	camera->SetOrthoLens(CAMERA_WIDTH, CAMERA_HEIGHT, CAMERA_NEAR, CAMERA_FAR);
-	return true;
-}
-
 bool CascadeShadowMap::PrepareConstantBuffer()
 {
 	// sceneConstant Buffer data
@@ -428,22 +374,95 @@ bool CascadeShadowMap::PrepareConstantBuffer()
 	return true;
 }
 
-bool CascadeShadowMap::UpdateLightCamera(const Vector3& lightDirection)
+/****************************************************************************
+*                       UpdateLightCamera
+*************************************************************************//**
+*  @fn        bool CascadeShadowMap::UpdateLightCamera(const gm::Float3& lightDirection, const Camera& camera)
+*  @brief     Fit the cascades to the scene camera
+*  @param[in] const gm::Float3& lightDirection
+*  @param[in] const Camera& camera
+*  @return @@bool
+*****************************************************************************/
+bool CascadeShadowMap::UpdateLightCamera(const Float3& lightDirection, const Camera& camera)
 {
-	_lightCamera.get()->SetPosition((lightDirection * (-_lightCamera.get()->GetFarZ())).ToFloat3());
-	_lightCamera.get()->LookAt(_lightCamera.get()->GetPosition3f(), gm::Float3(0, 0, 0), _lightCamera.get()->GetUp3f());
-	_lightCamera.get()->UpdateViewMatrix();
-	_cascadeShadowMapMatrix.CalculateLightViewProjectionCropMatrix(*_lightCamera.get(), lightDirection);
-	for(int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
-	{
-		shadow::ShadowCameraInfo shadowInfo;
-		shadowInfo.ViewProjection = _cascadeShadowMapMatrix.GetLightViewProjectionCropMatrix(i);
-		_shadowBuffers[i].get()->CopyStart();
-		_shadowBuffers[i].get()->CopyData(0, shadowInfo);
-		_shadowBuffers[i].get()->CopyEnd();
-	}
+	_cascadeShadowMapMatrix.CalculateLightViewProjectionCropMatrix(camera, lightDirection, g_Resolution);
 	return true;
 }
 
+/****************************************************************************
+*                       CullShadowCasters
+*************************************************************************//**
+*  @fn        void CascadeShadowMap::CullShadowCasters(VisibilityCulling& culling)
+*  @brief     Test the caster boxes against the crop boxes of all cascades at once,
+*             and pull the near plane of each cascade to its nearest caster.
+*             Casters without bounds are drawn to all of their cascades.
+*  @param[in,out] VisibilityCulling& culling
+*  @return @@void
+*****************************************************************************/
+void CascadeShadowMap::CullShadowCasters(VisibilityCulling& culling)
+{
+	/*-------------------------------------------------------------------
+	-               Collect the caster bounds
+	---------------------------------------------------------------------*/
+	_casterBounds.Clear();
+	_casterBoundIndices.resize(_casters.size());
+	for (size_t i = 0; i < _casters.size(); ++i)
+	{
+		GameActor*    actor = _casters[i].Actor;
+		VisibilityBox box;
+		switch ((ActorType)actor->GetActorType())
+		{
+			case ActorType::PMX:       { box = ((PMXModel*)actor)->GetWorldBox(); break; }
+			case ActorType::Primitive: { box = ((PrimitiveModel*)actor)->GetWorldBox(); break; }
+			default: { break; }
+		}
+
+		_casterBoundIndices[i] = -1;
+		if (!actor->IsActive() || box.IsEmpty()) { continue; }
+		_casterBoundIndices[i] = static_cast<INT32>(_casterBounds.Size());
+		_casterBounds.Add(box);
+	}
+
+	/*-------------------------------------------------------------------
+	-               Execute culling (one view per cascade)
+	---------------------------------------------------------------------*/
+	culling.ClearViews();
+	for (int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
+	{
+		culling.AddView(_cascadeShadowMapMatrix.GetCasterPlanes(i));
+	}
+	culling.Execute(_casterBounds);
+
+	/*-------------------------------------------------------------------
+	-               Visible casters of each cascade
+	---------------------------------------------------------------------*/
+	const Float3& forward = _cascadeShadowMapMatrix.GetLightForward();
+	for (int i = 0; i < (int)ShadowViewType::CountOfShadowViewType; ++i)
+	{
+		const std::vector<std::uint32_t>& visibleList = culling.GetVisibleList(i);
+		size_t cursor = 0; // both the visible list and the bound indices are ascending
+		float  nearZ  = FLT_MAX;
+
+		_visibleCasters[i].clear();
+		for (size_t j = 0; j < _casters.size(); ++j)
+		{
+			if ((_casters[j].CascadeMask & (1u << i)) == 0) { continue; }
+			if (!_casters[j].Actor->IsActive())            { continue; }
+
+			const INT32 boundIndex = _casterBoundIndices[j];
+			if (boundIndex >= 0)
+			{
+				while (cursor < visibleList.size() && visibleList[cursor] < (std::uint32_t)boundIndex) { ++cursor; }
+				if (cursor == visibleList.size() || visibleList[cursor] != (std::uint32_t)boundIndex) { continue; }
+
+				const float centerZ = forward.x * _casterBounds.CenterX[boundIndex] + forward.y * _casterBounds.CenterY[boundIndex] + forward.z * _casterBounds.CenterZ[boundIndex];
+				const float extentZ = fabsf(forward.x) * _casterBounds.ExtentX[boundIndex] + fabsf(forward.y) * _casterBounds.ExtentY[boundIndex] + fabsf(forward.z) * _casterBounds.ExtentZ[boundIndex];
+				nearZ = (std::min)(nearZ, centerZ - extentZ);
+			}
+			_visibleCasters[i].push_back(_casters[j].Actor);
+		}
+		if (nearZ < FLT_MAX) { _cascadeShadowMapMatrix.ExtendNearPlane(i, nearZ); }
+	}
+}
 
 #pragma endregion Private Function
\ No newline at end of file
@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CascadeShadowMapMatrix.cpp
+///             @brief  Split, fitting and texel snap of the cascade shadow map crop boxes
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/CascadeShadowMapMatrix.hpp"
+#include "GameCore/Include/Camera.hpp"
+#include <algorithm>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+
+namespace
+{
+	INLINE float DotFloat3(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	INLINE Float3 CrossFloat3(const Float3& a, const Float3& b)
+	{
+		return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+	}
+	INLINE Float3 NormalizeFloat3(const Float3& v)
+	{
+		const float length = sqrtf(DotFloat3(v, v));
+		return Float3(v.x / length, v.y / length, v.z / length);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       CalculateLightViewProjectionCropMatrix
+*************************************************************************//**
+*  @fn        void CascadeShadowMapMatrix::CalculateLightViewProjectionCropMatrix(const Camera& camera, const gm::Float3& lightDirection, const int resolution[CASCADE_COUNT])
+*  @brief     Fit the crop box of each cascade to the bounding sphere of its frustum slice.
+*             The sphere radius depends only on the lens, and the sphere center is snapped to the texel grid of the light view,
+*             so the shadow map texels keep the same world position while the camera moves or rotates.
+*  @param[in] const Camera& camera (scene camera)
+*  @param[in] const gm::Float3& lightDirection
+*  @param[in] const int resolution[CASCADE_COUNT]
+*  @return @@void
+*****************************************************************************/
+void CascadeShadowMapMatrix::CalculateLightViewProjectionCropMatrix(const Camera& camera, const Float3& lightDirection, const int resolution[CASCADE_COUNT])
+{
+	/*-------------------------------------------------------------------
+	-      Light view basis (the light view origin is the world origin)
+	-      The up vector is changed only when the light is almost vertical.
+	---------------------------------------------------------------------*/
+	if (DotFloat3(lightDirection, lightDirection) < 1e-12f) { return; }
+	_lightForward = NormalizeFloat3(lightDirection);
+	const Float3 worldUp = fabsf(_lightForward.y) > 0.99f ? Float3(0.0f, 0.0f, 1.0f) : Float3(0.0f, 1.0f, 0.0f);
+	_lightRight = NormalizeFloat3(CrossFloat3(worldUp, _lightForward));
+	_lightUp    = CrossFloat3(_lightForward, _lightRight);
+
+	/*-------------------------------------------------------------------
+	-      Split distances (practical split scheme)
+	---------------------------------------------------------------------*/
+	const float nearZ = camera.GetNearZ();
+	const float farZ  = _shadowDistance > 0.0f ? (std::min)(_shadowDistance, camera.GetFarZ()) : camera.GetFarZ();
+	for (int i = 0; i < CASCADE_COUNT; ++i)
+	{
+		const float rate        = (float)(i + 1) / CASCADE_COUNT;
+		const float logSplit    = nearZ * powf(farZ / nearZ, rate);
+		const float linearSplit = nearZ + (farZ - nearZ) * rate;
+		_splitDistances[i] = _splitLambda * logSplit + (1.0f - _splitLambda) * linearSplit;
+	}
+
+	/*-------------------------------------------------------------------
+	-      Bounding sphere of each frustum slice
+	---------------------------------------------------------------------*/
+	const float  tanHalfFov = tanf(camera.GetFovVertical() * 0.5f);
+	const float  cornerRate = tanHalfFov * tanHalfFov * (1.0f + camera.GetAspect() * camera.GetAspect()); // (corner distance from the view axis / depth)^2
+	const Float3 position   = camera.GetPosition3f();
+	const Float3 look       = camera.GetLook3f();
+
+	float sliceNear = nearZ;
+	for (int i = 0; i < CASCADE_COUNT; ++i)
+	{
+		const float sliceFar    = _splitDistances[i];
+		float       centerDepth = 0.5f * (sliceNear + sliceFar) * (1.0f + cornerRate);
+		float       radius      = 0.0f;
+		if (centerDepth >= sliceFar)
+		{
+			centerDepth = sliceFar;
+			radius      = sliceFar * sqrtf(cornerRate);
+		}
+		else
+		{
+			radius = sqrtf((sliceFar - centerDepth) * (sliceFar - centerDepth) + sliceFar * sliceFar * cornerRate);
+		}
+
+		/*-------------------------------------------------------------------
+		-      Snap the center to the texel grid.
+		-      The box is one texel larger than the sphere so that the snapped box still contains it.
+		---------------------------------------------------------------------*/
+		const float  halfSize  = radius * resolution[i] / (resolution[i] - 2.0f);
+		const float  texelSize = 2.0f * halfSize / resolution[i];
+		const Float3 center    = Float3(position.x + look.x * centerDepth, position.y + look.y * centerDepth, position.z + look.z * centerDepth);
+		const float  centerX   = floorf(DotFloat3(center, _lightRight) / texelSize) * texelSize;
+		const float  centerY   = floorf(DotFloat3(center, _lightUp)    / texelSize) * texelSize;
+		const float  centerZ   = DotFloat3(center, _lightForward);
+
+		CropBox& box = _cropBoxes[i];
+		box.Min = Float3(centerX - halfSize, centerY - halfSize, centerZ - halfSize);
+		box.Max = Float3(centerX + halfSize, centerY + halfSize, centerZ + halfSize);
+		UpdateCropMatrix(i);
+
+		/*-------------------------------------------------------------------
+		-      Caster planes (world space, inside : dot(normal, p) + d >= 0)
+		---------------------------------------------------------------------*/
+		FrustumPlanes& planes = _casterPlanes[i];
+		planes.Planes[0] = Float4( _lightRight.x,    _lightRight.y,    _lightRight.z,  -box.Min.x);
+		planes.Planes[1] = Float4(-_lightRight.x,   -_lightRight.y,   -_lightRight.z,   box.Max.x);
+		planes.Planes[2] = Float4( _lightUp.x,       _lightUp.y,       _lightUp.z,     -box.Min.y);
+		planes.Planes[3] = Float4(-_lightUp.x,      -_lightUp.y,      -_lightUp.z,      box.Max.y);
+		planes.Planes[4] = Float4( 0.0f, 0.0f, 0.0f, 1.0f); // the casters in front of the box can drop the shadow into it
+		planes.Planes[5] = Float4(-_lightForward.x, -_lightForward.y, -_lightForward.z, box.Max.z);
+
+		sliceNear = sliceFar;
+	}
+}
+
+/****************************************************************************
+*                       ExtendNearPlane
+*************************************************************************//**
+*  @fn        void CascadeShadowMapMatrix::ExtendNearPlane(int shadowMapID, float lightViewZ)
+*  @brief     Move the near plane toward the light (the texel grid does not change)
+*  @param[in] int shadowMapID
+*  @param[in] float lightViewZ
+*  @return @@void
+*****************************************************************************/
+void CascadeShadowMapMatrix::ExtendNearPlane(int shadowMapID, float lightViewZ)
+{
+	if (lightViewZ >= _cropBoxes[shadowMapID].Min.z) { return; }
+	_cropBoxes[shadowMapID].Min.z = lightViewZ;
+	UpdateCropMatrix(shadowMapID);
+}
+
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       UpdateCropMatrix
+*************************************************************************//**
+*  @fn        void CascadeShadowMapMatrix::UpdateCropMatrix(int shadowMapID)
+*  @brief     Light view * orthographic off center projection of the crop box
+*  @param[in] int shadowMapID
+*  @return @@void
+*****************************************************************************/
+void CascadeShadowMapMatrix::UpdateCropMatrix(int shadowMapID)
+{
+	const CropBox& box = _cropBoxes[shadowMapID];
+	const float scaleX = 2.0f / (box.Max.x - box.Min.x);
+	const float scaleY = 2.0f / (box.Max.y - box.Min.y);
+	const float scaleZ = 1.0f / (box.Max.z - box.Min.z);
+	_lightViewMatrix[shadowMapID] = Matrix4(Float4x4(
+		_lightRight.x * scaleX, _lightUp.x * scaleY, _lightForward.x * scaleZ, 0.0f,
+		_lightRight.y * scaleX, _lightUp.y * scaleY, _lightForward.y * scaleZ, 0.0f,
+		_lightRight.z * scaleX, _lightUp.z * scaleY, _lightForward.z * scaleZ, 0.0f,
+		-(box.Max.x + box.Min.x) * 0.5f * scaleX, -(box.Max.y + box.Min.y) * 0.5f * scaleY, -box.Min.z * scaleZ, 1.0f));
+}
+#pragma endregion Private Function
@@ -0,0 +1,774 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   ClusteredLighting.cpp
+///             @brief  CPU clustered light binning (froxel grid, SIMD, worker threads)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/ClusteredLighting.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "GameCore/Include/Profiler.hpp"
+#include "GameMath/Include/GMVectorUtility.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+#if defined(__AVX__)
+	using BatchVector = __m256;
+	constexpr size_t BATCH_WIDTH = 8;
+	INLINE BatchVector Load        (const float* p)                { return _mm256_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm256_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm256_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm256_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm256_mul_ps(a, b); }
+	INLINE BatchVector Max         (BatchVector a, BatchVector b)  { return _mm256_max_ps(a, b); }
+	INLINE BatchVector Sqrt        (BatchVector a)                 { return _mm256_sqrt_ps(a); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm256_and_ps(a, b); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm256_movemask_ps(a)); }
+#else
+	using BatchVector = __m128;
+	constexpr size_t BATCH_WIDTH = 4;
+	INLINE BatchVector Load        (const float* p)                { return _mm_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm_mul_ps(a, b); }
+	INLINE BatchVector Max         (BatchVector a, BatchVector b)  { return _mm_max_ps(a, b); }
+	INLINE BatchVector Sqrt        (BatchVector a)                 { return _mm_sqrt_ps(a); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm_and_ps(a, b); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm_cmple_ps(a, b); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm_movemask_ps(a)); }
+#endif
+	// the gathered arrays of a slice are padded to this lane count, so that the kernels never read out of the arrays.
+	constexpr size_t LANE_COUNT = 8;
+	static_assert(LANE_COUNT % BATCH_WIDTH == 0, "Padding must be a multiple of the simd width.");
+
+	/*-------------------------------------------------------------------
+	-    Cluster bounds splatted once per cluster
+	---------------------------------------------------------------------*/
+	struct ClusterBatch
+	{
+		BatchVector MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+		BatchVector CenterX, CenterY, CenterZ, Radius, NegativeRadius;
+	};
+
+	/*-------------------------------------------------------------------
+	-    The scalar tests (reference) and the simd kernels execute the same operations
+	-    in the same order, so both of them output the same lists.
+	---------------------------------------------------------------------*/
+	/****************************************************************************
+	*							SphereBoxKernel
+	*************************************************************************//**
+	*  @fn        BatchVector SphereBoxKernel(...)
+	*  @brief     Mask of the spheres which touch the box (squared distance from the center to the box <= radius^2)
+	*  @return    BatchVector
+	*****************************************************************************/
+	INLINE BatchVector SphereBoxKernel(const ClusterBatch& cluster, BatchVector x, BatchVector y, BatchVector z, BatchVector radius)
+	{
+		const BatchVector zero = Splat(0.0f);
+		const BatchVector dx   = Max(Max(Sub(cluster.MinX, x), Sub(x, cluster.MaxX)), zero);
+		const BatchVector dy   = Max(Max(Sub(cluster.MinY, y), Sub(y, cluster.MaxY)), zero);
+		const BatchVector dz   = Max(Max(Sub(cluster.MinZ, z), Sub(z, cluster.MaxZ)), zero);
+		return LessEqual(Add(Add(Mul(dx, dx), Mul(dy, dy)), Mul(dz, dz)), Mul(radius, radius));
+	}
+
+	INLINE bool IsSphereInBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ, float x, float y, float z, float radius)
+	{
+		const float dx = (std::max)((std::max)(minX - x, x - maxX), 0.0f);
+		const float dy = (std::max)((std::max)(minY - y, y - maxY), 0.0f);
+		const float dz = (std::max)((std::max)(minZ - z, z - maxZ), 0.0f);
+		return dx * dx + dy * dy + dz * dz <= radius * radius;
+	}
+
+	/****************************************************************************
+	*							ConeSphereKernel
+	*************************************************************************//**
+	*  @fn        BatchVector ConeSphereKernel(...)
+	*  @brief     Mask of the cones which touch the bounding sphere of the cluster.
+	*             The distance from the sphere center to the cone side must not exceed the sphere radius,
+	*             and the center must be within [-radius, range + radius] along the cone axis.
+	*  @return    BatchVector
+	*****************************************************************************/
+	INLINE BatchVector ConeSphereKernel(const ClusterBatch& cluster, BatchVector x, BatchVector y, BatchVector z,
+		BatchVector directionX, BatchVector directionY, BatchVector directionZ, BatchVector range, BatchVector cosAngle, BatchVector sinAngle)
+	{
+		const BatchVector vx       = Sub(cluster.CenterX, x);
+		const BatchVector vy       = Sub(cluster.CenterY, y);
+		const BatchVector vz       = Sub(cluster.CenterZ, z);
+		const BatchVector lengthSq = Add(Add(Mul(vx, vx), Mul(vy, vy)), Mul(vz, vz));
+		const BatchVector axis     = Add(Add(Mul(vx, directionX), Mul(vy, directionY)), Mul(vz, directionZ));
+		const BatchVector side     = Sqrt(Max(Sub(lengthSq, Mul(axis, axis)), Splat(0.0f)));
+		const BatchVector closest  = Sub(Mul(cosAngle, side), Mul(axis, sinAngle));
+		BatchVector visible = LessEqual(closest, cluster.Radius);
+		visible = And(visible, LessEqual(axis, Add(cluster.Radius, range)));
+		visible = And(visible, LessEqual(cluster.NegativeRadius, axis));
+		return visible;
+	}
+
+	INLINE bool IsConeInSphere(float centerX, float centerY, float centerZ, float sphereRadius, float x, float y, float z,
+		float directionX, float directionY, float directionZ, float range, float cosAngle, float sinAngle)
+	{
+		const float vx       = centerX - x;
+		const float vy       = centerY - y;
+		const float vz       = centerZ - z;
+		const float lengthSq = vx * vx + vy * vy + vz * vz;
+		const float axis     = vx * directionX + vy * directionY + vz * directionZ;
+		const float side     = std::sqrt((std::max)(lengthSq - axis * axis, 0.0f));
+		const float closest  = cosAngle * side - axis * sinAngle;
+		return closest <= sphereRadius && axis <= sphereRadius + range && -sphereRadius <= axis;
+	}
+
+	template<class Box>
+	INLINE ClusterBatch SplatCluster(const Box& box)
+	{
+		ClusterBatch cluster;
+		cluster.MinX    = Splat(box.MinX);    cluster.MinY    = Splat(box.MinY);    cluster.MinZ    = Splat(box.MinZ);
+		cluster.MaxX    = Splat(box.MaxX);    cluster.MaxY    = Splat(box.MaxY);    cluster.MaxZ    = Splat(box.MaxZ);
+		cluster.CenterX = Splat(box.CenterX); cluster.CenterY = Splat(box.CenterY); cluster.CenterZ = Splat(box.CenterZ);
+		cluster.Radius  = Splat(box.Radius);  cluster.NegativeRadius = Splat(-box.Radius);
+		return cluster;
+	}
+
+	INLINE std::uint32_t LaneMask(size_t i, size_t end)
+	{
+		return end - i < BATCH_WIDTH ? (1u << (end - i)) - 1u : (1u << BATCH_WIDTH) - 1u;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+ClusteredLighting::~ClusteredLighting()
+{
+	Finalize();
+}
+
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool ClusteredLighting::Initialize(JobSystem* jobSystem, std::uint32_t countX, std::uint32_t countY, std::uint32_t countZ)
+*  @brief     Set the grid size and the job system which runs the slices
+*  @param[in] JobSystem* jobSystem (nullptr : calling thread only)
+*  @param[in] std::uint32_t countX (screen tiles)
+*  @param[in] std::uint32_t countY (screen tiles)
+*  @param[in] std::uint32_t countZ (depth slices)
+*  @return @@bool
+*****************************************************************************/
+bool ClusteredLighting::Initialize(JobSystem* jobSystem, std::uint32_t countX, std::uint32_t countY, std::uint32_t countZ)
+{
+	Finalize();
+	if (countX == 0 || countY == 0 || countZ == 0) { return false; }
+
+	_countX = countX;
+	_countY = countY;
+	_countZ = countZ;
+	_slices.resize(countZ);
+	_lightRanges.assign(GetClusterCount(), ClusterLightRange());
+	_jobSystem = jobSystem;
+	return true;
+}
+
+/****************************************************************************
+*                       Finalize
+*************************************************************************//**
+*  @fn        void ClusteredLighting::Finalize()
+*  @brief     Release the lists (the job system is not owned)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::Finalize()
+{
+	_jobSystem = nullptr;
+	_slices      .clear(); _slices      .shrink_to_fit();
+	_lightRanges .clear(); _lightRanges .shrink_to_fit();
+	_lightIndices.clear(); _lightIndices.shrink_to_fit();
+	_pointLights = PointLightArray();
+	_spotLights  = SpotLightArray();
+	_countX = _countY = _countZ = 0;
+}
+
+int ClusteredLighting::GetWorkerCount() const
+{
+	return _jobSystem != nullptr ? _jobSystem->GetWorkerCount() : 0;
+}
+
+/****************************************************************************
+*                       Build
+*************************************************************************//**
+*  @fn        void ClusteredLighting::Build(const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+*  @brief     Bin the lights into the clusters. The result is in GetLightRanges and GetLightIndices.
+*  @param[in] const ClusterView& view
+*  @param[in] const PointLight* pointLights (world space)
+*  @param[in] size_t pointCount
+*  @param[in] const SpotLight* spotLights (world space)
+*  @param[in] size_t spotCount
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::Build(const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+{
+	PROFILE_FUNCTION();
+	if (_countZ == 0) { return; }
+	SetView(view);
+	PrepareLights(pointLights, pointCount, spotLights, spotCount);
+	BinLights();
+
+	/*-------------------------------------------------------------------
+	-        Few lights : calling thread only
+	---------------------------------------------------------------------*/
+	if (GetWorkerCount() == 0 || _binnedLightCount < PARALLEL_MIN_COUNT)
+	{
+		for (std::uint32_t z = 0; z < _countZ; ++z) { BuildSlice(z); }
+		ConcatenateSlices();
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-        One job per slice
+	---------------------------------------------------------------------*/
+	_jobSystem->ParallelFor(_countZ, [this](size_t z) { BuildSlice(static_cast<std::uint32_t>(z)); });
+	ConcatenateSlices();
+}
+
+/****************************************************************************
+*                       BuildReference
+*************************************************************************//**
+*  @fn        void ClusteredLighting::BuildReference(const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+*  @brief     Same output as Build with the scalar tests of every light against every cluster (no slice binning, no threads).
+*             This is slow, and is used to validate Build and the shader side.
+*  @param[in] const ClusterView& view
+*  @param[in] const PointLight* pointLights (world space)
+*  @param[in] size_t pointCount
+*  @param[in] const SpotLight* spotLights (world space)
+*  @param[in] size_t spotCount
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::BuildReference(const ClusterView& view, const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+{
+	if (_countZ == 0) { return; }
+	SetView(view);
+	PrepareLights(pointLights, pointCount, spotLights, spotCount);
+
+	_lightRanges.assign(GetClusterCount(), ClusterLightRange());
+	_lightIndices.clear();
+	for (std::uint32_t z = 0; z < _countZ; ++z)
+	{
+		for (std::uint32_t y = 0; y < _countY; ++y)
+		{
+			for (std::uint32_t x = 0; x < _countX; ++x)
+			{
+				const ClusterBox box  = GetClusterBox(x, x + 1, y, y + 1, z);
+				ClusterLightRange& range = _lightRanges[(z * _countY + y) * _countX + x];
+				range.Offset = static_cast<std::uint32_t>(_lightIndices.size());
+
+				const PointLightArray& points = _pointLights;
+				for (size_t i = 0; i < pointCount; ++i)
+				{
+					if (!IsInDepthRange(points.Z[i], points.Radius[i])) { continue; }
+					if (IsSphereInBox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ, points.X[i], points.Y[i], points.Z[i], points.Radius[i]))
+					{
+						_lightIndices.push_back(static_cast<std::uint32_t>(i));
+					}
+				}
+				range.PointCount = static_cast<std::uint32_t>(_lightIndices.size()) - range.Offset;
+
+				const SpotLightArray& spots = _spotLights;
+				for (size_t i = 0; i < spotCount; ++i)
+				{
+					if (!IsInDepthRange(spots.SphereZ[i], spots.SphereRadius[i])) { continue; }
+					if (IsConeInSphere(box.CenterX, box.CenterY, box.CenterZ, box.Radius, spots.X[i], spots.Y[i], spots.Z[i],
+						    spots.DirectionX[i], spots.DirectionY[i], spots.DirectionZ[i], spots.Range[i], spots.Cos[i], spots.Sin[i]) &&
+						IsSphereInBox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ, spots.SphereX[i], spots.SphereY[i], spots.SphereZ[i], spots.SphereRadius[i]))
+					{
+						_lightIndices.push_back(static_cast<std::uint32_t>(i));
+					}
+				}
+				range.SpotCount = static_cast<std::uint32_t>(_lightIndices.size()) - range.Offset - range.PointCount;
+			}
+		}
+	}
+}
+
+/****************************************************************************
+*                       GetClusterIndex
+*************************************************************************//**
+*  @fn        std::uint32_t ClusteredLighting::GetClusterIndex(float viewX, float viewY, float viewZ) const
+*  @brief     Cluster index ((z * CountY + y) * CountX + x) of a view space position.
+*             x is counted from the left of the screen, and y from the top.
+*  @param[in] float viewX
+*  @param[in] float viewY
+*  @param[in] float viewZ
+*  @return @@std::uint32_t (UINT32_MAX : outside of the grid)
+*****************************************************************************/
+std::uint32_t ClusteredLighting::GetClusterIndex(float viewX, float viewY, float viewZ) const
+{
+	const int z = GetSlice(viewZ);
+	if (z < 0 || z >= static_cast<int>(_countZ)) { return UINT32_MAX; }
+
+	const float ndcX = viewX / (viewZ * _view.TanHalfFovX);
+	const float ndcY = viewY / (viewZ * _view.TanHalfFovY);
+	const int   x    = static_cast<int>(std::floor((ndcX + 1.0f) * 0.5f * _countX));
+	const int   y    = static_cast<int>(std::floor((1.0f - ndcY) * 0.5f * _countY));
+	if (x < 0 || x >= static_cast<int>(_countX) || y < 0 || y >= static_cast<int>(_countY)) { return UINT32_MAX; }
+	return (static_cast<std::uint32_t>(z) * _countY + y) * _countX + x;
+}
+
+ClusteredLighting::Statistics ClusteredLighting::GetStatistics() const
+{
+	Statistics statistics;
+	statistics.PointLightCount  = _constants.PointLightCount;
+	statistics.SpotLightCount   = _constants.SpotLightCount;
+	statistics.IndexCount       = _lightIndices.size();
+
+	std::vector<std::uint8_t> isPointVisible(_constants.PointLightCount, 0);
+	std::vector<std::uint8_t> isSpotVisible (_constants.SpotLightCount,  0);
+	for (const auto& range : _lightRanges)
+	{
+		const std::uint64_t count = range.PointCount + range.SpotCount;
+		if (count != 0) { statistics.NonEmptyClusterCount++; }
+		statistics.MaxClusterLightCount = (std::max)(statistics.MaxClusterLightCount, count);
+
+		const std::uint32_t* indices = _lightIndices.data() + range.Offset;
+		for (std::uint32_t i = 0; i < range.PointCount; ++i) { isPointVisible[indices[i]] = 1; }
+		for (std::uint32_t i = 0; i < range.SpotCount;  ++i) { isSpotVisible[indices[range.PointCount + i]] = 1; }
+	}
+	for (auto isVisible : isPointVisible) { statistics.VisibleLightCount += isVisible; }
+	for (auto isVisible : isSpotVisible)  { statistics.VisibleLightCount += isVisible; }
+	return statistics;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+void ClusteredLighting::PointLightArray::Resize(size_t count)
+{
+	X.resize(count); Y.resize(count); Z.resize(count); Radius.resize(count);
+}
+
+void ClusteredLighting::SpotLightArray::Resize(size_t count)
+{
+	X.resize(count); Y.resize(count); Z.resize(count);
+	DirectionX.resize(count); DirectionY.resize(count); DirectionZ.resize(count);
+	Range.resize(count); Cos.resize(count); Sin.resize(count);
+	SphereX.resize(count); SphereY.resize(count); SphereZ.resize(count); SphereRadius.resize(count);
+}
+
+void ClusteredLighting::PointLightArray::Gather(const PointLightArray& source, const std::vector<std::uint32_t>& indices)
+{
+	Resize(gm::utils::AlignUp(indices.size(), LANE_COUNT));
+	for (size_t i = 0; i < indices.size(); ++i)
+	{
+		const std::uint32_t index = indices[i];
+		X[i]      = source.X[index];
+		Y[i]      = source.Y[index];
+		Z[i]      = source.Z[index];
+		Radius[i] = source.Radius[index];
+	}
+}
+
+void ClusteredLighting::SpotLightArray::Gather(const SpotLightArray& source, const std::vector<std::uint32_t>& indices)
+{
+	Resize(gm::utils::AlignUp(indices.size(), LANE_COUNT));
+	for (size_t i = 0; i < indices.size(); ++i)
+	{
+		const std::uint32_t index = indices[i];
+		X[i]            = source.X[index];
+		Y[i]            = source.Y[index];
+		Z[i]            = source.Z[index];
+		DirectionX[i]   = source.DirectionX[index];
+		DirectionY[i]   = source.DirectionY[index];
+		DirectionZ[i]   = source.DirectionZ[index];
+		Range[i]        = source.Range[index];
+		Cos[i]          = source.Cos[index];
+		Sin[i]          = source.Sin[index];
+		SphereX[i]      = source.SphereX[index];
+		SphereY[i]      = source.SphereY[index];
+		SphereZ[i]      = source.SphereZ[index];
+		SphereRadius[i] = source.SphereRadius[index];
+	}
+}
+
+/****************************************************************************
+*                       SetView
+*************************************************************************//**
+*  @fn        void ClusteredLighting::SetView(const ClusterView& view)
+*  @brief     Exponential depth slices : depth[z] = near * (far / near)^(z / countZ)
+*  @param[in] const ClusterView& view
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::SetView(const ClusterView& view)
+{
+	_view = view;
+	_view.NearZ = (std::max)(view.NearZ, 1e-4f);
+	_view.FarZ  = (std::max)(view.FarZ, _view.NearZ * 1.001f);
+
+	const float logRatio = std::log(_view.FarZ / _view.NearZ);
+	_constants.CountX     = _countX;
+	_constants.CountY     = _countY;
+	_constants.CountZ     = _countZ;
+	_constants.NearZ      = _view.NearZ;
+	_constants.SliceScale = static_cast<float>(_countZ) / logRatio;
+	_constants.SliceBias  = -static_cast<float>(_countZ) * std::log(_view.NearZ) / logRatio;
+
+	_sliceDepths.resize(_countZ + 1);
+	for (std::uint32_t z = 0; z <= _countZ; ++z)
+	{
+		_sliceDepths[z] = _view.NearZ * std::pow(_view.FarZ / _view.NearZ, static_cast<float>(z) / _countZ);
+	}
+	_sliceDepths[0]       = _view.NearZ;
+	_sliceDepths[_countZ] = _view.FarZ;
+
+	_sliceBoxes.resize(_countZ);
+	for (std::uint32_t z = 0; z < _countZ; ++z) { _sliceBoxes[z] = GetClusterBox(0, _countX, 0, _countY, z); }
+}
+
+/****************************************************************************
+*                       PrepareLights
+*************************************************************************//**
+*  @fn        void ClusteredLighting::PrepareLights(const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+*  @brief     Transform the lights into the view space (structure of arrays).
+*             The lights without range (and the spot lights without direction) are marked to be skipped.
+*             The cone angle is clamped to 90 degrees.
+*  @param[in] const PointLight* pointLights
+*  @param[in] size_t pointCount
+*  @param[in] const SpotLight* spotLights
+*  @param[in] size_t spotCount
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::PrepareLights(const PointLight* pointLights, size_t pointCount, const SpotLight* spotLights, size_t spotCount)
+{
+	const auto& m = _view.ViewMatrix.m;
+	_constants.PointLightCount = static_cast<std::uint32_t>(pointCount);
+	_constants.SpotLightCount  = static_cast<std::uint32_t>(spotCount);
+
+	/*-------------------------------------------------------------------
+	-        Point lights
+	---------------------------------------------------------------------*/
+	_pointLights.Resize(pointCount);
+	for (size_t i = 0; i < pointCount; ++i)
+	{
+		const PointLight& light = pointLights[i];
+		const gm::Float3& p     = light.Position;
+		_pointLights.X[i]      = p.x * m[0][0] + p.y * m[1][0] + p.z * m[2][0] + m[3][0];
+		_pointLights.Y[i]      = p.x * m[0][1] + p.y * m[1][1] + p.z * m[2][1] + m[3][1];
+		_pointLights.Z[i]      = p.x * m[0][2] + p.y * m[1][2] + p.z * m[2][2] + m[3][2];
+		_pointLights.Radius[i] = light.Range;
+	}
+
+	/*-------------------------------------------------------------------
+	-        Spot lights
+	---------------------------------------------------------------------*/
+	_spotLights.Resize(spotCount);
+	for (size_t i = 0; i < spotCount; ++i)
+	{
+		const SpotLight&  light = spotLights[i];
+		const gm::Float3& p     = light.Position;
+		const gm::Float3& d     = light.Direction;
+		const float x  = p.x * m[0][0] + p.y * m[1][0] + p.z * m[2][0] + m[3][0];
+		const float y  = p.x * m[0][1] + p.y * m[1][1] + p.z * m[2][1] + m[3][1];
+		const float z  = p.x * m[0][2] + p.y * m[1][2] + p.z * m[2][2] + m[3][2];
+		float       dx = d.x * m[0][0] + d.y * m[1][0] + d.z * m[2][0];
+		float       dy = d.x * m[0][1] + d.y * m[1][1] + d.z * m[2][1];
+		float       dz = d.x * m[0][2] + d.y * m[1][2] + d.z * m[2][2];
+		const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (length > 0.0f) { dx /= length; dy /= length; dz /= length; }
+
+		const float angle = (std::min)((std::max)(light.OuterConeAngle, 0.0f), gm::GM_PI * 0.5f);
+		const float cosAngle = std::cos(angle);
+		const float sinAngle = std::sin(angle);
+
+		/*-------------------------------------------------------------------
+		-        Bounding sphere of the cone
+		-        (wide cone : the circle of the cap, narrow cone : the circumsphere of the tip and the cap)
+		---------------------------------------------------------------------*/
+		float sphereOffset = 0.0f, sphereRadius = 0.0f;
+		if (angle > gm::GM_PI * 0.25f)
+		{
+			sphereOffset = cosAngle * light.Range;
+			sphereRadius = sinAngle * light.Range;
+		}
+		else
+		{
+			sphereOffset = light.Range / (2.0f * cosAngle);
+			sphereRadius = sphereOffset;
+		}
+		if (length <= 0.0f) { sphereRadius = 0.0f; }
+
+		_spotLights.X[i]            = x;
+		_spotLights.Y[i]            = y;
+		_spotLights.Z[i]            = z;
+		_spotLights.DirectionX[i]   = dx;
+		_spotLights.DirectionY[i]   = dy;
+		_spotLights.DirectionZ[i]   = dz;
+		_spotLights.Range[i]        = light.Range;
+		_spotLights.Cos[i]          = cosAngle;
+		_spotLights.Sin[i]          = sinAngle;
+		_spotLights.SphereX[i]      = x + dx * sphereOffset;
+		_spotLights.SphereY[i]      = y + dy * sphereOffset;
+		_spotLights.SphereZ[i]      = z + dz * sphereOffset;
+		_spotLights.SphereRadius[i] = sphereRadius;
+	}
+}
+
+/****************************************************************************
+*                       BinLights
+*************************************************************************//**
+*  @fn        void ClusteredLighting::BinLights()
+*  @brief     Add each light to the depth slices whose box its (bounding) sphere touches.
+*             The slice range from the depth has one slice of margin on both sides, and the slice box decides.
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::BinLights()
+{
+	for (auto& slice : _slices) { slice.PointLights.clear(); slice.SpotLights.clear(); }
+	_binnedLightCount = 0;
+
+	const int lastSlice = static_cast<int>(_countZ) - 1;
+	for (size_t i = 0; i < _pointLights.X.size(); ++i)
+	{
+		const float z = _pointLights.Z[i], radius = _pointLights.Radius[i];
+		if (!IsInDepthRange(z, radius)) { continue; }
+
+		const int begin = (std::max)(GetSlice(z - radius) - 1, 0);
+		const int end   = (std::min)(GetSlice(z + radius) + 1, lastSlice);
+		bool isBinned = false;
+		for (int slice = begin; slice <= end; ++slice)
+		{
+			const ClusterBox& box = _sliceBoxes[slice];
+			if (!IsSphereInBox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ, _pointLights.X[i], _pointLights.Y[i], z, radius)) { continue; }
+			_slices[slice].PointLights.push_back(static_cast<std::uint32_t>(i));
+			isBinned = true;
+		}
+		if (isBinned) { _binnedLightCount++; }
+	}
+
+	for (size_t i = 0; i < _spotLights.X.size(); ++i)
+	{
+		const float z = _spotLights.SphereZ[i], radius = _spotLights.SphereRadius[i];
+		if (!IsInDepthRange(z, radius)) { continue; }
+
+		const int begin = (std::max)(GetSlice(z - radius) - 1, 0);
+		const int end   = (std::min)(GetSlice(z + radius) + 1, lastSlice);
+		bool isBinned = false;
+		for (int slice = begin; slice <= end; ++slice)
+		{
+			const ClusterBox& box = _sliceBoxes[slice];
+			if (!IsSphereInBox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ, _spotLights.SphereX[i], _spotLights.SphereY[i], z, radius)) { continue; }
+			_slices[slice].SpotLights.push_back(static_cast<std::uint32_t>(i));
+			isBinned = true;
+		}
+		if (isBinned) { _binnedLightCount++; }
+	}
+}
+
+/****************************************************************************
+*                       BuildSlice
+*************************************************************************//**
+*  @fn        void ClusteredLighting::BuildSlice(std::uint32_t z)
+*  @brief     Gather the lights of the slice, narrow them down per tile row and test them against each cluster of the row.
+*             The offsets of the ranges are local to the slice until ConcatenateSlices.
+*  @param[in] std::uint32_t z
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::BuildSlice(std::uint32_t z)
+{
+	Slice& slice = _slices[z];
+	slice.Points.Gather(_pointLights, slice.PointLights);
+	slice.Spots .Gather(_spotLights,  slice.SpotLights);
+	slice.Ranges.resize(static_cast<size_t>(_countX) * _countY);
+	slice.Indices.clear();
+
+	for (std::uint32_t y = 0; y < _countY; ++y)
+	{
+		CullRow(slice, y, z);
+		const PointLightArray& points     = slice.RowPoints;
+		const SpotLightArray&  spots      = slice.RowSpots;
+		const size_t           pointCount = slice.RowPointLights.size();
+		const size_t           spotCount  = slice.RowSpotLights.size();
+
+		for (std::uint32_t x = 0; x < _countX; ++x)
+		{
+			const ClusterBox box = GetClusterBox(x, x + 1, y, y + 1, z);
+			const ClusterBatch cluster = SplatCluster(box);
+
+			ClusterLightRange& range = slice.Ranges[y * _countX + x];
+			range.Offset = static_cast<std::uint32_t>(slice.Indices.size());
+
+			/*-------------------------------------------------------------------
+			-        Point lights
+			---------------------------------------------------------------------*/
+			for (size_t i = 0; i < pointCount; i += BATCH_WIDTH)
+			{
+				std::uint32_t mask = MoveMask(SphereBoxKernel(cluster, Load(&points.X[i]), Load(&points.Y[i]), Load(&points.Z[i]), Load(&points.Radius[i])))
+					& LaneMask(i, pointCount);
+				for (size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+				{
+					if (mask & 1u) { slice.Indices.push_back(slice.RowPointLights[i + lane]); }
+				}
+			}
+			range.PointCount = static_cast<std::uint32_t>(slice.Indices.size()) - range.Offset;
+
+			/*-------------------------------------------------------------------
+			-        Spot lights
+			---------------------------------------------------------------------*/
+			for (size_t i = 0; i < spotCount; i += BATCH_WIDTH)
+			{
+				const BatchVector cone = ConeSphereKernel(cluster, Load(&spots.X[i]), Load(&spots.Y[i]), Load(&spots.Z[i]),
+					Load(&spots.DirectionX[i]), Load(&spots.DirectionY[i]), Load(&spots.DirectionZ[i]), Load(&spots.Range[i]), Load(&spots.Cos[i]), Load(&spots.Sin[i]));
+				const BatchVector sphere = SphereBoxKernel(cluster, Load(&spots.SphereX[i]), Load(&spots.SphereY[i]), Load(&spots.SphereZ[i]), Load(&spots.SphereRadius[i]));
+				std::uint32_t mask = MoveMask(And(cone, sphere)) & LaneMask(i, spotCount);
+				for (size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+				{
+					if (mask & 1u) { slice.Indices.push_back(slice.RowSpotLights[i + lane]); }
+				}
+			}
+			range.SpotCount = static_cast<std::uint32_t>(slice.Indices.size()) - range.Offset - range.PointCount;
+		}
+	}
+}
+
+/****************************************************************************
+*                       CullRow
+*************************************************************************//**
+*  @fn        void ClusteredLighting::CullRow(Slice& slice, std::uint32_t y, std::uint32_t z)
+*  @brief     Gather the lights of the slice whose (bounding) sphere touches the box of the whole tile row.
+*             The row box contains every cluster box of the row, so no light the cluster tests accept is dropped.
+*  @param[in] Slice& slice
+*  @param[in] std::uint32_t y
+*  @param[in] std::uint32_t z
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::CullRow(Slice& slice, std::uint32_t y, std::uint32_t z)
+{
+	const ClusterBatch row = SplatCluster(GetClusterBox(0, _countX, y, y + 1, z));
+
+	/*-------------------------------------------------------------------
+	-        Point lights
+	---------------------------------------------------------------------*/
+	const PointLightArray& points     = slice.Points;
+	const size_t           pointCount = slice.PointLights.size();
+	slice.RowPointLights.clear();
+	for (size_t i = 0; i < pointCount; i += BATCH_WIDTH)
+	{
+		std::uint32_t mask = MoveMask(SphereBoxKernel(row, Load(&points.X[i]), Load(&points.Y[i]), Load(&points.Z[i]), Load(&points.Radius[i])))
+			& LaneMask(i, pointCount);
+		for (size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+		{
+			if (mask & 1u) { slice.RowPointLights.push_back(static_cast<std::uint32_t>(i + lane)); }
+		}
+	}
+	slice.RowPoints.Gather(points, slice.RowPointLights);
+	for (auto& index : slice.RowPointLights) { index = slice.PointLights[index]; }
+
+	/*-------------------------------------------------------------------
+	-        Spot lights
+	---------------------------------------------------------------------*/
+	const SpotLightArray& spots     = slice.Spots;
+	const size_t          spotCount = slice.SpotLights.size();
+	slice.RowSpotLights.clear();
+	for (size_t i = 0; i < spotCount; i += BATCH_WIDTH)
+	{
+		std::uint32_t mask = MoveMask(SphereBoxKernel(row, Load(&spots.SphereX[i]), Load(&spots.SphereY[i]), Load(&spots.SphereZ[i]), Load(&spots.SphereRadius[i])))
+			& LaneMask(i, spotCount);
+		for (size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+		{
+			if (mask & 1u) { slice.RowSpotLights.push_back(static_cast<std::uint32_t>(i + lane)); }
+		}
+	}
+	slice.RowSpots.Gather(spots, slice.RowSpotLights);
+	for (auto& index : slice.RowSpotLights) { index = slice.SpotLights[index]; }
+}
+
+/****************************************************************************
+*                       ConcatenateSlices
+*************************************************************************//**
+*  @fn        void ClusteredLighting::ConcatenateSlices()
+*  @brief     Join the slice lists in the slice order and rebase the offsets
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void ClusteredLighting::ConcatenateSlices()
+{
+	size_t total = 0;
+	for (const auto& slice : _slices) { total += slice.Indices.size(); }
+	_lightIndices.resize(total);
+	_lightRanges .resize(GetClusterCount());
+
+	const size_t sliceClusterCount = static_cast<size_t>(_countX) * _countY;
+	std::uint32_t offset = 0;
+	for (std::uint32_t z = 0; z < _countZ; ++z)
+	{
+		const Slice& slice = _slices[z];
+		ClusterLightRange* ranges = &_lightRanges[z * sliceClusterCount];
+		for (size_t i = 0; i < sliceClusterCount; ++i)
+		{
+			ranges[i]         = slice.Ranges[i];
+			ranges[i].Offset += offset;
+		}
+		if (!slice.Indices.empty())
+		{
+			std::memcpy(_lightIndices.data() + offset, slice.Indices.data(), slice.Indices.size() * sizeof(std::uint32_t));
+		}
+		offset += static_cast<std::uint32_t>(slice.Indices.size());
+	}
+}
+
+/****************************************************************************
+*                       GetClusterBox
+*************************************************************************//**
+*  @fn        ClusteredLighting::ClusterBox ClusteredLighting::GetClusterBox(std::uint32_t beginX, std::uint32_t endX, std::uint32_t beginY, std::uint32_t endY, std::uint32_t z) const
+*  @brief     View space bounding box (and its bounding sphere) of the froxels [beginX, endX) x [beginY, endY) in the slice z.
+*             The tile edges are linear in the view depth, so the box is spanned by the corners at the near and far depth.
+*             A box of more tiles contains the boxes of its tiles (also in the floating point), so it can cull for them.
+*  @param[in] std::uint32_t beginX
+*  @param[in] std::uint32_t endX
+*  @param[in] std::uint32_t beginY
+*  @param[in] std::uint32_t endY
+*  @param[in] std::uint32_t z
+*  @return @@ClusterBox
+*****************************************************************************/
+ClusteredLighting::ClusterBox ClusteredLighting::GetClusterBox(std::uint32_t beginX, std::uint32_t endX, std::uint32_t beginY, std::uint32_t endY, std::uint32_t z) const
+{
+	const float nearZ  = _sliceDepths[z];
+	const float farZ   = _sliceDepths[z + 1];
+	const float left   = (-1.0f + 2.0f * beginX / _countX) * _view.TanHalfFovX;
+	const float right  = (-1.0f + 2.0f * endX   / _countX) * _view.TanHalfFovX;
+	const float top    = ( 1.0f - 2.0f * beginY / _countY) * _view.TanHalfFovY;
+	const float bottom = ( 1.0f - 2.0f * endY   / _countY) * _view.TanHalfFovY;
+
+	ClusterBox box;
+	box.MinX = (std::min)(left   * nearZ, left   * farZ);
+	box.MaxX = (std::max)(right  * nearZ, right  * farZ);
+	box.MinY = (std::min)(bottom * nearZ, bottom * farZ);
+	box.MaxY = (std::max)(top    * nearZ, top    * farZ);
+	box.MinZ = nearZ;
+	box.MaxZ = farZ;
+
+	const float extentX = (box.MaxX - box.MinX) * 0.5f;
+	const float extentY = (box.MaxY - box.MinY) * 0.5f;
+	const float extentZ = (box.MaxZ - box.MinZ) * 0.5f;
+	box.CenterX = (box.MinX + box.MaxX) * 0.5f;
+	box.CenterY = (box.MinY + box.MaxY) * 0.5f;
+	box.CenterZ = (box.MinZ + box.MaxZ) * 0.5f;
+	box.Radius  = std::sqrt(extentX * extentX + extentY * extentY + extentZ * extentZ);
+	return box;
+}
+
+int ClusteredLighting::GetSlice(float viewZ) const
+{
+	if (viewZ < _view.NearZ) { return -1; }
+	if (viewZ >= _view.FarZ) { return static_cast<int>(_countZ); }
+	const int slice = static_cast<int>(std::floor(std::log(viewZ) * _constants.SliceScale + _constants.SliceBias));
+	return (std::min)((std::max)(slice, 0), static_cast<int>(_countZ) - 1);
+}
+#pragma endregion Private Function
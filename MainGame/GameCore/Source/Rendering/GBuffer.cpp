@@ -315,7 +315,7 @@ bool GBuffer::DrawPMXActor(int index)
 	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 	commandList->IASetIndexBuffer(&indexBufferView);
 	commandList->SetGraphicsRootConstantBufferView(0, actor->GetModelWorldInfo()->Resource()->GetGPUVirtualAddress());
-	commandList->SetGraphicsRootConstantBufferView(4, actor->GetBoneBuffer()->Resource()->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(4, actor->GetBoneAddress());
 
 	/*-------------------------------------------------------------------
 	-               Drawing process for each material
@@ -16,6 +16,7 @@
 #include "GameMath/Include/GMColor.hpp"
 #include "GameMath/Include/GMDistribution.hpp"
 #include <d3dcompiler.h>
+#include <vector>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -377,16 +378,18 @@ bool SSAO::PrepareRandomTexture()
 	-			 Prepare texture data (set random value)
 	---------------------------------------------------------------------*/
 	RGBA* color = new RGBA[256 * 256];
-	RandomInt random;
-	random.SetRange(0, 255);
+	std::vector<int> randomValues(256 * 256 * 3);
+	RandomInt random(0, 255);
+	random.Fill(randomValues.data(), randomValues.size());
 	for (int i = 0; i < 256; ++i)
 	{
 		for (int j = 0; j < 256; ++j)
 		{
-			color[i * 256 + j].r = random.GetRandomValue();
-			color[i * 256 + j].g = random.GetRandomValue();
-			color[i * 256 + j].b = random.GetRandomValue();
-			color[i * 256 + j].a = 0;
+			const int index = i * 256 + j;
+			color[index].r = randomValues[index * 3 + 0];
+			color[index].g = randomValues[index * 3 + 1];
+			color[index].b = randomValues[index * 3 + 2];
+			color[index].a = 0;
 		}
 	}
 	
@@ -0,0 +1,387 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VisibilityCulling.cpp
+///             @brief  CPU frustum culling (SoA bounds, SIMD, worker threads)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "GameCore/Include/Profiler.hpp"
+#include "GameMath/Include/GMVectorUtility.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+#if defined(__AVX__)
+	using BatchVector = __m256;
+	constexpr size_t BATCH_WIDTH = 8;
+	INLINE BatchVector Load        (const float* p)                { return _mm256_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm256_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm256_add_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm256_mul_ps(a, b); }
+	INLINE BatchVector Min         (BatchVector a, BatchVector b)  { return _mm256_min_ps(a, b); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm256_and_ps(a, b); }
+	INLINE BatchVector GreaterEqual(BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	INLINE BatchVector AllOne      ()                              { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm256_movemask_ps(a)); }
+#else
+	using BatchVector = __m128;
+	constexpr size_t BATCH_WIDTH = 4;
+	INLINE BatchVector Load        (const float* p)                { return _mm_loadu_ps(p); }
+	INLINE BatchVector Splat       (float value)                   { return _mm_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm_add_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm_mul_ps(a, b); }
+	INLINE BatchVector Min         (BatchVector a, BatchVector b)  { return _mm_min_ps(a, b); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm_and_ps(a, b); }
+	INLINE BatchVector GreaterEqual(BatchVector a, BatchVector b)  { return _mm_cmpge_ps(a, b); }
+	INLINE BatchVector AllOne      ()                              { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm_movemask_ps(a)); }
+#endif
+	static_assert(VISIBILITY_LANE_COUNT % BATCH_WIDTH == 0, "Padding must be a multiple of the simd width.");
+	static_assert(VisibilityCulling::CHUNK_SIZE % VISIBILITY_LANE_COUNT == 0, "Chunk must be a multiple of the lane count.");
+
+	/*-------------------------------------------------------------------
+	-    Plane coefficients splatted once per view
+	---------------------------------------------------------------------*/
+	struct PlaneBatch
+	{
+		BatchVector NormalX, NormalY, NormalZ, Distance;
+		BatchVector AbsNormalX, AbsNormalY, AbsNormalZ;
+	};
+
+	void SetPlaneBatch(const FrustumPlanes& frustum, PlaneBatch* outPlanes)
+	{
+		for (int i = 0; i < FrustumPlanes::PLANE_COUNT; ++i)
+		{
+			const gm::Float4& plane = frustum.Planes[i];
+			outPlanes[i].NormalX    = Splat(plane.x);
+			outPlanes[i].NormalY    = Splat(plane.y);
+			outPlanes[i].NormalZ    = Splat(plane.z);
+			outPlanes[i].Distance   = Splat(plane.w);
+			outPlanes[i].AbsNormalX = Splat(std::fabs(plane.x));
+			outPlanes[i].AbsNormalY = Splat(std::fabs(plane.y));
+			outPlanes[i].AbsNormalZ = Splat(std::fabs(plane.z));
+		}
+	}
+
+	/****************************************************************************
+	*							FrustumKernel
+	*************************************************************************//**
+	*  @fn        BatchVector FrustumKernel(...)
+	*  @brief     Visible mask of the bounds. For each plane the signed distance of the center must not be
+	*             less than -min(radius, projected box extent), which is the sphere test and the box test at once.
+	*  @return    BatchVector (visible mask)
+	*****************************************************************************/
+	INLINE BatchVector FrustumKernel(const PlaneBatch* planes, BatchVector centerX, BatchVector centerY, BatchVector centerZ,
+		BatchVector radius, BatchVector extentX, BatchVector extentY, BatchVector extentZ)
+	{
+		const BatchVector zero = Splat(0.0f);
+		BatchVector visible    = AllOne();
+		for (int i = 0; i < FrustumPlanes::PLANE_COUNT; ++i)
+		{
+			const PlaneBatch& plane  = planes[i];
+			const BatchVector distance = Add(Add(Mul(plane.NormalX, centerX), Mul(plane.NormalY, centerY)), Add(Mul(plane.NormalZ, centerZ), plane.Distance));
+			const BatchVector extent   = Add(Add(Mul(plane.AbsNormalX, extentX), Mul(plane.AbsNormalY, extentY)), Mul(plane.AbsNormalZ, extentZ));
+			visible = And(visible, GreaterEqual(Add(distance, Min(radius, extent)), zero));
+		}
+		return visible;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region VisibilityBox
+void VisibilityBox::Merge(const gm::Float3& position)
+{
+	Min = gm::Float3((std::min)(Min.x, position.x), (std::min)(Min.y, position.y), (std::min)(Min.z, position.z));
+	Max = gm::Float3((std::max)(Max.x, position.x), (std::max)(Max.y, position.y), (std::max)(Max.z, position.z));
+}
+
+void VisibilityBox::Merge(const VisibilityBox& box)
+{
+	if (box.IsEmpty()) { return; }
+	Merge(box.Min);
+	Merge(box.Max);
+}
+
+void VisibilityBox::Expand(float margin)
+{
+	if (IsEmpty()) { return; }
+	Min = gm::Float3(Min.x - margin, Min.y - margin, Min.z - margin);
+	Max = gm::Float3(Max.x + margin, Max.y + margin, Max.z + margin);
+}
+
+/****************************************************************************
+*                       Transform
+*************************************************************************//**
+*  @fn        VisibilityBox VisibilityBox::Transform(const gm::Float4x4& matrix) const
+*  @brief     The center is transformed, and the extent is projected with the absolute value of the matrix
+*  @param[in] const gm::Float4x4& matrix (p' = p * matrix)
+*  @return @@VisibilityBox
+*****************************************************************************/
+VisibilityBox VisibilityBox::Transform(const gm::Float4x4& matrix) const
+{
+	if (IsEmpty()) { return *this; }
+
+	const auto& m = matrix.m;
+	const float center[3] = { (Min.x + Max.x) * 0.5f, (Min.y + Max.y) * 0.5f, (Min.z + Max.z) * 0.5f };
+	const float extent[3] = { (Max.x - Min.x) * 0.5f, (Max.y - Min.y) * 0.5f, (Max.z - Min.z) * 0.5f };
+
+	float resultCenter[3], resultExtent[3];
+	for (int j = 0; j < 3; ++j)
+	{
+		resultCenter[j] = center[0] * m[0][j] + center[1] * m[1][j] + center[2] * m[2][j] + m[3][j];
+		resultExtent[j] = extent[0] * std::fabs(m[0][j]) + extent[1] * std::fabs(m[1][j]) + extent[2] * std::fabs(m[2][j]);
+	}
+
+	VisibilityBox result;
+	result.Min = gm::Float3(resultCenter[0] - resultExtent[0], resultCenter[1] - resultExtent[1], resultCenter[2] - resultExtent[2]);
+	result.Max = gm::Float3(resultCenter[0] + resultExtent[0], resultCenter[1] + resultExtent[1], resultCenter[2] + resultExtent[2]);
+	return result;
+}
+#pragma endregion VisibilityBox
+
+#pragma region VisibilityBoundsArray
+void VisibilityBoundsArray::Add(const gm::Float3& center, const gm::Float3& extent)
+{
+	Add(center, extent, std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z));
+}
+
+void VisibilityBoundsArray::Add(const gm::Float3& center, const gm::Float3& extent, float radius)
+{
+	if (_count == CenterX.size())
+	{
+		const size_t size = _count + VISIBILITY_LANE_COUNT;
+		CenterX.resize(size); CenterY.resize(size); CenterZ.resize(size); Radius.resize(size);
+		ExtentX.resize(size); ExtentY.resize(size); ExtentZ.resize(size);
+	}
+	CenterX[_count] = center.x;
+	CenterY[_count] = center.y;
+	CenterZ[_count] = center.z;
+	Radius [_count] = radius;
+	ExtentX[_count] = extent.x;
+	ExtentY[_count] = extent.y;
+	ExtentZ[_count] = extent.z;
+	_count++;
+}
+
+void VisibilityBoundsArray::AddMinMax(const gm::Float3& minPosition, const gm::Float3& maxPosition)
+{
+	Add(gm::Float3((minPosition.x + maxPosition.x) * 0.5f, (minPosition.y + maxPosition.y) * 0.5f, (minPosition.z + maxPosition.z) * 0.5f),
+		gm::Float3((maxPosition.x - minPosition.x) * 0.5f, (maxPosition.y - minPosition.y) * 0.5f, (maxPosition.z - minPosition.z) * 0.5f));
+}
+
+void VisibilityBoundsArray::AddSphere(const gm::Float3& center, float radius)
+{
+	Add(center, gm::Float3(radius, radius, radius), radius);
+}
+
+void VisibilityBoundsArray::Clear()
+{
+	CenterX.clear(); CenterY.clear(); CenterZ.clear(); Radius.clear();
+	ExtentX.clear(); ExtentY.clear(); ExtentZ.clear();
+	_count = 0;
+}
+
+void VisibilityBoundsArray::Reserve(size_t count)
+{
+	count = gm::utils::AlignUp(count, VISIBILITY_LANE_COUNT);
+	CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count); Radius.reserve(count);
+	ExtentX.reserve(count); ExtentY.reserve(count); ExtentZ.reserve(count);
+}
+#pragma endregion VisibilityBoundsArray
+
+#pragma region VisibilityCulling
+VisibilityCulling::~VisibilityCulling()
+{
+	Finalize();
+}
+
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool VisibilityCulling::Initialize(JobSystem* jobSystem)
+*  @brief     Set the job system which runs the chunks
+*  @param[in] JobSystem* jobSystem (nullptr : calling thread only)
+*  @return @@bool
+*****************************************************************************/
+bool VisibilityCulling::Initialize(JobSystem* jobSystem)
+{
+	Finalize();
+	_jobSystem = jobSystem;
+	return true;
+}
+
+/****************************************************************************
+*                       Finalize
+*************************************************************************//**
+*  @fn        void VisibilityCulling::Finalize()
+*  @brief     Release the lists (the job system is not owned)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void VisibilityCulling::Finalize()
+{
+	_jobSystem = nullptr;
+	_views       .clear(); _views       .shrink_to_fit();
+	_visibleLists.clear(); _visibleLists.shrink_to_fit();
+	_chunkLists  .clear(); _chunkLists  .shrink_to_fit();
+}
+
+int VisibilityCulling::GetWorkerCount() const
+{
+	return _jobSystem != nullptr ? _jobSystem->GetWorkerCount() : 0;
+}
+
+int VisibilityCulling::AddView(const FrustumPlanes& frustum)
+{
+	_views.push_back(frustum);
+	if (_visibleLists.size() < _views.size()) { _visibleLists.resize(_views.size()); }
+	_visibleLists[_views.size() - 1].clear();
+	return static_cast<int>(_views.size() - 1);
+}
+
+void VisibilityCulling::ClearViews()
+{
+	_views.clear(); // the lists are kept to reuse their capacity
+}
+
+/****************************************************************************
+*                       Execute
+*************************************************************************//**
+*  @fn        void VisibilityCulling::Execute(const VisibilityBoundsArray& bounds)
+*  @brief     Cull the bounds against every view. The result is in GetVisibleList(view).
+*  @param[in] const VisibilityBoundsArray& bounds
+*  @return @@void
+*****************************************************************************/
+void VisibilityCulling::Execute(const VisibilityBoundsArray& bounds)
+{
+	PROFILE_FUNCTION();
+	const size_t viewCount = _views.size();
+	if (viewCount == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-        Small array : calling thread only
+	---------------------------------------------------------------------*/
+	if (GetWorkerCount() == 0 || bounds.Size() < PARALLEL_MIN_COUNT)
+	{
+		for (size_t i = 0; i < viewCount; ++i) { _visibleLists[i].clear(); }
+		_bounds = &bounds;
+		CullRange(0, bounds.Size(), _visibleLists.data());
+		_bounds = nullptr;
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-        One job per chunk
+	---------------------------------------------------------------------*/
+	const size_t chunkCount = (bounds.Size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	if (_chunkLists.size() < chunkCount * viewCount) { _chunkLists.resize(chunkCount * viewCount); }
+	_bounds = &bounds;
+	_jobSystem->ParallelFor(chunkCount, [this](size_t chunk) { CullChunk(chunk); });
+	_bounds = nullptr;
+
+	/*-------------------------------------------------------------------
+	-        Concatenate the chunk results (ascending index order)
+	---------------------------------------------------------------------*/
+	for (size_t view = 0; view < viewCount; ++view)
+	{
+		size_t total = 0;
+		for (size_t chunk = 0; chunk < chunkCount; ++chunk) { total += _chunkLists[chunk * viewCount + view].size(); }
+
+		std::vector<std::uint32_t>& visibleList = _visibleLists[view];
+		visibleList.resize(total);
+		size_t offset = 0;
+		for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			const std::vector<std::uint32_t>& chunkList = _chunkLists[chunk * viewCount + view];
+			if (chunkList.empty()) { continue; }
+			std::memcpy(visibleList.data() + offset, chunkList.data(), chunkList.size() * sizeof(std::uint32_t));
+			offset += chunkList.size();
+		}
+	}
+}
+#pragma endregion VisibilityCulling
+
+#pragma region Private Function
+/****************************************************************************
+*                       CullChunk
+*************************************************************************//**
+*  @fn        void VisibilityCulling::CullChunk(size_t chunk)
+*  @brief     Cull one chunk into its own lists (one job of Execute)
+*  @param[in] size_t chunk
+*  @return @@void
+*****************************************************************************/
+void VisibilityCulling::CullChunk(size_t chunk)
+{
+	const size_t viewCount = _views.size();
+	const size_t begin     = chunk * CHUNK_SIZE;
+	const size_t end       = (std::min)(begin + CHUNK_SIZE, _bounds->Size());
+	std::vector<std::uint32_t>* outLists = &_chunkLists[chunk * viewCount];
+	for (size_t view = 0; view < viewCount; ++view) { outLists[view].clear(); }
+	CullRange(begin, end, outLists);
+}
+
+/****************************************************************************
+*                       CullRange
+*************************************************************************//**
+*  @fn        void VisibilityCulling::CullRange(size_t begin, size_t end, std::vector<std::uint32_t>* outLists) const
+*  @brief     Cull [begin, end) of the bounds and append the visible indices to outLists[view].
+*             The bounds of a simd block are loaded once and tested against every view.
+*  @param[in] size_t begin (multiple of VISIBILITY_LANE_COUNT)
+*  @param[in] size_t end
+*  @param[out]std::vector<std::uint32_t>* outLists (view count)
+*  @return @@void
+*****************************************************************************/
+void VisibilityCulling::CullRange(size_t begin, size_t end, std::vector<std::uint32_t>* outLists) const
+{
+	const size_t viewCount = _views.size();
+	std::vector<PlaneBatch> planes(viewCount * FrustumPlanes::PLANE_COUNT);
+	for (size_t view = 0; view < viewCount; ++view)
+	{
+		SetPlaneBatch(_views[view], &planes[view * FrustumPlanes::PLANE_COUNT]);
+		outLists[view].reserve(outLists[view].size() + (end - begin));
+	}
+
+	const VisibilityBoundsArray& bounds = *_bounds;
+	for (size_t i = begin; i < end; i += BATCH_WIDTH)
+	{
+		const BatchVector centerX = Load(&bounds.CenterX[i]);
+		const BatchVector centerY = Load(&bounds.CenterY[i]);
+		const BatchVector centerZ = Load(&bounds.CenterZ[i]);
+		const BatchVector radius  = Load(&bounds.Radius [i]);
+		const BatchVector extentX = Load(&bounds.ExtentX[i]);
+		const BatchVector extentY = Load(&bounds.ExtentY[i]);
+		const BatchVector extentZ = Load(&bounds.ExtentZ[i]);
+
+		/*-------------------------------------------------------------------
+		-        Clear the padding lanes
+		---------------------------------------------------------------------*/
+		const std::uint32_t laneMask = end - i < BATCH_WIDTH ? (1u << (end - i)) - 1u : (1u << BATCH_WIDTH) - 1u;
+
+		for (size_t view = 0; view < viewCount; ++view)
+		{
+			std::uint32_t mask = MoveMask(FrustumKernel(&planes[view * FrustumPlanes::PLANE_COUNT],
+				centerX, centerY, centerZ, radius, extentX, extentY, extentZ)) & laneMask;
+			if (mask == 0) { continue; }
+
+			std::vector<std::uint32_t>& outList = outLists[view];
+			for (size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+			{
+				if (mask & 1u) { outList.push_back(static_cast<std::uint32_t>(i + lane)); }
+			}
+		}
+	}
+}
+#pragma endregion Private Function
@@ -329,7 +329,7 @@ bool ZPrepass::DrawPMXActor(int index)
 	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 	commandList->IASetIndexBuffer(&indexBufferView);
 	commandList->SetGraphicsRootConstantBufferView(0,actor->GetModelWorldInfo()->Resource()->GetGPUVirtualAddress());
-	commandList->SetGraphicsRootConstantBufferView(3, actor->GetBoneBuffer()->Resource()->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(3, actor->GetBoneAddress());
 	commandList->DrawIndexedInstanced((UINT)actor->GetPMXData()->GetIndexCount(), 1, 0, 0, 0);
 	
 
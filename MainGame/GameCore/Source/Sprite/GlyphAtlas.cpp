@@ -0,0 +1,221 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GlyphAtlas.cpp
+///             @brief  Dynamic glyph atlas (shelf packing, GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Sprite/GlyphAtlas.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr int           GLYPH_PADDING = 1;           // empty pixels between the cells (no bleeding by the bilinear filter)
+	constexpr std::uint32_t CLEAR_PIXEL   = 0x00FFFFFFu; // white, alpha 0
+
+	std::uint64_t GlyphKey(std::uint32_t fontID, std::uint32_t codePoint)
+	{
+		return (static_cast<std::uint64_t>(fontID) << 32) | codePoint;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       Initialize
+*************************************************************************//**
+*  @fn        bool GlyphAtlas::Initialize(int width, int height, int maxHeight)
+*  @brief     Allocate the atlas image
+*  @param[in] int width
+*  @param[in] int height (initial)
+*  @param[in] int maxHeight
+*  @return @@bool
+*****************************************************************************/
+bool GlyphAtlas::Initialize(int width, int height, int maxHeight)
+{
+	if (width <= 0 || height <= 0 || width > UINT16_MAX || maxHeight > UINT16_MAX) { return false; }
+
+	_width     = width;
+	_height    = height;
+	_maxHeight = (std::max)(height, maxHeight);
+	_pixels.assign(static_cast<size_t>(_width) * _height, CLEAR_PIXEL);
+	Reset();
+	return true;
+}
+
+void GlyphAtlas::Finalize()
+{
+	_glyphs.Clear();
+	_shelves.clear(); _shelves.shrink_to_fit();
+	_pixels.clear();  _pixels.shrink_to_fit();
+	_width = _height = _maxHeight = 0;
+	_shelfBottom = _dirtyRowBegin = _dirtyRowEnd = 0;
+}
+
+/****************************************************************************
+*                       Reset
+*************************************************************************//**
+*  @fn        void GlyphAtlas::Reset()
+*  @brief     Remove all glyphs (the uv of the cached glyphs become invalid)
+*  @param[in] void
+*  @return @@void
+*****************************************************************************/
+void GlyphAtlas::Reset()
+{
+	_glyphs.Clear();
+	_shelves.clear();
+	std::fill(_pixels.begin(), _pixels.end(), CLEAR_PIXEL);
+	_shelfBottom = 0;
+	MarkDirty(0, _height);
+	++_generation;
+}
+
+const GlyphRect* GlyphAtlas::Find(std::uint32_t fontID, std::uint32_t codePoint) const
+{
+	return _glyphs.Find(GlyphKey(fontID, codePoint));
+}
+
+/****************************************************************************
+*                       Insert
+*************************************************************************//**
+*  @fn        const GlyphRect* GlyphAtlas::Insert(std::uint32_t fontID, std::uint32_t codePoint, int cellWidth, int cellHeight, const GlyphCoverage& coverage)
+*  @brief     Pack the cell and draw the glyph (returns the existing cell if it is already inserted)
+*  @param[in] std::uint32_t fontID
+*  @param[in] std::uint32_t codePoint
+*  @param[in] int cellWidth
+*  @param[in] int cellHeight
+*  @param[in] const GlyphCoverage& coverage
+*  @return @@const GlyphRect* (nullptr : the cell is larger than the atlas)
+*****************************************************************************/
+const GlyphRect* GlyphAtlas::Insert(std::uint32_t fontID, std::uint32_t codePoint, int cellWidth, int cellHeight, const GlyphCoverage& coverage)
+{
+	if (const GlyphRect* found = Find(fontID, codePoint)) { return found; }
+	if (cellWidth <= 0 || cellHeight <= 0) { return nullptr; }
+	if (cellWidth + GLYPH_PADDING > _width || cellHeight + GLYPH_PADDING > _maxHeight) { return nullptr; }
+
+	/*-------------------------------------------------------------------
+	-        Find the place (grow -> clear when the atlas is full)
+	---------------------------------------------------------------------*/
+	int x = 0, y = 0;
+	while (!Allocate(cellWidth + GLYPH_PADDING, cellHeight + GLYPH_PADDING, x, y))
+	{
+		if (_height < _maxHeight)
+		{
+			_height = (std::min)(_height * 2, _maxHeight);
+			_pixels.resize(static_cast<size_t>(_width) * _height, CLEAR_PIXEL); // rows are kept
+			MarkDirty(0, _height);
+			++_generation; // v of all glyphs changed
+		}
+		else if (!_glyphs.IsEmpty())
+		{
+			Reset();
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-                Draw and register
+	---------------------------------------------------------------------*/
+	DrawCoverage(x, y, cellWidth, cellHeight, coverage);
+
+	GlyphRect rect;
+	rect.X      = static_cast<std::uint16_t>(x);
+	rect.Y      = static_cast<std::uint16_t>(y);
+	rect.Width  = static_cast<std::uint16_t>(cellWidth);
+	rect.Height = static_cast<std::uint16_t>(cellHeight);
+	return _glyphs.TryEmplace(GlyphKey(fontID, codePoint), rect).first;
+}
+
+void GlyphAtlas::ClearDirtyRows()
+{
+	_dirtyRowBegin = _dirtyRowEnd = 0;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        bool GlyphAtlas::Allocate(int width, int height, int& outX, int& outY)
+*  @brief     Best fit shelf. The shelf whose height wastes the least is used,
+*             and a new shelf is opened when no shelf is close to the requested height.
+*  @param[in] int width
+*  @param[in] int height
+*  @param[out]int& outX
+*  @param[out]int& outY
+*  @return @@bool
+*****************************************************************************/
+bool GlyphAtlas::Allocate(int width, int height, int& outX, int& outY)
+{
+	Shelf* best = nullptr;
+	for (Shelf& shelf : _shelves)
+	{
+		if (shelf.Height < height || shelf.UsedWidth + width > _width) { continue; }
+		if (shelf.Height * 4 > height * 5)                              { continue; } // waste more than 25%
+		if (best == nullptr || shelf.Height < best->Height) { best = &shelf; }
+	}
+
+	if (best == nullptr)
+	{
+		if (_shelfBottom + height > _height) { return false; }
+		_shelves.push_back(Shelf{ _shelfBottom, height, 0 });
+		_shelfBottom += height;
+		best = &_shelves.back();
+	}
+
+	outX = best->UsedWidth;
+	outY = best->Y;
+	best->UsedWidth += width;
+	return true;
+}
+
+/****************************************************************************
+*                       DrawCoverage
+*************************************************************************//**
+*  @fn        void GlyphAtlas::DrawCoverage(int x, int y, int cellWidth, int cellHeight, const GlyphCoverage& coverage)
+*  @brief     Write the coverage into the alpha of the cell (clipped by the cell)
+*  @param[in] int x, int y
+*  @param[in] int cellWidth, int cellHeight
+*  @param[in] const GlyphCoverage& coverage
+*  @return @@void
+*****************************************************************************/
+void GlyphAtlas::DrawCoverage(int x, int y, int cellWidth, int cellHeight, const GlyphCoverage& coverage)
+{
+	MarkDirty(y, y + cellHeight);
+	if (coverage.Pixels == nullptr || coverage.MaxValue <= 0) { return; }
+
+	const int beginX = (std::max)(0, -coverage.OffsetX);
+	const int beginY = (std::max)(0, -coverage.OffsetY);
+	const int endX   = (std::min)(coverage.Width , cellWidth  - coverage.OffsetX);
+	const int endY   = (std::min)(coverage.Height, cellHeight - coverage.OffsetY);
+
+	for (int row = beginY; row < endY; ++row)
+	{
+		const std::uint8_t* source      = coverage.Pixels + static_cast<size_t>(row) * coverage.Pitch;
+		std::uint32_t*      destination = _pixels.data() + static_cast<size_t>(y + coverage.OffsetY + row) * _width + x + coverage.OffsetX;
+		for (int column = beginX; column < endX; ++column)
+		{
+			const int alpha = (std::min)(255, source[column] * 255 / coverage.MaxValue);
+			destination[column] = CLEAR_PIXEL | (static_cast<std::uint32_t>(alpha) << 24);
+		}
+	}
+}
+
+void GlyphAtlas::MarkDirty(int rowBegin, int rowEnd)
+{
+	if (!HasDirtyRows()) { _dirtyRowBegin = rowBegin; _dirtyRowEnd = rowEnd; return; }
+	_dirtyRowBegin = (std::min)(_dirtyRowBegin, rowBegin);
+	_dirtyRowEnd   = (std::max)(_dirtyRowEnd  , rowEnd);
+}
+#pragma endregion Private Function
@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SpriteBatcher.cpp
+///             @brief  Sprite draw command sort / merge and vertex staging
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Sprite/SpriteBatcher.hpp"
+#include "GameMath/Include/GMSimdConfig.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#if defined(GM_SIMD_USE_SSE2)
+#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr size_t SPRITE_BATCHER_MIN_CAPACITY = 1024;
+	constexpr size_t SPRITE_BYTE_SIZE            = sizeof(VertexPositionNormalColorTexture) * SPRITE_VERTEX_COUNT;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+void SpriteBatcher::Begin(SpriteSortMode sortMode, Vertex* directDestination)
+{
+	_sortMode    = sortMode;
+	_direct      = sortMode == SpriteSortMode::Deferred ? directDestination : nullptr;
+	_spriteCount = 0;
+	_commands.clear();
+}
+
+/****************************************************************************
+*                       Reserve
+*************************************************************************//**
+*  @fn        SpriteBatcher::Vertex* SpriteBatcher::Reserve(size_t spriteCount)
+*  @brief     Return the free area for spriteCount sprites (the caller writes and calls Commit)
+*  @param[in] size_t spriteCount
+*  @return @@Vertex* (spriteCount * SPRITE_VERTEX_COUNT vertices)
+*****************************************************************************/
+SpriteBatcher::Vertex* SpriteBatcher::Reserve(size_t spriteCount)
+{
+	if (_direct != nullptr) { return _direct + _spriteCount * SPRITE_VERTEX_COUNT; }
+
+	ReserveStaging(_spriteCount + spriteCount);
+	return &_staging[_spriteCount * SPRITE_VERTEX_COUNT];
+}
+
+/****************************************************************************
+*                       Commit
+*************************************************************************//**
+*  @fn        void SpriteBatcher::Commit(size_t spriteCount, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType)
+*  @brief     Append the draw command, or extend the last one when the state is the same
+*  @param[in] size_t spriteCount (<= the last reserved count)
+*  @param[in] std::uint64_t textureKey (same key : same texture)
+*  @param[in] std::uint32_t textureSlot
+*  @param[in] std::uint32_t blendType
+*  @return @@void
+*****************************************************************************/
+void SpriteBatcher::Commit(size_t spriteCount, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType)
+{
+	if (spriteCount == 0) { return; }
+	assert(_direct != nullptr || _spriteCount + spriteCount <= _stagingCapacity);
+
+	if (!_commands.empty() && _commands.back().TextureKey == textureKey && _commands.back().BlendType == blendType)
+	{
+		_commands.back().SpriteCount += static_cast<std::uint32_t>(spriteCount);
+	}
+	else
+	{
+		_commands.push_back({ textureKey, textureSlot, blendType, static_cast<std::uint32_t>(_spriteCount), static_cast<std::uint32_t>(spriteCount) });
+	}
+	_spriteCount += spriteCount;
+}
+
+SpriteBatcher::Vertex* SpriteBatcher::Allocate(size_t spriteCount, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType)
+{
+	Vertex* vertices = Reserve(spriteCount);
+	Commit(spriteCount, textureKey, textureSlot, blendType);
+	return vertices;
+}
+
+/****************************************************************************
+*                       Add
+*************************************************************************//**
+*  @fn        void SpriteBatcher::Add(const Vertex* firstVertex, size_t spriteCount, size_t spriteByteStride, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType)
+*  @brief     Copy the vertices of spriteCount sprites (streamed in the direct mode)
+*  @param[in] const Vertex* firstVertex
+*  @param[in] size_t spriteCount
+*  @param[in] size_t spriteByteStride
+*  @param[in] std::uint64_t textureKey
+*  @param[in] std::uint32_t textureSlot
+*  @param[in] std::uint32_t blendType
+*  @return @@void
+*****************************************************************************/
+void SpriteBatcher::Add(const Vertex* firstVertex, size_t spriteCount, size_t spriteByteStride, std::uint64_t textureKey, std::uint32_t textureSlot, std::uint32_t blendType)
+{
+	if (spriteCount == 0) { return; }
+
+	Vertex* destination = Allocate(spriteCount, textureKey, textureSlot, blendType);
+	if (_direct != nullptr)
+	{
+		CopySprites(destination, firstVertex, spriteCount, spriteByteStride);
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-      Staging is read again in End, so keep it in the cache
+	---------------------------------------------------------------------*/
+	std::uint8_t*       out = reinterpret_cast<std::uint8_t*>(destination);
+	const std::uint8_t* in  = reinterpret_cast<const std::uint8_t*>(firstVertex);
+	if (spriteByteStride == SPRITE_BYTE_SIZE)
+	{
+		std::memcpy(out, in, SPRITE_BYTE_SIZE * spriteCount);
+		return;
+	}
+	for (size_t i = 0; i < spriteCount; ++i, out += SPRITE_BYTE_SIZE, in += spriteByteStride)
+	{
+		std::memcpy(out, in, SPRITE_BYTE_SIZE);
+	}
+}
+
+/****************************************************************************
+*                       End
+*************************************************************************//**
+*  @fn        const std::vector<SpriteDrawBatch>& SpriteBatcher::End(Vertex* destination)
+*  @brief     Sort (SpriteSortMode::Texture) and merge the draw commands, and write the vertices in the batch order.
+*  @param[in] Vertex* destination (GetSpriteCount() * SPRITE_VERTEX_COUNT vertices. not used in the direct mode)
+*  @return @@const std::vector<SpriteDrawBatch>&
+*****************************************************************************/
+const std::vector<SpriteDrawBatch>& SpriteBatcher::End(Vertex* destination)
+{
+	_batches.clear();
+	if (_spriteCount == 0) { return _batches; }
+
+	/*-------------------------------------------------------------------
+	-      Deferred : commands are already merged with the previous one
+	---------------------------------------------------------------------*/
+	if (_sortMode == SpriteSortMode::Deferred)
+	{
+		if (_direct == nullptr) { CopyVertices(destination, _staging.get(), SPRITE_BYTE_SIZE * _spriteCount); }
+		for (const Command& command : _commands)
+		{
+			_batches.push_back({ command.TextureKey, command.TextureSlot, command.BlendType, command.FirstSprite, command.SpriteCount });
+		}
+		return _batches;
+	}
+
+	/*-------------------------------------------------------------------
+	-      Texture : stable sort by (blend, texture)
+	---------------------------------------------------------------------*/
+	_order.resize(_commands.size());
+	for (std::uint32_t i = 0; i < _order.size(); ++i) { _order[i] = i; }
+	std::stable_sort(_order.begin(), _order.end(), [this](std::uint32_t a, std::uint32_t b)
+	{
+		const Command& left  = _commands[a];
+		const Command& right = _commands[b];
+		if (left.BlendType != right.BlendType) { return left.BlendType < right.BlendType; }
+		return left.TextureKey < right.TextureKey;
+	});
+
+	std::uint32_t writtenSprite = 0;
+	for (const std::uint32_t index : _order)
+	{
+		const Command& command = _commands[index];
+		CopyVertices(destination + (size_t)writtenSprite * SPRITE_VERTEX_COUNT, &_staging[(size_t)command.FirstSprite * SPRITE_VERTEX_COUNT], SPRITE_BYTE_SIZE * command.SpriteCount);
+
+		if (!_batches.empty() && _batches.back().BlendType == command.BlendType && _batches.back().TextureKey == command.TextureKey)
+		{
+			_batches.back().SpriteCount += command.SpriteCount;
+		}
+		else
+		{
+			_batches.push_back({ command.TextureKey, command.TextureSlot, command.BlendType, writtenSprite, command.SpriteCount });
+		}
+		writtenSprite += command.SpriteCount;
+	}
+	return _batches;
+}
+
+/****************************************************************************
+*                       CopyVertices
+*************************************************************************//**
+*  @fn        void SpriteBatcher::CopyVertices(void* destination, const void* source, size_t byteSize)
+*  @brief     Bulk copy for the upload heap. SSE2 uses 64 byte non temporal stores,
+*             which fill whole write combining lines and don't pollute the cache.
+*  @param[in] void* destination
+*  @param[in] const void* source
+*  @param[in] size_t byteSize
+*  @return @@void
+*****************************************************************************/
+void SpriteBatcher::CopyVertices(void* destination, const void* source, size_t byteSize)
+{
+#if defined(GM_SIMD_USE_SSE2)
+	std::uint8_t*       out = static_cast<std::uint8_t*>(destination);
+	const std::uint8_t* in  = static_cast<const std::uint8_t*>(source);
+	if ((reinterpret_cast<std::uintptr_t>(out) & 15) != 0 || byteSize < 256)
+	{
+		std::memcpy(out, in, byteSize);
+		return;
+	}
+
+	size_t rest = byteSize;
+	for (; rest >= 64; rest -= 64, in += 64, out += 64)
+	{
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+		const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 48));
+		_mm_stream_si128(reinterpret_cast<__m128i*>(out)     , a);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), b);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), c);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), d);
+	}
+	if (rest > 0) { std::memcpy(out, in, rest); }
+	_mm_sfence();
+#else
+	std::memcpy(destination, source, byteSize);
+#endif
+}
+
+/****************************************************************************
+*                       CopySprites
+*************************************************************************//**
+*  @fn        void SpriteBatcher::CopySprites(void* destination, const void* source, size_t spriteCount, size_t spriteByteStride)
+*  @brief     Gather the vertices of strided sprites (e.g. std::vector<Sprite>) into packed write combined memory.
+*             A sprite is 192 bytes, so it is 3 full write combining lines when the destination is 64 byte aligned.
+*  @param[in] void* destination
+*  @param[in] const void* source (first vertex of the first sprite)
+*  @param[in] size_t spriteCount
+*  @param[in] size_t spriteByteStride
+*  @return @@void
+*****************************************************************************/
+void SpriteBatcher::CopySprites(void* destination, const void* source, size_t spriteCount, size_t spriteByteStride)
+{
+	if (spriteByteStride == SPRITE_BYTE_SIZE)
+	{
+		CopyVertices(destination, source, SPRITE_BYTE_SIZE * spriteCount);
+		return;
+	}
+
+	std::uint8_t*       out = static_cast<std::uint8_t*>(destination);
+	const std::uint8_t* in  = static_cast<const std::uint8_t*>(source);
+#if defined(GM_SIMD_USE_SSE2)
+	static_assert(SPRITE_BYTE_SIZE % 16 == 0, "sprite vertices must be a multiple of 16 bytes");
+	if ((reinterpret_cast<std::uintptr_t>(out) & 15) == 0)
+	{
+		for (size_t i = 0; i < spriteCount; ++i, out += SPRITE_BYTE_SIZE, in += spriteByteStride)
+		{
+			for (size_t offset = 0; offset < SPRITE_BYTE_SIZE; offset += 64)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset + 16));
+				const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset + 32));
+				const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset + 48));
+				_mm_stream_si128(reinterpret_cast<__m128i*>(out + offset)     , a);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(out + offset + 16), b);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(out + offset + 32), c);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(out + offset + 48), d);
+			}
+		}
+		_mm_sfence();
+		return;
+	}
+#endif
+	for (size_t i = 0; i < spriteCount; ++i, out += SPRITE_BYTE_SIZE, in += spriteByteStride)
+	{
+		std::memcpy(out, in, SPRITE_BYTE_SIZE);
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+void SpriteBatcher::ReserveStaging(size_t spriteCount)
+{
+	if (spriteCount <= _stagingCapacity) { return; }
+
+	const size_t newCapacity = (std::max)({ spriteCount, _stagingCapacity * 2, SPRITE_BATCHER_MIN_CAPACITY });
+	std::unique_ptr<Vertex[]> staging(new Vertex[newCapacity * SPRITE_VERTEX_COUNT]);
+	if (_spriteCount > 0) { std::memcpy(staging.get(), _staging.get(), SPRITE_BYTE_SIZE * _spriteCount); }
+	_staging         = std::move(staging);
+	_stagingCapacity = newCapacity;
+}
+#pragma endregion Private Function
@@ -11,6 +11,7 @@
 #include "GameCore/Include/Sprite/SpriteRenderer.hpp"
 #include "GameCore/Include/Sprite/SpritePipeLineState.hpp"
 #include "DirectX12/Include/Core/DirectX12StaticSampler.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <d3dcompiler.h>
 
 
@@ -23,7 +24,8 @@ using namespace gm;
 //                              Implement
 //////////////////////////////////////////////////////////////////////////////////
 #pragma region Public Function
-const int SpriteRenderer::MaxSpriteCount = 1024;
+const int SpriteRenderer::MaxSpriteCount     = 1024;
+const int SpriteRenderer::MaxDrawSpriteCount = 16384; // 16384 * 4 vertices = 65536 (16 bit index)
 SpriteRenderer::SpriteRenderer()
 {
 	_projectionViewMatrix =gm::MatrixIdentity();
@@ -35,14 +37,21 @@ SpriteRenderer::~SpriteRenderer()
 }
 
 
-bool SpriteRenderer::Initialize(FastBlendStateType type, const std::wstring& addName)
+bool SpriteRenderer::Initialize(FastBlendStateType type, const std::wstring& addName, int initialSpriteCount)
 {
-	SpritePSOManager& spriteManager = SpritePSOManager::Instance();
+	if (initialSpriteCount <= 0)
+	{
+		::OutputDebugString(L"Error!: initialSpriteCount must be positive.");
+		return false;
+	}
+	_maxSpriteCount = initialSpriteCount;
+	_blendType      = type;
 	
 	// set name
 	std::wstring name = L"";
 	if (addName != L"") { name += addName; name += L"::"; }
 	name += L"SpriteRenderer::";
+	_name = name;
 
 	if (!PrepareRootSignature (name + L"RootSignature"))          { return false; }
 	if (!PreparePipelineState (type, name + L"PipelineState"))    { return false; }
@@ -53,8 +62,15 @@ bool SpriteRenderer::Initialize(FastBlendStateType type, const std::wstring& add
 	return true;
 }
 
-
-bool SpriteRenderer::DrawStart()
+/****************************************************************************
+*                       DrawStart
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::DrawStart(SpriteSortMode sortMode)
+*  @brief     Set the render states and start collecting the sprites
+*  @param[in] SpriteSortMode sortMode (Texture : merge the draws of the same texture across the frame)
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::DrawStart(SpriteSortMode sortMode)
 {
 	
 	/*-------------------------------------------------------------------
@@ -62,135 +78,134 @@ bool SpriteRenderer::DrawStart()
 	---------------------------------------------------------------------*/
 	DirectX12& directX12                      = DirectX12::Instance();
 	CommandList* commandList                  = directX12.GetCommandList();
-	SpritePSOManager& spriteManager           = SpritePSOManager::Instance();
 	int currentFrameIndex                     = directX12.GetCurrentFrameIndex();
-	SpriteType spriteType                     = SpriteType::TEXTURE;
 	_textureDescHeap                          = directX12.GetCbvSrvUavHeap();
-	D3D12_VERTEX_BUFFER_VIEW vertexBufferView = _meshBuffer[currentFrameIndex].VertexBufferView();
 	D3D12_INDEX_BUFFER_VIEW  indexBufferView  = _meshBuffer[currentFrameIndex].IndexBufferView();
 
 	/*-------------------------------------------------------------------
 	-               Execute commandlist
 	---------------------------------------------------------------------*/
 	commandList->SetGraphicsRootSignature(_rootSignature.Get());
-	commandList->SetPipelineState(_pipelineState.Get());
+	commandList->SetPipelineState(_pipelineStates[(int)_blendType].Get());
 	ID3D12DescriptorHeap* heapList[] = {_textureDescHeap.Get()};
 	commandList->SetDescriptorHeaps(_countof(heapList), heapList);
 
 	commandList->SetGraphicsRootConstantBufferView(0, _constantBuffer.get()->Resource()->GetGPUVirtualAddress());
 	commandList->IASetPrimitiveTopology(D3D10_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	commandList->IASetVertexBuffers(0,1,&vertexBufferView);
 	commandList->IASetIndexBuffer(&indexBufferView);
-	return true;
-}
 
-bool SpriteRenderer::Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix)
-{
 	/*-------------------------------------------------------------------
-	-               sprite count check
+	-       New frame: the GPU has finished the previous use of this ring
 	---------------------------------------------------------------------*/
-	if (_spriteStackCount + spriteList.size() > MaxSpriteCount)
+	if (_ringFrameCount != directX12.GetFrameCount())
 	{
-		MessageBox(NULL, L"The maximum number of sprites exceeded. \n If the maximum number is not exceeded, please check whether DrawEnd is being called.", L"Warning", MB_ICONWARNING);
-		return false;
+		_ringFrameCount = directX12.GetFrameCount();
+		_ringOffset     = 0;
+		_retiredVertexBuffers[currentFrameIndex].clear();
 	}
 
-	/*-------------------------------------------------------------------
-	-               Prepare variable
-	---------------------------------------------------------------------*/
-	DirectX12& directX12            = DirectX12::Instance();
-	int currentFrameIndex           = directX12.GetCurrentFrameIndex();
+	_sortMode = sortMode;
+	_textures.clear();
+	_batcher.Begin(_sortMode, GetRingDestination());
+	return true;
+}
 
-	/*-------------------------------------------------------------------
-	-               Check whether spriteList is empty 
-	---------------------------------------------------------------------*/
-	if (spriteList.empty())
-	{
-		return true;
-	}
+bool SpriteRenderer::Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix)
+{
+	return Draw(spriteList, texture, matrix, _blendType);
+}
 
-	/*-------------------------------------------------------------------
-	-               Copy ProjectionViewMatrix
-	---------------------------------------------------------------------*/
-	_projectionViewMatrix = matrix;
-	_constantBuffer->CopyStart();
-	_constantBuffer->CopyData(0, _projectionViewMatrix);
-	_constantBuffer->CopyEnd();
+/****************************************************************************
+*                       Draw
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix, FastBlendStateType blendType)
+*  @brief     Add the sprites. Deferred writes them into the vertex ring now, Texture stages them until DrawEnd.
+*             There is no sprite count limit.
+*  @param[in] const std::vector<Sprite>& spriteList
+*  @param[in] const Texture& texture
+*  @param[in] const gm::Matrix4& matrix (projection view matrix. the last one is used for the frame)
+*  @param[in] FastBlendStateType blendType
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::Draw(const std::vector<Sprite>& spriteList, const Texture& texture, const gm::Matrix4& matrix, FastBlendStateType blendType)
+{
+	if (spriteList.empty()) { return true; }
+	if (!ReserveRing(static_cast<int>(spriteList.size()))) { return false; }
 
+	UpdateMatrix(matrix);
+	_batcher.Add(spriteList[0].Vertices.data(), spriteList.size(), sizeof(Sprite),
+		texture.GPUHandler.ptr, RegisterTexture(texture), static_cast<std::uint32_t>(blendType));
+	return true;
+}
 
-	/*-------------------------------------------------------------------
-	-               Add vertex data 
-	---------------------------------------------------------------------*/
-	_dynamicVertexBuffer[currentFrameIndex]->CopyStart();
-	for (int i = 0; i < min((INT64)spriteList.size(), (INT64)MaxSpriteCount - (INT64)_spriteStackCount); ++i)
+/****************************************************************************
+*                       BeginVertexWrite
+*************************************************************************//**
+*  @fn        VertexPositionNormalColorTexture* SpriteRenderer::BeginVertexWrite(int& outWritableSpriteCount, int requestSpriteCount)
+*  @brief     Return the area for the caller to write vertices directly.
+*             The caller writes 4 vertices per sprite (same order as Sprite::Vertices) and calls EndVertexWrite.
+*             With SpriteSortMode::Deferred it is the mapped upload heap (write combined), so write it sequentially and never read it.
+*  @param[out]int& outWritableSpriteCount
+*  @param[in] int requestSpriteCount (0 : initial sprite count)
+*  @return    VertexPositionNormalColorTexture* (nullptr: already writing)
+*****************************************************************************/
+VertexPositionNormalColorTexture* SpriteRenderer::BeginVertexWrite(int& outWritableSpriteCount, int requestSpriteCount)
+{
+	outWritableSpriteCount = 0;
+	if (_isWritingVertices)
 	{
-		for (int j = 0; j < 4; ++j)
-		{
-			_dynamicVertexBuffer[currentFrameIndex]->CopyData((i + _spriteStackCount) * 4 + j, spriteList[i].Vertices[j]);
-		}
+		::OutputDebugString(L"Error!: EndVertexWrite is not called.");
+		return nullptr;
 	}
-	_dynamicVertexBuffer[currentFrameIndex]->CopyEnd();
-
 
-	/*-------------------------------------------------------------------
-	-               Count sprite num
-	---------------------------------------------------------------------*/
-	_drawCallNum++;
-	_spriteStackCount += static_cast<int>(spriteList.size());
-	_spriteCountList.push_back(static_cast<int>(spriteList.size()));
-	_textures.push_back(texture);
+	const int spriteCount = requestSpriteCount > 0 ? requestSpriteCount : _maxSpriteCount;
+	if (!ReserveRing(spriteCount)) { return nullptr; }
 
-	return true;
+	_isWritingVertices     = true;
+	outWritableSpriteCount = spriteCount;
+	return _batcher.Reserve(static_cast<size_t>(outWritableSpriteCount));
 }
 
-bool SpriteRenderer::DrawEnd()
+/****************************************************************************
+*                       EndVertexWrite
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::EndVertexWrite(int writtenSpriteCount, const Texture& texture, const gm::Matrix4& matrix)
+*  @brief     Stack the draw call of the written sprites
+*  @param[in] int writtenSpriteCount
+*  @param[in] const Texture& texture
+*  @param[in] const gm::Matrix4& matrix (projection view matrix)
+*  @return    bool
+*****************************************************************************/
+bool SpriteRenderer::EndVertexWrite(int writtenSpriteCount, const Texture& texture, const gm::Matrix4& matrix)
 {
-	/*-------------------------------------------------------------------
-	-               Prepare variable
-	---------------------------------------------------------------------*/
-	DirectX12& directX12     = DirectX12::Instance();
-	CommandList* commandList = directX12.GetCommandList();
-	int currentFrameIndex    = directX12.GetCurrentFrameIndex();
-
-	/*-------------------------------------------------------------------
-	-                 Draw
-	---------------------------------------------------------------------*/
-	int spriteCounter = 0;
-	for (int i = 0; i < _drawCallNum; ++i)
+	if (!_isWritingVertices)
 	{
-		commandList->SetGraphicsRootDescriptorTable(1, _textures[i].GPUHandler);
-		commandList->DrawIndexedInstanced((UINT)(6 * _spriteCountList[i]), 1, 6 * spriteCounter, 0, 1);
-		spriteCounter += _spriteCountList[i];
+		::OutputDebugString(L"Error!: BeginVertexWrite is not called.");
+		return false;
 	}
+	_isWritingVertices = false;
+	if (writtenSpriteCount <= 0) { return true; }
 
-	/*-------------------------------------------------------------------
-	-               Reset Stack Count 
-	---------------------------------------------------------------------*/
-	_spriteStackCount = 0;
-	_drawCallNum      = 0;
-	spriteCounter     = 0;
-	_spriteCountList.clear();
-	_textures.clear();
-	_vertices.clear();
-	
-	/*-------------------------------------------------------------------
-	-               Reset VertexData
-	---------------------------------------------------------------------*/
-	VertexPositionNormalColorTexture* vertices = new VertexPositionNormalColorTexture[4 * MaxSpriteCount];
-	_dynamicVertexBuffer[currentFrameIndex]->CopyStart();
-	for (int j = 0; j < 4 * min(_spriteStackCount, MaxSpriteCount); ++j)
-	{
-		vertices[j].Position = Float3(0.0f, 0.0f, 0.0f);
-		vertices[j].Normal   = Float3(0.0f, 0.0f, 0.0f);
-		vertices[j].Color    = Float4(1.0f, 1.0f, 1.0f, 1.0f);
-		vertices[j].UV       = Float2(0.0f, 0.0f);
-		_dynamicVertexBuffer[currentFrameIndex]->CopyData(j, vertices[j]);
-	}
-	_dynamicVertexBuffer[currentFrameIndex]->CopyEnd();
-	delete[] vertices;
+	UpdateMatrix(matrix);
+	_batcher.Commit(static_cast<size_t>(writtenSpriteCount), texture.GPUHandler.ptr, RegisterTexture(texture), static_cast<std::uint32_t>(_blendType));
 	return true;
 }
 
+/****************************************************************************
+*                       DrawEnd
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::DrawEnd()
+*  @brief     Issue the draw calls of the remaining sprites
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::DrawEnd()
+{
+	const bool result = FlushBatches();
+	_textures.clear();
+	return result;
+}
+
 bool SpriteRenderer::Finalize()
 {
 	/*-------------------------------------------------------------------
@@ -201,96 +216,90 @@ bool SpriteRenderer::Finalize()
 	/*-------------------------------------------------------------------
 	-           Clear texture resource
 	---------------------------------------------------------------------*/
-	for (auto& texture : _textures) 
-	{ 
-		if (texture.Resource)
-		{
-			texture.Resource = nullptr;
-		}
-	}
 	_textures.clear(); _textures.shrink_to_fit();
 	_textureDescHeap = nullptr;
 	/*-------------------------------------------------------------------
-	-           Clear Vertices
+	-           Clear Vertices (unmap the persistent mapping)
 	---------------------------------------------------------------------*/
-	_vertices.clear(); _vertices.shrink_to_fit();
-	for (auto& buffer : _dynamicVertexBuffer) 
-	{ 
-		buffer.get()->Resource()->Release();
-		buffer.reset();
+	for (int i = 0; i < FRAME_BUFFER_COUNT; ++i)
+	{
+		if (_dynamicVertexBuffer[i]) { _dynamicVertexBuffer[i]->CopyEnd(); }
+		_dynamicVertexBuffer[i].reset();
+		_retiredVertexBuffers[i].clear();
+		_vertexBufferCapacity[i] = 0;
 	}
+	_ringOffset     = 0;
+	_ringFrameCount = UINT64_MAX;
+	_batcher.Begin();
 	
 	/*-------------------------------------------------------------------
 	-           Clear ConstantBuffer
 	---------------------------------------------------------------------*/
+	_constantBuffer->CopyEnd();
 	_constantBuffer.get()->Resource()->Release();
 	_constantBuffer.reset();
-	/*-------------------------------------------------------------------
-	-           Clear SpriteCountList
-	---------------------------------------------------------------------*/
-	_spriteCountList.clear(); _spriteCountList.shrink_to_fit();
 
 	/*-------------------------------------------------------------------
 	-           Clear PipelineState
 	---------------------------------------------------------------------*/
 	_rootSignature = nullptr;
-	_pipelineState = nullptr;
+	for (auto& pipelineState : _pipelineStates) { pipelineState = nullptr; }
 	return true;
 }
 #pragma endregion Public Function
 
 #pragma region Private Function
-
-
-
 /****************************************************************************
 *                       PrepareVertexBuffer
 *************************************************************************//**
 *  @fn        bool SpriteRenderer::PrepareVertexBuffer()
-*  @brief     Prepare vertex buffer by the amount of the maxSpriteCount
+*  @brief     Prepare the vertex ring of each frame by the amount of the initial sprite count
 *  @param[in] void
 *  @return @@bool
 *****************************************************************************/
 bool SpriteRenderer::PrepareVertexBuffer(const std::wstring& name)
 {
-	SpritePSOManager& spriteManager = SpritePSOManager::Instance();
-	DirectX12& directX12            = DirectX12::Instance();
-
+	(void)name; // named in CreateVertexBuffer
 	_meshBuffer.resize(FRAME_BUFFER_COUNT);
 	for (int i = 0; i < _meshBuffer.size(); ++i)
 	{
-		VertexPositionNormalColorTexture* vertices = new VertexPositionNormalColorTexture[4 * MaxSpriteCount];
-		_dynamicVertexBuffer[i] = std::make_unique<UploadBuffer<VertexPositionNormalColorTexture>>(directX12.GetDevice(), MaxSpriteCount * 4, false,name);
-
-		_dynamicVertexBuffer[i]->CopyStart();
-		for (int j = 0; j < MaxSpriteCount * 4; ++j)
-		{
-			vertices[j].Position = Float3(0.0f, 0.0f, 0.0f);
-			vertices[j].Normal   = Float3(0.0f, 0.0f, 0.0f);
-			vertices[j].Color    = Float4(1.0f, 1.0f, 1.0f, 1.0f);
-			vertices[j].UV       = Float2(0.0f, 0.0f);
-			_dynamicVertexBuffer[i]->CopyData(j, vertices[j]);
-		}
-		_dynamicVertexBuffer[i]->CopyEnd();
-		const UINT vbByteSize = (UINT)MaxSpriteCount * 4 * sizeof(VertexPositionNormalColorTexture);
-
-		/*-------------------------------------------------------------------
-		-			Build CPU / GPU Vertex Buffer
-		---------------------------------------------------------------------*/
-		_meshBuffer[i].BaseVertexLocation   = 0;
-		_meshBuffer[i].VertexBufferGPU      = _dynamicVertexBuffer[i]->Resource();
-		_meshBuffer[i].VertexByteStride     = sizeof(VertexPositionNormalColorTexture);
-		_meshBuffer[i].VertexBufferByteSize = vbByteSize;
-		if (FAILED(D3DCreateBlob(vbByteSize, &_meshBuffer[i].VertexBufferCPU)))
-		{
-			::OutputDebugString(L"Can't create blob data (vertex)");
-			return false;
-		}
-		//CopyMemory(_meshBuffer[i].VertexBufferCPU->GetBufferPointer(), vertices, vbByteSize);
-		delete[] vertices;
+		if (!CreateVertexBuffer(i, _maxSpriteCount)) { return false; }
 	}
+	return true;
+}
 
+/****************************************************************************
+*                       CreateVertexBuffer
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::CreateVertexBuffer(int frameIndex, int spriteCapacity)
+*  @brief     Create the persistently mapped vertex buffer of the frame.
+*             The old buffer is retired (it may be still referenced by the recorded draws).
+*  @param[in] int frameIndex
+*  @param[in] int spriteCapacity
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::CreateVertexBuffer(int frameIndex, int spriteCapacity)
+{
+	DirectX12& directX12 = DirectX12::Instance();
+
+	VertexBufferPtr buffer = std::make_unique<UploadBuffer<VertexPositionNormalColorTexture>>(directX12.GetDevice(), (UINT)spriteCapacity * SPRITE_VERTEX_COUNT, false, _name + L"VertexBuffer");
+	buffer->CopyStart(); // kept mapped until Finalize (upload heap can stay mapped while the GPU reads it)
+
+	if (_dynamicVertexBuffer[frameIndex])
+	{
+		_dynamicVertexBuffer[frameIndex]->CopyEnd();
+		_retiredVertexBuffers[frameIndex].push_back(std::move(_dynamicVertexBuffer[frameIndex]));
+	}
+	_dynamicVertexBuffer[frameIndex]  = std::move(buffer);
+	_vertexBufferCapacity[frameIndex] = spriteCapacity;
 
+	/*-------------------------------------------------------------------
+	-			Build GPU Vertex Buffer
+	---------------------------------------------------------------------*/
+	_meshBuffer[frameIndex].BaseVertexLocation   = 0;
+	_meshBuffer[frameIndex].VertexBufferGPU      = _dynamicVertexBuffer[frameIndex]->Resource();
+	_meshBuffer[frameIndex].VertexByteStride     = sizeof(VertexPositionNormalColorTexture);
+	_meshBuffer[frameIndex].VertexBufferByteSize = (UINT)spriteCapacity * SPRITE_VERTEX_COUNT * sizeof(VertexPositionNormalColorTexture);
 	return true;
 }
 
@@ -298,25 +307,25 @@ bool SpriteRenderer::PrepareVertexBuffer(const std::wstring& name)
 *                       PrepareIndexBuffer
 *************************************************************************//**
 *  @fn        bool SpriteRenderer::PrepareIndexBuffer()
-*  @brief     Prepare index buffer by the amount of the maxSpriteCount
+*  @brief     Prepare the 16 bit index buffer of MaxDrawSpriteCount sprites.
+*             Each draw starts from index 0 and moves the base vertex, so it doesn't depend on the ring size.
 *  @param[in] void
 *  @return @@bool
 *****************************************************************************/
 bool SpriteRenderer::PrepareIndexBuffer(const std::wstring& name)
 {
-	SpritePSOManager& spriteManager = SpritePSOManager::Instance();
 	DirectX12& directX12 = DirectX12::Instance();
 
 	/*-------------------------------------------------------------------
 	-			Create rect indices
 	---------------------------------------------------------------------*/
-	std::vector<UINT16> indices(MaxSpriteCount * 6);
+	std::vector<UINT16> indices((UINT64)MaxDrawSpriteCount * 6);
 	UINT16 spriteIndex[] = { 0,1,3,1,2,3 };
-	for (int i = 0; i < MaxSpriteCount; ++i)
+	for (int i = 0; i < MaxDrawSpriteCount; ++i)
 	{
 		for (int j = 0; j < 6; ++j)
 		{
-			indices[(UINT64)6 * i + j] = i * 4 + spriteIndex[j];
+			indices[(UINT64)6 * i + j] = (UINT16)(i * 4 + spriteIndex[j]);
 		}
 	}
 
@@ -355,7 +364,7 @@ bool SpriteRenderer::PrepareIndexBuffer(const std::wstring& name)
 *                       PrepareConstantBuffer
 *************************************************************************//**
 *  @fn        bool SpriteRenderer::PrepareConstantBuffer()
-*  @brief     Prepare constant buffer by the amount of the maxSpriteCount
+*  @brief     Prepare the projection view matrix buffer (kept mapped)
 *  @param[in] void
 *  @return @@bool
 *****************************************************************************/
@@ -371,7 +380,6 @@ bool SpriteRenderer::PrepareConstantBuffer(const std::wstring& name)
 	_constantBuffer = std::make_unique<UploadBuffer<Matrix4>>(directX12.GetDevice(), 1, true, name);
 	_constantBuffer->CopyStart();
 	_constantBuffer->CopyData(0, _projectionViewMatrix);
-	_constantBuffer->CopyEnd();
 	/*-------------------------------------------------------------------
 	-			Build Constant Buffer View descriptor
 	---------------------------------------------------------------------*/
@@ -386,6 +394,128 @@ bool SpriteRenderer::PrepareConstantBuffer(const std::wstring& name)
 	return true;
 }
 
+void SpriteRenderer::UpdateMatrix(const gm::Matrix4& matrix)
+{
+	_projectionViewMatrix = matrix;
+	_constantBuffer->CopyData(0, _projectionViewMatrix);
+}
+
+/****************************************************************************
+*                       RegisterTexture
+*************************************************************************//**
+*  @fn        std::uint32_t SpriteRenderer::RegisterTexture(const Texture& texture)
+*  @brief     Return the texture slot for the batcher (the same texture in a row shares the slot)
+*  @param[in] const Texture& texture
+*  @return @@std::uint32_t
+*****************************************************************************/
+std::uint32_t SpriteRenderer::RegisterTexture(const Texture& texture)
+{
+	if (_textures.empty() || _textures.back().GPUHandler.ptr != texture.GPUHandler.ptr)
+	{
+		_textures.push_back(texture);
+	}
+	return static_cast<std::uint32_t>(_textures.size() - 1);
+}
+
+VertexPositionNormalColorTexture* SpriteRenderer::GetRingDestination() const
+{
+	const int currentFrameIndex = DirectX12::Instance().GetCurrentFrameIndex();
+	return _dynamicVertexBuffer[currentFrameIndex]->GetMappedData() + (INT64)_ringOffset * SPRITE_VERTEX_COUNT;
+}
+
+/****************************************************************************
+*                       ReserveRing
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::ReserveRing(int spriteCount)
+*  @brief     Make room for spriteCount more sprites in the vertex ring (direct write only).
+*             When the ring is full, the sprites so far are drawn and the ring is replaced by a larger one.
+*  @param[in] int spriteCount
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::ReserveRing(int spriteCount)
+{
+	if (!_batcher.IsDirect()) { return true; } // staged: checked in FlushBatches
+
+	const int currentFrameIndex = DirectX12::Instance().GetCurrentFrameIndex();
+	if (_ringOffset + (int)_batcher.GetSpriteCount() + spriteCount <= _vertexBufferCapacity[currentFrameIndex]) { return true; }
+
+	if (!FlushBatches()) { return false; }
+	if (_ringOffset + spriteCount > _vertexBufferCapacity[currentFrameIndex])
+	{
+		const int capacity = (std::max)(_vertexBufferCapacity[currentFrameIndex] * 2, spriteCount);
+		if (!CreateVertexBuffer(currentFrameIndex, capacity)) { return false; }
+		_ringOffset = 0;
+		_batcher.Begin(_sortMode, GetRingDestination());
+	}
+	return true;
+}
+
+/****************************************************************************
+*                       FlushBatches
+*************************************************************************//**
+*  @fn        bool SpriteRenderer::FlushBatches()
+*  @brief     Write the staged vertices (if any) into the vertex ring and issue one draw per batch
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool SpriteRenderer::FlushBatches()
+{
+	PROFILE_FUNCTION();
+	/*-------------------------------------------------------------------
+	-               Prepare variable
+	---------------------------------------------------------------------*/
+	DirectX12& directX12     = DirectX12::Instance();
+	CommandList* commandList = directX12.GetCommandList();
+	int currentFrameIndex    = directX12.GetCurrentFrameIndex();
+	const int spriteCount    = static_cast<int>(_batcher.GetSpriteCount());
+	if (spriteCount == 0) { return true; }
+
+	/*-------------------------------------------------------------------
+	-       Grow for the staged vertices (draws recorded before keep using the retired buffer)
+	---------------------------------------------------------------------*/
+	if (!_batcher.IsDirect() && _ringOffset + spriteCount > _vertexBufferCapacity[currentFrameIndex])
+	{
+		const int capacity = (std::max)(_vertexBufferCapacity[currentFrameIndex] * 2, spriteCount);
+		if (!CreateVertexBuffer(currentFrameIndex, capacity)) { return false; }
+		_ringOffset = 0;
+	}
+
+	const std::vector<SpriteDrawBatch>& batches = _batcher.End(GetRingDestination());
+	D3D12_VERTEX_BUFFER_VIEW vertexBufferView   = _meshBuffer[currentFrameIndex].VertexBufferView();
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
+
+	/*-------------------------------------------------------------------
+	-                 Draw
+	---------------------------------------------------------------------*/
+	std::uint32_t currentBlend = static_cast<std::uint32_t>(_blendType);
+	for (const SpriteDrawBatch& batch : batches)
+	{
+		if (batch.BlendType != currentBlend)
+		{
+			const FastBlendStateType blendType = static_cast<FastBlendStateType>(batch.BlendType);
+			if (_pipelineStates[batch.BlendType] == nullptr && !PreparePipelineState(blendType, _name + L"PipelineState")) { return false; }
+			commandList->SetPipelineState(_pipelineStates[batch.BlendType].Get());
+			currentBlend = batch.BlendType;
+		}
+		commandList->SetGraphicsRootDescriptorTable(1, _textures[batch.TextureSlot].GPUHandler);
+
+		for (std::uint32_t first = 0; first < batch.SpriteCount; first += MaxDrawSpriteCount)
+		{
+			const UINT drawCount  = (std::min)(batch.SpriteCount - first, (std::uint32_t)MaxDrawSpriteCount);
+			const INT  baseVertex = (_ringOffset + (INT)(batch.FirstSprite + first)) * SPRITE_VERTEX_COUNT;
+			commandList->DrawIndexedInstanced(6 * drawCount, 1, 0, baseVertex, 0);
+		}
+	}
+	if (currentBlend != static_cast<std::uint32_t>(_blendType)) { commandList->SetPipelineState(_pipelineStates[(int)_blendType].Get()); }
+
+	/*-------------------------------------------------------------------
+	-               Advance the ring
+	---------------------------------------------------------------------*/
+	_ringOffset += spriteCount;
+	_batcher.Begin(_sortMode, GetRingDestination());
+	return true;
+}
+
 bool SpriteRenderer::PrepareRootSignature(const std::wstring& name)
 {
 	/*-------------------------------------------------------------------
@@ -439,9 +569,9 @@ bool SpriteRenderer::PreparePipelineState(FastBlendStateType type, const std::ws
 		GetShaderBlendData(type).PixelShader->GetBufferSize()
 	};
 	pipeLineState.BlendState = GetBlendDesc(type);
-	ThrowIfFailed(DirectX12::Instance().GetDevice()->CreateGraphicsPipelineState(&pipeLineState, IID_PPV_ARGS(&_pipelineState)));
+	ThrowIfFailed(DirectX12::Instance().GetDevice()->CreateGraphicsPipelineState(&pipeLineState, IID_PPV_ARGS(&_pipelineStates[(int)type])));
 
-	_pipelineState->SetName(name.c_str());
+	_pipelineStates[(int)type]->SetName(name.c_str());
 
 	return true;
 
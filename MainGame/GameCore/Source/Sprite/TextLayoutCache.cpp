@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TextLayoutCache.cpp
+///             @brief  Cache of the text quads (GPU independent)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Sprite/TextLayoutCache.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                       BeginFrame
+*************************************************************************//**
+*  @fn        void TextLayoutCache::BeginFrame(std::uint64_t frame)
+*  @brief     Remove the layouts which have not been used for CACHE_LIFE_FRAME frames
+*             (checked once every CACHE_LIFE_FRAME frames)
+*  @param[in] std::uint64_t frame
+*  @return @@void
+*****************************************************************************/
+void TextLayoutCache::BeginFrame(std::uint64_t frame)
+{
+	_frame = frame;
+	if (_frame < _lastSweep + CACHE_LIFE_FRAME) { return; }
+	_lastSweep = _frame;
+
+	_expiredKeys.clear();
+	_layouts.ForEach([&](const std::string& key, TextLayout& layout)
+	{
+		if (layout.LastUsedFrame + CACHE_LIFE_FRAME < _frame) { _expiredKeys.push_back(key); }
+	});
+	for (const std::string& key : _expiredKeys) { _layouts.Erase(key); }
+}
+
+void TextLayoutCache::Clear()
+{
+	_layouts.Clear();
+	_expiredKeys.clear();
+}
+
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*                       FindOrAdd
+*************************************************************************//**
+*  @fn        TextLayout& TextLayoutCache::FindOrAdd()
+*  @brief     Return the layout of the current key (the key string is allocated only when it is added)
+*  @param[in] void
+*  @return @@TextLayout&
+*****************************************************************************/
+TextLayout& TextLayoutCache::FindOrAdd()
+{
+	TextLayout* layout = _layouts.Find(std::string_view(_key));
+	if (layout == nullptr) { layout = _layouts.TryEmplace(_key).first; }
+	layout->LastUsedFrame = _frame;
+	return *layout;
+}
+
+/****************************************************************************
+*                       PrepareDrawVertices
+*************************************************************************//**
+*  @fn        void TextLayoutCache::PrepareDrawVertices(TextLayout& layout, const gm::Float3& startPosition, const gm::Float4& color)
+*  @brief     Move and color the vertices when the start position or the color changed.
+*             The z of the start position is not used (same as the former TextRenderer).
+*  @param[in] TextLayout& layout
+*  @param[in] const gm::Float3& startPosition
+*  @param[in] const gm::Float4& color
+*  @return @@void
+*****************************************************************************/
+void TextLayoutCache::PrepareDrawVertices(TextLayout& layout, const Float3& startPosition, const Float4& color)
+{
+	if (layout.IsDrawReady
+		&& layout.DrawOffset.x == startPosition.x && layout.DrawOffset.y == startPosition.y
+		&& layout.DrawColor.x  == color.x && layout.DrawColor.y == color.y && layout.DrawColor.z == color.z && layout.DrawColor.w == color.w)
+	{
+		return;
+	}
+
+	layout.DrawVertices.resize(layout.Vertices.size());
+	for (size_t i = 0; i < layout.Vertices.size(); ++i)
+	{
+		const Vertex& source = layout.Vertices[i];
+		Vertex& destination  = layout.DrawVertices[i];
+		destination.Position = Float3(source.Position.x + startPosition.x, source.Position.y + startPosition.y, source.Position.z);
+		destination.Normal   = source.Normal;
+		destination.Color    = color;
+		destination.UV       = source.UV;
+	}
+	layout.DrawOffset  = Float3(startPosition.x, startPosition.y, 0.0f);
+	layout.DrawColor   = color;
+	layout.IsDrawReady = true;
+}
+
+/****************************************************************************
+*                       SetQuad
+*************************************************************************//**
+*  @fn        void TextLayoutCache::SetQuad(Vertex* vertices, float left, float right, float bottom, float top, const TextGlyph& glyph)
+*  @brief     Same vertex order and uv as Sprite::CreateRect (no rotation)
+*  @param[out]Vertex* vertices (4 vertices)
+*  @param[in] float left, float right, float bottom, float top
+*  @param[in] const TextGlyph& glyph
+*  @return @@void
+*****************************************************************************/
+void TextLayoutCache::SetQuad(Vertex* vertices, float left, float right, float bottom, float top, const TextGlyph& glyph)
+{
+	const Float3 normal = Float3(0.0f, 0.0f, 1.0f);
+	const Float4 white  = Float4(1.0f, 1.0f, 1.0f, 1.0f);
+	vertices[0] = Vertex(Float3(left , bottom, 0.0f), normal, white, Float2(glyph.U.x, glyph.V.y));
+	vertices[1] = Vertex(Float3(left , top   , 0.0f), normal, white, Float2(glyph.U.x, glyph.V.x));
+	vertices[2] = Vertex(Float3(right, top   , 0.0f), normal, white, Float2(glyph.U.y, glyph.V.x));
+	vertices[3] = Vertex(Float3(right, bottom, 0.0f), normal, white, Float2(glyph.U.y, glyph.V.y));
+}
+
+void TextLayoutCache::SetQuadUV(Vertex* vertices, const TextGlyph& glyph)
+{
+	vertices[0].UV = Float2(glyph.U.x, glyph.V.y);
+	vertices[1].UV = Float2(glyph.U.x, glyph.V.x);
+	vertices[2].UV = Float2(glyph.U.y, glyph.V.x);
+	vertices[3].UV = Float2(glyph.U.y, glyph.V.y);
+}
+#pragma endregion Private Function
@@ -10,17 +10,22 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Include/Sprite/TextRenderer.hpp"
 #include "DirectX12/Include/Core/DirectX12Texture.hpp"
+#include "DirectX12/Include/Core/DirectX12Base.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
-#define ASCII_START_CHAR 32 // start from ' '. 
+#define ASCII_START_CHAR 32 // start from ' '.
+#define SYSTEM_FONT_ID   0x10000 // layout cache font id of the system fonts (FontType is used for the font sheets)
+#define GLYPH_ATLAS_WIDTH          1024
+#define GLYPH_ATLAS_INITIAL_HEIGHT 256
+#define GLYPH_ATLAS_MAX_HEIGHT     2048
 using namespace gm;
 //////////////////////////////////////////////////////////////////////////////////
 //                             Implement
 //////////////////////////////////////////////////////////////////////////////////
 TextRenderer::~TextRenderer()
 {
-	
+	ReleaseSystemFonts();
 }
 #pragma region Public Function
 /****************************************************************************
@@ -36,6 +41,7 @@ bool TextRenderer::Initialize()
 	FontLoader fontLoader;
 	if (!fontLoader.Initialize())      { return false; }
 	if (!SpriteRenderer::Initialize(FastBlendStateType::Normal, L"TextRenderer")) { return false; }
+	if (!_glyphAtlas.Initialize(GLYPH_ATLAS_WIDTH, GLYPH_ATLAS_INITIAL_HEIGHT, GLYPH_ATLAS_MAX_HEIGHT)) { return false; }
 	return true;
 }
 
@@ -43,18 +49,29 @@ bool TextRenderer::ReloadFont()
 {
 	FontLoader::Finalize();
 	FontLoader::Initialize();
+	_layoutCache.Clear();
 	return true;
 }
 bool TextRenderer::DrawStart()
 {
 	if (!SpriteRenderer::DrawStart()) { return false; }
+
+	/*-------------------------------------------------------------------
+	-     Release the atlas textures the GPU no longer reads
+	---------------------------------------------------------------------*/
+	const UINT64 frameCount = DirectX12::Instance().GetFrameCount();
+	while (!_retiredAtlasTextures.empty() && _retiredAtlasTextures.front().first + FRAME_BUFFER_COUNT < frameCount)
+	{
+		_retiredAtlasTextures.erase(_retiredAtlasTextures.begin());
+	}
+	_layoutCache.BeginFrame(frameCount);
 	return true;
 }
 /****************************************************************************
 *							DrawString
 *************************************************************************//**
 *  @fn        bool TextRenderer::DrawString(FontType fontType, const TextString& text, const DirectX::XMFLOAT4& color, const DirectX::XMMATRIX& matrix)
-*  @brief     Draw String
+*  @brief     Draw String (the quads are built only when the text is not cached)
 *  @param[in] FontType fontType
 *  @param[in] const TextString& text
 *  @param[in] const DirectX::XMFLOAT4& color
@@ -66,46 +83,29 @@ bool TextRenderer::DrawString(FontType fontType, const TextString& text, const F
 	/*-------------------------------------------------------------------
 	-              Variable definition
 	---------------------------------------------------------------------*/
-	FontLoader           fontLoader;
-	std::vector<char>    string(text.String.length());
-	std::vector<Sprite>  spriteList(text.String.length());
-	FontInfo* fontInfo = &fontLoader.FontTable[fontType];
-
-	/*-------------------------------------------------------------------
-	-              Push_back the char 
-	---------------------------------------------------------------------*/
-	for (int i = 0; i < text.String.length(); ++i)
-	{
-		string[i] = static_cast<char>(text.String[i]);
-	}
+	FontLoader  fontLoader;
+	FontInfo*   fontInfo = &fontLoader.FontTable[fontType];
+	const float uStep    = fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth;
 
 	/*-------------------------------------------------------------------
-	-              Create Sprite (DirectX Coordinates)
+	-              Get the layout (DirectX Coordinates)
 	---------------------------------------------------------------------*/
-	for (int i = 0; i < text.String.length(); ++i)
-	{
-		Float3 centerPosition = Float3(
-			text.StartPosition.x + (i + 0.5f) * text.SizePerChar.x + i * text.Space,
-			text.StartPosition.y - text.SizePerChar.y,
-			0.0f);
-
-		Float2 u = Float2(
-			(string[i]      - ASCII_START_CHAR) * (fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth),
-			(string[i] + 1  - ASCII_START_CHAR) * (fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth));
+	const TextLayout& layout = _layoutCache.GetString(static_cast<std::uint32_t>(fontType), 0, text, color,
+		[uStep](wchar_t character, TextGlyph& glyph)
+		{
+			const char c = static_cast<char>(character);
+			glyph.U = Float2((c - ASCII_START_CHAR) * uStep, (c + 1 - ASCII_START_CHAR) * uStep);
+			return true;
+		});
 
-		Float2 v = Float2(0.0f, 1.0f);
-
-		spriteList[i].CreateSprite(centerPosition, text.SizePerChar, color, u, v);
-	}
-	SpriteRenderer::Draw(spriteList, fontInfo->Texture, matrix);
-	return true;
+	return DrawLayout(layout, fontInfo->Texture, matrix);
 }
 
 /****************************************************************************
 *							DrawNumber
 *************************************************************************//**
 *  @fn        bool TextRenderer::DrawNumber(FontType fontType, const TextNumber& num, const DirectX::XMFLOAT4& color, const DirectX::XMMATRIX& matrix)
-*  @brief     Draw Number
+*  @brief     Draw Number (only the changed digits are updated)
 *  @param[in] FontType fontType
 *  @param[in] const TextNumber& num
 *  @param[in] const DirectX::XMFLOAT4& color
@@ -117,42 +117,88 @@ bool TextRenderer::DrawNumber(FontType fontType, const TextNumber& num, const Fl
 	/*-------------------------------------------------------------------
 	-              Variable definition
 	---------------------------------------------------------------------*/
-	FontLoader           fontLoader;
-	std::vector<int>     values(num.Digit);
-	std::vector<Sprite>  spriteList(num.Digit);
-	FontInfo* fontInfo = &fontLoader.FontTable[fontType];
+	FontLoader  fontLoader;
+	FontInfo*   fontInfo = &fontLoader.FontTable[fontType];
+	const float uStep    = fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth;
 
 	/*-------------------------------------------------------------------
-	-              Push_back the value of each digit.
+	-              Get the layout (DirectX Coordinates)
 	---------------------------------------------------------------------*/
-	int tempValue = num.Number;
-	for (int i = num.Digit - 1; i >= 0; --i)
+	const TextLayout& layout = _layoutCache.GetNumber(static_cast<std::uint32_t>(fontType), 0, num, color,
+		[uStep](int digit, TextGlyph& glyph)
+		{
+			glyph.U = Float2(digit * uStep, (digit + 1) * uStep);
+			return true;
+		});
+
+	return DrawLayout(layout, fontInfo->Texture, matrix);
+}
+
+/****************************************************************************
+*							DrawString
+*************************************************************************//**
+*  @fn        bool TextRenderer::DrawString(int systemFontIndex, const TextString& text, const gm::Float4& color, const gm::Matrix4& matrix)
+*  @brief     Draw String with the system font (proportional. the glyphs are added to the atlas on demand)
+*  @param[in] int systemFontIndex (LoadSystemFont)
+*  @param[in] const TextString& text
+*  @param[in] const gm::Float4& color
+*  @param[in] const gm::Matrix4 matrix(projectionView)
+*  @return @@bool
+*****************************************************************************/
+bool TextRenderer::DrawString(int systemFontIndex, const TextString& text, const Float4& color, const Matrix4& matrix)
+{
+	if (systemFontIndex < 0 || systemFontIndex >= static_cast<int>(_systemFonts.size())) { return false; }
+
+	const std::uint32_t fontID = SYSTEM_FONT_ID + systemFontIndex;
+	auto glyphFunction = [this, systemFontIndex](wchar_t character, TextGlyph& glyph)
 	{
-		values[i] = (tempValue % 10);
-		tempValue = tempValue / 10;
-	}
+		return GetSystemGlyph(systemFontIndex, character, glyph);
+	};
 
 	/*-------------------------------------------------------------------
-	-              Create Sprite (DirectX Coordinates)
+	-    Get the layout (built again if the atlas was resized while building)
 	---------------------------------------------------------------------*/
-	for (int i = 0; i < num.Digit; ++i)
+	const std::uint32_t generation = _glyphAtlas.GetGeneration();
+	const TextLayout*   layout     = &_layoutCache.GetString(fontID, generation, text, color, glyphFunction);
+	if (generation != _glyphAtlas.GetGeneration())
 	{
-		Float3 centerPosition = Float3(
-			num.StartPosition.x + (i + 0.5f) * num.SizePerDigit.x + i * num.Space,
-			num.StartPosition.y - num.SizePerDigit.y,
-			0.0f);
+		layout = &_layoutCache.GetString(fontID, _glyphAtlas.GetGeneration(), text, color, glyphFunction);
+	}
 
-		Float2 u = Float2(
-			values[i]       * (fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth),
-			(values[i] + 1) * (fontInfo->PixelSizePerChar.x / fontInfo->ImagePixelWidth));
+	if (!UploadGlyphAtlas()) { return false; }
+	return DrawLayout(*layout, _atlasTexture, matrix);
+}
+
+/****************************************************************************
+*							DrawNumber
+*************************************************************************//**
+*  @fn        bool TextRenderer::DrawNumber(int systemFontIndex, const TextNumber& number, const gm::Float4& color, const gm::Matrix4& matrix)
+*  @brief     Draw Number with the system font (each digit has the same width)
+*  @param[in] int systemFontIndex (LoadSystemFont)
+*  @param[in] const TextNumber& number
+*  @param[in] const gm::Float4& color
+*  @param[in] const gm::Matrix4 matrix(projectionView)
+*  @return @@bool
+*****************************************************************************/
+bool TextRenderer::DrawNumber(int systemFontIndex, const TextNumber& number, const Float4& color, const Matrix4& matrix)
+{
+	if (systemFontIndex < 0 || systemFontIndex >= static_cast<int>(_systemFonts.size())) { return false; }
 
-		Float2 v = Float2(0.0f, 1.0f);
+	const std::uint32_t fontID = SYSTEM_FONT_ID + systemFontIndex;
+	auto glyphFunction = [this, systemFontIndex](int digit, TextGlyph& glyph)
+	{
+		return GetSystemGlyph(systemFontIndex, static_cast<wchar_t>(L'0' + digit), glyph);
+	};
 
-		spriteList[i].CreateSprite(centerPosition, num.SizePerDigit, color, u, v);
+	const std::uint32_t generation = _glyphAtlas.GetGeneration();
+	const TextLayout*   layout     = &_layoutCache.GetNumber(fontID, generation, number, color, glyphFunction);
+	if (generation != _glyphAtlas.GetGeneration())
+	{
+		layout = &_layoutCache.GetNumber(fontID, _glyphAtlas.GetGeneration(), number, color, glyphFunction);
 	}
 
-	SpriteRenderer::Draw(spriteList, fontInfo->Texture, matrix);
-	return true;
+	if (!UploadGlyphAtlas()) { return false; }
+	return DrawLayout(*layout, _atlasTexture, matrix);
 }
 
 /****************************************************************************
@@ -182,6 +228,246 @@ bool TextRenderer::Finalize()
 	FontLoader fontLoader;
 	if (!fontLoader.Finalize()     ) { return false; }
 	if (!SpriteRenderer::Finalize()) { return false; }
-	
+
+	_layoutCache.Clear();
+	_glyphAtlas.Finalize();
+	_atlasTexture.Resource = nullptr;
+	_atlasView.Release();
+	_retiredAtlasTextures.clear();
+	ReleaseSystemFonts();
 	return true;
-}
\ No newline at end of file
+}
+
+/****************************************************************************
+*							LoadSystemFont
+*************************************************************************//**
+*  @fn        int TextRenderer::LoadSystemFont(const std::wstring& faceName, int pixelHeight, bool isBold)
+*  @brief     Create the installed font for the glyph atlas
+*  @param[in] const std::wstring& faceName (e.g. L"Meiryo")
+*  @param[in] int pixelHeight (rasterized size. the drawn size is TextString::SizePerChar)
+*  @param[in] bool isBold
+*  @return @@int system font index (-1 : failed)
+*****************************************************************************/
+int TextRenderer::LoadSystemFont(const std::wstring& faceName, int pixelHeight, bool isBold)
+{
+	if (pixelHeight <= 0) { return -1; }
+	if (_glyphDC == nullptr)
+	{
+		_glyphDC = ::CreateCompatibleDC(nullptr);
+		if (_glyphDC == nullptr) { return -1; }
+	}
+
+	/*-------------------------------------------------------------------
+	-              Create font
+	---------------------------------------------------------------------*/
+	SystemFont font;
+	font.Handle = ::CreateFontW(-pixelHeight, 0, 0, 0, isBold ? FW_BOLD : FW_NORMAL, FALSE, FALSE, FALSE,
+		DEFAULT_CHARSET, OUT_TT_PRECIS, CLIP_DEFAULT_PRECIS, ANTIALIASED_QUALITY, DEFAULT_PITCH | FF_DONTCARE, faceName.c_str());
+	if (font.Handle == nullptr)
+	{
+		::OutputDebugString(L"Error!: The font could not be created.");
+		return -1;
+	}
+
+	TEXTMETRICW metrics = {};
+	::SelectObject(_glyphDC, font.Handle);
+	::GetTextMetricsW(_glyphDC, &metrics);
+	font.PixelHeight = pixelHeight;
+	font.Ascent      = metrics.tmAscent;
+	font.LineHeight  = (std::max)(1L, metrics.tmHeight);
+
+	_systemFonts.push_back(font);
+	return static_cast<int>(_systemFonts.size()) - 1;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*							DrawLayout
+*************************************************************************//**
+*  @fn        bool TextRenderer::DrawLayout(const TextLayout& layout, const Texture& texture, const gm::Matrix4& matrix)
+*  @brief     Copy the ready made vertices into the sprite vertex buffer
+*  @param[in] const TextLayout& layout
+*  @param[in] const Texture& texture
+*  @param[in] const gm::Matrix4& matrix
+*  @return @@bool
+*****************************************************************************/
+bool TextRenderer::DrawLayout(const TextLayout& layout, const Texture& texture, const Matrix4& matrix)
+{
+	const int charCount = layout.GetCharCount();
+	if (charCount == 0) { return true; }
+
+	int writableSpriteCount = 0;
+	VertexPositionNormalColorTexture* vertices = BeginVertexWrite(writableSpriteCount, charCount);
+	if (vertices == nullptr) { return false; }
+
+	SpriteBatcher::CopyVertices(vertices, layout.DrawVertices.data(), layout.DrawVertices.size() * sizeof(VertexPositionNormalColorTexture));
+	return EndVertexWrite(charCount, texture, matrix);
+}
+
+/****************************************************************************
+*							GetSystemGlyph
+*************************************************************************//**
+*  @fn        bool TextRenderer::GetSystemGlyph(int systemFontIndex, wchar_t character, TextGlyph& outGlyph)
+*  @brief     Find the glyph in the atlas, or rasterize it (GetGlyphOutline) and add it to the atlas
+*  @param[in] int systemFontIndex
+*  @param[in] wchar_t character
+*  @param[out]TextGlyph& outGlyph
+*  @return @@bool (false : the character is not drawn)
+*****************************************************************************/
+bool TextRenderer::GetSystemGlyph(int systemFontIndex, wchar_t character, TextGlyph& outGlyph)
+{
+	const SystemFont& font = _systemFonts[systemFontIndex];
+	const GlyphRect*  rect = _glyphAtlas.Find(systemFontIndex, character);
+
+	if (rect == nullptr)
+	{
+		/*-------------------------------------------------------------------
+		-              Rasterize (8 bit gray, 0 - 64)
+		---------------------------------------------------------------------*/
+		const MAT2   identity = { {0, 1}, {0, 0}, {0, 0}, {0, 1} };
+		GLYPHMETRICS metrics  = {};
+		::SelectObject(_glyphDC, font.Handle);
+		const DWORD size = ::GetGlyphOutlineW(_glyphDC, character, GGO_GRAY8_BITMAP, &metrics, 0, nullptr, &identity);
+		if (size == GDI_ERROR) { return false; }
+
+		GlyphCoverage coverage;
+		if (size > 0)
+		{
+			_glyphBuffer.resize(size);
+			if (::GetGlyphOutlineW(_glyphDC, character, GGO_GRAY8_BITMAP, &metrics, size, _glyphBuffer.data(), &identity) == GDI_ERROR) { return false; }
+			coverage.Pixels = _glyphBuffer.data();
+		}
+		coverage.Pitch    = (static_cast<int>(metrics.gmBlackBoxX) + 3) & ~3; // DWORD aligned rows
+		coverage.Width    = static_cast<int>(metrics.gmBlackBoxX);
+		coverage.Height   = static_cast<int>(metrics.gmBlackBoxY);
+		coverage.OffsetX  = metrics.gmptGlyphOrigin.x;
+		coverage.OffsetY  = font.Ascent - metrics.gmptGlyphOrigin.y;
+		coverage.MaxValue = 64;
+
+		rect = _glyphAtlas.Insert(systemFontIndex, character, (std::max)(1, (int)metrics.gmCellIncX), font.LineHeight, coverage);
+		if (rect == nullptr) { return false; }
+	}
+
+	/*-------------------------------------------------------------------
+	-              Glyph uv
+	---------------------------------------------------------------------*/
+	const float width  = static_cast<float>(_glyphAtlas.GetWidth());
+	const float height = static_cast<float>(_glyphAtlas.GetHeight());
+	outGlyph.U          = Float2(rect->X / width , (rect->X + rect->Width ) / width);
+	outGlyph.V          = Float2(rect->Y / height, (rect->Y + rect->Height) / height);
+	outGlyph.WidthScale = static_cast<float>(rect->Width) / font.LineHeight;
+	return true;
+}
+
+/****************************************************************************
+*							UploadGlyphAtlas
+*************************************************************************//**
+*  @fn        bool TextRenderer::UploadGlyphAtlas()
+*  @brief     Write the modified rows of the atlas into the texture.
+*             Only the new cells are modified, which the GPU does not read yet.
+*             When the atlas is resized or cleared, a new texture is used and the old one is kept for the frames in flight.
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool TextRenderer::UploadGlyphAtlas()
+{
+	if (!_glyphAtlas.HasDirtyRows()) { return true; }
+
+	if (_atlasTexture.Resource == nullptr || _atlasTextureGeneration != _glyphAtlas.GetGeneration())
+	{
+		return CreateAtlasTexture(); // writes all rows
+	}
+
+	/*-------------------------------------------------------------------
+	-              Write the rows
+	---------------------------------------------------------------------*/
+	const int rowBegin = _glyphAtlas.GetDirtyRowBegin();
+	const int rowEnd   = _glyphAtlas.GetDirtyRowEnd();
+	const UINT rowPitch = static_cast<UINT>(_glyphAtlas.GetWidth() * sizeof(std::uint32_t));
+	D3D12_BOX box = { 0, (UINT)rowBegin, 0, (UINT)_glyphAtlas.GetWidth(), (UINT)rowEnd, 1 };
+	ThrowIfFailed(_atlasTexture.Resource->WriteToSubresource(0, &box,
+		_glyphAtlas.GetPixels() + static_cast<size_t>(rowBegin) * _glyphAtlas.GetWidth(),
+		rowPitch, rowPitch * (rowEnd - rowBegin)));
+
+	_glyphAtlas.ClearDirtyRows();
+	return true;
+}
+
+/****************************************************************************
+*							CreateAtlasTexture
+*************************************************************************//**
+*  @fn        bool TextRenderer::CreateAtlasTexture()
+*  @brief     Create the CPU writable (custom heap) texture of the atlas size and its SRV
+*  @param[in] void
+*  @return @@bool
+*****************************************************************************/
+bool TextRenderer::CreateAtlasTexture()
+{
+	DirectX12& directX12 = DirectX12::Instance();
+	if (_atlasTexture.Resource != nullptr)
+	{
+		_retiredAtlasTextures.emplace_back(directX12.GetFrameCount(), _atlasTexture.Resource);
+	}
+
+	/*-------------------------------------------------------------------
+	-              Create texture (written by WriteToSubresource)
+	---------------------------------------------------------------------*/
+	D3D12_HEAP_PROPERTIES heapProperty = {};
+	heapProperty.Type                 = D3D12_HEAP_TYPE_CUSTOM;
+	heapProperty.MemoryPoolPreference = D3D12_MEMORY_POOL_L0;
+	heapProperty.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_WRITE_BACK;
+	heapProperty.CreationNodeMask     = 0;
+	heapProperty.VisibleNodeMask      = 0;
+	D3D12_RESOURCE_DESC resourceDesc = RESOURCE_DESC::Texture2D(DXGI_FORMAT_R8G8B8A8_UNORM, (UINT64)_glyphAtlas.GetWidth(), (UINT)_glyphAtlas.GetHeight(), 1, 1);
+
+	ResourceComPtr resource = nullptr;
+	ThrowIfFailed(directX12.GetDevice()->CreateCommittedResource(
+		&heapProperty,
+		D3D12_HEAP_FLAG_NONE,
+		&resourceDesc,
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+		nullptr,
+		IID_PPV_ARGS(resource.ReleaseAndGetAddressOf())));
+	ThrowIfFailed(resource->Map(0, nullptr, nullptr)); // WriteToSubresource needs the mapped subresource
+	resource->SetName(L"TextRenderer::GlyphAtlas");
+
+	/*-------------------------------------------------------------------
+	-              Create SRV
+	---------------------------------------------------------------------*/
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format                        = DXGI_FORMAT_R8G8B8A8_UNORM;
+	srvDesc.Shader4ComponentMapping       = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.ViewDimension                 = D3D12_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Texture2D.MipLevels           = 1;
+	srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
+	if (!_atlasView.Issue(HeapType::SRV)) { return false; }
+	const UINT viewID = _atlasView.GetIndex();
+	directX12.GetDevice()->CreateShaderResourceView(resource.Get(), &srvDesc, directX12.GetCPUResourceView(HeapType::SRV, viewID));
+
+	_atlasTexture.Resource   = resource;
+	_atlasTexture.Format     = DXGI_FORMAT_R8G8B8A8_UNORM;
+	_atlasTexture.GPUHandler = directX12.GetGPUResourceView(HeapType::SRV, viewID);
+	_atlasTexture.ImageSize  = Float2((float)_glyphAtlas.GetWidth(), (float)_glyphAtlas.GetHeight());
+	_atlasTextureGeneration  = _glyphAtlas.GetGeneration();
+
+	/*-------------------------------------------------------------------
+	-              The new texture needs all rows
+	---------------------------------------------------------------------*/
+	D3D12_BOX box = { 0, 0, 0, (UINT)_glyphAtlas.GetWidth(), (UINT)_glyphAtlas.GetHeight(), 1 };
+	const UINT rowPitch = static_cast<UINT>(_glyphAtlas.GetWidth() * sizeof(std::uint32_t));
+	ThrowIfFailed(resource->WriteToSubresource(0, &box, _glyphAtlas.GetPixels(), rowPitch, rowPitch * _glyphAtlas.GetHeight()));
+	_glyphAtlas.ClearDirtyRows();
+	return true;
+}
+
+void TextRenderer::ReleaseSystemFonts()
+{
+	for (SystemFont& font : _systemFonts)
+	{
+		if (font.Handle != nullptr) { ::DeleteObject(font.Handle); }
+	}
+	_systemFonts.clear();
+	if (_glyphDC != nullptr) { ::DeleteDC(_glyphDC); _glyphDC = nullptr; }
+}
+#pragma endregion Private Function
@@ -0,0 +1,383 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMBlockAllocator.hpp
+///             @brief  Lock free fixed size block allocator
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_BLOCK_ALLOCATOR_HPP
+#define GM_BLOCK_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMAlighedAllocator.hpp"
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define BLOCK_ALLOCATOR_NULL_INDEX (0xFFFFFFFFu)
+
+// live count / high water mark are only collected in the debug build (they are shared counters).
+#if defined(_DEBUG) && !defined(GM_BLOCK_ALLOCATOR_STATISTICS)
+#define GM_BLOCK_ALLOCATOR_STATISTICS
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			BlockAllocator
+	*************************************************************************//**
+	*  @class     BlockAllocator
+	*  @brief     Fixed size block allocator for the small objects shared by the worker threads.
+	*             Free blocks are kept in a lock free stack whose head is (tag << 32 | block index),
+	*             so the tag makes the compare exchange ABA safe. Memory grows by one page at a time
+	*             (pages are aligned to their size and released only in the destructor).
+	*             Each worker can keep a LocalCache to take / return blocks without touching the shared stack.
+	*             A mutex is taken only while a new page is allocated.
+	*****************************************************************************/
+	class BlockAllocator
+	{
+	public:
+		/****************************************************************************
+		*				  			LocalCache
+		*************************************************************************//**
+		*  @class     LocalCache
+		*  @brief     Per worker cache of free blocks. It must be used by one thread at a time,
+		*             and the cached blocks go back to the allocator when it is flushed or destroyed.
+		*****************************************************************************/
+		class LocalCache
+		{
+		public:
+			void Flush()
+			{
+				if (_count == 0) { return; }
+				_allocator->PushChain(_blocks, _count);
+				_count = 0;
+			}
+			int GetCachedCount() const { return _count; }
+
+			explicit LocalCache(BlockAllocator& allocator) : _allocator(&allocator) {}
+			LocalCache(const LocalCache&)            = delete;
+			LocalCache& operator=(const LocalCache&) = delete;
+			~LocalCache() { Flush(); }
+
+		private:
+			friend class BlockAllocator;
+			static constexpr int Capacity = 64;
+			BlockAllocator* _allocator = nullptr;
+			std::uint32_t   _blocks[Capacity];
+			int             _count = 0;
+		};
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* nullptr: maxBlockCount / maxPageCount is reached */
+		void* Allocate()
+		{
+			const std::uint32_t index = PopIndex();
+			if (index == BLOCK_ALLOCATOR_NULL_INDEX) { return nullptr; }
+			OnAllocate(1);
+			return GetBlockAddress(index);
+		}
+
+		void Free(void* ptr)
+		{
+			if (ptr == nullptr) { return; }
+			assert(Owns(ptr));
+			std::uint32_t index = GetBlockIndex(ptr);
+			PushChain(&index, 1);
+			OnFree(1);
+		}
+
+		void* Allocate(LocalCache& cache)
+		{
+			assert(cache._allocator == this);
+			if (cache._count == 0)
+			{
+				/*-------------------------------------------------------------------
+				-        Refill the half of the cache from the shared stack
+				---------------------------------------------------------------------*/
+				while (cache._count < LocalCache::Capacity / 2)
+				{
+					const std::uint32_t index = PopIndex();
+					if (index == BLOCK_ALLOCATOR_NULL_INDEX) { break; }
+					cache._blocks[cache._count++] = index;
+				}
+				if (cache._count == 0) { return nullptr; }
+			}
+			OnAllocate(1);
+			return GetBlockAddress(cache._blocks[--cache._count]);
+		}
+
+		void Free(LocalCache& cache, void* ptr)
+		{
+			if (ptr == nullptr) { return; }
+			assert(cache._allocator == this && Owns(ptr));
+			if (cache._count == LocalCache::Capacity)
+			{
+				/*-------------------------------------------------------------------
+				-        Return the upper half of the cache with one compare exchange
+				---------------------------------------------------------------------*/
+				const int half = LocalCache::Capacity / 2;
+				PushChain(&cache._blocks[half], LocalCache::Capacity - half);
+				cache._count = half;
+			}
+			cache._blocks[cache._count++] = GetBlockIndex(ptr);
+			OnFree(1);
+		}
+
+		bool Owns(const void* ptr) const
+		{
+			const unsigned char* page = reinterpret_cast<const unsigned char*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(static_cast<std::uintptr_t>(_pageByteSize) - 1));
+			const std::uint32_t  pageCount = _pageCount.load(std::memory_order_acquire);
+			for (std::uint32_t i = 0; i < pageCount; ++i)
+			{
+				if (_pages[i].load(std::memory_order_relaxed) != page) { continue; }
+				const std::size_t offset = static_cast<const unsigned char*>(ptr) - page;
+				return offset >= _blockOffset && (offset - _blockOffset) % _blockSize == 0
+					&& (offset - _blockOffset) / _blockSize < _blocksPerPage;
+			}
+			return false;
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		std::size_t   GetBlockSize    () const { return _blockSize; }
+		std::size_t   GetPageByteSize () const { return _pageByteSize; }
+		std::uint32_t GetBlocksPerPage() const { return _blocksPerPage; }
+		std::uint32_t GetPageCount    () const { return _pageCount.load(std::memory_order_acquire); }
+		std::size_t   GetCapacity     () const
+		{
+			const std::size_t capacity = static_cast<std::size_t>(GetPageCount()) * _blocksPerPage;
+			return capacity < _maxBlockCount ? capacity : _maxBlockCount;
+		}
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+		std::int64_t GetLiveCount    () const { return _liveCount    .load(std::memory_order_relaxed); }
+		std::int64_t GetHighWaterMark() const { return _highWaterMark.load(std::memory_order_relaxed); }
+#endif
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		/* blocksPerPage = 0: 64KB page. maxBlockCount = 0: no limit (up to maxPageCount pages) */
+		BlockAllocator(std::size_t blockSize, std::size_t blocksPerPage = 0, std::size_t maxBlockCount = 0, std::uint32_t maxPageCount = 4096, std::size_t alignment = 16)
+		{
+			assert(blockSize > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0);
+			_blockSize = (blockSize + alignment - 1) & ~(alignment - 1);
+
+			/*-------------------------------------------------------------------
+			-        Page layout: [PageHeader][next index x blocksPerPage][blocks]
+			---------------------------------------------------------------------*/
+			const std::size_t wantBytes = sizeof(PageHeader) + blocksPerPage * (sizeof(std::uint32_t) + _blockSize) + alignment;
+			_pageByteSize = 64 * 1024;
+			while (_pageByteSize < wantBytes || _pageByteSize < sizeof(PageHeader) + 8 * (sizeof(std::uint32_t) + _blockSize) + alignment)
+			{
+				_pageByteSize *= 2;
+			}
+
+			std::size_t count = (_pageByteSize - sizeof(PageHeader)) / (sizeof(std::uint32_t) + _blockSize);
+			for (;; --count)
+			{
+				const std::size_t offset = (sizeof(PageHeader) + count * sizeof(std::uint32_t) + alignment - 1) & ~(alignment - 1);
+				if (offset + count * _blockSize <= _pageByteSize) { _blockOffset = offset; break; }
+			}
+			_blocksPerPage = static_cast<std::uint32_t>(count);
+
+			/*-------------------------------------------------------------------
+			-        Every block index must fit in 32 bit (except the null index)
+			---------------------------------------------------------------------*/
+			const std::size_t indexLimit = (BLOCK_ALLOCATOR_NULL_INDEX - 1) / _blocksPerPage;
+			_maxPageCount  = static_cast<std::uint32_t>(maxPageCount < indexLimit ? maxPageCount : indexLimit);
+			_maxBlockCount = maxBlockCount != 0 ? maxBlockCount : static_cast<std::size_t>(_maxPageCount) * _blocksPerPage;
+			if (_maxBlockCount > static_cast<std::size_t>(_maxPageCount) * _blocksPerPage) { _maxBlockCount = static_cast<std::size_t>(_maxPageCount) * _blocksPerPage; }
+
+			_pages = std::make_unique<std::atomic<unsigned char*>[]>(_maxPageCount);
+			for (std::uint32_t i = 0; i < _maxPageCount; ++i) { _pages[i].store(nullptr, std::memory_order_relaxed); }
+			_head.store(BLOCK_ALLOCATOR_NULL_INDEX, std::memory_order_relaxed);
+		}
+
+		BlockAllocator(const BlockAllocator&)            = delete;
+		BlockAllocator& operator=(const BlockAllocator&) = delete;
+
+		~BlockAllocator()
+		{
+			const std::uint32_t pageCount = _pageCount.load(std::memory_order_acquire);
+			for (std::uint32_t i = 0; i < pageCount; ++i)
+			{
+				AlignedFreeInternal(_pages[i].load(std::memory_order_relaxed));
+			}
+		}
+
+	private:
+		struct PageHeader
+		{
+			BlockAllocator* Owner;
+			std::uint32_t   PageIndex;
+		};
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		unsigned char* GetPage(std::uint32_t index) const
+		{
+			return _pages[index / _blocksPerPage].load(std::memory_order_relaxed);
+		}
+
+		std::atomic<std::uint32_t>& GetNext(std::uint32_t index) const
+		{
+			return reinterpret_cast<std::atomic<std::uint32_t>*>(GetPage(index) + sizeof(PageHeader))[index % _blocksPerPage];
+		}
+
+		void* GetBlockAddress(std::uint32_t index) const
+		{
+			return GetPage(index) + _blockOffset + static_cast<std::size_t>(index % _blocksPerPage) * _blockSize;
+		}
+
+		std::uint32_t GetBlockIndex(const void* ptr) const
+		{
+			const unsigned char* page   = reinterpret_cast<const unsigned char*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(static_cast<std::uintptr_t>(_pageByteSize) - 1));
+			const PageHeader*    header = reinterpret_cast<const PageHeader*>(page);
+			assert(header->Owner == this);
+			return header->PageIndex * _blocksPerPage + static_cast<std::uint32_t>((static_cast<const unsigned char*>(ptr) - page - _blockOffset) / _blockSize);
+		}
+
+		/* pop one block index from the shared stack (allocate a new page when it is empty) */
+		std::uint32_t PopIndex()
+		{
+			const std::uint32_t index = TryPopIndex();
+			if (index != BLOCK_ALLOCATOR_NULL_INDEX) { return index; }
+
+			std::lock_guard<std::mutex> lock(_growMutex);
+			const std::uint32_t retryIndex = TryPopIndex(); // another thread may have added a page
+			if (retryIndex != BLOCK_ALLOCATOR_NULL_INDEX) { return retryIndex; }
+			return AddPage();
+		}
+
+		std::uint32_t TryPopIndex()
+		{
+			std::uint64_t head = _head.load(std::memory_order_acquire);
+			for (;;)
+			{
+				const std::uint32_t index = static_cast<std::uint32_t>(head);
+				if (index == BLOCK_ALLOCATOR_NULL_INDEX) { return BLOCK_ALLOCATOR_NULL_INDEX; }
+
+				/*-------------------------------------------------------------------
+				-   The next index may be stale when another thread took the block,
+				-   but then the tag has changed and the compare exchange fails.
+				---------------------------------------------------------------------*/
+				const std::uint32_t next    = GetNext(index).load(std::memory_order_relaxed);
+				const std::uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+				if (_head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) { return index; }
+			}
+		}
+
+		/* push indices[0] -> ... -> indices[count - 1] with one compare exchange */
+		void PushChain(const std::uint32_t* indices, int count)
+		{
+			for (int i = 0; i < count - 1; ++i)
+			{
+				GetNext(indices[i]).store(indices[i + 1], std::memory_order_relaxed);
+			}
+			PushLinkedChain(indices[0], GetNext(indices[count - 1]));
+		}
+
+		/* push the already linked chain first -> ... -> last (lastNext: the next index of the last block) */
+		void PushLinkedChain(std::uint32_t first, std::atomic<std::uint32_t>& lastNext)
+		{
+			std::uint64_t head = _head.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				lastNext.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+				const std::uint64_t newHead = (((head >> 32) + 1) << 32) | first;
+				if (_head.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed)) { return; }
+			}
+		}
+
+		/* allocate a page, push its blocks (except the first one) and return the first block. (called in _growMutex) */
+		std::uint32_t AddPage()
+		{
+			const std::uint32_t pageIndex  = _pageCount.load(std::memory_order_relaxed);
+			const std::size_t   firstBlock = static_cast<std::size_t>(pageIndex) * _blocksPerPage;
+			if (pageIndex >= _maxPageCount || firstBlock >= _maxBlockCount) { return BLOCK_ALLOCATOR_NULL_INDEX; }
+
+			unsigned char* page = static_cast<unsigned char*>(AlignedAllocInternal(_pageByteSize, static_cast<int>(_pageByteSize)));
+			if (page == nullptr) { return BLOCK_ALLOCATOR_NULL_INDEX; }
+
+			PageHeader* header = reinterpret_cast<PageHeader*>(page);
+			header->Owner      = this;
+			header->PageIndex  = pageIndex;
+
+			/*-------------------------------------------------------------------
+			-        Link the blocks of the new page
+			---------------------------------------------------------------------*/
+			const std::size_t   remain     = _maxBlockCount - firstBlock;
+			const std::uint32_t blockCount = static_cast<std::uint32_t>(remain < _blocksPerPage ? remain : _blocksPerPage);
+			const std::uint32_t base       = static_cast<std::uint32_t>(firstBlock);
+			std::atomic<std::uint32_t>* nexts = reinterpret_cast<std::atomic<std::uint32_t>*>(page + sizeof(PageHeader));
+			for (std::uint32_t i = 0; i < _blocksPerPage; ++i)
+			{
+				new (&nexts[i]) std::atomic<std::uint32_t>(i + 1 < blockCount ? base + i + 1 : BLOCK_ALLOCATOR_NULL_INDEX);
+			}
+
+			_pages[pageIndex].store(page, std::memory_order_release);
+			_pageCount.store(pageIndex + 1, std::memory_order_release);
+
+			/*-------------------------------------------------------------------
+			-        Publish block 1 .. blockCount - 1 (already linked)
+			---------------------------------------------------------------------*/
+			if (blockCount > 1) { PushLinkedChain(base + 1, nexts[blockCount - 1]); }
+			return base;
+		}
+
+		void OnAllocate(std::int64_t count)
+		{
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+			const std::int64_t live = _liveCount.fetch_add(count, std::memory_order_relaxed) + count;
+			std::int64_t highWater  = _highWaterMark.load(std::memory_order_relaxed);
+			while (live > highWater && !_highWaterMark.compare_exchange_weak(highWater, live, std::memory_order_relaxed)) {}
+#else
+			(void)count;
+#endif
+		}
+
+		void OnFree(std::int64_t count)
+		{
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+			_liveCount.fetch_sub(count, std::memory_order_relaxed);
+#else
+			(void)count;
+#endif
+		}
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		alignas(64) std::atomic<std::uint64_t> _head{ BLOCK_ALLOCATOR_NULL_INDEX }; // (tag << 32) | index
+		alignas(64) std::atomic<std::uint32_t> _pageCount{ 0 };
+		std::unique_ptr<std::atomic<unsigned char*>[]> _pages;
+		std::mutex    _growMutex;
+		std::size_t   _blockSize     = 0;
+		std::size_t   _blockOffset   = 0;
+		std::size_t   _pageByteSize  = 0;
+		std::size_t   _maxBlockCount = 0;
+		std::uint32_t _blocksPerPage = 0;
+		std::uint32_t _maxPageCount  = 0;
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+		std::atomic<std::int64_t> _liveCount     { 0 };
+		std::atomic<std::int64_t> _highWaterMark { 0 };
+#endif
+	};
+}
+#endif
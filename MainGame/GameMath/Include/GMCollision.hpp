@@ -12,7 +12,6 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMMatrix.hpp"
-#include <DirectXCollision.h>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -65,7 +64,7 @@ namespace gm
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		void __vectorcall Transform(BoundingSphere& Out, gm::Matrix4 M) const {};
+		void Transform(BoundingSphere& Out, gm::Matrix4 M) const {};
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -73,7 +72,7 @@ namespace gm
 		BoundingSphere() { Center = Float3(0.0f, 0.0f, 0.0f); Radius = 1.0f; }
 		BoundingSphere(const BoundingSphere&)            = default;
 		BoundingSphere& operator=(const BoundingSphere&) = default;
-		BoundingSphere(const BoundingSphere&&)           = default;
+		BoundingSphere(BoundingSphere&&)                 = default;
 
 		constexpr BoundingSphere(const Float3& center, float radius) :Center(center),Radius(radius){}
 	protected:
@@ -11,7 +11,10 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
+#include "GMRandomEngine.hpp"
 #include <random>
+#include <type_traits>
+#include <cstdint>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -43,6 +46,13 @@ namespace gm
 			return _uniformDist(_engine);
 		}
 
+		/* bulk version of GetRandomValue (float uses the SIMD fill of the engine) */
+		void Fill(T* out, size_t count)
+		{
+			if constexpr (std::is_same_v<T, float>) { _engine.Fill(out, count, _uniformDist.a(), _uniformDist.b()); }
+			else { for (size_t i = 0; i < count; ++i) { out[i] = _uniformDist(_engine); } }
+		}
+
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
@@ -51,20 +61,20 @@ namespace gm
 			_uniformDist = std::uniform_real_distribution<T>(min, max);
 		}
 
+		/* for the reproducible sequence (replay, test) */
+		void SetSeed(std::uint64_t seed, std::uint32_t streamIndex = 0) { _engine.Seed(seed, streamIndex); }
+		RandomEngine& GetEngine() { return _engine; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		Random()
 		{
-			std::mt19937 engine(_seed());
-			_engine      = engine;
 			_uniformDist = std::uniform_real_distribution<T>(0.0f, 1.0f);
 		}
 
 		Random(T min, T max)
 		{
-			std::mt19937 engine(_seed());
-			_engine      = engine;
 			_uniformDist = std::uniform_real_distribution<T>(min, max);
 		}
 		~Random() {};
@@ -77,8 +87,7 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		std::random_device _seed;
-		std::mt19937       _engine;
+		RandomEngine _engine;
 		std::uniform_real_distribution<T> _uniformDist;
 	};
 
@@ -96,7 +105,13 @@ namespace gm
 		*****************************************************************************/
 		int GetRandomValue()
 		{
-			return _uniformDist(_engine);
+			return _engine.NextInt(_min, _max);
+		}
+
+		/* bulk version of GetRandomValue */
+		void Fill(int* out, size_t count)
+		{
+			_engine.Fill(out, count, _min, _max);
 		}
 
 		/****************************************************************************
@@ -104,23 +119,19 @@ namespace gm
 		*****************************************************************************/
 		void SetRange(int min, int max)
 		{
-			_uniformDist = std::uniform_int_distribution<>(min, max);
+			_min = min; _max = max;
 		}
 
+		/* for the reproducible sequence (replay, test) */
+		void SetSeed(std::uint64_t seed, std::uint32_t streamIndex = 0) { _engine.Seed(seed, streamIndex); }
+		RandomEngine& GetEngine() { return _engine; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		RandomInt()
-		{
-			std::mt19937 engine(_seed());
-			_engine = engine;
-			_uniformDist = std::uniform_int_distribution<>(0, 1);
-		}
-		RandomInt(int min, int max)
+		RandomInt() = default;
+		RandomInt(int min, int max) : _min(min), _max(max)
 		{
-			std::mt19937 engine(_seed());
-			_engine = engine;
-			_uniformDist = std::uniform_int_distribution<int>(min, max);
 		}
 		~RandomInt() {};
 
@@ -132,9 +143,9 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		std::random_device _seed;
-		std::mt19937       _engine;
-		std::uniform_int_distribution<> _uniformDist;
+		RandomEngine _engine;
+		int _min = 0;
+		int _max = 1;
 	};
 
 
@@ -148,16 +159,13 @@ namespace gm
 	class Distribution
 	{
 	public:
+		/* for the reproducible sequence (replay, test) */
+		void SetSeed(std::uint64_t seed, std::uint32_t streamIndex = 0) { _engine.Seed(seed, streamIndex); }
 
-		Distribution()
-		{
-			std::mt19937 engine(_seed());
-			this->_engine = engine;
-		}
+		Distribution() = default;
 
 	protected:
-		std::random_device _seed;
-		std::mt19937       _engine;
+		RandomEngine _engine;
 
 	};
 
@@ -0,0 +1,545 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMFlatHashMap.hpp
+///             @brief  Open addressing hash map (control bytes + SSE2 group probing)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_FLAT_HASH_MAP_HPP
+#define GM_FLAT_HASH_MAP_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <string_view>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GM_FLAT_HASH_MAP_SSE2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	namespace flat_hash_map_detail
+	{
+		using ControlByte = std::int8_t;
+		constexpr ControlByte CONTROL_EMPTY   = -128; // 0b10000000
+		constexpr ControlByte CONTROL_DELETED = -2;   // 0b11111110
+		constexpr std::size_t GROUP_WIDTH     = 16;   // full slot: 0b0xxxxxxx (lower 7 bits of the hash)
+
+		inline std::uint32_t CountTrailingZeros(std::uint32_t value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanForward(&index, value);
+			return static_cast<std::uint32_t>(index);
+#else
+			return static_cast<std::uint32_t>(__builtin_ctz(value));
+#endif
+		}
+
+		/* finalizer of splitmix64 (spreads the bits so that both H1 and H2 are usable) */
+		inline std::uint64_t Mix(std::uint64_t value)
+		{
+			value ^= value >> 30; value *= 0xBF58476D1CE4E5B9ull;
+			value ^= value >> 27; value *= 0x94D049BB133111EBull;
+			value ^= value >> 31;
+			return value;
+		}
+
+		/* 8 bytes per step (the tail is zero padded), the length is mixed first */
+		inline std::uint64_t HashBytes(const void* data, std::size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			std::uint64_t hash = 14695981039346656037ull ^ size;
+			for (; size >= 8; bytes += 8, size -= 8)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes, 8);
+				hash  = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+				hash ^= hash >> 32;
+			}
+			if (size > 0)
+			{
+				std::uint64_t word = 0;
+				std::memcpy(&word, bytes, size);
+				hash  = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+				hash ^= hash >> 32;
+			}
+			return Mix(hash);
+		}
+
+		/****************************************************************************
+		*				  			Group
+		*************************************************************************//**
+		*  @struct    Group
+		*  @brief     16 control bytes compared at once. Each Match returns the slot bit mask.
+		*****************************************************************************/
+		struct Group
+		{
+#ifdef GM_FLAT_HASH_MAP_SSE2
+			__m128i Control;
+			explicit Group(const ControlByte* control) : Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+			std::uint32_t Match(ControlByte h2) const { return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), Control))); }
+			std::uint32_t MatchEmpty() const          { return Match(CONTROL_EMPTY); }
+			std::uint32_t MatchEmptyOrDeleted() const { return static_cast<std::uint32_t>(_mm_movemask_epi8(Control)); } // sign bit = not full
+#else
+			ControlByte Control[GROUP_WIDTH];
+			explicit Group(const ControlByte* control) { std::memcpy(Control, control, GROUP_WIDTH); }
+
+			std::uint32_t Match(ControlByte h2) const
+			{
+				std::uint32_t mask = 0;
+				for (std::uint32_t i = 0; i < GROUP_WIDTH; ++i) { if (Control[i] == h2) { mask |= 1u << i; } }
+				return mask;
+			}
+			std::uint32_t MatchEmpty() const { return Match(CONTROL_EMPTY); }
+			std::uint32_t MatchEmptyOrDeleted() const
+			{
+				std::uint32_t mask = 0;
+				for (std::uint32_t i = 0; i < GROUP_WIDTH; ++i) { if (Control[i] < 0) { mask |= 1u << i; } }
+				return mask;
+			}
+#endif
+		};
+	}
+
+	/****************************************************************************
+	*				  			FlatHash
+	*************************************************************************//**
+	*  @struct    FlatHash
+	*  @brief     Default hasher of FlatHashMap (std::hash + bit mixing).
+	*             The string version is transparent, so std::string keys can be
+	*             searched by std::string_view / const char* without allocation.
+	*****************************************************************************/
+	template<class Key>
+	struct FlatHash
+	{
+		std::uint64_t operator()(const Key& key) const
+		{
+			return flat_hash_map_detail::Mix(static_cast<std::uint64_t>(std::hash<Key>()(key)));
+		}
+	};
+
+	template<>
+	struct FlatHash<std::string>
+	{
+		using is_transparent = void;
+		std::uint64_t operator()(std::string_view key) const
+		{
+			return flat_hash_map_detail::HashBytes(key.data(), key.size());
+		}
+	};
+
+	/* resource paths (texture / model / motion / audio tables) */
+	template<>
+	struct FlatHash<std::wstring>
+	{
+		using is_transparent = void;
+		std::uint64_t operator()(std::wstring_view key) const
+		{
+			return flat_hash_map_detail::HashBytes(key.data(), key.size() * sizeof(wchar_t));
+		}
+	};
+
+	/****************************************************************************
+	*				  			FlatHashMap
+	*************************************************************************//**
+	*  @class     FlatHashMap
+	*  @brief     Swiss table style hash map. Key / value pairs are stored in one flat array
+	*             and 1 control byte per slot (empty / deleted / 7 bit hash) is probed 16 slots at once.
+	*             Find / Erase accept any key type which Hash and Equal accept (heterogeneous lookup).
+	*             With SetIncrementalRehash(true), growing keeps the old table and moves a few slots
+	*             on each insert / erase instead of rehashing everything at once.
+	*             Pointers to the values are invalidated by insertion.
+	*****************************************************************************/
+	template<class Key, class Value, class Hash = FlatHash<Key>, class Equal = std::equal_to<>>
+	class FlatHashMap
+	{
+		using ControlByte = flat_hash_map_detail::ControlByte;
+		using Group       = flat_hash_map_detail::Group;
+		using Slot        = std::pair<Key, Value>;
+		static constexpr std::size_t GROUP_WIDTH = flat_hash_map_detail::GROUP_WIDTH;
+		static constexpr std::size_t NOT_FOUND   = ~static_cast<std::size_t>(0);
+
+		struct Table
+		{
+			ControlByte* Control    = nullptr;
+			Slot*        Slots      = nullptr;
+			std::size_t  Capacity   = 0; // power of two (multiple of GROUP_WIDTH)
+			std::size_t  Size       = 0;
+			std::size_t  GrowthLeft = 0; // empty slots which can be used before the next rehash
+		};
+
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* insert the value constructed by args if the key does not exist. (second = true: inserted) */
+		template<class K, class... Args>
+		std::pair<Value*, bool> TryEmplace(K&& key, Args&&... args)
+		{
+			const std::uint64_t hash = _hash(key);
+			Slot* found = FindSlot(key, hash);
+			if (found != nullptr) { return { &found->second, false }; }
+
+			StepRehash();
+			const std::size_t index = PrepareInsert(hash);
+			Slot* slot = new (&_table.Slots[index]) Slot(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { &slot->second, true };
+		}
+
+		template<class K, class V>
+		Value& InsertOrAssign(K&& key, V&& value)
+		{
+			std::pair<Value*, bool> result = TryEmplace(std::forward<K>(key), std::forward<V>(value));
+			if (!result.second) { *result.first = std::forward<V>(value); }
+			return *result.first;
+		}
+
+		template<class K>
+		Value& operator[](K&& key) { return *TryEmplace(std::forward<K>(key)).first; }
+
+		template<class K>
+		Value* Find(const K& key)
+		{
+			Slot* slot = FindSlot(key, _hash(key));
+			return slot != nullptr ? &slot->second : nullptr;
+		}
+
+		template<class K>
+		const Value* Find(const K& key) const { return const_cast<FlatHashMap*>(this)->Find(key); }
+
+		template<class K>
+		bool Contains(const K& key) const { return Find(key) != nullptr; }
+
+		template<class K>
+		bool Erase(const K& key)
+		{
+			const std::uint64_t hash = _hash(key);
+			bool erased = EraseFrom(_table, key, hash);
+			if (!erased && _old.Capacity != 0) { erased = EraseFrom(_old, key, hash); }
+			if (erased) { StepRehash(); }
+			return erased;
+		}
+
+		void Clear()
+		{
+			DestroyTable(_old);
+			if (_table.Capacity == 0) { return; }
+			for (std::size_t i = 0; i < _table.Capacity; ++i)
+			{
+				if (_table.Control[i] >= 0) { _table.Slots[i].~Slot(); }
+			}
+			std::memset(_table.Control, flat_hash_map_detail::CONTROL_EMPTY, _table.Capacity);
+			_table.Size       = 0;
+			_table.GrowthLeft = MaxLoad(_table.Capacity);
+		}
+
+		/* make room for count elements without rehash */
+		void Reserve(std::size_t count)
+		{
+			if (count <= _table.Size + _old.Size + _table.GrowthLeft) { return; }
+			FinishRehash();
+			Resize(CapacityFor(count));
+		}
+
+		/* func(const Key&, Value&) */
+		template<class Function>
+		void ForEach(Function&& function)
+		{
+			ForEachIn(_table, function);
+			ForEachIn(_old  , function);
+		}
+
+		template<class Function>
+		void ForEach(Function&& function) const { const_cast<FlatHashMap*>(this)->ForEach([&](const Key& key, Value& value) { function(key, static_cast<const Value&>(value)); }); }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		std::size_t Size       () const { return _table.Size + _old.Size; }
+		bool        IsEmpty    () const { return Size() == 0; }
+		std::size_t GetCapacity() const { return _table.Capacity; }
+		bool        IsRehashing() const { return _old.Capacity != 0; }
+
+		/* stepCount: slots of the old table moved by each insert / erase */
+		void SetIncrementalRehash(bool enable, std::size_t stepCount = 64)
+		{
+			_useIncrementalRehash = enable;
+			_rehashStepCount      = stepCount == 0 ? 1 : stepCount;
+			if (!enable) { FinishRehash(); }
+		}
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		FlatHashMap() = default;
+		FlatHashMap(const FlatHashMap& other) : _useIncrementalRehash(other._useIncrementalRehash), _rehashStepCount(other._rehashStepCount), _hash(other._hash), _equal(other._equal)
+		{
+			Reserve(other.Size());
+			other.ForEach([&](const Key& key, const Value& value) { TryEmplace(key, value); });
+		}
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other) { FlatHashMap copy(other); Swap(copy); }
+			return *this;
+		}
+		FlatHashMap(FlatHashMap&& other) noexcept { Swap(other); }
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other) { DestroyTable(_table); DestroyTable(_old); Swap(other); }
+			return *this;
+		}
+		~FlatHashMap()
+		{
+			DestroyTable(_table);
+			DestroyTable(_old);
+		}
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		static std::size_t MaxLoad(std::size_t capacity) { return capacity - capacity / 8; } // 7 / 8
+		static ControlByte H2(std::uint64_t hash) { return static_cast<ControlByte>(hash & 0x7F); }
+		static std::size_t H1(std::uint64_t hash) { return static_cast<std::size_t>(hash >> 7); }
+
+		static std::size_t CapacityFor(std::size_t count)
+		{
+			std::size_t capacity = GROUP_WIDTH;
+			while (MaxLoad(capacity) < count) { capacity *= 2; }
+			return capacity;
+		}
+
+		/* group index sequence: h1, h1 + 1, h1 + 3, h1 + 6 ... (visits every group once because the group count is a power of two) */
+		template<class K>
+		std::size_t FindIndex(const Table& table, const K& key, std::uint64_t hash) const
+		{
+			if (table.Capacity == 0) { return NOT_FOUND; }
+			const std::size_t groupMask = table.Capacity / GROUP_WIDTH - 1;
+			const ControlByte h2        = H2(hash);
+			std::size_t group = H1(hash) & groupMask;
+
+			for (std::size_t step = 1; step <= groupMask + 1; ++step)
+			{
+				const std::size_t first = group * GROUP_WIDTH;
+				const Group g(table.Control + first);
+				for (std::uint32_t match = g.Match(h2); match != 0; match &= match - 1)
+				{
+					const std::size_t index = first + flat_hash_map_detail::CountTrailingZeros(match);
+					if (_equal(table.Slots[index].first, key)) { return index; }
+				}
+				if (g.MatchEmpty() != 0) { return NOT_FOUND; }
+				group = (group + step) & groupMask;
+			}
+			return NOT_FOUND;
+		}
+
+		template<class K>
+		Slot* FindSlot(const K& key, std::uint64_t hash)
+		{
+			std::size_t index = FindIndex(_table, key, hash);
+			if (index != NOT_FOUND) { return &_table.Slots[index]; }
+			if (_old.Capacity == 0) { return nullptr; }
+			index = FindIndex(_old, key, hash);
+			return index != NOT_FOUND ? &_old.Slots[index] : nullptr;
+		}
+
+		static std::size_t FindFirstNonFull(const Table& table, std::uint64_t hash)
+		{
+			const std::size_t groupMask = table.Capacity / GROUP_WIDTH - 1;
+			std::size_t group = H1(hash) & groupMask;
+			for (std::size_t step = 1;; ++step)
+			{
+				const std::uint32_t mask = Group(table.Control + group * GROUP_WIDTH).MatchEmptyOrDeleted();
+				if (mask != 0) { return group * GROUP_WIDTH + flat_hash_map_detail::CountTrailingZeros(mask); }
+				group = (group + step) & groupMask;
+			}
+		}
+
+		/* return the slot index for the new key (the control byte is already set) */
+		std::size_t PrepareInsert(std::uint64_t hash)
+		{
+			std::size_t index = _table.Capacity != 0 ? FindFirstNonFull(_table, hash) : NOT_FOUND;
+			if (index == NOT_FOUND || (_table.GrowthLeft == 0 && _table.Control[index] != flat_hash_map_detail::CONTROL_DELETED))
+			{
+				Grow();
+				index = FindFirstNonFull(_table, hash);
+			}
+			if (_table.Control[index] == flat_hash_map_detail::CONTROL_EMPTY) { _table.GrowthLeft--; }
+			_table.Control[index] = H2(hash);
+			_table.Size++;
+			return index;
+		}
+
+		template<class K>
+		bool EraseFrom(Table& table, const K& key, std::uint64_t hash)
+		{
+			const std::size_t index = FindIndex(table, key, hash);
+			if (index == NOT_FOUND) { return false; }
+
+			table.Slots[index].~Slot();
+			table.Size--;
+			/*-------------------------------------------------------------------
+			-   Probing always stops at a group with an empty slot,
+			-   so the slot can be empty again if its group already has one.
+			---------------------------------------------------------------------*/
+			const std::size_t first = index / GROUP_WIDTH * GROUP_WIDTH;
+			if (Group(table.Control + first).MatchEmpty() != 0)
+			{
+				table.Control[index] = flat_hash_map_detail::CONTROL_EMPTY;
+				table.GrowthLeft++;
+			}
+			else
+			{
+				table.Control[index] = flat_hash_map_detail::CONTROL_DELETED;
+			}
+			return true;
+		}
+
+		void Grow()
+		{
+			FinishRehash();
+			/*-------------------------------------------------------------------
+			-   Many deleted slots: rehash with the same capacity
+			---------------------------------------------------------------------*/
+			const std::size_t newCapacity = _table.Capacity == 0 ? GROUP_WIDTH
+				: (_table.Size * 2 <= MaxLoad(_table.Capacity) ? _table.Capacity : _table.Capacity * 2);
+
+			if (_useIncrementalRehash && _table.Size != 0)
+			{
+				_old           = _table;
+				_table         = CreateTable(newCapacity);
+				_rehashCursor  = 0;
+			}
+			else
+			{
+				Resize(newCapacity);
+			}
+		}
+
+		void Resize(std::size_t newCapacity)
+		{
+			Table old = _table;
+			_table = CreateTable(newCapacity);
+			MoveAll(old);
+		}
+
+		/* move up to _rehashStepCount slots of the old table */
+		void StepRehash()
+		{
+			if (_old.Capacity == 0) { return; }
+			for (std::size_t count = 0; count < _rehashStepCount && _rehashCursor < _old.Capacity; ++_rehashCursor)
+			{
+				if (_old.Control[_rehashCursor] < 0) { continue; }
+				MoveSlot(_old, _rehashCursor);
+				count++;
+			}
+			if (_rehashCursor == _old.Capacity) { DestroyTable(_old); }
+		}
+
+		void FinishRehash()
+		{
+			if (_old.Capacity == 0) { return; }
+			Table old = _old;
+			_old = Table();
+			MoveAll(old);
+		}
+
+		void MoveAll(Table& from)
+		{
+			for (std::size_t i = 0; i < from.Capacity; ++i)
+			{
+				if (from.Control[i] >= 0) { MoveSlot(from, i); }
+			}
+			DestroyTable(from);
+		}
+
+		/* the key never exists in _table and _table has room (its capacity covers both tables) */
+		void MoveSlot(Table& from, std::size_t index)
+		{
+			Slot& slot = from.Slots[index];
+			const std::uint64_t hash = _hash(slot.first);
+			const std::size_t   to   = FindFirstNonFull(_table, hash);
+			if (_table.Control[to] == flat_hash_map_detail::CONTROL_EMPTY) { _table.GrowthLeft--; }
+			_table.Control[to] = H2(hash);
+			_table.Size++;
+			new (&_table.Slots[to]) Slot(std::move(slot));
+
+			slot.~Slot();
+			from.Control[index] = flat_hash_map_detail::CONTROL_DELETED;
+			from.Size--;
+		}
+
+		static Table CreateTable(std::size_t capacity)
+		{
+			Table table;
+			table.Control    = std::allocator<ControlByte>().allocate(capacity);
+			table.Slots      = std::allocator<Slot>().allocate(capacity);
+			table.Capacity   = capacity;
+			table.GrowthLeft = MaxLoad(capacity);
+			std::memset(table.Control, flat_hash_map_detail::CONTROL_EMPTY, capacity);
+			return table;
+		}
+
+		static void DestroyTable(Table& table)
+		{
+			if (table.Capacity == 0) { return; }
+			for (std::size_t i = 0; i < table.Capacity; ++i)
+			{
+				if (table.Control[i] >= 0) { table.Slots[i].~Slot(); }
+			}
+			std::allocator<ControlByte>().deallocate(table.Control, table.Capacity);
+			std::allocator<Slot>()       .deallocate(table.Slots  , table.Capacity);
+			table = Table();
+		}
+
+		template<class Function>
+		static void ForEachIn(Table& table, Function& function)
+		{
+			for (std::size_t i = 0; i < table.Capacity; ++i)
+			{
+				if (table.Control[i] >= 0) { function(static_cast<const Key&>(table.Slots[i].first), table.Slots[i].second); }
+			}
+		}
+
+		void Swap(FlatHashMap& other) noexcept
+		{
+			std::swap(_table, other._table);
+			std::swap(_old  , other._old);
+			std::swap(_rehashCursor, other._rehashCursor);
+			std::swap(_useIncrementalRehash, other._useIncrementalRehash);
+			std::swap(_rehashStepCount, other._rehashStepCount);
+			std::swap(_hash , other._hash);
+			std::swap(_equal, other._equal);
+		}
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		Table       _table;
+		Table       _old;                 // previous table while the incremental rehash is running
+		std::size_t _rehashCursor = 0;
+		bool        _useIncrementalRehash = false;
+		std::size_t _rehashStepCount      = 64;
+		Hash        _hash;
+		Equal       _equal;
+	};
+}
+#endif
@@ -366,7 +366,7 @@ namespace gm
 
 			if (previous != BT_HASH_NULL)
 			{
-				btAssert(_next[previous] == lastPairIndex);
+				assert(_next[previous] == lastPairIndex);
 				_next[previous] = _next[lastPairIndex];
 			}
 			else
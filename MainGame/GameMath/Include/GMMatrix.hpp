@@ -13,6 +13,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMQuaternion.hpp"
+#include <cassert>
 
 
 #pragma warning(disable: 26812 26495)
@@ -34,7 +35,7 @@ namespace gm
 	*  @class     Float3x4
 	*  @brief     Float3x4 class
 	*****************************************************************************/
-	struct Float3x3 : public DirectX::XMFLOAT3X3
+	struct Float3x3 : public simd::Float3x3Data
 	{
 	public:
 		/****************************************************************************
@@ -50,11 +51,11 @@ namespace gm
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		Float3x3()         : XMFLOAT3X3() {};
-		Float3x3(float ix) : XMFLOAT3X3(ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
+		Float3x3()         : simd::Float3x3Data() {};
+		Float3x3(float ix) : simd::Float3x3Data(ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
 		Float3x3(float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22) 
-			               : XMFLOAT3X3(m00,m01,m02, m10, m11, m12, m20, m21, m22) {};
-		Float3x3(const XMFLOAT3X3& M)
+			               : simd::Float3x3Data(m00,m01,m02, m10, m11, m12, m20, m21, m22) {};
+		Float3x3(const simd::Float3x3Data& M)
 		{
 			this->_11 = M._11; this->_12 = M._12; this->_13 = M._13;
 			this->_21 = M._21; this->_22 = M._22; this->_23 = M._23;
@@ -66,7 +67,7 @@ namespace gm
 		Float3x3(Float3x3&&)                 = default;
 		Float3x3& operator=(Float3x3&&)      = default;
 
-		operator DirectX::XMMATRIX() const noexcept { return DirectX::XMLoadFloat3x3(this); }
+		operator simd::MatrixRegister() const noexcept { return simd::LoadFloat3x3(this); }
 		
 	private:
 		/****************************************************************************
@@ -85,7 +86,7 @@ namespace gm
 	*  @class     Float4x4
 	*  @brief     Float4x4 class 
 	*****************************************************************************/
-	struct Float3x4 : public DirectX::XMFLOAT3X4
+	struct Float3x4 : public simd::Float3x4Data
 	{
 		/****************************************************************************
 		**                Public Function
@@ -100,11 +101,11 @@ namespace gm
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		Float3x4()         : XMFLOAT3X4() {};
-		Float3x4(float ix) : XMFLOAT3X4(ix,ix,ix, ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
+		Float3x4()         : simd::Float3x4Data() {};
+		Float3x4(float ix) : simd::Float3x4Data(ix,ix,ix, ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
 		Float3x4(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33) 
-			               : XMFLOAT3X4(m00,m01,m02,m03, m10, m11, m12, m13, m20, m21, m22, m23) {};
-		Float3x4(const XMFLOAT3X4& M)
+			               : simd::Float3x4Data(m00,m01,m02,m03, m10, m11, m12, m13, m20, m21, m22, m23) {};
+		Float3x4(const simd::Float3x4Data& M)
 		{
 			this->_11 = M._11; this->_12 = M._12; this->_13 = M._13; this->_14 = M._14;
 			this->_21 = M._21; this->_22 = M._22; this->_23 = M._23; this->_24 = M._24;
@@ -116,7 +117,7 @@ namespace gm
 		Float3x4(Float3x4&&)                 = default;
 		Float3x4& operator=(Float3x4&&)      = default;
 
-		operator DirectX::XMMATRIX() const noexcept { return DirectX::XMLoadFloat3x4(this); }
+		operator simd::MatrixRegister() const noexcept { return simd::LoadFloat3x4(this); }
 
 	private:
 		/****************************************************************************
@@ -135,7 +136,7 @@ namespace gm
 	*  @class     Float4x4
 	*  @brief     Float4x4 class 
 	*****************************************************************************/
-	struct Float4x4 : public DirectX::XMFLOAT4X4
+	struct Float4x4 : public simd::Float4x4Data
 	{
 		/****************************************************************************
 		**                Public Function
@@ -150,11 +151,11 @@ namespace gm
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		INLINE Float4x4()         : XMFLOAT4X4() {};
-		INLINE Float4x4(float ix) : XMFLOAT4X4(ix,ix,ix,ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
+		INLINE Float4x4()         : simd::Float4x4Data() {};
+		INLINE Float4x4(float ix) : simd::Float4x4Data(ix,ix,ix,ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix, ix) {};
 		INLINE Float4x4(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33) 
-			               : XMFLOAT4X4(m00,m01,m02,m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33) {};
-		INLINE Float4x4(const XMFLOAT4X4& M)
+			               : simd::Float4x4Data(m00,m01,m02,m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33) {};
+		INLINE Float4x4(const simd::Float4x4Data& M)
 		{
 			this->_11 = M._11; this->_12 = M._12; this->_13 = M._13; this->_14 = M._14;
 			this->_21 = M._21; this->_22 = M._22; this->_23 = M._23; this->_24 = M._24;
@@ -166,7 +167,7 @@ namespace gm
 		INLINE Float4x4(Float4x4&&)                 = default;
 		INLINE Float4x4& operator=(Float4x4&&)      = default;
 
-		operator DirectX::XMMATRIX() const noexcept { return DirectX::XMLoadFloat4x4(this); }
+		operator simd::MatrixRegister() const noexcept { return simd::LoadFloat4x4(this); }
 
 	private:
 		/****************************************************************************
@@ -187,19 +188,19 @@ namespace gm
 	*  @class     Matrix3
 	*  @brief     Matrix3X3 class (note! : 16 bytes (for 16 alignment))
 	*****************************************************************************/
-	__declspec(align(16))struct Matrix3
+	struct alignas(16) Matrix3
 	{
 	public:
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		static INLINE Matrix3 MakeXRotation(float angle)                { return Matrix3(DirectX::XMMatrixRotationX(angle)); }
-		static INLINE Matrix3 MakeYRotation(float angle)                { return Matrix3(DirectX::XMMatrixRotationY(angle)); }
-		static INLINE Matrix3 MakeZRotation(float angle)                { return Matrix3(DirectX::XMMatrixRotationZ(angle)); }
-		static INLINE Matrix3 MakeScale(float scale)                    { return Matrix3(DirectX::XMMatrixScaling(scale, scale, scale)); }
-		static INLINE Matrix3 MakeScale(float sx, float sy, float sz)   { return Matrix3(DirectX::XMMatrixScaling(sx, sy, sz)); }
-		static INLINE Matrix3 MakeScale(const DirectX::XMFLOAT3& scale) { return Matrix3(DirectX::XMMatrixScaling(scale.x, scale.y, scale.z)); }
-		static INLINE Matrix3 MakeScale(Vector3 scale)                  { return Matrix3(DirectX::XMMatrixScalingFromVector(scale)); }
+		static INLINE Matrix3 MakeXRotation(float angle)                { return Matrix3(simd::MatrixRotationX(angle)); }
+		static INLINE Matrix3 MakeYRotation(float angle)                { return Matrix3(simd::MatrixRotationY(angle)); }
+		static INLINE Matrix3 MakeZRotation(float angle)                { return Matrix3(simd::MatrixRotationZ(angle)); }
+		static INLINE Matrix3 MakeScale(float scale)                    { return Matrix3(simd::MatrixScaling(scale, scale, scale)); }
+		static INLINE Matrix3 MakeScale(float sx, float sy, float sz)   { return Matrix3(simd::MatrixScaling(sx, sy, sz)); }
+		static INLINE Matrix3 MakeScale(const simd::Float3Data& scale) { return Matrix3(simd::MatrixScaling(scale.x, scale.y, scale.z)); }
+		static INLINE Matrix3 MakeScale(Vector3 scale)                  { return Matrix3(simd::MatrixScalingFromVector(scale)); }
 
 		/****************************************************************************
 		**                Public Member Variables
@@ -215,10 +216,10 @@ namespace gm
 		INLINE Vector3 GetRow(int i) const { return _matrix[i]; }
 		INLINE Vector3 GetColumn(int i) const { return Vector3(_matrix[0].GetElement(i), _matrix[1].GetElement(i), _matrix[2].GetElement(i)); }
 		INLINE Scalar  GetElement(int row, int column) const { return _matrix[row].GetElement(column); }
-		INLINE operator DirectX::XMMATRIX() const { return DirectX::XMMATRIX(_matrix[0], _matrix[1], _matrix[2], DirectX::XMVectorZero()); }
+		INLINE operator simd::MatrixRegister() const { return simd::MatrixSet(_matrix[0], _matrix[1], _matrix[2], simd::VectorZero()); }
 
 		INLINE Matrix3 operator* (Scalar scl)         const { return Matrix3(scl * GetX(), scl * GetY(), scl * GetZ()); }
-		INLINE Vector3 operator* (Vector3 vec)        const { return Vector3(DirectX::XMVector3TransformNormal(vec, *this)); }
+		INLINE Vector3 operator* (Vector3 vec)        const { return Vector3(simd::Vector3TransformNormal(vec, *this)); }
 		INLINE Matrix3 operator* (const Matrix3& mat) const { return Matrix3(*this * mat.GetX(), *this * mat.GetY(), *this * mat.GetZ()); }
 
 		bool operator == (const Matrix3& M) const noexcept;
@@ -241,8 +242,8 @@ namespace gm
 		INLINE Matrix3() {}
 		INLINE Matrix3(Vector3 x, Vector3 y, Vector3 z)     { _matrix[0] = x; _matrix[1] = y; _matrix[2] = z; }
 		INLINE Matrix3(const Matrix3& m)                    { _matrix[0] = m._matrix[0]; _matrix[1] = m._matrix[1]; _matrix[2] = m._matrix[2]; }
-		INLINE Matrix3(Quaternion q)                        { *this = Matrix3(DirectX::XMMatrixRotationQuaternion(q)); }
-		INLINE explicit Matrix3(const DirectX::XMMATRIX& m) { _matrix[0] = Vector3(m.r[0]); _matrix[1] = Vector3(m.r[1]); _matrix[2] = Vector3(m.r[2]); }
+		INLINE Matrix3(Quaternion q)                        { *this = Matrix3(simd::MatrixRotationQuaternion(q)); }
+		INLINE explicit Matrix3(const simd::MatrixRegister& m) { _matrix[0] = Vector3(m.r[0]); _matrix[1] = Vector3(m.r[1]); _matrix[2] = Vector3(m.r[2]); }
 		INLINE explicit Matrix3(EIdentityTag)               { _matrix[0] = Vector3(kXUnitVector); _matrix[1] = Vector3(kYUnitVector); _matrix[2] = Vector3(kZUnitVector); }
 		INLINE explicit Matrix3(EZeroTag)                   { _matrix[0] = _matrix[1] = _matrix[2] = Vector3(kZero); }
 	
@@ -265,7 +266,7 @@ namespace gm
 	*  @class     Matrix4
 	*  @brief     Matrix4X4 class (note! : 16 bytes (for 16 alignment))
 	*****************************************************************************/
-	__declspec(align(16))struct Matrix4
+	struct alignas(16) Matrix4
 	{
 	public:
 		/****************************************************************************
@@ -298,14 +299,14 @@ namespace gm
 		INLINE Float4x4 ToFloat4x4()
 		{
 			Float4x4 value;
-			DirectX::XMStoreFloat4x4(&value, _matrix);
+			simd::StoreFloat4x4(&value, _matrix);
 			return value;
 		}
 
 
-		INLINE Vector4 operator* (Vector3 vec) const        { return Vector4(DirectX::XMVector3Transform(vec, _matrix)); }
-		INLINE Vector4 operator* (Vector4 vec) const        { return Vector4(DirectX::XMVector4Transform(vec, _matrix)); }
-		INLINE Matrix4 operator* (const Matrix4& mat) const { return Matrix4(DirectX::XMMatrixMultiply(_matrix, mat)); }
+		INLINE Vector4 operator* (Vector3 vec) const        { return Vector4(simd::Vector3Transform(vec, _matrix)); }
+		INLINE Vector4 operator* (Vector4 vec) const        { return Vector4(simd::Vector4Transform(vec, _matrix)); }
+		INLINE Matrix4 operator* (const Matrix4& mat) const { return Matrix4(simd::MatrixMultiply(_matrix, mat)); }
 
 		bool operator == (const Matrix4& M) const noexcept;
 		bool operator != (const Matrix4& M) const noexcept;
@@ -326,8 +327,8 @@ namespace gm
 			_matrix.r[0] = vector::SetWToZero(x); _matrix.r[1] = vector::SetWToZero(y);
 			_matrix.r[2] = vector::SetWToZero(z); _matrix.r[3] = vector::SetWToOne(w);
 		}
-		INLINE Matrix4(const Float4x4& mat) { _matrix = DirectX::XMLoadFloat4x4(&mat); }
-		INLINE Matrix4(const float* data){ _matrix = DirectX::XMLoadFloat4x4((DirectX::XMFLOAT4X4*)data);}
+		INLINE Matrix4(const Float4x4& mat) { _matrix = simd::LoadFloat4x4(&mat); }
+		INLINE Matrix4(const float* data){ _matrix = simd::LoadFloat4x4((simd::Float4x4Data*)data);}
 		INLINE Matrix4(Vector4 x, Vector4 y, Vector4 z, Vector4 w) { _matrix.r[0] = x; _matrix.r[1] = y; _matrix.r[2] = z; _matrix.r[3] = w; }
 		INLINE Matrix4(const Matrix3& mat)
 		{
@@ -344,10 +345,10 @@ namespace gm
 			_matrix.r[3] = vector::SetWToOne(w);
 		}
 
-		INLINE explicit Matrix4(const DirectX::XMMATRIX& mat) { _matrix = mat; }
-		INLINE explicit Matrix4(EIdentityTag)                 { _matrix = DirectX::XMMatrixIdentity(); }
+		INLINE explicit Matrix4(const simd::MatrixRegister& mat) { _matrix = mat; }
+		INLINE explicit Matrix4(EIdentityTag)                 { _matrix = simd::MatrixIdentity(); }
 		INLINE explicit Matrix4(EZeroTag)                     { _matrix.r[0] = _matrix.r[1] = _matrix.r[2] = _matrix.r[3] = vector::SplatZero(); }
-		INLINE operator DirectX::XMMATRIX() const             { return _matrix; }
+		INLINE operator simd::MatrixRegister() const             { return _matrix; }
 
 
 		INLINE Matrix4(const Matrix4&)            = default;
@@ -363,7 +364,7 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		DirectX::XMMATRIX _matrix;
+		simd::MatrixRegister _matrix;
 	};
 
 	INLINE Matrix3 HadamaldProduct(const Matrix3& a, const Matrix3& b)
@@ -375,8 +376,8 @@ namespace gm
 		return result;
 	}
 	INLINE Matrix3 Absolute(const Matrix3& mat) { return Matrix3(Abs(mat.GetX()), Abs(mat.GetY()), Abs(mat.GetZ())); }
-	INLINE Matrix3 Transpose(const Matrix3& mat) { return Matrix3(DirectX::XMMatrixTranspose(mat)); }
-	INLINE Matrix3 InverseMatrix3(const Matrix3& mat) { Matrix4 m(mat);  return Matrix4(DirectX::XMMatrixInverse(nullptr, m)).Get3x3(); }
+	INLINE Matrix3 Transpose(const Matrix3& mat) { return Matrix3(simd::MatrixTranspose(mat)); }
+	INLINE Matrix3 InverseMatrix3(const Matrix3& mat) { Matrix4 m(mat);  return Matrix4(simd::MatrixInverse(nullptr, m)).Get3x3(); }
 	INLINE Matrix3 InverseTranspose(const Matrix3& mat)
 	{
 		const Vector3 x = mat.GetX();
@@ -391,9 +392,9 @@ namespace gm
 		// Return the adjoint / determinant
 		return Matrix3(inv0, inv1, inv2) * rDet;
 	}
-	INLINE Matrix3 Matrix3Identity() { return Matrix3(DirectX::XMMatrixIdentity()); }
-	INLINE Matrix3 ScalingMatrix3(const Vector3& scale) { return Matrix3(DirectX::XMMatrixScalingFromVector(scale)); }
-	INLINE Matrix3 RotationQuaternionMatrix3(const Quaternion& rotation) { return Matrix3(DirectX::XMMatrixRotationQuaternion(rotation)); }
+	INLINE Matrix3 Matrix3Identity() { return Matrix3(simd::MatrixIdentity()); }
+	INLINE Matrix3 ScalingMatrix3(const Vector3& scale) { return Matrix3(simd::MatrixScalingFromVector(scale)); }
+	INLINE Matrix3 RotationQuaternionMatrix3(const Quaternion& rotation) { return Matrix3(simd::MatrixRotationQuaternion(rotation)); }
 	INLINE Vector3 Solve33(const Vector3& b, const Matrix3& matrix) 
 	{
 		Vector3 column1 = matrix.GetColumn(0);
@@ -416,10 +417,10 @@ namespace gm
 	}
 	INLINE void GetSkewSymmetricMatrix3(const Vector3& input, Vector3* v0, Vector3* v1, Vector3* v2) { *v0 = Vector3(0.0f, -input.GetZ(), input.GetY()); *v1 = Vector3(input.GetZ(), 0.0f, -input.GetX()); *v2 = Vector3(-input.GetY(), input.GetX(), 0.0f); }
 
-	INLINE Scalar  Determinant(const Matrix4& matrix) { return Scalar(DirectX::XMMatrixDeterminant(matrix)); }
-	INLINE Matrix4 Transpose  (const Matrix4& matrix) { return Matrix4(DirectX::XMMatrixTranspose(matrix)); }
-	INLINE Matrix4 Inverse    (const Matrix4& matrix) { return Matrix4(DirectX::XMMatrixInverse(nullptr, matrix)); }
-	INLINE Matrix4 Inverse    (Vector4& determinant, const Matrix4& matrix) { return Matrix4(DirectX::XMMatrixInverse(determinant.VectorPtr(), matrix)); }
+	INLINE Scalar  Determinant(const Matrix4& matrix) { return Scalar(simd::MatrixDeterminant(matrix)); }
+	INLINE Matrix4 Transpose  (const Matrix4& matrix) { return Matrix4(simd::MatrixTranspose(matrix)); }
+	INLINE Matrix4 Inverse    (const Matrix4& matrix) { return Matrix4(simd::MatrixInverse(nullptr, matrix)); }
+	INLINE Matrix4 Inverse    (Vector4& determinant, const Matrix4& matrix) { return Matrix4(simd::MatrixInverse(determinant.VectorPtr(), matrix)); }
 	INLINE Matrix4 OrthoInvert(const Matrix4& xform)
 	{
 		Matrix3 basis     = Transpose(xform.Get3x3());
@@ -428,58 +429,58 @@ namespace gm
 	}
 	INLINE bool DecomposeSRT(const Matrix4& matrix, Vector3& scale, Quaternion& rotation, Vector3& transration)
 	{
-		DirectX::XMVECTOR s, r, t;
-		if (DirectX::XMMatrixDecompose(&s, &r, &t, matrix)) { return true; }
+		simd::VectorRegister s, r, t;
+		if (simd::MatrixDecompose(&s, &r, &t, matrix)) { return true; }
 		else { return false; }
 	}
 	
-	INLINE Matrix4  MatrixIdentity()   { return Matrix4(DirectX::XMMatrixIdentity()); }
-	INLINE Float4x4 MatrixIdentityF()  { return Matrix4(DirectX::XMMatrixIdentity()).ToFloat4x4(); }
-	INLINE Vector3 TransformVector3(Vector3& vector, Matrix4& matrix) { return Vector3(DirectX::XMVector3Transform(vector, matrix)); }
-	INLINE Vector3 TransformCoordinateVector3(Vector3& vector, Matrix4& matrix) { return Vector3(DirectX::XMVector3TransformCoord(vector, matrix)); }
-	INLINE Vector2 TransformNormal(const Vector2& v, const Matrix3& M) { return Vector2(DirectX::XMVector2TransformNormal(v, M)); }
-	INLINE Vector3 TransformNormal(const Vector3& v, const Matrix4& M) { return Vector3(DirectX::XMVector3TransformNormal(v, M)); }
-	INLINE Matrix4 Transform2D  (const Vector2& scaling, float rotation, const Vector2& translation, const Vector2& rotationOrigin = Vector2(0.0f, 0.0f))                 { return Matrix4(DirectX::XMMatrixAffineTransformation2D(scaling, rotationOrigin, rotation, translation)); }
-	INLINE Matrix4 Transform3D  (const Vector3& scaling, const Quaternion& rotation, const Vector3& translation, const Vector3& rotationOrigin = Vector3(0.0f, 0.0f, 0.0f)) { return Matrix4(DirectX::XMMatrixAffineTransformation(scaling, rotationOrigin, rotation, translation)); }
-	INLINE Matrix4 Transform3D  (const Matrix4& matrix, const Quaternion& rotation) { return matrix * Matrix4(DirectX::XMMatrixRotationQuaternion(rotation)); }
-	INLINE Matrix4 Translation            (const Float3& position)              { return Matrix4(DirectX::XMMatrixTranslationFromVector(position)); }
-	INLINE Matrix4 Translation            (const Vector3& position)             { return Matrix4(DirectX::XMMatrixTranslationFromVector(position)); }
-	INLINE Matrix4 Translation            (float x, float y, float z)           { return Matrix4(DirectX::XMMatrixTranslation(x, y, z)); };
-	INLINE Matrix4 Scaling                (float scale)                         { return Matrix4(DirectX::XMMatrixScaling(scale, scale, scale)); }
-	INLINE Matrix4 Scaling                (const Float3& scale)                 { return Matrix4(DirectX::XMMatrixScalingFromVector(scale)); }
-	INLINE Matrix4 Scaling                (const Vector3& scale)                { return Matrix4(DirectX::XMMatrixScalingFromVector(scale)); }
-	INLINE Matrix4 Scaling                (float sx, float sy, float sz)        { return Matrix4(DirectX::XMMatrixScaling(sx, sy, sz)); }
-	INLINE Matrix4 RotationX              (float radian)                        { return Matrix4(DirectX::XMMatrixRotationX(radian)); }
-	INLINE Matrix4 RotationY              (float radian)                        { return Matrix4(DirectX::XMMatrixRotationY(radian)); }
-	INLINE Matrix4 RotationZ              (float radian)                        { return Matrix4(DirectX::XMMatrixRotationZ(radian)); }
-	INLINE Matrix4 RotationQuaternion     (const Quaternion& rotation)          { return Matrix4(DirectX::XMMatrixRotationQuaternion(rotation)); }
-	INLINE Matrix4 RotationNormal         (const Vector3& normal, float radian) { return Matrix4(DirectX::XMMatrixRotationNormal(normal, radian)); }
-	INLINE Matrix4 RotationNormal         (const Float3& normal, float radian)  { return Matrix4(DirectX::XMMatrixRotationNormal(normal, radian)); }
-	INLINE Matrix4 RotationRollPitchYaw   (float roll, float pitch, float yaw)  { return Matrix4(DirectX::XMMatrixRotationRollPitchYaw(pitch, yaw, roll)); }
-	INLINE Matrix4 RotationRollPitchYaw   (const Vector3& rollPitchYaw)         { return Matrix4(DirectX::XMMatrixRotationRollPitchYaw(rollPitchYaw.GetY(), rollPitchYaw.GetZ(), rollPitchYaw.GetX())); }
-	INLINE Matrix4 RotationRollPitchYaw   (const Float3 & rollPitchYaw)         { Vector3 vector = Vector3(rollPitchYaw);  return Matrix4(DirectX::XMMatrixRotationRollPitchYaw(vector.GetY(), vector.GetZ(), vector.GetX())); }
-	INLINE Matrix4 RotationAxis           (const Float3 & axis, float radian)                                                                   { return Matrix4(DirectX::XMMatrixRotationAxis(axis, radian)); }
-	INLINE Matrix4 RotationAxis           (const Vector3& axis, float radian)                                                                   { return Matrix4(DirectX::XMMatrixRotationAxis(axis, radian)); }
-	INLINE Matrix4 LookAtLH               (const Vector3& eye, const Vector3& target,    const Vector3& up)                                     { return Matrix4(DirectX::XMMatrixLookAtLH(eye, target, up)); }
-	INLINE Matrix4 LookAtRH               (const Vector3& eye, const Vector3& target,    const Vector3& up)                                     { return Matrix4(DirectX::XMMatrixLookAtRH(eye, target, up)); }
-	INLINE Matrix4 LookAtLH               (const Float3 & eye, const Float3 & target,    const Float3 & up)                                     { return Matrix4(DirectX::XMMatrixLookAtLH(eye, target, up)); }
-	INLINE Matrix4 LookAtRH               (const Float3 & eye, const Float3 & target,    const Float3 & up)                                     { return Matrix4(DirectX::XMMatrixLookAtRH(eye, target, up)); }
-	INLINE Matrix4 LookToLH               (const Vector3& eye, const Vector3& direction, const Vector3& up)                                     { return Matrix4(DirectX::XMMatrixLookToLH(eye, direction, up)); }
-	INLINE Matrix4 LookToRH               (const Vector3& eye, const Vector3& direction, const Vector3& up)                                     { return Matrix4(DirectX::XMMatrixLookToRH(eye, direction, up)); }
-	INLINE Matrix4 LookToLH               (const Float3 & eye, const Float3 & direction, const Float3 & up)                                     { return Matrix4(DirectX::XMMatrixLookToLH(eye, direction, up)); }
-	INLINE Matrix4 LookToRH               (const Float3 & eye, const Float3 & direction, const Float3 & up)                                     { return Matrix4(DirectX::XMMatrixLookToRH(eye, direction, up)); }
-	INLINE Matrix4 PerspectiveLH          (float width, float height, float nearPlane, float farPlane)                                          { return Matrix4(DirectX::XMMatrixPerspectiveLH(width, height, nearPlane, farPlane)); }
-	INLINE Matrix4 PerspectiveRH          (float width, float height, float nearPlane, float farPlane)                                          { return Matrix4(DirectX::XMMatrixPerspectiveRH(width, height, nearPlane, farPlane)); }
-	INLINE Matrix4 PerspectiveFovLH       (float fov, float aspectRatio, float nearPlane, float farPlane)                                       { return Matrix4(DirectX::XMMatrixPerspectiveFovLH(fov, aspectRatio, nearPlane, farPlane)); }
-	INLINE Matrix4 PerspectiveFovRH       (float fov, float aspectRatio, float nearPlane, float farPlane)                                       { return Matrix4(DirectX::XMMatrixPerspectiveFovRH(fov, aspectRatio, nearPlane, farPlane)); }
-	INLINE Matrix4 PerspectiveOffCenterLH (float left, float right, float bottom, float top, float nearPlane, float farPlane)                   { return Matrix4(DirectX::XMMatrixPerspectiveOffCenterLH(left, right, bottom, top, nearPlane, farPlane)); }
-	INLINE Matrix4 PerspectiveOffCenterRH (float left, float right, float bottom, float top, float nearPlane, float farPlane)                   { return Matrix4(DirectX::XMMatrixPerspectiveOffCenterRH(left, right, bottom, top, nearPlane, farPlane)); }
-	INLINE Matrix4 OrthographicLH         (float viewWidth, float viewHeight, float zNearPlane, float zFarPlane)                                { return Matrix4(DirectX::XMMatrixOrthographicLH(viewWidth, viewHeight, zNearPlane, zFarPlane)); }
-	INLINE Matrix4 OrthographicRH         (float viewWidth, float viewHeight, float zNearPlane, float zFarPlane)                                { return Matrix4(DirectX::XMMatrixOrthographicRH(viewWidth, viewHeight, zNearPlane, zFarPlane)); }
-	INLINE Matrix4 OrthographicOffCenterLH(float viewLeft, float viewRight, float viewBottom, float viewTop, float zNearPlane, float zFarPlane) { return Matrix4(DirectX::XMMatrixOrthographicOffCenterLH(viewLeft, viewRight, viewBottom, viewTop, zNearPlane, zFarPlane)); }
-	INLINE Matrix4 OrthographicOffCenterRH(float viewLeft, float viewRight, float viewBottom, float viewTop, float zNearPlane, float zFarPlane) { return Matrix4(DirectX::XMMatrixOrthographicOffCenterRH(viewLeft, viewRight, viewBottom, viewTop, zNearPlane, zFarPlane)); }
-	INLINE Matrix4 Shadow                 (const Vector3& lightDirection, const Vector4& shadowPlane)                                           { return Matrix4(DirectX::XMMatrixShadow(shadowPlane, lightDirection)); }
-	INLINE Matrix4 Reflection             (const Vector4& reflectionPlane)                                                                      { return Matrix4(DirectX::XMMatrixReflect(reflectionPlane)); }
+	INLINE Matrix4  MatrixIdentity()   { return Matrix4(simd::MatrixIdentity()); }
+	INLINE Float4x4 MatrixIdentityF()  { return Matrix4(simd::MatrixIdentity()).ToFloat4x4(); }
+	INLINE Vector3 TransformVector3(Vector3& vector, Matrix4& matrix) { return Vector3(simd::Vector3Transform(vector, matrix)); }
+	INLINE Vector3 TransformCoordinateVector3(Vector3& vector, Matrix4& matrix) { return Vector3(simd::Vector3TransformCoord(vector, matrix)); }
+	INLINE Vector2 TransformNormal(const Vector2& v, const Matrix3& M) { return Vector2(simd::Vector2TransformNormal(v, M)); }
+	INLINE Vector3 TransformNormal(const Vector3& v, const Matrix4& M) { return Vector3(simd::Vector3TransformNormal(v, M)); }
+	INLINE Matrix4 Transform2D  (const Vector2& scaling, float rotation, const Vector2& translation, const Vector2& rotationOrigin = Vector2(0.0f, 0.0f))                 { return Matrix4(simd::MatrixAffineTransformation2D(scaling, rotationOrigin, rotation, translation)); }
+	INLINE Matrix4 Transform3D  (const Vector3& scaling, const Quaternion& rotation, const Vector3& translation, const Vector3& rotationOrigin = Vector3(0.0f, 0.0f, 0.0f)) { return Matrix4(simd::MatrixAffineTransformation(scaling, rotationOrigin, rotation, translation)); }
+	INLINE Matrix4 Transform3D  (const Matrix4& matrix, const Quaternion& rotation) { return matrix * Matrix4(simd::MatrixRotationQuaternion(rotation)); }
+	INLINE Matrix4 Translation            (const Float3& position)              { return Matrix4(simd::MatrixTranslationFromVector(position)); }
+	INLINE Matrix4 Translation            (const Vector3& position)             { return Matrix4(simd::MatrixTranslationFromVector(position)); }
+	INLINE Matrix4 Translation            (float x, float y, float z)           { return Matrix4(simd::MatrixTranslation(x, y, z)); };
+	INLINE Matrix4 Scaling                (float scale)                         { return Matrix4(simd::MatrixScaling(scale, scale, scale)); }
+	INLINE Matrix4 Scaling                (const Float3& scale)                 { return Matrix4(simd::MatrixScalingFromVector(scale)); }
+	INLINE Matrix4 Scaling                (const Vector3& scale)                { return Matrix4(simd::MatrixScalingFromVector(scale)); }
+	INLINE Matrix4 Scaling                (float sx, float sy, float sz)        { return Matrix4(simd::MatrixScaling(sx, sy, sz)); }
+	INLINE Matrix4 RotationX              (float radian)                        { return Matrix4(simd::MatrixRotationX(radian)); }
+	INLINE Matrix4 RotationY              (float radian)                        { return Matrix4(simd::MatrixRotationY(radian)); }
+	INLINE Matrix4 RotationZ              (float radian)                        { return Matrix4(simd::MatrixRotationZ(radian)); }
+	INLINE Matrix4 RotationQuaternion     (const Quaternion& rotation)          { return Matrix4(simd::MatrixRotationQuaternion(rotation)); }
+	INLINE Matrix4 RotationNormal         (const Vector3& normal, float radian) { return Matrix4(simd::MatrixRotationNormal(normal, radian)); }
+	INLINE Matrix4 RotationNormal         (const Float3& normal, float radian)  { return Matrix4(simd::MatrixRotationNormal(normal, radian)); }
+	INLINE Matrix4 RotationRollPitchYaw   (float roll, float pitch, float yaw)  { return Matrix4(simd::MatrixRotationRollPitchYaw(pitch, yaw, roll)); }
+	INLINE Matrix4 RotationRollPitchYaw   (const Vector3& rollPitchYaw)         { return Matrix4(simd::MatrixRotationRollPitchYaw(rollPitchYaw.GetY(), rollPitchYaw.GetZ(), rollPitchYaw.GetX())); }
+	INLINE Matrix4 RotationRollPitchYaw   (const Float3 & rollPitchYaw)         { Vector3 vector = Vector3(rollPitchYaw);  return Matrix4(simd::MatrixRotationRollPitchYaw(vector.GetY(), vector.GetZ(), vector.GetX())); }
+	INLINE Matrix4 RotationAxis           (const Float3 & axis, float radian)                                                                   { return Matrix4(simd::MatrixRotationAxis(axis, radian)); }
+	INLINE Matrix4 RotationAxis           (const Vector3& axis, float radian)                                                                   { return Matrix4(simd::MatrixRotationAxis(axis, radian)); }
+	INLINE Matrix4 LookAtLH               (const Vector3& eye, const Vector3& target,    const Vector3& up)                                     { return Matrix4(simd::MatrixLookAtLH(eye, target, up)); }
+	INLINE Matrix4 LookAtRH               (const Vector3& eye, const Vector3& target,    const Vector3& up)                                     { return Matrix4(simd::MatrixLookAtRH(eye, target, up)); }
+	INLINE Matrix4 LookAtLH               (const Float3 & eye, const Float3 & target,    const Float3 & up)                                     { return Matrix4(simd::MatrixLookAtLH(eye, target, up)); }
+	INLINE Matrix4 LookAtRH               (const Float3 & eye, const Float3 & target,    const Float3 & up)                                     { return Matrix4(simd::MatrixLookAtRH(eye, target, up)); }
+	INLINE Matrix4 LookToLH               (const Vector3& eye, const Vector3& direction, const Vector3& up)                                     { return Matrix4(simd::MatrixLookToLH(eye, direction, up)); }
+	INLINE Matrix4 LookToRH               (const Vector3& eye, const Vector3& direction, const Vector3& up)                                     { return Matrix4(simd::MatrixLookToRH(eye, direction, up)); }
+	INLINE Matrix4 LookToLH               (const Float3 & eye, const Float3 & direction, const Float3 & up)                                     { return Matrix4(simd::MatrixLookToLH(eye, direction, up)); }
+	INLINE Matrix4 LookToRH               (const Float3 & eye, const Float3 & direction, const Float3 & up)                                     { return Matrix4(simd::MatrixLookToRH(eye, direction, up)); }
+	INLINE Matrix4 PerspectiveLH          (float width, float height, float nearPlane, float farPlane)                                          { return Matrix4(simd::MatrixPerspectiveLH(width, height, nearPlane, farPlane)); }
+	INLINE Matrix4 PerspectiveRH          (float width, float height, float nearPlane, float farPlane)                                          { return Matrix4(simd::MatrixPerspectiveRH(width, height, nearPlane, farPlane)); }
+	INLINE Matrix4 PerspectiveFovLH       (float fov, float aspectRatio, float nearPlane, float farPlane)                                       { return Matrix4(simd::MatrixPerspectiveFovLH(fov, aspectRatio, nearPlane, farPlane)); }
+	INLINE Matrix4 PerspectiveFovRH       (float fov, float aspectRatio, float nearPlane, float farPlane)                                       { return Matrix4(simd::MatrixPerspectiveFovRH(fov, aspectRatio, nearPlane, farPlane)); }
+	INLINE Matrix4 PerspectiveOffCenterLH (float left, float right, float bottom, float top, float nearPlane, float farPlane)                   { return Matrix4(simd::MatrixPerspectiveOffCenterLH(left, right, bottom, top, nearPlane, farPlane)); }
+	INLINE Matrix4 PerspectiveOffCenterRH (float left, float right, float bottom, float top, float nearPlane, float farPlane)                   { return Matrix4(simd::MatrixPerspectiveOffCenterRH(left, right, bottom, top, nearPlane, farPlane)); }
+	INLINE Matrix4 OrthographicLH         (float viewWidth, float viewHeight, float zNearPlane, float zFarPlane)                                { return Matrix4(simd::MatrixOrthographicLH(viewWidth, viewHeight, zNearPlane, zFarPlane)); }
+	INLINE Matrix4 OrthographicRH         (float viewWidth, float viewHeight, float zNearPlane, float zFarPlane)                                { return Matrix4(simd::MatrixOrthographicRH(viewWidth, viewHeight, zNearPlane, zFarPlane)); }
+	INLINE Matrix4 OrthographicOffCenterLH(float viewLeft, float viewRight, float viewBottom, float viewTop, float zNearPlane, float zFarPlane) { return Matrix4(simd::MatrixOrthographicOffCenterLH(viewLeft, viewRight, viewBottom, viewTop, zNearPlane, zFarPlane)); }
+	INLINE Matrix4 OrthographicOffCenterRH(float viewLeft, float viewRight, float viewBottom, float viewTop, float zNearPlane, float zFarPlane) { return Matrix4(simd::MatrixOrthographicOffCenterRH(viewLeft, viewRight, viewBottom, viewTop, zNearPlane, zFarPlane)); }
+	INLINE Matrix4 Shadow                 (const Vector3& lightDirection, const Vector4& shadowPlane)                                           { return Matrix4(simd::MatrixShadow(shadowPlane, lightDirection)); }
+	INLINE Matrix4 Reflection             (const Vector4& reflectionPlane)                                                                      { return Matrix4(simd::MatrixReflect(reflectionPlane)); }
 	INLINE bool Matrix4::operator == (const Matrix4& M) const noexcept
 	{
 		return (Vector4(_matrix.r[0]) == Vector4(M._matrix.r[0])
@@ -496,31 +497,31 @@ namespace gm
 	}
 	INLINE Matrix4& Matrix4::operator+= (const Matrix4& M) noexcept
 	{
-		_matrix.r[0] = DirectX::XMVectorAdd(_matrix.r[0], M._matrix.r[0]);
-		_matrix.r[1] = DirectX::XMVectorAdd(_matrix.r[1], M._matrix.r[1]);
-		_matrix.r[2] = DirectX::XMVectorAdd(_matrix.r[2], M._matrix.r[2]);
-		_matrix.r[3] = DirectX::XMVectorAdd(_matrix.r[3], M._matrix.r[3]);
+		_matrix.r[0] = simd::VectorAdd(_matrix.r[0], M._matrix.r[0]);
+		_matrix.r[1] = simd::VectorAdd(_matrix.r[1], M._matrix.r[1]);
+		_matrix.r[2] = simd::VectorAdd(_matrix.r[2], M._matrix.r[2]);
+		_matrix.r[3] = simd::VectorAdd(_matrix.r[3], M._matrix.r[3]);
 		return *this;
 	}
 	INLINE Matrix4& Matrix4::operator-= (const Matrix4& M) noexcept
 	{
-		_matrix.r[0] = DirectX::XMVectorSubtract(_matrix.r[0], M._matrix.r[0]);
-		_matrix.r[1] = DirectX::XMVectorSubtract(_matrix.r[1], M._matrix.r[1]);
-		_matrix.r[2] = DirectX::XMVectorSubtract(_matrix.r[2], M._matrix.r[2]);
-		_matrix.r[3] = DirectX::XMVectorSubtract(_matrix.r[3], M._matrix.r[3]);
+		_matrix.r[0] = simd::VectorSubtract(_matrix.r[0], M._matrix.r[0]);
+		_matrix.r[1] = simd::VectorSubtract(_matrix.r[1], M._matrix.r[1]);
+		_matrix.r[2] = simd::VectorSubtract(_matrix.r[2], M._matrix.r[2]);
+		_matrix.r[3] = simd::VectorSubtract(_matrix.r[3], M._matrix.r[3]);
 		return *this;
 	}
 	INLINE Matrix4& Matrix4::operator*= (const Matrix4& M) noexcept
 	{
-		_matrix = DirectX::XMMatrixMultiply(_matrix, M);
+		_matrix = simd::MatrixMultiply(_matrix, M);
 		return *this;
 	}
 	INLINE Matrix4& Matrix4::operator*= (float S) noexcept
 	{
-		_matrix.r[0] = DirectX::XMVectorScale(_matrix.r[0], S);
-		_matrix.r[1] = DirectX::XMVectorScale(_matrix.r[1], S);
-		_matrix.r[2] = DirectX::XMVectorScale(_matrix.r[2], S);
-		_matrix.r[3] = DirectX::XMVectorScale(_matrix.r[3], S);
+		_matrix.r[0] = simd::VectorScale(_matrix.r[0], S);
+		_matrix.r[1] = simd::VectorScale(_matrix.r[1], S);
+		_matrix.r[2] = simd::VectorScale(_matrix.r[2], S);
+		_matrix.r[3] = simd::VectorScale(_matrix.r[3], S);
 		return *this;
 	}
 	INLINE Matrix4& Matrix4::operator/= (float S) noexcept
@@ -528,19 +529,19 @@ namespace gm
 		assert(S != 0.f);
 
 		float rs = 1.0f / S;
-		_matrix.r[0] = DirectX::XMVectorScale(_matrix.r[0], rs);
-		_matrix.r[1] = DirectX::XMVectorScale(_matrix.r[1], rs);
-		_matrix.r[2] = DirectX::XMVectorScale(_matrix.r[2], rs);
-		_matrix.r[3] = DirectX::XMVectorScale(_matrix.r[3], rs);
+		_matrix.r[0] = simd::VectorScale(_matrix.r[0], rs);
+		_matrix.r[1] = simd::VectorScale(_matrix.r[1], rs);
+		_matrix.r[2] = simd::VectorScale(_matrix.r[2], rs);
+		_matrix.r[3] = simd::VectorScale(_matrix.r[3], rs);
 
 		return *this;
 	}
 	INLINE Matrix4& Matrix4::operator/= (const Matrix4& M) noexcept
 	{
-		_matrix.r[0] = DirectX::XMVectorDivide(_matrix.r[0], M._matrix.r[0]);
-		_matrix.r[1] = DirectX::XMVectorDivide(_matrix.r[1], M._matrix.r[1]);
-		_matrix.r[2] = DirectX::XMVectorDivide(_matrix.r[2], M._matrix.r[2]);
-		_matrix.r[3] = DirectX::XMVectorDivide(_matrix.r[3], M._matrix.r[3]);
+		_matrix.r[0] = simd::VectorDivide(_matrix.r[0], M._matrix.r[0]);
+		_matrix.r[1] = simd::VectorDivide(_matrix.r[1], M._matrix.r[1]);
+		_matrix.r[2] = simd::VectorDivide(_matrix.r[2], M._matrix.r[2]);
+		_matrix.r[3] = simd::VectorDivide(_matrix.r[3], M._matrix.r[3]);
 		return *this;
 	}
 	INLINE Matrix4 operator+(const Matrix4& M1, const Matrix4& M2) noexcept
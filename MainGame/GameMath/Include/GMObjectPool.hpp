@@ -0,0 +1,200 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMObjectPool.hpp
+///             @brief  Typed object pool (dense active list + stable handles)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_OBJECT_POOL_HPP
+#define GM_OBJECT_POOL_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define OBJECT_POOL_INVALID_INDEX (0xFFFFFFFFu)
+
+//////////////////////////////////////////////////////////////////////////////////
+//
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			ObjectPoolHandle
+	*************************************************************************//**
+	*  @struct    ObjectPoolHandle
+	*  @brief     Slot index + generation. The handle becomes stale when the
+	*             object is released, even if the slot is acquired again.
+	*****************************************************************************/
+	struct ObjectPoolHandle
+	{
+		std::uint32_t Index      = OBJECT_POOL_INVALID_INDEX;
+		std::uint32_t Generation = 0;
+
+		bool operator==(const ObjectPoolHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+		bool operator!=(const ObjectPoolHandle& other) const { return !(*this == other); }
+	};
+
+	/****************************************************************************
+	*				  			ObjectPool
+	*************************************************************************//**
+	*  @class     ObjectPool
+	*  @brief     Pool of pre-created objects (the pool does not own them).
+	*             Acquired objects are kept in a dense array which is removed by swap,
+	*             so the live objects can be iterated without scanning the whole pool
+	*             and without allocation. The order of the active list is not kept.
+	*****************************************************************************/
+	template<typename T>
+	class ObjectPool
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Reserve(size_t capacity)
+		{
+			_objects    .reserve(capacity);
+			_generations.reserve(capacity);
+			_slotToDense.reserve(capacity);
+			_freeSlots  .reserve(capacity);
+			_active     .reserve(capacity);
+			_denseToSlot.reserve(capacity);
+		}
+
+		/* add the object to the pool as a free object */
+		ObjectPoolHandle Register(T* object)
+		{
+			assert(object != nullptr);
+			ObjectPoolHandle handle;
+			handle.Index      = static_cast<std::uint32_t>(_objects.size());
+			handle.Generation = 0;
+
+			_objects    .push_back(object);
+			_generations.push_back(0);
+			_slotToDense.push_back(OBJECT_POOL_INVALID_INDEX);
+			_freeSlots  .push_back(handle.Index);
+			return handle;
+		}
+
+		/* move a free object to the active list. (nullptr: all objects are in use) */
+		T* Acquire(ObjectPoolHandle* outHandle = nullptr)
+		{
+			if (_freeSlots.empty()) { return nullptr; }
+
+			const std::uint32_t slot = _freeSlots.back();
+			_freeSlots.pop_back();
+
+			_slotToDense[slot] = static_cast<std::uint32_t>(_active.size());
+			_active     .push_back(_objects[slot]);
+			_denseToSlot.push_back(slot);
+
+			if (outHandle != nullptr)
+			{
+				outHandle->Index      = slot;
+				outHandle->Generation = _generations[slot];
+			}
+			return _objects[slot];
+		}
+
+		bool Release(const ObjectPoolHandle& handle)
+		{
+			if (!IsValid(handle)) { return false; }
+			ReleaseAt(_slotToDense[handle.Index]);
+			return true;
+		}
+
+		/* release the activeIndex-th object of the active list. The last object is moved to activeIndex. */
+		void ReleaseAt(size_t activeIndex)
+		{
+			assert(activeIndex < _active.size());
+			const std::uint32_t slot     = _denseToSlot[activeIndex];
+			const std::uint32_t lastSlot = _denseToSlot.back();
+
+			_active     [activeIndex] = _active.back();
+			_denseToSlot[activeIndex] = lastSlot;
+			_slotToDense[lastSlot]    = static_cast<std::uint32_t>(activeIndex);
+			_active     .pop_back();
+			_denseToSlot.pop_back();
+
+			_slotToDense[slot] = OBJECT_POOL_INVALID_INDEX;
+			_generations[slot]++;
+			_freeSlots.push_back(slot);
+		}
+
+		/* release every active object for which predicate(T*) returns true */
+		template<typename Predicate>
+		void ReleaseIf(Predicate predicate)
+		{
+			for (size_t i = 0; i < _active.size();)
+			{
+				if (predicate(_active[i])) { ReleaseAt(i); }
+				else                       { ++i; }
+			}
+		}
+
+		void ReleaseAll()
+		{
+			while (!_active.empty()) { ReleaseAt(_active.size() - 1); }
+		}
+
+		/* remove all objects from the pool (the objects themselves are not deleted) */
+		void Clear()
+		{
+			_objects    .clear(); _objects    .shrink_to_fit();
+			_generations.clear(); _generations.shrink_to_fit();
+			_slotToDense.clear(); _slotToDense.shrink_to_fit();
+			_freeSlots  .clear(); _freeSlots  .shrink_to_fit();
+			_active     .clear(); _active     .shrink_to_fit();
+			_denseToSlot.clear(); _denseToSlot.shrink_to_fit();
+		}
+
+		bool IsValid(const ObjectPoolHandle& handle) const
+		{
+			return handle.Index < _objects.size()
+				&& _generations[handle.Index] == handle.Generation
+				&& _slotToDense[handle.Index] != OBJECT_POOL_INVALID_INDEX;
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		T* Get(const ObjectPoolHandle& handle) const { return IsValid(handle) ? _objects[handle.Index] : nullptr; }
+		const std::vector<T*>& GetActiveObjects() const { return _active; }
+		size_t GetActiveCount() const { return _active.size(); }
+		size_t GetFreeCount  () const { return _freeSlots.size(); }
+		size_t GetCapacity   () const { return _objects.size(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		ObjectPool() = default;
+		ObjectPool(const ObjectPool&)            = default;
+		ObjectPool& operator=(const ObjectPool&) = default;
+		ObjectPool(ObjectPool&&)                 = default;
+		ObjectPool& operator=(ObjectPool&&)      = default;
+		~ObjectPool() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		std::vector<T*>            _objects;     // slot -> object
+		std::vector<std::uint32_t> _generations; // slot -> generation
+		std::vector<std::uint32_t> _slotToDense; // slot -> index of the active list
+		std::vector<std::uint32_t> _freeSlots;
+		std::vector<T*>            _active;      // dense list of the live objects
+		std::vector<std::uint32_t> _denseToSlot;
+	};
+}
+#endif
@@ -27,19 +27,20 @@ subject to the following restrictions:
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
-#include "GMAlighedAllocator.hpp"
-#include <mutex>
+#include "GMBlockAllocator.hpp"
+#include <atomic>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 namespace gm
 {
 	/****************************************************************************
-	*				  			 ICollisionAlgorithm
+	*				  			 PoolAllocator
 	*************************************************************************//**
-	*  @class     Dispatcher
-	*  @brief    CollisionAlgorithm is an collision interface that is compatible
-	*            with the Broadphase and btDispatcher. It is persistent over frames
+	*  @class     PoolAllocator
+	*  @brief     Fixed size pool (maxElementCount elements of elementSize bytes).
+	*             It is a thin wrapper of BlockAllocator, so Allocate / FreeMemory are lock free.
+	*             Use BlockAllocator + LocalCache directly from the worker threads.
 	*****************************************************************************/
 	class PoolAllocator
 	{
@@ -47,76 +48,49 @@ namespace gm
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-
-
-		/****************************************************************************
-		**                Public Member Variables
-		*****************************************************************************/
-		int GetFreeCount() const { return _freeCount; }
-		int GetUsedCount() const { return _maxElementCount - _freeCount; }
-		int GetMaxCount() const { return _maxElementCount; }
-		int GetElementSize() const { return _elementSize; }
-		unsigned char* GetPoolAddress() { return _pool; }
-		const unsigned char* GetPoolAddress() const { return _pool; }
 		void* Allocate(int size)
 		{
 			(void)size;
-			_mutex.lock();
 			assert(!size || size <= _elementSize);
-			void* result = _firstFree;
-			if (NULL != _firstFree)
-			{
-				_firstFree = *(void**)_firstFree;
-				--_freeCount;
-			}
-			_mutex.unlock();
+			void* result = _allocator.Allocate();
+			if (result != nullptr) { _usedCount.fetch_add(1, std::memory_order_relaxed); }
 			return result;
 		}
 
 		bool ValidPtr(void* ptr)
 		{
-			if (ptr)
-			{
-				if (((unsigned char*)ptr >= _pool && (unsigned char*)ptr < _pool + (__int64)(_maxElementCount) * _elementSize))
-				{
-					return true;
-				}
-			}
-			return false;
+			return ptr != nullptr && _allocator.Owns(ptr);
 		}
 
 		void FreeMemory(void* ptr)
 		{
 			if (ptr)
 			{
-				assert((unsigned char*)ptr >= _pool && (unsigned char*)ptr < _pool + (__int64)(_maxElementCount) * _elementSize);
-
-				_mutex.lock();
-				*(void**)ptr = _firstFree;
-				_firstFree = ptr;
-				++_freeCount;
-				_mutex.unlock();
+				assert(ValidPtr(ptr));
+				_allocator.Free(ptr);
+				_usedCount.fetch_sub(1, std::memory_order_relaxed);
 			}
 		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		int GetFreeCount() const { return _maxElementCount - GetUsedCount(); }
+		int GetUsedCount() const { return _usedCount.load(std::memory_order_relaxed); }
+		int GetMaxCount() const { return _maxElementCount; }
+		int GetElementSize() const { return _elementSize; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		PoolAllocator(int elementSize, int maxElementCount)
-			:_elementSize(elementSize), _maxElementCount(maxElementCount)
+			:_elementSize(elementSize), _maxElementCount(maxElementCount),
+			_allocator(static_cast<size_t>(elementSize), static_cast<size_t>(maxElementCount), static_cast<size_t>(maxElementCount))
 		{
-			_pool = (unsigned char*)AlignedAllocInternal(static_cast<unsigned int>((__int64)(_elementSize) * _maxElementCount), 16);
-			unsigned char* p = _pool;
-			_firstFree = p;
-			_freeCount = _maxElementCount;
-			int count = _maxElementCount;
-			while (--count)
-			{
-				*(void**)p = (p + _elementSize);
-				p += _elementSize;
-			}
-			*(void**)p = 0;
 		}
-		~PoolAllocator() { AlignedFreeInternal(_pool); }
+		PoolAllocator(const PoolAllocator&)            = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+		~PoolAllocator() = default;
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -125,12 +99,10 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		int   _elementSize;
-		int   _maxElementCount;
-		int   _freeCount;
-		void* _firstFree;
-		unsigned char* _pool;
-		std::mutex _mutex;
+		int              _elementSize;
+		int              _maxElementCount;
+		std::atomic<int> _usedCount { 0 };
+		BlockAllocator   _allocator;
 	};
 }
-#endif
\ No newline at end of file
+#endif
@@ -44,43 +44,43 @@ namespace gm
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		INLINE Quaternion Normalize() { DirectX::XMVECTOR q = _vector; return Quaternion(DirectX::XMQuaternionNormalize(q)); }
-		INLINE Scalar     GetAngle()  { return Scalar(2.0f)* ACos(DirectX::XMVectorGetW(_vector)); }
+		INLINE Quaternion Normalize() { simd::VectorRegister q = _vector; return Quaternion(simd::QuaternionNormalize(q)); }
+		INLINE Scalar     GetAngle()  { return Scalar(2.0f)* ACos(simd::VectorGetW(_vector)); }
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE Quaternion operator~ (void) const { return Quaternion(DirectX::XMQuaternionConjugate(_vector)); }
-		INLINE Quaternion operator- (void) const { return Quaternion(DirectX::XMVectorNegate(_vector)); }
+		INLINE Quaternion operator~ (void) const { return Quaternion(simd::QuaternionConjugate(_vector)); }
+		INLINE Quaternion operator- (void) const { return Quaternion(simd::VectorNegate(_vector)); }
 
-		INLINE Quaternion operator* (Quaternion rhs) const { return Quaternion(DirectX::XMQuaternionMultiply(rhs, _vector)); } // from right to left 
-		INLINE Vector3 operator*    (Vector3 rhs)    const { return Vector3(DirectX::XMVector3Rotate(rhs, _vector)); }
+		INLINE Quaternion operator* (Quaternion rhs) const { return Quaternion(simd::QuaternionMultiply(rhs, _vector)); } // from right to left 
+		INLINE Vector3 operator*    (Vector3 rhs)    const { return Vector3(simd::Vector3Rotate(rhs, _vector)); }
 
 		INLINE Quaternion& operator=  (const Quaternion& rhs) { _vector = rhs; return *this; }
 		INLINE Quaternion& operator*= (Quaternion rhs) { *this = *this * rhs; return *this; }
 		INLINE Quaternion& operator=  (Quaternion&&) = default;
 
-		INLINE bool operator == (const Quaternion& V) const noexcept { DirectX::XMQuaternionEqual(*this, V); };
-		INLINE bool operator == (const Float4& V) const noexcept { DirectX::XMQuaternionEqual(*this, V); };
-		INLINE bool operator != (const Float4& V) const noexcept { DirectX::XMQuaternionNotEqual(*this, V); };
+		INLINE bool operator == (const Quaternion& V) const noexcept { return simd::QuaternionEqual(*this, V); };
+		INLINE bool operator == (const Float4& V) const noexcept { return simd::QuaternionEqual(*this, V); };
+		INLINE bool operator != (const Float4& V) const noexcept { return simd::QuaternionNotEqual(*this, V); };
 
 		INLINE Float4 ToFloat4()
 		{ 
 			Float4 value;
-			DirectX::XMStoreFloat4(&value, _vector);
+			simd::StoreFloat4(&value, _vector);
 			return value;
 		}
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		INLINE Quaternion()                                                 { _vector = DirectX::XMQuaternionIdentity(); }
-		INLINE Quaternion(const Vector3& axis, const Scalar& angle)         { _vector = DirectX::XMQuaternionRotationAxis(axis, angle); }
-		INLINE Quaternion(float pitch, float yaw, float roll)               { _vector = DirectX::XMQuaternionRotationRollPitchYaw(pitch, yaw, roll); }
-		INLINE Quaternion(const Vector3& PitchYawRoll)                      { _vector = DirectX::XMQuaternionRotationRollPitchYawFromVector(PitchYawRoll); }
+		INLINE Quaternion()                                                 { _vector = simd::QuaternionIdentity(); }
+		INLINE Quaternion(const Vector3& axis, const Scalar& angle)         { _vector = simd::QuaternionRotationAxis(axis, angle); }
+		INLINE Quaternion(float pitch, float yaw, float roll)               { _vector = simd::QuaternionRotationRollPitchYaw(pitch, yaw, roll); }
+		INLINE Quaternion(const Vector3& PitchYawRoll)                      { _vector = simd::QuaternionRotationRollPitchYawFromVector(PitchYawRoll); }
 		INLINE Quaternion(const Vector4& vector)                            { _vector = vector; }
-		INLINE explicit Quaternion(const DirectX::XMMATRIX& rotationMatrix) { _vector = DirectX::XMQuaternionRotationMatrix(rotationMatrix); }
-		INLINE explicit Quaternion(DirectX::FXMVECTOR vec)                  { _vector = vec; }
-		INLINE explicit Quaternion(EIdentityTag)                            { _vector = DirectX::XMQuaternionIdentity(); }
-		INLINE operator DirectX::XMVECTOR() const { return _vector; }
+		INLINE explicit Quaternion(const simd::MatrixRegister& rotationMatrix) { _vector = simd::QuaternionRotationMatrix(rotationMatrix); }
+		INLINE explicit Quaternion(simd::VectorRegister vec)                  { _vector = vec; }
+		INLINE explicit Quaternion(EIdentityTag)                            { _vector = simd::QuaternionIdentity(); }
+		INLINE operator simd::VectorRegister() const { return _vector; }
 		INLINE Quaternion(const Quaternion&) = default;
 		INLINE Quaternion(Quaternion&&)      = default;
 
@@ -92,21 +92,21 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		DirectX::XMVECTOR _vector;
+		simd::VectorRegister _vector;
 	};
 	
-	INLINE void AxisAngle(const Quaternion& q, float* rotate, Vector3& axis) { DirectX::XMVECTOR v = axis; DirectX::XMQuaternionToAxisAngle(&v, rotate, q); axis = Vector3(v); }
-	INLINE void AxisAngle(const Quaternion& q, float* rotate, DirectX::XMVECTOR* axis) { DirectX::XMQuaternionToAxisAngle(axis,rotate,q); }
-	INLINE Quaternion Normalize(const Quaternion& q)                           { return Quaternion(DirectX::XMQuaternionNormalize(q)); }
-	INLINE Quaternion Squad(const Quaternion& a, const Quaternion& b, const Quaternion& c, const Quaternion& d, float t) { return Quaternion(DirectX::XMQuaternionSquad(a, b, c, d, t)); }
-	INLINE Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t) { return Quaternion(DirectX::XMQuaternionSlerp(a, b, t)); }
-	INLINE Quaternion Lerp (const Quaternion& a, const Quaternion& b, float t) { return Quaternion(DirectX::XMVectorLerp(a, b, t)); }
-	INLINE Quaternion Norm       (const Quaternion& q)                         { return Quaternion(DirectX::XMQuaternionLength(q)); }
-	INLINE Quaternion NormSquared(const Quaternion& q)                         { return Quaternion(DirectX::XMQuaternionLengthSq(q)); }
-	INLINE Quaternion Conjugate  (const Quaternion& q)                         { return Quaternion(DirectX::XMQuaternionConjugate(q)); }
-	INLINE Quaternion Inverse    (const Quaternion& q)                         { return Quaternion(DirectX::XMQuaternionInverse(q)); }
-	INLINE Quaternion BaryCentric(const Quaternion& v1, const Quaternion& v2, const Quaternion& v3, float wf, float wg) { return Quaternion(DirectX::XMQuaternionBaryCentric(v1, v2, v3, wf, wg)); }
-	INLINE Scalar Dot(const Quaternion& q1, const Quaternion& q2) { return Scalar(DirectX::XMQuaternionDot(q1, q2)); }
+	INLINE void AxisAngle(const Quaternion& q, float* rotate, Vector3& axis) { simd::VectorRegister v = axis; simd::QuaternionToAxisAngle(&v, rotate, q); axis = Vector3(v); }
+	INLINE void AxisAngle(const Quaternion& q, float* rotate, simd::VectorRegister* axis) { simd::QuaternionToAxisAngle(axis,rotate,q); }
+	INLINE Quaternion Normalize(const Quaternion& q)                           { return Quaternion(simd::QuaternionNormalize(q)); }
+	INLINE Quaternion Squad(const Quaternion& a, const Quaternion& b, const Quaternion& c, const Quaternion& d, float t) { return Quaternion(simd::QuaternionSquad(a, b, c, d, t)); }
+	INLINE Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t) { return Quaternion(simd::QuaternionSlerp(a, b, t)); }
+	INLINE Quaternion Lerp (const Quaternion& a, const Quaternion& b, float t) { return Quaternion(simd::VectorLerp(a, b, t)); }
+	INLINE Quaternion Norm       (const Quaternion& q)                         { return Quaternion(simd::QuaternionLength(q)); }
+	INLINE Quaternion NormSquared(const Quaternion& q)                         { return Quaternion(simd::QuaternionLengthSq(q)); }
+	INLINE Quaternion Conjugate  (const Quaternion& q)                         { return Quaternion(simd::QuaternionConjugate(q)); }
+	INLINE Quaternion Inverse    (const Quaternion& q)                         { return Quaternion(simd::QuaternionInverse(q)); }
+	INLINE Quaternion BaryCentric(const Quaternion& v1, const Quaternion& v2, const Quaternion& v3, float wf, float wg) { return Quaternion(simd::QuaternionBaryCentric(v1, v2, v3, wf, wg)); }
+	INLINE Scalar Dot(const Quaternion& q1, const Quaternion& q2) { return Scalar(simd::QuaternionDot(q1, q2)); }
 	INLINE Vector3    QuaternionRotate(const Quaternion& rotation, const Vector3& v)
 	{
 		Quaternion q = rotation * v;
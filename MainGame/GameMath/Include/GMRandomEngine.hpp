@@ -0,0 +1,536 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMRandomEngine.hpp
+///             @brief  Small state random engine (4 lane xoshiro128+) with bulk fill and direction sampling
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_RANDOM_ENGINE_HPP
+#define GM_RANDOM_ENGINE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMVector.hpp"
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#if defined(GM_SIMD_USE_SSE2)
+#include <emmintrin.h>
+#define GM_RANDOM_ENGINE_SSE2
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			RandomEngine
+	*************************************************************************//**
+	*  @class     RandomEngine
+	*  @brief     xoshiro128+ running 4 independent lanes (96 bytes instead of the 2.5KB mt19937).
+	*             The output stream is the lanes interleaved (value i comes from lane i % 4),
+	*             so the scalar functions and the SSE2 bulk Fill return exactly the same sequence.
+	*             Every (seed, streamIndex) pair is deterministic, and the streams are 2^64 values apart
+	*             (jump function), so one seed can give each worker thread its own stream.
+	*             It also satisfies UniformRandomBitGenerator and can drive the std distributions.
+	*****************************************************************************/
+	class RandomEngine
+	{
+	public:
+		using result_type = std::uint32_t;
+		static constexpr int LaneCount = 4;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* raw 32 bits */
+		std::uint32_t NextUInt()
+		{
+			if (_bufferIndex == LaneCount) { Step(_buffer); _bufferIndex = 0; }
+			return _buffer[_bufferIndex++];
+		}
+
+		/* [0, 1) (upper 24 bits, the lower bits of xoshiro128+ are weak) */
+		float NextFloat() { return ToUnitFloat(NextUInt()); }
+		/* [min, max) (min <= max) */
+		float NextFloat(float min, float max) { return ToRangeFloat(NextFloat(), min, max, BelowMax(min, max)); }
+
+		/* [min, max]. multiply shift range reduction (the bias is at most range / 2^32) */
+		int NextInt(int min, int max) { return ToRangeInt(NextUInt(), min, max); }
+
+		void Fill(std::uint32_t* out, size_t count);
+		void Fill(float* out, size_t count, float min = 0.0f, float max = 1.0f);
+		void Fill(int* out, size_t count, int min, int max);
+
+		/* uniform directions. each sample uses two values of the stream */
+		Float3 UnitSphere    ();
+		Float3 UnitHemisphere();   // +z side, uniform
+		Float3 CosineHemisphere(); // +z side, pdf = cos(theta) / pi
+		Float2 UnitDisk      ();   // uniform point in the unit disk
+		void FillUnitSphere      (Float3* out, size_t count);
+		void FillUnitHemisphere  (Float3* out, size_t count);
+		void FillCosineHemisphere(Float3* out, size_t count);
+		void FillUnitDisk        (Float2* out, size_t count);
+
+		/* the same seed and stream index always produce the same sequence */
+		void Seed(std::uint64_t seed, std::uint32_t streamIndex = 0);
+		static std::uint64_t CreateRandomSeed()
+		{
+			std::random_device device;
+			return (static_cast<std::uint64_t>(device()) << 32) | device();
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		static constexpr result_type (min)() { return 0; }
+		static constexpr result_type (max)() { return UINT32_MAX; }
+		result_type operator()() { return NextUInt(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RandomEngine() { Seed(CreateRandomSeed()); }
+		explicit RandomEngine(std::uint64_t seed, std::uint32_t streamIndex = 0) { Seed(seed, streamIndex); }
+		RandomEngine(const RandomEngine&)            = default;
+		RandomEngine& operator=(const RandomEngine&) = default;
+		~RandomEngine() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		void Step(std::uint32_t* out);
+		template<typename Function> void FillPairs(size_t count, Function&& function);
+		static void Jump(std::uint32_t* state);
+		static float ToUnitFloat(std::uint32_t bits) { return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f); }
+		/* min + (max - min) * u rounds up to max for a narrow range, so it is clamped to the float below max */
+		static float BelowMax    (float min, float max) { return min < max ? std::nextafter(max, min) : max; }
+		static float ToRangeFloat(float u, float min, float max, float belowMax) { return (std::min)(min + (max - min) * u, belowMax); }
+		static int   ToRangeInt (std::uint32_t bits, int min, int max)
+		{
+			const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+			return static_cast<int>(static_cast<std::int64_t>(min) + static_cast<std::int64_t>((bits * range) >> 32));
+		}
+		static Float3 ToUnitSphere      (float u, float v);
+		static Float3 ToUnitHemisphere  (float u, float v);
+		static Float3 ToCosineHemisphere(float u, float v);
+		static Float2 ToUnitDisk        (float u, float v);
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		alignas(16) std::uint32_t _state [4][LaneCount]; // [word][lane] (SoA for SSE2)
+		alignas(16) std::uint32_t _buffer[LaneCount];    // the latest step of all lanes
+		int _bufferIndex = LaneCount;
+	};
+
+#pragma region Public Function
+	/****************************************************************************
+	*							Fill
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Fill(std::uint32_t* out, size_t count)
+	*  @brief     Fill raw 32 bit values. The middle part is written 4 values per step.
+	*  @param[out]std::uint32_t* out
+	*  @param[in] size_t count
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Fill(std::uint32_t* out, size_t count)
+	{
+		size_t i = 0;
+		/*-------------------------------------------------------------------
+		-        Rest of the last step
+		---------------------------------------------------------------------*/
+		for (; i < count && _bufferIndex < LaneCount; ++i) { out[i] = _buffer[_bufferIndex++]; }
+
+		/*-------------------------------------------------------------------
+		-        Whole steps
+		---------------------------------------------------------------------*/
+		for (; i + LaneCount <= count; i += LaneCount) { Step(out + i); }
+
+		/*-------------------------------------------------------------------
+		-        Tail
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i) { out[i] = NextUInt(); }
+	}
+
+	/****************************************************************************
+	*							Fill
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Fill(float* out, size_t count, float min, float max)
+	*  @brief     Fill uniform values in [min, max) (min <= max)
+	*  @param[out]float* out
+	*  @param[in] size_t count
+	*  @param[in] float  min
+	*  @param[in] float  max
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Fill(float* out, size_t count, float min, float max)
+	{
+		/*-------------------------------------------------------------------
+		-        Generate the bits into a block on the stack, then convert.
+		-        (out is a float array and must not be written as uint32)
+		---------------------------------------------------------------------*/
+		constexpr size_t BlockCount = 64;
+		alignas(16) std::uint32_t bits[BlockCount];
+		const float belowMax = BelowMax(min, max);
+
+		for (size_t first = 0; first < count; first += BlockCount)
+		{
+			const size_t blockCount = (std::min)(BlockCount, count - first);
+			float* block = out + first;
+			Fill(bits, blockCount);
+
+			size_t i = 0;
+#ifdef GM_RANDOM_ENGINE_SSE2
+			const __m128 minimum = _mm_set1_ps(min);
+			const __m128 range   = _mm_set1_ps(max - min);
+			const __m128 upper   = _mm_set1_ps(belowMax);
+			const __m128 unit    = _mm_set1_ps(1.0f / 16777216.0f);
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				const __m128i value = _mm_srli_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(bits + i)), 8);
+				const __m128  u     = _mm_mul_ps(_mm_cvtepi32_ps(value), unit);
+				_mm_storeu_ps(block + i, _mm_min_ps(_mm_add_ps(minimum, _mm_mul_ps(range, u)), upper));
+			}
+#endif
+			for (; i < blockCount; ++i) { block[i] = ToRangeFloat(ToUnitFloat(bits[i]), min, max, belowMax); }
+		}
+	}
+
+	/****************************************************************************
+	*							Fill
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Fill(int* out, size_t count, int min, int max)
+	*  @brief     Fill uniform integers in [min, max]
+	*  @param[out]int*   out
+	*  @param[in] size_t count
+	*  @param[in] int    min
+	*  @param[in] int    max
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Fill(int* out, size_t count, int min, int max)
+	{
+		/*-------------------------------------------------------------------
+		-        Convert block by block while the bits are still in the cache
+		---------------------------------------------------------------------*/
+		constexpr size_t BlockCount = 64;
+		alignas(16) std::uint32_t bits[BlockCount];
+
+		for (size_t first = 0; first < count; first += BlockCount)
+		{
+			const size_t blockCount = (std::min)(BlockCount, count - first);
+			Fill(bits, blockCount);
+			for (size_t i = 0; i < blockCount; ++i) { out[first + i] = ToRangeInt(bits[i], min, max); }
+		}
+	}
+
+	/****************************************************************************
+	*							UnitSphere
+	*************************************************************************//**
+	*  @fn        inline Float3 RandomEngine::UnitSphere()
+	*  @brief     Uniform direction on the unit sphere
+	*  @param[in] void
+	*  @return    Float3
+	*****************************************************************************/
+	inline Float3 RandomEngine::UnitSphere()
+	{
+		const float u = NextFloat();
+		const float v = NextFloat();
+		return ToUnitSphere(u, v);
+	}
+
+	/****************************************************************************
+	*							UnitHemisphere
+	*************************************************************************//**
+	*  @fn        inline Float3 RandomEngine::UnitHemisphere()
+	*  @brief     Uniform direction on the +z unit hemisphere
+	*  @param[in] void
+	*  @return    Float3
+	*****************************************************************************/
+	inline Float3 RandomEngine::UnitHemisphere()
+	{
+		const float u = NextFloat();
+		const float v = NextFloat();
+		return ToUnitHemisphere(u, v);
+	}
+
+	/****************************************************************************
+	*							CosineHemisphere
+	*************************************************************************//**
+	*  @fn        inline Float3 RandomEngine::CosineHemisphere()
+	*  @brief     Cosine weighted direction on the +z unit hemisphere
+	*  @param[in] void
+	*  @return    Float3
+	*****************************************************************************/
+	inline Float3 RandomEngine::CosineHemisphere()
+	{
+		const float u = NextFloat();
+		const float v = NextFloat();
+		return ToCosineHemisphere(u, v);
+	}
+
+	/****************************************************************************
+	*							UnitDisk
+	*************************************************************************//**
+	*  @fn        inline Float2 RandomEngine::UnitDisk()
+	*  @brief     Uniform point in the unit disk
+	*  @param[in] void
+	*  @return    Float2
+	*****************************************************************************/
+	inline Float2 RandomEngine::UnitDisk()
+	{
+		const float u = NextFloat();
+		const float v = NextFloat();
+		return ToUnitDisk(u, v);
+	}
+
+	/****************************************************************************
+	*							FillUnitSphere
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::FillUnitSphere(Float3* out, size_t count)
+	*  @brief     Bulk UnitSphere (the same values as calling UnitSphere count times)
+	*  @param[out]Float3* out
+	*  @param[in] size_t  count
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::FillUnitSphere(Float3* out, size_t count)
+	{
+		FillPairs(count, [out](size_t i, float u, float v) { out[i] = ToUnitSphere(u, v); });
+	}
+
+	/****************************************************************************
+	*							FillUnitHemisphere
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::FillUnitHemisphere(Float3* out, size_t count)
+	*  @brief     Bulk UnitHemisphere
+	*  @param[out]Float3* out
+	*  @param[in] size_t  count
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::FillUnitHemisphere(Float3* out, size_t count)
+	{
+		FillPairs(count, [out](size_t i, float u, float v) { out[i] = ToUnitHemisphere(u, v); });
+	}
+
+	/****************************************************************************
+	*							FillCosineHemisphere
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::FillCosineHemisphere(Float3* out, size_t count)
+	*  @brief     Bulk CosineHemisphere
+	*  @param[out]Float3* out
+	*  @param[in] size_t  count
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::FillCosineHemisphere(Float3* out, size_t count)
+	{
+		FillPairs(count, [out](size_t i, float u, float v) { out[i] = ToCosineHemisphere(u, v); });
+	}
+
+	/****************************************************************************
+	*							FillUnitDisk
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::FillUnitDisk(Float2* out, size_t count)
+	*  @brief     Bulk UnitDisk
+	*  @param[out]Float2* out
+	*  @param[in] size_t  count
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::FillUnitDisk(Float2* out, size_t count)
+	{
+		FillPairs(count, [out](size_t i, float u, float v) { out[i] = ToUnitDisk(u, v); });
+	}
+
+	/****************************************************************************
+	*							Seed
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Seed(std::uint64_t seed, std::uint32_t streamIndex)
+	*  @brief     Expand the seed with splitmix64 and jump (2^64 values) to each stream and lane.
+	*             lane l of stream s starts (s * 4 + l) jumps after the seeded state.
+	*  @param[in] std::uint64_t seed
+	*  @param[in] std::uint32_t streamIndex (ex. worker thread index)
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Seed(std::uint64_t seed, std::uint32_t streamIndex)
+	{
+		/*-------------------------------------------------------------------
+		-        splitmix64 (never gives the all zero state)
+		---------------------------------------------------------------------*/
+		std::uint32_t state[4];
+		for (int i = 0; i < 2; ++i)
+		{
+			std::uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			z =  z ^ (z >> 31);
+			state[i * 2 + 0] = static_cast<std::uint32_t>(z);
+			state[i * 2 + 1] = static_cast<std::uint32_t>(z >> 32);
+		}
+		if ((state[0] | state[1] | state[2] | state[3]) == 0) { state[0] = 1; }
+
+		/*-------------------------------------------------------------------
+		-        Jump to the stream, then to each lane
+		---------------------------------------------------------------------*/
+		for (std::uint64_t i = 0; i < static_cast<std::uint64_t>(streamIndex) * LaneCount; ++i) { Jump(state); }
+		for (int lane = 0; lane < LaneCount; ++lane)
+		{
+			if (lane > 0) { Jump(state); }
+			for (int word = 0; word < 4; ++word) { _state[word][lane] = state[word]; }
+		}
+		_bufferIndex = LaneCount;
+	}
+#pragma endregion Public Function
+
+#pragma region Private Function
+	/****************************************************************************
+	*							Step
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Step(std::uint32_t* out)
+	*  @brief     Advance all lanes once and write one value per lane
+	*  @param[out]std::uint32_t* out (LaneCount values)
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Step(std::uint32_t* out)
+	{
+#ifdef GM_RANDOM_ENGINE_SSE2
+		__m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(_state[0]));
+		__m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(_state[1]));
+		__m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(_state[2]));
+		__m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(_state[3]));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_add_epi32(s0, s3));
+
+		const __m128i t = _mm_slli_epi32(s1, 9);
+		s2 = _mm_xor_si128(s2, s0);
+		s3 = _mm_xor_si128(s3, s1);
+		s1 = _mm_xor_si128(s1, s2);
+		s0 = _mm_xor_si128(s0, s3);
+		s2 = _mm_xor_si128(s2, t);
+		s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+		_mm_store_si128(reinterpret_cast<__m128i*>(_state[0]), s0);
+		_mm_store_si128(reinterpret_cast<__m128i*>(_state[1]), s1);
+		_mm_store_si128(reinterpret_cast<__m128i*>(_state[2]), s2);
+		_mm_store_si128(reinterpret_cast<__m128i*>(_state[3]), s3);
+#else
+		for (int lane = 0; lane < LaneCount; ++lane)
+		{
+			std::uint32_t& s0 = _state[0][lane];
+			std::uint32_t& s1 = _state[1][lane];
+			std::uint32_t& s2 = _state[2][lane];
+			std::uint32_t& s3 = _state[3][lane];
+
+			out[lane] = s0 + s3;
+
+			const std::uint32_t t = s1 << 9;
+			s2 ^= s0;
+			s3 ^= s1;
+			s1 ^= s2;
+			s0 ^= s3;
+			s2 ^= t;
+			s3 = (s3 << 11) | (s3 >> 21);
+		}
+#endif
+	}
+
+	/****************************************************************************
+	*							Jump
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::Jump(std::uint32_t* state)
+	*  @brief     Advance one xoshiro128 state by 2^64 steps
+	*  @param[out]std::uint32_t* state (4 words)
+	*  @return    void
+	*****************************************************************************/
+	inline void RandomEngine::Jump(std::uint32_t* state)
+	{
+		static constexpr std::uint32_t JumpTable[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+		std::uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+		for (std::uint32_t jump : JumpTable)
+		{
+			for (int bit = 0; bit < 32; ++bit)
+			{
+				if (jump & (1u << bit))
+				{
+					s0 ^= state[0]; s1 ^= state[1]; s2 ^= state[2]; s3 ^= state[3];
+				}
+
+				const std::uint32_t t = state[1] << 9;
+				state[2] ^= state[0];
+				state[3] ^= state[1];
+				state[1] ^= state[2];
+				state[0] ^= state[3];
+				state[2] ^= t;
+				state[3] = (state[3] << 11) | (state[3] >> 21);
+			}
+		}
+		state[0] = s0; state[1] = s1; state[2] = s2; state[3] = s3;
+	}
+
+	/****************************************************************************
+	*							FillPairs
+	*************************************************************************//**
+	*  @fn        inline void RandomEngine::FillPairs(size_t count, Function&& function)
+	*  @brief     Bulk generate (u, v) pairs in [0, 1) through a small stack buffer
+	*  @param[in] size_t count (the number of pairs)
+	*  @param[in] Function function(size_t index, float u, float v)
+	*  @return    void
+	*****************************************************************************/
+	template<typename Function> inline void RandomEngine::FillPairs(size_t count, Function&& function)
+	{
+		constexpr size_t ChunkPairCount = 128;
+		float uv[ChunkPairCount * 2];
+
+		for (size_t first = 0; first < count; first += ChunkPairCount)
+		{
+			const size_t pairCount = (std::min)(ChunkPairCount, count - first);
+			Fill(uv, pairCount * 2);
+			for (size_t i = 0; i < pairCount; ++i) { function(first + i, uv[i * 2], uv[i * 2 + 1]); }
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-        (u, v) in [0, 1) -> direction (inverse CDF without rejection,
+	-        so every sample uses exactly two values of the stream)
+	---------------------------------------------------------------------*/
+	inline Float3 RandomEngine::ToUnitSphere(float u, float v)
+	{
+		const float z   = 1.0f - 2.0f * u;
+		const float r   = std::sqrt((std::max)(0.0f, 1.0f - z * z));
+		const float phi = GM_2PI * v;
+		return Float3(r * std::cos(phi), r * std::sin(phi), z);
+	}
+
+	inline Float3 RandomEngine::ToUnitHemisphere(float u, float v)
+	{
+		const float z   = 1.0f - u;
+		const float r   = std::sqrt((std::max)(0.0f, 1.0f - z * z));
+		const float phi = GM_2PI * v;
+		return Float3(r * std::cos(phi), r * std::sin(phi), z);
+	}
+
+	inline Float3 RandomEngine::ToCosineHemisphere(float u, float v)
+	{
+		const float r   = std::sqrt(u);
+		const float phi = GM_2PI * v;
+		return Float3(r * std::cos(phi), r * std::sin(phi), std::sqrt((std::max)(0.0f, 1.0f - u)));
+	}
+
+	inline Float2 RandomEngine::ToUnitDisk(float u, float v)
+	{
+		const float r   = std::sqrt(u);
+		const float phi = GM_2PI * v;
+		return Float2(r * std::cos(phi), r * std::sin(phi));
+	}
+#pragma endregion Private Function
+}
+#endif
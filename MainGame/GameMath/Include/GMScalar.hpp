@@ -48,13 +48,13 @@ namespace gm
 		*****************************************************************************/
 		INLINE Scalar() { _vector = vector::SplatOne(); }
         INLINE Scalar( const Scalar& scalar )               { _vector = scalar; }
-        INLINE Scalar( float f )                            { _vector = DirectX::XMVectorReplicate(f); }
-        INLINE explicit Scalar( DirectX::FXMVECTOR vector ) { _vector = vector; }
+        INLINE Scalar( float f )                            { _vector = simd::VectorReplicate(f); }
+        INLINE explicit Scalar( simd::VectorRegister vector ) { _vector = vector; }
         INLINE explicit Scalar( EZeroTag )                  { _vector = vector::SplatZero(); }
         INLINE explicit Scalar( EIdentityTag )              { _vector = vector::SplatOne(); }
 
-        INLINE operator DirectX::XMVECTOR() const { return _vector; }
-        INLINE operator float() const { return DirectX::XMVectorGetX(_vector); }
+        INLINE operator simd::VectorRegister() const { return _vector; }
+        INLINE operator float() const { return simd::VectorGetX(_vector); }
 
 
 	private:
@@ -65,14 +65,14 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		DirectX::XMVECTOR _vector;
+		simd::VectorRegister _vector;
 	};
 
-	INLINE Scalar operator- (Scalar s) { return Scalar(DirectX::XMVectorNegate(s)); }
-	INLINE Scalar operator+ (Scalar s1, Scalar s2) { return Scalar(DirectX::XMVectorAdd(s1, s2)); }
-	INLINE Scalar operator- (Scalar s1, Scalar s2) { return Scalar(DirectX::XMVectorSubtract(s1, s2)); }
-	INLINE Scalar operator* (Scalar s1, Scalar s2) { return Scalar(DirectX::XMVectorMultiply(s1, s2)); }
-	INLINE Scalar operator/ (Scalar s1, Scalar s2) { return Scalar(DirectX::XMVectorDivide(s1, s2)); }
+	INLINE Scalar operator- (Scalar s) { return Scalar(simd::VectorNegate(s)); }
+	INLINE Scalar operator+ (Scalar s1, Scalar s2) { return Scalar(simd::VectorAdd(s1, s2)); }
+	INLINE Scalar operator- (Scalar s1, Scalar s2) { return Scalar(simd::VectorSubtract(s1, s2)); }
+	INLINE Scalar operator* (Scalar s1, Scalar s2) { return Scalar(simd::VectorMultiply(s1, s2)); }
+	INLINE Scalar operator/ (Scalar s1, Scalar s2) { return Scalar(simd::VectorDivide(s1, s2)); }
 	INLINE Scalar operator+ (Scalar s1, float s2) { return s1 + Scalar(s2); }
 	INLINE Scalar operator- (Scalar s1, float s2) { return s1 - Scalar(s2); }
 	INLINE Scalar operator* (Scalar s1, float s2) { return s1 * Scalar(s2); }
@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdConfig.hpp
+///             @brief  SIMD backend switch of GameMath (scalar / SSE2 / SSE4 / NEON)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_CONFIG_HPP
+#define GM_SIMD_CONFIG_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------------------
+-   Backend
+-   GameMath types are built on the register functions of GMSimdCore.hpp, and this
+-   switch selects which implementation of them is compiled. Define GM_SIMD_BACKEND
+-   in the project settings (not in a source file), because every translation unit
+-   must see the same configuration.
+-     GM_SIMD_BACKEND_SCALAR : plain float[4] reference
+-     GM_SIMD_BACKEND_SSE2   : x86 / x64 default
+-     GM_SIMD_BACKEND_SSE4   : SSE4.1 (dot product, insert, blend, round)
+-     GM_SIMD_BACKEND_NEON   : ARM / ARM64
+-   When it is not defined, the backend is chosen from the target.
+---------------------------------------------------------------------------*/
+#define GM_SIMD_BACKEND_SCALAR 0
+#define GM_SIMD_BACKEND_SSE2   1
+#define GM_SIMD_BACKEND_SSE4   2
+#define GM_SIMD_BACKEND_NEON   3
+
+#ifndef GM_SIMD_BACKEND
+	#if defined(_XM_NO_INTRINSICS_)
+		#define GM_SIMD_BACKEND GM_SIMD_BACKEND_SCALAR
+	#elif defined(_M_ARM) || defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC) || defined(__arm__) || defined(__aarch64__)
+		#define GM_SIMD_BACKEND GM_SIMD_BACKEND_NEON
+	#elif defined(_XM_SSE4_INTRINSICS_) || defined(__AVX__) || defined(__SSE4_1__)
+		#define GM_SIMD_BACKEND GM_SIMD_BACKEND_SSE4
+	#elif defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+		#define GM_SIMD_BACKEND GM_SIMD_BACKEND_SSE2
+	#else
+		#define GM_SIMD_BACKEND GM_SIMD_BACKEND_SCALAR
+	#endif
+#endif
+
+#if GM_SIMD_BACKEND == GM_SIMD_BACKEND_SCALAR
+	#define GM_SIMD_BACKEND_NAME "Scalar"
+#elif GM_SIMD_BACKEND == GM_SIMD_BACKEND_SSE2
+	#if !(defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+	#error "GameMath: the SSE2 backend needs an x86 / x64 target."
+	#endif
+	#define GM_SIMD_USE_SSE2
+	#define GM_SIMD_BACKEND_NAME "SSE2"
+#elif GM_SIMD_BACKEND == GM_SIMD_BACKEND_SSE4
+	#if !(defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+	#error "GameMath: the SSE4 backend needs an x86 / x64 target."
+	#endif
+	#define GM_SIMD_USE_SSE2
+	#define GM_SIMD_USE_SSE4
+	#define GM_SIMD_BACKEND_NAME "SSE4"
+#elif GM_SIMD_BACKEND == GM_SIMD_BACKEND_NEON
+	#if !(defined(_M_ARM) || defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC) || defined(__arm__) || defined(__aarch64__))
+	#error "GameMath: the NEON backend needs an ARM target."
+	#endif
+	#define GM_SIMD_USE_NEON
+	#define GM_SIMD_BACKEND_NAME "NEON"
+#else
+	#error "GameMath: unknown GM_SIMD_BACKEND."
+#endif
+
+/*---------------------------------------------------------------------------
+-   DirectXMath interop
+-   The math itself never calls DirectXMath. On Windows the register and storage types
+-   are the DirectXMath ones (XMVECTOR, XMMATRIX, XMFLOAT3 ...), so the engine can keep
+-   passing gm::Float3 to XMLoadFloat3 or gm::Matrix4 to an XMMATRIX argument.
+-   Elsewhere (tools, servers, tests) GameMath defines the same layouts by itself.
+---------------------------------------------------------------------------*/
+#ifndef GM_SIMD_DIRECTXMATH_INTEROP
+	#if defined(_WIN32)
+		#define GM_SIMD_DIRECTXMATH_INTEROP 1
+	#else
+		#define GM_SIMD_DIRECTXMATH_INTEROP 0
+	#endif
+#endif
+
+#if GM_SIMD_DIRECTXMATH_INTEROP
+	/*-------------------------------------------------------------------
+	-   XMVECTOR must be the register of the selected backend
+	---------------------------------------------------------------------*/
+	#if defined(DIRECTX_MATH_VERSION)
+		#if (GM_SIMD_BACKEND == GM_SIMD_BACKEND_SCALAR) != defined(_XM_NO_INTRINSICS_)
+			#error "GameMath: DirectXMath was included before GMSimdConfig.hpp with another backend. Define GM_SIMD_BACKEND in the project settings."
+		#endif
+		#if GM_SIMD_BACKEND == GM_SIMD_BACKEND_SSE4 && !defined(_XM_SSE4_INTRINSICS_)
+			#error "GameMath: DirectXMath was included before GMSimdConfig.hpp without SSE4. Define GM_SIMD_BACKEND in the project settings."
+		#endif
+	#endif
+
+	#if GM_SIMD_BACKEND == GM_SIMD_BACKEND_SCALAR
+		#ifndef _XM_NO_INTRINSICS_
+		#define _XM_NO_INTRINSICS_
+		#endif
+	#elif GM_SIMD_BACKEND == GM_SIMD_BACKEND_SSE4
+		#ifndef _XM_SSE4_INTRINSICS_
+		#define _XM_SSE4_INTRINSICS_
+		#endif
+	#elif GM_SIMD_BACKEND == GM_SIMD_BACKEND_NEON
+		#ifndef _XM_ARM_NEON_INTRINSICS_
+		#define _XM_ARM_NEON_INTRINSICS_
+		#endif
+	#endif
+#endif
+
+/*---------------------------------------------------------------------------
+-   Compiler
+---------------------------------------------------------------------------*/
+#if defined(_MSC_VER)
+	#define GM_FORCE_INLINE __forceinline
+#else
+	#define GM_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+#endif
@@ -0,0 +1,1058 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdCore.hpp
+///             @brief  Register, storage types and the backend functions of GameMath
+///                     (scalar / SSE2 / SSE4 / NEON)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_CORE_HPP
+#define GM_SIMD_CORE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdConfig.hpp"
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+
+#if GM_SIMD_DIRECTXMATH_INTEROP
+#include <DirectXMath.h>
+#endif
+
+#if defined(GM_SIMD_USE_SSE4)
+#include <smmintrin.h>
+#elif defined(GM_SIMD_USE_SSE2)
+#include <emmintrin.h>
+#elif defined(GM_SIMD_USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(GM_SIMD_USE_NEON) && (defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM64EC))
+#define GM_SIMD_NEON_A64
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------------------
+-   Every backend returns the same bits for the basic operations (add, multiply, divide,
+-   sqrt, min / max, compare, round, dot product ...). The sums of the dot products are
+-   always taken in the order (x + y) + (z + w) and no backend fuses a multiply and an add,
+-   so a result does not depend on the backend except for the sign of a zero.
+-   Exp / Log / Pow are evaluated per lane with the C library on every backend.
+---------------------------------------------------------------------------*/
+namespace gm::simd
+{
+	/****************************************************************************
+	*				  			Types
+	*************************************************************************//**
+	*  @brief     VectorRegister : four floats in a SIMD register
+	*             MatrixRegister : four row registers (row vector convention, v * M)
+	*             FloatNData     : unaligned storage
+	*****************************************************************************/
+#if GM_SIMD_DIRECTXMATH_INTEROP
+	using VectorRegister = DirectX::XMVECTOR;
+	using MatrixRegister = DirectX::XMMATRIX;
+	using VectorF32      = DirectX::XMVECTORF32;
+	using VectorU32      = DirectX::XMVECTORU32;
+	using Float2Data     = DirectX::XMFLOAT2;
+	using Float3Data     = DirectX::XMFLOAT3;
+	using Float4Data     = DirectX::XMFLOAT4;
+	using Float3x3Data   = DirectX::XMFLOAT3X3;
+	using Float3x4Data   = DirectX::XMFLOAT3X4;
+	using Float4x4Data   = DirectX::XMFLOAT4X4;
+#else
+	#if defined(GM_SIMD_USE_SSE2)
+	using VectorRegister = __m128;
+	#elif defined(GM_SIMD_USE_NEON)
+	using VectorRegister = float32x4_t;
+	#else
+	struct alignas(16) VectorRegister { float Value[4]; };
+	#endif
+
+	struct alignas(16) MatrixRegister
+	{
+		VectorRegister r[4];
+	};
+
+	struct alignas(16) VectorF32
+	{
+		union
+		{
+			float          f[4];
+			VectorRegister v;
+		};
+		GM_FORCE_INLINE operator VectorRegister() const noexcept { return v; }
+		GM_FORCE_INLINE operator const float*  () const noexcept { return f; }
+	};
+
+	struct alignas(16) VectorU32
+	{
+		union
+		{
+			std::uint32_t  u[4];
+			VectorRegister v;
+		};
+		GM_FORCE_INLINE operator VectorRegister() const noexcept { return v; }
+	};
+
+	struct Float2Data
+	{
+		float x;
+		float y;
+
+		Float2Data() = default;
+		constexpr Float2Data(float ix, float iy) noexcept : x(ix), y(iy) {}
+		explicit Float2Data(const float* array) noexcept : x(array[0]), y(array[1]) {}
+	};
+
+	struct Float3Data
+	{
+		float x;
+		float y;
+		float z;
+
+		Float3Data() = default;
+		constexpr Float3Data(float ix, float iy, float iz) noexcept : x(ix), y(iy), z(iz) {}
+		explicit Float3Data(const float* array) noexcept : x(array[0]), y(array[1]), z(array[2]) {}
+	};
+
+	struct Float4Data
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+
+		Float4Data() = default;
+		constexpr Float4Data(float ix, float iy, float iz, float iw) noexcept : x(ix), y(iy), z(iz), w(iw) {}
+		explicit Float4Data(const float* array) noexcept : x(array[0]), y(array[1]), z(array[2]), w(array[3]) {}
+	};
+
+	struct Float3x3Data
+	{
+		union
+		{
+			struct
+			{
+				float _11, _12, _13;
+				float _21, _22, _23;
+				float _31, _32, _33;
+			};
+			float m[3][3];
+		};
+
+		Float3x3Data() = default;
+		constexpr Float3x3Data(float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22) noexcept
+			: _11(m00), _12(m01), _13(m02), _21(m10), _22(m11), _23(m12), _31(m20), _32(m21), _33(m22) {}
+		explicit Float3x3Data(const float* array) noexcept { std::memcpy(m, array, sizeof(m)); }
+
+		float  operator() (std::size_t row, std::size_t column) const noexcept { return m[row][column]; }
+		float& operator() (std::size_t row, std::size_t column) noexcept       { return m[row][column]; }
+	};
+
+	/* three rows of four columns (the transposed affine matrix, loaded as the columns of a MatrixRegister) */
+	struct Float3x4Data
+	{
+		union
+		{
+			struct
+			{
+				float _11, _12, _13, _14;
+				float _21, _22, _23, _24;
+				float _31, _32, _33, _34;
+			};
+			float m[3][4];
+			float f[12];
+		};
+
+		Float3x4Data() = default;
+		constexpr Float3x4Data(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23) noexcept
+			: _11(m00), _12(m01), _13(m02), _14(m03), _21(m10), _22(m11), _23(m12), _24(m13), _31(m20), _32(m21), _33(m22), _34(m23) {}
+		explicit Float3x4Data(const float* array) noexcept { std::memcpy(m, array, sizeof(m)); }
+
+		float  operator() (std::size_t row, std::size_t column) const noexcept { return m[row][column]; }
+		float& operator() (std::size_t row, std::size_t column) noexcept       { return m[row][column]; }
+	};
+
+	struct Float4x4Data
+	{
+		union
+		{
+			struct
+			{
+				float _11, _12, _13, _14;
+				float _21, _22, _23, _24;
+				float _31, _32, _33, _34;
+				float _41, _42, _43, _44;
+			};
+			float m[4][4];
+		};
+
+		Float4x4Data() = default;
+		constexpr Float4x4Data(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13,
+			                   float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33) noexcept
+			: _11(m00), _12(m01), _13(m02), _14(m03), _21(m10), _22(m11), _23(m12), _24(m13),
+			  _31(m20), _32(m21), _33(m22), _34(m23), _41(m30), _42(m31), _43(m32), _44(m33) {}
+		explicit Float4x4Data(const float* array) noexcept { std::memcpy(m, array, sizeof(m)); }
+
+		float  operator() (std::size_t row, std::size_t column) const noexcept { return m[row][column]; }
+		float& operator() (std::size_t row, std::size_t column) noexcept       { return m[row][column]; }
+	};
+#endif
+
+	static_assert(sizeof(VectorRegister) == 16, "GameMath: a vector register must be four floats.");
+	static_assert(sizeof(MatrixRegister) == 64, "GameMath: a matrix register must be four vector registers.");
+
+	/****************************************************************************
+	*				  			Constants
+	*****************************************************************************/
+	inline const VectorF32 g_Zero            = { { {  0.0f,  0.0f,  0.0f,  0.0f } } };
+	inline const VectorF32 g_One             = { { {  1.0f,  1.0f,  1.0f,  1.0f } } };
+	inline const VectorF32 g_NegativeOne     = { { { -1.0f, -1.0f, -1.0f, -1.0f } } };
+	inline const VectorF32 g_OneHalf         = { { {  0.5f,  0.5f,  0.5f,  0.5f } } };
+	inline const VectorF32 g_IdentityR0      = { { {  1.0f,  0.0f,  0.0f,  0.0f } } };
+	inline const VectorF32 g_IdentityR1      = { { {  0.0f,  1.0f,  0.0f,  0.0f } } };
+	inline const VectorF32 g_IdentityR2      = { { {  0.0f,  0.0f,  1.0f,  0.0f } } };
+	inline const VectorF32 g_IdentityR3      = { { {  0.0f,  0.0f,  0.0f,  1.0f } } };
+	inline const VectorF32 g_Epsilon         = { { { FLT_EPSILON, FLT_EPSILON, FLT_EPSILON, FLT_EPSILON } } };
+	inline const VectorF32 g_NoFraction      = { { { 8388608.0f, 8388608.0f, 8388608.0f, 8388608.0f } } }; // 2^23 : no fraction bits above
+	inline const VectorF32 g_Pi              = { { { 3.141592654f, 3.141592654f, 3.141592654f, 3.141592654f } } };
+	inline const VectorF32 g_HalfPi          = { { { 1.570796327f, 1.570796327f, 1.570796327f, 1.570796327f } } };
+	inline const VectorF32 g_TwoPi           = { { { 6.283185307f, 6.283185307f, 6.283185307f, 6.283185307f } } };
+	inline const VectorF32 g_ReciprocalTwoPi = { { { 0.159154943f, 0.159154943f, 0.159154943f, 0.159154943f } } };
+	inline const VectorU32 g_NegativeZero    = { { { 0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u } } };
+	inline const VectorU32 g_AbsMask         = { { { 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu } } };
+	inline const VectorU32 g_Infinity        = { { { 0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u } } };
+	inline const VectorU32 g_QNaN            = { { { 0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u } } };
+	inline const VectorU32 g_Mask3           = { { { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u } } };
+	inline const VectorU32 g_Select1110      = { { { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u } } };
+	inline const VectorU32 g_Select1100      = { { { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u } } };
+	inline const VectorU32 g_Select0001      = { { { 0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu } } };
+
+	/****************************************************************************
+	*				  			Lane access
+	*************************************************************************//**
+	*  @brief     Per lane fallback (scalar backend, C library functions, 32 bit ARM)
+	*****************************************************************************/
+	namespace detail
+	{
+		struct FloatLanes { float         f[4]; };
+		struct IntLanes   { std::uint32_t u[4]; };
+
+		GM_FORCE_INLINE FloatLanes ToFloatLanes(VectorRegister v) noexcept { FloatLanes lanes; std::memcpy(lanes.f, &v, sizeof(lanes.f)); return lanes; }
+		GM_FORCE_INLINE IntLanes   ToIntLanes  (VectorRegister v) noexcept { IntLanes   lanes; std::memcpy(lanes.u, &v, sizeof(lanes.u)); return lanes; }
+		GM_FORCE_INLINE VectorRegister FromLanes(const FloatLanes& lanes) noexcept { VectorRegister v; std::memcpy(&v, lanes.f, sizeof(lanes.f)); return v; }
+		GM_FORCE_INLINE VectorRegister FromLanes(const IntLanes&   lanes) noexcept { VectorRegister v; std::memcpy(&v, lanes.u, sizeof(lanes.u)); return v; }
+
+		template<class Function>
+		GM_FORCE_INLINE VectorRegister Map(VectorRegister a, Function function) noexcept
+		{
+			const FloatLanes x = ToFloatLanes(a);
+			FloatLanes result;
+			for (int i = 0; i < 4; ++i) { result.f[i] = function(x.f[i]); }
+			return FromLanes(result);
+		}
+
+		template<class Function>
+		GM_FORCE_INLINE VectorRegister Map(VectorRegister a, VectorRegister b, Function function) noexcept
+		{
+			const FloatLanes x = ToFloatLanes(a);
+			const FloatLanes y = ToFloatLanes(b);
+			FloatLanes result;
+			for (int i = 0; i < 4; ++i) { result.f[i] = function(x.f[i], y.f[i]); }
+			return FromLanes(result);
+		}
+
+		template<class Function>
+		GM_FORCE_INLINE VectorRegister MapInt(VectorRegister a, VectorRegister b, Function function) noexcept
+		{
+			const IntLanes x = ToIntLanes(a);
+			const IntLanes y = ToIntLanes(b);
+			IntLanes result;
+			for (int i = 0; i < 4; ++i) { result.u[i] = function(x.u[i], y.u[i]); }
+			return FromLanes(result);
+		}
+
+		/* compare result of a lane */
+		GM_FORCE_INLINE std::uint32_t Mask(bool condition) noexcept { return condition ? 0xFFFFFFFFu : 0u; }
+
+		GM_FORCE_INLINE float CopySignBit(float value, float sign) noexcept
+		{
+			std::uint32_t v, s;
+			std::memcpy(&v, &value, sizeof(v));
+			std::memcpy(&s, &sign , sizeof(s));
+			v |= (s & 0x80000000u);
+			std::memcpy(&value, &v, sizeof(v));
+			return value;
+		}
+	}
+
+#pragma region Set and Get
+	/****************************************************************************
+	*				  			Set
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister VectorZero() noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_setzero_ps();
+#elif defined(GM_SIMD_USE_NEON)
+		return vdupq_n_f32(0.0f);
+#else
+		return detail::FromLanes(detail::FloatLanes{ { 0.0f, 0.0f, 0.0f, 0.0f } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSet(float x, float y, float z, float w) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_set_ps(w, z, y, x);
+#elif defined(GM_SIMD_USE_NEON)
+		const float values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+#else
+		return detail::FromLanes(detail::FloatLanes{ { x, y, z, w } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSetInt(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t w) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_castsi128_ps(_mm_set_epi32((int)w, (int)z, (int)y, (int)x));
+#elif defined(GM_SIMD_USE_NEON)
+		const std::uint32_t values[4] = { x, y, z, w };
+		return vreinterpretq_f32_u32(vld1q_u32(values));
+#else
+		return detail::FromLanes(detail::IntLanes{ { x, y, z, w } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorReplicate(float value) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_set_ps1(value);
+#elif defined(GM_SIMD_USE_NEON)
+		return vdupq_n_f32(value);
+#else
+		return detail::FromLanes(detail::FloatLanes{ { value, value, value, value } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorReplicateInt(std::uint32_t value) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_castsi128_ps(_mm_set1_epi32((int)value));
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vdupq_n_u32(value));
+#else
+		return detail::FromLanes(detail::IntLanes{ { value, value, value, value } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSplatOne() noexcept { return VectorReplicate(1.0f); }
+	GM_FORCE_INLINE VectorRegister VectorTrueInt () noexcept { return VectorReplicateInt(0xFFFFFFFFu); }
+
+	/****************************************************************************
+	*				  			Get
+	*****************************************************************************/
+	template<int Index>
+	GM_FORCE_INLINE float VectorGetByIndex(VectorRegister v) noexcept
+	{
+		static_assert(0 <= Index && Index < 4, "GameMath: lane index out of range");
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(Index, Index, Index, Index)));
+#elif defined(GM_SIMD_USE_NEON)
+		return vgetq_lane_f32(v, Index);
+#else
+		return detail::ToFloatLanes(v).f[Index];
+#endif
+	}
+
+	template<int Index>
+	GM_FORCE_INLINE std::uint32_t VectorGetIntByIndex(VectorRegister v) noexcept
+	{
+		static_assert(0 <= Index && Index < 4, "GameMath: lane index out of range");
+#if defined(GM_SIMD_USE_SSE4)
+		return (std::uint32_t)_mm_extract_epi32(_mm_castps_si128(v), Index);
+#elif defined(GM_SIMD_USE_SSE2)
+		return (std::uint32_t)_mm_cvtsi128_si32(_mm_castps_si128(_mm_shuffle_ps(v, v, _MM_SHUFFLE(Index, Index, Index, Index))));
+#elif defined(GM_SIMD_USE_NEON)
+		return vgetq_lane_u32(vreinterpretq_u32_f32(v), Index);
+#else
+		return detail::ToIntLanes(v).u[Index];
+#endif
+	}
+
+	GM_FORCE_INLINE float VectorGetX(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cvtss_f32(v);
+#else
+		return VectorGetByIndex<0>(v);
+#endif
+	}
+	GM_FORCE_INLINE float VectorGetY(VectorRegister v) noexcept { return VectorGetByIndex<1>(v); }
+	GM_FORCE_INLINE float VectorGetZ(VectorRegister v) noexcept { return VectorGetByIndex<2>(v); }
+	GM_FORCE_INLINE float VectorGetW(VectorRegister v) noexcept { return VectorGetByIndex<3>(v); }
+
+	GM_FORCE_INLINE std::uint32_t VectorGetIntX(VectorRegister v) noexcept { return VectorGetIntByIndex<0>(v); }
+	GM_FORCE_INLINE std::uint32_t VectorGetIntY(VectorRegister v) noexcept { return VectorGetIntByIndex<1>(v); }
+	GM_FORCE_INLINE std::uint32_t VectorGetIntZ(VectorRegister v) noexcept { return VectorGetIntByIndex<2>(v); }
+	GM_FORCE_INLINE std::uint32_t VectorGetIntW(VectorRegister v) noexcept { return VectorGetIntByIndex<3>(v); }
+
+	/****************************************************************************
+	*				  			Set one lane
+	*****************************************************************************/
+	template<int Index>
+	GM_FORCE_INLINE VectorRegister VectorSetByIndex(VectorRegister v, float value) noexcept
+	{
+		static_assert(0 <= Index && Index < 4, "GameMath: lane index out of range");
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_insert_ps(v, _mm_set_ss(value), Index << 4);
+#elif defined(GM_SIMD_USE_SSE2)
+		if constexpr (Index == 0) { return _mm_move_ss(v, _mm_set_ss(value)); }
+		else
+		{
+			/*--- swap the lane with x, replace x and swap back ---*/
+			constexpr int shuffle = Index == 1 ? _MM_SHUFFLE(3, 2, 0, 1) : Index == 2 ? _MM_SHUFFLE(3, 0, 1, 2) : _MM_SHUFFLE(0, 2, 1, 3);
+			VectorRegister result = _mm_shuffle_ps(v, v, shuffle);
+			result = _mm_move_ss(result, _mm_set_ss(value));
+			return _mm_shuffle_ps(result, result, shuffle);
+		}
+#elif defined(GM_SIMD_USE_NEON)
+		return vsetq_lane_f32(value, v, Index);
+#else
+		detail::FloatLanes lanes = detail::ToFloatLanes(v);
+		lanes.f[Index] = value;
+		return detail::FromLanes(lanes);
+#endif
+	}
+	GM_FORCE_INLINE VectorRegister VectorSetX(VectorRegister v, float x) noexcept { return VectorSetByIndex<0>(v, x); }
+	GM_FORCE_INLINE VectorRegister VectorSetY(VectorRegister v, float y) noexcept { return VectorSetByIndex<1>(v, y); }
+	GM_FORCE_INLINE VectorRegister VectorSetZ(VectorRegister v, float z) noexcept { return VectorSetByIndex<2>(v, z); }
+	GM_FORCE_INLINE VectorRegister VectorSetW(VectorRegister v, float w) noexcept { return VectorSetByIndex<3>(v, w); }
+#pragma endregion Set and Get
+
+#pragma region Load and Store
+	/****************************************************************************
+	*				  			Load
+	*****************************************************************************/
+	/* four unaligned floats */
+	GM_FORCE_INLINE VectorRegister VectorLoad(const float* source) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_loadu_ps(source);
+#elif defined(GM_SIMD_USE_NEON)
+		return vld1q_f32(source);
+#else
+		detail::FloatLanes lanes;
+		std::memcpy(lanes.f, source, sizeof(lanes.f));
+		return detail::FromLanes(lanes);
+#endif
+	}
+
+	/* (x, y, 0, 0) */
+	GM_FORCE_INLINE VectorRegister LoadFloat2(const Float2Data* source) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(source)));
+#elif defined(GM_SIMD_USE_NEON)
+		return vcombine_f32(vld1_f32(&source->x), vdup_n_f32(0.0f));
+#else
+		return VectorSet(source->x, source->y, 0.0f, 0.0f);
+#endif
+	}
+
+	/* (x, y, z, 0) */
+	GM_FORCE_INLINE VectorRegister LoadFloat3(const Float3Data* source) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		const VectorRegister xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(source)));
+		const VectorRegister z  = _mm_load_ss(&source->z);
+		return _mm_movelh_ps(xy, z);
+#elif defined(GM_SIMD_USE_NEON)
+		const float32x2_t xy = vld1_f32(&source->x);
+		const float32x2_t z0 = vld1_lane_f32(&source->z, vdup_n_f32(0.0f), 0);
+		return vcombine_f32(xy, z0);
+#else
+		return VectorSet(source->x, source->y, source->z, 0.0f);
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister LoadFloat4(const Float4Data* source) noexcept
+	{
+		return VectorLoad(&source->x);
+	}
+
+	/****************************************************************************
+	*				  			Store
+	*****************************************************************************/
+	GM_FORCE_INLINE void VectorStore(float* destination, VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		_mm_storeu_ps(destination, v);
+#elif defined(GM_SIMD_USE_NEON)
+		vst1q_f32(destination, v);
+#else
+		const detail::FloatLanes lanes = detail::ToFloatLanes(v);
+		std::memcpy(destination, lanes.f, sizeof(lanes.f));
+#endif
+	}
+
+	GM_FORCE_INLINE void StoreFloat2(Float2Data* destination, VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		_mm_store_sd(reinterpret_cast<double*>(destination), _mm_castps_pd(v));
+#elif defined(GM_SIMD_USE_NEON)
+		vst1_f32(&destination->x, vget_low_f32(v));
+#else
+		const detail::FloatLanes lanes = detail::ToFloatLanes(v);
+		destination->x = lanes.f[0];
+		destination->y = lanes.f[1];
+#endif
+	}
+
+	GM_FORCE_INLINE void StoreFloat3(Float3Data* destination, VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		_mm_store_sd(reinterpret_cast<double*>(destination), _mm_castps_pd(v));
+		_mm_store_ss(&destination->z, _mm_movehl_ps(v, v));
+#elif defined(GM_SIMD_USE_NEON)
+		vst1_f32(&destination->x, vget_low_f32(v));
+		vst1q_lane_f32(&destination->z, v, 2);
+#else
+		const detail::FloatLanes lanes = detail::ToFloatLanes(v);
+		destination->x = lanes.f[0];
+		destination->y = lanes.f[1];
+		destination->z = lanes.f[2];
+#endif
+	}
+
+	GM_FORCE_INLINE void StoreFloat4(Float4Data* destination, VectorRegister v) noexcept
+	{
+		VectorStore(&destination->x, v);
+	}
+#pragma endregion Load and Store
+
+#pragma region Arithmetic
+	/****************************************************************************
+	*				  			Arithmetic
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister VectorAdd(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_add_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vaddq_f32(a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x + y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSubtract(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_sub_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vsubq_f32(a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x - y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorMultiply(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_mul_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vmulq_f32(a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x * y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorDivide(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_div_ps(a, b);
+#elif defined(GM_SIMD_NEON_A64)
+		return vdivq_f32(a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x / y; });
+#endif
+	}
+
+	/* a * b + c (not fused) */
+	GM_FORCE_INLINE VectorRegister VectorMultiplyAdd(VectorRegister a, VectorRegister b, VectorRegister c) noexcept
+	{
+		return VectorAdd(VectorMultiply(a, b), c);
+	}
+
+	/* c - a * b (not fused) */
+	GM_FORCE_INLINE VectorRegister VectorNegativeMultiplySubtract(VectorRegister a, VectorRegister b, VectorRegister c) noexcept
+	{
+		return VectorSubtract(c, VectorMultiply(a, b));
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorScale(VectorRegister v, float scale) noexcept
+	{
+		return VectorMultiply(v, VectorReplicate(scale));
+	}
+
+	/* 0 - v */
+	GM_FORCE_INLINE VectorRegister VectorNegate(VectorRegister v) noexcept
+	{
+		return VectorSubtract(VectorZero(), v);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorAbs(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_and_ps(v, g_AbsMask);
+#elif defined(GM_SIMD_USE_NEON)
+		return vabsq_f32(v);
+#else
+		return detail::Map(v, [](float x) { return std::fabs(x); });
+#endif
+	}
+
+	/* a < b ? a : b (the second one for NaN) */
+	GM_FORCE_INLINE VectorRegister VectorMin(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_min_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vbslq_f32(vcltq_f32(a, b), a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x < y ? x : y; });
+#endif
+	}
+
+	/* a > b ? a : b (the second one for NaN) */
+	GM_FORCE_INLINE VectorRegister VectorMax(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_max_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vbslq_f32(vcgtq_f32(a, b), a, b);
+#else
+		return detail::Map(a, b, [](float x, float y) { return x > y ? x : y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorClamp(VectorRegister v, VectorRegister minimum, VectorRegister maximum) noexcept
+	{
+		return VectorMin(VectorMax(minimum, v), maximum);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSaturate(VectorRegister v) noexcept
+	{
+		return VectorMin(VectorMax(v, VectorZero()), g_One);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSqrt(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_sqrt_ps(v);
+#elif defined(GM_SIMD_NEON_A64)
+		return vsqrtq_f32(v);
+#else
+		return detail::Map(v, [](float x) { return std::sqrt(x); });
+#endif
+	}
+
+	/* 1 / v (exact division, not the estimate) */
+	GM_FORCE_INLINE VectorRegister VectorReciprocal(VectorRegister v) noexcept
+	{
+		return VectorDivide(g_One, v);
+	}
+
+	/* 1 / sqrt(v) */
+	GM_FORCE_INLINE VectorRegister VectorReciprocalSqrt(VectorRegister v) noexcept
+	{
+		return VectorDivide(g_One, VectorSqrt(v));
+	}
+#pragma endregion Arithmetic
+
+#pragma region Bitwise
+	/****************************************************************************
+	*				  			Bitwise
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister VectorAndInt(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_and_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+		return detail::MapInt(a, b, [](std::uint32_t x, std::uint32_t y) { return x & y; });
+#endif
+	}
+
+	/* a & ~b */
+	GM_FORCE_INLINE VectorRegister VectorAndCInt(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_andnot_ps(b, a);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+		return detail::MapInt(a, b, [](std::uint32_t x, std::uint32_t y) { return x & ~y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorOrInt(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_or_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+		return detail::MapInt(a, b, [](std::uint32_t x, std::uint32_t y) { return x | y; });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorXorInt(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_xor_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+		return detail::MapInt(a, b, [](std::uint32_t x, std::uint32_t y) { return x ^ y; });
+#endif
+	}
+
+	/* lane of b where the mask is set, otherwise lane of a */
+	GM_FORCE_INLINE VectorRegister VectorSelect(VectorRegister a, VectorRegister b, VectorRegister mask) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(b, mask));
+#elif defined(GM_SIMD_USE_NEON)
+		return vbslq_f32(vreinterpretq_u32_f32(mask), b, a);
+#else
+		const detail::IntLanes x = detail::ToIntLanes(a);
+		const detail::IntLanes y = detail::ToIntLanes(b);
+		const detail::IntLanes m = detail::ToIntLanes(mask);
+		detail::IntLanes result;
+		for (int i = 0; i < 4; ++i) { result.u[i] = (x.u[i] & ~m.u[i]) | (y.u[i] & m.u[i]); }
+		return detail::FromLanes(result);
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSelectControl(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t w) noexcept
+	{
+		return VectorSetInt(x ? 0xFFFFFFFFu : 0u, y ? 0xFFFFFFFFu : 0u, z ? 0xFFFFFFFFu : 0u, w ? 0xFFFFFFFFu : 0u);
+	}
+#pragma endregion Bitwise
+
+#pragma region Compare
+	/****************************************************************************
+	*				  			Compare (all bits of a lane are set when true)
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister VectorEqual(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cmpeq_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vceqq_f32(a, b));
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return detail::FromLanes(detail::IntLanes{ { detail::Mask(x.f[0] == y.f[0]), detail::Mask(x.f[1] == y.f[1]), detail::Mask(x.f[2] == y.f[2]), detail::Mask(x.f[3] == y.f[3]) } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorNotEqual(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cmpneq_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a, b)));
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return detail::FromLanes(detail::IntLanes{ { detail::Mask(x.f[0] != y.f[0]), detail::Mask(x.f[1] != y.f[1]), detail::Mask(x.f[2] != y.f[2]), detail::Mask(x.f[3] != y.f[3]) } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorLess(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cmplt_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vcltq_f32(a, b));
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return detail::FromLanes(detail::IntLanes{ { detail::Mask(x.f[0] < y.f[0]), detail::Mask(x.f[1] < y.f[1]), detail::Mask(x.f[2] < y.f[2]), detail::Mask(x.f[3] < y.f[3]) } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorLessOrEqual(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_cmple_ps(a, b);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vcleq_f32(a, b));
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return detail::FromLanes(detail::IntLanes{ { detail::Mask(x.f[0] <= y.f[0]), detail::Mask(x.f[1] <= y.f[1]), detail::Mask(x.f[2] <= y.f[2]), detail::Mask(x.f[3] <= y.f[3]) } });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorGreater(VectorRegister a, VectorRegister b) noexcept
+	{
+		return VectorLess(b, a);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorGreaterOrEqual(VectorRegister a, VectorRegister b) noexcept
+	{
+		return VectorLessOrEqual(b, a);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorEqualInt(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_castps_si128(a), _mm_castps_si128(b)));
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_u32(vceqq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+		return detail::MapInt(a, b, [](std::uint32_t x, std::uint32_t y) { return detail::Mask(x == y); });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorIsNaN(VectorRegister v) noexcept
+	{
+		return VectorNotEqual(v, v);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorIsInfinite(VectorRegister v) noexcept
+	{
+		return VectorEqualInt(VectorAndInt(v, g_AbsMask), g_Infinity);
+	}
+
+	/* bit i : lane i of the compare result */
+	GM_FORCE_INLINE int VectorMoveMask(VectorRegister mask) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_movemask_ps(mask);
+#elif defined(GM_SIMD_USE_NEON)
+		const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+		return (int)(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+#else
+		const detail::IntLanes m = detail::ToIntLanes(mask);
+		return (int)((m.u[0] >> 31) | ((m.u[1] >> 31) << 1) | ((m.u[2] >> 31) << 2) | ((m.u[3] >> 31) << 3));
+#endif
+	}
+#pragma endregion Compare
+
+#pragma region Swizzle
+	/****************************************************************************
+	*				  			Swizzle and Permute
+	*****************************************************************************/
+	/* (v[X], v[Y], v[Z], v[W]) */
+	template<int X, int Y, int Z, int W>
+	GM_FORCE_INLINE VectorRegister VectorSwizzle(VectorRegister v) noexcept
+	{
+		static_assert(0 <= X && X < 4 && 0 <= Y && Y < 4 && 0 <= Z && Z < 4 && 0 <= W && W < 4, "GameMath: swizzle index out of range");
+#if defined(GM_SIMD_USE_SSE2)
+		return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(GM_SIMD_USE_NEON)
+		if constexpr (X == 0 && Y == 1 && Z == 2 && W == 3) { return v; }
+		else if constexpr (X == Y && Y == Z && Z == W)      { return vdupq_n_f32(vgetq_lane_f32(v, X)); }
+		else
+		{
+			float32x4_t result = vdupq_n_f32(vgetq_lane_f32(v, X));
+			result = vsetq_lane_f32(vgetq_lane_f32(v, Y), result, 1);
+			result = vsetq_lane_f32(vgetq_lane_f32(v, Z), result, 2);
+			result = vsetq_lane_f32(vgetq_lane_f32(v, W), result, 3);
+			return result;
+		}
+#else
+		const detail::FloatLanes lanes = detail::ToFloatLanes(v);
+		return detail::FromLanes(detail::FloatLanes{ { lanes.f[X], lanes.f[Y], lanes.f[Z], lanes.f[W] } });
+#endif
+	}
+
+	/* index 0-3 : lane of a, 4-7 : lane of b */
+	template<int X, int Y, int Z, int W>
+	GM_FORCE_INLINE VectorRegister VectorPermute(VectorRegister a, VectorRegister b) noexcept
+	{
+		static_assert(0 <= X && X < 8 && 0 <= Y && Y < 8 && 0 <= Z && Z < 8 && 0 <= W && W < 8, "GameMath: permute index out of range");
+		if constexpr (X < 4 && Y < 4 && Z < 4 && W < 4)       { return VectorSwizzle<X, Y, Z, W>(a); }
+		else if constexpr (X > 3 && Y > 3 && Z > 3 && W > 3)  { return VectorSwizzle<X - 4, Y - 4, Z - 4, W - 4>(b); }
+#if defined(GM_SIMD_USE_SSE2)
+		/*--- x, y from a and z, w from b (or the reverse) is one shuffle ---*/
+		else if constexpr (X < 4 && Y < 4 && Z > 3 && W > 3)  { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W - 4, Z - 4, Y, X)); }
+		else if constexpr (X > 3 && Y > 3 && Z < 4 && W < 4)  { return _mm_shuffle_ps(b, a, _MM_SHUFFLE(W, Z, Y - 4, X - 4)); }
+#endif
+		else
+		{
+			const VectorRegister fromA = VectorSwizzle<X & 3, Y & 3, Z & 3, W & 3>(a);
+			const VectorRegister fromB = VectorSwizzle<X & 3, Y & 3, Z & 3, W & 3>(b);
+			return VectorSelect(fromA, fromB, VectorSelectControl(X > 3, Y > 3, Z > 3, W > 3));
+		}
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorSplatX(VectorRegister v) noexcept { return VectorSwizzle<0, 0, 0, 0>(v); }
+	GM_FORCE_INLINE VectorRegister VectorSplatY(VectorRegister v) noexcept { return VectorSwizzle<1, 1, 1, 1>(v); }
+	GM_FORCE_INLINE VectorRegister VectorSplatZ(VectorRegister v) noexcept { return VectorSwizzle<2, 2, 2, 2>(v); }
+	GM_FORCE_INLINE VectorRegister VectorSplatW(VectorRegister v) noexcept { return VectorSwizzle<3, 3, 3, 3>(v); }
+#pragma endregion Swizzle
+
+#pragma region Rounding
+	/****************************************************************************
+	*				  			Rounding
+	*************************************************************************//**
+	*  @brief     The emulated paths (SSE2, 32 bit ARM) copy the sign bit of the input,
+	*             so -0.25 rounds to -0 as with the instructions.
+	*****************************************************************************/
+	/* to the nearest integer (ties to even) */
+	GM_FORCE_INLINE VectorRegister VectorRound(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#elif defined(GM_SIMD_USE_SSE2)
+		/*--- adding and subtracting 2^23 drops the fraction with the rounding of the FPU ---*/
+		const VectorRegister sign   = _mm_and_ps(v, g_NegativeZero);
+		const VectorRegister magic  = _mm_or_ps(g_NoFraction, sign);
+		VectorRegister       result = _mm_sub_ps(_mm_add_ps(v, magic), magic);
+		result = _mm_or_ps(result, sign);
+		const VectorRegister hasFraction = _mm_cmplt_ps(_mm_and_ps(v, g_AbsMask), g_NoFraction);
+		return VectorSelect(v, result, hasFraction);
+#elif defined(GM_SIMD_NEON_A64)
+		return vrndnq_f32(v);
+#else
+		return detail::Map(v, [](float x) { return std::nearbyint(x); });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorFloor(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_floor_ps(v);
+#elif defined(GM_SIMD_USE_SSE2)
+		VectorRegister result = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+		result = _mm_sub_ps(result, _mm_and_ps(_mm_cmpgt_ps(result, v), g_One));
+		result = _mm_or_ps(result, _mm_and_ps(v, g_NegativeZero));
+		const VectorRegister hasFraction = _mm_cmplt_ps(_mm_and_ps(v, g_AbsMask), g_NoFraction);
+		return VectorSelect(v, result, hasFraction);
+#elif defined(GM_SIMD_NEON_A64)
+		return vrndmq_f32(v);
+#else
+		return detail::Map(v, [](float x) { return std::floor(x); });
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorCeiling(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_ceil_ps(v);
+#elif defined(GM_SIMD_USE_SSE2)
+		VectorRegister result = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+		result = _mm_add_ps(result, _mm_and_ps(_mm_cmplt_ps(result, v), g_One));
+		result = _mm_or_ps(result, _mm_and_ps(v, g_NegativeZero));
+		const VectorRegister hasFraction = _mm_cmplt_ps(_mm_and_ps(v, g_AbsMask), g_NoFraction);
+		return VectorSelect(v, result, hasFraction);
+#elif defined(GM_SIMD_NEON_A64)
+		return vrndpq_f32(v);
+#else
+		return detail::Map(v, [](float x) { return std::ceil(x); });
+#endif
+	}
+
+	/* float -> int32 (truncate). Out of range values saturate, NaN is INT_MIN (0 on NEON) */
+	GM_FORCE_INLINE VectorRegister VectorConvertFloatToInt(VectorRegister v) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE2)
+		const VectorRegister overflow = _mm_cmpge_ps(v, _mm_set_ps1(2147483648.0f));
+		const VectorRegister result   = _mm_castsi128_ps(_mm_cvttps_epi32(v));
+		return VectorSelect(result, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)), overflow);
+#elif defined(GM_SIMD_USE_NEON)
+		return vreinterpretq_f32_s32(vcvtq_s32_f32(v));
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(v);
+		detail::IntLanes result;
+		for (int i = 0; i < 4; ++i)
+		{
+			if      (x.f[i] != x.f[i])           { result.u[i] = 0x80000000u; }
+			else if (x.f[i] >=  2147483648.0f)   { result.u[i] = 0x7FFFFFFFu; }
+			else if (x.f[i] <  -2147483648.0f)   { result.u[i] = 0x80000000u; }
+			else                                 { result.u[i] = (std::uint32_t)(std::int32_t)x.f[i]; }
+		}
+		return detail::FromLanes(result);
+#endif
+	}
+#pragma endregion Rounding
+
+#pragma region Dot
+	/****************************************************************************
+	*				  			Dot product (the result is in all lanes)
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister Vector2Dot(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_dp_ps(a, b, 0x3F);
+#elif defined(GM_SIMD_USE_SSE2)
+		const VectorRegister product = _mm_mul_ps(a, b);
+		const VectorRegister sum     = _mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1)));
+		return _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0));
+#elif defined(GM_SIMD_USE_NEON)
+		const float32x2_t product = vmul_f32(vget_low_f32(a), vget_low_f32(b));
+		const float32x2_t sum     = vpadd_f32(product, product);
+		return vcombine_f32(sum, sum);
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return VectorReplicate(x.f[0] * y.f[0] + x.f[1] * y.f[1]);
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister Vector3Dot(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_dp_ps(a, b, 0x7F);
+#elif defined(GM_SIMD_USE_SSE2)
+		const VectorRegister product = _mm_mul_ps(a, b);
+		VectorRegister sum = _mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1)));
+		sum = _mm_add_ss(sum, _mm_movehl_ps(product, product));
+		return _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0));
+#elif defined(GM_SIMD_USE_NEON)
+		const float32x4_t product = vmulq_f32(a, b);
+		const float32x2_t xy      = vget_low_f32(product);
+		const float32x2_t xySum   = vpadd_f32(xy, xy);
+		const float32x2_t sum     = vadd_f32(xySum, vdup_lane_f32(vget_high_f32(product), 0));
+		return vcombine_f32(sum, sum);
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return VectorReplicate((x.f[0] * y.f[0] + x.f[1] * y.f[1]) + x.f[2] * y.f[2]);
+#endif
+	}
+
+	GM_FORCE_INLINE VectorRegister Vector4Dot(VectorRegister a, VectorRegister b) noexcept
+	{
+#if defined(GM_SIMD_USE_SSE4)
+		return _mm_dp_ps(a, b, 0xFF);
+#elif defined(GM_SIMD_USE_SSE2)
+		/*--- (x + y) + (z + w) in every lane ---*/
+		const VectorRegister product = _mm_mul_ps(a, b);
+		const VectorRegister pair    = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(pair, _mm_shuffle_ps(pair, pair, _MM_SHUFFLE(1, 0, 3, 2)));
+#elif defined(GM_SIMD_NEON_A64)
+		const float32x4_t product = vmulq_f32(a, b);
+		const float32x4_t pair    = vpaddq_f32(product, product);
+		return vpaddq_f32(pair, pair);
+#elif defined(GM_SIMD_USE_NEON)
+		const float32x4_t product = vmulq_f32(a, b);
+		const float32x2_t pair    = vpadd_f32(vget_low_f32(product), vget_high_f32(product));
+		const float32x2_t sum     = vpadd_f32(pair, pair);
+		return vcombine_f32(sum, sum);
+#else
+		const detail::FloatLanes x = detail::ToFloatLanes(a), y = detail::ToFloatLanes(b);
+		return VectorReplicate((x.f[0] * y.f[0] + x.f[1] * y.f[1]) + (x.f[2] * y.f[2] + x.f[3] * y.f[3]));
+#endif
+	}
+#pragma endregion Dot
+}
+
+#endif
@@ -24,7 +24,6 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMVectorUtility.hpp"
-#include <DirectXMath.h>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -32,37 +31,37 @@
 namespace gm
 {
 #define CREATE_SIMD_FUNCTIONS( TYPE ) \
-	INLINE TYPE Sqrt( const TYPE& s )                                { return TYPE(DirectX::XMVectorSqrt(s)); } \
-	INLINE TYPE Recip( const TYPE& s )                               { return TYPE(DirectX::XMVectorReciprocal(s)); } \
-	INLINE TYPE RecipSqrt( const TYPE& s )                           { return TYPE(DirectX::XMVectorReciprocalSqrt(s)); } \
-	INLINE TYPE Floor( const TYPE& s )                               { return TYPE(DirectX::XMVectorFloor(s)); } \
-	INLINE TYPE Ceiling( const TYPE& s )                             { return TYPE(DirectX::XMVectorCeiling(s)); } \
-	INLINE TYPE Round( const TYPE& s )                               { return TYPE(DirectX::XMVectorRound(s)); } \
-	INLINE TYPE Abs( const TYPE& s )                                 { return TYPE(DirectX::XMVectorAbs(s)); } \
-	INLINE TYPE Exp( const TYPE& s )                                 { return TYPE(DirectX::XMVectorExp(s)); } \
-	INLINE TYPE Pow( const TYPE& b, const TYPE& e )                  { return TYPE(DirectX::XMVectorPow(b, e)); } \
-	INLINE TYPE Log( const TYPE& s )                                 { return TYPE(DirectX::XMVectorLog(s)); } \
-	INLINE TYPE Sin( const TYPE& s )                                 { return TYPE(DirectX::XMVectorSin(s)); } \
-	INLINE TYPE Cos( const TYPE& s )                                 { return TYPE(DirectX::XMVectorCos(s)); } \
-	INLINE TYPE Tan( const TYPE& s )                                 { return TYPE(DirectX::XMVectorTan(s)); } \
-	INLINE TYPE ASin( const TYPE& s )                                { return TYPE(DirectX::XMVectorASin(s)); } \
-	INLINE TYPE ACos( const TYPE& s )                                { return TYPE(DirectX::XMVectorACos(s)); } \
-	INLINE TYPE ATan( const TYPE& s )                                { return TYPE(DirectX::XMVectorATan(s)); } \
-	INLINE TYPE ATan2( const TYPE& y, const TYPE& x )                { return TYPE(DirectX::XMVectorATan2(y, x)); } \
-	INLINE TYPE Lerp( const TYPE& a, const TYPE& b, const TYPE& t )  { return TYPE(DirectX::XMVectorLerpV(a, b, t)); } \
-    INLINE TYPE Lerp( const TYPE& a, const TYPE& b, float t )        { return TYPE(DirectX::XMVectorLerp(a, b, t)); } \
+	INLINE TYPE Sqrt( const TYPE& s )                                { return TYPE(simd::VectorSqrt(s)); } \
+	INLINE TYPE Recip( const TYPE& s )                               { return TYPE(simd::VectorReciprocal(s)); } \
+	INLINE TYPE RecipSqrt( const TYPE& s )                           { return TYPE(simd::VectorReciprocalSqrt(s)); } \
+	INLINE TYPE Floor( const TYPE& s )                               { return TYPE(simd::VectorFloor(s)); } \
+	INLINE TYPE Ceiling( const TYPE& s )                             { return TYPE(simd::VectorCeiling(s)); } \
+	INLINE TYPE Round( const TYPE& s )                               { return TYPE(simd::VectorRound(s)); } \
+	INLINE TYPE Abs( const TYPE& s )                                 { return TYPE(simd::VectorAbs(s)); } \
+	INLINE TYPE Exp( const TYPE& s )                                 { return TYPE(simd::VectorExp(s)); } \
+	INLINE TYPE Pow( const TYPE& b, const TYPE& e )                  { return TYPE(simd::VectorPow(b, e)); } \
+	INLINE TYPE Log( const TYPE& s )                                 { return TYPE(simd::VectorLog(s)); } \
+	INLINE TYPE Sin( const TYPE& s )                                 { return TYPE(simd::VectorSin(s)); } \
+	INLINE TYPE Cos( const TYPE& s )                                 { return TYPE(simd::VectorCos(s)); } \
+	INLINE TYPE Tan( const TYPE& s )                                 { return TYPE(simd::VectorTan(s)); } \
+	INLINE TYPE ASin( const TYPE& s )                                { return TYPE(simd::VectorASin(s)); } \
+	INLINE TYPE ACos( const TYPE& s )                                { return TYPE(simd::VectorACos(s)); } \
+	INLINE TYPE ATan( const TYPE& s )                                { return TYPE(simd::VectorATan(s)); } \
+	INLINE TYPE ATan2( const TYPE& y, const TYPE& x )                { return TYPE(simd::VectorATan2(y, x)); } \
+	INLINE TYPE Lerp( const TYPE& a, const TYPE& b, const TYPE& t )  { return TYPE(simd::VectorLerpV(a, b, t)); } \
+    INLINE TYPE Lerp( const TYPE& a, const TYPE& b, float t )        { return TYPE(simd::VectorLerp(a, b, t)); } \
     INLINE TYPE SmoothStep (const TYPE& a, const TYPE& b, float t)   { t = (t > 1.0f) ? 1.0f : ((t < 0.0f) ? 0.0f : t); t = t * t * (3.f - 2.f * t); \
-	                                                                   return TYPE(DirectX::XMVectorLerp(a, b, t)); }  \
-	INLINE TYPE Max( const TYPE& a, const TYPE& b )                  { return TYPE(DirectX::XMVectorMax(a, b)); } \
-	INLINE TYPE Min( const TYPE& a, const TYPE& b )                  { return TYPE(DirectX::XMVectorMin(a, b)); } \
+	                                                                   return TYPE(simd::VectorLerp(a, b, t)); }  \
+	INLINE TYPE Max( const TYPE& a, const TYPE& b )                  { return TYPE(simd::VectorMax(a, b)); } \
+	INLINE TYPE Min( const TYPE& a, const TYPE& b )                  { return TYPE(simd::VectorMin(a, b)); } \
 	INLINE TYPE Clamp( const TYPE& v, const TYPE& a, const TYPE& b ) { return Min(Max(v, a), b); } \
-	INLINE BoolVector operator<  ( const TYPE& lhs, const TYPE& rhs ){ return DirectX::XMVectorLess(lhs, rhs); } \
-	INLINE BoolVector operator<= ( const TYPE& lhs, const TYPE& rhs ){ return DirectX::XMVectorLessOrEqual(lhs, rhs); } \
-	INLINE BoolVector operator>  ( const TYPE& lhs, const TYPE& rhs ){ return DirectX::XMVectorGreater(lhs, rhs); } \
-	INLINE BoolVector operator>= ( const TYPE& lhs, const TYPE& rhs ){ return DirectX::XMVectorGreaterOrEqual(lhs, rhs); } \
-	INLINE TYPE Select( const TYPE& lhs, const TYPE& rhs, BoolVector mask ) { return TYPE(DirectX::XMVectorSelect(lhs, rhs, mask)); }\
+	INLINE BoolVector operator<  ( const TYPE& lhs, const TYPE& rhs ){ return simd::VectorLess(lhs, rhs); } \
+	INLINE BoolVector operator<= ( const TYPE& lhs, const TYPE& rhs ){ return simd::VectorLessOrEqual(lhs, rhs); } \
+	INLINE BoolVector operator>  ( const TYPE& lhs, const TYPE& rhs ){ return simd::VectorGreater(lhs, rhs); } \
+	INLINE BoolVector operator>= ( const TYPE& lhs, const TYPE& rhs ){ return simd::VectorGreaterOrEqual(lhs, rhs); } \
+	INLINE TYPE Select( const TYPE& lhs, const TYPE& rhs, BoolVector mask ) { return TYPE(simd::VectorSelect(lhs, rhs, mask)); }\
 	INLINE void Swap(TYPE& a, TYPE& b){TYPE temp = a; a=b;b = temp;}
 }
 
-//INLINE BoolVector operator== ( const TYPE& lhs, const TYPE& rhs ){ return DirectX::XMVectorEqual(lhs, rhs); } 
+//INLINE BoolVector operator== ( const TYPE& lhs, const TYPE& rhs ){ return simd::VectorEqual(lhs, rhs); } 
 #endif
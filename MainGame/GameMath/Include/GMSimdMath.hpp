@@ -0,0 +1,1331 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdMath.hpp
+///             @brief  Vector, matrix, quaternion and color functions of GameMath
+///                     built on the backend functions of GMSimdCore.hpp
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_MATH_HPP
+#define GM_SIMD_MATH_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdCore.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------------------
+-   The formulas and the conventions follow DirectXMath, which the engine used before:
+-   row vectors (v * M), left handed and right handed projection, Exp / Log in base 2,
+-   QuaternionMultiply(q1, q2) is the rotation q1 followed by q2.
+-   The polynomial approximations (Sin, Cos, ACos, ATan) are written only here, so every
+-   backend evaluates the same operations in the same order.
+---------------------------------------------------------------------------*/
+namespace gm::simd
+{
+#pragma region Transcendental
+	/****************************************************************************
+	*				  			General
+	*****************************************************************************/
+	/* a + t (b - a) */
+	GM_FORCE_INLINE VectorRegister VectorLerp(VectorRegister a, VectorRegister b, float t) noexcept
+	{
+		return VectorMultiplyAdd(VectorSubtract(b, a), VectorReplicate(t), a);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorLerpV(VectorRegister a, VectorRegister b, VectorRegister t) noexcept
+	{
+		return VectorMultiplyAdd(VectorSubtract(b, a), t, a);
+	}
+
+	/* 2^v */
+	GM_FORCE_INLINE VectorRegister VectorExp(VectorRegister v) noexcept
+	{
+		return detail::Map(v, [](float x) { return std::exp2(x); });
+	}
+
+	/* log2(v) */
+	GM_FORCE_INLINE VectorRegister VectorLog(VectorRegister v) noexcept
+	{
+		return detail::Map(v, [](float x) { return std::log2(x); });
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorPow(VectorRegister base, VectorRegister exponent) noexcept
+	{
+		return detail::Map(base, exponent, [](float x, float y) { return std::pow(x, y); });
+	}
+
+	/* angle - 2pi * round(angle / 2pi) : [-pi, pi] */
+	GM_FORCE_INLINE VectorRegister VectorModAngles(VectorRegister angles) noexcept
+	{
+		const VectorRegister turns = VectorRound(VectorMultiply(angles, g_ReciprocalTwoPi));
+		return VectorNegativeMultiplySubtract(g_TwoPi, turns, angles);
+	}
+
+	/* v - d * trunc(v / d) */
+	GM_FORCE_INLINE VectorRegister VectorMod(VectorRegister v, VectorRegister d) noexcept
+	{
+		VectorRegister quotient = VectorDivide(v, d);
+		const VectorRegister isNegative = VectorLess(quotient, VectorZero());
+		quotient = VectorSelect(VectorFloor(quotient), VectorCeiling(quotient), isNegative);
+		return VectorNegativeMultiplySubtract(d, quotient, v);
+	}
+
+	namespace detail
+	{
+		/* x in [-pi, pi] -> y in [-pi/2, pi/2] with sin(x) = sin(y), cos(x) = sign * cos(y) */
+		GM_FORCE_INLINE VectorRegister ReflectHalfPi(VectorRegister x, VectorRegister* sign) noexcept
+		{
+			const VectorRegister signBit   = VectorAndInt(x, g_NegativeZero);
+			const VectorRegister pi        = VectorOrInt(g_Pi, signBit);          // +-pi
+			const VectorRegister absolute  = VectorAndCInt(x, signBit);
+			const VectorRegister reflected = VectorSubtract(pi, x);
+			const VectorRegister isInside  = VectorLessOrEqual(absolute, g_HalfPi);
+			if (sign) { *sign = VectorSelect(g_NegativeOne, g_One, isInside); }
+			return VectorSelect(reflected, x, isInside);
+		}
+
+		/* Horner's method : c[0] + c[1] x + c[2] x^2 ... (highest first in the loop) */
+		template<int Count>
+		GM_FORCE_INLINE VectorRegister Polynomial(VectorRegister x, const float (&coefficients)[Count]) noexcept
+		{
+			VectorRegister result = VectorReplicate(coefficients[Count - 1]);
+			for (int i = Count - 2; i >= 0; --i)
+			{
+				result = VectorMultiplyAdd(result, x, VectorReplicate(coefficients[i]));
+			}
+			return result;
+		}
+	}
+
+	/****************************************************************************
+	*				  			Trigonometry
+	*****************************************************************************/
+	/* 11 degree minimax approximation */
+	GM_FORCE_INLINE VectorRegister VectorSin(VectorRegister v) noexcept
+	{
+		static constexpr float coefficients[] = { 1.0f, -0.16666667f, 0.0083333310f, -0.00019840874f, 2.7525562e-06f, -2.3889859e-08f };
+		const VectorRegister x  = detail::ReflectHalfPi(VectorModAngles(v), nullptr);
+		const VectorRegister x2 = VectorMultiply(x, x);
+		return VectorMultiply(detail::Polynomial(x2, coefficients), x);
+	}
+
+	/* 10 degree minimax approximation */
+	GM_FORCE_INLINE VectorRegister VectorCos(VectorRegister v) noexcept
+	{
+		static constexpr float coefficients[] = { 1.0f, -0.5f, 0.041666638f, -0.0013888378f, 2.4760495e-05f, -2.6051615e-07f };
+		VectorRegister sign;
+		const VectorRegister x  = detail::ReflectHalfPi(VectorModAngles(v), &sign);
+		const VectorRegister x2 = VectorMultiply(x, x);
+		return VectorMultiply(detail::Polynomial(x2, coefficients), sign);
+	}
+
+	GM_FORCE_INLINE void VectorSinCos(VectorRegister* sin, VectorRegister* cos, VectorRegister v) noexcept
+	{
+		*sin = VectorSin(v);
+		*cos = VectorCos(v);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorTan(VectorRegister v) noexcept
+	{
+		return VectorDivide(VectorSin(v), VectorCos(v));
+	}
+
+	/* 7 degree minimax approximation of acos(x) / sqrt(1 - x) on [0, 1] */
+	GM_FORCE_INLINE VectorRegister VectorACos(VectorRegister v) noexcept
+	{
+		static constexpr float coefficients[] = { 1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f, 0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f };
+		const VectorRegister isPositive = VectorGreaterOrEqual(v, VectorZero());
+		const VectorRegister x          = VectorAbs(v);
+		const VectorRegister root       = VectorSqrt(VectorMax(VectorSubtract(g_One, x), VectorZero()));
+		const VectorRegister result     = VectorMultiply(detail::Polynomial(x, coefficients), root);
+		return VectorSelect(VectorSubtract(g_Pi, result), result, isPositive);
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorASin(VectorRegister v) noexcept
+	{
+		return VectorSubtract(g_HalfPi, VectorACos(v));
+	}
+
+	/* 3 degree approximation (error 7e-5 rad) */
+	GM_FORCE_INLINE VectorRegister VectorACosEst(VectorRegister v) noexcept
+	{
+		static constexpr float coefficients[] = { 1.5707288f, -0.2121144f, 0.0742610f, -0.0187293f };
+		const VectorRegister isPositive = VectorGreaterOrEqual(v, VectorZero());
+		const VectorRegister x          = VectorAbs(v);
+		const VectorRegister root       = VectorSqrt(VectorMax(VectorSubtract(g_One, x), VectorZero()));
+		const VectorRegister result     = VectorMultiply(detail::Polynomial(x, coefficients), root);
+		return VectorSelect(VectorSubtract(g_Pi, result), result, isPositive);
+	}
+
+	/* 17 degree odd polynomial on [-1, 1] (Abramowitz and Stegun 4.4.49), 1 / x outside */
+	GM_FORCE_INLINE VectorRegister VectorATan(VectorRegister v) noexcept
+	{
+		static constexpr float coefficients[] = { 1.0f, -0.3333314528f, 0.1999355085f, -0.1420889944f, 0.1065626393f, -0.0752896400f, 0.0429096138f, -0.0161657367f, 0.0028662257f };
+		const VectorRegister isInside = VectorLessOrEqual(VectorAbs(v), g_One);
+		VectorRegister sign = VectorSelect(g_NegativeOne, g_One, VectorGreater(v, g_One));
+		sign = VectorSelect(sign, VectorZero(), isInside);
+
+		const VectorRegister x      = VectorSelect(VectorReciprocal(v), v, isInside);
+		const VectorRegister x2     = VectorMultiply(x, x);
+		const VectorRegister result = VectorMultiply(detail::Polynomial(x2, coefficients), x);
+
+		/*--- atan(v) = sign * pi / 2 - atan(1 / v) outside [-1, 1] ---*/
+		const VectorRegister outside = VectorSubtract(VectorMultiply(sign, g_HalfPi), result);
+		return VectorSelect(outside, result, VectorEqual(sign, VectorZero()));
+	}
+
+	/* quadrant of (x, y), including zero and infinite inputs (same results as atan2f) */
+	GM_FORCE_INLINE VectorRegister VectorATan2(VectorRegister y, VectorRegister x) noexcept
+	{
+		const VectorRegister valid           = VectorTrueInt();
+		const VectorRegister ySign           = VectorAndInt(y, g_NegativeZero);
+		const VectorRegister pi              = VectorOrInt(g_Pi    , ySign);
+		const VectorRegister halfPi          = VectorOrInt(g_HalfPi, ySign);
+		const VectorRegister quarterPi       = VectorOrInt(VectorReplicate(0.785398163f), ySign);
+		const VectorRegister threeQuarterPi  = VectorOrInt(VectorReplicate(2.356194490f), ySign);
+
+		const VectorRegister yIsZero     = VectorEqual(y, VectorZero());
+		const VectorRegister xIsZero     = VectorEqual(x, VectorZero());
+		const VectorRegister xIsPositive = VectorEqualInt(VectorAndInt(x, g_NegativeZero), VectorZero());
+		const VectorRegister yIsInfinite = VectorIsInfinite(y);
+		const VectorRegister xIsInfinite = VectorIsInfinite(x);
+
+		/*--- special cases ---*/
+		VectorRegister r1 = VectorSelect(pi, ySign, xIsPositive);
+		VectorRegister r2 = VectorSelect(valid, halfPi, xIsZero);
+		VectorRegister r3 = VectorSelect(r2, r1, yIsZero);
+		VectorRegister r4 = VectorSelect(threeQuarterPi, quarterPi, xIsPositive);
+		VectorRegister r5 = VectorSelect(halfPi, r4, xIsInfinite);
+		const VectorRegister special = VectorSelect(r3, r5, yIsInfinite);
+		const VectorRegister isValid = VectorEqualInt(special, valid);
+
+		/*--- general case ---*/
+		const VectorRegister result = VectorAdd(VectorATan(VectorDivide(y, x)), VectorSelect(pi, g_NegativeZero, xIsPositive));
+		return VectorSelect(special, result, isValid);
+	}
+#pragma endregion Transcendental
+
+#pragma region Vector
+	/****************************************************************************
+	*				  			Curve
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister VectorHermite(VectorRegister position0, VectorRegister tangent0, VectorRegister position1, VectorRegister tangent1, float t) noexcept
+	{
+		const float t2 = t * t;
+		const float t3 = t * t2;
+		VectorRegister result = VectorScale(position0, 2.0f * t3 - 3.0f * t2 + 1.0f);
+		result = VectorMultiplyAdd(tangent0 , VectorReplicate(t3 - 2.0f * t2 + t), result);
+		result = VectorMultiplyAdd(position1, VectorReplicate(-2.0f * t3 + 3.0f * t2), result);
+		result = VectorMultiplyAdd(tangent1 , VectorReplicate(t3 - t2), result);
+		return result;
+	}
+
+	GM_FORCE_INLINE VectorRegister VectorCatmullRom(VectorRegister position0, VectorRegister position1, VectorRegister position2, VectorRegister position3, float t) noexcept
+	{
+		const float t2 = t * t;
+		const float t3 = t * t2;
+		VectorRegister result = VectorScale(position0, (-t3 + 2.0f * t2 - t) * 0.5f);
+		result = VectorMultiplyAdd(position1, VectorReplicate((3.0f * t3 - 5.0f * t2 + 2.0f) * 0.5f), result);
+		result = VectorMultiplyAdd(position2, VectorReplicate((-3.0f * t3 + 4.0f * t2 + t) * 0.5f), result);
+		result = VectorMultiplyAdd(position3, VectorReplicate((t3 - t2) * 0.5f), result);
+		return result;
+	}
+
+	/* p0 + f (p1 - p0) + g (p2 - p0) */
+	GM_FORCE_INLINE VectorRegister VectorBaryCentric(VectorRegister position0, VectorRegister position1, VectorRegister position2, float f, float g) noexcept
+	{
+		VectorRegister result = VectorMultiplyAdd(VectorSubtract(position1, position0), VectorReplicate(f), position0);
+		return VectorMultiplyAdd(VectorSubtract(position2, position0), VectorReplicate(g), result);
+	}
+
+	/****************************************************************************
+	*				  			Compare (all lanes of the dimension)
+	*****************************************************************************/
+	namespace detail
+	{
+		template<int Dimension> constexpr int LaneMask = (1 << Dimension) - 1;
+
+		template<int Dimension>
+		GM_FORCE_INLINE bool All(VectorRegister mask) noexcept { return (VectorMoveMask(mask) & LaneMask<Dimension>) == LaneMask<Dimension>; }
+
+		template<int Dimension>
+		GM_FORCE_INLINE bool Any(VectorRegister mask) noexcept { return (VectorMoveMask(mask) & LaneMask<Dimension>) != 0; }
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister Dot(VectorRegister a, VectorRegister b) noexcept
+		{
+			if constexpr (Dimension == 2)      { return Vector2Dot(a, b); }
+			else if constexpr (Dimension == 3) { return Vector3Dot(a, b); }
+			else                               { return Vector4Dot(a, b); }
+		}
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister Normalize(VectorRegister v) noexcept
+		{
+			/*--- zero stays zero and an infinite length gives NaN ---*/
+			const VectorRegister lengthSquared = Dot<Dimension>(v, v);
+			const VectorRegister length        = VectorSqrt(lengthSquared);
+			const VectorRegister isNotZero     = VectorNotEqual(length, VectorZero());
+			const VectorRegister isFinite      = VectorNotEqual(lengthSquared, g_Infinity);
+			const VectorRegister result        = VectorAndInt(VectorDivide(v, length), isNotZero);
+			return VectorSelect(g_QNaN, result, isFinite);
+		}
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister ClampLengthV(VectorRegister v, VectorRegister lengthMin, VectorRegister lengthMax) noexcept
+		{
+			const VectorRegister lengthSquared = Dot<Dimension>(v, v);
+			const VectorRegister reciprocal    = VectorReciprocalSqrt(lengthSquared);
+			const VectorRegister isInfinite    = VectorEqualInt(lengthSquared, g_Infinity);
+			const VectorRegister isZero        = VectorEqual(lengthSquared, VectorZero());
+			const VectorRegister isRegular     = VectorEqualInt(isInfinite, isZero);
+
+			const VectorRegister length = VectorSelect(lengthSquared, VectorMultiply(lengthSquared, reciprocal), isRegular);
+			const VectorRegister normal = VectorSelect(lengthSquared, VectorMultiply(v, reciprocal), isRegular);
+
+			const VectorRegister isOverMax  = VectorGreater(length, lengthMax);
+			const VectorRegister isUnderMin = VectorLess(length, lengthMin);
+			VectorRegister clampLength = VectorSelect(length     , lengthMax, isOverMax);
+			clampLength                = VectorSelect(clampLength, lengthMin, isUnderMin);
+
+			const VectorRegister result    = VectorMultiply(normal, clampLength);
+			const VectorRegister isInRange = VectorEqualInt(isOverMax, isUnderMin);
+			return VectorSelect(result, v, isInRange);
+		}
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister Refract(VectorRegister incident, VectorRegister normal, VectorRegister refractionIndex) noexcept
+		{
+			/*--- eta I - N (eta (I.N) + sqrt(1 - eta^2 (1 - (I.N)^2))), zero for the total internal reflection ---*/
+			const VectorRegister incidentDotNormal = Dot<Dimension>(incident, normal);
+			VectorRegister r = VectorNegativeMultiplySubtract(incidentDotNormal, incidentDotNormal, g_One);
+			r = VectorMultiply(r, refractionIndex);
+			r = VectorNegativeMultiplySubtract(r, refractionIndex, g_One);
+			if (Any<Dimension>(VectorLessOrEqual(r, VectorZero()))) { return VectorZero(); }
+
+			r = VectorMultiplyAdd(refractionIndex, incidentDotNormal, VectorSqrt(r));
+			return VectorSubtract(VectorMultiply(refractionIndex, incident), VectorMultiply(normal, r));
+		}
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister AngleBetweenVectors(VectorRegister a, VectorRegister b) noexcept
+		{
+			const VectorRegister reciprocalLength = VectorMultiply(VectorReciprocalSqrt(Dot<Dimension>(a, a)), VectorReciprocalSqrt(Dot<Dimension>(b, b)));
+			const VectorRegister cosAngle         = VectorMultiply(Dot<Dimension>(a, b), reciprocalLength);
+			return VectorACos(VectorClamp(cosAngle, g_NegativeOne, g_One));
+		}
+
+		template<int Dimension>
+		GM_FORCE_INLINE VectorRegister LinePointDistance(VectorRegister linePoint1, VectorRegister linePoint2, VectorRegister point) noexcept
+		{
+			const VectorRegister pointVector = VectorSubtract(point, linePoint1);
+			const VectorRegister lineVector  = VectorSubtract(linePoint2, linePoint1);
+			const VectorRegister scale       = VectorDivide(Dot<Dimension>(pointVector, lineVector), Dot<Dimension>(lineVector, lineVector));
+			const VectorRegister distance    = VectorSubtract(pointVector, VectorMultiply(lineVector, scale));
+			return VectorSqrt(Dot<Dimension>(distance, distance));
+		}
+	}
+
+	GM_FORCE_INLINE bool Vector2Equal       (VectorRegister a, VectorRegister b) noexcept { return detail::All<2>(VectorEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector3Equal       (VectorRegister a, VectorRegister b) noexcept { return detail::All<3>(VectorEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector4Equal       (VectorRegister a, VectorRegister b) noexcept { return detail::All<4>(VectorEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector2NotEqual    (VectorRegister a, VectorRegister b) noexcept { return detail::Any<2>(VectorNotEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector3NotEqual    (VectorRegister a, VectorRegister b) noexcept { return detail::Any<3>(VectorNotEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector4NotEqual    (VectorRegister a, VectorRegister b) noexcept { return detail::Any<4>(VectorNotEqual(a, b)); }
+	GM_FORCE_INLINE bool Vector2Less        (VectorRegister a, VectorRegister b) noexcept { return detail::All<2>(VectorLess(a, b)); }
+	GM_FORCE_INLINE bool Vector3Less        (VectorRegister a, VectorRegister b) noexcept { return detail::All<3>(VectorLess(a, b)); }
+	GM_FORCE_INLINE bool Vector4Less        (VectorRegister a, VectorRegister b) noexcept { return detail::All<4>(VectorLess(a, b)); }
+	GM_FORCE_INLINE bool Vector2IsNaN       (VectorRegister v) noexcept { return detail::Any<2>(VectorIsNaN(v)); }
+	GM_FORCE_INLINE bool Vector3IsNaN       (VectorRegister v) noexcept { return detail::Any<3>(VectorIsNaN(v)); }
+	GM_FORCE_INLINE bool Vector4IsNaN       (VectorRegister v) noexcept { return detail::Any<4>(VectorIsNaN(v)); }
+	GM_FORCE_INLINE bool Vector2IsInfinite  (VectorRegister v) noexcept { return detail::Any<2>(VectorIsInfinite(v)); }
+	GM_FORCE_INLINE bool Vector3IsInfinite  (VectorRegister v) noexcept { return detail::Any<3>(VectorIsInfinite(v)); }
+	GM_FORCE_INLINE bool Vector4IsInfinite  (VectorRegister v) noexcept { return detail::Any<4>(VectorIsInfinite(v)); }
+
+	/* -bounds <= v <= bounds */
+	GM_FORCE_INLINE VectorRegister VectorInBounds(VectorRegister v, VectorRegister bounds) noexcept
+	{
+		return VectorAndInt(VectorLessOrEqual(v, bounds), VectorLessOrEqual(VectorNegate(bounds), v));
+	}
+	GM_FORCE_INLINE bool Vector2InBounds(VectorRegister v, VectorRegister bounds) noexcept { return detail::All<2>(VectorInBounds(v, bounds)); }
+	GM_FORCE_INLINE bool Vector3InBounds(VectorRegister v, VectorRegister bounds) noexcept { return detail::All<3>(VectorInBounds(v, bounds)); }
+	GM_FORCE_INLINE bool Vector4InBounds(VectorRegister v, VectorRegister bounds) noexcept { return detail::All<4>(VectorInBounds(v, bounds)); }
+
+	/****************************************************************************
+	*				  			Vector2
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister Vector2LengthSq         (VectorRegister v) noexcept { return Vector2Dot(v, v); }
+	GM_FORCE_INLINE VectorRegister Vector2Length           (VectorRegister v) noexcept { return VectorSqrt(Vector2Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector2ReciprocalLength (VectorRegister v) noexcept { return VectorReciprocalSqrt(Vector2Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector2Normalize        (VectorRegister v) noexcept { return detail::Normalize<2>(v); }
+	GM_FORCE_INLINE VectorRegister Vector2ClampLength      (VectorRegister v, float lengthMin, float lengthMax) noexcept { return detail::ClampLengthV<2>(v, VectorReplicate(lengthMin), VectorReplicate(lengthMax)); }
+	GM_FORCE_INLINE VectorRegister Vector2Reflect          (VectorRegister incident, VectorRegister normal) noexcept
+	{
+		const VectorRegister twoDot = VectorAdd(Vector2Dot(incident, normal), Vector2Dot(incident, normal));
+		return VectorNegativeMultiplySubtract(twoDot, normal, incident);
+	}
+	GM_FORCE_INLINE VectorRegister Vector2Refract          (VectorRegister incident, VectorRegister normal, float refractionIndex) noexcept { return detail::Refract<2>(incident, normal, VectorReplicate(refractionIndex)); }
+	GM_FORCE_INLINE VectorRegister Vector2AngleBetweenNormals   (VectorRegister a, VectorRegister b) noexcept { return VectorACos   (VectorClamp(Vector2Dot(a, b), g_NegativeOne, g_One)); }
+	GM_FORCE_INLINE VectorRegister Vector2AngleBetweenNormalsEst(VectorRegister a, VectorRegister b) noexcept { return VectorACosEst(VectorClamp(Vector2Dot(a, b), g_NegativeOne, g_One)); }
+	GM_FORCE_INLINE VectorRegister Vector2AngleBetweenVectors   (VectorRegister a, VectorRegister b) noexcept { return detail::AngleBetweenVectors<2>(a, b); }
+	GM_FORCE_INLINE VectorRegister Vector2LinePointDistance(VectorRegister linePoint1, VectorRegister linePoint2, VectorRegister point) noexcept { return detail::LinePointDistance<2>(linePoint1, linePoint2, point); }
+
+	/* a.x b.y - a.y b.x in all lanes */
+	GM_FORCE_INLINE VectorRegister Vector2Cross(VectorRegister a, VectorRegister b) noexcept
+	{
+		const VectorRegister product = VectorMultiply(a, VectorSwizzle<1, 0, 1, 0>(b));
+		return VectorSplatX(VectorSubtract(product, VectorSplatY(product)));
+	}
+
+	/* intersection of two infinite lines. +inf : the same line, NaN : parallel */
+	GM_FORCE_INLINE VectorRegister Vector2IntersectLine(VectorRegister line1Point1, VectorRegister line1Point2, VectorRegister line2Point1, VectorRegister line2Point2) noexcept
+	{
+		const VectorRegister v1 = VectorSubtract(line1Point2, line1Point1);
+		const VectorRegister v2 = VectorSubtract(line2Point2, line2Point1);
+		const VectorRegister v3 = VectorSubtract(line1Point1, line2Point1);
+		const VectorRegister c1 = Vector2Cross(v1, v2);
+		const VectorRegister c2 = Vector2Cross(v2, v3);
+
+		if (detail::All<1>(VectorLessOrEqual(VectorAbs(c1), g_Epsilon)))
+		{
+			return detail::All<1>(VectorLessOrEqual(VectorAbs(c2), g_Epsilon)) ? VectorRegister(g_Infinity) : VectorRegister(g_QNaN);
+		}
+		return VectorMultiplyAdd(v1, VectorDivide(c2, c1), line1Point1);
+	}
+
+	GM_FORCE_INLINE VectorRegister Vector2TransformNormal(VectorRegister v, const MatrixRegister& m) noexcept
+	{
+		return VectorMultiplyAdd(VectorSplatX(v), m.r[0], VectorMultiply(VectorSplatY(v), m.r[1]));
+	}
+
+	/****************************************************************************
+	*				  			Vector3
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister Vector3LengthSq         (VectorRegister v) noexcept { return Vector3Dot(v, v); }
+	GM_FORCE_INLINE VectorRegister Vector3Length           (VectorRegister v) noexcept { return VectorSqrt(Vector3Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector3ReciprocalLength (VectorRegister v) noexcept { return VectorReciprocalSqrt(Vector3Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector3Normalize        (VectorRegister v) noexcept { return detail::Normalize<3>(v); }
+	GM_FORCE_INLINE VectorRegister Vector3ClampLength      (VectorRegister v, float lengthMin, float lengthMax) noexcept { return detail::ClampLengthV<3>(v, VectorReplicate(lengthMin), VectorReplicate(lengthMax)); }
+	GM_FORCE_INLINE VectorRegister Vector3Reflect          (VectorRegister incident, VectorRegister normal) noexcept
+	{
+		const VectorRegister twoDot = VectorAdd(Vector3Dot(incident, normal), Vector3Dot(incident, normal));
+		return VectorNegativeMultiplySubtract(twoDot, normal, incident);
+	}
+	GM_FORCE_INLINE VectorRegister Vector3Refract          (VectorRegister incident, VectorRegister normal, float refractionIndex) noexcept { return detail::Refract<3>(incident, normal, VectorReplicate(refractionIndex)); }
+	GM_FORCE_INLINE VectorRegister Vector3AngleBetweenNormals   (VectorRegister a, VectorRegister b) noexcept { return VectorACos   (VectorClamp(Vector3Dot(a, b), g_NegativeOne, g_One)); }
+	GM_FORCE_INLINE VectorRegister Vector3AngleBetweenNormalsEst(VectorRegister a, VectorRegister b) noexcept { return VectorACosEst(VectorClamp(Vector3Dot(a, b), g_NegativeOne, g_One)); }
+	GM_FORCE_INLINE VectorRegister Vector3AngleBetweenVectors   (VectorRegister a, VectorRegister b) noexcept { return detail::AngleBetweenVectors<3>(a, b); }
+	GM_FORCE_INLINE VectorRegister Vector3LinePointDistance(VectorRegister linePoint1, VectorRegister linePoint2, VectorRegister point) noexcept { return detail::LinePointDistance<3>(linePoint1, linePoint2, point); }
+
+	/* (a.y b.z - a.z b.y, a.z b.x - a.x b.z, a.x b.y - a.y b.x, 0) */
+	GM_FORCE_INLINE VectorRegister Vector3Cross(VectorRegister a, VectorRegister b) noexcept
+	{
+		const VectorRegister left  = VectorMultiply(VectorSwizzle<1, 2, 0, 3>(a), VectorSwizzle<2, 0, 1, 3>(b));
+		const VectorRegister right = VectorMultiply(VectorSwizzle<2, 0, 1, 3>(a), VectorSwizzle<1, 2, 0, 3>(b));
+		return VectorAndInt(VectorSubtract(left, right), g_Mask3);
+	}
+
+	/* (x, y, z, 1) * M */
+	GM_FORCE_INLINE VectorRegister Vector3Transform(VectorRegister v, const MatrixRegister& m) noexcept
+	{
+		const VectorRegister xy = VectorMultiplyAdd(VectorSplatY(v), m.r[1], VectorMultiply(VectorSplatX(v), m.r[0]));
+		const VectorRegister zw = VectorMultiplyAdd(VectorSplatZ(v), m.r[2], m.r[3]);
+		return VectorAdd(xy, zw);
+	}
+
+	/* (x, y, z, 0) * M */
+	GM_FORCE_INLINE VectorRegister Vector3TransformNormal(VectorRegister v, const MatrixRegister& m) noexcept
+	{
+		const VectorRegister xy = VectorMultiplyAdd(VectorSplatY(v), m.r[1], VectorMultiply(VectorSplatX(v), m.r[0]));
+		return VectorMultiplyAdd(VectorSplatZ(v), m.r[2], xy);
+	}
+
+	/* (x, y, z, 1) * M / w */
+	GM_FORCE_INLINE VectorRegister Vector3TransformCoord(VectorRegister v, const MatrixRegister& m) noexcept
+	{
+		const VectorRegister result = Vector3Transform(v, m);
+		return VectorDivide(result, VectorSplatW(result));
+	}
+
+	/****************************************************************************
+	*				  			Vector4
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister Vector4LengthSq         (VectorRegister v) noexcept { return Vector4Dot(v, v); }
+	GM_FORCE_INLINE VectorRegister Vector4Length           (VectorRegister v) noexcept { return VectorSqrt(Vector4Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector4ReciprocalLength (VectorRegister v) noexcept { return VectorReciprocalSqrt(Vector4Dot(v, v)); }
+	GM_FORCE_INLINE VectorRegister Vector4Normalize        (VectorRegister v) noexcept { return detail::Normalize<4>(v); }
+	GM_FORCE_INLINE VectorRegister Vector4ClampLength      (VectorRegister v, float lengthMin, float lengthMax) noexcept { return detail::ClampLengthV<4>(v, VectorReplicate(lengthMin), VectorReplicate(lengthMax)); }
+	GM_FORCE_INLINE VectorRegister Vector4Reflect          (VectorRegister incident, VectorRegister normal) noexcept
+	{
+		const VectorRegister twoDot = VectorAdd(Vector4Dot(incident, normal), Vector4Dot(incident, normal));
+		return VectorNegativeMultiplySubtract(twoDot, normal, incident);
+	}
+	GM_FORCE_INLINE VectorRegister Vector4Refract          (VectorRegister incident, VectorRegister normal, float refractionIndex) noexcept { return detail::Refract<4>(incident, normal, VectorReplicate(refractionIndex)); }
+
+	/* vector orthogonal to the three vectors */
+	GM_FORCE_INLINE VectorRegister Vector4Cross(VectorRegister a, VectorRegister b, VectorRegister c) noexcept
+	{
+		// a.yxxx * (b.zwyz * c.wzwy - b.wzwy * c.zwyz)
+		VectorRegister result = VectorSubtract(VectorMultiply(VectorSwizzle<2, 3, 1, 2>(b), VectorSwizzle<3, 2, 3, 1>(c)),
+			                                   VectorMultiply(VectorSwizzle<3, 2, 3, 1>(b), VectorSwizzle<2, 3, 1, 2>(c)));
+		result = VectorMultiply(result, VectorSwizzle<1, 0, 0, 0>(a));
+
+		// - a.zzyy * (b.ywxz * c.wxwx - b.wxwx * c.ywxz)
+		VectorRegister term = VectorSubtract(VectorMultiply(VectorSwizzle<1, 3, 0, 2>(b), VectorSwizzle<3, 0, 3, 0>(c)),
+			                                 VectorMultiply(VectorSwizzle<3, 0, 3, 0>(b), VectorSwizzle<1, 3, 0, 2>(c)));
+		result = VectorNegativeMultiplySubtract(VectorSwizzle<2, 2, 1, 1>(a), term, result);
+
+		// + a.wwwz * (b.yzxy * c.zxyx - b.zxyx * c.yzxy)
+		term = VectorSubtract(VectorMultiply(VectorSwizzle<1, 2, 0, 1>(b), VectorSwizzle<2, 0, 1, 0>(c)),
+			                  VectorMultiply(VectorSwizzle<2, 0, 1, 0>(b), VectorSwizzle<1, 2, 0, 1>(c)));
+		return VectorMultiplyAdd(VectorSwizzle<3, 3, 3, 2>(a), term, result);
+	}
+
+	GM_FORCE_INLINE VectorRegister Vector4Transform(VectorRegister v, const MatrixRegister& m) noexcept
+	{
+		const VectorRegister xy = VectorMultiplyAdd(VectorSplatY(v), m.r[1], VectorMultiply(VectorSplatX(v), m.r[0]));
+		const VectorRegister zw = VectorMultiplyAdd(VectorSplatW(v), m.r[3], VectorMultiply(VectorSplatZ(v), m.r[2]));
+		return VectorAdd(xy, zw);
+	}
+
+	/****************************************************************************
+	*				  			Plane (a, b, c, d) : ax + by + cz + d = 0
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister PlaneNormalize(VectorRegister plane) noexcept
+	{
+		return VectorMultiply(plane, Vector3ReciprocalLength(plane));
+	}
+
+	GM_FORCE_INLINE VectorRegister PlaneDot(VectorRegister plane, VectorRegister v) noexcept
+	{
+		return Vector4Dot(plane, v);
+	}
+#pragma endregion Vector
+
+#pragma region Matrix
+	/****************************************************************************
+	*				  			Matrix
+	*****************************************************************************/
+	GM_FORCE_INLINE MatrixRegister MatrixSet(VectorRegister row0, VectorRegister row1, VectorRegister row2, VectorRegister row3) noexcept
+	{
+		MatrixRegister m;
+		m.r[0] = row0; m.r[1] = row1; m.r[2] = row2; m.r[3] = row3;
+		return m;
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixIdentity() noexcept
+	{
+		return MatrixSet(g_IdentityR0, g_IdentityR1, g_IdentityR2, g_IdentityR3);
+	}
+
+	GM_FORCE_INLINE MatrixRegister LoadFloat3x3(const Float3x3Data* source) noexcept
+	{
+		return MatrixSet
+		(
+			VectorSet(source->m[0][0], source->m[0][1], source->m[0][2], 0.0f),
+			VectorSet(source->m[1][0], source->m[1][1], source->m[1][2], 0.0f),
+			VectorSet(source->m[2][0], source->m[2][1], source->m[2][2], 0.0f),
+			g_IdentityR3
+		);
+	}
+
+	/* the rows of Float3x4 are the columns of the matrix */
+	GM_FORCE_INLINE MatrixRegister LoadFloat3x4(const Float3x4Data* source) noexcept
+	{
+		return MatrixSet
+		(
+			VectorSet(source->m[0][0], source->m[1][0], source->m[2][0], 0.0f),
+			VectorSet(source->m[0][1], source->m[1][1], source->m[2][1], 0.0f),
+			VectorSet(source->m[0][2], source->m[1][2], source->m[2][2], 0.0f),
+			VectorSet(source->m[0][3], source->m[1][3], source->m[2][3], 1.0f)
+		);
+	}
+
+	GM_FORCE_INLINE MatrixRegister LoadFloat4x4(const Float4x4Data* source) noexcept
+	{
+		return MatrixSet(VectorLoad(source->m[0]), VectorLoad(source->m[1]), VectorLoad(source->m[2]), VectorLoad(source->m[3]));
+	}
+
+	GM_FORCE_INLINE void StoreFloat4x4(Float4x4Data* destination, const MatrixRegister& m) noexcept
+	{
+		for (int i = 0; i < 4; ++i) { VectorStore(destination->m[i], m.r[i]); }
+	}
+
+	/* row vector convention : v * (a * b) = (v * a) * b */
+	GM_FORCE_INLINE MatrixRegister MatrixMultiply(const MatrixRegister& a, const MatrixRegister& b) noexcept
+	{
+		MatrixRegister result;
+		for (int i = 0; i < 4; ++i) { result.r[i] = Vector4Transform(a.r[i], b); }
+		return result;
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixTranspose(const MatrixRegister& m) noexcept
+	{
+		const VectorRegister xy01 = VectorPermute<0, 1, 4, 5>(m.r[0], m.r[1]); // 00 01 10 11
+		const VectorRegister zw01 = VectorPermute<2, 3, 6, 7>(m.r[0], m.r[1]); // 02 03 12 13
+		const VectorRegister xy23 = VectorPermute<0, 1, 4, 5>(m.r[2], m.r[3]); // 20 21 30 31
+		const VectorRegister zw23 = VectorPermute<2, 3, 6, 7>(m.r[2], m.r[3]); // 22 23 32 33
+		return MatrixSet
+		(
+			VectorPermute<0, 2, 4, 6>(xy01, xy23),
+			VectorPermute<1, 3, 5, 7>(xy01, xy23),
+			VectorPermute<0, 2, 4, 6>(zw01, zw23),
+			VectorPermute<1, 3, 5, 7>(zw01, zw23)
+		);
+	}
+
+	GM_FORCE_INLINE bool MatrixIsIdentity(const MatrixRegister& m) noexcept
+	{
+		return Vector4Equal(m.r[0], g_IdentityR0) && Vector4Equal(m.r[1], g_IdentityR1)
+			&& Vector4Equal(m.r[2], g_IdentityR2) && Vector4Equal(m.r[3], g_IdentityR3);
+	}
+
+	namespace detail
+	{
+		/* cofactors of the transposed matrix (the adjugate) and the determinant */
+		GM_FORCE_INLINE float Adjugate(const MatrixRegister& matrix, float (&adjugate)[16]) noexcept
+		{
+			float m[16];
+			for (int i = 0; i < 4; ++i) { VectorStore(&m[i * 4], matrix.r[i]); }
+
+			const float s0 = m[0] * m[5]  - m[4]  * m[1];
+			const float s1 = m[0] * m[6]  - m[4]  * m[2];
+			const float s2 = m[0] * m[7]  - m[4]  * m[3];
+			const float s3 = m[1] * m[6]  - m[5]  * m[2];
+			const float s4 = m[1] * m[7]  - m[5]  * m[3];
+			const float s5 = m[2] * m[7]  - m[6]  * m[3];
+			const float c5 = m[10] * m[15] - m[14] * m[11];
+			const float c4 = m[9]  * m[15] - m[13] * m[11];
+			const float c3 = m[9]  * m[14] - m[13] * m[10];
+			const float c2 = m[8]  * m[15] - m[12] * m[11];
+			const float c1 = m[8]  * m[14] - m[12] * m[10];
+			const float c0 = m[8]  * m[13] - m[12] * m[9];
+
+			adjugate[0]  =  m[5]  * c5 - m[6]  * c4 + m[7]  * c3;
+			adjugate[1]  = -m[1]  * c5 + m[2]  * c4 - m[3]  * c3;
+			adjugate[2]  =  m[13] * s5 - m[14] * s4 + m[15] * s3;
+			adjugate[3]  = -m[9]  * s5 + m[10] * s4 - m[11] * s3;
+			adjugate[4]  = -m[4]  * c5 + m[6]  * c2 - m[7]  * c1;
+			adjugate[5]  =  m[0]  * c5 - m[2]  * c2 + m[3]  * c1;
+			adjugate[6]  = -m[12] * s5 + m[14] * s2 - m[15] * s1;
+			adjugate[7]  =  m[8]  * s5 - m[10] * s2 + m[11] * s1;
+			adjugate[8]  =  m[4]  * c4 - m[5]  * c2 + m[7]  * c0;
+			adjugate[9]  = -m[0]  * c4 + m[1]  * c2 - m[3]  * c0;
+			adjugate[10] =  m[12] * s4 - m[13] * s2 + m[15] * s0;
+			adjugate[11] = -m[8]  * s4 + m[9]  * s2 - m[11] * s0;
+			adjugate[12] = -m[4]  * c3 + m[5]  * c1 - m[6]  * c0;
+			adjugate[13] =  m[0]  * c3 - m[1]  * c1 + m[2]  * c0;
+			adjugate[14] = -m[12] * s3 + m[13] * s1 - m[14] * s0;
+			adjugate[15] =  m[8]  * s3 - m[9]  * s1 + m[10] * s0;
+
+			return (s0 * c5 - s1 * c4 + s2 * c3) + (s3 * c2 - s4 * c1 + s5 * c0);
+		}
+	}
+
+	/* determinant in all lanes */
+	GM_FORCE_INLINE VectorRegister MatrixDeterminant(const MatrixRegister& m) noexcept
+	{
+		float adjugate[16];
+		return VectorReplicate(detail::Adjugate(m, adjugate));
+	}
+
+	/* a singular matrix gives inf / NaN as with the division by zero */
+	GM_FORCE_INLINE MatrixRegister MatrixInverse(VectorRegister* determinant, const MatrixRegister& m) noexcept
+	{
+		float adjugate[16];
+		const VectorRegister det    = VectorReplicate(detail::Adjugate(m, adjugate));
+		const VectorRegister invDet = VectorReciprocal(det);
+		if (determinant) { *determinant = det; }
+
+		MatrixRegister result;
+		for (int i = 0; i < 4; ++i) { result.r[i] = VectorMultiply(VectorLoad(&adjugate[i * 4]), invDet); }
+		return result;
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixTranslation(float x, float y, float z) noexcept
+	{
+		return MatrixSet(g_IdentityR0, g_IdentityR1, g_IdentityR2, VectorSet(x, y, z, 1.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixTranslationFromVector(VectorRegister offset) noexcept
+	{
+		return MatrixSet(g_IdentityR0, g_IdentityR1, g_IdentityR2, VectorSelect(g_IdentityR3, offset, g_Select1110));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixScaling(float x, float y, float z) noexcept
+	{
+		return MatrixSet(VectorSet(x, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, y, 0.0f, 0.0f), VectorSet(0.0f, 0.0f, z, 0.0f), g_IdentityR3);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixScalingFromVector(VectorRegister scale) noexcept
+	{
+		return MatrixSet
+		(
+			VectorAndInt(scale, VectorSetInt(0xFFFFFFFFu, 0, 0, 0)),
+			VectorAndInt(scale, VectorSetInt(0, 0xFFFFFFFFu, 0, 0)),
+			VectorAndInt(scale, VectorSetInt(0, 0, 0xFFFFFFFFu, 0)),
+			g_IdentityR3
+		);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationX(float angle) noexcept
+	{
+		const float s = std::sin(angle);
+		const float c = std::cos(angle);
+		return MatrixSet(g_IdentityR0, VectorSet(0.0f, c, s, 0.0f), VectorSet(0.0f, -s, c, 0.0f), g_IdentityR3);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationY(float angle) noexcept
+	{
+		const float s = std::sin(angle);
+		const float c = std::cos(angle);
+		return MatrixSet(VectorSet(c, 0.0f, -s, 0.0f), g_IdentityR1, VectorSet(s, 0.0f, c, 0.0f), g_IdentityR3);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationZ(float angle) noexcept
+	{
+		const float s = std::sin(angle);
+		const float c = std::cos(angle);
+		return MatrixSet(VectorSet(c, s, 0.0f, 0.0f), VectorSet(-s, c, 0.0f, 0.0f), g_IdentityR2, g_IdentityR3);
+	}
+
+	/* roll (z), then pitch (x), then yaw (y) */
+	GM_FORCE_INLINE MatrixRegister MatrixRotationRollPitchYaw(float pitch, float yaw, float roll) noexcept
+	{
+		const float cp = std::cos(pitch), sp = std::sin(pitch);
+		const float cy = std::cos(yaw)  , sy = std::sin(yaw);
+		const float cr = std::cos(roll) , sr = std::sin(roll);
+		return MatrixSet
+		(
+			VectorSet(cr * cy + sr * sp * sy, sr * cp, sr * sp * cy - cr * sy, 0.0f),
+			VectorSet(cr * sp * sy - sr * cy, cr * cp, sr * sy + cr * sp * cy, 0.0f),
+			VectorSet(cp * sy               , -sp    , cp * cy               , 0.0f),
+			g_IdentityR3
+		);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationRollPitchYawFromVector(VectorRegister angles) noexcept
+	{
+		return MatrixRotationRollPitchYaw(VectorGetX(angles), VectorGetY(angles), VectorGetZ(angles));
+	}
+
+	/* normalAxis : unit vector */
+	GM_FORCE_INLINE MatrixRegister MatrixRotationNormal(VectorRegister normalAxis, float angle) noexcept
+	{
+		const float s = std::sin(angle);
+		const float c = std::cos(angle);
+		const VectorRegister sine       = VectorReplicate(s);
+		const VectorRegister oneMinusC  = VectorReplicate(1.0f - c);
+
+		const VectorRegister yzx      = VectorSwizzle<1, 2, 0, 3>(normalAxis);
+		const VectorRegister zxy      = VectorSwizzle<2, 0, 1, 3>(normalAxis);
+		const VectorRegister cross    = VectorMultiply(VectorMultiply(oneMinusC, yzx), zxy);                       // (1 - c) (yz, zx, xy)
+		const VectorRegister diagonal = VectorMultiplyAdd(VectorMultiply(oneMinusC, normalAxis), normalAxis, VectorReplicate(c));
+		const VectorRegister plus     = VectorMultiplyAdd(sine, normalAxis, cross);                               // cross + s n
+		const VectorRegister minus    = VectorNegativeMultiplySubtract(sine, normalAxis, cross);                  // cross - s n
+
+		return MatrixSet
+		(
+			VectorSet(VectorGetX(diagonal), VectorGetZ(plus)    , VectorGetY(minus)   , 0.0f),
+			VectorSet(VectorGetZ(minus)   , VectorGetY(diagonal), VectorGetX(plus)    , 0.0f),
+			VectorSet(VectorGetY(plus)    , VectorGetX(minus)   , VectorGetZ(diagonal), 0.0f),
+			g_IdentityR3
+		);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationAxis(VectorRegister axis, float angle) noexcept
+	{
+		return MatrixRotationNormal(Vector3Normalize(axis), angle);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixRotationQuaternion(VectorRegister quaternion) noexcept
+	{
+		const detail::FloatLanes q = detail::ToFloatLanes(quaternion);
+		const float x = q.f[0], y = q.f[1], z = q.f[2], w = q.f[3];
+		const float xx = x * x * 2.0f, yy = y * y * 2.0f, zz = z * z * 2.0f;
+		const float xy = x * y * 2.0f, xz = x * z * 2.0f, yz = y * z * 2.0f;
+		const float wx = w * x * 2.0f, wy = w * y * 2.0f, wz = w * z * 2.0f;
+		return MatrixSet
+		(
+			VectorSet(1.0f - yy - zz, xy + wz       , xz - wy       , 0.0f),
+			VectorSet(xy - wz       , 1.0f - xx - zz, yz + wx       , 0.0f),
+			VectorSet(xz + wy       , yz - wx       , 1.0f - xx - yy, 0.0f),
+			g_IdentityR3
+		);
+	}
+
+	/* scale * (rotation around the origin) + translation */
+	GM_FORCE_INLINE MatrixRegister MatrixAffineTransformation(VectorRegister scaling, VectorRegister rotationOrigin, VectorRegister rotationQuaternion, VectorRegister translation) noexcept
+	{
+		const VectorRegister origin = VectorAndInt(rotationOrigin, g_Mask3);
+		MatrixRegister result = MatrixScalingFromVector(scaling);
+		result.r[3] = VectorSubtract(result.r[3], origin);
+		result      = MatrixMultiply(result, MatrixRotationQuaternion(rotationQuaternion));
+		result.r[3] = VectorAdd(result.r[3], origin);
+		result.r[3] = VectorAdd(result.r[3], VectorAndInt(translation, g_Mask3));
+		return result;
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixAffineTransformation2D(VectorRegister scaling, VectorRegister rotationOrigin, float rotation, VectorRegister translation) noexcept
+	{
+		const VectorRegister origin = VectorAndInt(rotationOrigin, g_Select1100);
+		MatrixRegister result = MatrixScalingFromVector(VectorSelect(g_One, scaling, g_Select1100));
+		result.r[3] = VectorSubtract(result.r[3], origin);
+		result      = MatrixMultiply(result, MatrixRotationZ(rotation));
+		result.r[3] = VectorAdd(result.r[3], origin);
+		result.r[3] = VectorAdd(result.r[3], VectorAndInt(translation, g_Select1100));
+		return result;
+	}
+
+	/* quaternion from a pure rotation matrix */
+	GM_FORCE_INLINE VectorRegister QuaternionRotationMatrix(const MatrixRegister& matrix) noexcept
+	{
+		Float4x4Data m;
+		StoreFloat4x4(&m, matrix);
+
+		/*--- branch on the largest of |x|, |y|, |z|, |w| ---*/
+		if (m.m[2][2] <= 0.0f)
+		{
+			const float dif10 = m.m[1][1] - m.m[0][0];
+			const float omr22 = 1.0f - m.m[2][2];
+			if (dif10 <= 0.0f)
+			{
+				const float fourXSquared = omr22 - dif10;
+				const float inverse      = 0.5f / std::sqrt(fourXSquared);
+				return VectorSet(fourXSquared * inverse, (m.m[0][1] + m.m[1][0]) * inverse, (m.m[0][2] + m.m[2][0]) * inverse, (m.m[1][2] - m.m[2][1]) * inverse);
+			}
+			const float fourYSquared = omr22 + dif10;
+			const float inverse      = 0.5f / std::sqrt(fourYSquared);
+			return VectorSet((m.m[0][1] + m.m[1][0]) * inverse, fourYSquared * inverse, (m.m[1][2] + m.m[2][1]) * inverse, (m.m[2][0] - m.m[0][2]) * inverse);
+		}
+
+		const float sum10 = m.m[1][1] + m.m[0][0];
+		const float opr22 = 1.0f + m.m[2][2];
+		if (sum10 <= 0.0f)
+		{
+			const float fourZSquared = opr22 - sum10;
+			const float inverse      = 0.5f / std::sqrt(fourZSquared);
+			return VectorSet((m.m[0][2] + m.m[2][0]) * inverse, (m.m[1][2] + m.m[2][1]) * inverse, fourZSquared * inverse, (m.m[0][1] - m.m[1][0]) * inverse);
+		}
+		const float fourWSquared = opr22 + sum10;
+		const float inverse      = 0.5f / std::sqrt(fourWSquared);
+		return VectorSet((m.m[1][2] - m.m[2][1]) * inverse, (m.m[2][0] - m.m[0][2]) * inverse, (m.m[0][1] - m.m[1][0]) * inverse, fourWSquared * inverse);
+	}
+
+	/* scale, rotation and translation of an affine matrix. false : a scale is zero */
+	GM_FORCE_INLINE bool MatrixDecompose(VectorRegister* outScale, VectorRegister* outRotationQuaternion, VectorRegister* outTranslation, const MatrixRegister& m) noexcept
+	{
+		*outTranslation = VectorSelect(g_IdentityR3, m.r[3], g_Select1110);
+
+		VectorRegister rows[3] = { VectorAndInt(m.r[0], g_Mask3), VectorAndInt(m.r[1], g_Mask3), VectorAndInt(m.r[2], g_Mask3) };
+		float scales[3] = {};
+		for (int i = 0; i < 3; ++i) { scales[i] = VectorGetX(Vector3Length(rows[i])); }
+
+		/*--- a mirrored matrix : flip the x axis ---*/
+		if (VectorGetX(Vector3Dot(Vector3Cross(rows[0], rows[1]), rows[2])) < 0.0f)
+		{
+			scales[0] = -scales[0];
+		}
+		*outScale = VectorSet(scales[0], scales[1], scales[2], 0.0f);
+
+		for (int i = 0; i < 3; ++i)
+		{
+			if (std::fabs(scales[i]) < 0.0001f) { *outRotationQuaternion = g_IdentityR3; return false; }
+			rows[i] = VectorScale(rows[i], 1.0f / scales[i]);
+		}
+
+		*outRotationQuaternion = QuaternionRotationMatrix(MatrixSet(rows[0], rows[1], rows[2], g_IdentityR3));
+		return true;
+	}
+
+	/****************************************************************************
+	*				  			View and projection
+	*****************************************************************************/
+	GM_FORCE_INLINE MatrixRegister MatrixLookToLH(VectorRegister eyePosition, VectorRegister eyeDirection, VectorRegister upDirection) noexcept
+	{
+		const VectorRegister r2 = Vector3Normalize(eyeDirection);
+		const VectorRegister r0 = Vector3Normalize(Vector3Cross(upDirection, r2));
+		const VectorRegister r1 = Vector3Cross(r2, r0);
+
+		const VectorRegister negativeEye = VectorNegate(eyePosition);
+		const MatrixRegister view = MatrixSet
+		(
+			VectorSelect(Vector3Dot(r0, negativeEye), r0, g_Select1110),
+			VectorSelect(Vector3Dot(r1, negativeEye), r1, g_Select1110),
+			VectorSelect(Vector3Dot(r2, negativeEye), r2, g_Select1110),
+			g_IdentityR3
+		);
+		return MatrixTranspose(view);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixLookToRH(VectorRegister eyePosition, VectorRegister eyeDirection, VectorRegister upDirection) noexcept
+	{
+		return MatrixLookToLH(eyePosition, VectorNegate(eyeDirection), upDirection);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixLookAtLH(VectorRegister eyePosition, VectorRegister focusPosition, VectorRegister upDirection) noexcept
+	{
+		return MatrixLookToLH(eyePosition, VectorSubtract(focusPosition, eyePosition), upDirection);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixLookAtRH(VectorRegister eyePosition, VectorRegister focusPosition, VectorRegister upDirection) noexcept
+	{
+		return MatrixLookToLH(eyePosition, VectorSubtract(eyePosition, focusPosition), upDirection);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveLH(float viewWidth, float viewHeight, float nearZ, float farZ) noexcept
+	{
+		const float twoNearZ = nearZ + nearZ;
+		const float range    = farZ / (farZ - nearZ);
+		return MatrixSet(VectorSet(twoNearZ / viewWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, twoNearZ / viewHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 1.0f), VectorSet(0.0f, 0.0f, -range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveRH(float viewWidth, float viewHeight, float nearZ, float farZ) noexcept
+	{
+		const float twoNearZ = nearZ + nearZ;
+		const float range    = farZ / (nearZ - farZ);
+		return MatrixSet(VectorSet(twoNearZ / viewWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, twoNearZ / viewHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, -1.0f), VectorSet(0.0f, 0.0f, range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveFovLH(float fovAngleY, float aspectRatio, float nearZ, float farZ) noexcept
+	{
+		const float height = std::cos(0.5f * fovAngleY) / std::sin(0.5f * fovAngleY);
+		const float width  = height / aspectRatio;
+		const float range  = farZ / (farZ - nearZ);
+		return MatrixSet(VectorSet(width, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, height, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 1.0f), VectorSet(0.0f, 0.0f, -range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveFovRH(float fovAngleY, float aspectRatio, float nearZ, float farZ) noexcept
+	{
+		const float height = std::cos(0.5f * fovAngleY) / std::sin(0.5f * fovAngleY);
+		const float width  = height / aspectRatio;
+		const float range  = farZ / (nearZ - farZ);
+		return MatrixSet(VectorSet(width, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, height, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, -1.0f), VectorSet(0.0f, 0.0f, range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveOffCenterLH(float viewLeft, float viewRight, float viewBottom, float viewTop, float nearZ, float farZ) noexcept
+	{
+		const float twoNearZ          = nearZ + nearZ;
+		const float reciprocalWidth   = 1.0f / (viewRight - viewLeft);
+		const float reciprocalHeight  = 1.0f / (viewTop - viewBottom);
+		const float range             = farZ / (farZ - nearZ);
+		return MatrixSet(VectorSet(twoNearZ * reciprocalWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, twoNearZ * reciprocalHeight, 0.0f, 0.0f),
+			             VectorSet(-(viewLeft + viewRight) * reciprocalWidth, -(viewTop + viewBottom) * reciprocalHeight, range, 1.0f),
+			             VectorSet(0.0f, 0.0f, -range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixPerspectiveOffCenterRH(float viewLeft, float viewRight, float viewBottom, float viewTop, float nearZ, float farZ) noexcept
+	{
+		const float twoNearZ          = nearZ + nearZ;
+		const float reciprocalWidth   = 1.0f / (viewRight - viewLeft);
+		const float reciprocalHeight  = 1.0f / (viewTop - viewBottom);
+		const float range             = farZ / (nearZ - farZ);
+		return MatrixSet(VectorSet(twoNearZ * reciprocalWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, twoNearZ * reciprocalHeight, 0.0f, 0.0f),
+			             VectorSet((viewLeft + viewRight) * reciprocalWidth, (viewTop + viewBottom) * reciprocalHeight, range, -1.0f),
+			             VectorSet(0.0f, 0.0f, range * nearZ, 0.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixOrthographicLH(float viewWidth, float viewHeight, float nearZ, float farZ) noexcept
+	{
+		const float range = 1.0f / (farZ - nearZ);
+		return MatrixSet(VectorSet(2.0f / viewWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, 2.0f / viewHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 0.0f), VectorSet(0.0f, 0.0f, -range * nearZ, 1.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixOrthographicRH(float viewWidth, float viewHeight, float nearZ, float farZ) noexcept
+	{
+		const float range = 1.0f / (nearZ - farZ);
+		return MatrixSet(VectorSet(2.0f / viewWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, 2.0f / viewHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 0.0f), VectorSet(0.0f, 0.0f, range * nearZ, 1.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixOrthographicOffCenterLH(float viewLeft, float viewRight, float viewBottom, float viewTop, float nearZ, float farZ) noexcept
+	{
+		const float reciprocalWidth  = 1.0f / (viewRight - viewLeft);
+		const float reciprocalHeight = 1.0f / (viewTop - viewBottom);
+		const float range            = 1.0f / (farZ - nearZ);
+		return MatrixSet(VectorSet(reciprocalWidth + reciprocalWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, reciprocalHeight + reciprocalHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 0.0f),
+			             VectorSet(-(viewLeft + viewRight) * reciprocalWidth, -(viewTop + viewBottom) * reciprocalHeight, -range * nearZ, 1.0f));
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixOrthographicOffCenterRH(float viewLeft, float viewRight, float viewBottom, float viewTop, float nearZ, float farZ) noexcept
+	{
+		const float reciprocalWidth  = 1.0f / (viewRight - viewLeft);
+		const float reciprocalHeight = 1.0f / (viewTop - viewBottom);
+		const float range            = 1.0f / (nearZ - farZ);
+		return MatrixSet(VectorSet(reciprocalWidth + reciprocalWidth, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, reciprocalHeight + reciprocalHeight, 0.0f, 0.0f),
+			             VectorSet(0.0f, 0.0f, range, 0.0f),
+			             VectorSet(-(viewLeft + viewRight) * reciprocalWidth, -(viewTop + viewBottom) * reciprocalHeight, range * nearZ, 1.0f));
+	}
+
+	/* projection onto the plane from a point light (w = 1) or a directional light (w = 0) */
+	GM_FORCE_INLINE MatrixRegister MatrixShadow(VectorRegister shadowPlane, VectorRegister lightPosition) noexcept
+	{
+		VectorRegister plane = PlaneNormalize(shadowPlane);
+		const float dot = VectorGetX(PlaneDot(plane, lightPosition));
+		plane = VectorNegate(plane);
+		return MatrixSet
+		(
+			VectorMultiplyAdd(VectorSplatX(plane), lightPosition, VectorSet(dot, 0.0f, 0.0f, 0.0f)),
+			VectorMultiplyAdd(VectorSplatY(plane), lightPosition, VectorSet(0.0f, dot, 0.0f, 0.0f)),
+			VectorMultiplyAdd(VectorSplatZ(plane), lightPosition, VectorSet(0.0f, 0.0f, dot, 0.0f)),
+			VectorMultiplyAdd(VectorSplatW(plane), lightPosition, VectorSet(0.0f, 0.0f, 0.0f, dot))
+		);
+	}
+
+	GM_FORCE_INLINE MatrixRegister MatrixReflect(VectorRegister reflectionPlane) noexcept
+	{
+		const VectorRegister plane = PlaneNormalize(reflectionPlane);
+		const VectorRegister scale = VectorMultiply(plane, VectorReplicate(-2.0f));
+		return MatrixSet
+		(
+			VectorMultiplyAdd(VectorSplatX(plane), scale, g_IdentityR0),
+			VectorMultiplyAdd(VectorSplatY(plane), scale, g_IdentityR1),
+			VectorMultiplyAdd(VectorSplatZ(plane), scale, g_IdentityR2),
+			VectorMultiplyAdd(VectorSplatW(plane), scale, g_IdentityR3)
+		);
+	}
+#pragma endregion Matrix
+
+#pragma region Quaternion
+	/****************************************************************************
+	*				  			Quaternion (x, y, z, w)
+	*****************************************************************************/
+	GM_FORCE_INLINE VectorRegister QuaternionIdentity() noexcept { return g_IdentityR3; }
+
+	GM_FORCE_INLINE VectorRegister QuaternionDot     (VectorRegister a, VectorRegister b) noexcept { return Vector4Dot(a, b); }
+	GM_FORCE_INLINE VectorRegister QuaternionLengthSq(VectorRegister q) noexcept { return Vector4LengthSq(q); }
+	GM_FORCE_INLINE VectorRegister QuaternionLength  (VectorRegister q) noexcept { return Vector4Length(q); }
+	GM_FORCE_INLINE VectorRegister QuaternionNormalize(VectorRegister q) noexcept { return Vector4Normalize(q); }
+	GM_FORCE_INLINE bool           QuaternionEqual   (VectorRegister a, VectorRegister b) noexcept { return Vector4Equal(a, b); }
+	GM_FORCE_INLINE bool           QuaternionNotEqual(VectorRegister a, VectorRegister b) noexcept { return Vector4NotEqual(a, b); }
+
+	/* rotation q1 followed by q2 (the product q2 q1) */
+	GM_FORCE_INLINE VectorRegister QuaternionMultiply(VectorRegister q1, VectorRegister q2) noexcept
+	{
+		VectorRegister result = VectorMultiply(VectorSplatW(q2), q1);
+		result = VectorMultiplyAdd(VectorMultiply(VectorSplatX(q2), VectorSwizzle<3, 2, 1, 0>(q1)), VectorSet( 1.0f, -1.0f,  1.0f, -1.0f), result);
+		result = VectorMultiplyAdd(VectorMultiply(VectorSplatY(q2), VectorSwizzle<2, 3, 0, 1>(q1)), VectorSet( 1.0f,  1.0f, -1.0f, -1.0f), result);
+		result = VectorMultiplyAdd(VectorMultiply(VectorSplatZ(q2), VectorSwizzle<1, 0, 3, 2>(q1)), VectorSet(-1.0f,  1.0f,  1.0f, -1.0f), result);
+		return result;
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionConjugate(VectorRegister q) noexcept
+	{
+		return VectorMultiply(q, VectorSet(-1.0f, -1.0f, -1.0f, 1.0f));
+	}
+
+	/* zero for a zero quaternion */
+	GM_FORCE_INLINE VectorRegister QuaternionInverse(VectorRegister q) noexcept
+	{
+		const VectorRegister lengthSquared = Vector4LengthSq(q);
+		const VectorRegister isZero        = VectorLessOrEqual(lengthSquared, g_Epsilon);
+		return VectorSelect(VectorDivide(QuaternionConjugate(q), lengthSquared), VectorZero(), isZero);
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionRotationNormal(VectorRegister normalAxis, float angle) noexcept
+	{
+		const float halfAngle = 0.5f * angle;
+		const VectorRegister axis = VectorSelect(g_One, normalAxis, g_Select1110);
+		return VectorMultiply(axis, VectorSet(std::sin(halfAngle), std::sin(halfAngle), std::sin(halfAngle), std::cos(halfAngle)));
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionRotationAxis(VectorRegister axis, float angle) noexcept
+	{
+		return QuaternionRotationNormal(Vector3Normalize(axis), angle);
+	}
+
+	/* roll (z), then pitch (x), then yaw (y) */
+	GM_FORCE_INLINE VectorRegister QuaternionRotationRollPitchYaw(float pitch, float yaw, float roll) noexcept
+	{
+		const float cp = std::cos(0.5f * pitch), sp = std::sin(0.5f * pitch);
+		const float cy = std::cos(0.5f * yaw)  , sy = std::sin(0.5f * yaw);
+		const float cr = std::cos(0.5f * roll) , sr = std::sin(0.5f * roll);
+		return VectorSet
+		(
+			cr * sp * cy + sr * cp * sy,
+			cr * cp * sy - sr * sp * cy,
+			sr * cp * cy - cr * sp * sy,
+			cr * cp * cy + sr * sp * sy
+		);
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionRotationRollPitchYawFromVector(VectorRegister angles) noexcept
+	{
+		return QuaternionRotationRollPitchYaw(VectorGetX(angles), VectorGetY(angles), VectorGetZ(angles));
+	}
+
+	GM_FORCE_INLINE void QuaternionToAxisAngle(VectorRegister* axis, float* angle, VectorRegister q) noexcept
+	{
+		*axis  = q;
+		*angle = 2.0f * VectorGetX(VectorACos(VectorSplatW(q)));
+	}
+
+	/* spherical interpolation along the shorter arc (linear for almost the same rotations) */
+	GM_FORCE_INLINE VectorRegister QuaternionSlerpV(VectorRegister q0, VectorRegister q1, VectorRegister t) noexcept
+	{
+		const VectorRegister oneMinusEpsilon = VectorReplicate(1.0f - 0.00001f);
+
+		VectorRegister cosOmega = QuaternionDot(q0, q1);
+		const VectorRegister sign = VectorSelect(g_One, g_NegativeOne, VectorLess(cosOmega, VectorZero()));
+		cosOmega = VectorMultiply(cosOmega, sign);
+
+		const VectorRegister useSine  = VectorLess(cosOmega, oneMinusEpsilon);
+		const VectorRegister sinOmega = VectorSqrt(VectorNegativeMultiplySubtract(cosOmega, cosOmega, g_One));
+		const VectorRegister omega    = VectorATan2(sinOmega, cosOmega);
+
+		/*--- (1 - t, t) ---*/
+		const VectorRegister weights = VectorSelect(VectorZero(), VectorPermute<0, 5, 2, 3>(VectorSubtract(g_One, t), t), g_Select1100);
+		VectorRegister scale = VectorMultiply(VectorSin(VectorMultiply(weights, omega)), VectorReciprocal(sinOmega));
+		scale = VectorSelect(weights, scale, useSine);
+
+		const VectorRegister scale0 = VectorSplatX(scale);
+		const VectorRegister scale1 = VectorMultiply(VectorSplatY(scale), sign);
+		return VectorMultiplyAdd(q0, scale0, VectorMultiply(q1, scale1));
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionSlerp(VectorRegister q0, VectorRegister q1, float t) noexcept
+	{
+		return QuaternionSlerpV(q0, q1, VectorReplicate(t));
+	}
+
+	/* spherical quadrangle interpolation of the control points q1, a, b, c */
+	GM_FORCE_INLINE VectorRegister QuaternionSquadV(VectorRegister q1, VectorRegister a, VectorRegister b, VectorRegister c, VectorRegister t) noexcept
+	{
+		const VectorRegister q03 = QuaternionSlerpV(q1, c, t);
+		const VectorRegister q12 = QuaternionSlerpV(a , b, t);
+		const VectorRegister tp  = VectorMultiply(VectorNegativeMultiplySubtract(t, t, t), VectorReplicate(2.0f)); // 2 (t - t^2)
+		return QuaternionSlerpV(q03, q12, tp);
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionSquad(VectorRegister q1, VectorRegister a, VectorRegister b, VectorRegister c, float t) noexcept
+	{
+		return QuaternionSquadV(q1, a, b, c, VectorReplicate(t));
+	}
+
+	GM_FORCE_INLINE VectorRegister QuaternionBaryCentric(VectorRegister q0, VectorRegister q1, VectorRegister q2, float f, float g) noexcept
+	{
+		const float s = f + g;
+		if (s < 0.00001f && s > -0.00001f) { return q0; }
+
+		const VectorRegister q01 = QuaternionSlerp(q0, q1, s);
+		const VectorRegister q02 = QuaternionSlerp(q0, q2, s);
+		return QuaternionSlerp(q01, q02, g / s);
+	}
+
+	/* v rotated by the quaternion (w of v is ignored) */
+	GM_FORCE_INLINE VectorRegister Vector3Rotate(VectorRegister v, VectorRegister rotationQuaternion) noexcept
+	{
+		const VectorRegister pure   = VectorAndInt(v, g_Mask3);
+		const VectorRegister result = QuaternionMultiply(QuaternionConjugate(rotationQuaternion), pure);
+		return QuaternionMultiply(result, rotationQuaternion);
+	}
+#pragma endregion Quaternion
+
+#pragma region Color
+	/****************************************************************************
+	*				  			Color (r, g, b, a). The alpha is kept.
+	*****************************************************************************/
+	namespace detail
+	{
+		/* (rgb * M, a) */
+		GM_FORCE_INLINE VectorRegister ColorTransform(VectorRegister color, VectorRegister row0, VectorRegister row1, VectorRegister row2) noexcept
+		{
+			const VectorRegister xy = VectorMultiplyAdd(VectorSplatY(color), row1, VectorMultiply(VectorSplatX(color), row0));
+			return VectorMultiplyAdd(VectorSplatZ(color), row2, xy);
+		}
+
+		GM_FORCE_INLINE VectorRegister KeepAlpha(VectorRegister color, VectorRegister rgb) noexcept
+		{
+			return VectorSelect(color, rgb, g_Select1110);
+		}
+
+		GM_FORCE_INLINE float HueToColor(float p, float q, float h) noexcept
+		{
+			if (h < 0.0f) { h += 1.0f; }
+			if (h > 1.0f) { h -= 1.0f; }
+			if (h < 1.0f / 6.0f) { return p + (q - p) * 6.0f * h; }
+			if (h < 0.5f)        { return q; }
+			if (h < 2.0f / 3.0f) { return p + (q - p) * (2.0f / 3.0f - h) * 6.0f; }
+			return p;
+		}
+	}
+
+	GM_FORCE_INLINE bool ColorIsNaN     (VectorRegister color) noexcept { return Vector4IsNaN(color); }
+	GM_FORCE_INLINE bool ColorIsInfinite(VectorRegister color) noexcept { return Vector4IsInfinite(color); }
+
+	GM_FORCE_INLINE VectorRegister ColorNegative(VectorRegister color) noexcept
+	{
+		return detail::KeepAlpha(color, VectorSubtract(g_One, color));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorModulate(VectorRegister a, VectorRegister b) noexcept
+	{
+		return VectorMultiply(a, b);
+	}
+
+	/* lerp between the luminance (Rec.709) and the color */
+	GM_FORCE_INLINE VectorRegister ColorAdjustSaturation(VectorRegister color, float saturation) noexcept
+	{
+		const VectorRegister luminance = Vector3Dot(color, VectorSet(0.2125f, 0.7154f, 0.0721f, 0.0f));
+		return detail::KeepAlpha(color, VectorMultiplyAdd(VectorSubtract(color, luminance), VectorReplicate(saturation), luminance));
+	}
+
+	/* lerp between gray (0.5) and the color */
+	GM_FORCE_INLINE VectorRegister ColorAdjustContrast(VectorRegister color, float contrast) noexcept
+	{
+		return detail::KeepAlpha(color, VectorMultiplyAdd(VectorSubtract(color, g_OneHalf), VectorReplicate(contrast), g_OneHalf));
+	}
+
+	/* (hue, saturation, lightness, a) in [0, 1] */
+	GM_FORCE_INLINE VectorRegister ColorRGBToHSL(VectorRegister rgb) noexcept
+	{
+		const detail::FloatLanes c = detail::ToFloatLanes(rgb);
+		const float r = c.f[0], g = c.f[1], b = c.f[2];
+		const float minimum   = (std::min)(r, (std::min)(g, b));
+		const float maximum   = (std::max)(r, (std::max)(g, b));
+		const float lightness = (minimum + maximum) * 0.5f;
+		const float delta     = maximum - minimum;
+		if (delta < FLT_EPSILON) { return VectorSet(0.0f, 0.0f, lightness, c.f[3]); }
+
+		const float sum        = minimum + maximum;
+		const float saturation = lightness > 0.5f ? delta / (2.0f - sum) : delta / sum;
+		float hue = r == maximum ? (g - b) / delta : g == maximum ? (b - r) / delta + 2.0f : (r - g) / delta + 4.0f;
+		hue /= 6.0f;
+		if (hue < 0.0f) { hue += 1.0f; }
+		return VectorSet(hue, saturation, lightness, c.f[3]);
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorHSLToRGB(VectorRegister hsl) noexcept
+	{
+		const detail::FloatLanes c = detail::ToFloatLanes(hsl);
+		const float h = c.f[0], s = c.f[1], l = c.f[2];
+		if (std::fabs(s) < FLT_EPSILON) { return VectorSet(l, l, l, c.f[3]); }
+
+		const float t2 = l < 0.5f ? l * (1.0f + s) : (l + s) - (s * l);
+		const float t1 = 2.0f * l - t2;
+		return VectorSet(detail::HueToColor(t1, t2, h + 1.0f / 3.0f), detail::HueToColor(t1, t2, h), detail::HueToColor(t1, t2, h - 1.0f / 3.0f), c.f[3]);
+	}
+
+	/* (hue, saturation, value, a) in [0, 1] */
+	GM_FORCE_INLINE VectorRegister ColorRGBToHSV(VectorRegister rgb) noexcept
+	{
+		const detail::FloatLanes c = detail::ToFloatLanes(rgb);
+		const float r = c.f[0], g = c.f[1], b = c.f[2];
+		const float minimum    = (std::min)(r, (std::min)(g, b));
+		const float value      = (std::max)(r, (std::max)(g, b));
+		const float delta      = value - minimum;
+		const float saturation = value == 0.0f ? 0.0f : delta / value;
+		if (delta < FLT_EPSILON) { return VectorSet(0.0f, saturation, value, c.f[3]); }
+
+		float hue = 0.0f;
+		if      (r == value) { hue = (g - b) / delta; if (g < b) { hue += 6.0f; } }
+		else if (g == value) { hue = (b - r) / delta + 2.0f; }
+		else                 { hue = (r - g) / delta + 4.0f; }
+		return VectorSet(hue / 6.0f, saturation, value, c.f[3]);
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorHSVToRGB(VectorRegister hsv) noexcept
+	{
+		const detail::FloatLanes c = detail::ToFloatLanes(hsv);
+		const float h = c.f[0], s = c.f[1], v = c.f[2];
+		const float h6 = h * 6.0f;
+		const float i  = std::floor(h6);
+		const float f  = h6 - i;
+		const float p  = v * (1.0f - s);
+		const float q  = v * (1.0f - f * s);
+		const float t  = v * (1.0f - (1.0f - f) * s);
+
+		int sector = (int)std::fmod(i, 6.0f);
+		if (sector < 0) { sector += 6; }
+		switch (sector)
+		{
+			case 0:  return VectorSet(v, t, p, c.f[3]);
+			case 1:  return VectorSet(q, v, p, c.f[3]);
+			case 2:  return VectorSet(p, v, t, c.f[3]);
+			case 3:  return VectorSet(p, q, v, c.f[3]);
+			case 4:  return VectorSet(t, p, v, c.f[3]);
+			default: return VectorSet(v, p, q, c.f[3]);
+		}
+	}
+
+	/* analog PAL (BT.601) */
+	GM_FORCE_INLINE VectorRegister ColorRGBToYUV(VectorRegister rgb) noexcept
+	{
+		return detail::KeepAlpha(rgb, detail::ColorTransform(rgb, VectorSet(0.299f, -0.147f, 0.615f, 0.0f), VectorSet(0.587f, -0.289f, -0.515f, 0.0f), VectorSet(0.114f, 0.436f, -0.100f, 0.0f)));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorYUVToRGB(VectorRegister yuv) noexcept
+	{
+		return detail::KeepAlpha(yuv, detail::ColorTransform(yuv, g_One, VectorSet(0.0f, -0.395f, 2.032f, 0.0f), VectorSet(1.140f, -0.581f, 0.0f, 0.0f)));
+	}
+
+	/* BT.709 */
+	GM_FORCE_INLINE VectorRegister ColorRGBToYUV_HD(VectorRegister rgb) noexcept
+	{
+		return detail::KeepAlpha(rgb, detail::ColorTransform(rgb, VectorSet(0.2126f, -0.0997f, 0.6150f, 0.0f), VectorSet(0.7152f, -0.3354f, -0.5586f, 0.0f), VectorSet(0.0722f, 0.4351f, -0.0564f, 0.0f)));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorYUVToRGB_HD(VectorRegister yuv) noexcept
+	{
+		return detail::KeepAlpha(yuv, detail::ColorTransform(yuv, g_One, VectorSet(0.0f, -0.2153f, 2.1324f, 0.0f), VectorSet(1.2803f, -0.3806f, 0.0f, 0.0f)));
+	}
+
+	/* CIE 1931 */
+	GM_FORCE_INLINE VectorRegister ColorRGBToXYZ(VectorRegister rgb) noexcept
+	{
+		const VectorRegister xyz = detail::ColorTransform(rgb, VectorSet(0.4887180f, 0.1762044f, 0.0f, 0.0f), VectorSet(0.3106803f, 0.8129847f, 0.0102048f, 0.0f), VectorSet(0.2006017f, 0.0108109f, 0.9897952f, 0.0f));
+		return detail::KeepAlpha(rgb, VectorMultiply(xyz, VectorReplicate(1.0f / 0.17697f)));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorXYZToRGB(VectorRegister xyz) noexcept
+	{
+		const VectorRegister scaled = VectorMultiply(xyz, VectorReplicate(0.17697f));
+		return detail::KeepAlpha(xyz, detail::ColorTransform(scaled, VectorSet(2.3706743f, -0.5138850f, 0.0052982f, 0.0f), VectorSet(-0.9000405f, 1.4253036f, -0.0146949f, 0.0f), VectorSet(-0.4706338f, 0.0885814f, 1.0093968f, 0.0f)));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorSRGBToXYZ(VectorRegister srgb) noexcept
+	{
+		const VectorRegister linear = VectorDivide(srgb, VectorReplicate(12.92f));
+		const VectorRegister curve  = VectorPow(VectorDivide(VectorAdd(srgb, VectorReplicate(0.055f)), VectorReplicate(1.055f)), VectorReplicate(2.4f));
+		const VectorRegister rgb    = VectorSelect(linear, curve, VectorGreater(srgb, VectorReplicate(0.04045f)));
+		return detail::KeepAlpha(srgb, detail::ColorTransform(rgb, VectorSet(0.4124f, 0.2126f, 0.0193f, 0.0f), VectorSet(0.3576f, 0.7152f, 0.1192f, 0.0f), VectorSet(0.1805f, 0.0722f, 0.9505f, 0.0f)));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorXYZToSRGB(VectorRegister xyz) noexcept
+	{
+		const VectorRegister rgb    = detail::ColorTransform(xyz, VectorSet(3.2406f, -0.9689f, 0.0557f, 0.0f), VectorSet(-1.5372f, 1.8758f, -0.2040f, 0.0f), VectorSet(-0.4986f, 0.0415f, 1.0570f, 0.0f));
+		const VectorRegister linear = VectorMultiply(rgb, VectorReplicate(12.92f));
+		const VectorRegister curve  = VectorSubtract(VectorMultiply(VectorPow(rgb, VectorReplicate(1.0f / 2.4f)), VectorReplicate(1.055f)), VectorReplicate(0.055f));
+		return detail::KeepAlpha(xyz, VectorSelect(linear, curve, VectorGreater(rgb, VectorReplicate(0.0031308f))));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorRGBToSRGB(VectorRegister rgb) noexcept
+	{
+		const VectorRegister v      = VectorSaturate(rgb);
+		const VectorRegister linear = VectorMultiply(v, VectorReplicate(12.92f));
+		const VectorRegister curve  = VectorSubtract(VectorMultiply(VectorPow(v, VectorReplicate(1.0f / 2.4f)), VectorReplicate(1.055f)), VectorReplicate(0.055f));
+		return detail::KeepAlpha(rgb, VectorSelect(curve, linear, VectorLess(v, VectorReplicate(0.0031308f))));
+	}
+
+	GM_FORCE_INLINE VectorRegister ColorSRGBToRGB(VectorRegister srgb) noexcept
+	{
+		const VectorRegister v      = VectorSaturate(srgb);
+		const VectorRegister linear = VectorMultiply(v, VectorReplicate(1.0f / 12.92f));
+		const VectorRegister curve  = VectorPow(VectorMultiply(VectorAdd(v, VectorReplicate(0.055f)), VectorReplicate(1.0f / 1.055f)), VectorReplicate(2.4f));
+		return detail::KeepAlpha(srgb, VectorSelect(linear, curve, VectorGreater(v, VectorReplicate(0.04045f))));
+	}
+#pragma endregion Color
+}
+
+#endif
@@ -14,6 +14,15 @@
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cassert>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -25,6 +34,39 @@
 //////////////////////////////////////////////////////////////////////////////////
 namespace gm
 {
+	namespace sort_detail
+	{
+		/* placeholder payload for the key only radix sort */
+		struct NoPayload {};
+
+		template<size_t Size> struct UnsignedOf;
+		template<> struct UnsignedOf<1> { using Type = std::uint8_t;  };
+		template<> struct UnsignedOf<2> { using Type = std::uint16_t; };
+		template<> struct UnsignedOf<4> { using Type = std::uint32_t; };
+		template<> struct UnsignedOf<8> { using Type = std::uint64_t; };
+
+		/****************************************************************************
+		*							ToRadixKey
+		*************************************************************************//**
+		*  @fn        typename UnsignedOf<sizeof(T)>::Type ToRadixKey(T value)
+		*  @brief     Map the value to the unsigned key with the same order.
+		*             signed int: flip the sign bit, float: flip all bits when negative, else the sign bit.
+		*  @param[in] T value
+		*  @return    unsigned key
+		*****************************************************************************/
+		template<typename T> inline typename UnsignedOf<sizeof(T)>::Type ToRadixKey(T value)
+		{
+			using Unsigned = typename UnsignedOf<sizeof(T)>::Type;
+			constexpr Unsigned SignBit = static_cast<Unsigned>(Unsigned(1) << (sizeof(T) * 8 - 1));
+
+			Unsigned bits;
+			std::memcpy(&bits, &value, sizeof(T));
+			if constexpr (std::is_floating_point_v<T>) { return (bits & SignBit) ? static_cast<Unsigned>(~bits) : static_cast<Unsigned>(bits | SignBit); }
+			else if constexpr (std::is_signed_v<T>)   { return static_cast<Unsigned>(bits ^ SignBit); }
+			else                                       { return bits; }
+		}
+	}
+
 	/****************************************************************************
 	*				  			Sort
 	*************************************************************************//**
@@ -65,6 +107,23 @@ namespace gm
 		static void MergeSortDescend    (std::vector<T>& vector, int left, int right);
 		static void QuickSortAscend     (std::vector<T>& vector, int left, int right);
 		static void QuickSortDescend    (std::vector<T>& vector, int left, int right);
+
+
+		// for array (fast sorts for the per frame sorting)
+		static void RadixSortAscend (T* array, size_t arraySize);
+		static void RadixSortDescend(T* array, size_t arraySize);
+		template<typename Payload> static void RadixSortAscend (T* keys, Payload* payloads, size_t arraySize);
+		template<typename Payload> static void RadixSortDescend(T* keys, Payload* payloads, size_t arraySize);
+		template<typename Compare = std::less<T>> static void IntroSort   (T* array, size_t arraySize, Compare compare = Compare());
+		template<typename Compare = std::less<T>> static void ParallelSort(T* array, size_t arraySize, Compare compare = Compare(), unsigned int threadCount = 0);
+
+		// for std::vector (fast sorts for the per frame sorting)
+		static void RadixSortAscend (std::vector<T>& vector);
+		static void RadixSortDescend(std::vector<T>& vector);
+		template<typename Payload> static void RadixSortAscend (std::vector<T>& keys, std::vector<Payload>& payloads);
+		template<typename Payload> static void RadixSortDescend(std::vector<T>& keys, std::vector<Payload>& payloads);
+		template<typename Compare = std::less<T>> static void IntroSort   (std::vector<T>& vector, Compare compare = Compare());
+		template<typename Compare = std::less<T>> static void ParallelSort(std::vector<T>& vector, Compare compare = Compare(), unsigned int threadCount = 0);
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
@@ -83,6 +142,15 @@ namespace gm
 		static void MergeAscend (std::vector<T>& vector, int left, int mid, int right);
 		static void MergeDescend(std::vector<T>& vector, int left, int mid, int right);
 		static T Median(T& a, T& b, T& c);
+
+		template<bool IsDescend, typename Payload> static void RadixSort(T* keys, Payload* payloads, size_t arraySize);
+		template<typename Compare> static void IntroSortLoop(T* begin, T* end, Compare& compare, int badAllowed, bool isLeftmost);
+		template<typename Compare> static T*   PartitionRight(T* begin, T* end, Compare& compare, bool& isAlreadyPartitioned);
+		template<typename Compare> static T*   PartitionLeft (T* begin, T* end, Compare& compare);
+		template<typename Compare> static void InsertionSortRange         (T* begin, T* end, Compare& compare);
+		template<typename Compare> static void UnguardedInsertionSortRange(T* begin, T* end, Compare& compare);
+		template<typename Compare> static bool PartialInsertionSortRange  (T* begin, T* end, Compare& compare);
+		template<typename Compare> static void Sort3(T* a, T* b, T* c, Compare& compare);
 		
 
 		/****************************************************************************
@@ -384,7 +452,7 @@ namespace gm
 		
 		if (right - left <= QUICK_THREASHOLD)
 		{
-			InsertionSortAscend(array, right - left + 1);
+			InsertionSortAscend(array + left, right - left + 1);
 			return;
 		}
 		
@@ -423,7 +491,7 @@ namespace gm
 
 		if (right - left <= QUICK_THREASHOLD)
 		{
-			InsertionSortDescend(array, right - left + 1);
+			InsertionSortDescend(array + left, right - left + 1);
 			return;
 		}
 
@@ -714,6 +782,240 @@ namespace gm
 			gm::Sort<T>::MergeDescend  (vector, left, mid, right);
 		}
 	}
+
+	/****************************************************************************
+	*							RadixSortAscend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortAscend(T* array, size_t arraySize)
+	*  @brief     LSD Radix Sort (O(n), stable). T must be an integer or floating point type.
+	*             The digits which are the same in all keys are skipped.
+	*  @param[out]T*     array
+	*  @param[in] size_t arraySize
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSortAscend(T* array, size_t arraySize)
+	{
+		RadixSort<false, sort_detail::NoPayload>(array, nullptr, arraySize);
+	}
+
+	/****************************************************************************
+	*							RadixSortDescend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortDescend(T* array, size_t arraySize)
+	*  @brief     LSD Radix Sort (O(n), stable). T must be an integer or floating point type.
+	*  @param[out]T*     array
+	*  @param[in] size_t arraySize
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSortDescend(T* array, size_t arraySize)
+	{
+		RadixSort<true, sort_detail::NoPayload>(array, nullptr, arraySize);
+	}
+
+	/****************************************************************************
+	*							RadixSortAscend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortAscend(T* keys, Payload* payloads, size_t arraySize)
+	*  @brief     LSD Radix Sort of the key + payload pairs (ex. depth + draw index)
+	*  @param[out]T*       keys
+	*  @param[out]Payload* payloads (moved with the keys. Payload must be default constructible)
+	*  @param[in] size_t   arraySize
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Payload> void Sort<T>::RadixSortAscend(T* keys, Payload* payloads, size_t arraySize)
+	{
+		RadixSort<false, Payload>(keys, payloads, arraySize);
+	}
+
+	/****************************************************************************
+	*							RadixSortDescend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortDescend(T* keys, Payload* payloads, size_t arraySize)
+	*  @brief     LSD Radix Sort of the key + payload pairs (ex. depth + draw index)
+	*  @param[out]T*       keys
+	*  @param[out]Payload* payloads (moved with the keys. Payload must be default constructible)
+	*  @param[in] size_t   arraySize
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Payload> void Sort<T>::RadixSortDescend(T* keys, Payload* payloads, size_t arraySize)
+	{
+		RadixSort<true, Payload>(keys, payloads, arraySize);
+	}
+
+	/****************************************************************************
+	*							IntroSort
+	*************************************************************************//**
+	*  @fn        void Sort<T>::IntroSort(T* array, size_t arraySize, Compare compare)
+	*  @brief     Pattern defeating quick sort (O(nlogn) in the worst case, not stable).
+	*             Sorted / reverse sorted / equal inputs become O(n), and heap sort is used
+	*             after too many unbalanced partitions.
+	*  @param[out]T*      array
+	*  @param[in] size_t  arraySize
+	*  @param[in] Compare compare (strict weak ordering. default: ascend)
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::IntroSort(T* array, size_t arraySize, Compare compare)
+	{
+		if (arraySize < 2) { return; }
+
+		int badAllowed = 0;
+		for (size_t n = arraySize; n > 1; n >>= 1) { badAllowed++; }
+		IntroSortLoop(array, array + arraySize, compare, badAllowed, true);
+	}
+
+	/****************************************************************************
+	*							ParallelSort
+	*************************************************************************//**
+	*  @fn        void Sort<T>::ParallelSort(T* array, size_t arraySize, Compare compare, unsigned int threadCount)
+	*  @brief     Split the array into threadCount chunks, IntroSort each chunk on its own thread,
+	*             and merge the neighbor chunks in parallel. (compare is copied to each thread)
+	*  @param[out]T*           array
+	*  @param[in] size_t       arraySize
+	*  @param[in] Compare      compare
+	*  @param[in] unsigned int threadCount (0: hardware concurrency)
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::ParallelSort(T* array, size_t arraySize, Compare compare, unsigned int threadCount)
+	{
+		if (threadCount == 0) { threadCount = std::thread::hardware_concurrency(); }
+
+		/*-------------------------------------------------------------------
+		-        Small arrays are faster on one thread
+		---------------------------------------------------------------------*/
+		const size_t minChunkSize = 4096;
+		const size_t chunkCount   = (std::min)(static_cast<size_t>(threadCount), arraySize / minChunkSize);
+		if (chunkCount <= 1) { IntroSort(array, arraySize, compare); return; }
+
+		std::vector<size_t> bounds(chunkCount + 1);
+		for (size_t i = 0; i <= chunkCount; ++i) { bounds[i] = arraySize * i / chunkCount; }
+
+		/*-------------------------------------------------------------------
+		-        Sort each chunk
+		---------------------------------------------------------------------*/
+		std::vector<std::thread> threads;
+		threads.reserve(chunkCount);
+		for (size_t i = 1; i < chunkCount; ++i)
+		{
+			T*     chunk     = array + bounds[i];
+			size_t chunkSize = bounds[i + 1] - bounds[i];
+			threads.emplace_back([=]() { IntroSort(chunk, chunkSize, compare); });
+		}
+		IntroSort(array, bounds[1], compare);
+		for (auto& thread : threads) { thread.join(); }
+
+		/*-------------------------------------------------------------------
+		-        Merge the neighbor runs until one run remains
+		---------------------------------------------------------------------*/
+		std::vector<T> buffer(arraySize);
+		T* source      = array;
+		T* destination = buffer.data();
+		while (bounds.size() > 2)
+		{
+			std::vector<size_t> nextBounds(1, 0);
+			threads.clear();
+			for (size_t i = 0; i + 1 < bounds.size(); i += 2)
+			{
+				const size_t first = bounds[i];
+				const size_t mid   = bounds[i + 1];
+				const size_t last  = i + 2 < bounds.size() ? bounds[i + 2] : mid;
+				threads.emplace_back([=]()
+				{
+					std::merge(std::make_move_iterator(source + first), std::make_move_iterator(source + mid),
+						std::make_move_iterator(source + mid), std::make_move_iterator(source + last), destination + first, compare);
+				});
+				nextBounds.push_back(last);
+			}
+			for (auto& thread : threads) { thread.join(); }
+			std::swap(source, destination);
+			bounds = std::move(nextBounds);
+		}
+		if (source != array) { std::move(source, source + arraySize, array); }
+	}
+
+	/****************************************************************************
+	*							RadixSortAscend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortAscend(std::vector<T>& vector)
+	*  @brief     LSD Radix Sort (O(n), stable)
+	*  @param[out]std::vector<T>& vector
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSortAscend(std::vector<T>& vector)
+	{
+		RadixSortAscend(vector.data(), vector.size());
+	}
+
+	/****************************************************************************
+	*							RadixSortDescend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortDescend(std::vector<T>& vector)
+	*  @brief     LSD Radix Sort (O(n), stable)
+	*  @param[out]std::vector<T>& vector
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSortDescend(std::vector<T>& vector)
+	{
+		RadixSortDescend(vector.data(), vector.size());
+	}
+
+	/****************************************************************************
+	*							RadixSortAscend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortAscend(std::vector<T>& keys, std::vector<Payload>& payloads)
+	*  @brief     LSD Radix Sort of the key + payload pairs (keys.size() == payloads.size())
+	*  @param[out]std::vector<T>&       keys
+	*  @param[out]std::vector<Payload>& payloads
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Payload> void Sort<T>::RadixSortAscend(std::vector<T>& keys, std::vector<Payload>& payloads)
+	{
+		assert(keys.size() == payloads.size());
+		RadixSortAscend(keys.data(), payloads.data(), keys.size());
+	}
+
+	/****************************************************************************
+	*							RadixSortDescend
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSortDescend(std::vector<T>& keys, std::vector<Payload>& payloads)
+	*  @brief     LSD Radix Sort of the key + payload pairs (keys.size() == payloads.size())
+	*  @param[out]std::vector<T>&       keys
+	*  @param[out]std::vector<Payload>& payloads
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Payload> void Sort<T>::RadixSortDescend(std::vector<T>& keys, std::vector<Payload>& payloads)
+	{
+		assert(keys.size() == payloads.size());
+		RadixSortDescend(keys.data(), payloads.data(), keys.size());
+	}
+
+	/****************************************************************************
+	*							IntroSort
+	*************************************************************************//**
+	*  @fn        void Sort<T>::IntroSort(std::vector<T>& vector, Compare compare)
+	*  @brief     Pattern defeating quick sort (O(nlogn) in the worst case, not stable)
+	*  @param[out]std::vector<T>& vector
+	*  @param[in] Compare compare
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::IntroSort(std::vector<T>& vector, Compare compare)
+	{
+		IntroSort(vector.data(), vector.size(), compare);
+	}
+
+	/****************************************************************************
+	*							ParallelSort
+	*************************************************************************//**
+	*  @fn        void Sort<T>::ParallelSort(std::vector<T>& vector, Compare compare, unsigned int threadCount)
+	*  @brief     Multi thread IntroSort + merge
+	*  @param[out]std::vector<T>& vector
+	*  @param[in] Compare      compare
+	*  @param[in] unsigned int threadCount (0: hardware concurrency)
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::ParallelSort(std::vector<T>& vector, Compare compare, unsigned int threadCount)
+	{
+		ParallelSort(vector.data(), vector.size(), compare, threadCount);
+	}
 #pragma endregion Public Function
 #pragma region Private Function
 	/****************************************************************************
@@ -866,11 +1168,11 @@ namespace gm
 
 		for (int i = 0; i < leftSize; i++)
 		{
-			leftArray[i] = vector[(INT64)left + i];
+			leftArray[i] = vector[(std::int64_t)left + i];
 		}
 		for (int i = 0; i < rightSize; i++)
 		{
-			rightArray[i] = vector[(INT64)mid + 1 + i];
+			rightArray[i] = vector[(std::int64_t)mid + 1 + i];
 		}
 
 		int i = 0, j = 0, k = left;
@@ -986,7 +1288,7 @@ namespace gm
 
 		if (right - left <= QUICK_THREASHOLD)
 		{
-			InsertionSortAscend(vector);
+			InsertionSortAscend(vector.data() + left, right - left + 1);
 			return;
 		}
 
@@ -1025,7 +1327,7 @@ namespace gm
 
 		if (right - left <= QUICK_THREASHOLD)
 		{
-			InsertionSortDescend(vector);
+			InsertionSortDescend(vector.data() + left, right - left + 1);
 			return;
 		}
 
@@ -1064,6 +1366,403 @@ namespace gm
 		if (b - c > 0) std::swap(b, c);
 		return b;
 	}
+
+	/****************************************************************************
+	*							RadixSort
+	*************************************************************************//**
+	*  @fn        void Sort<T>::RadixSort(T* keys, Payload* payloads, size_t arraySize)
+	*  @brief     LSD Radix Sort with 8bit digits. The histograms of all digits are built in one pass,
+	*             the pass whose digit is the same in all keys is skipped and the keys ping-pong between
+	*             the input and one temporary buffer.
+	*  @param[out]T*       keys
+	*  @param[out]Payload* payloads (nullptr when Payload is sort_detail::NoPayload)
+	*  @param[in] size_t   arraySize
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<bool IsDescend, typename Payload> void Sort<T>::RadixSort(T* keys, Payload* payloads, size_t arraySize)
+	{
+		static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Radix sort needs integer or floating point keys.");
+		constexpr bool   HasPayload = !std::is_same_v<Payload, sort_detail::NoPayload>;
+		constexpr size_t PassCount  = sizeof(T);
+		constexpr size_t DigitCount = 256;
+
+		if (arraySize < 2) { return; }
+
+		const auto toKey = [](const T& value)
+		{
+			const auto key = sort_detail::ToRadixKey(value);
+			return IsDescend ? static_cast<decltype(key)>(~key) : key;
+		};
+
+		/*-------------------------------------------------------------------
+		-        Count all digits in one read pass
+		---------------------------------------------------------------------*/
+		std::vector<size_t> histogram(PassCount * DigitCount, 0);
+		for (size_t i = 0; i < arraySize; ++i)
+		{
+			const auto key = toKey(keys[i]);
+			for (size_t pass = 0; pass < PassCount; ++pass)
+			{
+				histogram[pass * DigitCount + ((key >> (pass * 8)) & 0xFF)]++;
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        Scatter by each digit (stable)
+		---------------------------------------------------------------------*/
+		std::vector<T>       keyBuffer(arraySize);
+		std::vector<Payload> payloadBuffer(HasPayload ? arraySize : 0);
+		T*       source             = keys;
+		T*       destination        = keyBuffer.data();
+		Payload* sourcePayload      = payloads;
+		Payload* destinationPayload = payloadBuffer.data();
+
+		for (size_t pass = 0; pass < PassCount; ++pass)
+		{
+			size_t* offset = &histogram[pass * DigitCount];
+			const size_t shift = pass * 8;
+			if (offset[(toKey(source[0]) >> shift) & 0xFF] == arraySize) { continue; }
+
+			size_t sum = 0;
+			for (size_t digit = 0; digit < DigitCount; ++digit)
+			{
+				const size_t count = offset[digit];
+				offset[digit] = sum;
+				sum += count;
+			}
+
+			for (size_t i = 0; i < arraySize; ++i)
+			{
+				const size_t index = offset[(toKey(source[i]) >> shift) & 0xFF]++;
+				destination[index] = std::move(source[i]);
+				if constexpr (HasPayload) { destinationPayload[index] = std::move(sourcePayload[i]); }
+			}
+			std::swap(source, destination);
+			std::swap(sourcePayload, destinationPayload);
+		}
+
+		if (source != keys)
+		{
+			std::move(source, source + arraySize, keys);
+			if constexpr (HasPayload) { std::move(sourcePayload, sourcePayload + arraySize, payloads); }
+		}
+	}
+
+	/****************************************************************************
+	*							IntroSortLoop
+	*************************************************************************//**
+	*  @fn        void Sort<T>::IntroSortLoop(T* begin, T* end, Compare& compare, int badAllowed, bool isLeftmost)
+	*  @brief     Pattern defeating quick sort main loop (recursion on the smaller side only)
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @param[in] int      badAllowed (the number of the unbalanced partitions before heap sort)
+	*  @param[in] bool     isLeftmost (false: *(begin - 1) is not greater than all elements (sentinel))
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::IntroSortLoop(T* begin, T* end, Compare& compare, int badAllowed, bool isLeftmost)
+	{
+		constexpr std::ptrdiff_t InsertionSortThreshold = 24;
+		constexpr std::ptrdiff_t NintherThreshold       = 128;
+
+		while (true)
+		{
+			const std::ptrdiff_t size = end - begin;
+
+			/*-------------------------------------------------------------------
+			-        Small range: insertion sort
+			---------------------------------------------------------------------*/
+			if (size < InsertionSortThreshold)
+			{
+				if (isLeftmost) { InsertionSortRange(begin, end, compare); }
+				else            { UnguardedInsertionSortRange(begin, end, compare); }
+				return;
+			}
+
+			/*-------------------------------------------------------------------
+			-        Choose pivot (median of 3 or ninther) and move it to *begin
+			---------------------------------------------------------------------*/
+			const std::ptrdiff_t half = size / 2;
+			if (size > NintherThreshold)
+			{
+				Sort3(begin, begin + half, end - 1, compare);
+				Sort3(begin + 1, begin + (half - 1), end - 2, compare);
+				Sort3(begin + 2, begin + (half + 1), end - 3, compare);
+				Sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+				std::iter_swap(begin, begin + half);
+			}
+			else
+			{
+				Sort3(begin + half, begin, end - 1, compare);
+			}
+
+			/*-------------------------------------------------------------------
+			-        Many equal elements: the pivot equals the left sentinel
+			---------------------------------------------------------------------*/
+			if (!isLeftmost && !compare(*(begin - 1), *begin))
+			{
+				begin = PartitionLeft(begin, end, compare) + 1;
+				continue;
+			}
+
+			bool isAlreadyPartitioned = false;
+			T* pivot = PartitionRight(begin, end, compare, isAlreadyPartitioned);
+
+			const std::ptrdiff_t leftSize  = pivot - begin;
+			const std::ptrdiff_t rightSize = end - (pivot + 1);
+			const bool isHighlyUnbalanced  = leftSize < size / 8 || rightSize < size / 8;
+
+			if (isHighlyUnbalanced)
+			{
+				/*-------------------------------------------------------------------
+				-        Too many bad partitions: heap sort (O(nlogn) guarantee)
+				---------------------------------------------------------------------*/
+				if (--badAllowed == 0)
+				{
+					std::make_heap(begin, end, compare);
+					std::sort_heap(begin, end, compare);
+					return;
+				}
+
+				/*-------------------------------------------------------------------
+				-        Break the pattern by swapping a few elements
+				---------------------------------------------------------------------*/
+				if (leftSize >= InsertionSortThreshold)
+				{
+					std::iter_swap(begin, begin + leftSize / 4);
+					std::iter_swap(pivot - 1, pivot - leftSize / 4);
+					if (leftSize > NintherThreshold)
+					{
+						std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+						std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+						std::iter_swap(pivot - 2, pivot - (leftSize / 4 + 1));
+						std::iter_swap(pivot - 3, pivot - (leftSize / 4 + 2));
+					}
+				}
+				if (rightSize >= InsertionSortThreshold)
+				{
+					std::iter_swap(pivot + 1, pivot + (1 + rightSize / 4));
+					std::iter_swap(end - 1, end - rightSize / 4);
+					if (rightSize > NintherThreshold)
+					{
+						std::iter_swap(pivot + 2, pivot + (2 + rightSize / 4));
+						std::iter_swap(pivot + 3, pivot + (3 + rightSize / 4));
+						std::iter_swap(end - 2, end - (1 + rightSize / 4));
+						std::iter_swap(end - 3, end - (2 + rightSize / 4));
+					}
+				}
+			}
+			else if (isAlreadyPartitioned
+				&& PartialInsertionSortRange(begin, pivot, compare)
+				&& PartialInsertionSortRange(pivot + 1, end, compare))
+			{
+				/*-------------------------------------------------------------------
+				-        Already sorted (ex. the same order as the previous frame)
+				---------------------------------------------------------------------*/
+				return;
+			}
+
+			/*-------------------------------------------------------------------
+			-        Recurse on the smaller side, loop on the larger side
+			---------------------------------------------------------------------*/
+			if (leftSize < rightSize)
+			{
+				IntroSortLoop(begin, pivot, compare, badAllowed, isLeftmost);
+				begin      = pivot + 1;
+				isLeftmost = false;
+			}
+			else
+			{
+				IntroSortLoop(pivot + 1, end, compare, badAllowed, false);
+				end = pivot;
+			}
+		}
+	}
+
+	/****************************************************************************
+	*							PartitionRight
+	*************************************************************************//**
+	*  @fn        T* Sort<T>::PartitionRight(T* begin, T* end, Compare& compare, bool& isAlreadyPartitioned)
+	*  @brief     Partition around *begin. The elements equal to the pivot go to the right side.
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @param[out]bool&    isAlreadyPartitioned (no element was swapped)
+	*  @return    T* pivot position
+	*****************************************************************************/
+	template<typename T> template<typename Compare> T* Sort<T>::PartitionRight(T* begin, T* end, Compare& compare, bool& isAlreadyPartitioned)
+	{
+		T pivot(std::move(*begin));
+		T* first = begin;
+		T* last  = end;
+
+		/*-------------------------------------------------------------------
+		-        The median of 3 guarantees an element >= pivot on the right
+		---------------------------------------------------------------------*/
+		while (compare(*++first, pivot));
+
+		if (first - 1 == begin) { while (first < last && !compare(*--last, pivot)); }
+		else                    { while (!compare(*--last, pivot)); }
+
+		isAlreadyPartitioned = first >= last;
+
+		while (first < last)
+		{
+			std::iter_swap(first, last);
+			while (compare(*++first, pivot));
+			while (!compare(*--last, pivot));
+		}
+
+		T* pivotPosition = first - 1;
+		*begin         = std::move(*pivotPosition);
+		*pivotPosition = std::move(pivot);
+		return pivotPosition;
+	}
+
+	/****************************************************************************
+	*							PartitionLeft
+	*************************************************************************//**
+	*  @fn        T* Sort<T>::PartitionLeft(T* begin, T* end, Compare& compare)
+	*  @brief     Partition around *begin. The elements equal to the pivot go to the left side.
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @return    T* pivot position
+	*****************************************************************************/
+	template<typename T> template<typename Compare> T* Sort<T>::PartitionLeft(T* begin, T* end, Compare& compare)
+	{
+		T pivot(std::move(*begin));
+		T* first = begin;
+		T* last  = end;
+
+		while (compare(pivot, *--last));
+
+		if (last + 1 == end) { while (first < last && !compare(pivot, *++first)); }
+		else                 { while (!compare(pivot, *++first)); }
+
+		while (first < last)
+		{
+			std::iter_swap(first, last);
+			while (compare(pivot, *--last));
+			while (!compare(pivot, *++first));
+		}
+
+		T* pivotPosition = last;
+		*begin         = std::move(*pivotPosition);
+		*pivotPosition = std::move(pivot);
+		return pivotPosition;
+	}
+
+	/****************************************************************************
+	*							InsertionSortRange
+	*************************************************************************//**
+	*  @fn        void Sort<T>::InsertionSortRange(T* begin, T* end, Compare& compare)
+	*  @brief     Insertion sort [begin, end)
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::InsertionSortRange(T* begin, T* end, Compare& compare)
+	{
+		if (begin == end) { return; }
+
+		for (T* current = begin + 1; current != end; ++current)
+		{
+			if (!compare(*current, *(current - 1))) { continue; }
+
+			T temp(std::move(*current));
+			T* hole = current;
+			do
+			{
+				*hole = std::move(*(hole - 1));
+				--hole;
+			} while (hole != begin && compare(temp, *(hole - 1)));
+			*hole = std::move(temp);
+		}
+	}
+
+	/****************************************************************************
+	*							UnguardedInsertionSortRange
+	*************************************************************************//**
+	*  @fn        void Sort<T>::UnguardedInsertionSortRange(T* begin, T* end, Compare& compare)
+	*  @brief     Insertion sort [begin, end) without the bounds check. (*(begin - 1) must be the sentinel)
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::UnguardedInsertionSortRange(T* begin, T* end, Compare& compare)
+	{
+		if (begin == end) { return; }
+
+		for (T* current = begin + 1; current != end; ++current)
+		{
+			if (!compare(*current, *(current - 1))) { continue; }
+
+			T temp(std::move(*current));
+			T* hole = current;
+			do
+			{
+				*hole = std::move(*(hole - 1));
+				--hole;
+			} while (compare(temp, *(hole - 1)));
+			*hole = std::move(temp);
+		}
+	}
+
+	/****************************************************************************
+	*							PartialInsertionSortRange
+	*************************************************************************//**
+	*  @fn        bool Sort<T>::PartialInsertionSortRange(T* begin, T* end, Compare& compare)
+	*  @brief     Insertion sort which gives up after a few moves
+	*  @param[out]T*       begin
+	*  @param[out]T*       end
+	*  @param[in] Compare& compare
+	*  @return    bool (true: the range was sorted)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> bool Sort<T>::PartialInsertionSortRange(T* begin, T* end, Compare& compare)
+	{
+		constexpr std::ptrdiff_t MoveLimit = 8;
+		if (begin == end) { return true; }
+
+		std::ptrdiff_t moveCount = 0;
+		for (T* current = begin + 1; current != end; ++current)
+		{
+			if (!compare(*current, *(current - 1))) { continue; }
+
+			T temp(std::move(*current));
+			T* hole = current;
+			do
+			{
+				*hole = std::move(*(hole - 1));
+				--hole;
+			} while (hole != begin && compare(temp, *(hole - 1)));
+			*hole = std::move(temp);
+
+			moveCount += current - hole;
+			if (moveCount > MoveLimit) { return current + 1 == end; }
+		}
+		return true;
+	}
+
+	/****************************************************************************
+	*							Sort3
+	*************************************************************************//**
+	*  @fn        void Sort<T>::Sort3(T* a, T* b, T* c, Compare& compare)
+	*  @brief     Sort the three elements (the median is moved to b)
+	*  @param[out]T* a
+	*  @param[out]T* b
+	*  @param[out]T* c
+	*  @param[in] Compare& compare
+	*  @return    void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::Sort3(T* a, T* b, T* c, Compare& compare)
+	{
+		if (compare(*b, *a)) { std::iter_swap(a, b); }
+		if (compare(*c, *b)) { std::iter_swap(b, c); }
+		if (compare(*b, *a)) { std::iter_swap(a, b); }
+	}
 #pragma endregion Private Function
 }
 
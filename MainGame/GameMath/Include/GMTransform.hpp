@@ -25,6 +25,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMMatrix.hpp"
 #include <vector>
+#include <cstdint>
 
 #pragma warning(disable: 26812 26495)
 
@@ -44,7 +45,22 @@ namespace gm
 	struct ScaleAndTranslation;
 	struct UniformScaleTransform;
 	struct Transform;
-
+	class  TransformHierarchy;
+
+	/****************************************************************************
+	*				  			Transform
+	*************************************************************************//**
+	*  @class     Transform
+	*  @brief     Local scale / rotation / position with a parent.
+	*             The local and world matrices are cached. The local matrix is rebuilt only when
+	*             LocalPosition / LocalRotation / LocalScale were changed (compared with the cached values,
+	*             so writing the public members directly is still fine), and each world matrix keeps
+	*             the version of the parent world matrix it was built from, so a change of a parent
+	*             reaches all of its children without visiting them.
+	*             GetMatrix() walks up to the root only to validate the caches (no matrix multiply for
+	*             the nodes which did not change). Use TransformHierarchy to update a whole scene.
+	*             The caches are not thread safe: do not call GetMatrix of one node from several threads.
+	*****************************************************************************/
 	struct Transform
 	{
 	public:
@@ -61,30 +77,38 @@ namespace gm
 
 		INLINE void SetParent(Transform* parent)
 		{
-			if (_parent != nullptr) { RemoveChild(this); }
+			if (_parent == parent) { return; }
+			if (_parent != nullptr) { _parent->RemoveChild(this); }
 			if (parent  != nullptr) { parent->SetChild(this); }
-			_parent = parent;
+			_parent       = parent;
+			_isWorldDirty = true;
 		}
+		INLINE Transform* GetParent() const { return _parent; }
 
+		/* world matrix (scale * rotation * translation * parent world) */
 		INLINE Matrix4 GetMatrix() const
 		{
-			Matrix4 model;
-			if (_parent != nullptr) { model = _parent->GetMatrix(); }
-			else { model = Matrix4(EIdentityTag::kIdentity); }
+			UpdateWorldMatrix();
+			return _worldMatrix;
+		}
 
-			return Scaling(LocalScale) * RotationQuaternion(LocalRotation) * Translation(LocalPosition) * model;
+		INLINE Float4x4 GetFloat4x4() const
+		{
+			return GetMatrix().ToFloat4x4();
 		}
 
-		INLINE Float4x4 GetFloat4x4()
+		/* scale * rotation * translation */
+		INLINE const Matrix4& GetLocalMatrix() const
 		{
-			Matrix4 model;
-			if (_parent != nullptr) { model = _parent->GetMatrix(); }
-			else { model = Matrix4(EIdentityTag::kIdentity); }
-			return (Scaling(LocalScale) * RotationQuaternion(LocalRotation) * Translation(LocalPosition) * model).ToFloat4x4();
+			UpdateLocalMatrix();
+			return _localMatrix;
 		}
 
+		/* force rebuilding the matrices (ex. after the parent was replaced without SetParent) */
+		INLINE void MarkDirty() { _isLocalDirty = true; _isWorldDirty = true; }
+
 		INLINE int  GetChildCount()           const { return static_cast<int>(_child.size()); }
-		INLINE Transform* GetChild(int index) const { return (_child.size() <= index) ? nullptr : _child[index]; }
+		INLINE Transform* GetChild(int index) const { return (index < 0 || GetChildCount() <= index) ? nullptr : _child[index]; }
 		INLINE void SetChild(Transform* child) { _child.push_back(child); };
 		INLINE bool RemoveChild(Transform* child)
 		{
@@ -105,21 +129,143 @@ namespace gm
 		INLINE Transform(Quaternion rotate) : LocalPosition(kZero)   , LocalRotation(rotate)   , LocalScale(kIdentity) {}
 		INLINE Transform(Vector3 position)  : LocalPosition(position), LocalRotation(kIdentity), LocalScale(kIdentity) {}
 		INLINE Transform(float x, float y, float z)                          : LocalPosition(x,y,z), LocalRotation(kIdentity), LocalScale(kIdentity) {}
-		INLINE Transform(Quaternion rotate, Vector3 position)                : LocalRotation(rotate), LocalPosition(position), LocalScale(kIdentity) {}
-		INLINE Transform(Vector3 scale, Quaternion rotate, Vector3 position) : LocalRotation(rotate), LocalPosition(position), LocalScale(scale) {}
-		INLINE ~Transform() { SetParent(nullptr); }
+		INLINE Transform(Quaternion rotate, Vector3 position)                : LocalPosition(position), LocalRotation(rotate), LocalScale(kIdentity) {}
+		INLINE Transform(Vector3 scale, Quaternion rotate, Vector3 position) : LocalPosition(position), LocalRotation(rotate), LocalScale(scale) {}
+		INLINE ~Transform()
+		{
+			SetParent(nullptr);
+			for (Transform* child : _child)
+			{
+				if (child->_parent != this) { continue; } // _child of a copied transform
+				child->_parent       = nullptr;
+				child->_isWorldDirty = true;
+			}
+		}
 
 	private:
+		friend class TransformHierarchy;
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
-		
+		/* rebuild the local matrix if the local values were changed. return true when rebuilt */
+		INLINE bool UpdateLocalMatrix() const
+		{
+			if (!_isLocalDirty
+				&& LocalPosition == _cachedPosition
+				&& LocalScale    == _cachedScale
+				&& simd::Vector4Equal(LocalRotation, _cachedRotation)) { return false; }
+
+			_cachedPosition = LocalPosition;
+			_cachedRotation = LocalRotation;
+			_cachedScale    = LocalScale;
+			_localMatrix    = Scaling(LocalScale) * RotationQuaternion(LocalRotation) * Translation(LocalPosition);
+			_isLocalDirty   = false;
+			return true;
+		}
+
+		/* rebuild the world matrix from the parent world matrix which is already up to date */
+		INLINE void UpdateWorldMatrixFromParent() const
+		{
+			const bool          isLocalChanged = UpdateLocalMatrix();
+			const std::uint32_t parentVersion  = _parent != nullptr ? _parent->_worldVersion : 0;
+			if (!isLocalChanged && !_isWorldDirty && parentVersion == _parentVersion) { return; }
+
+			_worldMatrix   = _parent != nullptr ? _localMatrix * _parent->_worldMatrix : _localMatrix;
+			_parentVersion = parentVersion;
+			_isWorldDirty  = false;
+			++_worldVersion;
+		}
+
+		/* validate from the root to this node (recursive, so it can not be force inlined) */
+		inline void UpdateWorldMatrix() const
+		{
+			if (_parent != nullptr) { _parent->UpdateWorldMatrix(); }
+			UpdateWorldMatrixFromParent();
+		}
 
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
 		Transform* _parent = nullptr;
 		std::vector<Transform*> _child;
+
+		mutable Matrix4       _localMatrix;
+		mutable Matrix4       _worldMatrix;
+		mutable Vector3       _cachedPosition;
+		mutable Quaternion    _cachedRotation;
+		mutable Vector3       _cachedScale;
+		mutable std::uint32_t _worldVersion  = 1; // incremented whenever _worldMatrix changes (0: no parent)
+		mutable std::uint32_t _parentVersion = 0; // _worldVersion of the parent used for _worldMatrix
+		mutable bool          _isLocalDirty  = true;
+		mutable bool          _isWorldDirty  = true;
+	};
+
+	/****************************************************************************
+	*				  			TransformHierarchy
+	*************************************************************************//**
+	*  @class     TransformHierarchy
+	*  @brief     Flattened transform tree (parents are always before their children).
+	*             UpdateWorldMatrices visits each node exactly once in this order, so every world
+	*             matrix is built from a parent which is already up to date (no walk up to the root).
+	*             Call Build again after the tree was changed (SetParent, add or remove a transform).
+	*****************************************************************************/
+	class TransformHierarchy
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* collect the roots and all of their descendants (breadth first) */
+		INLINE void Build(Transform* const* roots, size_t rootCount)
+		{
+			_nodes.clear();
+			_parentIndices.clear();
+			for (size_t i = 0; i < rootCount; ++i)
+			{
+				if (roots[i] == nullptr) { continue; }
+				_nodes.push_back(roots[i]);
+				_parentIndices.push_back(-1);
+			}
+
+			for (size_t i = 0; i < _nodes.size(); ++i)
+			{
+				for (Transform* child : _nodes[i]->_child)
+				{
+					_nodes.push_back(child);
+					_parentIndices.push_back(static_cast<int>(i));
+				}
+			}
+		}
+		INLINE void Build(const std::vector<Transform*>& roots) { Build(roots.data(), roots.size()); }
+
+		INLINE void UpdateWorldMatrices() const
+		{
+			for (const Transform* node : _nodes) { node->UpdateWorldMatrixFromParent(); }
+		}
+
+		INLINE void Clear() { _nodes.clear(); _parentIndices.clear(); }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		INLINE size_t Size() const { return _nodes.size(); }
+		INLINE Transform* GetTransform  (size_t index) const { return _nodes[index]; }
+		INLINE int        GetParentIndex(size_t index) const { return _parentIndices[index]; } // -1: root
+		/* valid after UpdateWorldMatrices */
+		INLINE const Matrix4& GetWorldMatrix(size_t index) const { return _nodes[index]->_worldMatrix; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		TransformHierarchy() = default;
+		~TransformHierarchy() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		std::vector<Transform*> _nodes;
+		std::vector<int>        _parentIndices;
 	};
 
 
@@ -146,7 +292,7 @@ namespace gm
 		INLINE Vector3 operator* (Vector3 vector) const { return _rotation * vector + _translation; }
 		INLINE Vector4 operator* (Vector4 vector) const 
 		{ 
-			return Vector4(vector::SetWToZero(_rotation      * Vector3((DirectX::XMVECTOR)vector))) +
+			return Vector4(vector::SetWToZero(_rotation      * Vector3((simd::VectorRegister)vector))) +
 				   Vector4(vector::SetWToOne (_translation)) * vector.GetW();
 		}
 		INLINE OrthogonalTransform operator* (const OrthogonalTransform& xform) const
@@ -169,7 +315,7 @@ namespace gm
 		INLINE OrthogonalTransform(const Matrix3& mat)                     : _rotation(mat)      , _translation(kZero)     {}
 		INLINE OrthogonalTransform(const Matrix3& mat, Vector3 translate)  : _rotation(mat)      , _translation(translate) {}
 		INLINE OrthogonalTransform(EIdentityTag)                           : _rotation(kIdentity), _translation(kZero)     {}
-		INLINE explicit OrthogonalTransform(const DirectX::XMMATRIX& mat) { *this = OrthogonalTransform(Matrix3(mat), Vector3(mat.r[3])); }
+		INLINE explicit OrthogonalTransform(const simd::MatrixRegister& mat) { *this = OrthogonalTransform(Matrix3(mat), Vector3(mat.r[3])); }
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -196,7 +342,7 @@ namespace gm
 		INLINE void SetScale(Scalar s)        { _vector.SetW(s); }
 		INLINE void SetTranslation(Vector3 t) { _vector.SetXYZ(t); }
 		INLINE Scalar  GetScale()       const { return   _vector.GetW(); }
-		INLINE Vector3 GetTranslation() const { (Vector3)_vector; }
+		INLINE Vector3 GetTranslation() const { return (Vector3)_vector; }
 		
 
 		/****************************************************************************
@@ -210,7 +356,7 @@ namespace gm
 			_vector = Vector4(translate);
 			_vector.SetW(scale);
 		}
-		INLINE explicit ScaleAndTranslation(const DirectX::XMVECTOR& v) : _vector(v){}
+		INLINE explicit ScaleAndTranslation(const simd::VectorRegister& v) : _vector(v){}
 
 	private:
 		/****************************************************************************
@@ -308,8 +454,8 @@ namespace gm
 			_translation = xform.GetTranslation();
 		}
 		INLINE AffineTransform(EIdentityTag) : _basis(kIdentity), _translation(kZero){}
-		INLINE explicit AffineTransform(const DirectX::XMMATRIX& mat): _basis(mat), _translation(mat.r[3]){}
-		INLINE operator DirectX::XMMATRIX() const { return (DirectX::XMMATRIX&)*this; }
+		INLINE explicit AffineTransform(const simd::MatrixRegister& mat): _basis(mat), _translation(mat.r[3]){}
+		INLINE operator simd::MatrixRegister() const { return (simd::MatrixRegister&)*this; }
 
 	private:
 		/****************************************************************************
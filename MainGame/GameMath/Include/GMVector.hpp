@@ -50,7 +50,7 @@ namespace gm
 	*  @class     Float2
 	*  @brief     Float2 class for holding the value
 	*****************************************************************************/
-	struct Float2 : public DirectX::XMFLOAT2
+	struct Float2 : public simd::Float2Data
 	{
 	public:
 		/****************************************************************************
@@ -60,26 +60,26 @@ namespace gm
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE bool operator == (const Float2& V) const noexcept { DirectX::XMVector2Equal(*this, V); };
-		INLINE bool operator != (const Float2& V) const noexcept { DirectX::XMVector2NotEqual(*this, V); };
+		INLINE bool operator == (const Float2& V) const noexcept { return simd::Vector2Equal(*this, V); };
+		INLINE bool operator != (const Float2& V) const noexcept { return simd::Vector2NotEqual(*this, V); };
 
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		Float2()                    : XMFLOAT2(0.0f, 0.0f) {};
-		Float2(float ix)            : XMFLOAT2(ix, ix)     {};
-		Float2(float ix, float iy)  : XMFLOAT2(ix, iy)     {};
-		Float2(const XMFLOAT2& V)             { this->x = V.x; this->y = V.y; }
-		//Float2(DirectX::FXMVECTOR v)        { DirectX::XMStoreFloat2(this, v); } // LXgȒPɂȂ肷 Float2 = (Float2)Vector2 + Vector2oĂ܂)
-		Float2(const DirectX::XMVECTORF32& F) { this->x = F.f[0]; this->y = F.f[1]; }
-		explicit Float2(_In_reads_(2) const float* pArray) : XMFLOAT2(pArray) {}
+		Float2()                    : simd::Float2Data(0.0f, 0.0f) {};
+		Float2(float ix)            : simd::Float2Data(ix, ix)     {};
+		Float2(float ix, float iy)  : simd::Float2Data(ix, iy)     {};
+		Float2(const simd::Float2Data& V)             { this->x = V.x; this->y = V.y; }
+		//Float2(simd::VectorRegister v)        { simd::StoreFloat2(this, v); } // LXgȒPɂȂ肷 Float2 = (Float2)Vector2 + Vector2oĂ܂)
+		Float2(const simd::VectorF32& F) { this->x = F.f[0]; this->y = F.f[1]; }
+		explicit Float2(const float* pArray) : simd::Float2Data(pArray) {}
 
 		Float2(const Float2&)            = default;
 		Float2& operator=(const Float2&) = default;
 		Float2(Float2&&)                 = default;
 		Float2& operator=(Float2&&)      = default;
 
-		operator DirectX::XMVECTOR() const noexcept { return XMLoadFloat2(this); }
+		operator simd::VectorRegister() const noexcept { return simd::LoadFloat2(this); }
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -96,7 +96,7 @@ namespace gm
 	*  @class     Float3
 	*  @brief     Float3 class for holding the value
 	*****************************************************************************/
-	struct Float3 : public DirectX::XMFLOAT3
+	struct Float3 : public simd::Float3Data
 	{
 	public:
 		/****************************************************************************
@@ -106,26 +106,26 @@ namespace gm
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE bool operator == (const Float3& V) const noexcept { DirectX::XMVector3Equal(*this, V); };
-		INLINE bool operator != (const Float3& V) const noexcept { DirectX::XMVector3NotEqual(*this, V); };
+		INLINE bool operator == (const Float3& V) const noexcept { return simd::Vector3Equal(*this, V); };
+		INLINE bool operator != (const Float3& V) const noexcept { return simd::Vector3NotEqual(*this, V); };
 
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		Float3()                             : XMFLOAT3(0.0f, 0.0f, 0.0f) {};
-		Float3(float ix)                     : XMFLOAT3(ix, ix, ix) {};
-		Float3(float ix, float iy, float iz) : XMFLOAT3(ix, iy, iz) {};
-		Float3(const XMFLOAT3& V)             { this->x = V.x; this->y = V.y; this->z = V.z; }
-		//Float3(DirectX::FXMVECTOR v)        { DirectX::XMStoreFloat3(this, v); } // LXgȒPɂȂ肷 Float3 = (Float3)Vector3 + Vector3oĂ܂)
-		Float3(const DirectX::XMVECTORF32& F) { this->x = F.f[0]; this->y = F.f[1]; this->z = F.f[2];}
-		explicit Float3(_In_reads_(3) const float* pArray) : XMFLOAT3(pArray) {}
+		Float3()                             : simd::Float3Data(0.0f, 0.0f, 0.0f) {};
+		Float3(float ix)                     : simd::Float3Data(ix, ix, ix) {};
+		Float3(float ix, float iy, float iz) : simd::Float3Data(ix, iy, iz) {};
+		Float3(const simd::Float3Data& V)             { this->x = V.x; this->y = V.y; this->z = V.z; }
+		//Float3(simd::VectorRegister v)        { simd::StoreFloat3(this, v); } // LXgȒPɂȂ肷 Float3 = (Float3)Vector3 + Vector3oĂ܂)
+		Float3(const simd::VectorF32& F) { this->x = F.f[0]; this->y = F.f[1]; this->z = F.f[2];}
+		explicit Float3(const float* pArray) : simd::Float3Data(pArray) {}
 
 		Float3(const Float3&)            = default;
 		Float3& operator=(const Float3&) = default;
 		Float3(Float3&&)                 = default;
 		Float3& operator=(Float3&&)      = default;
 
-		operator DirectX::XMVECTOR() const noexcept { return XMLoadFloat3(this); }
+		operator simd::VectorRegister() const noexcept { return simd::LoadFloat3(this); }
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -142,7 +142,7 @@ namespace gm
 	*  @class     Float4
 	*  @brief     Float4 class for holding the value
 	*****************************************************************************/
-	struct Float4 : public DirectX::XMFLOAT4
+	struct Float4 : public simd::Float4Data
 	{
 	public:
 		/****************************************************************************
@@ -152,26 +152,26 @@ namespace gm
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE bool operator == (const Float4& V) const noexcept { DirectX::XMVector4Equal(*this, V); };
-		INLINE bool operator != (const Float4& V) const noexcept { DirectX::XMVector4NotEqual(*this, V); };
+		INLINE bool operator == (const Float4& V) const noexcept { return simd::Vector4Equal(*this, V); };
+		INLINE bool operator != (const Float4& V) const noexcept { return simd::Vector4NotEqual(*this, V); };
 
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
-		Float4()                                       : XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f) {};
-		Float4(float ix)                               : XMFLOAT4(ix, ix, ix, ix) {};
-		Float4(float ix, float iy, float iz, float iw) : XMFLOAT4(ix, iy, iz, iw) {};
-		Float4(const XMFLOAT4& V)             { this->x = V.x; this->y = V.y; this->z = V.z; this->w = V.w;}
-		//Float4(DirectX::FXMVECTOR v)        { DirectX::XMStoreFloat4(this, v); } // LXgȒPɂȂ肷 Float2 = (Float2)Vector2 + Vector2oĂ܂)
-		Float4(const DirectX::XMVECTORF32& F) { this->x = F.f[0]; this->y = F.f[1]; this->z = F.f[2]; this->w = F.f[3];}
-		explicit Float4(_In_reads_(4) const float* pArray) : XMFLOAT4(pArray) {}
+		Float4()                                       : simd::Float4Data(0.0f, 0.0f, 0.0f, 0.0f) {};
+		Float4(float ix)                               : simd::Float4Data(ix, ix, ix, ix) {};
+		Float4(float ix, float iy, float iz, float iw) : simd::Float4Data(ix, iy, iz, iw) {};
+		Float4(const simd::Float4Data& V)             { this->x = V.x; this->y = V.y; this->z = V.z; this->w = V.w;}
+		//Float4(simd::VectorRegister v)        { simd::StoreFloat4(this, v); } // LXgȒPɂȂ肷 Float2 = (Float2)Vector2 + Vector2oĂ܂)
+		Float4(const simd::VectorF32& F) { this->x = F.f[0]; this->y = F.f[1]; this->z = F.f[2]; this->w = F.f[3];}
+		explicit Float4(const float* pArray) : simd::Float4Data(pArray) {}
 
 		Float4(const Float4&)            = default;
 		Float4& operator=(const Float4&) = default;
 		Float4(Float4&&)                 = default;
 		Float4& operator=(Float4&&)      = default;
 
-		operator DirectX::XMVECTOR() const noexcept { return XMLoadFloat4(this); }
+		operator simd::VectorRegister() const noexcept { return simd::LoadFloat4(this); }
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -195,11 +195,11 @@ namespace gm
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		INLINE Vector2 operator- ()           const { return Vector2(DirectX::XMVectorNegate(_vector)); }
-		INLINE Vector2 operator+ (Vector2 v2) const { return Vector2(DirectX::XMVectorAdd(_vector, v2)); }
-		INLINE Vector2 operator- (Vector2 v2) const { return Vector2(DirectX::XMVectorSubtract(_vector, v2)); }
-		INLINE Vector2 operator* (Vector2 v2) const { return Vector2(DirectX::XMVectorMultiply(_vector, v2)); }
-		INLINE Vector2 operator/ (Vector2 v2) const { return Vector2(DirectX::XMVectorDivide(_vector, v2)); }
+		INLINE Vector2 operator- ()           const { return Vector2(simd::VectorNegate(_vector)); }
+		INLINE Vector2 operator+ (Vector2 v2) const { return Vector2(simd::VectorAdd(_vector, v2)); }
+		INLINE Vector2 operator- (Vector2 v2) const { return Vector2(simd::VectorSubtract(_vector, v2)); }
+		INLINE Vector2 operator* (Vector2 v2) const { return Vector2(simd::VectorMultiply(_vector, v2)); }
+		INLINE Vector2 operator/ (Vector2 v2) const { return Vector2(simd::VectorDivide(_vector, v2)); }
 		INLINE Vector2 operator* (Scalar  v2) const { return *this * Vector2(v2); }
 		INLINE Vector2 operator/ (Scalar  v2) const { return *this / Vector2(v2); }
 		INLINE Vector2 operator* (float   v2) const { return *this * Scalar(v2); }
@@ -218,14 +218,14 @@ namespace gm
 		INLINE friend Vector2 operator* (float   v1, Vector2 v2) { return Scalar(v1) * v2; }
 		INLINE friend Vector2 operator/ (float   v1, Vector2 v2) { return Scalar(v1) / v2; }
 
-		INLINE bool operator == (const Vector2& V) const noexcept { DirectX::XMVector2Equal(*this, V); };
-		INLINE bool operator != (const Vector2& V) const noexcept { DirectX::XMVector2NotEqual(*this, V); };
+		INLINE bool operator == (const Vector2& V) const noexcept { return simd::Vector2Equal(*this, V); };
+		INLINE bool operator != (const Vector2& V) const noexcept { return simd::Vector2NotEqual(*this, V); };
 
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE Scalar GetX() const { return Scalar(DirectX::XMVectorSplatX(_vector)); }
-		INLINE Scalar GetY() const { return Scalar(DirectX::XMVectorSplatY(_vector)); }
+		INLINE Scalar GetX() const { return Scalar(simd::VectorSplatX(_vector)); }
+		INLINE Scalar GetY() const { return Scalar(simd::VectorSplatY(_vector)); }
 		INLINE Scalar GetElement(Vector2Element element)
 		{
 			switch (element)
@@ -235,11 +235,11 @@ namespace gm
 			}
 		};
 
-		INLINE void SetX(Scalar x) { _vector = DirectX::XMVectorPermute<4, 1, 2, 3>(_vector, x); }
-		INLINE void SetY(Scalar y) { _vector = DirectX::XMVectorPermute<0, 5, 2, 3>(_vector, y); }
+		INLINE void SetX(Scalar x) { _vector = simd::VectorPermute<4, 1, 2, 3>(_vector, x); }
+		INLINE void SetY(Scalar y) { _vector = simd::VectorPermute<0, 5, 2, 3>(_vector, y); }
 		INLINE Float2 ToFloat2() { 
 			Float2 value;
-			DirectX::XMStoreFloat2(&value, _vector);
+			simd::StoreFloat2(&value, _vector);
 			return value;
 		}
 		INLINE void SetElement(Vector2Element element, Scalar scalar)
@@ -263,17 +263,17 @@ namespace gm
 		**                Constructor and Destructor
 		*****************************************************************************/
 		INLINE Vector2() {}
-		INLINE Vector2(float x, float y)                { _vector = DirectX::XMVectorSet(x, y, 0, 0); }
-		INLINE Vector2(const DirectX::XMFLOAT2& v)      { _vector = XMLoadFloat2(&v); }
-		INLINE Vector2(const Float2& v)                 { _vector = XMLoadFloat2(&v); }
+		INLINE Vector2(float x, float y)                { _vector = simd::VectorSet(x, y, 0, 0); }
+		INLINE Vector2(const simd::Float2Data& v)      { _vector = simd::LoadFloat2(&v); }
+		INLINE Vector2(const Float2& v)                 { _vector = simd::LoadFloat2(&v); }
 		INLINE Vector2(const Vector2& v)                { _vector = v; }
 		INLINE Vector2(const Scalar& s)                 { _vector = s; }
-		INLINE explicit Vector2(DirectX::FXMVECTOR vec) { _vector = vec; }
+		INLINE explicit Vector2(simd::VectorRegister vec) { _vector = vec; }
 		INLINE explicit Vector2(EZeroTag)               { _vector = vector::SplatZero(); }
 		INLINE explicit Vector2(EIdentityTag)           { _vector = vector::SplatOne(); }
 		INLINE explicit Vector2(EXUnitVector)           { _vector = vector::CreateXUnitVector(); }
 		INLINE explicit Vector2(EYUnitVector)           { _vector = vector::CreateYUnitVector(); }
-		INLINE operator DirectX::XMVECTOR() const { return _vector; }
+		INLINE operator simd::VectorRegister() const { return _vector; }
 
 	protected:
 		/****************************************************************************
@@ -283,7 +283,7 @@ namespace gm
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
-		DirectX::XMVECTOR _vector;
+		simd::VectorRegister _vector;
 	};
 
 
@@ -303,10 +303,10 @@ namespace gm
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE operator DirectX::XMVECTOR() const { return _vector; }
-		INLINE Scalar GetX() const { return Scalar(DirectX::XMVectorSplatX(_vector)); }
-		INLINE Scalar GetY() const { return Scalar(DirectX::XMVectorSplatY(_vector)); }
-		INLINE Scalar GetZ() const { return Scalar(DirectX::XMVectorSplatZ(_vector)); }
+		INLINE operator simd::VectorRegister() const { return _vector; }
+		INLINE Scalar GetX() const { return Scalar(simd::VectorSplatX(_vector)); }
+		INLINE Scalar GetY() const { return Scalar(simd::VectorSplatY(_vector)); }
+		INLINE Scalar GetZ() const { return Scalar(simd::VectorSplatZ(_vector)); }
 		INLINE Scalar GetElement(Vector3Element element) const 
 		{
 			switch (element)
@@ -343,21 +343,21 @@ namespace gm
 			default: { SetZ(scalar); return; }
 			}
 		}
-		INLINE void SetX(Scalar x) { _vector = DirectX::XMVectorPermute<4, 1, 2, 3>(_vector, x); }
-		INLINE void SetY(Scalar y) { _vector = DirectX::XMVectorPermute<0, 5, 2, 3>(_vector, y); }
-		INLINE void SetZ(Scalar z) { _vector = DirectX::XMVectorPermute<0, 1, 6, 3>(_vector, z); }
+		INLINE void SetX(Scalar x) { _vector = simd::VectorPermute<4, 1, 2, 3>(_vector, x); }
+		INLINE void SetY(Scalar y) { _vector = simd::VectorPermute<0, 5, 2, 3>(_vector, y); }
+		INLINE void SetZ(Scalar z) { _vector = simd::VectorPermute<0, 1, 6, 3>(_vector, z); }
 		INLINE Float3 ToFloat3()
 		{
 			Float3 value;
-			DirectX::XMStoreFloat3(&value, _vector);
+			simd::StoreFloat3(&value, _vector);
 			return value;
 		}
 
-		INLINE Vector3 operator- () const { return Vector3(DirectX::XMVectorNegate(_vector)); }
-		INLINE Vector3 operator+ (Vector3 v2) const { return Vector3(DirectX::XMVectorAdd(_vector, v2)); }
-		INLINE Vector3 operator- (Vector3 v2) const { return Vector3(DirectX::XMVectorSubtract(_vector, v2)); }
-		INLINE Vector3 operator* (Vector3 v2) const { return Vector3(DirectX::XMVectorMultiply(_vector, v2)); }
-		INLINE Vector3 operator/ (Vector3 v2) const { return Vector3(DirectX::XMVectorDivide(_vector, v2)); }
+		INLINE Vector3 operator- () const { return Vector3(simd::VectorNegate(_vector)); }
+		INLINE Vector3 operator+ (Vector3 v2) const { return Vector3(simd::VectorAdd(_vector, v2)); }
+		INLINE Vector3 operator- (Vector3 v2) const { return Vector3(simd::VectorSubtract(_vector, v2)); }
+		INLINE Vector3 operator* (Vector3 v2) const { return Vector3(simd::VectorMultiply(_vector, v2)); }
+		INLINE Vector3 operator/ (Vector3 v2) const { return Vector3(simd::VectorDivide(_vector, v2)); }
 		INLINE Vector3 operator* (Scalar  v2) const { return *this * Vector3(v2); }
 		INLINE Vector3 operator/ (Scalar  v2) const { return *this / Vector3(v2); }
 		INLINE Vector3 operator* (float   v2) const { return *this * Scalar(v2); }
@@ -373,20 +373,20 @@ namespace gm
 		INLINE friend Vector3 operator* (float   v1, Vector3 v2) { return Scalar(v1) * v2; }
 		INLINE friend Vector3 operator/ (float   v1, Vector3 v2) { return Scalar(v1) / v2; }
 
-		INLINE bool operator == (const Vector3& V) const noexcept { return DirectX::XMVector3Equal(*this, V); };
-		INLINE bool operator != (const Vector3& V) const noexcept { return DirectX::XMVector3NotEqual(*this, V); };
+		INLINE bool operator == (const Vector3& V) const noexcept { return simd::Vector3Equal(*this, V); };
+		INLINE bool operator != (const Vector3& V) const noexcept { return simd::Vector3NotEqual(*this, V); };
 
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		INLINE Vector3()                           { _vector = vector::SplatZero(); }
-		INLINE Vector3(float x, float y, float z)  { _vector = DirectX::XMVectorSet(x, y, z, 0); }
-		INLINE Vector3(const DirectX::XMFLOAT3& v) { _vector = DirectX::XMLoadFloat3(&v); }
-		INLINE Vector3(const Float3& v)            { _vector = XMLoadFloat3(&v); }
+		INLINE Vector3(float x, float y, float z)  { _vector = simd::VectorSet(x, y, z, 0); }
+		INLINE Vector3(const simd::Float3Data& v) { _vector = simd::LoadFloat3(&v); }
+		INLINE Vector3(const Float3& v)            { _vector = simd::LoadFloat3(&v); }
 		INLINE Vector3(const Vector3& vector)      { _vector = vector; }
 		INLINE Vector3(Scalar scalar)              { _vector = scalar; }
 		INLINE explicit Vector3(Vector4 vec);
-		INLINE explicit Vector3(DirectX::FXMVECTOR vector) { _vector = vector; }
+		INLINE explicit Vector3(simd::VectorRegister vector) { _vector = vector; }
 		INLINE explicit Vector3(EZeroTag)     { _vector = vector::SplatZero(); }
 		INLINE explicit Vector3(EIdentityTag) { _vector = vector::SplatOne(); }
 		INLINE explicit Vector3(EXUnitVector) { _vector = vector::CreateXUnitVector(); }
@@ -403,7 +403,7 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		DirectX::XMVECTOR _vector;
+		simd::VectorRegister _vector;
 	};
 
 
@@ -419,11 +419,11 @@ namespace gm
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		INLINE Vector4 operator- ()           const { return Vector4(DirectX::XMVectorNegate  (_vector)); }
-		INLINE Vector4 operator+ (Vector4 v2) const { return Vector4(DirectX::XMVectorAdd     (_vector, v2)); }
-		INLINE Vector4 operator- (Vector4 v2) const { return Vector4(DirectX::XMVectorSubtract(_vector, v2)); }
-		INLINE Vector4 operator* (Vector4 v2) const { return Vector4(DirectX::XMVectorMultiply(_vector, v2)); }
-		INLINE Vector4 operator/ (Vector4 v2) const { return Vector4(DirectX::XMVectorDivide  (_vector, v2)); }
+		INLINE Vector4 operator- ()           const { return Vector4(simd::VectorNegate  (_vector)); }
+		INLINE Vector4 operator+ (Vector4 v2) const { return Vector4(simd::VectorAdd     (_vector, v2)); }
+		INLINE Vector4 operator- (Vector4 v2) const { return Vector4(simd::VectorSubtract(_vector, v2)); }
+		INLINE Vector4 operator* (Vector4 v2) const { return Vector4(simd::VectorMultiply(_vector, v2)); }
+		INLINE Vector4 operator/ (Vector4 v2) const { return Vector4(simd::VectorDivide  (_vector, v2)); }
 		INLINE Vector4 operator* (Scalar  v2) const { return *this * Vector4(v2); }
 		INLINE Vector4 operator/ (Scalar  v2) const { return *this / Vector4(v2); }
 		INLINE Vector4 operator* (float   v2) const { return *this * Scalar(v2); }
@@ -437,15 +437,15 @@ namespace gm
 		INLINE friend Vector4 operator* (float   v1, Vector4 v2) { return Scalar(v1) * v2; }
 		INLINE friend Vector4 operator/ (float   v1, Vector4 v2) { return Scalar(v1) / v2; }
 
-		INLINE bool operator == (const Vector4& V) const noexcept { DirectX::XMVector4Equal(*this, V); };
-		INLINE bool operator != (const Vector4& V) const noexcept { DirectX::XMVector4NotEqual(*this, V); };
+		INLINE bool operator == (const Vector4& V) const noexcept { return simd::Vector4Equal(*this, V); };
+		INLINE bool operator != (const Vector4& V) const noexcept { return simd::Vector4NotEqual(*this, V); };
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		INLINE Scalar GetX() const { return Scalar(DirectX::XMVectorSplatX(_vector)); }
-		INLINE Scalar GetY() const { return Scalar(DirectX::XMVectorSplatY(_vector)); }
-		INLINE Scalar GetZ() const { return Scalar(DirectX::XMVectorSplatZ(_vector)); }
-		INLINE Scalar GetW() const { return Scalar(DirectX::XMVectorSplatW(_vector)); }
+		INLINE Scalar GetX() const { return Scalar(simd::VectorSplatX(_vector)); }
+		INLINE Scalar GetY() const { return Scalar(simd::VectorSplatY(_vector)); }
+		INLINE Scalar GetZ() const { return Scalar(simd::VectorSplatZ(_vector)); }
+		INLINE Scalar GetW() const { return Scalar(simd::VectorSplatW(_vector)); }
 		INLINE Vector3 GetXYZ() const { return Vector3(GetX(), GetY(), GetZ()); }
 		INLINE Scalar GetElement(Vector4Element element)
 		{
@@ -458,16 +458,16 @@ namespace gm
 			}
 		};
 		
-		INLINE void SetX(Scalar x) { _vector = DirectX::XMVectorPermute<4, 1, 2, 3>(_vector, x); }
-		INLINE void SetY(Scalar y) { _vector = DirectX::XMVectorPermute<0, 5, 2, 3>(_vector, y); }
-		INLINE void SetZ(Scalar z) { _vector = DirectX::XMVectorPermute<0, 1, 6, 3>(_vector, z); }
-		INLINE void SetW(Scalar w) { _vector = DirectX::XMVectorPermute<0, 1, 2, 7>(_vector, w); }
-		INLINE void SetXYZ(Vector3 xyz) { _vector = DirectX::XMVectorPermute<0, 1, 2, 7>(xyz, _vector); }
-		INLINE DirectX::XMVECTOR* VectorPtr() { return &_vector; }
+		INLINE void SetX(Scalar x) { _vector = simd::VectorPermute<4, 1, 2, 3>(_vector, x); }
+		INLINE void SetY(Scalar y) { _vector = simd::VectorPermute<0, 5, 2, 3>(_vector, y); }
+		INLINE void SetZ(Scalar z) { _vector = simd::VectorPermute<0, 1, 6, 3>(_vector, z); }
+		INLINE void SetW(Scalar w) { _vector = simd::VectorPermute<0, 1, 2, 7>(_vector, w); }
+		INLINE void SetXYZ(Vector3 xyz) { _vector = simd::VectorPermute<0, 1, 2, 7>(xyz, _vector); }
+		INLINE simd::VectorRegister* VectorPtr() { return &_vector; }
 		INLINE Float4 ToFloat4()
 		{
 			Float4 value;
-			DirectX::XMStoreFloat4(&value, _vector);
+			simd::StoreFloat4(&value, _vector);
 			return value;
 		}
 		INLINE void SetElement(Vector4Element element, Scalar scalar)
@@ -494,21 +494,21 @@ namespace gm
 		**                Constructor and Destructor
 		*****************************************************************************/
 		INLINE Vector4()                                   { _vector = vector::SplatZero(); }
-		INLINE Vector4(float x, float y, float z, float w) { _vector = DirectX::XMVectorSet(x, y, z, w); }
-		INLINE Vector4(const DirectX::XMFLOAT4& v)         { _vector = XMLoadFloat4(&v); }
-		INLINE Vector4(Vector3 xyz, float w)               { _vector = DirectX::XMVectorSetW(xyz, w); }
-		INLINE Vector4(const Float4& v)                    { _vector = XMLoadFloat4(&v); }
+		INLINE Vector4(float x, float y, float z, float w) { _vector = simd::VectorSet(x, y, z, w); }
+		INLINE Vector4(const simd::Float4Data& v)         { _vector = simd::LoadFloat4(&v); }
+		INLINE Vector4(Vector3 xyz, float w)               { _vector = simd::VectorSetW(xyz, w); }
+		INLINE Vector4(const Float4& v)                    { _vector = simd::LoadFloat4(&v); }
 		INLINE Vector4(const Vector4& v)                   { _vector = v; }
 		INLINE Vector4(const Scalar& s)                    { _vector = s; }
 		INLINE explicit Vector4(Vector3 xyz)               { _vector = vector::SetWToOne(xyz); }
-		INLINE explicit Vector4(DirectX::FXMVECTOR vec)    { _vector = vec; }
+		INLINE explicit Vector4(simd::VectorRegister vec)    { _vector = vec; }
 		INLINE explicit Vector4(EZeroTag)                  { _vector = vector::SplatZero(); }
 		INLINE explicit Vector4(EIdentityTag)              { _vector = vector::SplatOne(); }
 		INLINE explicit Vector4(EXUnitVector)              { _vector = vector::CreateXUnitVector(); }
 		INLINE explicit Vector4(EYUnitVector)              { _vector = vector::CreateYUnitVector(); }
 		INLINE explicit Vector4(EZUnitVector)              { _vector = vector::CreateZUnitVector(); }
 		INLINE explicit Vector4(EWUnitVector)              { _vector = vector::CreateWUnitVector(); }
-		INLINE operator DirectX::XMVECTOR() const { return _vector; }
+		INLINE operator simd::VectorRegister() const { return _vector; }
 
 	protected:
 		/****************************************************************************
@@ -518,10 +518,10 @@ namespace gm
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
-		DirectX::XMVECTOR _vector;
+		simd::VectorRegister _vector;
 	};
 
-	INLINE Vector3::Vector3(Vector4 vec) : _vector((DirectX::XMVECTOR)vec)
+	INLINE Vector3::Vector3(Vector4 vec) : _vector((simd::VectorRegister)vec)
 	{
 	}
 
@@ -529,7 +529,7 @@ namespace gm
 	INLINE Vector3 MakeHomogeneous(Vector4 v)
 	{
 		Scalar W = v.GetW();
-		return Vector3(DirectX::XMVectorSelect(DirectX::XMVectorDivide(v, W), v, DirectX::XMVectorEqual(W, vector::SplatZero())));
+		return Vector3(simd::VectorSelect(simd::VectorDivide(v, W), v, simd::VectorEqual(W, vector::SplatZero())));
 	}
 
 	CREATE_SIMD_FUNCTIONS(Vector2);
@@ -540,41 +540,41 @@ namespace gm
 	INLINE bool IsZero(const Vector3& v) { return (v.GetX() == 0.0f) && (v.GetY() == 0.0f) && (v.GetZ() == 0.0f); }
 	INLINE bool IsZero(const Vector4& v) { return (v.GetX() == 0.0f) && (v.GetY() == 0.0f) && (v.GetZ() == 0.0f) && (v.GetW() == 0.0f); }
 
-	INLINE Vector2 ReplicateVector2(float value) { return Vector2(DirectX::XMVectorReplicate(value)); }
-	INLINE Vector3 ReplicateVector3(float value) { return Vector3(DirectX::XMVectorReplicate(value)); }
-	INLINE Vector4 ReplicateVector4(float value) { return Vector4(DirectX::XMVectorReplicate(value)); }
+	INLINE Vector2 ReplicateVector2(float value) { return Vector2(simd::VectorReplicate(value)); }
+	INLINE Vector3 ReplicateVector3(float value) { return Vector3(simd::VectorReplicate(value)); }
+	INLINE Vector4 ReplicateVector4(float value) { return Vector4(simd::VectorReplicate(value)); }
 
-	INLINE Scalar Norm(const Vector2& v)                                          { return Scalar(DirectX::XMVector2Length(v)); }
-	INLINE Scalar Norm(const Vector3& v)                                          { return Scalar(DirectX::XMVector3Length(v)); }
-	INLINE Scalar Norm(const Vector4& v)                                          { return Scalar(DirectX::XMVector4Length(v)); }
+	INLINE Scalar Norm(const Vector2& v)                                          { return Scalar(simd::Vector2Length(v)); }
+	INLINE Scalar Norm(const Vector3& v)                                          { return Scalar(simd::Vector3Length(v)); }
+	INLINE Scalar Norm(const Vector4& v)                                          { return Scalar(simd::Vector4Length(v)); }
 
-	INLINE Scalar NormSquared(const Vector2& v)                                   { return Scalar(DirectX::XMVector2LengthSq(v)); }
-	INLINE Scalar NormSquared(const Vector3& v)                                   { return Scalar(DirectX::XMVector3LengthSq(v)); }
-	INLINE Scalar NormSquared(const Vector4& v)                                   { return Scalar(DirectX::XMVector4LengthSq(v)); }
+	INLINE Scalar NormSquared(const Vector2& v)                                   { return Scalar(simd::Vector2LengthSq(v)); }
+	INLINE Scalar NormSquared(const Vector3& v)                                   { return Scalar(simd::Vector3LengthSq(v)); }
+	INLINE Scalar NormSquared(const Vector4& v)                                   { return Scalar(simd::Vector4LengthSq(v)); }
 
 	INLINE bool FuzzyZero(const Vector2& v)										  { return NormSquared(v) < FLT_EPSILON * FLT_EPSILON; }
 	INLINE bool FuzzyZero(const Vector3& v)										  { return NormSquared(v) < FLT_EPSILON * FLT_EPSILON; }
 	INLINE bool FuzzyZero(const Vector4& v)										  { return NormSquared(v) < FLT_EPSILON * FLT_EPSILON; }
 
-	INLINE Scalar NormRecip(const Vector2& v)                                     { return Scalar(DirectX::XMVector2ReciprocalLength(v)); }
-	INLINE Scalar NormRecip(const Vector3& v)                                     { return Scalar(DirectX::XMVector3ReciprocalLength(v)); }
-	INLINE Scalar NormRecip(const Vector4& v)                                     { return Scalar(DirectX::XMVector4ReciprocalLength(v)); }
+	INLINE Scalar NormRecip(const Vector2& v)                                     { return Scalar(simd::Vector2ReciprocalLength(v)); }
+	INLINE Scalar NormRecip(const Vector3& v)                                     { return Scalar(simd::Vector3ReciprocalLength(v)); }
+	INLINE Scalar NormRecip(const Vector4& v)                                     { return Scalar(simd::Vector4ReciprocalLength(v)); }
 
-	INLINE Vector2 ClampNorm(const Vector2& v, float minNorm, float maxNorm)      { return Vector2(DirectX::XMVector2ClampLength(v, minNorm, maxNorm)); }
-	INLINE Vector3 ClampNorm(const Vector3& v, float minNorm, float maxNorm)      { return Vector3(DirectX::XMVector3ClampLength(v, minNorm, maxNorm)); }
-	INLINE Vector4 ClampNorm(const Vector4& v, float minNorm, float maxNorm)      { return Vector4(DirectX::XMVector4ClampLength(v, minNorm, maxNorm)); }
+	INLINE Vector2 ClampNorm(const Vector2& v, float minNorm, float maxNorm)      { return Vector2(simd::Vector2ClampLength(v, minNorm, maxNorm)); }
+	INLINE Vector3 ClampNorm(const Vector3& v, float minNorm, float maxNorm)      { return Vector3(simd::Vector3ClampLength(v, minNorm, maxNorm)); }
+	INLINE Vector4 ClampNorm(const Vector4& v, float minNorm, float maxNorm)      { return Vector4(simd::Vector4ClampLength(v, minNorm, maxNorm)); }
 
-	INLINE Scalar Dot(const Vector2& v1, const Vector2& v2)                       { return Scalar(DirectX::XMVector2Dot(v1, v2)); }
-	INLINE Scalar Dot(const Vector3& v1, const Vector3& v2)                       { return Scalar(DirectX::XMVector3Dot(v1, v2)); }
-	INLINE Scalar Dot(const Vector4& v1, const Vector4& v2)                       { return Scalar(DirectX::XMVector4Dot(v1, v2)); }
+	INLINE Scalar Dot(const Vector2& v1, const Vector2& v2)                       { return Scalar(simd::Vector2Dot(v1, v2)); }
+	INLINE Scalar Dot(const Vector3& v1, const Vector3& v2)                       { return Scalar(simd::Vector3Dot(v1, v2)); }
+	INLINE Scalar Dot(const Vector4& v1, const Vector4& v2)                       { return Scalar(simd::Vector4Dot(v1, v2)); }
 
-	INLINE Vector2 Cross(const Vector2& v1, const Vector2& v2)                    { return Vector2(DirectX::XMVector2Cross(v1, v2)); }
-	INLINE Vector3 Cross(const Vector3& v1, const Vector3& v2)                    { return Vector3(DirectX::XMVector3Cross(v1, v2)); }
-	INLINE Vector4 Cross(const Vector4& v1, const Vector4& v2, const Vector4& v3) { return Vector4(DirectX::XMVector4Cross(v1, v2, v3)); }
+	INLINE Vector2 Cross(const Vector2& v1, const Vector2& v2)                    { return Vector2(simd::Vector2Cross(v1, v2)); }
+	INLINE Vector3 Cross(const Vector3& v1, const Vector3& v2)                    { return Vector3(simd::Vector3Cross(v1, v2)); }
+	INLINE Vector4 Cross(const Vector4& v1, const Vector4& v2, const Vector4& v3) { return Vector4(simd::Vector4Cross(v1, v2, v3)); }
 
-	INLINE Vector2 Normalize(const Vector2& v)                                    { return Vector2(DirectX::XMVector2Normalize(v)); }
-	INLINE Vector3 Normalize(const Vector3& v)                                    { return Vector3(DirectX::XMVector3Normalize(v)); }
-	INLINE Vector4 Normalize(const Vector4& v)                                    { return Vector4(DirectX::XMVector4Normalize(v)); }
+	INLINE Vector2 Normalize(const Vector2& v)                                    { return Vector2(simd::Vector2Normalize(v)); }
+	INLINE Vector3 Normalize(const Vector3& v)                                    { return Vector3(simd::Vector3Normalize(v)); }
+	INLINE Vector4 Normalize(const Vector4& v)                                    { return Vector4(simd::Vector4Normalize(v)); }
 	
 	INLINE Vector3 SafeNormalize(const Vector3& v)
 	{
@@ -598,49 +598,49 @@ namespace gm
 	INLINE Scalar DistanceSquared(const Vector3& v1, const Vector3& v2)           { return Scalar(NormSquared(v1 - v2)); }
 	INLINE Scalar DistanceSquared(const Vector4& v1, const Vector4& v2)           { return Scalar(NormSquared(v1 - v2)); }
 
-	INLINE Vector2 Reflect(const Vector2& incident, const Vector2& normal)        { return Vector2(DirectX::XMVector2Reflect(incident, normal)); }
-	INLINE Vector3 Reflect(const Vector3& incident, const Vector3& normal)        { return Vector3(DirectX::XMVector3Reflect(incident, normal)); }
-	INLINE Vector4 Reflect(const Vector4& incident, const Vector4& normal)        { return Vector4(DirectX::XMVector4Reflect(incident, normal)); }
+	INLINE Vector2 Reflect(const Vector2& incident, const Vector2& normal)        { return Vector2(simd::Vector2Reflect(incident, normal)); }
+	INLINE Vector3 Reflect(const Vector3& incident, const Vector3& normal)        { return Vector3(simd::Vector3Reflect(incident, normal)); }
+	INLINE Vector4 Reflect(const Vector4& incident, const Vector4& normal)        { return Vector4(simd::Vector4Reflect(incident, normal)); }
 
-	INLINE Vector2 Refract(const Vector2& incident, const Vector2& normal, float refractRatio)                     { return Vector2(DirectX::XMVector2Refract(incident, normal, refractRatio)); }
-	INLINE Vector3 Refract(const Vector3& incident, const Vector3& normal, float refractRatio)                     { return Vector3(DirectX::XMVector3Refract(incident, normal, refractRatio)); }
-	INLINE Vector4 Refract(const Vector4& incident, const Vector4& normal, float refractRatio)                     { return Vector4(DirectX::XMVector4Refract(incident, normal, refractRatio)); }
+	INLINE Vector2 Refract(const Vector2& incident, const Vector2& normal, float refractRatio)                     { return Vector2(simd::Vector2Refract(incident, normal, refractRatio)); }
+	INLINE Vector3 Refract(const Vector3& incident, const Vector3& normal, float refractRatio)                     { return Vector3(simd::Vector3Refract(incident, normal, refractRatio)); }
+	INLINE Vector4 Refract(const Vector4& incident, const Vector4& normal, float refractRatio)                     { return Vector4(simd::Vector4Refract(incident, normal, refractRatio)); }
 
-	INLINE Vector2 Hermite(const Vector2& v1, const Vector2& t1, const Vector2& v2, const Vector2& t2, float t)    { return Vector2(DirectX::XMVectorHermite(v1, t1, v2, t2, t)); }
-	INLINE Vector3 Hermite(const Vector3& v1, const Vector3& t1, const Vector3& v2, const Vector3& t2, float t)    { return Vector3(DirectX::XMVectorHermite(v1, t1, v2, t2, t)); }
-	INLINE Vector4 Hermite(const Vector4& v1, const Vector4& t1, const Vector4& v2, const Vector4& t2, float t)    { return Vector4(DirectX::XMVectorHermite(v1, t1, v2, t2, t)); }
+	INLINE Vector2 Hermite(const Vector2& v1, const Vector2& t1, const Vector2& v2, const Vector2& t2, float t)    { return Vector2(simd::VectorHermite(v1, t1, v2, t2, t)); }
+	INLINE Vector3 Hermite(const Vector3& v1, const Vector3& t1, const Vector3& v2, const Vector3& t2, float t)    { return Vector3(simd::VectorHermite(v1, t1, v2, t2, t)); }
+	INLINE Vector4 Hermite(const Vector4& v1, const Vector4& t1, const Vector4& v2, const Vector4& t2, float t)    { return Vector4(simd::VectorHermite(v1, t1, v2, t2, t)); }
 
-	INLINE Vector2 CatmullRom(const Vector2& v1, const Vector2& v2, const Vector2& v3, const Vector2& v4, float t) { return Vector2(DirectX::XMVectorCatmullRom(v1, v2, v3, v4, t));}
-	INLINE Vector3 CatmullRom(const Vector3& v1, const Vector3& v2, const Vector3& v3, const Vector3& v4, float t) { return Vector3(DirectX::XMVectorCatmullRom(v1, v2, v3, v4, t)); }
-	INLINE Vector4 CatmullRom(const Vector4& v1, const Vector4& v2, const Vector4& v3, const Vector4& v4, float t) { return Vector4(DirectX::XMVectorCatmullRom(v1, v2, v3, v4, t)); }
+	INLINE Vector2 CatmullRom(const Vector2& v1, const Vector2& v2, const Vector2& v3, const Vector2& v4, float t) { return Vector2(simd::VectorCatmullRom(v1, v2, v3, v4, t));}
+	INLINE Vector3 CatmullRom(const Vector3& v1, const Vector3& v2, const Vector3& v3, const Vector3& v4, float t) { return Vector3(simd::VectorCatmullRom(v1, v2, v3, v4, t)); }
+	INLINE Vector4 CatmullRom(const Vector4& v1, const Vector4& v2, const Vector4& v3, const Vector4& v4, float t) { return Vector4(simd::VectorCatmullRom(v1, v2, v3, v4, t)); }
 	
-	INLINE Vector2 BaryCentric(const Vector2& v1, const Vector2& v2, const Vector2& v3, float wf, float wg)        { return Vector2(DirectX::XMVectorBaryCentric(v1, v2, v3, wf, wg)); }
-	INLINE Vector3 BaryCentric(const Vector3& v1, const Vector3& v2, const Vector3& v3, float wf, float wg)        { return Vector3(DirectX::XMVectorBaryCentric(v1, v2, v3, wf, wg)); }
-	INLINE Vector4 BaryCentric(const Vector4& v1, const Vector4& v2, const Vector4& v3, float wf, float wg)        { return Vector4(DirectX::XMVectorBaryCentric(v1, v2, v3, wf, wg)); }
+	INLINE Vector2 BaryCentric(const Vector2& v1, const Vector2& v2, const Vector2& v3, float wf, float wg)        { return Vector2(simd::VectorBaryCentric(v1, v2, v3, wf, wg)); }
+	INLINE Vector3 BaryCentric(const Vector3& v1, const Vector3& v2, const Vector3& v3, float wf, float wg)        { return Vector3(simd::VectorBaryCentric(v1, v2, v3, wf, wg)); }
+	INLINE Vector4 BaryCentric(const Vector4& v1, const Vector4& v2, const Vector4& v3, float wf, float wg)        { return Vector4(simd::VectorBaryCentric(v1, v2, v3, wf, wg)); }
 	
-	INLINE Vector2 AngleBetweenNormalizeVector(const Vector2& v1, const Vector2& v2) { return Vector2(DirectX::XMVector2AngleBetweenNormals(v1, v2)); }
-	INLINE Vector3 AngleBetweenNormalizeVector(const Vector3& v1, const Vector3& v2) { return Vector3(DirectX::XMVector3AngleBetweenNormals(v1, v2)); }
-	INLINE Vector2 AngleBetweenNormalizeVectorEstimation(const Vector2& v1, const Vector2& v2) { return Vector2(DirectX::XMVector2AngleBetweenNormalsEst(v1, v2)); }
-	INLINE Vector3 AngleBetweenNormalizeVectorEstimation(const Vector3& v1, const Vector3& v2) { return Vector3(DirectX::XMVector3AngleBetweenNormalsEst(v1, v2)); }
-	INLINE Vector2 AngleBetweenVectors(const Vector2& v1, const Vector2& v2) { return Vector2(DirectX::XMVector2AngleBetweenVectors(v1, v2)); }
-	INLINE Vector3 AngleBetweenVectors(const Vector3& v1, const Vector3& v2) { return Vector3(DirectX::XMVector3AngleBetweenVectors(v1, v2)); }
+	INLINE Vector2 AngleBetweenNormalizeVector(const Vector2& v1, const Vector2& v2) { return Vector2(simd::Vector2AngleBetweenNormals(v1, v2)); }
+	INLINE Vector3 AngleBetweenNormalizeVector(const Vector3& v1, const Vector3& v2) { return Vector3(simd::Vector3AngleBetweenNormals(v1, v2)); }
+	INLINE Vector2 AngleBetweenNormalizeVectorEstimation(const Vector2& v1, const Vector2& v2) { return Vector2(simd::Vector2AngleBetweenNormalsEst(v1, v2)); }
+	INLINE Vector3 AngleBetweenNormalizeVectorEstimation(const Vector3& v1, const Vector3& v2) { return Vector3(simd::Vector3AngleBetweenNormalsEst(v1, v2)); }
+	INLINE Vector2 AngleBetweenVectors(const Vector2& v1, const Vector2& v2) { return Vector2(simd::Vector2AngleBetweenVectors(v1, v2)); }
+	INLINE Vector3 AngleBetweenVectors(const Vector3& v1, const Vector3& v2) { return Vector3(simd::Vector3AngleBetweenVectors(v1, v2)); }
 
-	INLINE bool InBounds(const Vector2& v, const Vector2& bounds) { return DirectX::XMVector2InBounds(v, bounds); }
-	INLINE bool InBounds(const Vector3& v, const Vector3& bounds) { return DirectX::XMVector3InBounds(v, bounds); }
-	INLINE bool InBounds(const Vector4& v, const Vector4& bounds) { return DirectX::XMVector4InBounds(v, bounds); }
+	INLINE bool InBounds(const Vector2& v, const Vector2& bounds) { return simd::Vector2InBounds(v, bounds); }
+	INLINE bool InBounds(const Vector3& v, const Vector3& bounds) { return simd::Vector3InBounds(v, bounds); }
+	INLINE bool InBounds(const Vector4& v, const Vector4& bounds) { return simd::Vector4InBounds(v, bounds); }
 
-	INLINE bool IsInfinite(const Vector2& v) { return DirectX::XMVector2IsInfinite(v); }
-	INLINE bool IsInfinite(const Vector3& v) { return DirectX::XMVector3IsInfinite(v); }
-	INLINE bool IsInfinite(const Vector4& v) { return DirectX::XMVector4IsInfinite(v); }
+	INLINE bool IsInfinite(const Vector2& v) { return simd::Vector2IsInfinite(v); }
+	INLINE bool IsInfinite(const Vector3& v) { return simd::Vector3IsInfinite(v); }
+	INLINE bool IsInfinite(const Vector4& v) { return simd::Vector4IsInfinite(v); }
 
-	INLINE bool IsNAN(const Vector2& v) { return DirectX::XMVector2IsNaN(v); }
-	INLINE bool IsNAN(const Vector3& v) { return DirectX::XMVector3IsNaN(v); }
-	INLINE bool IsNAN(const Vector4& v) { return DirectX::XMVector4IsNaN(v); }
+	INLINE bool IsNAN(const Vector2& v) { return simd::Vector2IsNaN(v); }
+	INLINE bool IsNAN(const Vector3& v) { return simd::Vector3IsNaN(v); }
+	INLINE bool IsNAN(const Vector4& v) { return simd::Vector4IsNaN(v); }
 
-	INLINE Vector2 LinePointDistance(const Vector2& linePoint1, const Vector2& linePoint2, const Vector2& point) { return Vector2(DirectX::XMVector2LinePointDistance(linePoint1, linePoint2, point)); }
-	INLINE Vector3 LinePointDistance(const Vector3& linePoint1, const Vector3& linePoint2, const Vector3& point) { return Vector3(DirectX::XMVector3LinePointDistance(linePoint1, linePoint2, point)); }
+	INLINE Vector2 LinePointDistance(const Vector2& linePoint1, const Vector2& linePoint2, const Vector2& point) { return Vector2(simd::Vector2LinePointDistance(linePoint1, linePoint2, point)); }
+	INLINE Vector3 LinePointDistance(const Vector3& linePoint1, const Vector3& linePoint2, const Vector3& point) { return Vector3(simd::Vector3LinePointDistance(linePoint1, linePoint2, point)); }
 
-	INLINE Vector2 IntersectLine(const Vector2& line1Point1, const Vector2& line1Point2, const Vector2& line2Point1, const Vector2& line2Point2) { return Vector2(DirectX::XMVector2IntersectLine(line1Point1, line1Point2, line2Point1, line2Point2)); }
+	INLINE Vector2 IntersectLine(const Vector2& line1Point1, const Vector2& line1Point2, const Vector2& line2Point1, const Vector2& line2Point2) { return Vector2(simd::Vector2IntersectLine(line1Point1, line1Point2, line2Point1, line2Point2)); }
 	
 	INLINE Vector2Element MaxAxis2(const Vector2& v)
 	{
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "MainGame/Core/Include/GameManager.hpp"
 #include "GameCore/Include/Core/GameCorePipelineDeleter.hpp"
+#include "GameCore/Include/Profiler.hpp"
 #include <cassert>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -21,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 void GameManager::GameStart(GameTimer& gameTimer)
 {
+	PROFILE_THREAD("Main");
 	_directX12.Initialize(_mainWindow);
 	_directX12.ResetCommandList();
 	_renderingEngine.Initialize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
@@ -31,10 +33,14 @@ void GameManager::GameMain()
 {
 	Update();
 	Draw();
+	PROFILE_END_FRAME();
 }
 
 void GameManager::GameEnd()
 {
+#if USE_PROFILER
+	Profiler::Instance().ExportChromeTrace(L"ProfileTrace.json"); // last frames (chrome://tracing, ui.perfetto.dev)
+#endif
 	//_directX12.ResetCommandList();
 	_sceneManager.CallSceneTerminate();
 	_sceneManager.Finalize();
@@ -58,11 +64,13 @@ void GameManager::SetHWND(HWND hwnd)
 #pragma region Private Function
 void GameManager::Draw()
 {
+	PROFILE_FUNCTION();
 	_sceneManager.CallSceneDraw();
 }
 
 void GameManager::Update()
 {
+	PROFILE_FUNCTION();
 	_sceneManager.CallSceneUpdate();
 }
 
@@ -11,6 +11,7 @@
 #include "MainGame/Core/Include/Scene.hpp"
 #include "MainGame/Core/Include/RendererTitle.hpp"
 #include "GameCore/Include/GameTimer.hpp"
+#include "GameCore/Include/Core/GameObject.hpp"
 #include <iostream>
 #include <cassert>
 
@@ -90,6 +91,7 @@ void SceneManager::CallSceneInitialize(GameTimer& gameTimer) const
 void SceneManager::CallSceneUpdate()
 {
 	_currentScene.top()->Update();
+	GameObject::UpdateWorldMatrices(); // the draw reads the cached world matrices
 }
 /****************************************************************************
 *                       CallSceneDraw
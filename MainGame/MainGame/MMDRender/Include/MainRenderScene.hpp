@@ -100,7 +100,7 @@ private:
 	Texture _whiteTexture;
 	Sprite  _backSprite;
 	std::vector<std::wstring> _explainTexts;
-	const int _explainRows = 7;
+	const int _explainRows = 8;
 
 	/*-------------------------------------------------------------------
 	-          Post Effect Infomation
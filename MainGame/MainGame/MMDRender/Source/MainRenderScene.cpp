@@ -334,6 +334,7 @@ bool MainRenderScene::LoadMaterials(GameTimer& gameTimer)
 	_explainTexts[4] = L"P: Change PostEffect";
 	_explainTexts[5] = L"Enter: Back Title";
 	_explainTexts[6] = L"T: Hide text";
+	_explainTexts[7] = L"Right Click: Pick Model";
 	return true;
 }
 
@@ -350,6 +351,7 @@ bool MainRenderScene::InitializeRenderingEngine()
 {
 	_renderingEngine.OnAfterSceneTransition();
 	_renderingEngine.SetSceneGPUAddress(_frameResource->SceneConstantsBuffer.get()->Resource()->GetGPUVirtualAddress());
+	_renderingEngine.SetCamera(&_fpsCamera);
 	_renderingEngine.AddObjectToForwardRenderer(*_stage.get());
 	_renderingEngine.AddObjectToForwardRenderer(*_miku.get());
 	_renderingEngine.AddObjectToZPrepass       (*_stage.get());
@@ -478,6 +480,19 @@ void MainRenderScene::OnMouseInput()
 		_fpsCamera.RotatePitch(dy);
 		_fpsCamera.RotateWorldY(dx);
 	}
+	/*-------------------------------------------------------------------
+	-           Mouse Input Right Button (pick the model under the cursor)
+	---------------------------------------------------------------------*/
+	if (_gameInput.GetMouse().IsTrigger(MouseButton::RIGHT))
+	{
+		const GameActor* picked = _renderingEngine.PickForwardRenderingActor(
+			static_cast<float>(_gameInput.GetMouse().GetMousePosition_X()),
+			static_cast<float>(_gameInput.GetMouse().GetMousePosition_Y()));
+
+		if      (picked == nullptr)      { _explainTexts[7] = L"Right Click: Pick Model (None)"; }
+		else if (picked == _miku.get())  { _explainTexts[7] = L"Right Click: Pick Model (Miku)"; }
+		else if (picked == _stage.get()) { _explainTexts[7] = L"Right Click: Pick Model (Stage)"; }
+	}
 }
 
 /****************************************************************************
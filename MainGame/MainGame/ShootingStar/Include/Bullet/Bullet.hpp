@@ -15,6 +15,8 @@
 #include "GameCore/Include/Collision/Collider.hpp"
 #include "GameCore/Include/GameTimer.hpp"
 #include "GameMath/Include/GMVector.hpp"
+#include "GameMath/Include/GMObjectPool.hpp"
+#include "GameMath/Include/GMBlockAllocator.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -48,17 +50,24 @@ public:
 	*****************************************************************************/
 	static void     Initialize();
 	static std::vector<Bullet*>& AllBullets() { return _bullets; }
-	static std::vector<Bullet*>  AllActiveBullets();
-	static std::vector<Bullet*>  AllActivePlayerBullets();
+	static const std::vector<Bullet*>& AllActiveBullets(BulletType type) { return _bulletPools[(int)type].GetActiveObjects(); }
+	static const std::vector<Bullet*>& AllActivePlayerBullets() { return AllActiveBullets(BulletType::Player); }
 	static void     AllBulletsUpdate(GameTimer& gameTimer);
 	static void     ClearAllBullets();
 	static void     ActiveBullet(const gm::Vector3& position, const gm::Vector3& velocity,  BulletType type);
 	static void     GenerateBullets(int bulletNum, BulletType type, BulletColor color);
+
+	/* bullets are allocated from a block allocator (same size objects created and destroyed every scene) */
+	static void* operator new(std::size_t size);
+	static void  operator delete(void* ptr);
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
 	Collider2D&       GetColBox()       { return _colliderBox; }
 	const Collider2D& GetColBox() const { return _colliderBox; }
+	Collider2D        GetPreviousColBox() const;
+	Collider2D        GetSweptColBox() const;
+	const gm::Float2& GetDisplacement() const { return _displacement; }
 	Texture&          GetTexture  ()  { return _texture; }
 	const Texture&    GetTexture() const { return _texture; }
 	Sprite &          GetSprite   ()  { return _sprite; }
@@ -86,11 +95,14 @@ private:
 	*****************************************************************************/
 	Collider2D  _colliderBox;
 	gm::Vector3 _speed;
+	gm::Float2  _displacement; // movement in the last update (for the continuous collision detection)
 	Sprite      _sprite;
 	Texture     _texture;
 	const float _bulletSize = 0.10f;
 	BulletType  _bulletType;
 	static std::vector<Bullet*> _bullets;
+	static gm::ObjectPool<Bullet> _bulletPools[(int)BulletType::CountOfBulletType]; // live bullets of each type
+	static gm::BlockAllocator     _allocator;
 
 	static Texture _textureColorList[(int)BulletColor::CountOfColorType];
 };
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BulletSystem.hpp
+///             @brief  Data oriented bullet simulation (SoA arrays + SIMD update)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef BULLET_SYSTEM_HPP
+#define BULLET_SYSTEM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12VertexTypes.hpp"
+#include "GameMath/Include/GMVector.hpp"
+#include "GameMath/Include/GMMatrix.hpp"
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cfloat>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class  SpriteRenderer;
+struct Texture;
+
+// every SoA array is padded to this lane count so that the SIMD kernels never need a scalar tail.
+#define BULLET_SYSTEM_LANE_COUNT 8
+
+//////////////////////////////////////////////////////////////////////////////////
+//								Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			BulletSystem
+*************************************************************************//**
+*  @class     BulletSystem
+*  @brief     Bullets stored as structure of arrays (position, velocity, lifetime, type).
+*             Update integrates and culls all bullets with SSE/AVX, and the sprite vertices
+*             are written directly into the SpriteRenderer staging buffer (one draw call).
+*             Each bullet type has its own size, uv rect (in one texture atlas) and color.
+*             Bullets are kept in spawn order. Coordinates are the sprite space (-1 to 1).
+*****************************************************************************/
+class BulletSystem
+{
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	bool   SetBulletSprite(int typeID, const gm::Float2& size, const gm::Float2& u, const gm::Float2& v, const gm::Float4& color = gm::Float4(1.0f, 1.0f, 1.0f, 1.0f));
+	bool   Spawn (const gm::Float2& position, const gm::Float2& velocity, int typeID, float lifetime = FLT_MAX);
+	void   Update(float deltaTime);
+	size_t WriteVertices(VertexPositionNormalColorTexture* outVertices, size_t maxSpriteCount) const;
+	bool   Draw  (SpriteRenderer& renderer, const Texture& texture, const gm::Matrix4& matrix) const;
+	void   Clear ();
+	void   Reserve(size_t capacity);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	size_t Size      () const { return _count; }
+	size_t GetCapacity() const { return _capacity; }
+	const float*        GetPositionX() const { return _positionX.data(); }
+	const float*        GetPositionY() const { return _positionY.data(); }
+	const float*        GetVelocityX() const { return _velocityX.data(); }
+	const float*        GetVelocityY() const { return _velocityY.data(); }
+	const float*        GetLifetime () const { return _lifetime .data(); }
+	const std::int32_t* GetTypeID   () const { return _typeID   .data(); }
+
+	/* bullets which leave this rect (the whole sprite is outside) are removed in Update */
+	void SetCullingRect(float left, float bottom, float right, float top) { _cullLeft = left; _cullBottom = bottom; _cullRight = right; _cullTop = top; }
+	void SetDepth      (float z) { _depth = z; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	BulletSystem() = default;
+	BulletSystem(const BulletSystem&)            = default;
+	BulletSystem& operator=(const BulletSystem&) = default;
+	BulletSystem(BulletSystem&&)                 = default;
+	BulletSystem& operator=(BulletSystem&&)      = default;
+	~BulletSystem() = default;
+
+private:
+	struct BulletSprite
+	{
+		gm::Float2 HalfSize;
+		std::array<VertexPositionNormalColorTexture, 4> Vertices; // normal, color and uv (position is overwritten)
+		bool IsRegistered = false;
+	};
+	/****************************************************************************
+	**                Private Function
+	*****************************************************************************/
+	void Compact();
+
+	/****************************************************************************
+	**                Private Member Variables
+	*****************************************************************************/
+	std::vector<float>         _positionX;
+	std::vector<float>         _positionY;
+	std::vector<float>         _velocityX;
+	std::vector<float>         _velocityY;
+	std::vector<float>         _lifetime;   // remaining time [s]
+	std::vector<float>         _halfWidth;  // copied from the type at spawn (no gather in the kernels)
+	std::vector<float>         _halfHeight;
+	std::vector<std::int32_t>  _typeID;
+	std::vector<std::uint32_t> _aliveMask;  // bit i of word i / 32 : the i-th bullet survives this update
+	std::vector<BulletSprite>  _sprites;    // typeID -> sprite
+
+	size_t _count    = 0;
+	size_t _capacity = 0;
+	float  _cullLeft   = -1.0f;
+	float  _cullBottom = -1.0f;
+	float  _cullRight  =  1.0f;
+	float  _cullTop    =  1.0f;
+	float  _depth      =  0.0f;
+};
+
+#endif
@@ -14,6 +14,8 @@
 #include "GameCore/Include/Core/GameActor.hpp"
 #include "GameCore/Include/GameTimer.hpp"
 #include "GameMath/Include/GMVector.hpp"
+#include "GameMath/Include/GMObjectPool.hpp"
+#include "GameMath/Include/GMPoolAllocator.hpp"
 #include "GameCore/Include/Audio/AudioSource.hpp"
 #include <vector>
 //////////////////////////////////////////////////////////////////////////////////
@@ -36,11 +38,16 @@ public:
 	/****************************************************************************
 	**                Public Function
 	*****************************************************************************/
-	static std::vector<DamageEffect*> AllEffects() { return _damageEffects; }
+	static const std::vector<DamageEffect*>& AllEffects() { return _damageEffects; }
+	static const std::vector<DamageEffect*>& AllActiveEffects() { return _effectPool.GetActiveObjects(); }
 	static void AllEffectsUpdate(GameTimer& gameTimer);
 	static void ClearAllEffects();
 	static void ActiveEffect(const gm::Vector3& position);
 	static void CreateEffects(int effectNum);
+
+	/* effects are allocated from a fixed pool (the heap is used only when the pool is full) */
+	static void* operator new(std::size_t size);
+	static void  operator delete(void* ptr);
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
@@ -72,6 +79,8 @@ private:
 	float   _localTimer = 0;
 	std::unique_ptr<AudioSource> _audio;
 	static std::vector<DamageEffect*> _damageEffects;
+	static gm::ObjectPool<DamageEffect> _effectPool;
+	static gm::PoolAllocator            _allocator;
 };
 
 #endif
\ No newline at end of file
@@ -54,7 +54,7 @@ public:
 	int GetCurrentEnemyAppearCount() { return _emitterCount; }
 
 	Enemy* GetEnemy(EnemyType type, int index);
-	static std::vector<Enemy*> GetActiveEnemies();
+	static const std::vector<Enemy*>& GetActiveEnemies(EnemyType type);
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
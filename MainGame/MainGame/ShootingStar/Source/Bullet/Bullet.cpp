@@ -11,11 +11,14 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "MainGame/ShootingStar/Include/Bullet/Bullet.hpp"
 #include "GameCore/Include/Screen.hpp"
+#include "GameCore/Include/Collision/Collision.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 using namespace gm;
 std::vector<Bullet*> Bullet::_bullets;
+gm::ObjectPool<Bullet> Bullet::_bulletPools[(int)BulletType::CountOfBulletType];
+gm::BlockAllocator     Bullet::_allocator(sizeof(Bullet), 256);
 Texture Bullet::_textureColorList[(int)BulletColor::CountOfColorType];
 //////////////////////////////////////////////////////////////////////////////////
 //                              Implement
@@ -37,6 +40,7 @@ Bullet::Bullet(BulletType type, BulletColor color)
 	_sprite.CreateSpriteForTexture(_transform.LocalPosition.ToFloat3(), Float2(_bulletSize / Screen::GetAspectRatio(), _bulletSize), Float2(0, 1), Float2(0, 1));
 
 	_bullets.push_back(this);
+	_bulletPools[(int)type].Register(this);
 
 }
 /****************************************************************************
@@ -72,62 +76,57 @@ void Bullet::GenerateBullets(int bulletNum, BulletType type, BulletColor color)
 	}
 }
 /****************************************************************************
-*                      AllBulletsUpdate
+*                      operator new
 *************************************************************************//**
-*  @fn        void Bullet::AllBulletsUpdate(GameTimer& gameTimer)
-*  @brief     Update all bullets
-*  @param[in] GameTimer& gameTimer
-*  @return @@void
+*  @fn        void* Bullet::operator new(std::size_t size)
+*  @brief     Allocate one bullet from the block allocator
+*  @param[in] std::size_t size
+*  @return @@void*
 *****************************************************************************/
-void Bullet::AllBulletsUpdate(GameTimer& gameTimer)
+void* Bullet::operator new(std::size_t size)
 {
-	/*-------------------------------------------------------------------
-	-          Execute All bullet update 
-	---------------------------------------------------------------------*/
-	for (auto it = _bullets.begin(); it != _bullets.end(); ++it)
-	{
-		(*it)->Update(gameTimer);
-	}
+	assert(size <= _allocator.GetBlockSize());
+	void* ptr = _allocator.Allocate();
+	if (ptr == nullptr) { throw std::bad_alloc(); }
+	return ptr;
 }
 /****************************************************************************
-*                      AllActiveBullets
+*                      operator delete
 *************************************************************************//**
-*  @fn        std::vector<Bullet*> Bullet::AllActiveBullets()
-*  @brief     Return AllActiveBullets
-*  @param[in] void
-*  @return @@std::vector<Bullet*>
+*  @fn        void Bullet::operator delete(void* ptr)
+*  @brief     Return the bullet to the block allocator (GameObject::DestroyImmediate)
+*  @param[in] void* ptr
+*  @return @@void
 *****************************************************************************/
-std::vector<Bullet*> Bullet::AllActiveBullets()
+void Bullet::operator delete(void* ptr)
 {
-	std::vector<Bullet*> bullets;
-	for (auto& bullet : _bullets)
-	{
-		if (bullet->IsActive())
-		{
-			bullets.push_back(bullet);
-		}
-	}
-	return bullets;
+	_allocator.Free(ptr);
 }
 /****************************************************************************
-*                      AllActivePlayerBullets
+*                      AllBulletsUpdate
 *************************************************************************//**
-*  @fn        std::vector<Bullet*> Bullet::AllActivePlayerBullets
-*  @brief     return active player bullets
-*  @param[in] void
-*  @return @ std::vector<Bullet*>
+*  @fn        void Bullet::AllBulletsUpdate(GameTimer& gameTimer)
+*  @brief     Update all bullets
+*  @param[in] GameTimer& gameTimer
+*  @return @@void
 *****************************************************************************/
-std::vector<Bullet*> Bullet::AllActivePlayerBullets()
+void Bullet::AllBulletsUpdate(GameTimer& gameTimer)
 {
-	std::vector<Bullet*> bullets;
-	for (auto& bullet : _bullets)
+	/*-------------------------------------------------------------------
+	-          Execute live bullet update.
+	-          Bullets deactivated since the last update (collision, out of screen)
+	-          are returned to the pool here.
+	---------------------------------------------------------------------*/
+	for (auto& pool : _bulletPools)
 	{
-		if (bullet->IsActive() && bullet->GetBulletType() == BulletType::Player)
+		for (size_t i = 0; i < pool.GetActiveCount();)
 		{
-			bullets.push_back(bullet);
+			Bullet* bullet = pool.GetActiveObjects()[i];
+			bullet->Update(gameTimer);
+			if (bullet->IsActive()) { ++i; }
+			else                    { pool.ReleaseAt(i); }
 		}
 	}
-	return bullets;
 }
 /****************************************************************************
 *                       Update
@@ -148,7 +147,9 @@ void Bullet::Update(GameTimer& gameTimer)
 	-          Update position
 	---------------------------------------------------------------------*/
 	Vector3 position = _transform.LocalPosition;
-	position        -= _speed * gameTimer.DeltaTime();
+	Vector3 movement = _speed * gameTimer.DeltaTime();
+	position        -= movement;
+	_displacement    = Float2(-movement.GetX(), -movement.GetY());
 	
 	/*-------------------------------------------------------------------
 	-         Update position and collider (󏉊䗦ŌŒ肷.)
@@ -170,6 +171,7 @@ void Bullet::Update(GameTimer& gameTimer)
 		_transform.LocalPosition    = Vector3(0, 0, 0);
 		_colliderBox.centerPosition = _transform.LocalPosition.ToFloat3();
 		_speed = Vector3(0, 0, 0);
+		_displacement = Float2(0, 0);
 	}
 
 }
@@ -183,16 +185,39 @@ void Bullet::Update(GameTimer& gameTimer)
 *****************************************************************************/
 void Bullet::ActiveBullet(const gm::Vector3& position, const gm::Vector3& velocity, BulletType type)
 {
-	for (int i = 0; i < _bullets.size(); ++i)
-	{
-		if (_bullets[i]->_bulletType != type) { continue; }
-		if (_bullets[i]->IsActive()) { continue; }
-		
-		_bullets[i]->SetActive(true);
-		_bullets[i]->GetTransform().LocalPosition = position;
-		_bullets[i]->_speed = velocity;
-		break;
-	}
+	Bullet* bullet = _bulletPools[(int)type].Acquire();
+	if (bullet == nullptr) { return; } // all bullets are in use
+
+	bullet->SetActive(true);
+	bullet->GetTransform().LocalPosition = position;
+	bullet->_speed = velocity;
+	bullet->_displacement = Float2(0, 0);
+}
+/****************************************************************************
+*                       GetPreviousColBox
+*************************************************************************//**
+*  @fn        Collider2D Bullet::GetPreviousColBox() const
+*  @brief     Return the collider at the position before the last update
+*  @param[in] void
+*  @return    Collider2D
+*****************************************************************************/
+Collider2D Bullet::GetPreviousColBox() const
+{
+	Collider2D collider     = _colliderBox;
+	collider.centerPosition = Float3(_colliderBox.centerPosition.x - _displacement.x, _colliderBox.centerPosition.y - _displacement.y, 0.0f);
+	return collider;
+}
+/****************************************************************************
+*                       GetSweptColBox
+*************************************************************************//**
+*  @fn        Collider2D Bullet::GetSweptColBox() const
+*  @brief     Return the rectangle enclosing the movement in the last update (for the broad phase)
+*  @param[in] void
+*  @return    Collider2D
+*****************************************************************************/
+Collider2D Bullet::GetSweptColBox() const
+{
+	return Collision::GetSweptBounds2D(GetPreviousColBox(), _displacement);
 }
 /****************************************************************************
 *                       ClearAllBullets
@@ -210,6 +235,7 @@ void Bullet::ClearAllBullets()
 		Destroy(_bullets[i]);
 	}
 	_bullets.clear(); _bullets.shrink_to_fit();
+	for (auto& pool : _bulletPools) { pool.Clear(); }
 	
 	for (auto& texture : _textureColorList)
 	{
@@ -0,0 +1,337 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BulletSystem.cpp
+///             @brief  Data oriented bullet simulation (SoA arrays + SIMD update)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MainGame/ShootingStar/Include/Bullet/BulletSystem.hpp"
+#include "GameCore/Include/Sprite/SpriteRenderer.hpp"
+#include <immintrin.h>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+
+namespace
+{
+#if defined(__AVX__)
+	using BatchVector = __m256;
+	constexpr size_t BATCH_WIDTH = 8;
+	INLINE BatchVector Load        (const float* p)                { return _mm256_loadu_ps(p); }
+	INLINE void        Store       (float* p, BatchVector a)       { _mm256_storeu_ps(p, a); }
+	INLINE BatchVector Splat       (float value)                   { return _mm256_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm256_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm256_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm256_mul_ps(a, b); }
+	INLINE BatchVector Greater     (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	INLINE BatchVector GreaterEqual(BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm256_and_ps(a, b); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm256_movemask_ps(a)); }
+#else
+	using BatchVector = __m128;
+	constexpr size_t BATCH_WIDTH = 4;
+	INLINE BatchVector Load        (const float* p)                { return _mm_loadu_ps(p); }
+	INLINE void        Store       (float* p, BatchVector a)       { _mm_storeu_ps(p, a); }
+	INLINE BatchVector Splat       (float value)                   { return _mm_set1_ps(value); }
+	INLINE BatchVector Add         (BatchVector a, BatchVector b)  { return _mm_add_ps(a, b); }
+	INLINE BatchVector Sub         (BatchVector a, BatchVector b)  { return _mm_sub_ps(a, b); }
+	INLINE BatchVector Mul         (BatchVector a, BatchVector b)  { return _mm_mul_ps(a, b); }
+	INLINE BatchVector Greater     (BatchVector a, BatchVector b)  { return _mm_cmpgt_ps(a, b); }
+	INLINE BatchVector GreaterEqual(BatchVector a, BatchVector b)  { return _mm_cmpge_ps(a, b); }
+	INLINE BatchVector LessEqual   (BatchVector a, BatchVector b)  { return _mm_cmple_ps(a, b); }
+	INLINE BatchVector And         (BatchVector a, BatchVector b)  { return _mm_and_ps(a, b); }
+	INLINE std::uint32_t MoveMask  (BatchVector a)                 { return static_cast<std::uint32_t>(_mm_movemask_ps(a)); }
+#endif
+	static_assert(BULLET_SYSTEM_LANE_COUNT % BATCH_WIDTH == 0, "Padding must be a multiple of the simd width.");
+
+	INLINE size_t PaddedSize(size_t count)
+	{
+		return (count + BULLET_SYSTEM_LANE_COUNT - 1) / BULLET_SYSTEM_LANE_COUNT * BULLET_SYSTEM_LANE_COUNT;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*							SetBulletSprite
+*************************************************************************//**
+*  @fn        bool BulletSystem::SetBulletSprite(int typeID, const gm::Float2& size, const gm::Float2& u, const gm::Float2& v, const gm::Float4& color)
+*  @brief     Register the sprite of the bullet type (same uv layout as Sprite::CreateRect)
+*  @param[in] int typeID (0 or more)
+*  @param[in] const gm::Float2& size  (width, height)
+*  @param[in] const gm::Float2& u     (u[0], u[1])
+*  @param[in] const gm::Float2& v     (v[0], v[1])
+*  @param[in] const gm::Float4& color (R, G, B, Alpha)
+*  @return    bool
+*****************************************************************************/
+bool BulletSystem::SetBulletSprite(int typeID, const Float2& size, const Float2& u, const Float2& v, const Float4& color)
+{
+	if (typeID < 0)
+	{
+		::OutputDebugString(L"Error!: bullet type id must not be negative.");
+		return false;
+	}
+	if (static_cast<size_t>(typeID) >= _sprites.size()) { _sprites.resize(static_cast<size_t>(typeID) + 1); }
+
+	BulletSprite& sprite = _sprites[typeID];
+	sprite.HalfSize      = Float2(size.x / 2, size.y / 2);
+	sprite.IsRegistered  = true;
+
+	/*-------------------------------------------------------------------
+	-    Axis aligned rect: the face normal is always +z
+	---------------------------------------------------------------------*/
+	const Float2 uvs[] = { Float2(u.x, v.y), Float2(u.x, v.x), Float2(u.y, v.x), Float2(u.y, v.y) };
+	for (int i = 0; i < 4; ++i)
+	{
+		sprite.Vertices[i].Position = Float3(0.0f, 0.0f, 0.0f);
+		sprite.Vertices[i].Normal   = Float3(0.0f, 0.0f, 1.0f);
+		sprite.Vertices[i].Color    = color;
+		sprite.Vertices[i].UV       = uvs[i];
+	}
+	return true;
+}
+
+/****************************************************************************
+*							Spawn
+*************************************************************************//**
+*  @fn        bool BulletSystem::Spawn(const gm::Float2& position, const gm::Float2& velocity, int typeID, float lifetime)
+*  @brief     Add a bullet. The arrays grow when the capacity is exceeded (call Reserve beforehand to avoid it)
+*  @param[in] const gm::Float2& position
+*  @param[in] const gm::Float2& velocity [/s]
+*  @param[in] int   typeID (registered by SetBulletSprite)
+*  @param[in] float lifetime [s]
+*  @return    bool
+*****************************************************************************/
+bool BulletSystem::Spawn(const Float2& position, const Float2& velocity, int typeID, float lifetime)
+{
+	if (typeID < 0 || static_cast<size_t>(typeID) >= _sprites.size() || !_sprites[typeID].IsRegistered)
+	{
+		::OutputDebugString(L"Error!: bullet type is not registered.");
+		return false;
+	}
+	if (_count == _capacity) { Reserve(_capacity == 0 ? 1024 : _capacity * 2); }
+
+	const BulletSprite& sprite = _sprites[typeID];
+	_positionX [_count] = position.x;
+	_positionY [_count] = position.y;
+	_velocityX [_count] = velocity.x;
+	_velocityY [_count] = velocity.y;
+	_lifetime  [_count] = lifetime;
+	_halfWidth [_count] = sprite.HalfSize.x;
+	_halfHeight[_count] = sprite.HalfSize.y;
+	_typeID    [_count] = typeID;
+	_count++;
+	return true;
+}
+
+/****************************************************************************
+*							Update
+*************************************************************************//**
+*  @fn        void BulletSystem::Update(float deltaTime)
+*  @brief     Integrate the positions, decrease the lifetimes and remove the
+*             bullets which are expired or outside the culling rect.
+*  @param[in] float deltaTime
+*  @return    void
+*****************************************************************************/
+void BulletSystem::Update(float deltaTime)
+{
+	if (_count == 0) { return; }
+
+	const BatchVector dt     = Splat(deltaTime);
+	const BatchVector zero   = Splat(0.0f);
+	const BatchVector left   = Splat(_cullLeft);
+	const BatchVector bottom = Splat(_cullBottom);
+	const BatchVector right  = Splat(_cullRight);
+	const BatchVector top    = Splat(_cullTop);
+
+	float* positionX = _positionX.data();
+	float* positionY = _positionY.data();
+	float* lifetime  = _lifetime .data();
+
+	const size_t wordCount = (_count + 31) / 32;
+	std::memset(_aliveMask.data(), 0, wordCount * sizeof(std::uint32_t));
+
+	/*-------------------------------------------------------------------
+	-    Integration and culling (the padding lanes are computed but ignored)
+	---------------------------------------------------------------------*/
+	for (size_t i = 0; i < _count; i += BATCH_WIDTH)
+	{
+		const BatchVector x    = Add(Load(positionX + i), Mul(Load(_velocityX.data() + i), dt));
+		const BatchVector y    = Add(Load(positionY + i), Mul(Load(_velocityY.data() + i), dt));
+		const BatchVector life = Sub(Load(lifetime  + i), dt);
+		const BatchVector hw   = Load(_halfWidth .data() + i);
+		const BatchVector hh   = Load(_halfHeight.data() + i);
+		Store(positionX + i, x);
+		Store(positionY + i, y);
+		Store(lifetime  + i, life);
+
+		BatchVector alive = Greater(life, zero);
+		alive = And(alive, GreaterEqual(Add(x, hw), left));
+		alive = And(alive, LessEqual   (Sub(x, hw), right));
+		alive = And(alive, GreaterEqual(Add(y, hh), bottom));
+		alive = And(alive, LessEqual   (Sub(y, hh), top));
+		_aliveMask[i / 32] |= MoveMask(alive) << (i % 32);
+	}
+	if (_count % 32 != 0) { _aliveMask[wordCount - 1] &= (1u << (_count % 32)) - 1u; }
+
+	Compact();
+}
+
+/****************************************************************************
+*							WriteVertices
+*************************************************************************//**
+*  @fn        size_t BulletSystem::WriteVertices(VertexPositionNormalColorTexture* outVertices, size_t maxSpriteCount) const
+*  @brief     Write 4 vertices per bullet (same corner order as Sprite::CreateRect).
+*             outVertices is written sequentially and never read, so it can point to the mapped upload heap.
+*  @param[out]VertexPositionNormalColorTexture* outVertices (4 * maxSpriteCount elements)
+*  @param[in] size_t maxSpriteCount
+*  @return    size_t written sprite count
+*****************************************************************************/
+size_t BulletSystem::WriteVertices(VertexPositionNormalColorTexture* outVertices, size_t maxSpriteCount) const
+{
+	using Vertex = VertexPositionNormalColorTexture;
+	const size_t writeCount = (std::min)(_count, maxSpriteCount);
+
+	alignas(32) float left  [BATCH_WIDTH];
+	alignas(32) float right [BATCH_WIDTH];
+	alignas(32) float bottom[BATCH_WIDTH];
+	alignas(32) float top   [BATCH_WIDTH];
+	Vertex quad[4];
+
+	for (size_t i = 0; i < writeCount; i += BATCH_WIDTH)
+	{
+		/*-------------------------------------------------------------------
+		-    Rect edges of BATCH_WIDTH bullets
+		---------------------------------------------------------------------*/
+		const BatchVector x  = Load(_positionX .data() + i);
+		const BatchVector y  = Load(_positionY .data() + i);
+		const BatchVector hw = Load(_halfWidth .data() + i);
+		const BatchVector hh = Load(_halfHeight.data() + i);
+		Store(left  , Sub(x, hw));
+		Store(right , Add(x, hw));
+		Store(bottom, Sub(y, hh));
+		Store(top   , Add(y, hh));
+
+		/*-------------------------------------------------------------------
+		-    Expand to the vertex layout (one 4 vertices block per bullet)
+		---------------------------------------------------------------------*/
+		const size_t laneCount = (std::min)(BATCH_WIDTH, writeCount - i);
+		for (size_t lane = 0; lane < laneCount; ++lane)
+		{
+			std::memcpy(quad, _sprites[_typeID[i + lane]].Vertices.data(), sizeof(quad));
+			quad[0].Position = Float3(left [lane], bottom[lane], _depth);
+			quad[1].Position = Float3(left [lane], top   [lane], _depth);
+			quad[2].Position = Float3(right[lane], top   [lane], _depth);
+			quad[3].Position = Float3(right[lane], bottom[lane], _depth);
+			std::memcpy(outVertices + (i + lane) * 4, quad, sizeof(quad));
+		}
+	}
+	return writeCount;
+}
+
+/****************************************************************************
+*							Draw
+*************************************************************************//**
+*  @fn        bool BulletSystem::Draw(SpriteRenderer& renderer, const Texture& texture, const gm::Matrix4& matrix) const
+*  @brief     Write all bullets into the sprite renderer staging buffer (between DrawStart and DrawEnd)
+*  @param[in] SpriteRenderer& renderer
+*  @param[in] const Texture& texture (atlas of all bullet types)
+*  @param[in] const gm::Matrix4& matrix
+*  @return    bool
+*****************************************************************************/
+bool BulletSystem::Draw(SpriteRenderer& renderer, const Texture& texture, const Matrix4& matrix) const
+{
+	int writableSpriteCount = 0;
+	VertexPositionNormalColorTexture* vertices = renderer.BeginVertexWrite(writableSpriteCount, static_cast<int>(_count));
+	if (vertices == nullptr) { return false; }
+
+	const size_t writtenCount = WriteVertices(vertices, static_cast<size_t>((std::max)(writableSpriteCount, 0)));
+	return renderer.EndVertexWrite(static_cast<int>(writtenCount), texture, matrix);
+}
+
+void BulletSystem::Clear()
+{
+	_count = 0;
+}
+
+/****************************************************************************
+*							Reserve
+*************************************************************************//**
+*  @fn        void BulletSystem::Reserve(size_t capacity)
+*  @brief     Allocate the SoA arrays (padded to BULLET_SYSTEM_LANE_COUNT)
+*  @param[in] size_t capacity
+*  @return    void
+*****************************************************************************/
+void BulletSystem::Reserve(size_t capacity)
+{
+	if (capacity <= _capacity) { return; }
+	const size_t paddedSize = PaddedSize(capacity);
+
+	_positionX .resize(paddedSize, 0.0f);
+	_positionY .resize(paddedSize, 0.0f);
+	_velocityX .resize(paddedSize, 0.0f);
+	_velocityY .resize(paddedSize, 0.0f);
+	_lifetime  .resize(paddedSize, 0.0f);
+	_halfWidth .resize(paddedSize, 0.0f);
+	_halfHeight.resize(paddedSize, 0.0f);
+	_typeID    .resize(paddedSize, 0);
+	_aliveMask .resize((paddedSize + 31) / 32, 0);
+	_capacity = capacity;
+}
+#pragma endregion Public Function
+
+#pragma region Private Function
+/****************************************************************************
+*							Compact
+*************************************************************************//**
+*  @fn        void BulletSystem::Compact()
+*  @brief     Move the surviving bullets to the front (the spawn order is kept)
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void BulletSystem::Compact()
+{
+	const size_t wordCount = (_count + 31) / 32;
+	size_t writeIndex = 0;
+
+	for (size_t word = 0; word < wordCount; ++word)
+	{
+		std::uint32_t mask  = _aliveMask[word];
+		const size_t  first = word * 32;
+
+		/*-------------------------------------------------------------------
+		-    Nothing has been removed yet and the whole word survives
+		---------------------------------------------------------------------*/
+		if (mask == 0xFFFFFFFFu && writeIndex == first) { writeIndex += 32; continue; }
+
+		for (size_t bit = 0; mask != 0; ++bit, mask >>= 1)
+		{
+			if ((mask & 1u) == 0) { continue; }
+
+			const size_t readIndex = first + bit;
+			if (readIndex != writeIndex)
+			{
+				_positionX [writeIndex] = _positionX [readIndex];
+				_positionY [writeIndex] = _positionY [readIndex];
+				_velocityX [writeIndex] = _velocityX [readIndex];
+				_velocityY [writeIndex] = _velocityY [readIndex];
+				_lifetime  [writeIndex] = _lifetime  [readIndex];
+				_halfWidth [writeIndex] = _halfWidth [readIndex];
+				_halfHeight[writeIndex] = _halfHeight[readIndex];
+				_typeID    [writeIndex] = _typeID    [readIndex];
+			}
+			writeIndex++;
+		}
+	}
+	_count = writeIndex;
+}
+#pragma endregion Private Function
@@ -17,6 +17,8 @@
 //////////////////////////////////////////////////////////////////////////////////
 using namespace gm;
 std::vector<DamageEffect*> DamageEffect::_damageEffects;
+gm::ObjectPool<DamageEffect> DamageEffect::_effectPool;
+gm::PoolAllocator            DamageEffect::_allocator(static_cast<int>(sizeof(DamageEffect)), 32);
 
 static float g_AnimationPatternTable[9] =
 {
@@ -52,6 +54,33 @@ DamageEffect::DamageEffect()
 	_audio.get()->LoadSound(L"Resources/Audio/ShootingStar/bomb01.wav", SoundType::SE);
 
 	_damageEffects.push_back(this);
+	_effectPool.Register(this);
+}
+/****************************************************************************
+*                      operator new
+*************************************************************************//**
+*  @fn        void* DamageEffect::operator new(std::size_t size)
+*  @brief     Allocate one effect from the pool (from the heap when the pool is full)
+*  @param[in] std::size_t size
+*  @return @@void*
+*****************************************************************************/
+void* DamageEffect::operator new(std::size_t size)
+{
+	void* ptr = _allocator.Allocate(static_cast<int>(size));
+	return ptr != nullptr ? ptr : ::operator new(size);
+}
+/****************************************************************************
+*                      operator delete
+*************************************************************************//**
+*  @fn        void DamageEffect::operator delete(void* ptr)
+*  @brief     Return the effect to the pool (or to the heap)
+*  @param[in] void* ptr
+*  @return @@void
+*****************************************************************************/
+void DamageEffect::operator delete(void* ptr)
+{
+	if (_allocator.ValidPtr(ptr)) { _allocator.FreeMemory(ptr); }
+	else                          { ::operator delete(ptr); }
 }
 /****************************************************************************
 *                      CreateEffect
@@ -79,11 +108,14 @@ void DamageEffect::CreateEffects(int effectNum)
 void DamageEffect::AllEffectsUpdate(GameTimer& gameTimer)
 {
 	/*-------------------------------------------------------------------
-	-          Execute All effect update
+	-          Execute live effect update (finished effects return to the pool)
 	---------------------------------------------------------------------*/
-	for (auto it = _damageEffects.begin(); it != _damageEffects.end(); ++it)
+	for (size_t i = 0; i < _effectPool.GetActiveCount();)
 	{
-		(*it)->Update(gameTimer);
+		DamageEffect* effect = _effectPool.GetActiveObjects()[i];
+		effect->Update(gameTimer);
+		if (effect->IsActive()) { ++i; }
+		else                    { _effectPool.ReleaseAt(i); }
 	}
 }
 /****************************************************************************
@@ -125,17 +157,14 @@ void DamageEffect::Update(GameTimer& gameTimer)
 *****************************************************************************/
 void DamageEffect::ActiveEffect(const gm::Vector3& position)
 {
-	for (int i = 0; i < _damageEffects.size(); ++i)
-	{
-		if (_damageEffects[i]->IsActive()) { continue; }
+	DamageEffect* effect = _effectPool.Acquire();
+	if (effect == nullptr) { return; } // all effects are in use
 
-		_damageEffects[i]->SetActive(true);
-		_damageEffects[i]->GetTransform().LocalPosition = position;
-		_damageEffects[i]->_animationIndex = 0;
-		_damageEffects[i]->_sprite.UpdateSpriteForTexture(_damageEffects[i]->_transform.LocalPosition.ToFloat3(), Float2(0.125f * g_AnimationPattern[_damageEffects[i]->_animationIndex], 0.125f * (g_AnimationPattern[_damageEffects[i]->_animationIndex] + 1)), Float2(0, 1));
-		_damageEffects[i]->_audio.get()->Play();
-		break;
-	}
+	effect->SetActive(true);
+	effect->GetTransform().LocalPosition = position;
+	effect->_animationIndex = 0;
+	effect->_sprite.UpdateSpriteForTexture(effect->_transform.LocalPosition.ToFloat3(), Float2(0.125f * g_AnimationPattern[effect->_animationIndex], 0.125f * (g_AnimationPattern[effect->_animationIndex] + 1)), Float2(0, 1));
+	effect->_audio.get()->Play();
 }
 /****************************************************************************
 *                       ClearAllEffects
@@ -153,4 +182,5 @@ void DamageEffect::ClearAllEffects()
 		Destroy(_damageEffects[i]);
 	}
 	_damageEffects.clear(); _damageEffects.shrink_to_fit();
+	_effectPool.Clear();
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "MainGame/ShootingStar/Include/Enemy/EnemyPurple.hpp"
 #include "MainGame/ShootingStar/Include/Enemy/EnemyRed.hpp"
 #include "MainGame/ShootingStar/Include/Player/Player.hpp"
+#include "GameMath/Include/GMObjectPool.hpp"
 using namespace gm;
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +83,7 @@ std::vector<EnemyBoss>       g_bossEnemies;
 std::vector<EnemyLightGreen> g_greenEnemies;
 std::vector<EnemyPurple>     g_purpleEnemies;
 std::vector<EnemyRed>        g_redEnemies;
+gm::ObjectPool<Enemy>        g_enemyPools[(int)EnemyType::CountOfEnemyType]; // live enemies of each type
 bool g_enableGenerate = true;
 
 namespace enemy
@@ -92,6 +94,8 @@ namespace enemy
 	static void GenerateEnemyPurple(const Vector3& position);
 	static void GenerateEnemyRed(const Vector3& position);
 	static void GenerateEnemyBoss(const Vector3& position);
+	static void GenerateFromPool(EnemyType type, const Vector3& position);
+	template<class T> static void RegisterPool(EnemyType type, std::vector<T>& enemies);
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +146,15 @@ void EnemyManager::Initialize()
 		enemy.Initialize();
 	}
 
+	/*-------------------------------------------------------------------
+	-           Register enemies to the pool (all enemies start as free)
+	---------------------------------------------------------------------*/
+	enemy::RegisterPool(EnemyType::Default   , g_enemies);
+	enemy::RegisterPool(EnemyType::Blue      , g_blueEnemies);
+	enemy::RegisterPool(EnemyType::LightGreen, g_greenEnemies);
+	enemy::RegisterPool(EnemyType::Purple    , g_purpleEnemies);
+	enemy::RegisterPool(EnemyType::Red       , g_redEnemies);
+	enemy::RegisterPool(EnemyType::Boss      , g_bossEnemies);
 }
 /****************************************************************************
 *                      Update
@@ -170,29 +183,21 @@ void EnemyManager::Update(GameTimer& gameTimer, const Player& player)
 	
 
 	// G̍XV
-	for (auto& enemy : g_enemies)
-	{
-		enemy.Update(gameTimer, player);
-	}
-	for (auto& enemy : g_blueEnemies)
-	{
-		enemy.Update(gameTimer, player);
-	}
-	for (auto& enemy : g_greenEnemies)
-	{
-		enemy.Update(gameTimer, player);
-	}
-	for (auto& enemy : g_purpleEnemies)
-	{
-		enemy.Update(gameTimer, player);
-	}
-	for (auto& enemy : g_redEnemies)
-	{
-		enemy.Update(gameTimer, player);
-	}
-	for (auto& enemy : g_bossEnemies)
+	/*-------------------------------------------------------------------
+	-           Update only the live enemies.
+	-           An enemy deactivated since the last update (collision or its own update)
+	-           gets one more update to clean up (laser, barrier...), and then returns to the pool.
+	---------------------------------------------------------------------*/
+	for (auto& pool : g_enemyPools)
 	{
-		enemy.Update(gameTimer, player);
+		for (size_t i = 0; i < pool.GetActiveCount();)
+		{
+			Enemy* enemy = pool.GetActiveObjects()[i];
+			const bool wasActive = enemy->IsActive();
+			enemy->Update(gameTimer, player);
+			if (wasActive) { ++i; }
+			else           { pool.ReleaseAt(i); }
+		}
 	}
 	_localTimer += gameTimer.DeltaTime();
 }
@@ -218,6 +223,7 @@ void EnemyManager::Terminate()
 	g_greenEnemies .clear(); g_greenEnemies .shrink_to_fit();
 	g_purpleEnemies.clear(); g_purpleEnemies.shrink_to_fit();
 	g_redEnemies   .clear(); g_redEnemies   .shrink_to_fit();
+	for (auto& pool : g_enemyPools) { pool.Clear(); }
 }
 /****************************************************************************
 *                      GenerateEnemy
@@ -325,141 +331,27 @@ Enemy* EnemyManager::GetEnemy(EnemyType type, int index)
 void EnemyManager::GetDrawMaterial(EnemyType type, std::vector<Sprite>& sprite, Texture& texture)
 {
 	sprite.clear();
-	switch (type)
+	for (auto& enemy : g_enemyPools[(int)type].GetActiveObjects())
 	{
-		case EnemyType::Default:
-		{
-			for (auto& enemy : g_enemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
-		}
-		case EnemyType::Blue:
-		{
-			for (auto& enemy : g_blueEnemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
-		}
-		case EnemyType::LightGreen:
+		if (enemy->IsActive())
 		{
-			for (auto& enemy : g_greenEnemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
-		}
-		case EnemyType::Purple:
-		{
-			for (auto& enemy : g_purpleEnemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
-		}
-		case EnemyType::Red:
-		{
-			for (auto& enemy : g_redEnemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
-		}
-		case EnemyType::Boss:
-		{
-			for (auto& enemy : g_bossEnemies)
-			{
-				if (enemy.IsActive())
-				{
-					sprite.push_back(enemy.GetSprite());
-					texture = enemy.GetTexture();
-				}
-			}
-			break;
+			sprite.push_back(enemy->GetSprite());
+			texture = enemy->GetTexture();
 		}
 	}
-	
 }
 /****************************************************************************
 *                      GetActiveEnemies
 *************************************************************************//**
-*  @fn        std::vector<Enemy*> EnemyManager::GetActiveEnemies()
-*  @brief     Return active enemies
-*  @param[in] void
-*  @return @@std::vector<Enemy*>
+*  @fn        const std::vector<Enemy*>& EnemyManager::GetActiveEnemies(EnemyType type)
+*  @brief     Return the live enemies of the type (no copy).
+*             An enemy deactivated in this frame stays in the list until the next update.
+*  @param[in] EnemyType type
+*  @return    const std::vector<Enemy*>&
 *****************************************************************************/
-std::vector<Enemy*> EnemyManager::GetActiveEnemies()
+const std::vector<Enemy*>& EnemyManager::GetActiveEnemies(EnemyType type)
 {
-	std::vector<Enemy*> enemies;
-	for (auto& enemy : g_enemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-
-	for (auto& enemy : g_blueEnemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-
-	for (auto& enemy : g_greenEnemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-
-	for (auto& enemy : g_purpleEnemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-
-	for (auto& enemy : g_redEnemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-	for (auto& enemy : g_bossEnemies)
-	{
-		if (enemy.IsActive())
-		{
-			enemies.push_back(&enemy);
-		}
-	}
-	return enemies;
+	return g_enemyPools[(int)type].GetActiveObjects();
 }
 /****************************************************************************
 *                      GenerateEnemyDefault
@@ -471,10 +363,7 @@ std::vector<Enemy*> EnemyManager::GetActiveEnemies()
 *****************************************************************************/
 void enemy::GenerateEnemyDefault(const Vector3& position)
 {
-	for (auto& enemy : g_enemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
+	GenerateFromPool(EnemyType::Default, position);
 }
 /****************************************************************************
 *                      GenerateEnemyBlue
@@ -486,10 +375,7 @@ void enemy::GenerateEnemyDefault(const Vector3& position)
 *****************************************************************************/
 void enemy::GenerateEnemyBlue(const Vector3& position)
 {
-	for (auto& enemy : g_blueEnemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
+	GenerateFromPool(EnemyType::Blue, position);
 }
 /****************************************************************************
 *                      GenerateEnemyLightGreen
@@ -501,10 +387,7 @@ void enemy::GenerateEnemyBlue(const Vector3& position)
 *****************************************************************************/
 void enemy::GenerateEnemyLightGreen(const Vector3& position)
 {
-	for (auto& enemy : g_greenEnemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
+	GenerateFromPool(EnemyType::LightGreen, position);
 }
 /****************************************************************************
 *                      GenerateEnemyPurple
@@ -516,10 +399,7 @@ void enemy::GenerateEnemyLightGreen(const Vector3& position)
 *****************************************************************************/
 void enemy::GenerateEnemyPurple(const Vector3& position)
 {
-	for (auto& enemy : g_purpleEnemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
+	GenerateFromPool(EnemyType::Purple, position);
 }
 /****************************************************************************
 *                      GenerateEnemyRed
@@ -531,10 +411,7 @@ void enemy::GenerateEnemyPurple(const Vector3& position)
 *****************************************************************************/
 void enemy::GenerateEnemyRed(const Vector3& position)
 {
-	for (auto& enemy : g_redEnemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
+	GenerateFromPool(EnemyType::Red, position);
 }
 /****************************************************************************
 *                      GenerateEnemyBoss
@@ -546,8 +423,38 @@ void enemy::GenerateEnemyRed(const Vector3& position)
 *****************************************************************************/
 void enemy::GenerateEnemyBoss(const Vector3& position)
 {
-	for (auto& enemy : g_bossEnemies)
-	{
-		if (enemy.Generate(position)) { break; }
-	}
-}
\ No newline at end of file
+	GenerateFromPool(EnemyType::Boss, position);
+}
+/****************************************************************************
+*                      GenerateFromPool
+*************************************************************************//**
+*  @fn        void enemy::GenerateFromPool(EnemyType type, const Vector3& position)
+*  @brief     Take a free enemy from the pool and generate it
+*  @param[in] EnemyType type
+*  @param[in] Vector3& position
+*  @return    void
+*****************************************************************************/
+void enemy::GenerateFromPool(EnemyType type, const Vector3& position)
+{
+	ObjectPoolHandle handle;
+	Enemy* enemy = g_enemyPools[(int)type].Acquire(&handle);
+	if (enemy == nullptr) { return; } // all enemies are in use
+
+	if (!enemy->Generate(position)) { g_enemyPools[(int)type].Release(handle); }
+}
+/****************************************************************************
+*                      RegisterPool
+*************************************************************************//**
+*  @fn        void enemy::RegisterPool(EnemyType type, std::vector<T>& enemies)
+*  @brief     Register the enemy buffer to the pool
+*  @param[in] EnemyType type
+*  @param[in] std::vector<T>& enemies
+*  @return    void
+*****************************************************************************/
+template<class T>
+void enemy::RegisterPool(EnemyType type, std::vector<T>& enemies)
+{
+	g_enemyPools[(int)type].Clear();
+	g_enemyPools[(int)type].Reserve(enemies.size());
+	for (auto& enemy : enemies) { g_enemyPools[(int)type].Register(&enemy); }
+}
@@ -274,18 +274,15 @@ void ShootingStarGame::DrawSprites()
 	/*-------------------------------------------------------------------
 	-            Hit Animation
 	---------------------------------------------------------------------*/
-	if (DamageEffect::AllEffects().size() != 0)
+	if (DamageEffect::AllActiveEffects().size() != 0)
 	{
 		Texture texture;
-		for (auto& effect : DamageEffect::AllEffects())
+		for (auto& effect : DamageEffect::AllActiveEffects())
 		{
-			if (effect->IsActive())
-			{
-				texture = effect->GetTexture();
-				damage.push_back(effect->GetSprite());
-			}
+			texture = effect->GetTexture();
+			damage.push_back(effect->GetSprite());
 		}
-		if (damage.size() != 0) _spriteRenderer.get()->Draw(damage, texture, MatrixIdentity());
+		_spriteRenderer.get()->Draw(damage, texture, MatrixIdentity());
 	}
 
 	/*-------------------------------------------------------------------
@@ -321,10 +318,9 @@ void ShootingStarGame::DrawSprites()
 		{
 			std::vector<Sprite> bullets;
 			Texture texture;
-			for (auto& bullet : Bullet::AllBullets())
+			for (auto& bullet : Bullet::AllActiveBullets((BulletType)i))
 			{
-				if (bullet->GetBulletType() != (BulletType)i) { continue; }
-				if (bullet->IsActive())
+				if (bullet->IsActive()) // bullets hit in this frame are returned to the pool in the next update.
 				{
 					texture = bullet->GetTexture();
 					bullets.push_back(bullet->GetSprite());
@@ -429,39 +425,46 @@ void ShootingStarGame::UpdateBackGround()
 
 void ShootingStarGame::CollisionDetections()
 {
-	auto enemies = EnemyManager::Instance().GetActiveEnemies();
-	auto bullets = Bullet::AllActiveBullets();
-	auto playerBullets = Bullet::AllActivePlayerBullets();
+	const auto& playerBullets = Bullet::AllActivePlayerBullets();
+	const BulletType enemyBulletTypes[] = { BulletType::EnemyBulletBlue, BulletType::EnemyBulletGreen };
+	float timeOfImpact = 0.0f;
 	/*-------------------------------------------------------------------
 	-           Player Bullet vs Enemy
+	-           (bullets are swept over the last movement so that fast bullets
+	-            can not pass through the enemies at a low frame rate.)
 	---------------------------------------------------------------------*/
-	for (auto& enemy : enemies)
+	for (int type = 0; type < (int)EnemyType::CountOfEnemyType; ++type)
 	{
-		for (auto& bullet : playerBullets)
+		for (auto& enemy : EnemyManager::GetActiveEnemies((EnemyType)type))
 		{
-			if (Collision::OnCollision2D(bullet->GetColBox(), enemy->GetColBox()))
+			if (!enemy->IsActive()) { continue; }
+			for (auto& bullet : playerBullets)
 			{
-				if (enemy->GetEnemyType() == EnemyType::Boss && static_cast<EnemyBoss*>(enemy)->IsCharging())
+				if (!Collision::OnCollision2D(bullet->GetSweptColBox(), enemy->GetColBox())) { continue; }
+				if (Collision::OnSweepCollision2D(bullet->GetPreviousColBox(), bullet->GetDisplacement(), enemy->GetColBox(), timeOfImpact))
 				{
-					bullet->SetActive(false);
-					enemy->Damage(_player.get()->GetAttackPower());
-					DamageEffect::ActiveEffect(Vector3(enemy->GetTransform().LocalPosition + Vector3(0.05f, -0.3f, 0)));
+					if (enemy->GetEnemyType() == EnemyType::Boss && static_cast<EnemyBoss*>(enemy)->IsCharging())
+					{
+						bullet->SetActive(false);
+						enemy->Damage(_player.get()->GetAttackPower());
+						DamageEffect::ActiveEffect(Vector3(enemy->GetTransform().LocalPosition + Vector3(0.05f, -0.3f, 0)));
+						if (enemy->IsHPZero())
+						{
+							_player.get()->SetIsClear(true);
+						}
+					}
+					else if(enemy->GetEnemyType() == EnemyType::Boss){}
+					else
+					{
+						bullet->SetActive(false);
+						enemy->Damage(_player.get()->GetAttackPower());
+						DamageEffect::ActiveEffect(enemy->GetTransform().LocalPosition);
+					}
 					if (enemy->IsHPZero())
 					{
-						_player.get()->SetIsClear(true);
+						enemy->SetActive(false);
 					}
 				}
-				else if(enemy->GetEnemyType() == EnemyType::Boss){}
-				else
-				{
-					bullet->SetActive(false);
-					enemy->Damage(_player.get()->GetAttackPower());
-					DamageEffect::ActiveEffect(enemy->GetTransform().LocalPosition);
-				}
-				if (enemy->IsHPZero())
-				{
-					enemy->SetActive(false);
-				}
 			}
 		}
 	}
@@ -469,15 +472,22 @@ void ShootingStarGame::CollisionDetections()
 	/*-------------------------------------------------------------------
 	-           Player Bullet vs Enemy Bullet
 	---------------------------------------------------------------------*/
-	for (auto& bullet : bullets)
+	for (auto bulletType : enemyBulletTypes)
 	{
-		if (bullet->GetBulletType() == BulletType::Player) { continue; };
-		for (auto& playerBullet : playerBullets)
+		for (auto& bullet : Bullet::AllActiveBullets(bulletType))
 		{
-			if (Collision::OnCollision2D(bullet->GetColBox(), playerBullet->GetColBox()))
+			for (auto& playerBullet : playerBullets)
 			{
-				bullet->SetActive(false);
-				playerBullet->SetActive(false);
+				if (!Collision::OnCollision2D(bullet->GetSweptColBox(), playerBullet->GetSweptColBox())) { continue; }
+
+				const Float2 relativeDisplacement(
+					bullet->GetDisplacement().x - playerBullet->GetDisplacement().x,
+					bullet->GetDisplacement().y - playerBullet->GetDisplacement().y);
+				if (Collision::OnSweepCollision2D(bullet->GetPreviousColBox(), relativeDisplacement, playerBullet->GetPreviousColBox(), timeOfImpact))
+				{
+					bullet->SetActive(false);
+					playerBullet->SetActive(false);
+				}
 			}
 		}
 	}
@@ -487,30 +497,43 @@ void ShootingStarGame::CollisionDetections()
 		/*-------------------------------------------------------------------
 		-           Enemy Bullet vs Player
 		---------------------------------------------------------------------*/
-		for (auto& bullet : bullets)
+		bool hasHit = false;
+		for (auto bulletType : enemyBulletTypes)
 		{
-			if (bullet->GetBulletType() == BulletType::Player) { continue; }
-			if (Collision::OnCollision2D(bullet->GetColBox(), _player.get()->GetColBox()))
+			for (auto& bullet : Bullet::AllActiveBullets(bulletType))
 			{
-				_player.get()->Damage();
-				bullet->SetActive(false);
-				DamageEffect::ActiveEffect(_player.get()->GetTransform().LocalPosition);
-				break;
+				if (!Collision::OnCollision2D(bullet->GetSweptColBox(), _player.get()->GetColBox())) { continue; }
+				if (Collision::OnSweepCollision2D(bullet->GetPreviousColBox(), bullet->GetDisplacement(), _player.get()->GetColBox(), timeOfImpact))
+				{
+					_player.get()->Damage();
+					bullet->SetActive(false);
+					DamageEffect::ActiveEffect(_player.get()->GetTransform().LocalPosition);
+					hasHit = true;
+					break;
+				}
 			}
+			if (hasHit) { break; }
 		}
 
 		/*-------------------------------------------------------------------
 		-           Player vs Enemy
 		---------------------------------------------------------------------*/
-		for (auto& enemy : enemies)
+		hasHit = false;
+		for (int type = 0; type < (int)EnemyType::CountOfEnemyType; ++type)
 		{
-			if (Collision::OnCollision2D(_player.get()->GetColBox(), enemy->GetColBox()))
+			for (auto& enemy : EnemyManager::GetActiveEnemies((EnemyType)type))
 			{
-				_player.get()->Damage();
-				enemy->SetActive(false);
-				DamageEffect::ActiveEffect(_player.get()->GetTransform().LocalPosition);
-				break;
+				if (!enemy->IsActive()) { continue; }
+				if (Collision::OnCollision2D(_player.get()->GetColBox(), enemy->GetColBox()))
+				{
+					_player.get()->Damage();
+					enemy->SetActive(false);
+					DamageEffect::ActiveEffect(_player.get()->GetTransform().LocalPosition);
+					hasHit = true;
+					break;
+				}
 			}
+			if (hasHit) { break; }
 		}
 
 		/*-------------------------------------------------------------------
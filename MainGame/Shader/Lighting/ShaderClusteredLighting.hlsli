@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////////
+//              Title:  ShaderClusteredLighting.hlsli
+//            Content:  Clustered light lists built on the CPU (GameCore/Include/Rendering/ClusteredLighting.hpp)
+//             Author:  Toide Yutaro
+//             Create:  2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef SHADER_CLUSTERED_LIGHTING_HLSLI
+#define SHADER_CLUSTERED_LIGHTING_HLSLI
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "ShaderLightType.hlsli"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Define
+//////////////////////////////////////////////////////////////////////////////////
+// same layout as ClusterConstants (32 bytes)
+struct ClusterConstants
+{
+    uint  CountX;
+    uint  CountY;
+    uint  CountZ;
+    uint  PointLightCount;
+    uint  SpotLightCount;
+    float NearZ;
+    float SliceScale; // slice = floor(log(viewZ) * SliceScale + SliceBias)
+    float SliceBias;
+};
+
+// same layout as ClusterLightRange (16 bytes)
+// LightIndices[Offset, Offset + PointCount) : point lights, the next SpotCount : spot lights
+struct ClusterLightRange
+{
+    uint Offset;
+    uint PointCount;
+    uint SpotCount;
+    uint Padding;
+};
+
+/*-------------------------------------------------------------------
+-   Usage (the buffers are bound by the renderer)
+-   StructuredBuffer<PointLight>        ClusterPointLights;
+-   StructuredBuffer<SpotLight>         ClusterSpotLights;
+-   StructuredBuffer<ClusterLightRange> ClusterLightRanges;
+-   StructuredBuffer<uint>              ClusterLightIndices;
+-
+-   ClusterLightRange range = ClusterLightRanges[GetClusterIndex(cluster, svPosition.xy, RenderTargetSize, viewZ)];
+-   for (uint i = 0; i < range.PointCount; ++i) { PointLight light = ClusterPointLights[ClusterLightIndices[range.Offset + i]]; ... }
+-   for (uint j = 0; j < range.SpotCount;  ++j) { SpotLight  light = ClusterSpotLights [ClusterLightIndices[range.Offset + range.PointCount + j]]; ... }
+---------------------------------------------------------------------*/
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  		GetClusterIndex
+*************************************************************************//**
+*  @class     uint GetClusterIndex(ClusterConstants cluster, float2 pixel, float2 renderTargetSize, float viewZ)
+*  @brief     Cluster of a pixel ((z * CountY + y) * CountX + x, x from the left and y from the top of the screen)
+*  @param[in] ClusterConstants cluster
+*  @param[in] float2 pixel (SV_Position.xy)
+*  @param[in] float2 render target size
+*  @param[in] float  view space depth
+*****************************************************************************/
+uint GetClusterIndex(ClusterConstants cluster, float2 pixel, float2 renderTargetSize, float viewZ)
+{
+    uint2 tile  = min((uint2)(pixel * float2(cluster.CountX, cluster.CountY) / renderTargetSize), uint2(cluster.CountX - 1, cluster.CountY - 1));
+    int   slice = (int)floor(log(max(viewZ, cluster.NearZ)) * cluster.SliceScale + cluster.SliceBias);
+    uint  z     = (uint)clamp(slice, 0, (int)cluster.CountZ - 1);
+    return (z * cluster.CountY + tile.y) * cluster.CountX + tile.x;
+}
+
+#endif
@@ -0,0 +1,330 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   AudioMixerTest.cpp
+///             @brief  AudioMixer / AudioSink : gains, resampling, 3D attenuation, voice stealing,
+///                     the sinks and the voices per millisecond benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/AudioMixer.hpp"
+#include "GameCore/Include/Audio/AudioSink.hpp"
+#include "GameCore/Include/Audio/WavDecoder.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr float QUARTER_PI = 0.785398163f;
+
+	std::shared_ptr<AudioMixerClip> MakeClip(const std::vector<float>& samples, std::uint32_t channels, std::uint32_t rate)
+	{
+		auto clip = std::make_shared<AudioMixerClip>();
+		clip->Create(samples.data(), samples.size() / channels, channels, rate);
+		return clip;
+	}
+
+	std::vector<float> MakeRamp(size_t count, float step)
+	{
+		std::vector<float> samples(count);
+		for (size_t i = 0; i < count; ++i) { samples[i] = static_cast<float>(i) * step; }
+		return samples;
+	}
+
+	bool IsNear(float a, float b, float tolerance = 1e-5f) { return std::fabs(a - b) <= tolerance; }
+
+	/*---------------------------------------------------------------------------
+	-   Same rate : mono is panned with equal power, stereo with balance
+	---------------------------------------------------------------------------*/
+	void CheckGains()
+	{
+		AudioMixer mixer;
+		TEST_CHECK(mixer.Initialize(48000, 4, 64));
+		test::Random random(38);
+
+		std::vector<float> mono(500), stereo(1000); // shorter than the mix, so the voices end inside it
+		for (float& value : mono)   { value = random.Float(-0.5f, 0.5f); }
+		for (float& value : stereo) { value = random.Float(-0.5f, 0.5f); }
+		const auto monoClip   = MakeClip(mono  , 1, 48000);
+		const auto stereoClip = MakeClip(stereo, 2, 48000);
+
+		const float pans[] = { -1.0f, -0.3f, 0.0f, 0.6f, 1.0f };
+		for (float pan : pans)
+		{
+			AudioMixerPlayDesc desc;
+			desc.Volume = 0.8f;
+			desc.Pan    = pan;
+
+			std::vector<float> output(512 * 2);
+			mixer.Play(monoClip, desc);
+			mixer.Mix(output.data(), 512);
+			const float monoLeft  = 0.8f * std::cos((pan + 1.0f) * QUARTER_PI);
+			const float monoRight = 0.8f * std::sin((pan + 1.0f) * QUARTER_PI);
+			int failed = 0;
+			for (size_t i = 0; i < 500; ++i)
+			{
+				if (!IsNear(output[i * 2], mono[i] * monoLeft) || !IsNear(output[i * 2 + 1], mono[i] * monoRight)) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "mono pan %.1f : %d frame(s) differ", pan, failed);
+
+			mixer.Play(stereoClip, desc);
+			mixer.Mix(output.data(), 512);
+			const float stereoLeft  = 0.8f * (std::min)(1.0f - pan, 1.0f);
+			const float stereoRight = 0.8f * (std::min)(1.0f + pan, 1.0f);
+			failed = 0;
+			for (size_t i = 0; i < 500; ++i)
+			{
+				if (!IsNear(output[i * 2], stereo[i * 2] * stereoLeft) || !IsNear(output[i * 2 + 1], stereo[i * 2 + 1] * stereoRight)) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "stereo pan %.1f : %d frame(s) differ", pan, failed);
+			TEST_CHECK(mixer.GetActiveVoiceCount() == 0);
+		}
+
+		/* the master volume scales and clamps the output */
+		std::vector<float> output(64 * 2);
+		AudioMixerPlayDesc desc;
+		desc.Pan = -1.0f;
+		mixer.Play(stereoClip, desc);
+		mixer.Play(stereoClip, desc);
+		mixer.SetMasterVolume(4.0f);
+		mixer.Mix(output.data(), 64);
+		int failed = 0;
+		for (size_t i = 0; i < 64; ++i)
+		{
+			const float expected = (std::min)((std::max)((stereo[i * 2] + stereo[i * 2]) * 4.0f, -1.0f), 1.0f);
+			if (!IsNear(output[i * 2], expected) || output[i * 2 + 1] != 0.0f) { failed++; }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "master volume : %d frame(s) differ", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Linear and Catmull-Rom resampling of a ramp (both are exact on a line),
+	-   loop wrap and the release of the one-shot voice at its end
+	---------------------------------------------------------------------------*/
+	void CheckResample()
+	{
+		AudioMixer mixer;
+		TEST_CHECK(mixer.Initialize(48000, 4, 100));
+		const auto halfRate = MakeClip(MakeRamp(300, 0.001f), 1, 24000);
+		const float gain = std::cos(QUARTER_PI);
+
+		const AudioInterpolation interpolations[] = { AudioInterpolation::Linear, AudioInterpolation::Cubic };
+		for (AudioInterpolation interpolation : interpolations)
+		{
+			AudioMixerPlayDesc desc;
+			desc.Interpolation = interpolation;
+			const AudioVoiceHandle handle = mixer.Play(halfRate, desc);
+
+			std::vector<float> output(700 * 2);
+			mixer.Mix(output.data(), 700);
+			int failed = 0;
+			for (size_t i = 2; i < 590; ++i) // the cubic curve needs the neighbours of both sides
+			{
+				if (!IsNear(output[i * 2], static_cast<float>(i) * 0.0005f * gain)) { failed++; }
+			}
+			for (size_t i = 600; i < 700; ++i)
+			{
+				if (output[i * 2] != 0.0f || output[i * 2 + 1] != 0.0f) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "interpolation %d : %d frame(s) differ", static_cast<int>(interpolation), failed);
+			TEST_CHECK(!mixer.IsPlaying(handle) && mixer.GetActiveVoiceCount() == 0);
+		}
+
+		/* loop : frame i reads clip[i % 300] */
+		AudioMixerPlayDesc loop;
+		loop.IsLoop = true;
+		const auto sameRate = MakeClip(MakeRamp(300, 0.001f), 1, 48000);
+		const AudioVoiceHandle handle = mixer.Play(sameRate, loop);
+		std::vector<float> output(1000 * 2);
+		mixer.Mix(output.data(), 1000);
+		int failed = 0;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			if (!IsNear(output[i * 2], static_cast<float>(i % 300) * 0.001f * gain)) { failed++; }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "loop : %d frame(s) differ", failed);
+		TEST_CHECK(mixer.IsPlaying(handle));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Distance attenuation, azimuth pan and the doppler clamp
+	---------------------------------------------------------------------------*/
+	void Check3D()
+	{
+		AudioMixer mixer;
+		TEST_CHECK(mixer.Initialize(48000, 4, 256));
+		const auto dc = MakeClip(std::vector<float>(4096, 1.0f), 1, 48000);
+		std::vector<float> output(256 * 2);
+
+		/* the gain moves from the 2D gain to the 3D gain in the first block */
+		const AudioVoiceHandle front = mixer.Play(dc);
+		AudioMixerEmitter emitter;
+		emitter.Position = gm::Float3(0.0f, 0.0f, 4.0f);
+		mixer.SetEmitter(front, emitter);
+		mixer.Mix(output.data(), 256);
+		mixer.Mix(output.data(), 256);
+		const float center = 0.25f * std::cos(QUARTER_PI);
+		TEST_CHECK_MESSAGE(IsNear(output[0], center) && IsNear(output[1], center), "front : %f %f", output[0], output[1]);
+		mixer.Stop(front);
+
+		const AudioVoiceHandle right = mixer.Play(dc);
+		emitter.Position = gm::Float3(4.0f, 0.0f, 0.0f);
+		mixer.SetEmitter(right, emitter);
+		mixer.Mix(output.data(), 256);
+		mixer.Mix(output.data(), 256);
+		TEST_CHECK_MESSAGE(IsNear(output[0], 0.0f) && IsNear(output[1], 0.25f), "right : %f %f", output[0], output[1]);
+		mixer.Stop(right);
+
+		/* 200 m/s toward the listener : 343.5 / 143.5 is clamped to 2, so frame i reads clip[2i] */
+		const auto ramp = MakeClip(MakeRamp(4096, 1e-4f), 1, 48000);
+		const AudioVoiceHandle moving = mixer.Play(ramp);
+		emitter.Position = gm::Float3(0.0f, 0.0f, 1.0f);
+		emitter.Velocity = gm::Float3(0.0f, 0.0f, -200.0f);
+		mixer.SetEmitter(moving, emitter);
+		mixer.Mix(output.data(), 256);
+		int failed = 0;
+		for (size_t i = 0; i < 256; ++i)
+		{
+			if (!IsNear(output[i * 2], static_cast<float>(i * 2) * 1e-4f * std::cos(QUARTER_PI))) { failed++; }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "doppler : %d frame(s) differ", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The oldest one-shot voice is stolen, looping voices never are,
+	-   and the handles of a reused voice expire
+	---------------------------------------------------------------------------*/
+	void CheckVoicePool()
+	{
+		AudioMixer mixer;
+		TEST_CHECK(mixer.Initialize(48000, 4, 64));
+		const auto clip = MakeClip(std::vector<float>(48000, 0.1f), 1, 48000);
+
+		AudioMixerPlayDesc loop;
+		loop.IsLoop = true;
+		const AudioVoiceHandle looping = mixer.Play(clip, loop);
+		std::vector<AudioVoiceHandle> oneShots;
+		for (int i = 0; i < 3; ++i) { oneShots.push_back(mixer.Play(clip)); }
+		TEST_CHECK(mixer.GetActiveVoiceCount() == 4);
+
+		const AudioVoiceHandle stealer = mixer.Play(clip);
+		TEST_CHECK(stealer != INVALID_AUDIO_VOICE && (stealer & 0xFFFF) == (oneShots[0] & 0xFFFF));
+		TEST_CHECK(!mixer.IsPlaying(oneShots[0]) && mixer.IsPlaying(oneShots[1]) && mixer.IsPlaying(looping));
+
+		/* the expired handle must not stop the new owner */
+		mixer.Stop(oneShots[0]);
+		mixer.SetVolume(oneShots[0], 0.0f);
+		TEST_CHECK(mixer.IsPlaying(stealer) && mixer.GetActiveVoiceCount() == 4);
+
+		mixer.StopAll();
+		for (int i = 0; i < 4; ++i) { TEST_CHECK(mixer.Play(clip, loop) != INVALID_AUDIO_VOICE); }
+		TEST_CHECK(mixer.Play(clip) == INVALID_AUDIO_VOICE);
+		TEST_CHECK(mixer.Play(nullptr) == INVALID_AUDIO_VOICE);
+
+		AudioMixerClip broken;
+		const float sample = 0.0f;
+		TEST_CHECK(!broken.Create(&sample, 1, 3, 48000) && !broken.Create(nullptr, 1, 1, 48000) && !broken.Create(&sample, 1, 1, 0));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Render : NullAudioSink counts the frames, WavFileAudioSink writes a float wave file
+	---------------------------------------------------------------------------*/
+	void CheckSinks()
+	{
+		const auto clip = MakeClip(MakeRamp(1000, 0.0005f), 1, 48000);
+		AudioMixer mixer;
+
+		NullAudioSink nullSink;
+		TEST_CHECK(mixer.Initialize(48000, 4, 256, &nullSink));
+		mixer.Play(clip);
+		TEST_CHECK(mixer.Render(1000));
+		TEST_CHECK(nullSink.GetWrittenFrameCount() == 1000);
+		TEST_CHECK(IsNear(nullSink.GetPeak(), 999.0f * 0.0005f * std::cos(QUARTER_PI)));
+
+		std::vector<float> expected(1000 * 2);
+		mixer.Play(clip);
+		mixer.Mix(expected.data(), 1000);
+
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / "MainGameAudioMixerTest.wav";
+		{
+			WavFileAudioSink fileSink(path.wstring());
+			mixer.SetSink(&fileSink);
+			mixer.Play(clip);
+			TEST_CHECK(mixer.Render(1000));
+			TEST_CHECK(fileSink.GetWrittenFrameCount() == 1000);
+			mixer.SetSink(nullptr);
+		}
+
+		WavDecoder decoder;
+		TEST_CHECK(decoder.OpenStream(path.wstring()));
+		TEST_CHECK(decoder.GetFormat().FormatTag == WAV_FORMAT_IEEE_FLOAT && decoder.GetFormat().Channels == 2);
+		TEST_CHECK(decoder.GetFormat().SamplesPerSecond == 48000 && decoder.GetFrameCount() == 1000);
+		std::vector<float> written(1000 * 2);
+		TEST_CHECK(decoder.ReadFramesAsFloat(written.data(), 1000) == 1000 && written == expected);
+		decoder.Close();
+		std::filesystem::remove(path);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   256 looping voices at 48kHz, 256 frame blocks
+	---------------------------------------------------------------------------*/
+	void BenchOne(const char* name, const std::shared_ptr<AudioMixerClip>& clip, AudioInterpolation interpolation)
+	{
+		const std::uint32_t voiceCount = 256;
+		const size_t        blockCount = 400 * static_cast<size_t>(test::BenchScale());
+		AudioMixer mixer;
+		mixer.Initialize(48000, voiceCount, 256);
+
+		test::Random random(3800);
+		for (std::uint32_t i = 0; i < voiceCount; ++i)
+		{
+			AudioMixerPlayDesc desc;
+			desc.IsLoop        = true;
+			desc.Volume        = 1.0f / voiceCount;
+			desc.Pan           = random.Float(-1.0f, 1.0f);
+			desc.Interpolation = interpolation;
+			mixer.Play(clip, desc);
+		}
+
+		std::vector<float> output(256 * 2);
+		test::Timer timer;
+		for (size_t i = 0; i < blockCount; ++i) { mixer.Mix(output.data(), 256); }
+		const double ms = timer.ElapsedMs();
+		test::DoNotOptimize(output[0]);
+		test::PrintBench(name, ms, voiceCount * blockCount, "voice block");
+	}
+
+	void Bench()
+	{
+		test::Random random(3801);
+		std::vector<float> stereo(44100 * 2);
+		for (float& value : stereo) { value = random.Float(-1.0f, 1.0f); }
+		const auto clip44  = MakeClip(stereo, 2, 44100);
+		const auto clip48  = MakeClip(stereo, 2, 48000);
+		const auto monoClip = MakeClip(std::vector<float>(stereo.begin(), stereo.begin() + 44100), 1, 44100);
+
+		BenchOne("256 voices stereo 48k -> 48k"         , clip48  , AudioInterpolation::Linear);
+		BenchOne("256 voices stereo 44.1k -> 48k linear", clip44  , AudioInterpolation::Linear);
+		BenchOne("256 voices stereo 44.1k -> 48k cubic" , clip44  , AudioInterpolation::Cubic);
+		BenchOne("256 voices mono   44.1k -> 48k linear", monoClip, AudioInterpolation::Linear);
+	}
+}
+
+int main()
+{
+	CheckGains();
+	CheckResample();
+	Check3D();
+	CheckVoicePool();
+	CheckSinks();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,332 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   WavDecoderTest.cpp
+///             @brief  WavDecoder / WavStream : decode generated wave files of every supported format
+///                     (load, stream, seek, broken headers, ring buffers) and the decode throughput
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Audio/WavDecoder.hpp"
+#include "GameCore/Include/Audio/WavStream.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/* format of a generated file : the data is little endian, the expected value is what DecodeSample returns */
+	struct WaveSpec
+	{
+		const char*   Name;
+		std::uint16_t FormatTag;
+		std::uint16_t BitsPerSample;
+		bool          IsExtensible;
+	};
+
+	const WaveSpec g_specs[] =
+	{
+		{ "pcm8"           , WAV_FORMAT_PCM       , 8 , false },
+		{ "pcm16"          , WAV_FORMAT_PCM       , 16, false },
+		{ "pcm24"          , WAV_FORMAT_PCM       , 24, false },
+		{ "pcm32"          , WAV_FORMAT_PCM       , 32, false },
+		{ "float32"        , WAV_FORMAT_IEEE_FLOAT, 32, false },
+		{ "float64"        , WAV_FORMAT_IEEE_FLOAT, 64, false },
+		{ "extensible pcm24", WAV_FORMAT_PCM      , 24, true  },
+		{ "extensible float", WAV_FORMAT_IEEE_FLOAT, 32, true },
+	};
+
+	struct WaveData
+	{
+		std::vector<std::uint8_t> Bytes;    // data chunk body
+		std::vector<float>        Expected; // interleaved
+	};
+
+	void PutLE(std::vector<std::uint8_t>& out, std::uint64_t value, int byteCount)
+	{
+		for (int i = 0; i < byteCount; ++i) { out.push_back(static_cast<std::uint8_t>(value >> (8 * i))); }
+	}
+
+	WaveData MakeSamples(const WaveSpec& spec, size_t sampleCount, test::Random& random)
+	{
+		WaveData data;
+		for (size_t i = 0; i < sampleCount; ++i)
+		{
+			if (spec.FormatTag == WAV_FORMAT_IEEE_FLOAT)
+			{
+				const float value = random.Float(-1.0f, 1.0f);
+				if (spec.BitsPerSample == 32)
+				{
+					std::uint32_t bits; std::memcpy(&bits, &value, sizeof(bits));
+					PutLE(data.Bytes, bits, 4);
+					data.Expected.push_back(value);
+				}
+				else
+				{
+					const double wide = static_cast<double>(value) + 1.0e-12;
+					std::uint64_t bits; std::memcpy(&bits, &wide, sizeof(bits));
+					PutLE(data.Bytes, bits, 8);
+					data.Expected.push_back(static_cast<float>(wide));
+				}
+				continue;
+			}
+
+			switch (spec.BitsPerSample)
+			{
+				case 8:
+				{
+					const std::uint32_t value = random.Range(256);
+					PutLE(data.Bytes, value, 1);
+					data.Expected.push_back((static_cast<float>(value) - 128.0f) * (1.0f / 128.0f));
+					break;
+				}
+				case 16:
+				{
+					const std::int16_t value = static_cast<std::int16_t>(random.Range(65536) - 32768);
+					PutLE(data.Bytes, static_cast<std::uint16_t>(value), 2);
+					data.Expected.push_back(static_cast<float>(value) * (1.0f / 32768.0f));
+					break;
+				}
+				case 24:
+				{
+					const std::int32_t value = static_cast<std::int32_t>(random.Range(1u << 24)) - (1 << 23);
+					PutLE(data.Bytes, static_cast<std::uint32_t>(value), 3);
+					data.Expected.push_back(static_cast<float>(value) * (1.0f / 8388608.0f));
+					break;
+				}
+				default:
+				{
+					const std::int32_t value = static_cast<std::int32_t>(random.Next());
+					PutLE(data.Bytes, static_cast<std::uint32_t>(value), 4);
+					data.Expected.push_back(static_cast<float>(static_cast<double>(value) * (1.0 / 2147483648.0)));
+					break;
+				}
+			}
+		}
+		return data;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   RIFF writer : fmt (16 or 40 bytes), an odd sized LIST chunk (word alignment),
+	-   then data. declaredDataSize != 0 writes a broken data chunk size.
+	---------------------------------------------------------------------------*/
+	std::wstring WriteWave(const char* fileName, const WaveSpec& spec, std::uint16_t channels, const std::vector<std::uint8_t>& body, std::uint32_t declaredDataSize = 0)
+	{
+		const std::uint16_t blockAlign = static_cast<std::uint16_t>(channels * spec.BitsPerSample / 8);
+		std::vector<std::uint8_t> file;
+		file.insert(file.end(), { 'R', 'I', 'F', 'F' }); PutLE(file, 0, 4); file.insert(file.end(), { 'W', 'A', 'V', 'E' });
+
+		file.insert(file.end(), { 'f', 'm', 't', ' ' }); PutLE(file, spec.IsExtensible ? 40 : 16, 4);
+		PutLE(file, spec.IsExtensible ? WAV_FORMAT_EXTENSIBLE : spec.FormatTag, 2);
+		PutLE(file, channels, 2);
+		PutLE(file, 48000, 4);
+		PutLE(file, 48000u * blockAlign, 4);
+		PutLE(file, blockAlign, 2);
+		PutLE(file, spec.BitsPerSample, 2);
+		if (spec.IsExtensible)
+		{
+			PutLE(file, 22, 2);                 // cbSize
+			PutLE(file, spec.BitsPerSample, 2); // valid bits
+			PutLE(file, 0x3, 4);                // front left / right
+			PutLE(file, spec.FormatTag, 2);     // sub format GUID (the rest is the fixed KSDATAFORMAT suffix)
+			file.insert(file.end(), { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 });
+		}
+
+		file.insert(file.end(), { 'L', 'I', 'S', 'T' }); PutLE(file, 3, 4); file.insert(file.end(), { 'a', 'b', 'c', 0 });
+
+		file.insert(file.end(), { 'd', 'a', 't', 'a' }); PutLE(file, declaredDataSize != 0 ? declaredDataSize : body.size(), 4);
+		file.insert(file.end(), body.begin(), body.end());
+		const std::uint32_t riffSize = static_cast<std::uint32_t>(file.size() - 8);
+		for (int i = 0; i < 4; ++i) { file[4 + i] = static_cast<std::uint8_t>(riffSize >> (8 * i)); }
+
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / (std::string("MainGameWavDecoderTest_") + fileName + ".wav");
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+		return path.wstring();
+	}
+
+	int CountMismatch(const float* actual, const float* expected, size_t count)
+	{
+		int failed = 0;
+		for (size_t i = 0; i < count; ++i) { if (actual[i] != expected[i]) { failed++; } }
+		return failed;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Every format : header, LoadFromFile, ReadFramesAsFloat (across the decode buffer) and SeekFrame
+	---------------------------------------------------------------------------*/
+	void CheckFormats()
+	{
+		test::Random random(37);
+		const std::uint16_t channels   = 2;
+		const size_t        frameCount = 3001; // more than the internal decode buffer (1024 frames)
+
+		for (const WaveSpec& spec : g_specs)
+		{
+			const WaveData     data = MakeSamples(spec, frameCount * channels, random);
+			const std::wstring path = WriteWave("format", spec, channels, data.Bytes);
+
+			WavDecoder decoder;
+			TEST_CHECK_MESSAGE(decoder.OpenStream(path), "%s : open", spec.Name);
+			const WavFormat& format = decoder.GetFormat();
+			TEST_CHECK_MESSAGE(format.FormatTag == spec.FormatTag && format.BitsPerSample == spec.BitsPerSample &&
+				format.Channels == channels && format.SamplesPerSecond == 48000 && format.IsExtensible == spec.IsExtensible, "%s : format", spec.Name);
+			TEST_CHECK_MESSAGE(decoder.GetFrameCount() == frameCount && decoder.GetWaveSize() == data.Bytes.size(), "%s : size", spec.Name);
+
+			std::vector<float> samples(frameCount * channels);
+			TEST_CHECK_MESSAGE(decoder.ReadFramesAsFloat(samples.data(), frameCount + 10) == frameCount && decoder.IsEndOfStream(), "%s : read", spec.Name);
+			TEST_CHECK_MESSAGE(CountMismatch(samples.data(), data.Expected.data(), samples.size()) == 0, "%s : decoded values", spec.Name);
+
+			const size_t seekFrame = 1500;
+			TEST_CHECK(decoder.SeekFrame(seekFrame) && decoder.GetCurrentFrame() == seekFrame);
+			std::vector<float> part(10 * channels);
+			TEST_CHECK(decoder.ReadFramesAsFloat(part.data(), 10) == 10);
+			TEST_CHECK_MESSAGE(CountMismatch(part.data(), data.Expected.data() + seekFrame * channels, part.size()) == 0, "%s : seek", spec.Name);
+			TEST_CHECK(decoder.SeekFrame(frameCount * 2) && decoder.IsEndOfStream());
+			decoder.Close();
+
+			/*-------------------------------------------------------------------
+			-     LoadFromFile : raw bytes, 64bit float is converted to 32bit
+			---------------------------------------------------------------------*/
+			WavDecoder loader;
+			TEST_CHECK_MESSAGE(loader.LoadFromFile(path) && !loader.IsOpened(), "%s : load", spec.Name);
+			if (spec.BitsPerSample == 64)
+			{
+				TEST_CHECK(loader.GetFormat().BitsPerSample == 32 && loader.GetWaveSize() == frameCount * channels * sizeof(float));
+				TEST_CHECK(CountMismatch(reinterpret_cast<const float*>(loader.GetWaveData().get()), data.Expected.data(), data.Expected.size()) == 0);
+			}
+			else
+			{
+				TEST_CHECK(loader.GetWaveSize() == data.Bytes.size() && std::memcmp(loader.GetWaveData().get(), data.Bytes.data(), data.Bytes.size()) == 0);
+			}
+			std::filesystem::remove(path);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Broken files : a data size larger than the file, a truncated last frame,
+	-   no RIFF header, unsupported format, missing file
+	---------------------------------------------------------------------------*/
+	void CheckBrokenFiles()
+	{
+		test::Random random(370);
+		const WaveSpec& pcm16 = g_specs[1];
+		WaveData data = MakeSamples(pcm16, 200 * 2, random);
+		data.Bytes.push_back(0x12); // half of a sample : not a complete frame
+
+		const std::wstring clamped = WriteWave("clamped", pcm16, 2, data.Bytes, 0x7FFFFFF0);
+		WavDecoder decoder;
+		TEST_CHECK(decoder.LoadFromFile(clamped) && decoder.GetFrameCount() == 200 && decoder.GetWaveSize() == 200 * 4);
+		std::filesystem::remove(clamped);
+
+		const WaveSpec adpcm = { "adpcm", 0x0002, 4, false };
+		const std::wstring unsupported = WriteWave("unsupported", adpcm, 2, data.Bytes);
+		TEST_CHECK(!decoder.LoadFromFile(unsupported));
+		std::filesystem::remove(unsupported);
+
+		const std::filesystem::path notRiff = std::filesystem::temp_directory_path() / "MainGameWavDecoderTest_notriff.wav";
+		{ std::ofstream stream(notRiff, std::ios::binary); stream << "RIFX0000WAVEfmt "; }
+		TEST_CHECK(!decoder.LoadFromFile(notRiff.wstring()));
+		std::filesystem::remove(notRiff);
+
+		TEST_CHECK(!decoder.LoadFromFile(L"MainGameWavDecoderTest_missing.wav"));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   WavStream : the ring never splits a frame, loop continues from the top,
+	-   SeekTime moves to the sample frame
+	---------------------------------------------------------------------------*/
+	void CheckStream()
+	{
+		test::Random random(3700);
+		const WaveSpec& pcm24 = g_specs[2];
+		const size_t frameCount = 1000;
+		const WaveData data = MakeSamples(pcm24, frameCount * 2, random);
+		const std::wstring path = WriteWave("stream", pcm24, 2, data.Bytes);
+		const size_t blockAlign = 6;
+
+		WavStream stream;
+		TEST_CHECK(stream.Open(path, 1000, 3, false));
+		TEST_CHECK(stream.GetBufferByteSize() == 996 && stream.GetBufferCount() == 3);
+
+		std::vector<std::uint8_t> all;
+		size_t size = 0;
+		for (const std::uint8_t* buffer = stream.ReadNextBuffer(size); buffer != nullptr; buffer = stream.ReadNextBuffer(size))
+		{
+			TEST_CHECK(size % blockAlign == 0);
+			all.insert(all.end(), buffer, buffer + size);
+		}
+		TEST_CHECK(all == data.Bytes && stream.IsEndOfStream());
+
+		/* loop : 3 times of the track without a gap */
+		TEST_CHECK(stream.Open(path, 1000, 2, true));
+		all.clear();
+		while (all.size() < data.Bytes.size() * 3)
+		{
+			const std::uint8_t* buffer = stream.ReadNextBuffer(size);
+			if (buffer == nullptr) { break; }
+			all.insert(all.end(), buffer, buffer + size);
+		}
+		bool isSame = all.size() >= data.Bytes.size() * 3;
+		for (size_t i = 0; isSame && i < data.Bytes.size() * 3; ++i) { isSame = all[i] == data.Bytes[i % data.Bytes.size()]; }
+		TEST_CHECK(isSame && !stream.IsEndOfStream());
+
+		TEST_CHECK(stream.SeekTime(500.0 / 48000.0) && stream.GetDecoder().GetCurrentFrame() == 500);
+		const std::uint8_t* buffer = stream.ReadNextBuffer(size);
+		TEST_CHECK(buffer != nullptr && std::memcmp(buffer, data.Bytes.data() + 500 * blockAlign, blockAlign) == 0);
+		stream.Close();
+		std::filesystem::remove(path);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   60 seconds of 48kHz stereo 16bit (11MB) : ReadFramesAsFloat and WavStream throughput
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		test::Random random(37000);
+		const size_t frameCount = 48000 * 60;
+		const WaveData data = MakeSamples(g_specs[1], frameCount * 2, random);
+		const std::wstring path = WriteWave("bench", g_specs[1], 2, data.Bytes);
+		const int round = 3 * test::BenchScale();
+		const double megaBytes = static_cast<double>(data.Bytes.size()) / (1024.0 * 1024.0);
+
+		std::vector<float> samples(4096 * 2);
+		test::Timer timer;
+		for (int r = 0; r < round; ++r)
+		{
+			WavDecoder decoder;
+			decoder.OpenStream(path);
+			while (decoder.ReadFramesAsFloat(samples.data(), 4096) != 0) { test::DoNotOptimize(samples[0]); }
+		}
+		double ms = timer.ElapsedMs();
+		test::PrintBench("60s pcm16 stereo : ReadFramesAsFloat", ms, frameCount * round, "frame");
+		std::printf("[BENCH] 60s pcm16 stereo : ReadFramesAsFloat %.1f MB/s\n", megaBytes * round / (ms / 1000.0));
+
+		timer.Reset();
+		for (int r = 0; r < round; ++r)
+		{
+			WavStream stream;
+			stream.Open(path);
+			size_t size = 0;
+			while (stream.ReadNextBuffer(size) != nullptr) { test::DoNotOptimize(size); }
+		}
+		ms = timer.ElapsedMs();
+		test::PrintBench("60s pcm16 stereo : WavStream 64KB ring", ms, frameCount * round, "frame");
+		std::filesystem::remove(path);
+	}
+}
+
+int main()
+{
+	CheckFormats();
+	CheckBrokenFiles();
+	CheckStream();
+	Bench();
+	return TEST_RESULT();
+}
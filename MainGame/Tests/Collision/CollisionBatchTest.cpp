@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CollisionBatchTest.cpp
+///             @brief  CollisionBatch : hit masks against the scalar tests of Collision.cpp and the pairs per second of the 8 kernels (batch vs scalar)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/CollisionBatch.hpp"
+#include "GameCore/Include/Collision/Collider.hpp"
+#include "GameCore/Include/Collision/Collision.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <cstdio>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	Collider2D MakeCircle(test::Random& random, bool hasDepth)
+	{
+		Float2 center(random.Float(-50.0f, 50.0f), random.Float(-50.0f, 50.0f));
+		Collider2D collider = Collider2D::CreateCircleCollider(center, random.Float(0.5f, 6.0f));
+		collider.centerPosition.z = hasDepth ? random.Float(-8.0f, 8.0f) : 0.0f;
+		return collider;
+	}
+
+	Collider2D MakeRectangle(test::Random& random)
+	{
+		Float2 center(random.Float(-50.0f, 50.0f), random.Float(-50.0f, 50.0f));
+		return Collider2D::CreateRectangleCollider(center, random.Float(0.5f, 12.0f), random.Float(0.5f, 12.0f));
+	}
+
+	Collider3D MakeSphere(test::Random& random)
+	{
+		return Collider3D::CreateSphereCollider(Float3(random.Float(-30, 30), random.Float(-30, 30), random.Float(-30, 30)), random.Float(0.5f, 6.0f));
+	}
+
+	Collider3D MakeBox(test::Random& random)
+	{
+		Collider3D collider = Collider3D::CreateBoxCollider(Float3(random.Float(-30, 30), random.Float(-30, 30), random.Float(-30, 30)), random.Float(1, 12), random.Float(1, 12), random.Float(1, 12));
+		collider.shapeType3D = ColliderShape3D::Box;
+		return collider;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   mask of the batch == scalar test of every element (and the padding bits are 0)
+	---------------------------------------------------------------------------*/
+	template<class Collider, class Array, class Batch, class Scalar>
+	void CheckMask(const char* name, const Collider& first, const std::vector<Collider>& colliders, const Array& array, Batch batch, Scalar scalar)
+	{
+		std::vector<std::uint32_t> mask(CollisionBatch::GetHitMaskWordCount(array.Size()) + 1, 0xCDCDCDCDu);
+		batch(first, array, mask.data());
+
+		int failed = 0, hitCount = 0;
+		for (size_t i = 0; i < colliders.size(); ++i)
+		{
+			const bool expected = scalar(first, colliders[i]);
+			hitCount += expected;
+			if (CollisionBatch::IsHit(mask.data(), i) != expected && failed++ < 4)
+			{
+				std::printf("  %s : collider %zu : batch %d, scalar %d\n", name, i, !expected, expected);
+			}
+		}
+		const size_t lastWord = mask.size() - 2;
+		const bool   isPaddingClear = colliders.size() % 32 == 0 || (mask[lastWord] >> (colliders.size() % 32)) == 0;
+		TEST_CHECK_MESSAGE(failed == 0 && isPaddingClear, "%s : %d mismatch(es)", name, failed);
+		TEST_CHECK_MESSAGE(mask.back() == 0xCDCDCDCDu, "%s : wrote past the mask", name);
+		(void)hitCount;
+	}
+
+	void CheckAgainstScalar()
+	{
+		test::Random random(26);
+		for (int round = 0; round < 64; ++round)
+		{
+			const size_t count = 1 + random.Range(300);
+
+			std::vector<Collider2D> circles, rectangles;
+			std::vector<Collider3D> spheres, boxes;
+			CircleColliderArray circleArray; RectangleColliderArray rectangleArray;
+			SphereColliderArray sphereArray; AABBColliderArray      boxArray;
+			for (size_t i = 0; i < count; ++i)
+			{
+				/*--- half of the rounds give the circles a z (Collider2D keeps a 3D center) ---*/
+				circles   .push_back(MakeCircle(random, round % 2 == 1)); circleArray   .Add(circles.back());
+				rectangles.push_back(MakeRectangle(random));               rectangleArray.Add(rectangles.back());
+				spheres   .push_back(MakeSphere(random));                  sphereArray   .Add(spheres.back());
+				boxes     .push_back(MakeBox(random));                     boxArray      .Add(boxes.back());
+			}
+			TEST_CHECK(circleArray.Size() == count && circleArray.CenterZ.size() % COLLISION_BATCH_LANE_COUNT == 0);
+
+			const Collider2D circle    = MakeCircle(random, round % 2 == 1);
+			const Collider2D rectangle = MakeRectangle(random);
+			const Collider3D sphere    = MakeSphere(random);
+			const Collider3D box       = MakeBox(random);
+
+			CheckMask("CircleVsCircles",       circle,    circles,    circleArray,    CollisionBatch::CircleVsCircles,       Collision::OnCollision2D);
+			CheckMask("CircleVsRectangles",    circle,    rectangles, rectangleArray, CollisionBatch::CircleVsRectangles,    Collision::OnCollision2D);
+			CheckMask("RectangleVsCircles",    rectangle, circles,    circleArray,    CollisionBatch::RectangleVsCircles,    Collision::OnCollision2D);
+			CheckMask("RectangleVsRectangles", rectangle, rectangles, rectangleArray, CollisionBatch::RectangleVsRectangles, Collision::OnCollision2D);
+			CheckMask("SphereVsSpheres", sphere, spheres, sphereArray, CollisionBatch::SphereVsSpheres, Collision::OnCollision3D);
+			CheckMask("SphereVsAABBs",   sphere, boxes,   boxArray,    CollisionBatch::SphereVsAABBs,   Collision::OnCollision3D);
+			CheckMask("AABBVsSpheres",   box,    spheres, sphereArray, CollisionBatch::AABBVsSpheres,   Collision::OnCollision3D);
+			CheckMask("AABBVsAABBs",     box,    boxes,   boxArray,    CollisionBatch::AABBVsAABBs,     Collision::OnCollision3D);
+		}
+
+		/*--- the same x, y but far apart in z must not hit ---*/
+		CircleColliderArray array;
+		array.Add(0.0f, 0.0f, 100.0f, 1.0f);
+		array.Add(0.0f, 0.0f, 1.0f);
+		Float2 origin(0.0f, 0.0f);
+		const Collider2D circle = Collider2D::CreateCircleCollider(origin, 1.0f);
+		std::uint32_t mask = 0;
+		CollisionBatch::CircleVsCircles(circle, array, &mask);
+		TEST_CHECK(mask == 0x2u);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   pairs per second of one kernel : the scalar test over the colliders, then the batch
+	---------------------------------------------------------------------------*/
+	template<class Collider, class Array, class Batch, class Scalar>
+	void BenchKernel(const char* name, const Collider& first, const std::vector<Collider>& colliders, const Array& array, Batch batch, Scalar scalar)
+	{
+		const size_t count = colliders.size();
+		const int    loop  = 20 * test::BenchScale();
+		std::vector<std::uint32_t> mask(CollisionBatch::GetHitMaskWordCount(count));
+		std::vector<std::uint8_t>  hits(count);
+		char label[64];
+
+		test::Timer timer;
+		for (int l = 0; l < loop; ++l) { for (size_t i = 0; i < count; ++i) { hits[i] = scalar(first, colliders[i]); } test::DoNotOptimize(hits[0]); }
+		std::snprintf(label, sizeof(label), "%s : scalar", name);
+		test::PrintThroughput(label, timer.ElapsedMs(), count * loop, "pair");
+
+		timer.Reset();
+		for (int l = 0; l < loop; ++l) { batch(first, array, mask.data()); test::DoNotOptimize(mask[0]); }
+		std::snprintf(label, sizeof(label), "%s : batch", name);
+		test::PrintThroughput(label, timer.ElapsedMs(), count * loop, "pair");
+	}
+
+	void Bench()
+	{
+		const size_t count = 100000;
+		test::Random random(260);
+		std::vector<Collider2D> circles, rectangles;
+		std::vector<Collider3D> spheres, boxes;
+		CircleColliderArray circleArray; RectangleColliderArray rectangleArray;
+		SphereColliderArray sphereArray; AABBColliderArray      boxArray;
+		circleArray.Reserve(count); rectangleArray.Reserve(count); sphereArray.Reserve(count); boxArray.Reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			circles   .push_back(MakeCircle(random, true)); circleArray   .Add(circles.back());
+			rectangles.push_back(MakeRectangle(random));     rectangleArray.Add(rectangles.back());
+			spheres   .push_back(MakeSphere(random));        sphereArray   .Add(spheres.back());
+			boxes     .push_back(MakeBox(random));           boxArray      .Add(boxes.back());
+		}
+		const Collider2D circle    = MakeCircle(random, true);
+		const Collider2D rectangle = MakeRectangle(random);
+		const Collider3D sphere    = MakeSphere(random);
+		const Collider3D box       = MakeBox(random);
+
+		BenchKernel("circle vs 100k circles",        circle,    circles,    circleArray,    CollisionBatch::CircleVsCircles,       Collision::OnCollision2D);
+		BenchKernel("circle vs 100k rectangles",     circle,    rectangles, rectangleArray, CollisionBatch::CircleVsRectangles,    Collision::OnCollision2D);
+		BenchKernel("rectangle vs 100k circles",     rectangle, circles,    circleArray,    CollisionBatch::RectangleVsCircles,    Collision::OnCollision2D);
+		BenchKernel("rectangle vs 100k rectangles",  rectangle, rectangles, rectangleArray, CollisionBatch::RectangleVsRectangles, Collision::OnCollision2D);
+		BenchKernel("sphere vs 100k spheres", sphere, spheres, sphereArray, CollisionBatch::SphereVsSpheres, Collision::OnCollision3D);
+		BenchKernel("sphere vs 100k AABBs",   sphere, boxes,   boxArray,    CollisionBatch::SphereVsAABBs,   Collision::OnCollision3D);
+		BenchKernel("AABB vs 100k spheres",   box,    spheres, sphereArray, CollisionBatch::AABBVsSpheres,   Collision::OnCollision3D);
+		BenchKernel("AABB vs 100k AABBs",     box,    boxes,   boxArray,    CollisionBatch::AABBVsAABBs,     Collision::OnCollision3D);
+	}
+}
+
+int main()
+{
+	CheckAgainstScalar();
+	Bench();
+	return TEST_RESULT();
+}
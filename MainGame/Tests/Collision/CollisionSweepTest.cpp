@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CollisionSweepTest.cpp
+///             @brief  Collision::OnSweepCollision2D / GetSweptBounds2D : tunneling, time of impact,
+///                     start overlap, grazing and parallel motion, no displacement == OnCollision2D,
+///                     sub-stepped reference and the swept bounds
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/Collision.hpp"
+#include "GameCore/Include/Collision/Collider.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <cmath>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	Collider2D Circle(float x, float y, float radius)
+	{
+		Float2 center(x, y);
+		return Collider2D::CreateCircleCollider(center, radius);
+	}
+
+	Collider2D Rectangle(float x, float y, float width, float height)
+	{
+		Float2 center(x, y);
+		return Collider2D::CreateRectangleCollider(center, width, height);
+	}
+
+	Collider2D Moved(const Collider2D& collider, const Float2& displacement, float t)
+	{
+		Collider2D result = collider;
+		Float2 center(collider.centerPosition.x + displacement.x * t, collider.centerPosition.y + displacement.y * t);
+		result.SetCenterPosition(center);
+		return result;
+	}
+
+	float Sweep(const Collider2D& first, const Float2& displacement, const Collider2D& second)
+	{
+		float toi = -1.0f;
+		return Collision::OnSweepCollision2D(first, displacement, second, toi) ? toi : -1.0f;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A fast shape passing through a thin one in a single step : no overlap at
+	-   either end of the frame, but the sweep hits at the first contact
+	---------------------------------------------------------------------------*/
+	void CheckTunneling()
+	{
+		const Float2 displacement(20.0f, 0.0f);
+		const Collider2D wall      = Rectangle(0.0f, 0.0f, 0.1f, 4.0f);
+		const Collider2D needle    = Circle   (0.0f, 0.0f, 0.1f);
+		const Collider2D bullet    = Circle   (-10.0f, 0.0f, 0.5f);
+		const Collider2D block     = Rectangle(-10.0f, 0.0f, 1.0f, 1.0f);
+		const Collider2D smallBall = Circle   (0.0f, 0.0f, 0.2f);
+
+		TEST_CHECK(!Collision::OnCollision2D(bullet, wall) && !Collision::OnCollision2D(Moved(bullet, displacement, 1.0f), wall));
+
+		/* contact when the leading edge reaches the near side of the thin shape */
+		TEST_CHECK(std::fabs(Sweep(bullet, displacement, wall)      - (10.0f - 0.05f - 0.5f) / 20.0f) < 1e-5f);
+		TEST_CHECK(std::fabs(Sweep(bullet, displacement, needle)    - (10.0f - 0.1f  - 0.5f) / 20.0f) < 1e-5f);
+		TEST_CHECK(std::fabs(Sweep(block , displacement, wall)      - (10.0f - 0.05f - 0.5f) / 20.0f) < 1e-5f);
+		TEST_CHECK(std::fabs(Sweep(block , displacement, smallBall) - (10.0f - 0.2f  - 0.5f) / 20.0f) < 1e-5f);
+
+		/* the same motion stopping short of the wall does not hit */
+		TEST_CHECK(Sweep(bullet, Float2(9.0f, 0.0f), wall) < 0.0f);
+		TEST_CHECK(Sweep(block , Float2(9.0f, 0.0f), smallBall) < 0.0f);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Shapes overlapping at the start of the frame hit at 0, whatever the motion
+	---------------------------------------------------------------------------*/
+	void CheckStartOverlap()
+	{
+		const Collider2D circle    = Circle   (0.0f, 0.0f, 1.0f);
+		const Collider2D rectangle = Rectangle(0.5f, 0.0f, 2.0f, 2.0f);
+		const Collider2D other     = Circle   (1.0f, 0.5f, 1.0f);
+		const Float2 displacements[] = { Float2(5.0f, 0.0f), Float2(-5.0f, 3.0f), Float2(0.0f, 0.0f) };
+		for (const Float2& d : displacements)
+		{
+			TEST_CHECK(Sweep(circle   , d, other)     == 0.0f);
+			TEST_CHECK(Sweep(circle   , d, rectangle) == 0.0f);
+			TEST_CHECK(Sweep(rectangle, d, circle)    == 0.0f);
+			TEST_CHECK(Sweep(rectangle, d, Rectangle(1.0f, 1.0f, 1.0f, 1.0f)) == 0.0f);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Passing just over a corner (hit or miss by 1e-3) and moving parallel to an edge
+	---------------------------------------------------------------------------*/
+	void CheckGrazing()
+	{
+		const Collider2D box = Rectangle(0.0f, 0.0f, 4.0f, 4.0f); // top at y = 2, left at x = -2
+		const Float2 displacement(20.0f, 0.0f);
+
+		/*--- - circle passing over the top left corner ---*/
+		TEST_CHECK(Sweep(Circle(-10.0f, 2.5f + 1e-3f, 0.5f), displacement, box) < 0.0f);
+		{
+			const float y        = 2.5f - 1e-3f;
+			const float dx       = std::sqrt(0.5f * 0.5f - (y - 2.0f) * (y - 2.0f));
+			const float expected = (-2.0f - dx + 10.0f) / 20.0f; // the corner circle, not the expanded box
+			const float toi      = Sweep(Circle(-10.0f, y, 0.5f), displacement, box);
+			TEST_CHECK_MESSAGE(std::fabs(toi - expected) < 1e-4f, "corner toi %f, expected %f", toi, expected);
+		}
+		/*--- - rectangle passing over the corner, and the circle passing over a rectangle ---*/
+		TEST_CHECK(Sweep(Rectangle(-10.0f, 2.5f + 1e-3f, 1.0f, 1.0f), displacement, box) < 0.0f);
+		TEST_CHECK(Sweep(Rectangle(-10.0f, 2.5f + 1e-3f, 1.0f, 1.0f), displacement, Circle(0.0f, 0.0f, 2.0f)) < 0.0f);
+
+		/*--- - parallel to the top edge : touching slides along it (the scalar test counts touching), above it misses ---*/
+		const Collider2D slider = Rectangle(-10.0f, 2.5f, 1.0f, 1.0f);
+		TEST_CHECK(Collision::OnCollision2D(Moved(slider, displacement, 0.5f), box));
+		TEST_CHECK(std::fabs(Sweep(slider, displacement, box) - (10.0f - 2.5f) / 20.0f) < 1e-5f);
+		TEST_CHECK(Sweep(Rectangle(-10.0f, 2.51f, 1.0f, 1.0f), displacement, box) < 0.0f);
+		TEST_CHECK(Sweep(Circle(-10.0f, 2.51f, 0.5f), displacement, box) < 0.0f);
+
+		/*--- - parallel inside the edge band : hits at the side, not at the corner ---*/
+		TEST_CHECK(std::fabs(Sweep(Circle(-10.0f, 1.9f, 0.5f), displacement, box) - (10.0f - 2.5f) / 20.0f) < 1e-5f);
+
+		/*--- - moving away from a touching shape ---*/
+		TEST_CHECK(Sweep(Circle(-3.0f, 0.0f, 0.5f), Float2(-5.0f, 0.0f), box) < 0.0f);
+		TEST_CHECK(Sweep(Circle(0.0f, 3.5f, 0.5f), Float2(0.0f, 5.0f), Circle(0.0f, 0.0f, 2.0f)) < 0.0f);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random pairs of every shape combination
+	-   - no displacement : the same result as OnCollision2D
+	-   - any sub-step overlapping : the sweep hits no later than that step
+	---------------------------------------------------------------------------*/
+	Collider2D RandomShape(test::Random& random)
+	{
+		const float x = random.Float(-10.0f, 10.0f), y = random.Float(-10.0f, 10.0f);
+		return random.Bool() ? Circle(x, y, random.Float(0.1f, 3.0f)) : Rectangle(x, y, random.Float(0.2f, 6.0f), random.Float(0.2f, 6.0f));
+	}
+
+	void CheckAgainstDiscrete()
+	{
+		test::Random random(28);
+		int staticFailed = 0, sweepFailed = 0, hitCount = 0;
+		for (int i = 0; i < 20000; ++i)
+		{
+			const Collider2D first  = RandomShape(random);
+			const Collider2D second = RandomShape(random);
+
+			const bool expected = Collision::OnCollision2D(first, second);
+			const float toi     = Sweep(first, Float2(0.0f, 0.0f), second);
+			if (expected != (toi == 0.0f) && staticFailed++ < 4)
+			{
+				std::printf("  no displacement : shape %d vs %d, OnCollision2D %d, sweep %f\n",
+					static_cast<int>(first.shapeType2D), static_cast<int>(second.shapeType2D), expected, toi);
+			}
+
+			const Float2 displacement(random.Float(-25.0f, 25.0f), random.Float(-25.0f, 25.0f));
+			const float  sweepToi = Sweep(first, displacement, second);
+			hitCount += sweepToi >= 0.0f;
+			for (int step = 0; step <= 256; ++step)
+			{
+				const float t = step / 256.0f;
+				if (!Collision::OnCollision2D(Moved(first, displacement, t), second)) { continue; }
+				if ((sweepToi < 0.0f || sweepToi > t + 1e-4f) && sweepFailed++ < 4)
+				{
+					std::printf("  shape %d vs %d overlaps at t = %f, sweep %f\n",
+						static_cast<int>(first.shapeType2D), static_cast<int>(second.shapeType2D), t, sweepToi);
+				}
+				break;
+			}
+		}
+		TEST_CHECK_MESSAGE(staticFailed == 0 && sweepFailed == 0, "%d no displacement, %d sweep mismatch(es)", staticFailed, sweepFailed);
+		TEST_CHECK(hitCount > 1000);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   GetSweptBounds2D : the rectangle around the start and the end bounds
+	---------------------------------------------------------------------------*/
+	void CheckSweptBounds()
+	{
+		test::Random random(280);
+		for (int i = 0; i < 2000; ++i)
+		{
+			const Collider2D collider = RandomShape(random);
+			const Float2 displacement(random.Float(-25.0f, 25.0f), random.Float(-25.0f, 25.0f));
+			const Collider2D bounds   = Collision::GetSweptBounds2D(collider, displacement);
+			TEST_CHECK(bounds.shapeType2D == ColliderShape2D::Rectangle);
+
+			const float halfWidth  = collider.shapeType2D == ColliderShape2D::Circle ? collider.circle.radius : collider.rectangle.width  / 2;
+			const float halfHeight = collider.shapeType2D == ColliderShape2D::Circle ? collider.circle.radius : collider.rectangle.height / 2;
+			const float left   = bounds.centerPosition.x - bounds.rectangle.width  / 2 - 1e-4f;
+			const float right  = bounds.centerPosition.x + bounds.rectangle.width  / 2 + 1e-4f;
+			const float bottom = bounds.centerPosition.y - bounds.rectangle.height / 2 - 1e-4f;
+			const float top    = bounds.centerPosition.y + bounds.rectangle.height / 2 + 1e-4f;
+			for (float t : { 0.0f, 1.0f })
+			{
+				const float x = collider.centerPosition.x + displacement.x * t;
+				const float y = collider.centerPosition.y + displacement.y * t;
+				TEST_CHECK(x - halfWidth >= left && x + halfWidth <= right && y - halfHeight >= bottom && y + halfHeight <= top);
+			}
+			/* and no larger than that */
+			TEST_CHECK(std::fabs(bounds.rectangle.width  - (std::fabs(displacement.x) + 2 * halfWidth )) < 1e-3f);
+			TEST_CHECK(std::fabs(bounds.rectangle.height - (std::fabs(displacement.y) + 2 * halfHeight)) < 1e-3f);
+		}
+	}
+}
+
+int main()
+{
+	CheckTunneling();
+	CheckStartOverlap();
+	CheckGrazing();
+	CheckAgainstDiscrete();
+	CheckSweptBounds();
+	return TEST_RESULT();
+}
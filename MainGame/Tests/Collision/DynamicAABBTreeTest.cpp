@@ -0,0 +1,328 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DynamicAABBTreeTest.cpp
+///             @brief  DynamicAABBTree : raycast, overlap and frustum queries against brute force
+///                     over random boxes, oriented boxes and spheres (with MoveProxy churn),
+///                     rays starting inside a leaf, the balance, and the query benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Collision/DynamicAABBTree.hpp"
+#include "GameCore/Include/Collision/Collision.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/* the tree only stores the actor pointers : the index of the test collider is used as the actor */
+	GameActor* ToActor(size_t index) { return reinterpret_cast<GameActor*>(static_cast<std::uintptr_t>(index + 1) * 16); }
+	size_t     ToIndex(GameActor* actor) { return reinterpret_cast<std::uintptr_t>(actor) / 16 - 1; }
+
+	Float4 RandomRotation(test::Random& random)
+	{
+		float x = random.Float(-1, 1), y = random.Float(-1, 1), z = random.Float(-1, 1), w = random.Float(-1, 1);
+		const float length = std::sqrt(x * x + y * y + z * z + w * w);
+		if (length < 1e-3f) { return Float4(0.0f, 0.0f, 0.0f, 1.0f); }
+		return Float4(x / length, y / length, z / length, w / length);
+	}
+
+	Collider3D MakeCollider(test::Random& random, const Float3& center)
+	{
+		switch (random.Range(3))
+		{
+			case 0:  { return Collider3D::CreateBoxCollider(center, random.Float(0.5f, 8.0f), random.Float(0.5f, 8.0f), random.Float(0.5f, 8.0f)); }
+			case 1:  { return Collider3D::CreateOrientedBoxCollider(center, Float3(random.Float(0.5f, 8.0f), random.Float(0.5f, 8.0f), random.Float(0.5f, 8.0f)), RandomRotation(random)); }
+			default: { return Collider3D::CreateSphereCollider(center, random.Float(0.3f, 4.0f)); }
+		}
+	}
+
+	Float3 RandomPoint(test::Random& random, float range)
+	{
+		return Float3(random.Float(-range, range), random.Float(-range, range), random.Float(-range, range));
+	}
+
+	Float3 GetCenter(const Collider3D& collider)
+	{
+		switch (collider.shapeType3D)
+		{
+			case ColliderShape3D::Box:         { return collider.box.Center; }
+			case ColliderShape3D::OrientedBox: { return collider.orientedBox.Center; }
+			default:                           { return collider.sphere.Center; }
+		}
+	}
+
+	Collider3D Translate(const Collider3D& collider, const Float3& d)
+	{
+		Collider3D result = collider;
+		const Float3 c = GetCenter(collider);
+		const Float3 moved(c.x + d.x, c.y + d.y, c.z + d.z);
+		switch (collider.shapeType3D)
+		{
+			case ColliderShape3D::Box:         { result.box.Center         = moved; break; }
+			case ColliderShape3D::OrientedBox: { result.orientedBox.Center = moved; break; }
+			default:                           { result.sphere.Center      = moved; break; }
+		}
+		return result;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Brute force reference : every live collider with the same leaf tests
+	---------------------------------------------------------------------------*/
+	struct Scene
+	{
+		std::vector<Collider3D> Colliders;
+		std::vector<int>        ProxyIDs; // AABB_TREE_NULL_NODE : destroyed
+
+		std::vector<size_t> Overlap(const Collider3D& volume) const
+		{
+			std::vector<size_t> result;
+			for (size_t i = 0; i < Colliders.size(); ++i)
+			{
+				if (ProxyIDs[i] != AABB_TREE_NULL_NODE && Collision::OnCollision3D(volume, Colliders[i])) { result.push_back(i); }
+			}
+			return result;
+		}
+
+		/* closest hit, a collider enclosing the origin is hit at 0 (skipped with isContainingSkipped) */
+		bool Raycast(const Float3& origin, const Float3& direction, float maxDistance, bool isContainingSkipped, float& outDistance) const
+		{
+			using namespace DirectX;
+			const float length = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+			const XMVECTOR o = XMLoadFloat3(&origin);
+			const XMVECTOR d = XMVectorSet(direction.x / length, direction.y / length, direction.z / length, 0.0f);
+			bool isHit = false;
+			outDistance = maxDistance;
+			for (size_t i = 0; i < Colliders.size(); ++i)
+			{
+				if (ProxyIDs[i] == AABB_TREE_NULL_NODE) { continue; }
+				const Collider3D& c = Colliders[i];
+				float distance = 0.0f;
+				bool  hit      = false;
+				switch (c.shapeType3D)
+				{
+					case ColliderShape3D::Box:         { hit = c.box        .Intersects(o, d, distance); break; }
+					case ColliderShape3D::OrientedBox: { hit = c.orientedBox.Intersects(o, d, distance); break; }
+					default:
+					{
+						hit = c.sphere.Intersects(o, d, distance);
+						const float dx = origin.x - c.sphere.Center.x, dy = origin.y - c.sphere.Center.y, dz = origin.z - c.sphere.Center.z;
+						if (dx * dx + dy * dy + dz * dz <= c.sphere.Radius * c.sphere.Radius) { distance = 0.0f; }
+						break;
+					}
+				}
+				distance = (std::max)(distance, 0.0f);
+				if (!hit || (isContainingSkipped && distance <= 0.0f) || distance > outDistance) { continue; }
+				outDistance = distance;
+				isHit       = true;
+			}
+			return isHit;
+		}
+	};
+
+	std::vector<size_t> ToIndices(const std::vector<GameActor*>& actors)
+	{
+		std::vector<size_t> result;
+		for (GameActor* actor : actors) { result.push_back(ToIndex(actor)); }
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The three queries of the tree == brute force
+	---------------------------------------------------------------------------*/
+	void CheckQueries(const DynamicAABBTree& tree, const Scene& scene, test::Random& random, int round)
+	{
+		int overlapFailed = 0, frustumFailed = 0, rayFailed = 0;
+		std::vector<GameActor*> actors;
+		for (int q = 0; q < 40; ++q)
+		{
+			/*--- - overlap : sphere, box and plane volumes ---*/
+			Collider3D volume;
+			switch (q % 3)
+			{
+				case 0:  { volume = Collider3D::CreateSphereCollider(RandomPoint(random, 50.0f), random.Float(1.0f, 20.0f)); break; }
+				case 1:  { volume = Collider3D::CreateBoxCollider(RandomPoint(random, 50.0f), random.Float(1, 30), random.Float(1, 30), random.Float(1, 30)); break; }
+				default: { volume = Collider3D::CreatePlaneCollider(RandomPoint(random, 30.0f), Float3(random.Float(-1, 1), random.Float(-1, 1), random.Float(-1, 1) + 2.0f)); break; }
+			}
+			actors.clear();
+			tree.QueryOverlap(volume, actors);
+			overlapFailed += ToIndices(actors) != scene.Overlap(volume);
+
+			/*--- - frustum ---*/
+			const Collider3D frustum = Collider3D::CreateFrustumCollider(RandomPoint(random, 40.0f), RandomRotation(random),
+				random.Float(0.2f, 1.2f), -random.Float(0.2f, 1.2f), random.Float(0.2f, 1.0f), -random.Float(0.2f, 1.0f), random.Float(0.1f, 2.0f), random.Float(10.0f, 80.0f));
+			actors.clear();
+			tree.QueryFrustum(frustum, actors);
+			frustumFailed += ToIndices(actors) != scene.Overlap(frustum);
+
+			/*--- - ray, half of them starting inside a collider ---*/
+			Float3 origin = RandomPoint(random, 60.0f);
+			if (q % 2 == 1)
+			{
+				size_t index = random.Range(static_cast<std::uint32_t>(scene.Colliders.size()));
+				while (scene.ProxyIDs[index] == AABB_TREE_NULL_NODE) { index = (index + 1) % scene.Colliders.size(); }
+				origin = GetCenter(scene.Colliders[index]);
+			}
+			const Float3 direction = RandomPoint(random, 1.0f);
+			if (direction.x * direction.x + direction.y * direction.y + direction.z * direction.z < 1e-4f) { continue; }
+			for (int skip = 0; skip < 2; ++skip)
+			{
+				DynamicAABBTreeRaycastHit hit;
+				float expected = 0.0f;
+				const bool isExpected = scene.Raycast(origin, direction, 200.0f, skip == 1, expected);
+				const bool isHit      = tree.Raycast(origin, direction, 200.0f, hit, skip == 1);
+				if (isHit != isExpected || (isHit && (std::fabs(hit.Distance - expected) > 1e-4f || hit.Actor != tree.GetActor(hit.ProxyID))))
+				{
+					if (rayFailed++ < 4) { std::printf("  round %d ray %d : tree %d (%f), brute force %d (%f)\n", round, q, isHit, hit.Distance, isExpected, expected); }
+				}
+				if (q % 2 == 1 && skip == 0) { TEST_CHECK(isHit && hit.Distance == 0.0f); } // the collider around the origin
+			}
+		}
+		TEST_CHECK_MESSAGE(overlapFailed == 0 && frustumFailed == 0 && rayFailed == 0, "round %d : %d overlap, %d frustum, %d ray mismatch(es)",
+			round, overlapFailed, frustumFailed, rayFailed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random scene, then moves (small ones stay in the fat box, large ones reinsert
+	-   and rotate the tree), destroys and creates
+	---------------------------------------------------------------------------*/
+	void CheckAgainstBruteForce()
+	{
+		test::Random    random(27);
+		DynamicAABBTree tree;
+		Scene           scene;
+		for (size_t i = 0; i < 600; ++i)
+		{
+			scene.Colliders.push_back(MakeCollider(random, RandomPoint(random, 50.0f)));
+			scene.ProxyIDs .push_back(tree.CreateProxy(scene.Colliders.back(), ToActor(i)));
+		}
+		TEST_CHECK(tree.Validate() && tree.GetProxyCount() == 600);
+		CheckQueries(tree, scene, random, 0);
+
+		int reinsertCount = 0, keepCount = 0;
+		for (int round = 1; round <= 30; ++round)
+		{
+			for (size_t i = 0; i < scene.Colliders.size(); ++i)
+			{
+				if (scene.ProxyIDs[i] == AABB_TREE_NULL_NODE || random.Range(3) != 0) { continue; }
+				const float  step = random.Range(4) == 0 ? 15.0f : 0.03f;
+				const Float3 d    = RandomPoint(random, step);
+				scene.Colliders[i] = Translate(scene.Colliders[i], d);
+				if (tree.MoveProxy(scene.ProxyIDs[i], scene.Colliders[i], d)) { ++reinsertCount; } else { ++keepCount; }
+			}
+			for (int k = 0; k < 8; ++k)
+			{
+				const size_t index = random.Range(static_cast<std::uint32_t>(scene.Colliders.size()));
+				if (scene.ProxyIDs[index] != AABB_TREE_NULL_NODE)
+				{
+					tree.DestroyProxy(scene.ProxyIDs[index]);
+					scene.ProxyIDs[index] = AABB_TREE_NULL_NODE;
+				}
+				else
+				{
+					scene.Colliders[index] = MakeCollider(random, RandomPoint(random, 50.0f));
+					scene.ProxyIDs [index] = tree.CreateProxy(scene.Colliders[index], ToActor(index));
+				}
+			}
+			TEST_CHECK_MESSAGE(tree.Validate(), "round %d : the tree is broken", round);
+			CheckQueries(tree, scene, random, round);
+		}
+		TEST_CHECK(reinsertCount > 0 && keepCount > 0);
+
+		int liveCount = 0;
+		for (int id : scene.ProxyIDs) { liveCount += id != AABB_TREE_NULL_NODE; }
+		TEST_CHECK(tree.GetProxyCount() == liveCount);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A ray from inside a box : the box at 0, the box behind it when the containing leaves are skipped
+	---------------------------------------------------------------------------*/
+	void CheckContainingRay()
+	{
+		DynamicAABBTree tree;
+		const int stage  = tree.CreateProxy(Collider3D::CreateBoxCollider(Float3(0, 0, 0), 100, 100, 100), ToActor(0));
+		const int target = tree.CreateProxy(Collider3D::CreateSphereCollider(Float3(0, 0, 10), 1.0f), ToActor(1));
+		const int around = tree.CreateProxy(Collider3D::CreateSphereCollider(Float3(0, 0, 0), 0.5f), ToActor(2));
+		(void)stage; (void)around;
+
+		DynamicAABBTreeRaycastHit hit;
+		TEST_CHECK(tree.Raycast(Float3(0, 0, 0), Float3(0, 0, 1), 50.0f, hit) && hit.Distance == 0.0f);
+		TEST_CHECK(tree.Raycast(Float3(0, 0, 0), Float3(0, 0, 1), 50.0f, hit, true) && hit.ProxyID == target && std::fabs(hit.Distance - 9.0f) < 1e-4f);
+		TEST_CHECK(!tree.Raycast(Float3(0, 0, 0), Float3(0, 0, -1), 40.0f, hit, true));
+		TEST_CHECK(!tree.Raycast(Float3(0, 0, 0), Float3(0, 0, 1), 8.0f, hit, true)); // beyond maxDistance
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Boxes inserted in order along a line : the rotations keep the height logarithmic
+	---------------------------------------------------------------------------*/
+	void CheckBalance()
+	{
+		DynamicAABBTree tree;
+		for (int i = 0; i < 1024; ++i) { tree.CreateProxy(Collider3D::CreateBoxCollider(Float3(i * 2.0f, 0, 0), 1, 1, 1), ToActor(i)); }
+		TEST_CHECK(tree.Validate());
+		TEST_CHECK_MESSAGE(tree.GetHeight() <= 24, "height %d for 1024 sorted leaves", tree.GetHeight());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Queries against 10k colliders : the tree vs testing every collider
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int queryCount = 200 * test::BenchScale();
+		test::Random    random(270);
+		DynamicAABBTree tree;
+		Scene           scene;
+		for (size_t i = 0; i < 10000; ++i)
+		{
+			scene.Colliders.push_back(MakeCollider(random, RandomPoint(random, 200.0f)));
+			scene.ProxyIDs .push_back(tree.CreateProxy(scene.Colliders.back(), ToActor(i)));
+		}
+		std::vector<Collider3D> volumes;
+		std::vector<Float3>     origins, directions;
+		for (int q = 0; q < queryCount; ++q)
+		{
+			volumes   .push_back(Collider3D::CreateSphereCollider(RandomPoint(random, 200.0f), random.Float(2.0f, 10.0f)));
+			origins   .push_back(RandomPoint(random, 200.0f));
+			directions.push_back(Float3(random.Float(-1, 1), random.Float(-1, 1), 1.0f));
+		}
+
+		std::vector<GameActor*> actors;
+		size_t found = 0;
+		test::Timer timer;
+		for (const Collider3D& volume : volumes) { actors.clear(); tree.QueryOverlap(volume, actors); found += actors.size(); }
+		test::PrintBench("overlap (10k colliders) : tree", timer.ElapsedMs(), queryCount, "query");
+		timer.Reset();
+		for (const Collider3D& volume : volumes) { found += scene.Overlap(volume).size(); }
+		test::PrintBench("overlap (10k colliders) : brute force", timer.ElapsedMs(), queryCount, "query");
+
+		timer.Reset();
+		DynamicAABBTreeRaycastHit hit;
+		for (int q = 0; q < queryCount; ++q) { found += tree.Raycast(origins[q], directions[q], 400.0f, hit); }
+		test::PrintBench("raycast (10k colliders) : tree", timer.ElapsedMs(), queryCount, "ray");
+		timer.Reset();
+		float distance = 0.0f;
+		for (int q = 0; q < queryCount; ++q) { found += scene.Raycast(origins[q], directions[q], 400.0f, false, distance); }
+		test::PrintBench("raycast (10k colliders) : brute force", timer.ElapsedMs(), queryCount, "ray");
+		test::DoNotOptimize(found);
+	}
+}
+
+int main()
+{
+	CheckContainingRay();
+	CheckBalance();
+	CheckAgainstBruteForce();
+	Bench();
+	return TEST_RESULT();
+}
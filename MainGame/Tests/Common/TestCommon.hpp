@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TestCommon.hpp
+///             @brief  Check macros, random numbers and timer of the headless tests
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEST_COMMON_HPP
+#define TEST_COMMON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------------------
+-   Every test is a small executable registered to ctest. A failed check prints the
+-   condition and the executable returns TEST_RESULT() != 0 at the end of main.
+-   Set TEST_BENCH_SCALE (environment) to run the benchmarks with more iterations.
+---------------------------------------------------------------------------*/
+namespace test
+{
+	inline int& FailureCount() { static int count = 0; return count; }
+
+	inline int Result()
+	{
+		if (FailureCount() == 0) { std::printf("[PASS]\n"); return 0; }
+		std::printf("[FAIL] %d check(s)\n", FailureCount());
+		return 1;
+	}
+
+	/* multiplier of the benchmark iterations (default 1) */
+	inline int BenchScale()
+	{
+		const char* scale = std::getenv("TEST_BENCH_SCALE");
+		const int   value = scale != nullptr ? std::atoi(scale) : 1;
+		return value > 0 ? value : 1;
+	}
+
+	/****************************************************************************
+	*				  			Random
+	*************************************************************************//**
+	*  @class     Random
+	*  @brief     Deterministic xorshift64* (the same sequence on every platform)
+	*****************************************************************************/
+	class Random
+	{
+	public:
+		explicit Random(std::uint64_t seed = 0x9E3779B97F4A7C15ull) : _state(seed != 0 ? seed : 1) {}
+
+		std::uint64_t Next()
+		{
+			_state ^= _state >> 12; _state ^= _state << 25; _state ^= _state >> 27;
+			return _state * 0x2545F4914F6CDD1Dull;
+		}
+		/* [0, range) */
+		std::uint32_t Range(std::uint32_t range) { return range == 0 ? 0 : static_cast<std::uint32_t>(Next() % range); }
+		/* [minimum, maximum) */
+		float Float(float minimum, float maximum)
+		{
+			const float t = static_cast<float>(Next() >> 40) / static_cast<float>(1ull << 24);
+			return minimum + (maximum - minimum) * t;
+		}
+		bool Bool() { return (Next() & 1) != 0; }
+
+	private:
+		std::uint64_t _state;
+	};
+
+	/****************************************************************************
+	*				  			Timer
+	*************************************************************************//**
+	*  @class     Timer
+	*  @brief     Wall clock time from the construction or the last Reset
+	*****************************************************************************/
+	class Timer
+	{
+	public:
+		Timer() { Reset(); }
+		void   Reset() { _begin = std::chrono::steady_clock::now(); }
+		double ElapsedMs() const { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _begin).count(); }
+	private:
+		std::chrono::steady_clock::time_point _begin;
+	};
+
+	/* keep the optimizer from removing a benchmark loop */
+	template<class T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink; sink = &value;
+#endif
+	}
+
+	inline void PrintBench(const char* name, double milliseconds, std::uint64_t count, const char* unit = "op")
+	{
+		std::printf("[BENCH] %-44s %10.3f ms  %10.2f ns/%s\n", name, milliseconds,
+			count > 0 ? milliseconds * 1.0e6 / static_cast<double>(count) : 0.0, unit);
+	}
+
+	/* the same line as PrintBench but as a throughput (millions of unit per second) */
+	inline void PrintThroughput(const char* name, double milliseconds, std::uint64_t count, const char* unit = "op")
+	{
+		std::printf("[BENCH] %-44s %10.3f ms  %10.2f M%s/s\n", name, milliseconds,
+			milliseconds > 0.0 ? static_cast<double>(count) / (milliseconds * 1.0e3) : 0.0, unit);
+	}
+}
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { ++test::FailureCount(); std::printf("[CHECK] %s:%d : %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+#define TEST_CHECK_MESSAGE(condition, ...) \
+	do { if (!(condition)) { ++test::FailureCount(); std::printf("[CHECK] %s:%d : %s : ", __FILE__, __LINE__, #condition); std::printf(__VA_ARGS__); std::printf("\n"); } } while (0)
+
+#define TEST_RESULT() test::Result()
+
+#endif
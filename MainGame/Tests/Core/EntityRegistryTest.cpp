@@ -0,0 +1,334 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   EntityRegistryTest.cpp
+///             @brief  EntityRegistry : random create / destroy / add / remove against a reference model,
+///                     component lifetimes and the 100k entities benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Core/EntityRegistry.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	struct Position { float X = 0.0f, Y = 0.0f, Z = 0.0f; };
+	struct Velocity { float X = 0.0f, Y = 0.0f, Z = 0.0f; };
+	struct alignas(32) Bounds { float Radius = 0.0f; };
+
+	/* counts the live instances to check that every column constructs and destroys once */
+	struct Tracked
+	{
+		static int& LiveCount() { static int count = 0; return count; }
+		std::string Value;
+		Tracked(std::string value = std::string()) : Value(std::move(value)) { LiveCount()++; }
+		Tracked(const Tracked& other) : Value(other.Value) { LiveCount()++; }
+		Tracked(Tracked&& other) noexcept : Value(std::move(other.Value)) { LiveCount()++; }
+		Tracked& operator=(const Tracked&) = default;
+		Tracked& operator=(Tracked&&)      = default;
+		~Tracked() { LiveCount()--; }
+	};
+
+	struct ReferenceEntity
+	{
+		std::string Name, Tag;
+		bool  HasPosition = false, HasVelocity = false, HasBounds = false, HasTracked = false;
+		float PositionX = 0.0f, VelocityX = 0.0f, Radius = 0.0f;
+		std::string TrackedValue;
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Random operations compared with a std::map model, stale handles,
+	-   ForEach visits, name / tag buckets and component lifetimes
+	---------------------------------------------------------------------------*/
+	void CheckAgainstReference()
+	{
+		test::Random random(40);
+		int failed = 0;
+		{
+			EntityRegistry registry;
+			std::map<std::uint64_t, ReferenceEntity> reference; // (index << 32 | generation)
+			std::vector<Entity> alive, dead;
+			auto key = [](Entity entity) { return (static_cast<std::uint64_t>(entity.Index) << 32) | entity.Generation; };
+
+			for (int step = 0; step < 100000; ++step)
+			{
+				const std::uint32_t operation = random.Range(10);
+				if (operation < 3 || alive.empty())
+				{
+					ReferenceEntity model;
+					model.Name = random.Range(3) == 0 ? std::string() : "Entity" + std::to_string(random.Range(500));
+					model.Tag  = "Tag" + std::to_string(random.Range(8));
+					Entity entity;
+					if (random.Bool())
+					{
+						entity = registry.Create(model.Name, model.Tag);
+					}
+					else
+					{
+						model.HasPosition = model.HasTracked = true;
+						model.PositionX    = static_cast<float>(step);
+						model.TrackedValue = std::to_string(step);
+						entity = registry.CreateWith(model.Name, model.Tag, Position{ model.PositionX }, Tracked(model.TrackedValue));
+					}
+					reference[key(entity)] = model;
+					alive.push_back(entity);
+					continue;
+				}
+
+				const size_t pick   = random.Range(static_cast<std::uint32_t>(alive.size()));
+				const Entity entity = alive[pick];
+				ReferenceEntity& model = reference[key(entity)];
+				switch (operation)
+				{
+					case 3:
+						model.HasVelocity = true;
+						model.VelocityX   = random.Float(-1.0f, 1.0f);
+						registry.AddComponent<Velocity>(entity, Velocity{ model.VelocityX });
+						break;
+					case 4:
+						model.HasBounds = true;
+						model.Radius    = random.Float(0.0f, 1.0f);
+						registry.AddComponent<Bounds>(entity).Radius = model.Radius;
+						break;
+					case 5:
+						model.HasTracked   = true;
+						model.TrackedValue = "t" + std::to_string(step);
+						registry.AddComponent<Tracked>(entity, model.TrackedValue);
+						break;
+					case 6:
+					{
+						if (random.Bool()) { registry.RemoveComponent<Velocity>(entity); }
+						else               { registry.RemoveComponent<Tracked>(entity); }
+						model.HasVelocity = registry.HasComponent<Velocity>(entity);
+						model.HasTracked  = registry.HasComponent<Tracked>(entity);
+						break;
+					}
+					case 7:
+						model.Tag = "Tag" + std::to_string(random.Range(8));
+						registry.SetTag(entity, model.Tag);
+						break;
+					default:
+						if (!registry.Destroy(entity)) { failed++; }
+						reference.erase(key(entity));
+						alive[pick] = alive.back();
+						alive.pop_back();
+						dead.push_back(entity);
+						break;
+				}
+			}
+
+			/* every live entity matches its model */
+			for (const Entity entity : alive)
+			{
+				const ReferenceEntity& model = reference[key(entity)];
+				const Position* position = registry.GetComponent<Position>(entity);
+				const Velocity* velocity = registry.GetComponent<Velocity>(entity);
+				const Bounds*   bounds   = registry.GetComponent<Bounds>(entity);
+				const Tracked*  tracked  = registry.GetComponent<Tracked>(entity);
+				if (!registry.IsAlive(entity) || registry.GetName(entity) != model.Name || registry.GetTag(entity) != model.Tag) { failed++; }
+				if ((position != nullptr) != model.HasPosition || (position != nullptr && position->X != model.PositionX)) { failed++; }
+				if ((velocity != nullptr) != model.HasVelocity || (velocity != nullptr && velocity->X != model.VelocityX)) { failed++; }
+				if ((bounds   != nullptr) != model.HasBounds   || (bounds   != nullptr && bounds->Radius != model.Radius)) { failed++; }
+				if ((tracked  != nullptr) != model.HasTracked  || (tracked  != nullptr && tracked->Value != model.TrackedValue)) { failed++; }
+				if (bounds != nullptr && reinterpret_cast<std::uintptr_t>(bounds) % alignof(Bounds) != 0) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "%d entity state(s) differ", failed);
+			TEST_CHECK(registry.GetEntityCount() == alive.size());
+
+			/* destroyed handles stay stale after their index is reused */
+			int staleFailed = 0;
+			for (const Entity entity : dead)
+			{
+				if (registry.IsAlive(entity) || registry.GetComponent<Position>(entity) != nullptr || registry.Destroy(entity)) { staleFailed++; }
+			}
+			TEST_CHECK_MESSAGE(staleFailed == 0, "%d stale handle(s) accepted", staleFailed);
+
+			/* ForEach visits exactly the entities with all of the components */
+			size_t expected = 0, visited = 0;
+			for (const auto& [id, model] : reference) { expected += model.HasPosition && model.HasVelocity; }
+			registry.ForEach<Position, Velocity>([&](Entity entity, Position& position, Velocity& velocity)
+			{
+				const ReferenceEntity& model = reference[key(entity)];
+				if (position.X != model.PositionX || velocity.X != model.VelocityX) { failed++; }
+				visited++;
+			});
+			TEST_CHECK_MESSAGE(visited == expected && failed == 0, "ForEach : %zu / %zu", visited, expected);
+
+			/* tag buckets and name lookup */
+			for (int t = 0; t < 8; ++t)
+			{
+				const std::string tag = "Tag" + std::to_string(t);
+				size_t tagCount = 0;
+				for (const auto& [id, model] : reference) { tagCount += model.Tag == tag; }
+				const std::vector<Entity>& tagged = registry.FindAllWithTag(tag);
+				const bool allMatch = std::all_of(tagged.begin(), tagged.end(), [&](Entity entity) { return registry.GetTag(entity) == tag; });
+				TEST_CHECK_MESSAGE(tagged.size() == tagCount && allMatch, "%s : %zu / %zu", tag.c_str(), tagged.size(), tagCount);
+			}
+			for (const Entity entity : alive)
+			{
+				const std::string& name = registry.GetName(entity);
+				if (!name.empty() && registry.GetName(registry.Find(name)) != name) { failed++; }
+			}
+			TEST_CHECK(registry.Find("") .IsNull() && registry.Find("Nobody").IsNull() && failed == 0);
+
+			/* deferred destroy inside ForEach */
+			registry.ForEach<Position>([&](Entity entity, Position&) { registry.DestroyDeferred(entity); });
+			registry.FlushDestroyed();
+			size_t remaining = 0;
+			registry.ForEach<Position>([&](Entity, Position&) { remaining++; });
+			TEST_CHECK(remaining == 0);
+
+			registry.Clear();
+			TEST_CHECK(registry.GetEntityCount() == 0 && Tracked::LiveCount() == 0);
+			TEST_CHECK(registry.FindAllWithTag("Tag0").empty());
+		}
+		TEST_CHECK_MESSAGE(Tracked::LiveCount() == 0, "%d Tracked component(s) leaked", Tracked::LiveCount());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   100k entities (half with Velocity), compared with a list of objects
+	-   searched linearly (the GameObject list before the hashed index)
+	---------------------------------------------------------------------------*/
+	struct ListObject
+	{
+		std::string Name, Tag;
+		Position    Point;
+		Velocity    Speed;
+		bool        HasVelocity = false;
+	};
+
+	void Bench()
+	{
+		const int    entityCount = 100000;
+		const int    round       = test::BenchScale();
+		char label[96];
+
+		double createMs = 0.0, findMs = 0.0, tagMs = 0.0, updateMs = 0.0, destroyMs = 0.0;
+		double listCreateMs = 0.0, listFindMs = 0.0, listTagMs = 0.0, listUpdateMs = 0.0;
+		size_t sink = 0;
+		for (int r = 0; r < round; ++r)
+		{
+			/*-------------------------------------------------------------------
+			-              EntityRegistry
+			---------------------------------------------------------------------*/
+			EntityRegistry registry;
+			std::vector<Entity> entities(entityCount);
+			test::Timer timer;
+			for (int i = 0; i < entityCount; ++i)
+			{
+				const std::string name = "Enemy" + std::to_string(i);
+				const char*       tag  = i % 100 == 0 ? "Boss" : "Enemy";
+				entities[i] = i % 2 == 0 ? registry.CreateWith(name, tag, Position{ static_cast<float>(i) }, Velocity{ 1.0f })
+				                         : registry.CreateWith(name, tag, Position{ static_cast<float>(i) });
+			}
+			createMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int i = 0; i < 1000; ++i) { sink += registry.Find("Enemy" + std::to_string(i * 97)).Index; }
+			findMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int i = 0; i < 100; ++i) { sink += registry.FindAllWithTag("Boss").size(); }
+			tagMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int frame = 0; frame < 100; ++frame)
+			{
+				registry.ForEach<Position, Velocity>([](Entity, Position& position, const Velocity& velocity)
+				{
+					position.X += velocity.X * 0.016f;
+					position.Y += velocity.Y * 0.016f;
+					position.Z += velocity.Z * 0.016f;
+				});
+			}
+			updateMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int i = 0; i < entityCount; i += 10) { registry.Destroy(entities[i]); }
+			destroyMs += timer.ElapsedMs();
+			test::DoNotOptimize(registry.GetEntityCount());
+
+			/*-------------------------------------------------------------------
+			-              Object list
+			---------------------------------------------------------------------*/
+			std::vector<std::unique_ptr<ListObject>> objects;
+			timer.Reset();
+			for (int i = 0; i < entityCount; ++i)
+			{
+				auto object = std::make_unique<ListObject>();
+				object->Name        = "Enemy" + std::to_string(i);
+				object->Tag         = i % 100 == 0 ? "Boss" : "Enemy";
+				object->Point.X  = static_cast<float>(i);
+				object->HasVelocity = i % 2 == 0;
+				object->Speed.X  = 1.0f;
+				objects.push_back(std::move(object));
+			}
+			listCreateMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int i = 0; i < 1000; ++i)
+			{
+				const std::string name = "Enemy" + std::to_string(i * 97);
+				sink += std::find_if(objects.begin(), objects.end(), [&](const auto& object) { return object->Name == name; }) - objects.begin();
+			}
+			listFindMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int i = 0; i < 100; ++i)
+			{
+				std::vector<ListObject*> bosses;
+				for (const auto& object : objects) { if (object->Tag == "Boss") { bosses.push_back(object.get()); } }
+				sink += bosses.size();
+			}
+			listTagMs += timer.ElapsedMs();
+
+			timer.Reset();
+			for (int frame = 0; frame < 100; ++frame)
+			{
+				for (const auto& object : objects)
+				{
+					if (!object->HasVelocity) { continue; }
+					object->Point.X += object->Speed.X * 0.016f;
+					object->Point.Y += object->Speed.Y * 0.016f;
+					object->Point.Z += object->Speed.Z * 0.016f;
+				}
+			}
+			listUpdateMs += timer.ElapsedMs();
+			test::DoNotOptimize(objects.back()->Point.X);
+		}
+		test::DoNotOptimize(sink);
+
+		auto print = [&](const char* name, double ms, std::uint64_t count, const char* unit)
+		{
+			std::snprintf(label, sizeof(label), "100k : %s", name);
+			test::PrintBench(label, ms, count * round, unit);
+		};
+		print("EntityRegistry create (name + tag)", createMs    , entityCount, "entity");
+		print("object list    create (name + tag)", listCreateMs, entityCount, "entity");
+		print("EntityRegistry Find by name"       , findMs      , 1000, "find");
+		print("object list    Find by name"       , listFindMs  , 1000, "find");
+		print("EntityRegistry tag query"          , tagMs       , 100 , "query");
+		print("object list    tag query"          , listTagMs   , 100 , "query");
+		print("EntityRegistry position update"    , updateMs    , 100ull * entityCount / 2, "entity");
+		print("object list    position update"    , listUpdateMs, 100ull * entityCount / 2, "entity");
+		print("EntityRegistry destroy 10k"        , destroyMs   , entityCount / 10, "entity");
+	}
+}
+
+int main()
+{
+	CheckAgainstReference();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,187 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GameObjectTest.cpp
+///             @brief  GameObject : world matrices of the parent tree (UpdateWorldMatrices),
+///                     name / tag lookups and destruction through the registry
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Core/GameObject.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	Matrix4 ReferenceMatrix(const Transform& transform)
+	{
+		const Matrix4 parent = transform.GetParent() != nullptr ? ReferenceMatrix(*transform.GetParent()) : Matrix4(kIdentity);
+		return Scaling(transform.LocalScale) * RotationQuaternion(transform.LocalRotation) * Translation(transform.LocalPosition) * parent;
+	}
+
+	bool IsSame(Matrix4 a, Matrix4 b)
+	{
+		const Float4x4 fa = a.ToFloat4x4(), fb = b.ToFloat4x4();
+		return std::memcmp(&fa, &fb, sizeof(Float4x4)) == 0;
+	}
+
+	int CountMismatch(const std::vector<std::unique_ptr<GameObject>>& gameObjects)
+	{
+		int failed = 0;
+		for (const auto& gameObject : gameObjects)
+		{
+			if (gameObject != nullptr && !IsSame(gameObject->GetTransform().GetMatrix(), ReferenceMatrix(gameObject->GetTransform()))) { failed++; }
+		}
+		return failed;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   SetParent links the transforms, UpdateWorldMatrices follows moves,
+	-   re-parenting and deleted parents
+	---------------------------------------------------------------------------*/
+	void CheckWorldMatrices()
+	{
+		test::Random random(360);
+		std::vector<std::unique_ptr<GameObject>> gameObjects;
+		for (int i = 0; i < 200; ++i)
+		{
+			gameObjects.push_back(std::make_unique<GameObject>());
+			gameObjects.back()->SetPosition(random.Float(-1.0f, 1.0f), random.Float(-1.0f, 1.0f), 0.0f);
+			if (i > 0 && random.Range(4) != 0) { gameObjects.back()->SetParent(gameObjects[random.Range(i)].get()); }
+		}
+
+		GameObject::UpdateWorldMatrices();
+		TEST_CHECK(CountMismatch(gameObjects) == 0);
+		TEST_CHECK(IsSame(gameObjects[0]->GetTransform().GetMatrix(), Translation(gameObjects[0]->GetTransform().LocalPosition)));
+
+		for (int frame = 0; frame < 30; ++frame)
+		{
+			for (int i = 0; i < 20; ++i)
+			{
+				GameObject* gameObject = gameObjects[random.Range(200)].get();
+				if (gameObject != nullptr) { gameObject->SetRotation(Quaternion(0.0f, 0.0f, random.Float(-3.0f, 3.0f))); }
+			}
+			const int child = 1 + static_cast<int>(random.Range(199));
+			if (gameObjects[child] != nullptr) { gameObjects[child]->SetParent(random.Bool() ? nullptr : gameObjects[random.Range(child)].get()); }
+			if (frame % 10 == 9) { gameObjects[random.Range(200)].reset(); } // the children become roots
+
+			GameObject::UpdateWorldMatrices();
+			TEST_CHECK_MESSAGE(CountMismatch(gameObjects) == 0, "frame %d", frame);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Find / GameObjectsWithTag follow SetName / SetTag and every way of destruction
+	-   (delete through unique_ptr, DestroyImmediate, DestroyAllTagObject)
+	---------------------------------------------------------------------------*/
+	void CheckNameAndTag()
+	{
+		const size_t baseCount = GameObject::CountGameObjects();
+		std::vector<std::unique_ptr<GameObject>> owned;
+		for (int i = 0; i < 50; ++i)
+		{
+			owned.push_back(std::make_unique<GameObject>());
+			owned.back()->SetName("Enemy" + std::to_string(i));
+			owned.back()->SetTag(i % 5 == 0 ? "Boss" : "Enemy");
+		}
+		TEST_CHECK(GameObject::CountGameObjects() == baseCount + 50);
+		TEST_CHECK(GameObject::Find("Enemy7") == owned[7].get() && GameObject::Find("Enemy50") == nullptr);
+		TEST_CHECK(GameObject::GameObjectsWithTag("Boss").size() == 10 && GameObject::GameObjectsWithTag("Enemy").size() == 40);
+
+		owned[7]->SetName("Renamed");
+		owned[5]->SetTag("Enemy");
+		TEST_CHECK(GameObject::Find("Enemy7") == nullptr && GameObject::Find("Renamed") == owned[7].get());
+		TEST_CHECK(GameObject::GameObjectsWithTag("Boss").size() == 9 && GameObject::GameObjectsWithTag("Enemy").size() == 41);
+
+		/* the destructor removes the object from the list and the index */
+		owned[7].reset();
+		owned[10].reset();
+		TEST_CHECK(GameObject::Find("Renamed") == nullptr && GameObject::Find("Enemy10") == nullptr);
+		TEST_CHECK(GameObject::GameObjectsWithTag("Boss").size() == 8 && GameObject::CountGameObjects() == baseCount + 48);
+		for (int i = 0; i < 50; ++i)
+		{
+			if (owned[i] != nullptr && GameObject::Find(owned[i]->GetName()) != owned[i].get()) { TEST_CHECK_MESSAGE(false, "Enemy%d", i); }
+		}
+
+		/* DestroyImmediate / DestroyAllTagObject delete the objects themselves */
+		GameObject* single = new GameObject();
+		single->SetName("Single");
+		TEST_CHECK(GameObject::DestroyImmediate(single) && GameObject::Find("Single") == nullptr);
+		std::vector<GameObject*> loose;
+		for (int i = 0; i < 20; ++i)
+		{
+			loose.push_back(new GameObject());
+			loose.back()->SetTag("Loose");
+		}
+		GameObject::DestroyAllTagObject("Loose");
+		TEST_CHECK(GameObject::GameObjectsWithTag("Loose").empty() && GameObject::CountGameObjects() == baseCount + 48);
+
+		/* the remaining objects are deleted after the list is cleared (the owners outlive the scene) */
+		TEST_CHECK(GameObject::ClearAllGameObjects() && GameObject::CountGameObjects() == 0 && GameObject::Find("Enemy1") == nullptr);
+		owned.clear();
+		auto after = std::make_unique<GameObject>();
+		after->SetName("After");
+		TEST_CHECK(GameObject::Find("After") == after.get() && GameObject::CountGameObjects() == 1);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   10k gameObjects (100 roots * 100 children), 10% move per frame
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int frame = 200 * test::BenchScale();
+		test::Random random(3601);
+		std::vector<std::unique_ptr<GameObject>> gameObjects;
+		for (int r = 0; r < 100; ++r)
+		{
+			gameObjects.push_back(std::make_unique<GameObject>());
+			GameObject* root = gameObjects.back().get();
+			for (int c = 0; c < 100; ++c)
+			{
+				gameObjects.push_back(std::make_unique<GameObject>());
+				gameObjects.back()->SetParent(root);
+			}
+		}
+
+		Matrix4 sink;
+		double getMatrixMs = 0.0, updateMs = 0.0;
+		test::Timer timer;
+		for (int f = 0; f < frame; ++f)
+		{
+			for (size_t i = 0; i < gameObjects.size() / 10; ++i)
+			{
+				gameObjects[random.Range(static_cast<std::uint32_t>(gameObjects.size()))]->SetPosition(random.Float(-1.0f, 1.0f), 0.0f, 0.0f);
+			}
+			timer.Reset();
+			if (f % 2 == 0)
+			{
+				for (const auto& gameObject : gameObjects) { sink = gameObject->GetTransform().GetMatrix(); test::DoNotOptimize(sink); }
+				getMatrixMs += timer.ElapsedMs();
+			}
+			else
+			{
+				GameObject::UpdateWorldMatrices();
+				updateMs += timer.ElapsedMs();
+			}
+		}
+		test::PrintBench("10k gameObjects : GetMatrix each", getMatrixMs, gameObjects.size() * (frame / 2), "object");
+		test::PrintBench("10k gameObjects : UpdateWorldMatrices", updateMs, gameObjects.size() * (frame / 2), "object");
+	}
+}
+
+int main()
+{
+	CheckWorldMatrices();
+	CheckNameAndTag();
+	Bench();
+	return TEST_RESULT();
+}
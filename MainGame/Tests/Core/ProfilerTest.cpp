@@ -0,0 +1,437 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   ProfilerTest.cpp
+///             @brief  Profiler : call path tree and depth first statistics, min / avg / max over the
+///                     wrapped history, dropped events, buffer reuse of short lived threads while
+///                     EndFrame runs, and the Chrome trace read back by JsonDocument
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Profiler.hpp"
+#include "GameCore/Include/File/JsonDocument.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	Profiler& GetProfiler() { return Profiler::Instance(); }
+
+	void Spin(std::uint32_t count)
+	{
+		std::uint32_t x = count;
+		for (std::uint32_t i = 0; i < count; ++i) { x = x * 1664525u + 1013904223u; test::DoNotOptimize(x); }
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Depth first : every scope follows its parent, and the threads do not interleave
+	---------------------------------------------------------------------------*/
+	bool IsDepthFirst(const std::vector<ProfileStatistics>& statistics)
+	{
+		std::vector<std::uint64_t> stack;
+		std::uint32_t thread = 0;
+		for (const ProfileStatistics& scope : statistics)
+		{
+			if (scope.Thread < thread) { return false; }
+			if (scope.Thread != thread) { thread = scope.Thread; stack.clear(); }
+			if (scope.Depth > stack.size()) { return false; }
+			stack.resize(scope.Depth);
+			if (scope.ParentID != (scope.Depth == 0 ? 0 : stack.back())) { return false; }
+			stack.push_back(scope.PathID);
+		}
+		return true;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Chrome trace
+	---------------------------------------------------------------------------*/
+	std::string WriteTrace()
+	{
+		std::ostringstream stream;
+		GetProfiler().WriteChromeTrace(stream);
+		return stream.str();
+	}
+
+	std::int64_t ToNanoseconds(const JsonNode* microseconds)
+	{
+		return microseconds != nullptr ? std::llround(microseconds->GetNumber(-1.0) * 1000.0) : -1;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   PathID / ParentID tree of nested scopes, the same marker under two parents,
+	-   another thread, and PROFILER_MAX_DEPTH
+	---------------------------------------------------------------------------*/
+	void Recurse(int depth)
+	{
+		PROFILE_SCOPE("Recurse");
+		if (depth > 1) { Recurse(depth - 1); }
+	}
+
+	void RecordFrame()
+	{
+		PROFILE_SCOPE("Frame");
+		{
+			PROFILE_SCOPE("Update");
+			{ PROFILE_SCOPE("Physics");   Spin(200); }
+			{ PROFILE_SCOPE("Physics");   Spin(200); } // the same line twice : one path, two calls
+			{ PROFILE_SCOPE("Animation"); Spin(100); }
+		}
+		{
+			PROFILE_SCOPE("Render");
+			{ PROFILE_SCOPE("Physics"); Spin(100); }
+		}
+	}
+
+	void CheckTree()
+	{
+		GetProfiler().Reset();
+		for (int frame = 0; frame < 4; ++frame)
+		{
+			RecordFrame();
+			std::thread([] { PROFILE_SCOPE("Frame"); { PROFILE_SCOPE("Update"); } }).join();
+			GetProfiler().EndFrame();
+		}
+		Recurse(PROFILER_MAX_DEPTH + 8);
+		GetProfiler().EndFrame();
+
+		const std::vector<ProfileStatistics> statistics = GetProfiler().GetStatistics();
+		TEST_CHECK(IsDepthFirst(statistics));
+
+		/* the main thread : the tree in the order of the first event, then the recursion */
+		const char*         names [] = { "Frame", "Update", "Physics", "Animation", "Render", "Physics" };
+		const std::uint32_t depths[] = { 0, 1, 2, 2, 1, 2 };
+		const double        calls [] = { 1, 1, 2, 1, 1, 1 };
+		TEST_CHECK(statistics.size() == 6 + PROFILER_MAX_DEPTH + 2);
+		if (statistics.size() != 6 + PROFILER_MAX_DEPTH + 2) { return; }
+		for (int i = 0; i < 6; ++i)
+		{
+			const ProfileStatistics& scope = statistics[i];
+			TEST_CHECK_MESSAGE(scope.Name == names[i] && scope.Depth == depths[i], "%d : %s depth %u", i, scope.Name.c_str(), scope.Depth);
+			TEST_CHECK(scope.Thread == statistics[0].Thread && scope.FrameCount == 4 && scope.AverageCalls == calls[i]);
+			TEST_CHECK(scope.MinMs > 0.0 && scope.MinMs <= scope.AverageMs && scope.AverageMs <= scope.MaxMs);
+		}
+		TEST_CHECK(statistics[2].PathID != statistics[5].PathID);                 // Physics under Update and under Render
+		TEST_CHECK(statistics[1].ParentID == statistics[0].PathID && statistics[4].ParentID == statistics[0].PathID);
+		TEST_CHECK(statistics[0].AverageMs >= statistics[1].AverageMs + statistics[4].AverageMs);
+
+		/* deeper scopes than PROFILER_MAX_DEPTH are not recorded */
+		for (int i = 0; i < PROFILER_MAX_DEPTH; ++i)
+		{
+			const ProfileStatistics& scope = statistics[6 + i];
+			TEST_CHECK(scope.Name == "Recurse" && scope.Depth == static_cast<std::uint32_t>(i) && scope.FrameCount == 1 && scope.AverageCalls == 1.0);
+		}
+
+		/* the other thread has its own paths for the same markers */
+		const ProfileStatistics& otherFrame  = statistics[6 + PROFILER_MAX_DEPTH];
+		const ProfileStatistics& otherUpdate = statistics[7 + PROFILER_MAX_DEPTH];
+		TEST_CHECK(otherFrame.Name == "Frame" && otherFrame.Thread != statistics[0].Thread && otherFrame.PathID != statistics[0].PathID);
+		TEST_CHECK(otherUpdate.ParentID == otherFrame.PathID && otherUpdate.FrameCount == 4);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Min / Average / Max of the scopes and the frames over more frames than the history.
+	-   The expected values are computed from the trace, which has the same history frames
+	-   and the event times in nanoseconds.
+	---------------------------------------------------------------------------*/
+	struct Sample
+	{
+		std::int64_t  Time  = 0;
+		std::uint32_t Calls = 0;
+	};
+
+	void CheckHistory()
+	{
+		const int frameCount = 2 * PROFILER_HISTORY_FRAMES + 60;
+		GetProfiler().Reset();
+		for (int frame = 0; frame < frameCount; ++frame)
+		{
+			{
+				PROFILE_SCOPE("Root");
+				if (frame % 7 != 0)
+				{
+					for (int call = 0; call <= frame % 3; ++call) { PROFILE_SCOPE("Work"); Spin(50 + 37 * (frame % 11)); }
+				}
+				if (frame < 100) { PROFILE_SCOPE("Early"); } // out of the history at the end
+			}
+			GetProfiler().EndFrame();
+		}
+
+		JsonDocument      document;
+		const std::string trace = WriteTrace();
+		TEST_CHECK(document.Parse(trace));
+		const JsonNode* events = document.GetRoot().Find("traceEvents");
+		TEST_CHECK(events != nullptr && events->IsArray());
+		if (events == nullptr || !events->IsArray()) { return; }
+
+		/*-------------------------------------------------------------------
+		-               Per frame time of each marker from the trace
+		---------------------------------------------------------------------*/
+		std::vector<std::int64_t>                  frameTimes;
+		std::vector<std::map<std::string, Sample>> frameSamples;
+		for (std::uint32_t i = 0; i < events->Size(); ++i)
+		{
+			const JsonNode& event = (*events)[i];
+			const JsonNode* phase = event.Find("ph");
+			if (phase == nullptr || phase->GetStringView() != "X") { continue; }
+
+			const std::string  name     = event.Find("name")->GetString();
+			const std::int64_t duration = ToNanoseconds(event.Find("dur"));
+			if (event.Find("cat")->GetStringView() == "frame")
+			{
+				TEST_CHECK(name == "Frame " + std::to_string(frameCount - PROFILER_HISTORY_FRAMES + frameTimes.size()));
+				frameTimes.push_back(duration);
+				frameSamples.emplace_back();
+			}
+			else if (!frameSamples.empty())
+			{
+				Sample& sample = frameSamples.back()[name];
+				sample.Time += duration;
+				sample.Calls++;
+			}
+		}
+		TEST_CHECK(frameTimes.size() == PROFILER_HISTORY_FRAMES);
+
+		/*-------------------------------------------------------------------
+		-               Frame statistics
+		---------------------------------------------------------------------*/
+		const ProfileFrameStatistics frame = GetProfiler().GetFrameStatistics();
+		std::int64_t minTime = INT64_MAX, maxTime = 0, totalTime = 0;
+		for (std::int64_t time : frameTimes) { minTime = (std::min)(minTime, time); maxTime = (std::max)(maxTime, time); totalTime += time; }
+		TEST_CHECK(frame.FrameCount == PROFILER_HISTORY_FRAMES && frame.TotalFrameCount == static_cast<std::uint64_t>(frameCount));
+		TEST_CHECK(std::fabs(frame.MinMs - minTime * 1e-6) < 1e-9 && std::fabs(frame.MaxMs - maxTime * 1e-6) < 1e-9);
+		TEST_CHECK(std::fabs(frame.AverageMs - totalTime * 1e-6 / PROFILER_HISTORY_FRAMES) < 1e-9);
+		TEST_CHECK(std::fabs(frame.LastMs - frameTimes.back() * 1e-6) < 1e-9);
+
+		/*-------------------------------------------------------------------
+		-               Scope statistics
+		---------------------------------------------------------------------*/
+		const std::vector<ProfileStatistics> statistics = GetProfiler().GetStatistics();
+		TEST_CHECK(statistics.size() == 3 && IsDepthFirst(statistics));
+		if (statistics.size() != 3) { return; }
+		for (const ProfileStatistics& scope : statistics)
+		{
+			std::int64_t  minScope = INT64_MAX, maxScope = 0, totalScope = 0;
+			std::uint64_t calls = 0;
+			std::uint32_t count = 0;
+			for (auto& samples : frameSamples)
+			{
+				const auto found = samples.find(scope.Name);
+				if (found == samples.end()) { continue; }
+				minScope    = (std::min)(minScope, found->second.Time);
+				maxScope    = (std::max)(maxScope, found->second.Time);
+				totalScope += found->second.Time;
+				calls      += found->second.Calls;
+				count++;
+			}
+			TEST_CHECK_MESSAGE(scope.FrameCount == count, "%s : %u frames, expected %u", scope.Name.c_str(), scope.FrameCount, count);
+			if (count == 0)
+			{
+				TEST_CHECK(scope.Name == "Early" && scope.MinMs == 0.0 && scope.MaxMs == 0.0 && scope.AverageMs == 0.0);
+				continue;
+			}
+			TEST_CHECK_MESSAGE(std::fabs(scope.MinMs - minScope * 1e-6) < 1e-9 && std::fabs(scope.MaxMs - maxScope * 1e-6) < 1e-9,
+				"%s : min %f max %f, expected %f %f", scope.Name.c_str(), scope.MinMs, scope.MaxMs, minScope * 1e-6, maxScope * 1e-6);
+			TEST_CHECK(std::fabs(scope.AverageMs - totalScope * 1e-6 / count) < 1e-9);
+			TEST_CHECK(std::fabs(scope.AverageCalls - static_cast<double>(calls) / count) < 1e-12);
+		}
+		TEST_CHECK(statistics[0].Name == "Root" && statistics[0].FrameCount == PROFILER_HISTORY_FRAMES);
+		TEST_CHECK(statistics[1].Name == "Early" && statistics[2].Name == "Work"); // in the order of the first event
+		TEST_CHECK(statistics[2].MinMs < statistics[2].MaxMs);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A full buffer drops the new events until EndFrame reads it
+	---------------------------------------------------------------------------*/
+	void CheckDroppedEvents()
+	{
+		GetProfiler().Reset();
+		const std::uint64_t dropped = GetProfiler().GetFrameStatistics().DroppedEventCount;
+
+		for (int i = 0; i < PROFILER_EVENT_CAPACITY + 100; ++i) { PROFILE_SCOPE("Drop"); }
+		TEST_CHECK(GetProfiler().GetFrameStatistics().DroppedEventCount == dropped + 100);
+		GetProfiler().EndFrame();
+
+		for (int i = 0; i < PROFILER_EVENT_CAPACITY; ++i) { PROFILE_SCOPE("Drop"); }
+		GetProfiler().EndFrame();
+		TEST_CHECK(GetProfiler().GetFrameStatistics().DroppedEventCount == dropped + 100);
+
+		const std::vector<ProfileStatistics> statistics = GetProfiler().GetStatistics();
+		TEST_CHECK(statistics.size() == 1 && statistics[0].FrameCount == 2 && statistics[0].AverageCalls == PROFILER_EVENT_CAPACITY);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Waves of short lived threads while another thread runs EndFrame.
+	-   Every event arrives once, and the buffers of the exited threads are reused.
+	---------------------------------------------------------------------------*/
+	size_t CountThreadBuffers()
+	{
+		const std::string trace = WriteTrace();
+		size_t count = 0;
+		for (size_t position = trace.find("\"thread_name\""); position != std::string::npos; position = trace.find("\"thread_name\"", position + 1)) { count++; }
+		return count;
+	}
+
+	void CheckShortLivedThreads(bool isStress)
+	{
+		const int waveCount   = PROFILER_HISTORY_FRAMES / 2 - 10; // every event stays in the history
+		const int workerCount = 4;
+		const int taskCount   = isStress ? 300 : 100;
+
+		GetProfiler().Reset();
+		const size_t        bufferCount = CountThreadBuffers();
+		const std::uint64_t dropped     = GetProfiler().GetFrameStatistics().DroppedEventCount;
+
+		std::atomic<int>  requested = 0, done = 0;
+		std::atomic<bool> isStopped = false;
+		std::thread frameThread([&]
+		{
+			while (!isStopped.load(std::memory_order_acquire))
+			{
+				if (done.load(std::memory_order_relaxed) < requested.load(std::memory_order_acquire))
+				{
+					GetProfiler().EndFrame();
+					done.fetch_add(1, std::memory_order_release);
+				}
+				else { std::this_thread::yield(); }
+			}
+		});
+
+		for (int wave = 0; wave < waveCount; ++wave)
+		{
+			std::vector<std::thread> workers;
+			for (int worker = 0; worker < workerCount; ++worker)
+			{
+				workers.emplace_back([=]
+				{
+					if (worker == 0) { PROFILE_THREAD("Worker"); }
+					for (int task = 0; task < taskCount; ++task)
+					{
+						PROFILE_SCOPE("Task");
+						{ PROFILE_SCOPE("Step"); Spin(20); }
+						{ PROFILE_SCOPE("Step"); Spin(20); }
+					}
+				});
+			}
+			requested.fetch_add(1, std::memory_order_release); // reads the buffers while they are written
+			for (std::thread& worker : workers) { worker.join(); }
+			requested.fetch_add(1, std::memory_order_release); // drains and frees the buffers of the exited threads
+			while (done.load(std::memory_order_acquire) < requested.load(std::memory_order_relaxed)) { std::this_thread::yield(); }
+		}
+		isStopped.store(true, std::memory_order_release);
+		frameThread.join();
+		GetProfiler().EndFrame();
+
+		/* the frame thread and one wave of workers at most */
+		TEST_CHECK_MESSAGE(CountThreadBuffers() <= bufferCount + 1 + workerCount, "%zu buffers", CountThreadBuffers());
+		TEST_CHECK(GetProfiler().GetFrameStatistics().DroppedEventCount == dropped);
+
+		const std::vector<ProfileStatistics> statistics = GetProfiler().GetStatistics();
+		TEST_CHECK(IsDepthFirst(statistics));
+		double tasks = 0.0, steps = 0.0;
+		for (const ProfileStatistics& scope : statistics)
+		{
+			const double calls = scope.AverageCalls * scope.FrameCount;
+			if      (scope.Name == "Task") { tasks += calls; TEST_CHECK(scope.Depth == 0); }
+			else if (scope.Name == "Step") { steps += calls; TEST_CHECK(scope.Depth == 1); }
+		}
+		const double expected = static_cast<double>(waveCount) * workerCount * taskCount;
+		TEST_CHECK_MESSAGE(std::llround(tasks) == std::llround(expected) && std::llround(steps) == std::llround(2 * expected),
+			"%.0f tasks and %.0f steps, expected %.0f and %.0f", tasks, steps, expected, 2 * expected);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The trace is valid JSON, including the names which need escaping
+	---------------------------------------------------------------------------*/
+	const char* const ESCAPED_NAMES[] =
+	{
+		"Quote \"name\"", "Back\\slash\\", "Line\nFeed\tTab\r", "Control \x01\x1f", "UTF-8 \xE6\x97\xA5\xE6\x9C\xAC",
+	};
+
+	void CheckChromeTrace()
+	{
+		GetProfiler().Reset();
+		std::thread([]
+		{
+			PROFILE_THREAD("Thread \"Escape\" \\");
+			for (const char* name : ESCAPED_NAMES) { PROFILE_SCOPE(name); }
+		}).join();
+		GetProfiler().EndFrame();
+		{ PROFILE_SCOPE("Current"); } // not collected by EndFrame yet
+
+		JsonDocument      document;
+		const std::string trace = WriteTrace();
+		TEST_CHECK_MESSAGE(document.Parse(trace), "%s at %zu", document.GetErrorMessage().c_str(), document.GetErrorOffset());
+		const JsonNode* events = document.GetRoot().Find("traceEvents");
+		TEST_CHECK(events != nullptr && events->IsArray() && document.GetRoot().Find("displayTimeUnit") != nullptr);
+		if (events == nullptr || !events->IsArray()) { return; }
+
+		int found[std::size(ESCAPED_NAMES)] = {};
+		int frameCount = 0, currentCount = 0, threadNameCount = 0, invalidCount = 0;
+		for (std::uint32_t i = 0; i < events->Size(); ++i)
+		{
+			const JsonNode& event = (*events)[i];
+			const JsonNode* name  = event.Find("name");
+			const JsonNode* phase = event.Find("ph");
+			if (name == nullptr || !name->IsString() || phase == nullptr || event.Find("pid") == nullptr || event.Find("tid") == nullptr) { invalidCount++; continue; }
+			if (phase->GetStringView() == "M")
+			{
+				const JsonNode* args = event.Find("args");
+				threadNameCount += name->GetStringView() == "thread_name" && args != nullptr && args->Find("name")->GetString() == "Thread \"Escape\" \\";
+				continue;
+			}
+			if (ToNanoseconds(event.Find("ts")) < 0 || ToNanoseconds(event.Find("dur")) < 0) { invalidCount++; }
+
+			const std::string text = name->GetString();
+			frameCount   += text == "Frame 0";
+			currentCount += text == "Current";
+			for (size_t n = 0; n < std::size(ESCAPED_NAMES); ++n) { found[n] += text == ESCAPED_NAMES[n]; }
+		}
+		TEST_CHECK(invalidCount == 0 && frameCount == 1 && currentCount == 1 && threadNameCount == 1);
+		for (size_t n = 0; n < std::size(ESCAPED_NAMES); ++n) { TEST_CHECK_MESSAGE(found[n] == 1, "name %zu found %d time(s)", n, found[n]); }
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Cost of a scope (EndFrame every 4096 scopes)
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int count = 1000000 * test::BenchScale();
+		GetProfiler().Reset();
+		test::Timer timer;
+		for (int i = 0; i < count; ++i)
+		{
+			PROFILE_SCOPE("Bench");
+			if ((i & 4095) == 4095) { GetProfiler().EndFrame(); }
+		}
+		test::PrintBench("PROFILE_SCOPE + EndFrame", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "scope");
+
+		GetProfiler().SetEnabled(false);
+		timer.Reset();
+		for (int i = 0; i < count; ++i) { PROFILE_SCOPE("Bench"); }
+		test::PrintBench("PROFILE_SCOPE (disabled)", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "scope");
+		GetProfiler().SetEnabled(true);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool isStress = argc >= 2 && std::strcmp(argv[1], "stress") == 0;
+	CheckTree();
+	CheckHistory();
+	CheckDroppedEvents();
+	CheckShortLivedThreads(isStress);
+	CheckChromeTrace();
+	if (!isStress) { Bench(); }
+	return TEST_RESULT();
+}
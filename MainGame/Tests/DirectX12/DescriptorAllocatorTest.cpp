@@ -0,0 +1,344 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DescriptorAllocatorTest.cpp
+///             @brief  DescriptorAllocator : fuzz against a slot map (best fit, merge, fences,
+///                     stale handles, transient ranges, statistics) and the allocate / free benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12DescriptorAllocator.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	enum class SlotState : std::uint8_t { Free, Allocated, Pending };
+
+	struct PendingHandle
+	{
+		DescriptorHandle Handle;
+		std::uint64_t    RetireFence;
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Reference of the persistent range : one state per descriptor
+	---------------------------------------------------------------------------*/
+	struct SlotMap
+	{
+		std::vector<SlotState>   Slots;
+		std::vector<PendingHandle> Pending;
+
+		void Set(const DescriptorHandle& handle, SlotState state)
+		{
+			for (std::uint32_t i = 0; i < handle.Count; ++i) { Slots[handle.Index + i] = state; }
+		}
+		bool IsState(std::uint32_t index, std::uint32_t count, SlotState state) const
+		{
+			for (std::uint32_t i = 0; i < count; ++i) { if (Slots[index + i] != state) { return false; } }
+			return true;
+		}
+		/* best fit block : the smallest free run >= count (the lowest index on a tie). {index, length} */
+		std::pair<std::uint32_t, std::uint32_t> BestFit(std::uint32_t count) const
+		{
+			std::pair<std::uint32_t, std::uint32_t> best = { DescriptorHandle::INVALID_INDEX, 0 };
+			for (std::uint32_t i = 0; i < Slots.size();)
+			{
+				if (Slots[i] != SlotState::Free) { ++i; continue; }
+				std::uint32_t end = i;
+				while (end < Slots.size() && Slots[end] == SlotState::Free) { ++end; }
+				if (end - i >= count && (best.second == 0 || end - i < best.second)) { best = { i, end - i }; }
+				i = end;
+			}
+			return best;
+		}
+		void Release(std::uint64_t completedFence)
+		{
+			for (size_t i = 0; i < Pending.size();)
+			{
+				if (Pending[i].RetireFence > completedFence) { ++i; continue; }
+				Set(Pending[i].Handle, SlotState::Free);
+				Pending[i] = Pending.back();
+				Pending.pop_back();
+			}
+		}
+		void Check(const DescriptorAllocator& allocator) const
+		{
+			std::uint32_t allocated = 0, pending = 0, free = 0, blocks = 0, largest = 0, run = 0;
+			for (size_t i = 0; i <= Slots.size(); ++i)
+			{
+				const bool isFree = i < Slots.size() && Slots[i] == SlotState::Free;
+				if (isFree) { ++run; ++free; continue; }
+				if (run > 0) { ++blocks; largest = (std::max)(largest, run); run = 0; }
+				if (i == Slots.size()) { break; }
+				if (Slots[i] == SlotState::Allocated) { ++allocated; } else { ++pending; }
+			}
+			const DescriptorAllocator::Statistics statistics = allocator.GetStatistics();
+			TEST_CHECK(statistics.AllocatedCount   == allocated);
+			TEST_CHECK(statistics.PendingCount     == pending);
+			TEST_CHECK(statistics.FreeCount        == free);
+			TEST_CHECK(statistics.FreeBlockCount   == blocks); // neighbors are always merged
+			TEST_CHECK(statistics.LargestFreeBlock == largest);
+		}
+	};
+
+	/*---------------------------------------------------------------------------
+	-   A fresh allocator issues 0, 1, 2 ... (the legacy IssueID order)
+	---------------------------------------------------------------------------*/
+	void CheckSequential()
+	{
+		DescriptorAllocator allocator;
+		allocator.Initialize(64, 8, 2);
+		TEST_CHECK(allocator.GetTotalCount() == 80);
+		for (std::uint32_t i = 0; i < 64; ++i)
+		{
+			const DescriptorHandle handle = allocator.Allocate();
+			TEST_CHECK(handle.Index == i && handle.Count == 1 && !handle.IsTransient());
+		}
+		TEST_CHECK(!allocator.Allocate().IsValid());
+		TEST_CHECK(allocator.GetStatistics().FailedCount == 1);
+		TEST_CHECK(allocator.GetStatistics().PeakAllocatedCount == 64);
+		TEST_CHECK(!allocator.Allocate(0).IsValid());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Released ranges wait for the fence, merge, and stale handles are rejected
+	---------------------------------------------------------------------------*/
+	void CheckRelease()
+	{
+		DescriptorAllocator allocator;
+		allocator.Initialize(16);
+		const DescriptorHandle a = allocator.Allocate(4);
+		const DescriptorHandle b = allocator.Allocate(4);
+		const DescriptorHandle c = allocator.Allocate(4);
+		TEST_CHECK(a.Index == 0 && b.Index == 4 && c.Index == 8);
+
+		TEST_CHECK(allocator.Free(b, 10));
+		TEST_CHECK(!allocator.Free(b, 10));             // released twice
+		TEST_CHECK(!allocator.IsAlive(b));
+		TEST_CHECK(allocator.GetStatistics().PendingCount == 4);
+		TEST_CHECK(allocator.Allocate(4).Index == 12);  // b is not reused before the fence
+		allocator.ReleaseCompleted(9);
+		TEST_CHECK(allocator.GetStatistics().PendingCount == 4);
+		allocator.ReleaseCompleted(10);
+		TEST_CHECK(allocator.GetStatistics().PendingCount == 0);
+
+		const DescriptorHandle reused = allocator.Allocate(4);
+		TEST_CHECK(reused.Index == b.Index && reused.Generation != b.Generation);
+		TEST_CHECK(!allocator.Free(b, 0));              // stale handle of the same slot
+		TEST_CHECK(allocator.IsAlive(reused));
+
+		DescriptorHandle wrongCount = a;
+		wrongCount.Count = 2;
+		TEST_CHECK(!allocator.Free(wrongCount, 0));
+		TEST_CHECK(!allocator.Free(DescriptorHandle(), 0));
+
+		/*-------------------------------------------------------------------
+		-              a, reused, c released : one block of 12 again
+		---------------------------------------------------------------------*/
+		TEST_CHECK(allocator.Free(a, 0) && allocator.Free(c, 0) && allocator.Free(reused, 0));
+		allocator.ReleaseCompleted(0);
+		const DescriptorAllocator::Statistics statistics = allocator.GetStatistics();
+		TEST_CHECK(statistics.FreeBlockCount == 1 && statistics.LargestFreeBlock == 12 && statistics.Fragmentation == 0.0f);
+		TEST_CHECK(allocator.Allocate(12).Index == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Transient ranges : per frame, linear, reset in BeginFrame, never freed
+	---------------------------------------------------------------------------*/
+	void CheckTransient()
+	{
+		DescriptorAllocator allocator;
+		allocator.Initialize(10, 6, 3);
+		for (std::uint32_t frame = 0; frame < 7; ++frame)
+		{
+			allocator.BeginFrame(frame, frame);
+			const std::uint32_t base = 10 + (frame % 3) * 6;
+			const DescriptorHandle a = allocator.AllocateTransient(4);
+			const DescriptorHandle b = allocator.AllocateTransient(2);
+			TEST_CHECK(a.IsTransient() && a.Index == base && b.Index == base + 4);
+			TEST_CHECK(!allocator.AllocateTransient(1).IsValid());
+			TEST_CHECK(!allocator.Free(a, frame));
+			TEST_CHECK(allocator.GetStatistics().TransientUsed == 6);
+		}
+		TEST_CHECK(allocator.GetStatistics().TransientPeak == 6);
+
+		DescriptorAllocator noTransient;
+		noTransient.Initialize(4);
+		TEST_CHECK(!noTransient.AllocateTransient(1).IsValid());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random allocate / free / stale free / fence / transient operations
+	-   over many heap shapes, checked against the slot map
+	---------------------------------------------------------------------------*/
+	void CheckFuzz()
+	{
+		test::Random random(4500);
+		std::uint64_t operationCount = 0;
+		for (int shape = 0; shape < 200; ++shape)
+		{
+			const std::uint32_t persistentCount = 1 + random.Range(shape % 4 == 0 ? 4096 : 256);
+			const std::uint32_t transientCount  = random.Range(3) == 0 ? 0 : 1 + random.Range(64);
+			const std::uint32_t frameCount      = 1 + random.Range(3);
+
+			DescriptorAllocator allocator;
+			allocator.Initialize(persistentCount, transientCount, frameCount);
+			SlotMap map;
+			map.Slots.assign(persistentCount, SlotState::Free);
+			std::vector<DescriptorHandle> live;
+			std::vector<DescriptorHandle> dead;
+			std::vector<DescriptorHandle> transients;
+			std::uint64_t completedFence = 0;
+			std::uint32_t frame          = 0;
+			std::uint32_t transientUsed  = 0;
+
+			for (int operation = 0; operation < 3000; ++operation, ++operationCount)
+			{
+				const std::uint32_t type = random.Range(100);
+				if (type < 40)
+				{
+					/*-------------------------------------------------------------------
+					-              Allocate : succeeds iff a free run exists, best fit
+					---------------------------------------------------------------------*/
+					const std::uint32_t count = random.Range(10) == 0 ? 1 + random.Range(64) : 1 + random.Range(8);
+					const std::pair<std::uint32_t, std::uint32_t> best = map.BestFit(count);
+					const DescriptorHandle handle = allocator.Allocate(count);
+					if (best.second == 0)
+					{
+						TEST_CHECK_MESSAGE(!handle.IsValid(), "shape %d op %d : %u descriptors served without a free run", shape, operation, count);
+						continue;
+					}
+					TEST_CHECK_MESSAGE(handle.IsValid() && handle.Index == best.first && handle.Count == count,
+						"shape %d op %d : %u descriptors at %u, best fit %u", shape, operation, count, handle.Index, best.first);
+					if (!handle.IsValid() || !map.IsState(handle.Index, count, SlotState::Free)) { return; }
+					map.Set(handle, SlotState::Allocated);
+					live.push_back(handle);
+				}
+				else if (type < 70 && !live.empty())
+				{
+					/*-------------------------------------------------------------------
+					-              Free a live handle (retired a few frames later)
+					---------------------------------------------------------------------*/
+					const size_t index = random.Range(static_cast<std::uint32_t>(live.size()));
+					const DescriptorHandle handle = live[index];
+					const std::uint64_t retireFence = completedFence + random.Range(4);
+					TEST_CHECK(allocator.IsAlive(handle));
+					TEST_CHECK(allocator.Free(handle, retireFence));
+					map.Set(handle, SlotState::Pending);
+					map.Pending.push_back({ handle, retireFence });
+					live[index] = live.back();
+					live.pop_back();
+					dead.push_back(handle);
+				}
+				else if (type < 78 && !dead.empty())
+				{
+					/*-------------------------------------------------------------------
+					-              Free a stale handle : always rejected
+					---------------------------------------------------------------------*/
+					const DescriptorHandle handle = dead[random.Range(static_cast<std::uint32_t>(dead.size()))];
+					TEST_CHECK(!allocator.IsAlive(handle));
+					TEST_CHECK_MESSAGE(!allocator.Free(handle, completedFence), "shape %d op %d : stale handle %u released", shape, operation, handle.Index);
+				}
+				else if (type < 88)
+				{
+					/*-------------------------------------------------------------------
+					-              Next frame : the fence advances, the transient range resets
+					---------------------------------------------------------------------*/
+					completedFence += 1;
+					frame          += 1;
+					allocator.BeginFrame(frame, completedFence);
+					map.Release(completedFence);
+					transients.clear();
+					transientUsed = 0;
+				}
+				else
+				{
+					/*-------------------------------------------------------------------
+					-              Transient : linear in the range of the frame
+					---------------------------------------------------------------------*/
+					const std::uint32_t count  = 1 + random.Range(8);
+					const DescriptorHandle handle = allocator.AllocateTransient(count);
+					if (transientUsed + count > transientCount)
+					{
+						TEST_CHECK(!handle.IsValid());
+						continue;
+					}
+					const std::uint32_t base = persistentCount + (frame % frameCount) * transientCount;
+					TEST_CHECK_MESSAGE(handle.IsTransient() && handle.Index == base + transientUsed,
+						"shape %d op %d : transient at %u, expected %u", shape, operation, handle.Index, base + transientUsed);
+					TEST_CHECK(handle.Index + handle.Count <= allocator.GetTotalCount());
+					transientUsed += count;
+					transients.push_back(handle);
+				}
+
+				if (operation % 64 == 0) { map.Check(allocator); }
+			}
+			map.Check(allocator);
+			TEST_CHECK(allocator.GetStatistics().TransientUsed == transientUsed);
+
+			/*-------------------------------------------------------------------
+			-              Everything released : one free block
+			---------------------------------------------------------------------*/
+			for (const DescriptorHandle& handle : live) { TEST_CHECK(allocator.Free(handle, completedFence + 1)); }
+			allocator.ReleaseCompleted(completedFence + 4);
+			const DescriptorAllocator::Statistics statistics = allocator.GetStatistics();
+			TEST_CHECK(statistics.FreeCount == persistentCount && statistics.FreeBlockCount == 1 && statistics.PendingCount == 0);
+		}
+		TEST_CHECK(operationCount == 600000);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Views of a scene : half of a 4096 heap in use, random allocate / free pairs
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int count = 1000000 * test::BenchScale();
+		test::Random random(4501);
+		DescriptorAllocator allocator;
+		allocator.Initialize(4096, 1024, 3);
+
+		std::vector<DescriptorHandle> live;
+		while (allocator.GetStatistics().AllocatedCount < 2048) { live.push_back(allocator.Allocate(1 + random.Range(4))); }
+
+		std::uint64_t fence = 0;
+		test::Timer timer;
+		for (int i = 0; i < count; ++i)
+		{
+			const size_t index = random.Range(static_cast<std::uint32_t>(live.size()));
+			allocator.Free(live[index], fence + 2);
+			if ((i & 63) == 0) { fence++; allocator.BeginFrame(static_cast<std::uint32_t>(fence), fence); }
+			live[index] = allocator.Allocate(1 + random.Range(4));
+			if (!live[index].IsValid()) { live[index] = allocator.Allocate(1); }
+		}
+		test::DoNotOptimize(live[0]);
+		test::PrintBench("persistent free + allocate (2k of 4k used)", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "pair");
+
+		timer.Reset();
+		for (int i = 0; i < count; ++i)
+		{
+			if ((i & 1023) == 0) { fence++; allocator.BeginFrame(static_cast<std::uint32_t>(fence), fence); }
+			test::DoNotOptimize(allocator.AllocateTransient(1));
+		}
+		test::PrintBench("transient allocate", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "op");
+
+		const DescriptorAllocator::Statistics statistics = allocator.GetStatistics();
+		std::printf("        fragmentation %.3f, %u free blocks, %llu failed\n", statistics.Fragmentation, statistics.FreeBlockCount,
+			static_cast<unsigned long long>(statistics.FailedCount));
+	}
+}
+
+int main()
+{
+	CheckSequential();
+	CheckRelease();
+	CheckTransient();
+	CheckFuzz();
+	Bench();
+	return TEST_RESULT();
+}
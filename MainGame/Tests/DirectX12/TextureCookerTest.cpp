@@ -0,0 +1,638 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TextureCookerTest.cpp
+///             @brief  TextureCooker : file layout and Parse over random textures, mip filtering (linear, sRGB,
+///                     alpha weighted), BC1 / BC3 / BC7 against reference decoders, the hash, the cook cache
+///                     and the cook / cache hit benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12TextureCooker.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/*---------------------------------------------------------------------------
+	-   R8G8B8A8 source with a row pitch
+	---------------------------------------------------------------------------*/
+	struct Image
+	{
+		std::vector<std::uint8_t> Texels;
+		std::uint32_t Width    = 0;
+		std::uint32_t Height   = 0;
+		std::uint32_t RowPitch = 0;
+
+		Image(std::uint32_t width, std::uint32_t height, std::uint32_t padding = 0)
+			: Texels(static_cast<size_t>(width * 4 + padding) * height, 0xCD), Width(width), Height(height), RowPitch(width * 4 + padding) {}
+		std::uint8_t*       At(std::uint32_t x, std::uint32_t y)       { return Texels.data() + static_cast<size_t>(y) * RowPitch + x * 4; }
+		const std::uint8_t* At(std::uint32_t x, std::uint32_t y) const { return Texels.data() + static_cast<size_t>(y) * RowPitch + x * 4; }
+	};
+
+	/* bilinear interpolation of a random 5x5 grid (+ noise) : something block compression is made for */
+	Image MakeSmoothImage(std::uint32_t width, std::uint32_t height, std::uint32_t padding, bool hasAlpha, int noise, test::Random& random)
+	{
+		float grid[5][5][4];
+		for (auto& row : grid) { for (auto& texel : row) { for (int c = 0; c < 4; ++c) { texel[c] = random.Float(0.0f, 255.0f); } } }
+
+		Image image(width, height, padding);
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			for (std::uint32_t x = 0; x < width; ++x)
+			{
+				const float gx = 4.0f * x / (std::max)(width - 1, 1u), gy = 4.0f * y / (std::max)(height - 1, 1u);
+				const int   ix = (std::min)(static_cast<int>(gx), 3), iy = (std::min)(static_cast<int>(gy), 3);
+				const float fx = gx - ix, fy = gy - iy;
+				for (int c = 0; c < 4; ++c)
+				{
+					const float top    = grid[iy    ][ix][c] * (1.0f - fx) + grid[iy    ][ix + 1][c] * fx;
+					const float bottom = grid[iy + 1][ix][c] * (1.0f - fx) + grid[iy + 1][ix + 1][c] * fx;
+					const int   value  = static_cast<int>(top * (1.0f - fy) + bottom * fy) + (noise > 0 ? static_cast<int>(random.Range(2 * noise + 1)) - noise : 0);
+					image.At(x, y)[c] = static_cast<std::uint8_t>(std::clamp(value, 0, 255));
+				}
+				if (!hasAlpha) { image.At(x, y)[3] = 255; }
+			}
+		}
+		return image;
+	}
+
+	Image MakeNoiseImage(std::uint32_t width, std::uint32_t height, std::uint32_t padding, test::Random& random)
+	{
+		Image image(width, height, padding);
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			for (std::uint32_t x = 0; x < width; ++x) { for (int c = 0; c < 4; ++c) { image.At(x, y)[c] = static_cast<std::uint8_t>(random.Range(256)); } }
+		}
+		return image;
+	}
+
+	TextureCookSettings MakeSettings(TextureMipFilter filter, TextureCompression compression, bool isSRGB, bool isAlphaWeighted)
+	{
+		TextureCookSettings settings;
+		settings.Filter          = filter;
+		settings.Compression     = compression;
+		settings.IsSRGB          = isSRGB;
+		settings.IsAlphaWeighted = isAlphaWeighted;
+		return settings;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Reference block decoders (as the hardware reads the blocks)
+	---------------------------------------------------------------------------*/
+	void DecodeRGB565(std::uint16_t value, int* outColor)
+	{
+		const int r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+		outColor[0] = (r << 3) | (r >> 2);
+		outColor[1] = (g << 2) | (g >> 4);
+		outColor[2] = (b << 3) | (b >> 2);
+	}
+
+	/* isBC1 : c0 <= c1 selects three colors + transparent black */
+	void DecodeColorBlock(const std::uint8_t* block, bool isBC1, std::uint8_t outTexels[16][4])
+	{
+		const std::uint16_t color0 = static_cast<std::uint16_t>(block[0] | block[1] << 8);
+		const std::uint16_t color1 = static_cast<std::uint16_t>(block[2] | block[3] << 8);
+		int palette[4][4];
+		DecodeRGB565(color0, palette[0]);
+		DecodeRGB565(color1, palette[1]);
+		palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+		const bool isFourColor = !isBC1 || color0 > color1;
+		for (int c = 0; c < 3; ++c)
+		{
+			if (isFourColor)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+		if (!isFourColor) { palette[3][3] = 0; }
+
+		std::uint32_t bits;
+		std::memcpy(&bits, block + 4, sizeof(bits));
+		for (int i = 0; i < 16; ++i)
+		{
+			const int index = (bits >> (i * 2)) & 3;
+			for (int c = 0; c < 4; ++c) { outTexels[i][c] = static_cast<std::uint8_t>(palette[index][c]); }
+		}
+	}
+
+	void DecodeAlphaBlock(const std::uint8_t* block, std::uint8_t outTexels[16][4])
+	{
+		const int alpha0 = block[0], alpha1 = block[1];
+		int palette[8] = { alpha0, alpha1 };
+		if (alpha0 > alpha1) { for (int i = 2; i < 8; ++i) { palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7; } }
+		else
+		{
+			for (int i = 2; i < 6; ++i) { palette[i] = ((6 - i) * alpha0 + (i - 1) * alpha1) / 5; }
+			palette[6] = 0; palette[7] = 255;
+		}
+		std::uint64_t bits = 0;
+		for (int i = 0; i < 6; ++i) { bits |= static_cast<std::uint64_t>(block[2 + i]) << (i * 8); }
+		for (int i = 0; i < 16; ++i) { outTexels[i][3] = static_cast<std::uint8_t>(palette[(bits >> (i * 3)) & 7]); }
+	}
+
+	/* mode 6 only : anything else decodes to magenta so that it can not pass */
+	void DecodeBC7Block(const std::uint8_t* block, std::uint8_t outTexels[16][4])
+	{
+		std::uint64_t bits[2];
+		std::memcpy(bits, block, sizeof(bits));
+		int offset = 0;
+		const auto read = [&](int count)
+		{
+			std::uint32_t value = 0;
+			for (int i = 0; i < count; ++i, ++offset) { value |= static_cast<std::uint32_t>((bits[offset >> 6] >> (offset & 63)) & 1) << i; }
+			return static_cast<int>(value);
+		};
+		if (read(7) != 1 << 6)
+		{
+			for (int i = 0; i < 16; ++i) { outTexels[i][0] = 255; outTexels[i][1] = 0; outTexels[i][2] = 255; outTexels[i][3] = 255; }
+			return;
+		}
+		int endPoints[2][4];
+		for (int c = 0; c < 4; ++c) { endPoints[0][c] = read(7); endPoints[1][c] = read(7); }
+		const int pBit0 = read(1), pBit1 = read(1);
+		for (int c = 0; c < 4; ++c) { endPoints[0][c] = endPoints[0][c] << 1 | pBit0; endPoints[1][c] = endPoints[1][c] << 1 | pBit1; }
+
+		static const int WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		for (int i = 0; i < 16; ++i)
+		{
+			const int index = read(i == 0 ? 3 : 4);
+			for (int c = 0; c < 4; ++c)
+			{
+				outTexels[i][c] = static_cast<std::uint8_t>(((64 - WEIGHTS[index]) * endPoints[0][c] + WEIGHTS[index] * endPoints[1][c] + 32) >> 6);
+			}
+		}
+	}
+
+	/* decode a compressed mip into R8G8B8A8 */
+	std::vector<std::uint8_t> DecodeMip(const CookedTexture& texture, std::uint32_t mipIndex)
+	{
+		const CookedTextureMip&  mip    = texture.Mips[mipIndex];
+		const std::uint8_t*      blocks = texture.GetMipData(mipIndex);
+		const TextureCompression compression = texture.GetCompression();
+		std::vector<std::uint8_t> texels(static_cast<size_t>(mip.Width) * mip.Height * 4);
+		for (std::uint32_t by = 0; by < mip.RowCount; ++by)
+		{
+			for (std::uint32_t bx = 0; bx < (mip.Width + 3) / 4; ++bx)
+			{
+				const std::uint8_t* block = blocks + static_cast<size_t>(by) * mip.RowPitch + bx * (compression == TextureCompression::BC1 ? 8 : 16);
+				std::uint8_t decoded[16][4];
+				switch (compression)
+				{
+					case TextureCompression::BC1: DecodeColorBlock(block, true, decoded); break;
+					case TextureCompression::BC3: DecodeColorBlock(block + 8, false, decoded); DecodeAlphaBlock(block, decoded); break;
+					default:                      DecodeBC7Block(block, decoded); break;
+				}
+				for (std::uint32_t i = 0; i < 16; ++i)
+				{
+					const std::uint32_t x = bx * 4 + (i & 3), y = by * 4 + (i >> 2);
+					if (x < mip.Width && y < mip.Height) { std::memcpy(texels.data() + (static_cast<size_t>(y) * mip.Width + x) * 4, decoded[i], 4); }
+				}
+			}
+		}
+		return texels;
+	}
+
+	/* root mean square error of the channels [first, last) */
+	double GetRMSE(const std::uint8_t* a, const std::uint8_t* b, size_t texelCount, int first, int last)
+	{
+		double sum = 0.0;
+		for (size_t i = 0; i < texelCount; ++i)
+		{
+			for (int c = first; c < last; ++c) { const double d = static_cast<double>(a[i * 4 + c]) - b[i * 4 + c]; sum += d * d; }
+		}
+		return std::sqrt(sum / (static_cast<double>(texelCount) * (last - first)));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Layout of the file image
+	---------------------------------------------------------------------------*/
+	bool IsValidLayout(const CookedTexture& texture, const Image& image, const TextureCookSettings& settings)
+	{
+		const bool isBlockAligned = image.Width % 4 == 0 && image.Height % 4 == 0;
+		const TextureCompression compression = isBlockAligned ? settings.Compression : TextureCompression::None;
+		std::uint32_t mipCount = TextureCooker::GetFullMipCount(image.Width, image.Height);
+		if (settings.MaxMipCount != 0) { mipCount = (std::min)(mipCount, settings.MaxMipCount); }
+
+		const CookedTextureHeader& header = texture.Header;
+		if (header.Magic != COOKED_TEXTURE_MAGIC || header.Width != image.Width || header.Height != image.Height) { return false; }
+		if (header.MipCount != mipCount || texture.Mips.size() != mipCount || texture.GetCompression() != compression) { return false; }
+		if (texture.IsSRGBFormat() != settings.IsSRGBFormat) { return false; }
+		if (std::memcmp(texture.Data.data(), &header, sizeof(header)) != 0) { return false; }
+		if (std::memcmp(texture.Data.data() + sizeof(header), texture.Mips.data(), sizeof(CookedTextureMip) * mipCount) != 0) { return false; }
+
+		std::uint64_t end = sizeof(CookedTextureHeader) + sizeof(CookedTextureMip) * mipCount;
+		for (std::uint32_t i = 0; i < mipCount; ++i)
+		{
+			const CookedTextureMip& mip = texture.Mips[i];
+			const std::uint32_t width = (std::max)(image.Width >> i, 1u), height = (std::max)(image.Height >> i, 1u);
+			const std::uint32_t rowPitch = compression == TextureCompression::None ? width * 4 : (width + 3) / 4 * (compression == TextureCompression::BC1 ? 8 : 16);
+			const std::uint32_t rowCount = compression == TextureCompression::None ? height : (height + 3) / 4;
+			if (mip.Width != width || mip.Height != height || mip.RowPitch != rowPitch || mip.RowCount != rowCount) { return false; }
+			if (mip.Offset % 16 != 0 || mip.Offset < end || mip.Size != static_cast<std::uint64_t>(rowPitch) * rowCount) { return false; }
+			end = mip.Offset + mip.Size;
+		}
+		return end <= texture.Data.size() && texture.Data.size() - end < 16;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random sizes, pitches and settings : layout, mip 0, box filter bounds, Parse of good and broken images
+	---------------------------------------------------------------------------*/
+	void CheckLayout()
+	{
+		test::Random  random(4700);
+		TextureCooker cooker;
+		for (int i = 0; i < 240; ++i)
+		{
+			const bool          isBlockAligned = random.Range(2) == 0;
+			const std::uint32_t width   = isBlockAligned ? 4 * (1 + random.Range(24)) : 1 + random.Range(97);
+			const std::uint32_t height  = isBlockAligned ? 4 * (1 + random.Range(24)) : 1 + random.Range(97);
+			const Image         image   = random.Range(2) == 0 ? MakeNoiseImage(width, height, 4 * random.Range(3), random)
+				: MakeSmoothImage(width, height, 4 * random.Range(3), random.Bool(), 0, random);
+
+			TextureCookSettings settings = MakeSettings(static_cast<TextureMipFilter>(random.Range(2)), static_cast<TextureCompression>(random.Range(4)), random.Bool(), random.Bool());
+			settings.MaxMipCount  = random.Range(3) == 0 ? 1 + random.Range(4) : 0;
+			settings.IsSRGBFormat = random.Bool();
+
+			CookedTexture texture;
+			TEST_CHECK(cooker.Cook(image.Texels.data(), width, height, image.RowPitch, 0x1234 + i, settings, texture));
+			TEST_CHECK_MESSAGE(IsValidLayout(texture, image, settings), "texture %d (%ux%u) : broken layout", i, width, height);
+			if (!IsValidLayout(texture, image, settings)) { return; }
+			TEST_CHECK(texture.Header.SourceHash == static_cast<std::uint64_t>(0x1234 + i));
+
+			/*-------------------------------------------------------------------
+			-              Mip 0 is the source, the box filter is an average (within the source range)
+			---------------------------------------------------------------------*/
+			if (texture.GetCompression() == TextureCompression::None)
+			{
+				bool isSame = true;
+				for (std::uint32_t y = 0; y < height; ++y) { isSame &= std::memcmp(texture.GetMipData(0) + static_cast<size_t>(y) * width * 4, image.At(0, y), width * 4) == 0; }
+				TEST_CHECK_MESSAGE(isSame, "texture %d : mip 0 is not the source", i);
+
+				if (settings.Filter == TextureMipFilter::Box)
+				{
+					int minimum[4] = { 255, 255, 255, 255 }, maximum[4] = {};
+					bool hasTransparent = false;
+					for (std::uint32_t y = 0; y < height; ++y)
+					{
+						for (std::uint32_t x = 0; x < width; ++x)
+						{
+							const std::uint8_t* texel = image.At(x, y);
+							hasTransparent |= texel[3] == 0;
+							for (int c = 0; c < 4; ++c) { minimum[c] = (std::min)(minimum[c], static_cast<int>(texel[c])); maximum[c] = (std::max)(maximum[c], static_cast<int>(texel[c])); }
+						}
+					}
+					if (settings.IsAlphaWeighted && hasTransparent) { minimum[0] = minimum[1] = minimum[2] = 0; } // no coverage : black
+					for (std::uint32_t m = 1; m < texture.Header.MipCount; ++m)
+					{
+						const std::uint8_t* texels = texture.GetMipData(m);
+						const size_t        count  = static_cast<size_t>(texture.Mips[m].Width) * texture.Mips[m].Height * 4;
+						bool isInRange = true;
+						for (size_t k = 0; k < count; ++k) { isInRange &= texels[k] + 1 >= minimum[k & 3] && texels[k] <= maximum[k & 3] + 1; }
+						TEST_CHECK_MESSAGE(isInRange, "texture %d mip %u : box filtered texel out of the source range", i, m);
+					}
+				}
+			}
+
+			/*-------------------------------------------------------------------
+			-              Parse : the image itself, truncated and damaged images
+			---------------------------------------------------------------------*/
+			CookedTexture parsed;
+			TEST_CHECK(TextureCooker::Parse(std::vector<std::uint8_t>(texture.Data), parsed));
+			TEST_CHECK(parsed.Data == texture.Data && parsed.Mips.size() == texture.Mips.size()
+				&& std::memcmp(parsed.Mips.data(), texture.Mips.data(), sizeof(CookedTextureMip) * texture.Mips.size()) == 0);
+
+			const CookedTextureMip& last = texture.Mips.back();
+			std::vector<std::uint8_t> truncated(texture.Data.begin(), texture.Data.begin() + random.Range(static_cast<std::uint32_t>(last.Offset + last.Size)));
+			TEST_CHECK_MESSAGE(!TextureCooker::Parse(std::move(truncated), parsed), "texture %d : truncated image parsed", i);
+
+			const size_t fieldOffsets[] = { offsetof(CookedTextureHeader, Magic), offsetof(CookedTextureHeader, Version), offsetof(CookedTextureHeader, Width),
+				offsetof(CookedTextureHeader, Height), offsetof(CookedTextureHeader, Compression), sizeof(CookedTextureHeader) + offsetof(CookedTextureMip, Size) };
+			for (size_t fieldOffset : fieldOffsets)
+			{
+				std::vector<std::uint8_t> damaged = texture.Data;
+				damaged[fieldOffset + 3] ^= 0x40;
+				TEST_CHECK_MESSAGE(!TextureCooker::Parse(std::move(damaged), parsed), "texture %d : damaged byte %zu parsed", i, fieldOffset + 3);
+			}
+		}
+
+		CookedTexture texture;
+		const std::uint8_t texel[4] = {};
+		TEST_CHECK(!cooker.Cook(nullptr, 4, 4, 16, 0, TextureCookSettings(), texture));
+		TEST_CHECK(!cooker.Cook(texel, 0, 4, 16, 0, TextureCookSettings(), texture));
+		TEST_CHECK(!cooker.Cook(texel, 4, 4, 15, 0, TextureCookSettings(), texture));
+		TEST_CHECK(TextureCooker::GetFullMipCount(1, 1) == 1 && TextureCooker::GetFullMipCount(1024, 3) == 11 && TextureCooker::GetFullMipCount(5, 7) == 3);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Values of the mip chain
+	---------------------------------------------------------------------------*/
+	void CheckFilter()
+	{
+		TextureCooker cooker;
+		CookedTexture texture;
+
+		/*-------------------------------------------------------------------
+		-              A constant image stays constant through every filter and size
+		---------------------------------------------------------------------*/
+		test::Random random(4701);
+		for (int i = 0; i < 40; ++i)
+		{
+			const std::uint32_t width = 1 + random.Range(80), height = 1 + random.Range(80);
+			Image image(width, height);
+			const std::uint8_t color[4] = { static_cast<std::uint8_t>(random.Range(256)), static_cast<std::uint8_t>(random.Range(256)),
+				static_cast<std::uint8_t>(random.Range(256)), static_cast<std::uint8_t>(1 + random.Range(255)) };
+			for (std::uint32_t y = 0; y < height; ++y) { for (std::uint32_t x = 0; x < width; ++x) { std::memcpy(image.At(x, y), color, 4); } }
+
+			const TextureCookSettings settings = MakeSettings(static_cast<TextureMipFilter>(i & 1), TextureCompression::None, (i & 2) != 0, (i & 4) != 0);
+			cooker.Cook(image.Texels.data(), width, height, image.RowPitch, 0, settings, texture);
+			int maxError = 0;
+			for (std::uint32_t m = 0; m < texture.Header.MipCount; ++m)
+			{
+				const std::uint8_t* texels = texture.GetMipData(m);
+				for (size_t k = 0; k < static_cast<size_t>(texture.Mips[m].Width) * texture.Mips[m].Height * 4; ++k) { maxError = (std::max)(maxError, std::abs(texels[k] - color[k & 3])); }
+			}
+			TEST_CHECK_MESSAGE(maxError <= 1, "constant %ux%u (filter %d, srgb %d, alpha weighted %d) : error %d", width, height,
+				i & 1, (i >> 1) & 1, (i >> 2) & 1, maxError);
+		}
+
+		/*-------------------------------------------------------------------
+		-              Black / white checker : the average is taken in linear space when IsSRGB
+		---------------------------------------------------------------------*/
+		for (int filter = 0; filter < 2; ++filter)
+		{
+			Image checker(64, 64);
+			for (std::uint32_t y = 0; y < 64; ++y)
+			{
+				for (std::uint32_t x = 0; x < 64; ++x) { const std::uint8_t v = ((x ^ y) & 1) ? 255 : 0; std::uint8_t* t = checker.At(x, y); t[0] = t[1] = t[2] = v; t[3] = 255; }
+			}
+			for (int isSRGB = 0; isSRGB < 2; ++isSRGB)
+			{
+				cooker.Cook(checker.Texels.data(), 64, 64, checker.RowPitch, 0, MakeSettings(static_cast<TextureMipFilter>(filter), TextureCompression::None, isSRGB != 0, false), texture);
+				const std::uint8_t* texels = texture.GetMipData(1);
+				const int expected = isSRGB ? 188 : 128;  // sRGB(0.5) : linear average
+				int maxError = 0;
+				for (std::uint32_t y = 4; y < 28; ++y)    // the kaiser taps are clamped at the edges
+				{
+					for (std::uint32_t x = 4; x < 28; ++x) { maxError = (std::max)(maxError, std::abs(texels[(y * 32 + x) * 4] - expected)); }
+				}
+				TEST_CHECK_MESSAGE(maxError <= 2, "checker (filter %d, srgb %d) : mip 1 is %d away from %d", filter, isSRGB, maxError, expected);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-              Transparent texels do not bleed into the visible ones when IsAlphaWeighted
+		---------------------------------------------------------------------*/
+		Image cutout(2, 2);
+		const std::uint8_t green[4] = { 0, 255, 0, 255 }, clearRed[4] = { 255, 0, 0, 0 };
+		std::memcpy(cutout.At(0, 0), green, 4); std::memcpy(cutout.At(1, 0), clearRed, 4);
+		std::memcpy(cutout.At(0, 1), clearRed, 4); std::memcpy(cutout.At(1, 1), green, 4);
+		cooker.Cook(cutout.Texels.data(), 2, 2, cutout.RowPitch, 0, MakeSettings(TextureMipFilter::Box, TextureCompression::None, true, true), texture);
+		const std::uint8_t* weighted = texture.GetMipData(1);
+		TEST_CHECK(weighted[0] == 0 && weighted[1] == 255 && weighted[2] == 0 && weighted[3] == 128);
+		cooker.Cook(cutout.Texels.data(), 2, 2, cutout.RowPitch, 0, MakeSettings(TextureMipFilter::Box, TextureCompression::None, false, false), texture);
+		const std::uint8_t* plain = texture.GetMipData(1);
+		TEST_CHECK(plain[0] == 128 && plain[1] == 128 && plain[2] == 0 && plain[3] == 128);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   BC1 / BC3 / BC7 mips decode close to the uncompressed chain. Only the mips of 32 texels
+	-   or more are measured : below that one block spans the whole image, which no single
+	-   end point line fits. Constant images decode within the end point quantization.
+	---------------------------------------------------------------------------*/
+	void CheckCompression()
+	{
+		test::Random  random(4702);
+		TextureCooker cooker;
+		double worst[4][2] = {};  // [compression][color, alpha]
+		for (int i = 0; i < 36; ++i)
+		{
+			const TextureCompression compression = static_cast<TextureCompression>(1 + i % 3);
+			const std::uint32_t width = 4 * (16 + random.Range(24)), height = 4 * (16 + random.Range(24));
+			const Image image = MakeSmoothImage(width, height, 0, compression != TextureCompression::BC1, 2, random);
+
+			TextureCookSettings settings = MakeSettings(TextureMipFilter::Box, compression, true, true);
+			CookedTexture compressed, reference;
+			cooker.Cook(image.Texels.data(), width, height, image.RowPitch, 0, settings, compressed);
+			settings.Compression = TextureCompression::None;
+			cooker.Cook(image.Texels.data(), width, height, image.RowPitch, 0, settings, reference);
+			TEST_CHECK(compressed.GetCompression() == compression && compressed.Header.MipCount == reference.Header.MipCount);
+
+			for (std::uint32_t m = 0; compressed.Mips[m].Width >= 32 && compressed.Mips[m].Height >= 32; ++m)
+			{
+				const std::vector<std::uint8_t> decoded = DecodeMip(compressed, m);
+				const std::uint8_t* expected = reference.GetMipData(m);
+				const size_t        count    = static_cast<size_t>(compressed.Mips[m].Width) * compressed.Mips[m].Height;
+				const double        color    = GetRMSE(decoded.data(), expected, count, 0, 3);
+				const double        alpha    = GetRMSE(decoded.data(), expected, count, 3, 4);
+				worst[i % 3 + 1][0] = (std::max)(worst[i % 3 + 1][0], color);
+				worst[i % 3 + 1][1] = (std::max)(worst[i % 3 + 1][1], alpha);
+			}
+		}
+		/* one end point line per block : BC7 mode 6 fits color and alpha together, BC3 has a separate alpha block */
+		TEST_CHECK_MESSAGE(worst[1][0] < 10.0 && worst[1][1] == 0.0, "BC1 rmse : color %.2f alpha %.2f", worst[1][0], worst[1][1]);
+		TEST_CHECK_MESSAGE(worst[2][0] < 10.0 && worst[2][1] < 3.0 , "BC3 rmse : color %.2f alpha %.2f", worst[2][0], worst[2][1]);
+		TEST_CHECK_MESSAGE(worst[3][0] < 8.0  && worst[3][1] < 8.0 , "BC7 rmse : color %.2f alpha %.2f", worst[3][0], worst[3][1]);
+
+		/*-------------------------------------------------------------------
+		-              Constant images
+		---------------------------------------------------------------------*/
+		const int maxErrors[4] = { 0, 4, 4, 2 };
+		for (int i = 0; i < 60; ++i)
+		{
+			const TextureCompression compression = static_cast<TextureCompression>(1 + i % 3);
+			const std::uint8_t color[4] = { static_cast<std::uint8_t>(random.Range(256)), static_cast<std::uint8_t>(random.Range(256)),
+				static_cast<std::uint8_t>(random.Range(256)), compression == TextureCompression::BC1 ? std::uint8_t(255) : static_cast<std::uint8_t>(random.Range(256)) };
+			Image image(8, 8);
+			for (std::uint32_t y = 0; y < 8; ++y) { for (std::uint32_t x = 0; x < 8; ++x) { std::memcpy(image.At(x, y), color, 4); } }
+			CookedTexture texture;
+			cooker.Cook(image.Texels.data(), 8, 8, image.RowPitch, 0, MakeSettings(TextureMipFilter::Box, compression, false, false), texture);
+			const std::vector<std::uint8_t> decoded = DecodeMip(texture, 0);
+			int maxError = 0;
+			for (size_t k = 0; k < decoded.size(); ++k) { maxError = (std::max)(maxError, std::abs(decoded[k] - color[k & 3])); }
+			TEST_CHECK_MESSAGE(maxError <= maxErrors[i % 3 + 1], "BC%d : constant (%d, %d, %d, %d) decoded %d away", i % 3 == 0 ? 1 : i % 3 == 1 ? 3 : 7,
+				color[0], color[1], color[2], color[3], maxError);
+		}
+
+		/*-------------------------------------------------------------------
+		-              BC1 punch through : alpha < 128 is transparent black, the rest opaque
+		---------------------------------------------------------------------*/
+		Image cutout = MakeSmoothImage(32, 32, 0, true, 0, random);
+		CookedTexture texture;
+		cooker.Cook(cutout.Texels.data(), 32, 32, cutout.RowPitch, 0, MakeSettings(TextureMipFilter::Box, TextureCompression::BC1, true, true), texture);
+		const std::vector<std::uint8_t> decoded = DecodeMip(texture, 0);
+		bool isPunchThrough = true;
+		for (std::uint32_t k = 0; k < 32 * 32; ++k)
+		{
+			const bool isOpaque = cutout.Texels[k * 4 + 3] >= 128;
+			isPunchThrough &= decoded[k * 4 + 3] == (isOpaque ? 255 : 0);
+		}
+		TEST_CHECK(isPunchThrough);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Cache key : every byte, the size and every setting except IsSRGBFormat
+	---------------------------------------------------------------------------*/
+	void CheckHash()
+	{
+		std::vector<std::uint8_t> bytes(40);
+		for (size_t i = 0; i < bytes.size(); ++i) { bytes[i] = static_cast<std::uint8_t>(i * 7); }
+		const TextureCookSettings settings;
+		const std::uint64_t base = TextureCooker::HashSource(bytes.data(), bytes.size(), settings);
+		TEST_CHECK(base == TextureCooker::HashSource(bytes.data(), bytes.size(), settings));
+
+		std::vector<std::uint64_t> hashes = { base };
+		for (size_t size = 0; size < bytes.size(); ++size) { hashes.push_back(TextureCooker::HashSource(bytes.data(), size, settings)); }
+		for (size_t i = 0; i < bytes.size(); ++i)
+		{
+			bytes[i] ^= 1;
+			hashes.push_back(TextureCooker::HashSource(bytes.data(), bytes.size(), settings));
+			bytes[i] ^= 1;
+		}
+		TextureCookSettings changed[5] = { settings, settings, settings, settings, settings };
+		changed[0].Filter          = TextureMipFilter::Kaiser;
+		changed[1].Compression     = TextureCompression::BC7;
+		changed[2].IsSRGB          = false;
+		changed[3].IsAlphaWeighted = false;
+		changed[4].MaxMipCount     = 3;
+		for (const TextureCookSettings& setting : changed) { hashes.push_back(TextureCooker::HashSource(bytes.data(), bytes.size(), setting)); }
+		std::sort(hashes.begin(), hashes.end());
+		TEST_CHECK(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+
+		TextureCookSettings format = settings;
+		format.IsSRGBFormat = true;
+		TEST_CHECK(TextureCooker::HashSource(bytes.data(), bytes.size(), format) == base);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Save / Load / ReadRange in a temporary directory
+	---------------------------------------------------------------------------*/
+	void CheckCache()
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "MainGameTextureCookerTest";
+		std::error_code error;
+		std::filesystem::remove_all(directory, error);
+
+		test::Random  random(4703);
+		TextureCooker cooker;
+		TextureCookCache cache;
+		cache.SetDirectory(directory);
+		const Image image = MakeSmoothImage(64, 32, 0, true, 4, random);
+		TextureCookSettings settings = MakeSettings(TextureMipFilter::Kaiser, TextureCompression::BC3, true, true);
+		settings.IsSRGBFormat = true;
+		const std::uint64_t hash = TextureCooker::HashSource(image.Texels.data(), image.Texels.size(), settings);
+
+		CookedTexture texture, loaded;
+		TEST_CHECK(!cache.Load(hash, loaded));
+		TEST_CHECK(!cache.Save(loaded));
+		cooker.Cook(image.Texels.data(), image.Width, image.Height, image.RowPitch, hash, settings, texture);
+		TEST_CHECK(cache.Save(texture));
+		TEST_CHECK(cache.Load(hash, loaded));
+		TEST_CHECK(loaded.Data == texture.Data && loaded.IsSRGBFormat() && loaded.Header.MipCount == 7);
+
+		/*-------------------------------------------------------------------
+		-              Only the finished file is left
+		---------------------------------------------------------------------*/
+		int fileCount = 0;
+		for (const auto& entry : std::filesystem::directory_iterator(directory)) { fileCount++; TEST_CHECK(entry.path().extension() == ".ptex"); }
+		TEST_CHECK(fileCount == 1);
+
+		/*-------------------------------------------------------------------
+		-              One mip with one read
+		---------------------------------------------------------------------*/
+		const CookedTextureMip& mip = texture.Mips[2];
+		std::vector<std::uint8_t> range;
+		TEST_CHECK(TextureCookCache::ReadRange(cache.GetFilePath(hash), mip.Offset, mip.Size, range));
+		TEST_CHECK(range.size() == mip.Size && std::memcmp(range.data(), texture.GetMipData(2), range.size()) == 0);
+		TEST_CHECK(!TextureCookCache::ReadRange(cache.GetFilePath(hash), texture.Data.size() - 4, 8, range));
+
+		/*-------------------------------------------------------------------
+		-              A file under another hash or a broken file is a miss
+		---------------------------------------------------------------------*/
+		std::filesystem::copy_file(cache.GetFilePath(hash), cache.GetFilePath(hash + 1), error);
+		TEST_CHECK(!error && !cache.Load(hash + 1, loaded));
+		std::filesystem::resize_file(cache.GetFilePath(hash), texture.Data.size() / 2, error);
+		TEST_CHECK(!error && !cache.Load(hash, loaded));
+
+		std::filesystem::remove_all(directory, error);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Cook of a 1024 x 1024 texture per setting, and the cache hit which replaces it
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int    count = test::BenchScale();
+		test::Random random(4704);
+		const Image  image = MakeSmoothImage(1024, 1024, 0, true, 6, random);
+		TextureCooker cooker;
+		CookedTexture texture;
+		char label[64];
+
+		const struct { TextureMipFilter Filter; TextureCompression Compression; const char* Name; } cases[] =
+		{
+			{ TextureMipFilter::Box   , TextureCompression::None, "box   , R8G8B8A8" },
+			{ TextureMipFilter::Kaiser, TextureCompression::None, "kaiser, R8G8B8A8" },
+			{ TextureMipFilter::Box   , TextureCompression::BC1 , "box   , BC1" },
+			{ TextureMipFilter::Box   , TextureCompression::BC3 , "box   , BC3" },
+			{ TextureMipFilter::Box   , TextureCompression::BC7 , "box   , BC7" },
+		};
+		for (const auto& setting : cases)
+		{
+			const TextureCookSettings settings = MakeSettings(setting.Filter, setting.Compression, true, true);
+			test::Timer timer;
+			for (int i = 0; i < count; ++i) { cooker.Cook(image.Texels.data(), 1024, 1024, image.RowPitch, 0, settings, texture); }
+			std::snprintf(label, sizeof(label), "cook 1024x1024 : %s", setting.Name);
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(count), "texture");
+		}
+
+		/*-------------------------------------------------------------------
+		-              Cache hit : hash the source, read and parse the cooked file
+		---------------------------------------------------------------------*/
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "MainGameTextureCookerBench";
+		TextureCookCache cache;
+		cache.SetDirectory(directory);
+		const TextureCookSettings settings = MakeSettings(TextureMipFilter::Kaiser, TextureCompression::BC7, true, true);
+		const std::uint64_t hash = TextureCooker::HashSource(image.Texels.data(), image.Texels.size(), settings);
+		cooker.Cook(image.Texels.data(), 1024, 1024, image.RowPitch, hash, settings, texture);
+		TEST_CHECK(cache.Save(texture));
+
+		const int loadCount = 20 * count;
+		test::Timer timer;
+		for (int i = 0; i < loadCount; ++i)
+		{
+			CookedTexture loaded;
+			TEST_CHECK(cache.Load(TextureCooker::HashSource(image.Texels.data(), image.Texels.size(), settings), loaded));
+			test::DoNotOptimize(loaded.Data.data());
+		}
+		test::PrintBench("cache hit 1024x1024 (hash + read + parse)", timer.ElapsedMs(), static_cast<std::uint64_t>(loadCount), "texture");
+
+		std::error_code error;
+		std::filesystem::remove_all(directory, error);
+	}
+}
+
+int main()
+{
+	CheckLayout();
+	CheckFilter();
+	CheckCompression();
+	CheckHash();
+	CheckCache();
+	Bench();
+	return TEST_RESULT();
+}
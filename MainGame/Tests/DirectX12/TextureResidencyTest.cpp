@@ -0,0 +1,462 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TextureResidencyTest.cpp
+///             @brief  TextureResidency driven by a simulated camera walking through a field of textures,
+///                     with a fake loader (latency, failures) and textures streamed in and out :
+///                     the budget, the load / trim decisions against a shadow model, the convergence,
+///                     and the Update benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12TextureResidency.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr std::uint32_t TAIL_SIZE        = 64;   // same rule as TEXTURE_STREAMING_TAIL_SIZE
+	constexpr float         VIEW_DISTANCE    = 250.0f;
+	constexpr float         SCREEN_HEIGHT    = 1080.0f;
+	constexpr std::uint32_t MAX_PENDING_LOAD = 4;
+
+	/*---------------------------------------------------------------------------
+	-   One texture placed in the world
+	---------------------------------------------------------------------------*/
+	struct SceneTexture
+	{
+		std::uint32_t ID         = TextureResidency::INVALID_ID;
+		std::uint64_t Generation = 0;
+		float         X = 0.0f, Z = 0.0f;
+		float         ObjectSize = 1.0f; // world units covered by the texture
+		std::uint32_t Width = 0, Height = 0, MipCount = 0, TailMip = 0;
+		std::uint64_t MipBytes[TextureResidency::MAX_MIP_COUNT] = {};
+
+		std::uint64_t SuffixBytes(std::uint32_t mip) const
+		{
+			std::uint64_t bytes = 0;
+			for (std::uint32_t i = mip; i < MipCount; ++i) { bytes += MipBytes[i]; }
+			return bytes;
+		}
+	};
+
+	/* shadow of the residency, updated only from the loads, trims and load results */
+	struct ShadowEntry
+	{
+		std::uint32_t ResidentMip   = 0;
+		std::uint32_t PendingMip    = 0;
+		std::uint32_t RequestedMip  = 0;
+		float         Priority      = 0.0f;
+		std::uint64_t LastUsedFrame = 0;
+	};
+
+	/* read in flight of the fake loader */
+	struct FakeRead
+	{
+		std::uint32_t ID;
+		std::uint64_t Generation;
+		std::uint32_t TargetMip;
+		std::uint64_t FinishFrame;
+		bool          IsFailed;
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Camera, textures, fake loader and the shadow model
+	---------------------------------------------------------------------------*/
+	class Simulation
+	{
+	public:
+		struct Result
+		{
+			std::uint64_t LoadedBytes   = 0;
+			std::uint64_t PeakBytes     = 0;
+			double        SatisfiedRate = 0.0; // requested bytes which are resident, averaged over the frames
+		};
+
+		Simulation(std::uint64_t streamingBytes, std::uint32_t seed) : _random(seed) // budget : the tails + streamingBytes
+		{
+			for (int i = 0; i < 300; ++i) { _textures.push_back(MakeTexture()); }
+			for (const SceneTexture& texture : _textures) { _tailBytes += texture.SuffixBytes(texture.TailMip); }
+			_residency.Initialize(_tailBytes + streamingBytes, MAX_PENDING_LOAD);
+			for (SceneTexture& texture : _textures) { RegisterTexture(texture); }
+			TEST_CHECK(_residency.GetResidentBytes() == _tailBytes);
+		}
+
+		/* walk around the field (the camera moves by speed per frame), then stay still.
+		   isChurn : textures stream out and in, and the camera cuts across the field (the loads in flight lose their view) */
+		Result Run(int walkFrameCount, int stillFrameCount, float speed, bool isChurn)
+		{
+			Result result;
+			double satisfied = 0.0;
+			for (int frame = 0; frame < walkFrameCount + stillFrameCount; ++frame)
+			{
+				if (frame < walkFrameCount)
+				{
+					_angle += speed / 300.0f;
+					if (isChurn && frame % 50 == 49) { _angle += 3.14159265f; }
+					_cameraX = 500.0f + 300.0f * std::cos(_angle);
+					_cameraZ = 500.0f + 300.0f * std::sin(_angle);
+				}
+				if (isChurn && frame < walkFrameCount && frame % 40 == 39) { Churn(); }
+				satisfied += Step(result);
+			}
+			result.SatisfiedRate = satisfied / (walkFrameCount + stillFrameCount);
+			return result;
+		}
+
+		/*-------------------------------------------------------------------
+		-              Checks after the camera stayed still
+		---------------------------------------------------------------------*/
+		/* every visible texture has its requested mip or a finer one (a budget which holds the view) */
+		bool IsConverged() const
+		{
+			for (const SceneTexture& texture : _textures)
+			{
+				const ShadowEntry& shadow = _shadows[texture.ID];
+				if (shadow.LastUsedFrame == _frame && shadow.ResidentMip > shadow.RequestedMip) { return false; }
+			}
+			return true;
+		}
+		/* a texture still waiting for its mips means the unused textures gave back everything above their tails */
+		bool IsUnusedTrimmedWhenShort() const
+		{
+			bool isShort = false, hasUnusedMips = false;
+			for (const SceneTexture& texture : _textures)
+			{
+				const ShadowEntry& shadow = _shadows[texture.ID];
+				if (shadow.LastUsedFrame == _frame) { isShort       |= shadow.ResidentMip > shadow.RequestedMip; }
+				else                                { hasUnusedMips |= shadow.ResidentMip < texture.TailMip; }
+			}
+			return !isShort || !hasUnusedMips;
+		}
+		std::uint64_t GetBudget() const { return _residency.GetBudget(); }
+		std::uint64_t GetTailBytes() const { return _tailBytes; }
+		TextureResidency::Statistics GetStatistics() const { return _residency.GetStatistics(); }
+
+	private:
+		SceneTexture MakeTexture()
+		{
+			SceneTexture texture;
+			texture.X          = _random.Float(0.0f, 1000.0f);
+			texture.Z          = _random.Float(0.0f, 1000.0f);
+			texture.ObjectSize = _random.Float(4.0f, 40.0f);
+			texture.Width      = 256u << _random.Range(5);
+			texture.Height     = _random.Range(3) == 0 ? texture.Width / 2 : texture.Width;
+			const std::uint64_t blockBytes = _random.Bool() ? 8 : 16; // BC1 / BC7
+			texture.MipCount = 0;
+			for (std::uint32_t w = texture.Width, h = texture.Height;; w = (std::max)(w / 2, 1u), h = (std::max)(h / 2, 1u))
+			{
+				texture.MipBytes[texture.MipCount++] = ((w + 3) / 4) * ((h + 3) / 4) * blockBytes;
+				if (w == 1 && h == 1) { break; }
+			}
+			while (texture.TailMip + 1 < texture.MipCount && (std::max)(texture.Width >> texture.TailMip, texture.Height >> texture.TailMip) > TAIL_SIZE) { ++texture.TailMip; }
+			return texture;
+		}
+
+		void RegisterTexture(SceneTexture& texture)
+		{
+			texture.ID         = _residency.Register(texture.MipBytes, texture.MipCount, texture.TailMip);
+			texture.Generation = ++_generation;
+			if (texture.ID >= _shadows.size()) { _shadows.resize(texture.ID + 1); }
+			_shadows[texture.ID] = ShadowEntry();
+			_shadows[texture.ID].ResidentMip = _shadows[texture.ID].PendingMip = texture.TailMip;
+			_shadowBytes += texture.SuffixBytes(texture.TailMip);
+		}
+
+		/* a level chunk streams out and another one in : the reads of the old textures become stale */
+		void Churn()
+		{
+			for (int i = 0; i < 6; ++i)
+			{
+				SceneTexture& texture = _textures[_random.Range(static_cast<std::uint32_t>(_textures.size()))];
+				const ShadowEntry& shadow = _shadows[texture.ID];
+				_shadowBytes -= texture.SuffixBytes(shadow.ResidentMip);
+				_tailBytes   -= texture.SuffixBytes(texture.TailMip);
+				_residency.Unregister(texture.ID);
+				TEST_CHECK(!_residency.IsRegistered(texture.ID));
+
+				texture = MakeTexture();
+				_tailBytes += texture.SuffixBytes(texture.TailMip);
+				RegisterTexture(texture);
+			}
+		}
+
+		SceneTexture* Find(std::uint32_t id)
+		{
+			for (SceneTexture& texture : _textures) { if (texture.ID == id) { return &texture; } }
+			return nullptr;
+		}
+
+		/*-------------------------------------------------------------------
+		-              One frame : finish reads, request, update, check
+		---------------------------------------------------------------------*/
+		double Step(Result& result)
+		{
+			_frame++;
+
+			/*--- - the fake loader reports the reads which finished ---*/
+			for (size_t i = 0; i < _reads.size();)
+			{
+				const FakeRead read = _reads[i];
+				if (read.FinishFrame > _frame) { ++i; continue; }
+				_reads[i] = _reads.back();
+				_reads.pop_back();
+
+				const SceneTexture* texture = Find(read.ID);
+				if (texture == nullptr || texture->Generation != read.Generation) { continue; } // unregistered meanwhile
+				ShadowEntry& shadow = _shadows[read.ID];
+				TEST_CHECK(shadow.PendingMip == read.TargetMip && _residency.GetPendingMip(read.ID) == read.TargetMip);
+				if (read.IsFailed) { _residency.OnLoadFailed(read.ID); }
+				else
+				{
+					_residency.OnLoaded(read.ID, read.TargetMip);
+					_shadowBytes     += texture->SuffixBytes(read.TargetMip) - texture->SuffixBytes(shadow.ResidentMip);
+					result.LoadedBytes += texture->SuffixBytes(read.TargetMip) - texture->SuffixBytes(shadow.ResidentMip);
+					shadow.ResidentMip = read.TargetMip;
+				}
+				shadow.PendingMip = shadow.ResidentMip;
+			}
+
+			/*--- - the camera requests the mips of the visible textures ---*/
+			_residency.BeginFrame(_frame);
+			std::uint64_t requestedBytes = 0, satisfiedBytes = 0;
+			for (const SceneTexture& texture : _textures)
+			{
+				const float distance = std::sqrt((texture.X - _cameraX) * (texture.X - _cameraX) + (texture.Z - _cameraZ) * (texture.Z - _cameraZ));
+				if (distance > VIEW_DISTANCE) { continue; }
+				const float screenSize = SCREEN_HEIGHT * texture.ObjectSize / (std::max)(distance, 1.0f);
+				const std::uint32_t mip = TextureResidency::ComputeRequiredMip(texture.Width, texture.Height, texture.MipCount, screenSize);
+				_residency.Request(texture.ID, mip, screenSize);
+
+				ShadowEntry& shadow = _shadows[texture.ID];
+				shadow.RequestedMip  = (std::min)(mip, texture.TailMip);
+				shadow.Priority      = screenSize;
+				shadow.LastUsedFrame = _frame;
+				requestedBytes += texture.SuffixBytes(shadow.RequestedMip);
+				satisfiedBytes += texture.SuffixBytes((std::max)(shadow.RequestedMip, shadow.ResidentMip));
+			}
+
+			const TextureResidency::Statistics before = _residency.GetStatistics();
+			_residency.Update(_loads, _trims);
+			const TextureResidency::Statistics after  = _residency.GetStatistics();
+			CheckTrims();
+			CheckLoads(before, after);
+
+			/*--- - the budget and the shadow ---*/
+			TEST_CHECK_MESSAGE(_residency.GetResidentBytes() == _shadowBytes, "frame %llu : %llu resident bytes, shadow %llu",
+				static_cast<unsigned long long>(_frame), static_cast<unsigned long long>(_residency.GetResidentBytes()), static_cast<unsigned long long>(_shadowBytes));
+			TEST_CHECK_MESSAGE(after.ResidentBytes + after.PendingBytes <= after.Budget,
+				"frame %llu : %llu resident + %llu pending bytes over the budget %llu", static_cast<unsigned long long>(_frame),
+				static_cast<unsigned long long>(after.ResidentBytes), static_cast<unsigned long long>(after.PendingBytes), static_cast<unsigned long long>(after.Budget));
+			TEST_CHECK(after.PendingCount <= MAX_PENDING_LOAD && after.PendingCount == CountPending());
+			TEST_CHECK(_trims.empty() || !_loads.empty() || after.DeniedCount > before.DeniedCount); // trims only make room for a load
+			result.PeakBytes = (std::max)(result.PeakBytes, after.ResidentBytes + after.PendingBytes);
+			return requestedBytes == 0 ? 1.0 : static_cast<double>(satisfiedBytes) / requestedBytes;
+		}
+
+		/* LRU : unused textures (oldest first) drop to their tails before used ones (lowest priority first)
+		   give back the mips they did not request. Never the tail, never a pending texture. */
+		void CheckTrims()
+		{
+			bool          isUsedTrimmed = false;
+			std::uint64_t lastFrame     = 0;
+			float         lastPriority  = 0.0f;
+			for (const TextureResidencyChange& trim : _trims)
+			{
+				const SceneTexture* texture = Find(trim.TextureID);
+				TEST_CHECK(texture != nullptr);
+				if (texture == nullptr) { return; }
+				ShadowEntry& shadow = _shadows[trim.TextureID];
+				const bool isUsed = shadow.LastUsedFrame == _frame;
+				TEST_CHECK(trim.ResidentMip == shadow.ResidentMip && shadow.PendingMip == shadow.ResidentMip);
+				TEST_CHECK(trim.TargetMip > trim.ResidentMip && trim.TargetMip <= texture->TailMip);
+				TEST_CHECK_MESSAGE(!isUsed || trim.TargetMip <= shadow.RequestedMip, "frame %llu : texture %u trimmed to mip %u below its request %u",
+					static_cast<unsigned long long>(_frame), trim.TextureID, trim.TargetMip, shadow.RequestedMip);
+				TEST_CHECK(isUsed || trim.TargetMip == texture->TailMip);
+
+				TEST_CHECK_MESSAGE(isUsed || !isUsedTrimmed, "frame %llu : unused texture %u trimmed after a used one", static_cast<unsigned long long>(_frame), trim.TextureID);
+				if (!isUsed) { TEST_CHECK(shadow.LastUsedFrame >= lastFrame); lastFrame = shadow.LastUsedFrame; }
+				else         { TEST_CHECK(!isUsedTrimmed || shadow.Priority >= lastPriority); lastPriority = shadow.Priority; }
+				isUsedTrimmed |= isUsed;
+
+				_shadowBytes -= texture->SuffixBytes(trim.ResidentMip) - texture->SuffixBytes(trim.TargetMip);
+				shadow.ResidentMip = shadow.PendingMip = trim.TargetMip;
+				TEST_CHECK(_residency.GetResidentMip(trim.TextureID) == trim.TargetMip);
+			}
+		}
+
+		/* highest priority first, never finer than requested, at most the pending limit */
+		void CheckLoads(const TextureResidency::Statistics& before, const TextureResidency::Statistics& after)
+		{
+			float lastPriority = 1e30f;
+			for (const TextureResidencyChange& load : _loads)
+			{
+				const SceneTexture* texture = Find(load.TextureID);
+				TEST_CHECK(texture != nullptr);
+				if (texture == nullptr) { return; }
+				ShadowEntry& shadow = _shadows[load.TextureID];
+				TEST_CHECK(shadow.LastUsedFrame == _frame && shadow.PendingMip == shadow.ResidentMip);
+				TEST_CHECK(load.ResidentMip == shadow.ResidentMip && load.TargetMip < load.ResidentMip);
+				TEST_CHECK_MESSAGE(load.TargetMip >= shadow.RequestedMip, "frame %llu : texture %u loads mip %u finer than its request %u",
+					static_cast<unsigned long long>(_frame), load.TextureID, load.TargetMip, shadow.RequestedMip);
+				TEST_CHECK(shadow.Priority <= lastPriority);
+				lastPriority = shadow.Priority;
+
+				shadow.PendingMip = load.TargetMip;
+				_reads.push_back({ load.TextureID, texture->Generation, load.TargetMip, _frame + 1 + _random.Range(5), _random.Range(50) == 0 });
+			}
+			TEST_CHECK(after.LoadCount - before.LoadCount == _loads.size());
+			TEST_CHECK(after.ReducedCount - before.ReducedCount <= _loads.size());
+		}
+
+		std::uint64_t CountPending() const
+		{
+			std::uint64_t count = 0;
+			for (const SceneTexture& texture : _textures) { count += _shadows[texture.ID].PendingMip != _shadows[texture.ID].ResidentMip; }
+			return count;
+		}
+
+		test::Random                        _random;
+		TextureResidency                    _residency;
+		std::vector<SceneTexture>           _textures;
+		std::vector<ShadowEntry>            _shadows;   // [texture ID]
+		std::vector<FakeRead>               _reads;
+		std::vector<TextureResidencyChange> _loads;
+		std::vector<TextureResidencyChange> _trims;
+		std::uint64_t _frame       = 0;
+		std::uint64_t _generation  = 0;
+		std::uint64_t _tailBytes   = 0;
+		std::uint64_t _shadowBytes = 0;
+		float         _angle       = 0.0f;
+		float         _cameraX     = 800.0f;
+		float         _cameraZ     = 500.0f;
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Small cases of the policy
+	---------------------------------------------------------------------------*/
+	void CheckBasic()
+	{
+		const std::uint64_t mipBytes[4] = { 64, 16, 4, 1 }; // 85 bytes, tail 2 (5 bytes)
+		TextureResidency residency;
+		residency.Initialize(5 * 3 + 16 + 80, 2);
+		const std::uint32_t a = residency.Register(mipBytes, 4, 2);
+		const std::uint32_t b = residency.Register(mipBytes, 4, 2);
+		const std::uint32_t c = residency.Register(mipBytes, 4, 2);
+		TEST_CHECK(residency.Register(mipBytes, 0, 0) == TextureResidency::INVALID_ID);
+		TEST_CHECK(residency.Register(mipBytes, TextureResidency::MAX_MIP_COUNT + 1, 0) == TextureResidency::INVALID_ID);
+		TEST_CHECK(residency.GetResidentBytes() == 15 && residency.GetResidentMip(a) == 2);
+
+		std::vector<TextureResidencyChange> loads, trims;
+		residency.BeginFrame(1);
+		residency.Request(a, 0, 1.0f);
+		residency.Request(b, 3, 5.0f);
+		residency.Request(b, 1, 9.0f);  // finest mip, highest priority
+		residency.Update(loads, trims);
+		TEST_CHECK(loads.size() == 2 && trims.empty());
+		TEST_CHECK(loads[0].TextureID == b && loads[0].TargetMip == 1 && loads[1].TextureID == a && loads[1].TargetMip == 0);
+		TEST_CHECK(residency.GetStatistics().PendingBytes == 16 + 80);
+		residency.OnLoaded(b, 1);
+		residency.OnLoaded(a, 0);
+		TEST_CHECK(residency.GetResidentBytes() == 15 + 16 + 80);
+
+		/*-------------------------------------------------------------------
+		-              c needs room : a (unused) drops to its tail, b (used) keeps its request
+		---------------------------------------------------------------------*/
+		residency.BeginFrame(2);
+		residency.Request(b, 1, 1.0f);
+		residency.Request(c, 0, 1.0f);
+		residency.Update(loads, trims);
+		TEST_CHECK(trims.size() == 1 && trims[0].TextureID == a && trims[0].ResidentMip == 0 && trims[0].TargetMip == 2);
+		TEST_CHECK(loads.size() == 1 && loads[0].TextureID == c && loads[0].TargetMip == 0);
+		residency.OnLoadFailed(c);
+		TEST_CHECK(residency.GetResidentMip(c) == 2 && residency.GetStatistics().PendingCount == 0);
+
+		/*-------------------------------------------------------------------
+		-              b gives back the mip it no longer requests, and a still does not fit : reduced
+		---------------------------------------------------------------------*/
+		residency.BeginFrame(3);
+		residency.Request(a, 0, 1.0f);
+		residency.Request(b, 2, 1.0f);
+		residency.Request(c, 0, 2.0f);
+		residency.Update(loads, trims);
+		TEST_CHECK(trims.size() == 1 && trims[0].TextureID == b && trims[0].TargetMip == 2);
+		TEST_CHECK(loads.size() == 2 && loads[0].TextureID == c && loads[0].TargetMip == 0 && loads[1].TextureID == a && loads[1].TargetMip == 1);
+		TEST_CHECK(residency.GetStatistics().ReducedCount == 1 && residency.GetStatistics().DeniedCount == 0);
+
+		/*-------------------------------------------------------------------
+		-              Unregistered while loading : the late result is ignored
+		---------------------------------------------------------------------*/
+		residency.Unregister(c);
+		TEST_CHECK(residency.GetResidentBytes() == 10 && residency.GetStatistics().PendingCount == 1);
+		residency.OnLoaded(c, 0);
+		TEST_CHECK(residency.GetResidentBytes() == 10);
+
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 1024.0f)      == 0);
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 256.0f)       == 2);
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 256.0f, 1.0f) == 3);
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 4096.0f)      == 0);
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 0.0f)         == 10);
+		TEST_CHECK(TextureResidency::ComputeRequiredMip(1024, 512, 11, 0.001f)       == 10);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The walk with an ample budget converges to the requested mips once the camera stops,
+	-   and the walks with short budgets stay within them
+	---------------------------------------------------------------------------*/
+	void CheckWalk()
+	{
+		Simulation ample(1024ull * 1024 * 1024, 4800);
+		ample.Run(400, 200, 2.0f, true);
+		TEST_CHECK_MESSAGE(ample.IsConverged(), "the view did not reach its requested mips with an ample budget");
+
+		const std::uint64_t budgets[] = { 8ull * 1024 * 1024, 24ull * 1024 * 1024, 48ull * 1024 * 1024 }; // below the 70 MB the walk touches
+		for (std::uint64_t budget : budgets)
+		{
+			Simulation tight(budget, 4801);
+			tight.Run(400, 200, 3.0f, true);
+			TEST_CHECK_MESSAGE(tight.IsUnusedTrimmedWhenShort(), "budget %llu MB : unused textures keep mips while the view is short",
+				static_cast<unsigned long long>(budget >> 20));
+			TEST_CHECK(tight.GetStatistics().TrimCount > 0);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Walk per budget : bytes loaded, satisfied requests, and the cost of Update
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int frameCount = 2000 * test::BenchScale();
+		const std::uint64_t budgets[] = { 16ull * 1024 * 1024, 32ull * 1024 * 1024, 64ull * 1024 * 1024, 256ull * 1024 * 1024 };
+		char label[64];
+		for (std::uint64_t budget : budgets)
+		{
+			Simulation simulation(budget, 4802);
+			test::Timer timer;
+			const Simulation::Result result = simulation.Run(frameCount, 0, 2.0f, false);
+			std::snprintf(label, sizeof(label), "walk, tails + %3llu MB", static_cast<unsigned long long>(budget >> 20));
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frameCount), "frame");
+			const TextureResidency::Statistics statistics = simulation.GetStatistics();
+			std::printf("        satisfied %.3f, loaded %.1f KB/frame, peak %.1f MB of %.1f MB, %llu loads (%llu reduced, %llu denied), %llu trims\n",
+				result.SatisfiedRate, result.LoadedBytes / 1024.0 / frameCount, result.PeakBytes / 1048576.0, simulation.GetBudget() / 1048576.0,
+				static_cast<unsigned long long>(statistics.LoadCount), static_cast<unsigned long long>(statistics.ReducedCount),
+				static_cast<unsigned long long>(statistics.DeniedCount), static_cast<unsigned long long>(statistics.TrimCount));
+		}
+	}
+}
+
+int main()
+{
+	CheckBasic();
+	CheckWalk();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,418 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   UploadArenaTest.cpp
+///             @brief  UploadArena over a fake GPU address space : fuzz of the ring (alignment, address translation,
+///                     no reuse before the fence, statistics), writers on the JobSystem racing a GPU thread
+///                     which reads the retired frames (also under TSan) and the constant upload benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12UploadArena.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <condition_variable>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr std::uint64_t BLOCK_SIZE = UploadArena::CONSTANT_BUFFER_ALIGNMENT;
+
+	std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+	/*---------------------------------------------------------------------------
+	-   Mapped upload heap : CPU memory and a GPU virtual address range of the same size
+	---------------------------------------------------------------------------*/
+	struct FakeUploadHeap
+	{
+		static constexpr std::uint64_t GPU_BASE = 0x0000'7a00'0010'0000ull;
+
+		std::unique_ptr<std::uint8_t[]> Storage;
+		std::uint8_t*                   CPU      = nullptr;
+		std::uint64_t                   Capacity = 0;
+
+		explicit FakeUploadHeap(std::uint64_t capacity) : Storage(new std::uint8_t[capacity + BLOCK_SIZE]), Capacity(capacity)
+		{
+			CPU = reinterpret_cast<std::uint8_t*>(AlignUp(reinterpret_cast<std::uintptr_t>(Storage.get()), BLOCK_SIZE));
+		}
+		/* what the GPU reads at the address */
+		const std::uint8_t* Translate(std::uint64_t gpuAddress) const { return CPU + (gpuAddress - GPU_BASE); }
+	};
+
+	/* one allocation as the command list sees it : the address and the words written there */
+	struct UploadRecord
+	{
+		std::uint64_t GPU;
+		std::uint64_t Size;
+		std::uint32_t Tag;
+	};
+
+	void Fill(const UploadAllocation& allocation, std::uint32_t tag)
+	{
+		std::uint32_t* words = static_cast<std::uint32_t*>(allocation.CPU);
+		for (std::uint64_t i = 0; i < allocation.Size / sizeof(std::uint32_t); ++i) { words[i] = tag; }
+	}
+
+	bool IsFilled(const FakeUploadHeap& heap, const UploadRecord& record)
+	{
+		const std::uint32_t* words = reinterpret_cast<const std::uint32_t*>(heap.Translate(record.GPU));
+		for (std::uint64_t i = 0; i < record.Size / sizeof(std::uint32_t); ++i) { if (words[i] != record.Tag) { return false; } }
+		return true;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Address and alignment rules of one allocation
+	---------------------------------------------------------------------------*/
+	bool IsValidAllocation(const FakeUploadHeap& heap, const UploadAllocation& allocation, std::uint64_t size, std::uint64_t alignment)
+	{
+		const std::uint64_t offset = static_cast<std::uint64_t>(static_cast<std::uint8_t*>(allocation.CPU) - heap.CPU);
+		return allocation.GPU == FakeUploadHeap::GPU_BASE + offset
+			&& offset + allocation.Size <= heap.Capacity
+			&& allocation.Size == AlignUp(size, BLOCK_SIZE)
+			&& allocation.GPU % (std::max)(alignment, BLOCK_SIZE) == 0;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Trivial API rules
+	---------------------------------------------------------------------------*/
+	void CheckBasic()
+	{
+		UploadArena arena;
+		TEST_CHECK(!arena.IsInitialized() && !arena.Allocate(16).IsValid());
+
+		FakeUploadHeap heap(4096);
+		arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, 4096 + 100, 1024);
+		TEST_CHECK(arena.GetCapacity() == 4096);
+		TEST_CHECK(!arena.Allocate(0).IsValid());
+
+		struct Constant { float Value[5]; } constant = { { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f } };
+		const UploadAllocation allocation = arena.Upload(constant);
+		TEST_CHECK(allocation.IsValid() && IsValidAllocation(heap, allocation, sizeof(Constant), BLOCK_SIZE));
+		TEST_CHECK(allocation.IsValid() && std::memcmp(allocation.CPU, &constant, sizeof(Constant)) == 0);
+		TEST_CHECK(arena.Allocate(100).GPU == allocation.GPU + BLOCK_SIZE);  // the same chunk
+
+		/*-------------------------------------------------------------------
+		-              Larger than the ring : failed, counted
+		---------------------------------------------------------------------*/
+		TEST_CHECK(!arena.Allocate(4097).IsValid());
+		UploadArena::Statistics statistics = arena.GetStatistics();
+		TEST_CHECK(statistics.FailedCount == 1 && statistics.FrameAllocationCount == 2 && statistics.FrameUploadedBytes == 2 * BLOCK_SIZE);
+		TEST_CHECK(statistics.FrameChunkCount == 1 && statistics.InFlightBytes == 1024);
+
+		/*-------------------------------------------------------------------
+		-              A new frame takes a new chunk
+		---------------------------------------------------------------------*/
+		arena.EndFrame(1);
+		TEST_CHECK(arena.Allocate(16).GPU == FakeUploadHeap::GPU_BASE + 1024);
+		statistics = arena.GetStatistics();
+		TEST_CHECK(statistics.LastFrameUploadedBytes == 2 * BLOCK_SIZE && statistics.FrameUploadedBytes == BLOCK_SIZE);
+		arena.ReleaseCompleted(1);
+		TEST_CHECK(arena.GetStatistics().InFlightBytes == 1024);
+
+		arena.Finalize();
+		TEST_CHECK(!arena.Allocate(16).IsValid());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random frames over random rings. Every 256 byte block remembers the frame which
+	-   owns it until the fake GPU completes that frame; an allocation in an owned block
+	-   is memory reused before its fence.
+	---------------------------------------------------------------------------*/
+	void CheckFuzz()
+	{
+		test::Random random(4600);
+		std::uint64_t allocationCount = 0, failedCount = 0;
+		for (int shape = 0; shape < 120; ++shape)
+		{
+			const std::uint64_t capacity  = BLOCK_SIZE * (4 + random.Range(1024));
+			const std::uint64_t chunkSize = BLOCK_SIZE * (1 + random.Range(32));
+			const std::uint32_t maxLag    = random.Range(4);
+
+			FakeUploadHeap heap(capacity);
+			UploadArena arena;
+			arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, capacity, chunkSize);
+			std::vector<std::unique_ptr<UploadArenaWriter>> writers;
+			for (std::uint32_t i = 0, count = random.Range(4); i < count; ++i) { writers.push_back(std::make_unique<UploadArenaWriter>(arena)); }
+
+			std::vector<std::uint64_t>              owner(capacity / BLOCK_SIZE, 0);  // 0 : free, otherwise frame fence
+			std::vector<std::vector<UploadRecord>>  frames;                           // [fence - 1]
+			std::uint64_t completedFence = 0, peak = 0, failed = 0;
+			std::uint32_t tag            = 0;
+
+			for (std::uint64_t fence = 1; fence <= 200; ++fence)
+			{
+				std::vector<UploadRecord> records;
+				std::uint64_t frameBytes = 0;
+				for (std::uint32_t i = 0, count = random.Range(24); i < count; ++i)
+				{
+					const std::uint64_t size      = random.Range(16) == 0 ? 1 + random.Range(static_cast<std::uint32_t>(capacity / 2)) : 1 + random.Range(1024);
+					const std::uint64_t alignment = BLOCK_SIZE << (random.Range(4) == 0 ? random.Range(4) : 0);
+					const std::uint32_t writer    = random.Range(static_cast<std::uint32_t>(writers.size()) + 1);
+					const UploadAllocation allocation = writer == writers.size() ? arena.Allocate(size, alignment) : writers[writer]->Allocate(size, alignment);
+					allocationCount++;
+					if (!allocation.IsValid())
+					{
+						/* only a ring with frames in flight (or a request larger than the ring) may fail */
+						const bool isInFlight = std::any_of(owner.begin(), owner.end(), [](std::uint64_t frame) { return frame != 0; });
+						TEST_CHECK_MESSAGE(isInFlight || AlignUp(size, BLOCK_SIZE) + alignment - BLOCK_SIZE > capacity,
+							"shape %d frame %llu : %llu bytes failed on an empty ring of %llu", shape, static_cast<unsigned long long>(fence),
+							static_cast<unsigned long long>(size), static_cast<unsigned long long>(capacity));
+						failed++;
+						continue;
+					}
+					TEST_CHECK_MESSAGE(IsValidAllocation(heap, allocation, size, alignment), "shape %d frame %llu : %llu bytes (align %llu) at 0x%llx",
+						shape, static_cast<unsigned long long>(fence), static_cast<unsigned long long>(size),
+						static_cast<unsigned long long>(alignment), static_cast<unsigned long long>(allocation.GPU));
+					if (!IsValidAllocation(heap, allocation, size, alignment)) { return; }
+
+					const std::uint64_t first = (allocation.GPU - FakeUploadHeap::GPU_BASE) / BLOCK_SIZE;
+					for (std::uint64_t block = first; block < first + allocation.Size / BLOCK_SIZE; ++block)
+					{
+						TEST_CHECK_MESSAGE(owner[block] == 0, "shape %d frame %llu : block %llu of frame %llu reused before its fence",
+							shape, static_cast<unsigned long long>(fence), static_cast<unsigned long long>(block), static_cast<unsigned long long>(owner[block]));
+						owner[block] = fence;
+					}
+					Fill(allocation, ++tag);
+					records.push_back({ allocation.GPU, allocation.Size, tag });
+					frameBytes += allocation.Size;
+				}
+
+				const UploadArena::Statistics statistics = arena.GetStatistics();
+				TEST_CHECK(statistics.FrameUploadedBytes == frameBytes && statistics.FrameAllocationCount == records.size());
+				TEST_CHECK(statistics.InFlightBytes <= capacity && statistics.FailedCount == failed);
+				arena.EndFrame(fence);
+				peak = (std::max)(peak, frameBytes);
+				TEST_CHECK(arena.GetStatistics().LastFrameUploadedBytes == frameBytes && arena.GetStatistics().PeakFrameUploadedBytes == peak);
+				frames.push_back(std::move(records));
+
+				/*-------------------------------------------------------------------
+				-              The GPU reads the frames it completes
+				---------------------------------------------------------------------*/
+				const std::uint64_t target = fence == 200 ? fence : fence - (std::min)(fence, static_cast<std::uint64_t>(random.Range(maxLag + 1)));
+				for (; completedFence < target; ++completedFence)
+				{
+					for (const UploadRecord& record : frames[completedFence])
+					{
+						TEST_CHECK_MESSAGE(IsFilled(heap, record), "shape %d : constants of frame %llu overwritten before the GPU read them",
+							shape, static_cast<unsigned long long>(completedFence + 1));
+					}
+				}
+				for (std::uint64_t& frame : owner) { if (frame != 0 && frame <= completedFence) { frame = 0; } }
+				arena.ReleaseCompleted(completedFence);
+			}
+
+			/*-------------------------------------------------------------------
+			-              All frames completed : the whole ring can be taken again
+			---------------------------------------------------------------------*/
+			TEST_CHECK(arena.GetStatistics().InFlightBytes == 0);
+			TEST_CHECK_MESSAGE(arena.Allocate(capacity).IsValid(), "shape %d : the drained ring of %llu bytes can not be taken", shape,
+				static_cast<unsigned long long>(capacity));
+			failedCount += failed;
+		}
+		TEST_CHECK(failedCount > 0 && failedCount < allocationCount / 4); // both paths are exercised
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Fake GPU queue : a thread reads the constants of the submitted frames and completes their fences.
+	-   A frame runs once the CPU is <latency> frames ahead of it (or on Flush), so the frames
+	-   the GPU has not read yet are always the newest ones in the ring.
+	---------------------------------------------------------------------------*/
+	class FakeGpuQueue
+	{
+	public:
+		void Submit(std::uint64_t fence, std::vector<UploadRecord>&& records)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_submitted.push_back({ fence, std::move(records) });
+			}
+			_condition.notify_one();
+		}
+		std::uint64_t GetCompletedFence() const { return _completedFence.load(std::memory_order_acquire); }
+		void WaitForFence(std::uint64_t fence) const { while (GetCompletedFence() < fence) { std::this_thread::yield(); } }
+		void Flush()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_isFlush = true;
+			}
+			_condition.notify_one();
+		}
+		std::uint64_t GetCorruptedCount() const { return _corruptedCount.load(); }
+
+		FakeGpuQueue(const FakeUploadHeap& heap, size_t latency) : _heap(heap), _latency(latency), _thread(&FakeGpuQueue::Execute, this) {}
+		~FakeGpuQueue()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_isQuit = true;
+			}
+			_condition.notify_one();
+			_thread.join();
+		}
+	private:
+		struct Frame
+		{
+			std::uint64_t             Fence;
+			std::vector<UploadRecord> Records;
+		};
+		void Execute()
+		{
+			while (true)
+			{
+				Frame frame;
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					_condition.wait(lock, [this]() { return _isQuit || _submitted.size() > _latency || (_isFlush && !_submitted.empty()); });
+					if (_isQuit) { return; }
+					frame = std::move(_submitted.front());
+					_submitted.erase(_submitted.begin());
+				}
+				for (const UploadRecord& record : frame.Records) { if (!IsFilled(_heap, record)) { _corruptedCount++; } }
+				_completedFence.store(frame.Fence, std::memory_order_release);
+			}
+		}
+
+		const FakeUploadHeap&      _heap;
+		std::mutex                 _mutex;
+		std::condition_variable    _condition;
+		std::vector<Frame>         _submitted;
+		std::atomic<std::uint64_t> _completedFence = 0;
+		std::atomic<std::uint64_t> _corruptedCount = 0;
+		size_t                     _latency        = 0;
+		bool                       _isFlush        = false;
+		bool                       _isQuit         = false;
+		std::thread                _thread;
+	};
+
+	/*---------------------------------------------------------------------------
+	-   One writer per job on the JobSystem while the GPU thread reads the former frames.
+	-   Memory handed out too early is a data race with the GPU thread (TSan) and a corrupted frame.
+	---------------------------------------------------------------------------*/
+	void CheckConcurrent(bool isStress)
+	{
+		constexpr std::uint32_t WRITER_COUNT = 8;
+		constexpr std::uint64_t FRAME_LAG    = 2;
+		const     std::uint64_t frameCount   = isStress ? 300 : 1000;
+
+		JobSystem jobSystem;
+		jobSystem.Initialize(3);
+		FakeUploadHeap heap(512 * 1024); // about four frames : the head laps right behind the frames the GPU has not read
+		UploadArena arena;
+		arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, heap.Capacity, 4096);
+		FakeGpuQueue gpu(heap, FRAME_LAG);
+
+		std::vector<std::unique_ptr<UploadArenaWriter>> writers;
+		for (std::uint32_t i = 0; i < WRITER_COUNT; ++i) { writers.push_back(std::make_unique<UploadArenaWriter>(arena)); }
+		std::vector<std::vector<UploadRecord>> records(WRITER_COUNT);
+		std::uint64_t failedCount = 0;
+
+		for (std::uint64_t fence = 1; fence <= frameCount; ++fence)
+		{
+			jobSystem.ParallelFor(WRITER_COUNT, [&](size_t index)
+			{
+				test::Random random(static_cast<std::uint32_t>(fence * WRITER_COUNT + index));
+				for (int i = 0; i < 40; ++i)
+				{
+					const std::uint64_t size       = 1 + random.Range(256);
+					const UploadAllocation allocation = writers[index]->Allocate(size, random.Range(8) == 0 ? 1024 : BLOCK_SIZE);
+					if (!allocation.IsValid()) { continue; }
+					const std::uint32_t tag = static_cast<std::uint32_t>(fence << 12 | index << 8 | i);
+					Fill(allocation, tag);
+					records[index].push_back({ allocation.GPU, allocation.Size, tag });
+				}
+			});
+
+			/*-------------------------------------------------------------------
+			-              Submit, keep FRAME_LAG frames in flight and recycle the completed ones
+			---------------------------------------------------------------------*/
+			std::vector<UploadRecord> frame;
+			for (std::vector<UploadRecord>& list : records) { frame.insert(frame.end(), list.begin(), list.end()); list.clear(); }
+			TEST_CHECK(arena.GetStatistics().FrameAllocationCount == frame.size());
+			failedCount += WRITER_COUNT * 40 - frame.size();
+			arena.EndFrame(fence);
+			gpu.Submit(fence, std::move(frame));
+			if (fence > FRAME_LAG) { gpu.WaitForFence(fence - FRAME_LAG); }
+			arena.ReleaseCompleted(gpu.GetCompletedFence());
+		}
+		gpu.Flush();
+		gpu.WaitForFence(frameCount);
+		arena.ReleaseCompleted(frameCount);
+
+		TEST_CHECK_MESSAGE(gpu.GetCorruptedCount() == 0, "%llu constants overwritten while the GPU read them", static_cast<unsigned long long>(gpu.GetCorruptedCount()));
+		TEST_CHECK_MESSAGE(failedCount == 0, "%llu allocations failed with %llu frames in flight", static_cast<unsigned long long>(failedCount),
+			static_cast<unsigned long long>(FRAME_LAG));
+		TEST_CHECK(arena.GetStatistics().InFlightBytes == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Constants of a frame : writer bump allocation, one chunk per allocation, writers on the JobSystem
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int count = 2000000 * test::BenchScale();
+		FakeUploadHeap heap(16 * 1024 * 1024);
+		UploadArena arena;
+		arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, heap.Capacity, 64 * 1024);
+		struct ObjectConstant { float World[16]; float Color[4]; } constant = {};
+
+		std::uint64_t fence = 0;
+		test::Timer timer;
+		for (int i = 0; i < count; ++i)
+		{
+			if ((i & 8191) == 0) { arena.EndFrame(++fence); arena.ReleaseCompleted(fence - 1); }
+			test::DoNotOptimize(arena.Upload(constant));
+		}
+		test::PrintBench("upload 80 byte constant (writer)", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "op");
+
+		arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, heap.Capacity, BLOCK_SIZE);
+		timer.Reset();
+		for (int i = 0; i < count; ++i)
+		{
+			if ((i & 8191) == 0) { arena.EndFrame(++fence); arena.ReleaseCompleted(fence - 1); }
+			test::DoNotOptimize(arena.AllocateChunk(sizeof(ObjectConstant)));
+		}
+		test::PrintBench("chunk per constant (locked ring)", timer.ElapsedMs(), static_cast<std::uint64_t>(count), "op");
+
+		arena.Initialize(heap.CPU, FakeUploadHeap::GPU_BASE, heap.Capacity, 64 * 1024);
+		JobSystem jobSystem;
+		jobSystem.Initialize((std::max)(static_cast<int>(std::thread::hardware_concurrency()), 2) - 1);
+		std::vector<std::unique_ptr<UploadArenaWriter>> writers;
+		for (int i = 0; i < 8; ++i) { writers.push_back(std::make_unique<UploadArenaWriter>(arena)); }
+		const int frameCount = count / 8192;
+		timer.Reset();
+		for (int frame = 0; frame < frameCount; ++frame)
+		{
+			jobSystem.ParallelFor(writers.size(), [&](size_t index)
+			{
+				for (int i = 0; i < 1024; ++i) { test::DoNotOptimize(writers[index]->Upload(constant)); }
+			});
+			arena.EndFrame(++fence);
+			arena.ReleaseCompleted(fence - 1);
+		}
+		char label[64];
+		std::snprintf(label, sizeof(label), "upload (8 writers, %d workers)", jobSystem.GetWorkerCount());
+		test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frameCount) * 8192, "op");
+		TEST_CHECK(arena.GetStatistics().FailedCount == 0);
+	}
+}
+
+/* "stress" : skip the benchmark (used by the thread sanitizer build) */
+int main(int argc, char** argv)
+{
+	const bool isStress = argc >= 2 && std::strcmp(argv[1], "stress") == 0;
+	CheckBasic();
+	if (!isStress) { CheckFuzz(); }
+	CheckConcurrent(isStress);
+	if (!isStress) { Bench(); }
+	return TEST_RESULT();
+}
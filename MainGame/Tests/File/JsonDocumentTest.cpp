@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   JsonDocumentTest.cpp
+///             @brief  JsonDocument / JsonValue : values, escapes, the SSE2 string scan, hashed lookup,
+///                     malformed input, SAX and the multi MB parse throughput
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/File/JsonDocument.hpp"
+#include "GameCore/Include/File/Json.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/*---------------------------------------------------------------------------
+	-   Every value type, numbers, escapes (surrogate pair) and the BOM
+	---------------------------------------------------------------------------*/
+	void CheckValues()
+	{
+		const std::string text =
+			"\xEF\xBB\xBF { \"null\" : null, \"true\":true ,\"false\":false,\n"
+			"\t\"int\": -12345, \"big\": 1234567890123456789, \"real\": 0.25e2, \"small\": -1.5E-3,\r\n"
+			"  \"text\": \"a\\\"b\\\\c\\/d\\n\\u00e9\\ud83d\\ude00\", \"plain\": \"name\",\n"
+			"  \"array\": [1, [2, []], {}, \"x\"] }";
+		JsonDocument document;
+		TEST_CHECK_MESSAGE(document.Parse(text), "%s at %zu", document.GetErrorMessage().c_str(), document.GetErrorOffset());
+
+		const JsonNode& root = document.GetRoot();
+		TEST_CHECK(root.IsObject() && root.Size() == 10);
+		TEST_CHECK(root.Find("null") != nullptr && root.Find("null")->IsNull());
+		TEST_CHECK(root.Find("true")->GetBool() && !root.Find("false")->GetBool(true));
+		TEST_CHECK(root.Find("int")->GetNumber() == -12345.0);
+		TEST_CHECK(root.Find("big")->GetNumber() == 1234567890123456789.0);
+		TEST_CHECK(root.Find("real")->GetNumber() == 25.0 && root.Find("small")->GetNumber() == -1.5e-3);
+		TEST_CHECK(root.Find("missing") == nullptr && root.Find("int")->GetNumber() != 0.0);
+
+		const JsonNode& escaped = *root.Find("text");
+		const std::string expected = "a\"b\\c/d\n\xC3\xA9\xF0\x9F\x98\x80";
+		TEST_CHECK(escaped.HasEscape() && escaped.GetString() == expected);
+		const std::string_view cached = document.GetString(escaped);
+		TEST_CHECK(cached == expected && document.GetString(escaped).data() == cached.data());
+		const JsonNode& plain = *root.Find("plain");
+		TEST_CHECK(!plain.HasEscape() && plain.GetStringView() == "name" && plain.GetStringView().data() == text.data() + text.find("name\""));
+
+		const JsonNode& array = *root.Find("array");
+		TEST_CHECK(array.IsArray() && array.Size() == 4 && array[0].GetNumber() == 1.0);
+		TEST_CHECK(array[1].Size() == 2 && array[1][1].IsArray() && array[1][1].Size() == 0);
+		TEST_CHECK(array[2].IsObject() && array[2].Size() == 0 && array[3].GetStringView() == "x");
+		TEST_CHECK(root.GetMember(0).GetKey() == "null" && root.GetMember(9).GetKey() == "array");
+
+		TEST_CHECK(document.Parse("  42 ") && document.GetRoot().GetNumber() == 42.0);
+		TEST_CHECK(document.Parse("\"\"") && document.GetRoot().IsString() && document.GetRoot().GetStringView().empty());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The closing quote / escape at every offset of the 16 byte scan,
+	-   with the string ending right at the buffer end
+	---------------------------------------------------------------------------*/
+	void CheckStringScan()
+	{
+		int failed = 0;
+		for (size_t length = 0; length < 48; ++length)
+		{
+			const std::string body(length, 'a');
+			JsonDocument document;
+			std::string text = "\"" + body + "\"";
+			if (!document.Parse(text.data(), text.size()) || document.GetRoot().GetStringView() != body) { failed++; }
+
+			for (size_t escape = 0; escape < length; ++escape)
+			{
+				text = "[\"" + body.substr(0, escape) + "\\t" + body.substr(escape) + "\",1]";
+				const std::string expected = body.substr(0, escape) + "\t" + body.substr(escape);
+				if (!document.Parse(text) || document.GetRoot()[0].GetString() != expected || document.GetRoot()[1].GetNumber() != 1.0) { failed++; }
+			}
+
+			text = "\"" + body; // unterminated
+			if (document.Parse(text.data(), text.size())) { failed++; }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "%d string(s) scanned wrong", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Linear (<= 8 members) and hashed lookup, duplicate keys, escaped keys
+	---------------------------------------------------------------------------*/
+	void CheckLookup()
+	{
+		const int memberCounts[] = { 1, 8, 9, 100, 3000 };
+		for (int count : memberCounts)
+		{
+			std::string text = "{";
+			for (int i = 0; i < count; ++i) { text += "\"key" + std::to_string(i) + "\":" + std::to_string(i) + ","; }
+			text += "\"key0\":-1, \"escaped\\u0041\":7}";
+
+			JsonDocument document;
+			TEST_CHECK(document.Parse(text));
+			const JsonNode& root = document.GetRoot();
+			int failed = 0;
+			for (int i = 0; i < count; ++i)
+			{
+				const JsonNode* value = root.Find("key" + std::to_string(i));
+				if (value == nullptr || value->GetNumber() != static_cast<double>(i)) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "%d member(s) : %d lookup(s) failed", count, failed);
+			TEST_CHECK(root.Find("key") == nullptr && root.Find(std::to_string(count)) == nullptr);
+			TEST_CHECK(root.Find("escapedA") != nullptr && root.Find("escapedA")->GetNumber() == 7.0);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Malformed input is rejected with an offset inside the text, the depth limit
+	---------------------------------------------------------------------------*/
+	void CheckErrors()
+	{
+		const char* broken[] =
+		{
+			"", " ", "{", "}", "[1,]", "[1 2]", "{\"a\" 1}", "{\"a\":}", "{1:2}", "{\"a\":1,}", "tru", "nul", "falsey",
+			"01", "1.", "-", "1e", ".5", "+1", "\"\\x\"", "\"\\u12G4\"", "\"\\u12\"", "[\"a]", "[1] 2", "{\"a\":1}}",
+		};
+		for (const char* text : broken)
+		{
+			JsonDocument document;
+			const size_t size = std::strlen(text);
+			TEST_CHECK_MESSAGE(!document.Parse(text, size), "accepted : %s", text);
+			TEST_CHECK_MESSAGE(!document.GetErrorMessage().empty() && document.GetErrorOffset() <= size, "%s : offset %zu", text, document.GetErrorOffset());
+			std::string message;
+			JsonHandler handler;
+			TEST_CHECK_MESSAGE(!JsonDocument::ParseSax(text, size, handler, &message) && !message.empty(), "sax accepted : %s", text);
+		}
+
+		JsonDocument document;
+		const std::string deep    = std::string(JSON_MAX_DEPTH, '[') + std::string(JSON_MAX_DEPTH, ']');
+		const std::string tooDeep = std::string(JSON_MAX_DEPTH + 1, '[') + std::string(JSON_MAX_DEPTH + 1, ']');
+		TEST_CHECK(document.Parse(deep));
+		TEST_CHECK(!document.Parse(tooDeep));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   SAX events and the early stop, JsonValue built from the document
+	---------------------------------------------------------------------------*/
+	class CountHandler : public JsonHandler
+	{
+	public:
+		bool OnNull  ()                                   override { Count[0]++; return true; }
+		bool OnBool  (bool)                               override { Count[1]++; return true; }
+		bool OnNumber(double value)                       override { Count[2]++; Sum += value; return Count[2] < StopNumber; }
+		bool OnString(std::string_view, bool)             override { Count[3]++; return true; }
+		bool OnKey   (std::string_view key, bool)         override { Count[4]++; Keys += key; return true; }
+		bool OnEndObject(std::uint32_t memberCount)       override { Count[5]++; Members += memberCount; return true; }
+		bool OnEndArray (std::uint32_t elementCount)      override { Count[6]++; Elements += elementCount; return true; }
+		int    Count[7]   = {};
+		double Sum        = 0.0;
+		int    StopNumber = 1 << 30;
+		std::uint32_t Members = 0, Elements = 0;
+		std::string   Keys;
+	};
+
+	void CheckSaxAndJsonValue()
+	{
+		const std::string text = "{\"a\":[1,2,3,null,true,\"s\"],\"b\":{\"c\":4.5,\"d\":false},\"e\":\"t\"}";
+		CountHandler handler;
+		TEST_CHECK(JsonDocument::ParseSax(text.data(), text.size(), handler));
+		TEST_CHECK(handler.Count[0] == 1 && handler.Count[1] == 2 && handler.Count[2] == 4 && handler.Count[3] == 2);
+		TEST_CHECK(handler.Count[4] == 5 && handler.Keys == "abcde" && handler.Count[5] == 2 && handler.Count[6] == 1);
+		TEST_CHECK(handler.Members == 5 && handler.Elements == 6 && handler.Sum == 10.5);
+
+		CountHandler stop;
+		stop.StopNumber = 2;
+		TEST_CHECK(!JsonDocument::ParseSax(text.data(), text.size(), stop) && stop.Count[2] == 2);
+
+		JsonValue value = JsonValue().Parse(text.c_str());
+		TEST_CHECK(value.Type == JsonValueType::Object && value.object.size() == 3);
+		TEST_CHECK(value.object["a"].Type == JsonValueType::Array && value.object["a"].array.size() == 6);
+		TEST_CHECK(value.object["a"].array[3].Type == JsonValueType::Null && value.object["a"].array[4].boolean);
+		TEST_CHECK(value.object["b"].object["c"].number == 4.5 && value.object["e"].string == "t");
+	}
+
+	/*---------------------------------------------------------------------------
+	-   About 8 MB of scene like json (objects with transforms, names and tags)
+	---------------------------------------------------------------------------*/
+	std::string MakeScene(size_t targetByteSize)
+	{
+		test::Random random(3900);
+		std::string text = "{\"version\":2,\"gameObjects\":[";
+		char buffer[512];
+		for (int i = 0; text.size() < targetByteSize; ++i)
+		{
+			std::snprintf(buffer, sizeof(buffer),
+				"%s{\"name\":\"GameObject_%d\",\"active\":%s,\"parent\":%d,\"tag\":\"Enemy\\tGroup %u\",\n"
+				" \"position\":[%.6f,%.6f,%.6f],\"rotation\":[%.6f,%.6f,%.6f,%.6f],\"scale\":[1,1,1],\n"
+				" \"components\":[{\"type\":\"MeshRenderer\",\"mesh\":\"Resources/Model/Mesh_%u.pmx\",\"castShadow\":true},"
+				"{\"type\":\"Collider\",\"radius\":%.3f,\"layer\":null}]}",
+				i == 0 ? "" : ",", i, random.Bool() ? "true" : "false", static_cast<int>(random.Range(1000)) - 1, random.Range(16),
+				random.Float(-100.0f, 100.0f), random.Float(-100.0f, 100.0f), random.Float(-100.0f, 100.0f),
+				random.Float(-1.0f, 1.0f), random.Float(-1.0f, 1.0f), random.Float(-1.0f, 1.0f), random.Float(-1.0f, 1.0f),
+				random.Range(300), random.Float(0.1f, 5.0f));
+			text += buffer;
+		}
+		text += "]}";
+		return text;
+	}
+
+	void Bench()
+	{
+		const std::string text  = MakeScene(8 * 1024 * 1024);
+		const int         round = 5 * test::BenchScale();
+		const double      megaBytes = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+		char label[96];
+
+		auto report = [&](const char* name, double ms)
+		{
+			std::snprintf(label, sizeof(label), "%.1f MB scene : %s", megaBytes, name);
+			test::PrintBench(label, ms, text.size() * round, "byte");
+			std::printf("[BENCH] %.1f MB scene : %s %.1f MB/s\n", megaBytes, name, megaBytes * round / (ms / 1000.0));
+		};
+
+		JsonDocument document;
+		test::Timer timer;
+		for (int r = 0; r < round; ++r)
+		{
+			TEST_CHECK(document.Parse(text));
+			test::DoNotOptimize(document.GetRoot());
+		}
+		report("JsonDocument DOM", timer.ElapsedMs());
+		TEST_CHECK(document.GetRoot().Find("gameObjects") != nullptr && document.GetRoot().Find("gameObjects")->Size() > 10000);
+
+		CountHandler handler;
+		timer.Reset();
+		for (int r = 0; r < round; ++r) { TEST_CHECK(JsonDocument::ParseSax(text.data(), text.size(), handler)); }
+		report("JsonDocument SAX", timer.ElapsedMs());
+
+		timer.Reset();
+		for (int r = 0; r < round; ++r)
+		{
+			JsonValue value = JsonValue().Parse(text.c_str());
+			test::DoNotOptimize(value.Type);
+		}
+		report("JsonValue (std::map)", timer.ElapsedMs());
+	}
+}
+
+int main()
+{
+	CheckValues();
+	CheckStringScan();
+	CheckLookup();
+	CheckErrors();
+	CheckSaxAndJsonValue();
+	Bench();
+	return TEST_RESULT();
+}
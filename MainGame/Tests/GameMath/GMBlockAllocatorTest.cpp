@@ -0,0 +1,367 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMBlockAllocatorTest.cpp
+///             @brief  BlockAllocator / PoolAllocator : limits, multithreaded stress and
+///                     the throughput against the previous mutex pool allocator
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMBlockAllocator.hpp"
+#include "GameMath/Include/GMPoolAllocator.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/****************************************************************************
+	*				  			MutexPoolAllocator
+	*************************************************************************//**
+	*  @class     MutexPoolAllocator
+	*  @brief     The previous PoolAllocator (one free list guarded by a mutex), kept as the baseline
+	*****************************************************************************/
+	class MutexPoolAllocator
+	{
+	public:
+		void* Allocate()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			void* result = _firstFree;
+			if (result != nullptr) { _firstFree = *static_cast<void**>(result); }
+			return result;
+		}
+		void FreeMemory(void* ptr)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			*static_cast<void**>(ptr) = _firstFree;
+			_firstFree = ptr;
+		}
+
+		MutexPoolAllocator(size_t elementSize, size_t maxElementCount) : _pool(elementSize * maxElementCount)
+		{
+			for (size_t i = 0; i < maxElementCount; ++i)
+			{
+				*reinterpret_cast<void**>(&_pool[i * elementSize]) = i + 1 < maxElementCount ? &_pool[(i + 1) * elementSize] : nullptr;
+			}
+			_firstFree = _pool.data();
+		}
+	private:
+		std::vector<unsigned char> _pool;
+		void*      _firstFree = nullptr;
+		std::mutex _mutex;
+	};
+
+	/* payload written to every allocated block and checked before it is freed */
+	struct Payload
+	{
+		std::uint64_t Owner;
+		std::uint64_t Serial;
+		std::uint64_t Check;
+	};
+
+	void Write(void* block, std::uint64_t owner, std::uint64_t serial)
+	{
+		Payload* payload = static_cast<Payload*>(block);
+		payload->Owner  = owner;
+		payload->Serial = serial;
+		payload->Check  = owner * 0x9E3779B97F4A7C15ull ^ serial;
+	}
+
+	bool IsIntact(const void* block)
+	{
+		const Payload* payload = static_cast<const Payload*>(block);
+		return payload->Check == (payload->Owner * 0x9E3779B97F4A7C15ull ^ payload->Serial);
+	}
+
+	int GetThreadCount()
+	{
+		const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+		return std::max(4, std::min(hardware, 8));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   maxBlockCount limit, alignment, Owns, reuse and the statistics
+	---------------------------------------------------------------------------*/
+	void CheckBlockAllocator()
+	{
+		BlockAllocator allocator(24, 16, 100, 4096, 32);
+		TEST_CHECK(allocator.GetBlockSize() == 32);
+
+		std::vector<void*> blocks;
+		for (void* block = allocator.Allocate(); block != nullptr; block = allocator.Allocate())
+		{
+			blocks.push_back(block);
+		}
+		TEST_CHECK_MESSAGE(blocks.size() == 100, "%zu blocks", blocks.size());
+		TEST_CHECK(allocator.GetCapacity() == 100);
+		TEST_CHECK(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+
+		bool aligned = true, owned = true;
+		for (void* block : blocks)
+		{
+			aligned = aligned && (reinterpret_cast<std::uintptr_t>(block) % 32) == 0;
+			owned   = owned && allocator.Owns(block);
+		}
+		TEST_CHECK(aligned);
+		TEST_CHECK(owned);
+
+		int outside = 0;
+		TEST_CHECK(!allocator.Owns(&outside));
+		TEST_CHECK(!allocator.Owns(static_cast<unsigned char*>(blocks[0]) + 8));
+
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+		TEST_CHECK(allocator.GetLiveCount() == 100 && allocator.GetHighWaterMark() == 100);
+#endif
+		/*-------------------------------------------------------------------
+		-        Freed blocks are reused without a new page
+		---------------------------------------------------------------------*/
+		const std::uint32_t pageCount = allocator.GetPageCount();
+		for (void* block : blocks) { allocator.Free(block); }
+		std::vector<void*> reused;
+		for (void* block = allocator.Allocate(); block != nullptr; block = allocator.Allocate())
+		{
+			reused.push_back(block);
+		}
+		std::sort(blocks.begin(), blocks.end());
+		std::sort(reused.begin(), reused.end());
+		TEST_CHECK(reused == blocks);
+		TEST_CHECK(allocator.GetPageCount() == pageCount);
+
+		/*-------------------------------------------------------------------
+		-        LocalCache returns its blocks on Flush / destruction
+		---------------------------------------------------------------------*/
+		for (void* block : reused) { allocator.Free(block); }
+		{
+			BlockAllocator::LocalCache cache(allocator);
+			void* block = allocator.Allocate(cache);
+			TEST_CHECK(block != nullptr && cache.GetCachedCount() > 0);
+			allocator.Free(cache, block);
+		}
+		size_t count = 0;
+		for (void* block = allocator.Allocate(); block != nullptr; block = allocator.Allocate()) { ++count; }
+		TEST_CHECK_MESSAGE(count == 100, "%zu blocks after the cache was destroyed", count);
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+		TEST_CHECK(allocator.GetLiveCount() == 100 && allocator.GetHighWaterMark() == 100);
+#endif
+	}
+
+	void CheckPoolAllocator()
+	{
+		PoolAllocator pool(40, 10);
+		std::vector<void*> elements;
+		for (int i = 0; i < 10; ++i) { elements.push_back(pool.Allocate(40)); }
+		TEST_CHECK(std::find(elements.begin(), elements.end(), nullptr) == elements.end());
+		TEST_CHECK(pool.Allocate(40) == nullptr);
+		TEST_CHECK(pool.GetUsedCount() == 10 && pool.GetFreeCount() == 0);
+
+		int outside = 0;
+		TEST_CHECK(pool.ValidPtr(elements[3]));
+		TEST_CHECK(!pool.ValidPtr(&outside) && !pool.ValidPtr(nullptr));
+
+		pool.FreeMemory(elements[3]);
+		TEST_CHECK(pool.GetUsedCount() == 9);
+		TEST_CHECK(pool.Allocate(40) == elements[3]);
+		for (void* element : elements) { pool.FreeMemory(element); }
+		TEST_CHECK(pool.GetUsedCount() == 0 && pool.GetFreeCount() == 10);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Every thread allocates / frees at random with its LocalCache (or without one).
+	-   A part of the blocks is freed by another thread through a shared exchange list.
+	-   A block given to two owners breaks the payload of one of them.
+	---------------------------------------------------------------------------*/
+	void CheckMultiThread()
+	{
+		const int threadCount = GetThreadCount();
+		const int iteration   = 40000;
+		const size_t maxBlockCount = 1 << 16;
+		BlockAllocator allocator(sizeof(Payload), 64, maxBlockCount);
+
+		std::mutex         exchangeMutex;
+		std::vector<void*> exchange;
+		std::atomic<int>   broken { 0 };
+		std::atomic<int>   failedAllocation { 0 };
+
+		auto worker = [&](int threadID)
+		{
+			BlockAllocator::LocalCache cache(allocator);
+			const bool useCache = threadID % 2 == 0;
+			test::Random random(1000 + threadID);
+			std::vector<void*> live;
+
+			auto release = [&](void* block)
+			{
+				if (!IsIntact(block)) { broken++; }
+				Write(block, 0, 0);
+				if (useCache) { allocator.Free(cache, block); }
+				else          { allocator.Free(block); }
+			};
+
+			for (int i = 0; i < iteration; ++i)
+			{
+				const std::uint32_t action = random.Range(10);
+				if (action < 5 || live.empty())
+				{
+					void* block = useCache ? allocator.Allocate(cache) : allocator.Allocate();
+					if (block == nullptr) { failedAllocation++; continue; }
+					Write(block, threadID + 1, i);
+					live.push_back(block);
+				}
+				else
+				{
+					const size_t index = random.Range(static_cast<std::uint32_t>(live.size()));
+					void* block = live[index];
+					live[index] = live.back();
+					live.pop_back();
+
+					if (action == 9)
+					{
+						std::lock_guard<std::mutex> lock(exchangeMutex);
+						exchange.push_back(block);
+						continue;
+					}
+					release(block);
+				}
+
+				/* free the blocks of the other threads */
+				if ((i & 255) == 0)
+				{
+					std::vector<void*> others;
+					{
+						std::lock_guard<std::mutex> lock(exchangeMutex);
+						others.swap(exchange);
+					}
+					for (void* block : others) { release(block); }
+				}
+			}
+			for (void* block : live) { release(block); }
+		};
+
+		std::vector<std::thread> threads;
+		for (int i = 0; i < threadCount; ++i) { threads.emplace_back(worker, i); }
+		for (std::thread& thread : threads) { thread.join(); }
+		for (void* block : exchange)
+		{
+			if (!IsIntact(block)) { broken++; }
+			allocator.Free(block);
+		}
+
+		TEST_CHECK_MESSAGE(broken.load() == 0, "%d block(s) shared by two owners", broken.load());
+		TEST_CHECK(failedAllocation.load() == 0);
+#ifdef GM_BLOCK_ALLOCATOR_STATISTICS
+		TEST_CHECK_MESSAGE(allocator.GetLiveCount() == 0, "%lld live blocks", static_cast<long long>(allocator.GetLiveCount()));
+#endif
+
+		/*-------------------------------------------------------------------
+		-        Every block is back in the free stack exactly once
+		---------------------------------------------------------------------*/
+		std::set<void*> all;
+		size_t count = 0;
+		for (void* block = allocator.Allocate(); block != nullptr; block = allocator.Allocate())
+		{
+			all.insert(block);
+			++count;
+		}
+		TEST_CHECK_MESSAGE(all.size() == count && count == maxBlockCount, "%zu unique of %zu blocks", all.size(), count);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Allocate / free bursts of 32 blocks on every thread
+	---------------------------------------------------------------------------*/
+	template<class Allocate, class Free>
+	double RunBench(int threadCount, int iteration, Allocate&& allocate, Free&& free)
+	{
+		std::atomic<int> ready { 0 };
+		std::atomic<bool> start { false };
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				void* blocks[32];
+				auto context = allocate.MakeContext();
+				ready++;
+				while (!start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+				for (int i = 0; i < iteration; ++i)
+				{
+					for (int j = 0; j < 32; ++j) { blocks[j] = allocate(context); test::DoNotOptimize(blocks[j]); }
+					for (int j = 0; j < 32; ++j) { free(context, blocks[j]); }
+				}
+			});
+		}
+		while (ready.load() < threadCount) { std::this_thread::yield(); }
+		test::Timer timer;
+		start.store(true, std::memory_order_release);
+		for (std::thread& thread : threads) { thread.join(); }
+		return timer.ElapsedMs();
+	}
+
+	struct NoContext { int Dummy = 0; };
+
+	void Bench()
+	{
+		const int iteration = 20000 * test::BenchScale();
+		const size_t size   = 64;
+
+		for (const int threadCount : { 1, GetThreadCount() })
+		{
+			const std::uint64_t count = static_cast<std::uint64_t>(threadCount) * iteration * 32;
+			char name[64];
+
+			{
+				MutexPoolAllocator pool(size, 32 * threadCount);
+				struct { MutexPoolAllocator* Pool; NoContext MakeContext() { return {}; } void* operator()(NoContext&) { return Pool->Allocate(); } } allocate{ &pool };
+				const double ms = RunBench(threadCount, iteration, allocate, [&](NoContext&, void* p) { pool.FreeMemory(p); });
+				std::snprintf(name, sizeof(name), "mutex pool (old) : %d thread(s)", threadCount);
+				test::PrintBench(name, ms, count, "alloc+free");
+			}
+			{
+				BlockAllocator allocator(size);
+				struct { BlockAllocator* Allocator; NoContext MakeContext() { return {}; } void* operator()(NoContext&) { return Allocator->Allocate(); } } allocate{ &allocator };
+				const double ms = RunBench(threadCount, iteration, allocate, [&](NoContext&, void* p) { allocator.Free(p); });
+				std::snprintf(name, sizeof(name), "BlockAllocator : %d thread(s)", threadCount);
+				test::PrintBench(name, ms, count, "alloc+free");
+			}
+			{
+				BlockAllocator allocator(size);
+				struct
+				{
+					BlockAllocator* Allocator;
+					std::unique_ptr<BlockAllocator::LocalCache> MakeContext() { return std::make_unique<BlockAllocator::LocalCache>(*Allocator); }
+					void* operator()(std::unique_ptr<BlockAllocator::LocalCache>& cache) { return Allocator->Allocate(*cache); }
+				} allocate{ &allocator };
+				const double ms = RunBench(threadCount, iteration, allocate, [&](std::unique_ptr<BlockAllocator::LocalCache>& cache, void* p) { allocator.Free(*cache, p); });
+				std::snprintf(name, sizeof(name), "BlockAllocator + LocalCache : %d thread(s)", threadCount);
+				test::PrintBench(name, ms, count, "alloc+free");
+			}
+			{
+				struct { NoContext MakeContext() { return {}; } void* operator()(NoContext&) { return std::malloc(64); } } allocate;
+				const double ms = RunBench(threadCount, iteration, allocate, [](NoContext&, void* p) { std::free(p); });
+				std::snprintf(name, sizeof(name), "malloc : %d thread(s)", threadCount);
+				test::PrintBench(name, ms, count, "alloc+free");
+			}
+		}
+	}
+}
+
+/* "stress" : skip the benchmark (used by the thread sanitizer build) */
+int main(int argc, char** argv)
+{
+	CheckBlockAllocator();
+	CheckPoolAllocator();
+	CheckMultiThread();
+	if (argc < 2 || std::strcmp(argv[1], "stress") != 0) { Bench(); }
+	return TEST_RESULT();
+}
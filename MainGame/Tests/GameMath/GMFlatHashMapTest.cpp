@@ -0,0 +1,221 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMFlatHashMapTest.cpp
+///             @brief  FlatHashMap : random operations against std::unordered_map and
+///                     insert / lookup / erase heavy benchmarks (gm::HashMap, std::map, std::unordered_map)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMFlatHashMap.hpp"
+#include "GameMath/Include/GMHashMap.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/*---------------------------------------------------------------------------
+	-   Random insert / overwrite / erase / find compared with std::unordered_map
+	---------------------------------------------------------------------------*/
+	void CheckAgainstUnorderedMap(bool incrementalRehash)
+	{
+		test::Random random(incrementalRehash ? 320 : 32);
+		FlatHashMap<int, int>        map;
+		std::unordered_map<int, int> reference;
+		map.SetIncrementalRehash(incrementalRehash, 8);
+
+		int failed = 0;
+		for (int i = 0; i < 400000; ++i)
+		{
+			const int key = static_cast<int>(random.Range(20000));
+			switch (random.Range(4))
+			{
+				case 0:
+				{
+					const bool inserted = map.TryEmplace(key, i).second;
+					if (inserted != reference.emplace(key, i).second) { failed++; }
+					break;
+				}
+				case 1:
+					map.InsertOrAssign(key, i);
+					reference[key] = i;
+					break;
+				case 2:
+					if (map.Erase(key) != (reference.erase(key) == 1)) { failed++; }
+					break;
+				default:
+				{
+					const int* value = map.Find(key);
+					const auto found = reference.find(key);
+					if ((value != nullptr) != (found != reference.end()) || (value != nullptr && *value != found->second)) { failed++; }
+					break;
+				}
+			}
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "%d operation(s) differ (incremental rehash %d)", failed, incrementalRehash);
+		TEST_CHECK(map.Size() == reference.size());
+
+		size_t visited = 0;
+		map.ForEach([&](const int& key, int& value) { visited++; if (reference.at(key) != value) { failed++; } });
+		TEST_CHECK(visited == reference.size() && failed == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   string_view / wstring keys, move only values, copy, Clear and Reserve
+	---------------------------------------------------------------------------*/
+	void CheckKeysAndValues()
+	{
+		FlatHashMap<std::string, int> names;
+		names.TryEmplace(std::string("センター"), 1);
+		names.TryEmplace("全ての親", 2);
+		TEST_CHECK(names.Find(std::string_view("全ての親")) != nullptr && *names.Find("全ての親") == 2);
+		TEST_CHECK(names.Find("左足先EX") == nullptr);
+
+		FlatHashMap<std::string, int> copy(names);
+		copy.Erase("センター");
+		TEST_CHECK(copy.Size() == 1 && names.Size() == 2 && names.Contains("センター"));
+
+		FlatHashMap<std::wstring, std::unique_ptr<int>> resources;
+		resources[std::wstring(L"Resources/Texture/a.png")] = std::make_unique<int>(7);
+		for (int i = 0; i < 1000; ++i) { resources[L"Resources/Model/" + std::to_wstring(i)] = std::make_unique<int>(i); }
+		const std::unique_ptr<int>* texture = resources.Find(std::wstring_view(L"Resources/Texture/a.png"));
+		TEST_CHECK(texture != nullptr && **texture == 7);
+		int sum = 0;
+		resources.ForEach([&](const std::wstring&, std::unique_ptr<int>& value) { sum += *value; });
+		TEST_CHECK(sum == 7 + 999 * 1000 / 2);
+		resources.Clear();
+		TEST_CHECK(resources.IsEmpty() && resources.Find(L"Resources/Texture/a.png") == nullptr);
+
+		FlatHashMap<int, int> reserved;
+		reserved.Reserve(1000);
+		const size_t capacity = reserved.GetCapacity();
+		for (int i = 0; i < 1000; ++i) { reserved.TryEmplace(i, i); }
+		TEST_CHECK(reserved.GetCapacity() == capacity);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   insert heavy / lookup heavy / erase heavy on 200k int and string keys
+	---------------------------------------------------------------------------*/
+	struct BenchKeys
+	{
+		std::vector<int>         Ints;
+		std::vector<std::string> Strings;
+		std::vector<int>         LookupOrder;
+	};
+
+	BenchKeys MakeKeys(size_t count)
+	{
+		BenchKeys keys;
+		test::Random random(3200);
+		for (size_t i = 0; i < count; ++i)
+		{
+			keys.Ints.push_back(static_cast<int>(random.Next() & 0x3FFFFFFF));
+			keys.Strings.push_back("Bone_" + std::to_string(random.Next() % 100000000) + "_" + std::to_string(i));
+			keys.LookupOrder.push_back(static_cast<int>(random.Range(static_cast<std::uint32_t>(count))));
+		}
+		return keys;
+	}
+
+	template<class Insert, class Lookup, class Erase>
+	void RunBench(const char* name, size_t count, Insert&& insert, Lookup&& lookup, Erase&& erase)
+	{
+		const int lookupRound = 5;
+		char label[96];
+		test::Timer timer;
+		for (size_t i = 0; i < count; ++i) { insert(i); }
+		std::snprintf(label, sizeof(label), "%s : insert", name);
+		test::PrintBench(label, timer.ElapsedMs(), count, "op");
+
+		timer.Reset();
+		size_t found = 0;
+		for (int round = 0; round < lookupRound; ++round)
+		{
+			for (size_t i = 0; i < count; ++i) { found += lookup(i); }
+		}
+		test::DoNotOptimize(found);
+		std::snprintf(label, sizeof(label), "%s : lookup", name);
+		test::PrintBench(label, timer.ElapsedMs(), count * lookupRound, "op");
+
+		timer.Reset();
+		for (size_t i = 0; i < count; ++i) { erase(i); }
+		std::snprintf(label, sizeof(label), "%s : erase", name);
+		test::PrintBench(label, timer.ElapsedMs(), count, "op");
+	}
+
+	void Bench()
+	{
+		const size_t    count = 200000 * static_cast<size_t>(test::BenchScale());
+		const BenchKeys keys  = MakeKeys(count);
+		const auto& ints      = keys.Ints;
+		const auto& strings   = keys.Strings;
+		const auto& order     = keys.LookupOrder;
+
+		{
+			FlatHashMap<int, int> map;
+			RunBench("int    FlatHashMap", count, [&](size_t i) { map.TryEmplace(ints[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.Find(ints[order[i]]) != nullptr; }, [&](size_t i) { map.Erase(ints[i]); });
+		}
+		{
+			FlatHashMap<int, int> map;
+			map.SetIncrementalRehash(true);
+			RunBench("int    FlatHashMap (incremental)", count, [&](size_t i) { map.TryEmplace(ints[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.Find(ints[order[i]]) != nullptr; }, [&](size_t i) { map.Erase(ints[i]); });
+		}
+		{
+			HashMap<HashInt, int> map;
+			RunBench("int    gm::HashMap", count, [&](size_t i) { map.insert(HashInt(ints[i]), static_cast<int>(i)); },
+				[&](size_t i) { return map.find(HashInt(ints[order[i]])) != nullptr; }, [&](size_t i) { map.remove(HashInt(ints[i])); });
+		}
+		{
+			std::unordered_map<int, int> map;
+			RunBench("int    std::unordered_map", count, [&](size_t i) { map.emplace(ints[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.find(ints[order[i]]) != map.end(); }, [&](size_t i) { map.erase(ints[i]); });
+		}
+		{
+			std::map<int, int> map;
+			RunBench("int    std::map", count, [&](size_t i) { map.emplace(ints[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.find(ints[order[i]]) != map.end(); }, [&](size_t i) { map.erase(ints[i]); });
+		}
+
+		{
+			FlatHashMap<std::string, int> map;
+			RunBench("string FlatHashMap", count, [&](size_t i) { map.TryEmplace(strings[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.Find(std::string_view(strings[order[i]])) != nullptr; }, [&](size_t i) { map.Erase(strings[i]); });
+		}
+		{
+			/* gm::HashMap needs a HashString (copy + hash) for every call, same as the engine code */
+			HashMap<HashString, int> map;
+			RunBench("string gm::HashMap", count, [&](size_t i) { map.insert(HashString(strings[i].c_str()), static_cast<int>(i)); },
+				[&](size_t i) { return map.find(HashString(strings[order[i]].c_str())) != nullptr; }, [&](size_t i) { map.remove(HashString(strings[i].c_str())); });
+		}
+		{
+			std::unordered_map<std::string, int> map;
+			RunBench("string std::unordered_map", count, [&](size_t i) { map.emplace(strings[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.find(strings[order[i]]) != map.end(); }, [&](size_t i) { map.erase(strings[i]); });
+		}
+		{
+			std::map<std::string, int> map;
+			RunBench("string std::map", count, [&](size_t i) { map.emplace(strings[i], static_cast<int>(i)); },
+				[&](size_t i) { return map.find(strings[order[i]]) != map.end(); }, [&](size_t i) { map.erase(strings[i]); });
+		}
+	}
+}
+
+int main()
+{
+	CheckAgainstUnorderedMap(false);
+	CheckAgainstUnorderedMap(true);
+	CheckKeysAndValues();
+	Bench();
+	return TEST_RESULT();
+}
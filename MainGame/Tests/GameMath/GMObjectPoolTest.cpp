@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMObjectPoolTest.cpp
+///             @brief  ObjectPool : exhaustion, swap remove of ReleaseAt / ReleaseIf against a reference,
+///                     stale handles after reacquire, and iteration of the live objects without allocation
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMObjectPool.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------------------
+-   Every allocation of the executable is counted
+---------------------------------------------------------------------------*/
+namespace { size_t g_AllocationCount = 0; }
+
+void* operator new(std::size_t size)
+{
+	++g_AllocationCount;
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) { return pointer; }
+	throw std::bad_alloc();
+}
+void operator delete(void* pointer) noexcept              { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+namespace
+{
+	struct Bullet
+	{
+		int  ID     = 0;
+		bool IsLive = false; // set by the test while the bullet is acquired
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Acquire every object, then nullptr
+	---------------------------------------------------------------------------*/
+	void CheckExhaustion()
+	{
+		std::vector<Bullet> bullets(64);
+		ObjectPool<Bullet>  pool;
+		for (Bullet& bullet : bullets) { pool.Register(&bullet); }
+		TEST_CHECK(pool.GetCapacity() == 64 && pool.GetFreeCount() == 64 && pool.GetActiveCount() == 0);
+
+		std::vector<Bullet*> acquired;
+		while (Bullet* bullet = pool.Acquire()) { acquired.push_back(bullet); }
+		std::sort(acquired.begin(), acquired.end());
+		TEST_CHECK(acquired.size() == 64 && std::unique(acquired.begin(), acquired.end()) == acquired.end());
+		TEST_CHECK(pool.GetFreeCount() == 0 && pool.GetActiveCount() == 64);
+
+		ObjectPoolHandle handle;
+		TEST_CHECK(pool.Acquire(&handle) == nullptr && handle.Index == OBJECT_POOL_INVALID_INDEX);
+
+		pool.ReleaseAll();
+		TEST_CHECK(pool.GetFreeCount() == 64 && pool.GetActiveCount() == 0 && pool.Acquire() != nullptr);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   ReleaseAt moves the last object into the hole
+	---------------------------------------------------------------------------*/
+	void CheckSwapRemove()
+	{
+		std::vector<Bullet> bullets(8);
+		ObjectPool<Bullet>  pool;
+		ObjectPoolHandle    handles[8];
+		for (Bullet& bullet : bullets) { pool.Register(&bullet); }
+		for (ObjectPoolHandle& handle : handles) { pool.Acquire(&handle); }
+
+		const std::vector<Bullet*>& active = pool.GetActiveObjects();
+		Bullet* const last     = active.back();
+		Bullet* const released = active[2];
+		pool.ReleaseAt(2);
+		TEST_CHECK(active.size() == 7 && active[2] == last);
+		TEST_CHECK(std::find(active.begin(), active.end(), released) == active.end());
+
+		/* the handle of the moved object still finds it, the released one does not */
+		int validCount = 0;
+		for (const ObjectPoolHandle& handle : handles)
+		{
+			validCount += pool.IsValid(handle);
+			TEST_CHECK(pool.Get(handle) != released && (pool.Get(handle) != nullptr) == pool.IsValid(handle));
+		}
+		TEST_CHECK(validCount == 7);
+
+		/* release of the last element itself */
+		pool.ReleaseAt(active.size() - 1);
+		TEST_CHECK(active.size() == 6);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random Acquire / Release / ReleaseAt / ReleaseIf against the set of live bullets
+	---------------------------------------------------------------------------*/
+	bool IsConsistent(const ObjectPool<Bullet>& pool, const std::vector<Bullet>& bullets,
+		const std::vector<ObjectPoolHandle>& handles)
+	{
+		size_t liveCount = 0;
+		for (const Bullet& bullet : bullets) { liveCount += bullet.IsLive; }
+
+		std::vector<Bullet*> active = pool.GetActiveObjects();
+		std::sort(active.begin(), active.end());
+		if (active.size() != liveCount || std::unique(active.begin(), active.end()) != active.end()) { return false; }
+		for (Bullet* bullet : active) { if (!bullet->IsLive) { return false; } }
+		if (pool.GetActiveCount() + pool.GetFreeCount() != pool.GetCapacity()) { return false; }
+
+		/* handles[id] is the handle of the last acquire of bullets[id] */
+		for (size_t id = 0; id < bullets.size(); ++id)
+		{
+			if (pool.IsValid(handles[id]) != bullets[id].IsLive) { return false; }
+			if (bullets[id].IsLive && pool.Get(handles[id]) != &bullets[id]) { return false; }
+		}
+		return true;
+	}
+
+	void CheckAgainstReference()
+	{
+		test::Random random(29);
+		std::vector<Bullet>           bullets(200);
+		std::vector<ObjectPoolHandle> handles(bullets.size());
+		ObjectPool<Bullet>            pool;
+		for (size_t i = 0; i < bullets.size(); ++i)
+		{
+			bullets[i].ID = static_cast<int>(i);
+			pool.Register(&bullets[i]);
+		}
+
+		int failed = 0;
+		for (int step = 0; step < 20000; ++step)
+		{
+			switch (random.Range(5))
+			{
+				case 0: case 1:
+				{
+					ObjectPoolHandle handle;
+					if (Bullet* bullet = pool.Acquire(&handle))
+					{
+						failed += bullet->IsLive;
+						bullet->IsLive      = true;
+						handles[bullet->ID] = handle;
+					}
+					else { failed += pool.GetActiveCount() != bullets.size(); }
+					break;
+				}
+				case 2:
+				{
+					const size_t id = random.Range(static_cast<std::uint32_t>(bullets.size()));
+					failed += pool.Release(handles[id]) != bullets[id].IsLive;
+					bullets[id].IsLive = false;
+					break;
+				}
+				case 3:
+				{
+					if (pool.GetActiveCount() == 0) { break; }
+					const size_t index = random.Range(static_cast<std::uint32_t>(pool.GetActiveCount()));
+					pool.GetActiveObjects()[index]->IsLive = false;
+					pool.ReleaseAt(index);
+					break;
+				}
+				default:
+				{
+					/* release every third id, including the objects swapped into the current index */
+					const int remainder = static_cast<int>(random.Range(3));
+					pool.ReleaseIf([&](Bullet* bullet)
+					{
+						if (bullet->ID % 3 != remainder) { return false; }
+						bullet->IsLive = false;
+						return true;
+					});
+					for (Bullet* bullet : pool.GetActiveObjects()) { failed += bullet->ID % 3 == remainder; }
+					break;
+				}
+			}
+			if (!IsConsistent(pool, bullets, handles) && failed++ < 4) { std::printf("  inconsistent at step %d\n", step); }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "%d failure(s)", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A handle to a released slot stays invalid after the slot is acquired again
+	---------------------------------------------------------------------------*/
+	void CheckStaleHandle()
+	{
+		Bullet bullets[2];
+		ObjectPool<Bullet> pool;
+		pool.Register(&bullets[0]);
+		pool.Register(&bullets[1]);
+
+		ObjectPoolHandle first, second, other;
+		pool.Acquire(&other);
+		Bullet* const object = pool.Acquire(&first);
+		TEST_CHECK(pool.Release(first));
+		TEST_CHECK(pool.Acquire(&second) == object); // the same slot comes back
+		TEST_CHECK(second.Index == first.Index && second.Generation != first.Generation && second != first);
+
+		TEST_CHECK(!pool.IsValid(first) && pool.Get(first) == nullptr);
+		TEST_CHECK(!pool.Release(first));                        // the stale handle can not release the new owner
+		TEST_CHECK(pool.IsValid(second) && pool.Get(second) == object && pool.GetActiveCount() == 2);
+		TEST_CHECK(pool.IsValid(other));
+
+		ObjectPoolHandle none;
+		TEST_CHECK(!pool.IsValid(none) && pool.Get(none) == nullptr);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A frame of a reserved pool : acquire, update the live objects, release the dead ones.
+	-   Only the live objects are touched, and nothing is allocated.
+	---------------------------------------------------------------------------*/
+	void CheckIterationWithoutAllocation()
+	{
+		test::Random random(290);
+		std::vector<Bullet> bullets(1024);
+		ObjectPool<Bullet>  pool;
+		pool.Reserve(bullets.size());
+		for (size_t i = 0; i < bullets.size(); ++i)
+		{
+			bullets[i].ID = static_cast<int>(i);
+			pool.Register(&bullets[i]);
+		}
+
+		const size_t allocationCount = g_AllocationCount;
+		int touchedDead = 0;
+		for (int frame = 0; frame < 200; ++frame)
+		{
+			const int spawnCount = static_cast<int>(random.Range(64));
+			for (int i = 0; i < spawnCount; ++i)
+			{
+				if (Bullet* bullet = pool.Acquire()) { bullet->IsLive = true; }
+			}
+			for (Bullet* bullet : pool.GetActiveObjects())
+			{
+				touchedDead += !bullet->IsLive;
+			}
+			pool.ReleaseIf([&](Bullet* bullet)
+			{
+				if (random.Range(8) != 0) { return false; }
+				bullet->IsLive = false;
+				return true;
+			});
+		}
+		TEST_CHECK_MESSAGE(g_AllocationCount == allocationCount, "%zu allocation(s)", g_AllocationCount - allocationCount);
+		TEST_CHECK(touchedDead == 0 && pool.GetActiveCount() > 0);
+	}
+}
+
+int main()
+{
+	CheckExhaustion();
+	CheckSwapRemove();
+	CheckStaleHandle();
+	CheckAgainstReference();
+	CheckIterationWithoutAllocation();
+	return TEST_RESULT();
+}
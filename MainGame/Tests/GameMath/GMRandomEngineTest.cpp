@@ -0,0 +1,326 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMRandomEngineTest.cpp
+///             @brief  RandomEngine : known answers of the seeded and jumped streams, bulk Fill == the same
+///                     number of Next calls (from any position of the step buffer), range bounds,
+///                     direction samplers, and the throughput against std::mt19937 + std distributions
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMRandomEngine.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr std::uint64_t SEED = 20261018ull;
+
+	/*---------------------------------------------------------------------------
+	-   The first 8 values of RandomEngine(SEED, stream). The same on every backend.
+	---------------------------------------------------------------------------*/
+	constexpr std::uint32_t KnownValues[4][8] =
+	{
+		{ 0xf73cc5cbu, 0x8e057ffdu, 0x4c6aac2au, 0x4e5e96f0u, 0x1d804214u, 0x141c7d87u, 0x7180d2c1u, 0x3d52cf91u },
+		{ 0xb737a9e8u, 0x26f7f6deu, 0x73d4a4a4u, 0x5afa9c1du, 0xc674b63fu, 0xbadba46du, 0xd11d3a30u, 0xe5852c6cu },
+		{ 0x7bcb19fdu, 0xfa1c8eb9u, 0x94fa29ceu, 0xacfe8bc7u, 0x2f2bd5e1u, 0xb1899f94u, 0x8d4d5c85u, 0x60c00718u },
+		{ 0x5b976e85u, 0x17e0091eu, 0x973716abu, 0x2d511d0eu, 0xffaf0b20u, 0x15e240c5u, 0x60e36d24u, 0x80202a21u },
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Reference xoshiro128+ (one state, as published) with the splitmix64 seeding
+	---------------------------------------------------------------------------*/
+	struct Xoshiro128Plus
+	{
+		std::uint32_t S[4];
+
+		explicit Xoshiro128Plus(std::uint64_t seed)
+		{
+			for (int i = 0; i < 2; ++i)
+			{
+				std::uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				z =  z ^ (z >> 31);
+				S[i * 2 + 0] = static_cast<std::uint32_t>(z);
+				S[i * 2 + 1] = static_cast<std::uint32_t>(z >> 32);
+			}
+		}
+
+		std::uint32_t Next()
+		{
+			const std::uint32_t result = S[0] + S[3];
+			const std::uint32_t t      = S[1] << 9;
+			S[2] ^= S[0]; S[3] ^= S[1]; S[1] ^= S[2]; S[0] ^= S[3];
+			S[2] ^= t;
+			S[3] = (S[3] << 11) | (S[3] >> 21);
+			return result;
+		}
+
+		void Jump()
+		{
+			static constexpr std::uint32_t JUMP[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+			std::uint32_t s[4] = {};
+			for (std::uint32_t jump : JUMP)
+			{
+				for (int bit = 0; bit < 32; ++bit)
+				{
+					if (jump & (1u << bit)) { for (int i = 0; i < 4; ++i) { s[i] ^= S[i]; } }
+					Next();
+				}
+			}
+			for (int i = 0; i < 4; ++i) { S[i] = s[i]; }
+		}
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Known answers, and value i of stream s == lane (i % 4) of the reference
+	-   jumped (s * 4 + i % 4) times
+	---------------------------------------------------------------------------*/
+	void CheckKnownAnswers()
+	{
+		for (std::uint32_t stream = 0; stream < 4; ++stream)
+		{
+			RandomEngine engine(SEED, stream);
+			for (int i = 0; i < 8; ++i)
+			{
+				const std::uint32_t value = engine.NextUInt();
+				TEST_CHECK_MESSAGE(value == KnownValues[stream][i], "stream %u value %d : 0x%08x", stream, i, value);
+			}
+
+			Xoshiro128Plus lanes[RandomEngine::LaneCount] = { Xoshiro128Plus(SEED), Xoshiro128Plus(SEED), Xoshiro128Plus(SEED), Xoshiro128Plus(SEED) };
+			for (int lane = 0; lane < RandomEngine::LaneCount; ++lane)
+			{
+				for (std::uint32_t jump = 0; jump < stream * RandomEngine::LaneCount + lane; ++jump) { lanes[lane].Jump(); }
+			}
+			engine.Seed(SEED, stream);
+			int mismatch = 0;
+			for (int i = 0; i < 1000; ++i) { mismatch += engine.NextUInt() != lanes[i % RandomEngine::LaneCount].Next(); }
+			TEST_CHECK_MESSAGE(mismatch == 0, "stream %u : %d value(s) differ from the reference", stream, mismatch);
+		}
+
+		/* reseeding restarts the sequence, the streams differ */
+		RandomEngine a(SEED), b(SEED, 1);
+		a.NextUInt(); a.NextUInt();
+		a.Seed(SEED);
+		TEST_CHECK(a.NextUInt() == KnownValues[0][0] && b.NextUInt() != KnownValues[0][0]);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Exact (bitwise) equality of the values
+	---------------------------------------------------------------------------*/
+	template<typename T> bool IsSame(const T& a, const T& b) { return std::memcmp(&a, &b, sizeof(T)) == 0; }
+
+	/*---------------------------------------------------------------------------
+	-   Fill == the same number of Next calls, starting at every position of the
+	-   4 value step buffer, for counts around the step and the 64 value block
+	---------------------------------------------------------------------------*/
+	template<typename T, typename Fill, typename Next>
+	int CompareFill(std::uint32_t stream, Fill fill, Next next)
+	{
+		static constexpr size_t Counts[] = { 0, 1, 2, 3, 4, 5, 7, 63, 64, 65, 67, 127, 128, 130, 1001 };
+		int failed = 0;
+		for (int skip = 0; skip < RandomEngine::LaneCount; ++skip)
+		{
+			for (size_t count : Counts)
+			{
+				RandomEngine bulk(SEED, stream), single(SEED, stream);
+				for (int i = 0; i < skip; ++i) { bulk.NextUInt(); single.NextUInt(); }
+
+				const T guard{};
+				std::vector<T> values(count + 1, guard); // values[count] must not be written
+				fill(bulk, values.data(), count);
+				for (size_t i = 0; i < count; ++i) { failed += !IsSame(values[i], next(single)); }
+				failed += !IsSame(values[count], guard);
+
+				/* and the engines continue in the same state */
+				failed += bulk.NextUInt() != single.NextUInt();
+			}
+		}
+		return failed;
+	}
+
+	void CheckFill()
+	{
+		for (std::uint32_t stream = 0; stream < 2; ++stream)
+		{
+			TEST_CHECK(CompareFill<std::uint32_t>(stream,
+				[](RandomEngine& e, std::uint32_t* out, size_t count) { e.Fill(out, count); },
+				[](RandomEngine& e) { return e.NextUInt(); }) == 0);
+			TEST_CHECK(CompareFill<float>(stream,
+				[](RandomEngine& e, float* out, size_t count) { e.Fill(out, count); },
+				[](RandomEngine& e) { return e.NextFloat(); }) == 0);
+			TEST_CHECK(CompareFill<float>(stream,
+				[](RandomEngine& e, float* out, size_t count) { e.Fill(out, count, -3.5f, 10.25f); },
+				[](RandomEngine& e) { return e.NextFloat(-3.5f, 10.25f); }) == 0);
+			TEST_CHECK(CompareFill<int>(stream,
+				[](RandomEngine& e, int* out, size_t count) { e.Fill(out, count, -7, 100); },
+				[](RandomEngine& e) { return e.NextInt(-7, 100); }) == 0);
+			TEST_CHECK(CompareFill<Float3>(stream,
+				[](RandomEngine& e, Float3* out, size_t count) { e.FillUnitSphere(out, count); },
+				[](RandomEngine& e) { return e.UnitSphere(); }) == 0);
+			TEST_CHECK(CompareFill<Float3>(stream,
+				[](RandomEngine& e, Float3* out, size_t count) { e.FillUnitHemisphere(out, count); },
+				[](RandomEngine& e) { return e.UnitHemisphere(); }) == 0);
+			TEST_CHECK(CompareFill<Float3>(stream,
+				[](RandomEngine& e, Float3* out, size_t count) { e.FillCosineHemisphere(out, count); },
+				[](RandomEngine& e) { return e.CosineHemisphere(); }) == 0);
+			TEST_CHECK(CompareFill<Float2>(stream,
+				[](RandomEngine& e, Float2* out, size_t count) { e.FillUnitDisk(out, count); },
+				[](RandomEngine& e) { return e.UnitDisk(); }) == 0);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   NextFloat in [min, max), NextInt in [min, max] (both ends reached for a small range)
+	---------------------------------------------------------------------------*/
+	void CheckBounds()
+	{
+		RandomEngine engine(SEED);
+		const float floatRanges[][2] = { { 0.0f, 1.0f }, { -1.0f, 1.0f }, { 10.0f, 20.0f }, { -5.0f, -4.5f }, { 100.0f, 100.001f }, { -1e6f, 1e6f } };
+		for (const auto& range : floatRanges)
+		{
+			std::vector<float> values(100000);
+			engine.Fill(values.data(), values.size(), range[0], range[1]);
+			int outside = 0;
+			for (float value : values) { outside += !(value >= range[0] && value < range[1]); }
+			for (int i = 0; i < 100000; ++i)
+			{
+				const float value = engine.NextFloat(range[0], range[1]);
+				outside += !(value >= range[0] && value < range[1]);
+			}
+			TEST_CHECK_MESSAGE(outside == 0, "[%f, %f) : %d value(s) outside", range[0], range[1], outside);
+		}
+
+		const int intRanges[][2] = { { 0, 1 }, { -3, 3 }, { 5, 5 }, { -1000, 1000000 }, { INT_MIN, INT_MAX }, { INT_MAX - 2, INT_MAX }, { INT_MIN, INT_MIN + 2 } };
+		for (const auto& range : intRanges)
+		{
+			const bool isSmall = static_cast<std::int64_t>(range[1]) - range[0] < 16;
+			bool hitMin = false, hitMax = false;
+			int outside = 0;
+			std::vector<int> values(20000);
+			engine.Fill(values.data(), values.size(), range[0], range[1]);
+			for (int i = 0; i < 20000; ++i) { values.push_back(engine.NextInt(range[0], range[1])); }
+			for (int value : values)
+			{
+				outside += value < range[0] || value > range[1];
+				hitMin  |= value == range[0];
+				hitMax  |= value == range[1];
+			}
+			TEST_CHECK_MESSAGE(outside == 0 && (!isSmall || (hitMin && hitMax)), "[%d, %d] : %d outside, min %d max %d",
+				range[0], range[1], outside, hitMin, hitMax);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Unit length and half space of the directions, and the expected mean
+	---------------------------------------------------------------------------*/
+	void CheckDirections()
+	{
+		constexpr int SampleCount = 200000;
+		RandomEngine engine(SEED, 3);
+		std::vector<Float3> directions(SampleCount);
+
+		struct Sampler { const char* Name; void (RandomEngine::*Fill)(Float3*, size_t); bool IsHemisphere; float MeanZ; };
+		const Sampler samplers[] =
+		{
+			{ "UnitSphere"      , &RandomEngine::FillUnitSphere      , false, 0.0f        },
+			{ "UnitHemisphere"  , &RandomEngine::FillUnitHemisphere  , true , 0.5f        },
+			{ "CosineHemisphere", &RandomEngine::FillCosineHemisphere, true , 2.0f / 3.0f },
+		};
+		for (const Sampler& sampler : samplers)
+		{
+			(engine.*sampler.Fill)(directions.data(), directions.size());
+			int notUnit = 0, wrongSide = 0;
+			double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+			for (const Float3& d : directions)
+			{
+				const float length = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+				notUnit   += std::fabs(length - 1.0f) > 1e-5f;
+				wrongSide += sampler.IsHemisphere && d.z < 0.0f;
+				sumX += d.x; sumY += d.y; sumZ += d.z;
+			}
+			const double meanX = sumX / SampleCount, meanY = sumY / SampleCount, meanZ = sumZ / SampleCount;
+			TEST_CHECK_MESSAGE(notUnit == 0 && wrongSide == 0, "%s : %d not unit, %d below the plane", sampler.Name, notUnit, wrongSide);
+			TEST_CHECK_MESSAGE(std::fabs(meanX) < 0.01 && std::fabs(meanY) < 0.01 && std::fabs(meanZ - sampler.MeanZ) < 0.01,
+				"%s : mean (%f, %f, %f)", sampler.Name, meanX, meanY, meanZ);
+		}
+
+		/* disk : inside, mean 0, mean radius 2 / 3 */
+		std::vector<Float2> points(SampleCount);
+		engine.FillUnitDisk(points.data(), points.size());
+		int outside = 0;
+		double sumX = 0.0, sumY = 0.0, sumR = 0.0;
+		for (const Float2& p : points)
+		{
+			const float r = std::sqrt(p.x * p.x + p.y * p.y);
+			outside += r > 1.0f + 1e-6f;
+			sumX += p.x; sumY += p.y; sumR += r;
+		}
+		TEST_CHECK(outside == 0);
+		TEST_CHECK(std::fabs(sumX / SampleCount) < 0.01 && std::fabs(sumY / SampleCount) < 0.01 && std::fabs(sumR / SampleCount - 2.0 / 3.0) < 0.01);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   RandomEngine vs the std::mt19937 + uniform_*_distribution path it replaced
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t count = static_cast<size_t>(4000000) * test::BenchScale();
+		std::vector<float> floats(count);
+		std::vector<int>   ints  (count);
+		float floatSum = 0.0f;
+		long long intSum = 0;
+
+		std::mt19937 mt(static_cast<std::uint32_t>(SEED));
+		std::uniform_real_distribution<float> realDistribution(-1.0f, 1.0f);
+		std::uniform_int_distribution<int>    intDistribution(0, 99);
+		RandomEngine engine(SEED);
+
+		test::Timer timer;
+		for (size_t i = 0; i < count; ++i) { floatSum += realDistribution(mt); }
+		test::PrintThroughput("float : mt19937 + uniform_real_distribution", timer.ElapsedMs(), count, "value");
+		timer.Reset();
+		for (size_t i = 0; i < count; ++i) { floatSum += engine.NextFloat(-1.0f, 1.0f); }
+		test::PrintThroughput("float : RandomEngine::NextFloat", timer.ElapsedMs(), count, "value");
+		timer.Reset();
+		engine.Fill(floats.data(), count, -1.0f, 1.0f);
+		test::PrintThroughput("float : RandomEngine::Fill", timer.ElapsedMs(), count, "value");
+
+		timer.Reset();
+		for (size_t i = 0; i < count; ++i) { intSum += intDistribution(mt); }
+		test::PrintThroughput("int : mt19937 + uniform_int_distribution", timer.ElapsedMs(), count, "value");
+		timer.Reset();
+		for (size_t i = 0; i < count; ++i) { intSum += engine.NextInt(0, 99); }
+		test::PrintThroughput("int : RandomEngine::NextInt", timer.ElapsedMs(), count, "value");
+		timer.Reset();
+		engine.Fill(ints.data(), count, 0, 99);
+		test::PrintThroughput("int : RandomEngine::Fill", timer.ElapsedMs(), count, "value");
+
+		test::DoNotOptimize(floatSum);
+		test::DoNotOptimize(intSum);
+		test::DoNotOptimize(floats.data());
+		test::DoNotOptimize(ints.data());
+	}
+}
+
+int main()
+{
+	CheckKnownAnswers();
+	CheckFill();
+	CheckBounds();
+	CheckDirections();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdBench.cpp
+///             @brief  Throughput of the GameMath backends (built once per backend)
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMSimdMath.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	using namespace gm::simd;
+
+	template<class Function>
+	void Run(const char* name, std::uint64_t count, Function function)
+	{
+		function(); // warm up
+		test::Timer timer;
+		function();
+		test::PrintBench(name, timer.ElapsedMs(), count);
+	}
+}
+
+int main()
+{
+	std::printf("GameMath backend : %s\n", GM_SIMD_BACKEND_NAME);
+	const int count = 1 << 18;
+	const int loop  = 4 * test::BenchScale();
+
+	test::Random random(35);
+	std::vector<Float4Data> positions(count);
+	for (Float4Data& p : positions) { p = { random.Float(-10, 10), random.Float(-10, 10), random.Float(-10, 10), 1.0f }; }
+	std::vector<Float4Data> results(count);
+
+	const MatrixRegister world = MatrixMultiply(MatrixRotationRollPitchYaw(0.3f, 0.2f, 0.1f), MatrixTranslation(1.0f, 2.0f, 3.0f));
+	const MatrixRegister view  = MatrixLookAtLH(VectorSet(0, 5, -10, 1), VectorZero(), VectorSet(0, 1, 0, 0));
+	const MatrixRegister proj  = MatrixPerspectiveFovLH(0.8f, 16.0f / 9.0f, 0.1f, 100.0f);
+
+	Run("Vector4Transform (world * view * proj)", (std::uint64_t)count * loop, [&]()
+	{
+		const MatrixRegister matrix = MatrixMultiply(MatrixMultiply(world, view), proj);
+		for (int l = 0; l < loop; ++l)
+		for (int i = 0; i < count; ++i) { StoreFloat4(&results[i], Vector4Transform(LoadFloat4(&positions[i]), matrix)); }
+		test::DoNotOptimize(results[count - 1]);
+	});
+
+	Run("MatrixMultiply", (std::uint64_t)count * loop / 4, [&]()
+	{
+		MatrixRegister m = world;
+		for (int i = 0; i < count * loop / 4; ++i) { m = MatrixMultiply(m, view); m.r[3] = g_IdentityR3; }
+		test::DoNotOptimize(m);
+	});
+
+	Run("MatrixInverse", (std::uint64_t)count * loop / 8, [&]()
+	{
+		MatrixRegister m = world;
+		for (int i = 0; i < count * loop / 8; ++i) { m = MatrixInverse(nullptr, m); }
+		test::DoNotOptimize(m);
+	});
+
+	Run("Vector3Normalize", (std::uint64_t)count * loop, [&]()
+	{
+		for (int l = 0; l < loop; ++l)
+		for (int i = 0; i < count; ++i) { StoreFloat4(&results[i], Vector3Normalize(LoadFloat4(&positions[i]))); }
+		test::DoNotOptimize(results[count - 1]);
+	});
+
+	Run("Vector3Dot + Vector3Cross", (std::uint64_t)count * loop, [&]()
+	{
+		VectorRegister sum = VectorZero();
+		for (int l = 0; l < loop; ++l)
+		for (int i = 1; i < count; ++i)
+		{
+			const VectorRegister a = LoadFloat4(&positions[i - 1]), b = LoadFloat4(&positions[i]);
+			sum = VectorAdd(sum, VectorAdd(Vector3Dot(a, b), Vector3Cross(a, b)));
+		}
+		test::DoNotOptimize(sum);
+	});
+
+	Run("VectorSinCos", (std::uint64_t)count * loop, [&]()
+	{
+		for (int l = 0; l < loop; ++l)
+		for (int i = 0; i < count; ++i)
+		{
+			VectorRegister s, c;
+			VectorSinCos(&s, &c, LoadFloat4(&positions[i]));
+			StoreFloat4(&results[i], VectorAdd(s, c));
+		}
+		test::DoNotOptimize(results[count - 1]);
+	});
+
+	Run("QuaternionSlerp", (std::uint64_t)count * loop / 4, [&]()
+	{
+		const VectorRegister q0 = QuaternionRotationRollPitchYaw(0.1f, 0.2f, 0.3f);
+		const VectorRegister q1 = QuaternionRotationRollPitchYaw(1.1f, -0.7f, 0.4f);
+		VectorRegister sum = VectorZero();
+		for (int i = 0; i < count * loop / 4; ++i) { sum = VectorAdd(sum, QuaternionSlerp(q0, q1, (float)(i & 255) / 255.0f)); }
+		test::DoNotOptimize(sum);
+	});
+	return 0;
+}
@@ -0,0 +1,420 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdConformance.cpp
+///             @brief  Conformance test of the GameMath backends.
+///                     The same source is built once per backend (scalar / SSE2 / SSE4 / NEON).
+///                     dump    : check every function against a double precision reference
+///                               and write the results of the backend to a file
+///                     compare : compare the results of two backends
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMMatrix.hpp"
+#include "GameMath/Include/GMSimdMath.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/*---------------------------------------------------------------------------
+	-   Exact     : every backend must return the same bits (+0 and -0 are equal)
+	-   Tolerance : polynomial approximations, compared with an absolute / relative error
+	---------------------------------------------------------------------------*/
+	enum class Compare : std::uint32_t { Exact = 0, Tolerance = 1 };
+
+	struct Record
+	{
+		std::string        Name;
+		Compare            Mode = Compare::Exact;
+		std::vector<float> Values;
+	};
+
+	constexpr int   InputCount         = 512;
+	constexpr float TranscendentalError = 2.0e-5f; // |result - reference| <= error * max(1, |reference|)
+	constexpr float BackendError        = 1.0e-5f;
+
+	std::vector<Record> g_records;
+
+	/*---------------------------------------------------------------------------
+	-   Inputs : random values and the cases where the backends usually differ
+	---------------------------------------------------------------------------*/
+	struct Inputs
+	{
+		std::vector<simd::Float4Data> A, B, C;
+	};
+
+	Inputs MakeInputs()
+	{
+		static const float specials[] =
+		{
+			0.0f, -0.0f, 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f, 1.0f, -1.0f,
+			0.49999997f, -0.49999997f, 8388607.5f, -8388607.5f, 8388608.0f, 16777217.0f,
+			1.0e-30f, -1.0e-30f, 123456.789f, -0.25f
+		};
+		constexpr int specialCount = sizeof(specials) / sizeof(specials[0]);
+
+		Inputs inputs;
+		test::Random random(0x5EED0035u);
+		for (int i = 0; i < InputCount; ++i)
+		{
+			simd::Float4Data a, b, c;
+			if (i < specialCount * 4)
+			{
+				a = { specials[i % specialCount], specials[(i + 1) % specialCount], specials[(i + 3) % specialCount], specials[(i + 7) % specialCount] };
+				b = { specials[(i + 5) % specialCount], 3.0f, -specials[i % specialCount], 0.75f };
+			}
+			else
+			{
+				const float range = (i & 1) ? 4.0f : 1000.0f;
+				a = { random.Float(-range, range), random.Float(-range, range), random.Float(-range, range), random.Float(-range, range) };
+				b = { random.Float(-range, range), random.Float(-range, range), random.Float(-range, range), random.Float(-range, range) };
+			}
+			c = { random.Float(-10.0f, 10.0f), random.Float(-10.0f, 10.0f), random.Float(-10.0f, 10.0f), random.Float(-10.0f, 10.0f) };
+			inputs.A.push_back(a); inputs.B.push_back(b); inputs.C.push_back(c);
+		}
+		return inputs;
+	}
+
+	simd::Float4Data ToData(simd::VectorRegister v)
+	{
+		simd::Float4Data result; simd::StoreFloat4(&result, v); return result;
+	}
+
+	float Lane(const simd::Float4Data& v, int i) { return (&v.x)[i]; }
+
+	bool SameFloat(float a, float b)
+	{
+		if (a != a && b != b) { return true; } // NaN
+		return a == b;                         // +0 == -0
+	}
+
+	bool Near(double value, double reference, double error)
+	{
+		if (value != value || reference != reference) { return value != value && reference != reference; }
+		return std::fabs(value - reference) <= error * (std::max)(1.0, std::fabs(reference));
+	}
+
+	Record& Begin(const char* name, Compare mode)
+	{
+		g_records.push_back(Record{ name, mode, {} });
+		return g_records.back();
+	}
+
+	void Append(Record& record, simd::VectorRegister v)
+	{
+		const simd::Float4Data data = ToData(v);
+		record.Values.insert(record.Values.end(), { data.x, data.y, data.z, data.w });
+	}
+
+	void Append(Record& record, const simd::MatrixRegister& m)
+	{
+		for (int i = 0; i < 4; ++i) { Append(record, m.r[i]); }
+	}
+
+	/*---------------------------------------------------------------------------
+	-   lane wise function checked against double precision
+	---------------------------------------------------------------------------*/
+	template<class Function, class Reference>
+	void CheckLanes(const char* name, Compare mode, const Inputs& inputs, Function function, Reference reference, double error = 0.0)
+	{
+		Record& record = Begin(name, mode);
+		int     failed = 0;
+		for (int i = 0; i < InputCount; ++i)
+		{
+			const simd::VectorRegister a = simd::LoadFloat4(&inputs.A[i]);
+			const simd::VectorRegister b = simd::LoadFloat4(&inputs.B[i]);
+			const simd::VectorRegister c = simd::LoadFloat4(&inputs.C[i]);
+			const simd::VectorRegister v = function(a, b, c);
+			Append(record, v);
+
+			const simd::Float4Data result = ToData(v);
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				const double expected = reference(Lane(inputs.A[i], lane), Lane(inputs.B[i], lane), Lane(inputs.C[i], lane));
+				const bool   isOK     = mode == Compare::Exact ? SameFloat(Lane(result, lane), (float)expected) : Near(Lane(result, lane), expected, error);
+				if (!isOK && failed++ < 4)
+				{
+					std::printf("  %s : input %d lane %d : %.9g (expected %.9g)\n", name, i, lane, Lane(result, lane), expected);
+				}
+			}
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "%s : %d lane(s) differ from the reference", name, failed);
+	}
+
+	void CheckArithmetic(const Inputs& inputs)
+	{
+		using V = simd::VectorRegister;
+		CheckLanes("VectorAdd",      Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorAdd(a, b); },      [](double a, double b, double)   { return (float)(a + b); });
+		CheckLanes("VectorSubtract", Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorSubtract(a, b); }, [](double a, double b, double)   { return (float)(a - b); });
+		CheckLanes("VectorMultiply", Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorMultiply(a, b); }, [](double a, double b, double)   { return (float)(a * b); });
+		CheckLanes("VectorDivide",   Compare::Exact, inputs, [](V a, V, V c)   { return simd::VectorDivide(a, c); },   [](double a, double, double c)   { return (float)(a / c); });
+		/*--- not fused : the product is rounded before the add ---*/
+		CheckLanes("VectorMultiplyAdd", Compare::Exact, inputs, [](V a, V b, V c) { return simd::VectorMultiplyAdd(a, b, c); }, [](double a, double b, double c) { return (float)((double)(float)(a * b) + c); });
+		CheckLanes("VectorNegativeMultiplySubtract", Compare::Exact, inputs, [](V a, V b, V c) { return simd::VectorNegativeMultiplySubtract(a, b, c); }, [](double a, double b, double c) { return (float)(c - (double)(float)(a * b)); });
+		CheckLanes("VectorNegate",   Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorNegate(a); },      [](double a, double, double)     { return -a; });
+		CheckLanes("VectorAbs",      Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorAbs(a); },         [](double a, double, double)     { return std::fabs(a); });
+		CheckLanes("VectorMin",      Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorMin(a, b); },      [](double a, double b, double)   { return a < b ? a : b; });
+		CheckLanes("VectorMax",      Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorMax(a, b); },      [](double a, double b, double)   { return a > b ? a : b; });
+		CheckLanes("VectorSaturate", Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorSaturate(a); },    [](double a, double, double)     { return a < 0.0 ? 0.0 : (a > 1.0 ? 1.0 : a); });
+		CheckLanes("VectorSqrt",     Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorSqrt(simd::VectorAbs(a)); }, [](double a, double, double) { return (float)std::sqrt(std::fabs(a)); });
+		CheckLanes("VectorReciprocal", Compare::Exact, inputs, [](V, V, V c)   { return simd::VectorReciprocal(c); },  [](double, double, double c)     { return (float)(1.0 / c); });
+		CheckLanes("VectorRound",    Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorRound(a); },       [](double a, double, double)     { return std::nearbyint(a); });
+		CheckLanes("VectorFloor",    Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorFloor(a); },       [](double a, double, double)     { return std::floor(a); });
+		CheckLanes("VectorCeiling",  Compare::Exact, inputs, [](V a, V, V)     { return simd::VectorCeiling(a); },     [](double a, double, double)     { return std::ceil(a); });
+		CheckLanes("VectorLess",     Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorSelect(simd::g_Zero, simd::g_One, simd::VectorLess(a, b)); }, [](double a, double b, double) { return a < b ? 1.0 : 0.0; });
+		CheckLanes("VectorEqual",    Compare::Exact, inputs, [](V a, V b, V)   { return simd::VectorSelect(simd::g_Zero, simd::g_One, simd::VectorEqual(a, simd::VectorNegate(b))); }, [](double a, double b, double) { return a == -b ? 1.0 : 0.0; });
+		CheckLanes("VectorConvertFloatToInt", Compare::Exact, inputs,
+			[](V, V, V c)
+			{
+				const V value = simd::VectorConvertFloatToInt(simd::VectorScale(c, 1000.0f));
+				const simd::Float4Data data = ToData(value);
+				std::int32_t lanes[4]; std::memcpy(lanes, &data, sizeof(lanes));
+				return simd::VectorSet((float)lanes[0], (float)lanes[1], (float)lanes[2], (float)lanes[3]);
+			},
+			[](double, double, double c) { return (double)(std::int32_t)(float)((float)c * 1000.0f); });
+	}
+
+	void CheckGeometry(const Inputs& inputs)
+	{
+		Record& dot2  = Begin("Vector2Dot",  Compare::Exact);
+		Record& dot3  = Begin("Vector3Dot",  Compare::Exact);
+		Record& dot4  = Begin("Vector4Dot",  Compare::Exact);
+		Record& cross = Begin("Vector3Cross", Compare::Exact);
+		int failed = 0;
+		for (int i = 0; i < InputCount; ++i)
+		{
+			const simd::Float4Data& a = inputs.A[i];
+			const simd::Float4Data& b = inputs.B[i];
+			const simd::VectorRegister va = simd::LoadFloat4(&a), vb = simd::LoadFloat4(&b);
+			const simd::VectorRegister d2 = simd::Vector2Dot(va, vb), d3 = simd::Vector3Dot(va, vb), d4 = simd::Vector4Dot(va, vb);
+			Append(dot2, d2); Append(dot3, d3); Append(dot4, d4);
+
+			/*--- the summation order of the dot products is fixed ---*/
+			const float expected2 = a.x * b.x + a.y * b.y;
+			const float expected3 = (a.x * b.x + a.y * b.y) + a.z * b.z;
+			const float expected4 = (a.x * b.x + a.y * b.y) + (a.z * b.z + a.w * b.w);
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				failed += !SameFloat(Lane(ToData(d2), lane), expected2);
+				failed += !SameFloat(Lane(ToData(d3), lane), expected3);
+				failed += !SameFloat(Lane(ToData(d4), lane), expected4);
+			}
+
+			const simd::Float4Data c = ToData(simd::Vector3Cross(va, vb));
+			Append(cross, simd::LoadFloat4(&c));
+			failed += !SameFloat(c.x, a.y * b.z - a.z * b.y);
+			failed += !SameFloat(c.y, a.z * b.x - a.x * b.z);
+			failed += !SameFloat(c.z, a.x * b.y - a.y * b.x);
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "dot / cross : %d lane(s) differ from the reference", failed);
+	}
+
+	void CheckMatrix(const Inputs& inputs)
+	{
+		Record& multiply  = Begin("MatrixMultiply",   Compare::Exact);
+		Record& transpose = Begin("MatrixTranspose",  Compare::Exact);
+		Record& transform = Begin("Vector4Transform", Compare::Exact);
+		Record& inverse   = Begin("MatrixInverse",    Compare::Exact);
+		int failedInverse = 0, failedTransform = 0;
+		for (int i = 0; i + 8 <= InputCount; i += 8)
+		{
+			const simd::MatrixRegister a = simd::MatrixSet(simd::LoadFloat4(&inputs.C[i]), simd::LoadFloat4(&inputs.C[i + 1]), simd::LoadFloat4(&inputs.C[i + 2]), simd::LoadFloat4(&inputs.C[i + 3]));
+			const simd::MatrixRegister b = simd::MatrixSet(simd::LoadFloat4(&inputs.C[i + 4]), simd::LoadFloat4(&inputs.C[i + 5]), simd::LoadFloat4(&inputs.C[i + 6]), simd::LoadFloat4(&inputs.C[i + 7]));
+			Append(multiply,  simd::MatrixMultiply(a, b));
+			Append(transpose, simd::MatrixTranspose(a));
+
+			const simd::VectorRegister v = simd::LoadFloat4(&inputs.C[(i + 9) % InputCount]);
+			const simd::VectorRegister t = simd::Vector4Transform(v, a);
+			Append(transform, t);
+			simd::Float4x4Data m; simd::StoreFloat4x4(&m, a);
+			const simd::Float4Data x = ToData(v), y = ToData(t);
+			for (int column = 0; column < 4; ++column)
+			{
+				double expected = 0.0;
+				for (int row = 0; row < 4; ++row) { expected += (double)Lane(x, row) * m.m[row][column]; }
+				failedTransform += !Near(Lane(y, column), expected, 1.0e-4);
+			}
+
+			/*--- A * inverse(A) = I ---*/
+			simd::VectorRegister determinant;
+			const simd::MatrixRegister inv = simd::MatrixInverse(&determinant, a);
+			Append(inverse, inv);
+			if (std::fabs(simd::VectorGetX(determinant)) > 1.0f)
+			{
+				simd::Float4x4Data identity; simd::StoreFloat4x4(&identity, simd::MatrixMultiply(a, inv));
+				for (int r = 0; r < 4; ++r)
+				for (int c = 0; c < 4; ++c) { failedInverse += !Near(identity.m[r][c], r == c ? 1.0 : 0.0, 1.0e-3); }
+			}
+		}
+		TEST_CHECK_MESSAGE(failedTransform == 0, "Vector4Transform : %d lane(s)", failedTransform);
+		TEST_CHECK_MESSAGE(failedInverse   == 0, "MatrixInverse : %d element(s) of A * inverse(A) are not the identity", failedInverse);
+	}
+
+	void CheckTranscendental(const Inputs& inputs)
+	{
+		using V = simd::VectorRegister;
+		const double e = TranscendentalError;
+		CheckLanes("VectorSin",  Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorSin(c); },  [](double, double, double c) { return std::sin((float)c); }, e);
+		CheckLanes("VectorCos",  Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorCos(c); },  [](double, double, double c) { return std::cos((float)c); }, e);
+		CheckLanes("VectorTan",  Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorTan(simd::VectorScale(c, 0.1f)); }, [](double, double, double c) { return std::tan((double)(float)((float)c * 0.1f)); }, 1.0e-4);
+		CheckLanes("VectorASin", Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorASin(simd::VectorScale(c, 0.1f)); }, [](double, double, double c) { return std::asin((double)(float)((float)c * 0.1f)); }, e);
+		CheckLanes("VectorACos", Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorACos(simd::VectorScale(c, 0.1f)); }, [](double, double, double c) { return std::acos((double)(float)((float)c * 0.1f)); }, e);
+		CheckLanes("VectorATan", Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorATan(c); },  [](double, double, double c) { return std::atan((float)c); }, e);
+		CheckLanes("VectorATan2", Compare::Tolerance, inputs, [](V, V b, V c) { return simd::VectorATan2(c, simd::VectorScale(b, 0.01f)); },
+			[](double, double b, double c) { return std::atan2((double)(float)c, (double)(float)((float)b * 0.01f)); }, 1.0e-4);
+		CheckLanes("VectorExp",  Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorExp(c); },  [](double, double, double c) { return std::exp2((float)c); }, e);
+		CheckLanes("VectorLog",  Compare::Tolerance, inputs, [](V, V, V c) { return simd::VectorLog(simd::VectorAdd(simd::VectorAbs(c), simd::g_One)); },
+			[](double, double, double c) { return std::log2((double)(float)(std::fabs((float)c) + 1.0f)); }, e);
+	}
+
+	void CheckQuaternion(const Inputs& inputs)
+	{
+		Record& slerp  = Begin("QuaternionSlerp",  Compare::Tolerance);
+		Record& rotate = Begin("Vector3Rotate",    Compare::Tolerance);
+		int failed = 0;
+		for (int i = 0; i < InputCount; ++i)
+		{
+			const simd::Float4Data& c = inputs.C[i];
+			const simd::VectorRegister q0 = simd::QuaternionRotationRollPitchYaw(c.x * 0.3f, c.y * 0.3f, c.z * 0.3f);
+			const simd::VectorRegister q1 = simd::QuaternionRotationRollPitchYaw(c.w * 0.3f, c.x * 0.1f, c.y * 0.2f);
+			const simd::VectorRegister q  = simd::QuaternionSlerp(q0, q1, 0.25f);
+			Append(slerp, q);
+			failed += !Near(simd::VectorGetX(simd::QuaternionLength(q)), 1.0, 1.0e-5);
+
+			/*--- the rotation of the quaternion equals the rotation of its matrix ---*/
+			const simd::VectorRegister v  = simd::LoadFloat4(&inputs.C[(i + 1) % InputCount]);
+			const simd::VectorRegister r0 = simd::Vector3Rotate(v, q);
+			const simd::VectorRegister r1 = simd::Vector3TransformNormal(v, simd::MatrixRotationQuaternion(q));
+			Append(rotate, r0);
+			const simd::Float4Data x = ToData(r0), y = ToData(r1);
+			for (int lane = 0; lane < 3; ++lane) { failed += !Near(Lane(x, lane), Lane(y, lane), 1.0e-4); }
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "quaternion : %d value(s)", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   gm types are thin wrappers of the register functions (CREATE_SIMD_FUNCTIONS)
+	---------------------------------------------------------------------------*/
+	void CheckWrapperTypes()
+	{
+		const Vector3 a(1.0f, 2.0f, 3.0f), b(-4.0f, 0.5f, 2.0f);
+		TEST_CHECK((float)Dot(a, b) == 3.0f);
+		const Vector3 c = Cross(a, b);
+		TEST_CHECK(c.GetX() == 2.5f && c.GetY() == -14.0f && c.GetZ() == 8.5f);
+		const Vector3 m = Max(a, b);
+		TEST_CHECK(m.GetX() == 1.0f && m.GetY() == 2.0f && m.GetZ() == 3.0f);
+		const Vector3 f = Floor(Vector3(1.5f, -1.5f, -0.0f));
+		TEST_CHECK(f.GetX() == 1.0f && f.GetY() == -2.0f && f.GetZ() == 0.0f);
+
+		const Matrix4 translation(simd::MatrixTranslation(1.0f, 2.0f, 3.0f));
+		const Vector4 p = translation * Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+		TEST_CHECK(p.GetX() == 2.0f && p.GetY() == 3.0f && p.GetZ() == 4.0f && p.GetW() == 1.0f);
+		const Matrix4 identity = translation * Inverse(translation);
+		TEST_CHECK(simd::MatrixIsIdentity(identity));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   File : "GMSC" version count { mode nameLength name valueCount values }
+	---------------------------------------------------------------------------*/
+	bool WriteRecords(const char* filePath)
+	{
+		std::ofstream stream(filePath, std::ios::binary);
+		if (!stream) { return false; }
+		const std::uint32_t header[3] = { 0x43534D47u, 1u, (std::uint32_t)g_records.size() };
+		stream.write((const char*)header, sizeof(header));
+		for (const Record& record : g_records)
+		{
+			const std::uint32_t info[3] = { (std::uint32_t)record.Mode, (std::uint32_t)record.Name.size(), (std::uint32_t)record.Values.size() };
+			stream.write((const char*)info, sizeof(info));
+			stream.write(record.Name.data(), record.Name.size());
+			stream.write((const char*)record.Values.data(), record.Values.size() * sizeof(float));
+		}
+		return (bool)stream;
+	}
+
+	bool ReadRecords(const char* filePath, std::vector<Record>& records)
+	{
+		std::ifstream stream(filePath, std::ios::binary);
+		std::uint32_t header[3] = {};
+		if (!stream.read((char*)header, sizeof(header)) || header[0] != 0x43534D47u || header[1] != 1u) { return false; }
+		records.resize(header[2]);
+		for (Record& record : records)
+		{
+			std::uint32_t info[3] = {};
+			if (!stream.read((char*)info, sizeof(info))) { return false; }
+			record.Mode = (Compare)info[0];
+			record.Name.resize(info[1]);
+			record.Values.resize(info[2]);
+			stream.read(record.Name.data(), info[1]);
+			stream.read((char*)record.Values.data(), info[2] * sizeof(float));
+		}
+		return (bool)stream;
+	}
+
+	int Dump(const char* filePath)
+	{
+		std::printf("GameMath backend : %s\n", GM_SIMD_BACKEND_NAME);
+		const Inputs inputs = MakeInputs();
+		CheckArithmetic(inputs);
+		CheckGeometry(inputs);
+		CheckMatrix(inputs);
+		CheckTranscendental(inputs);
+		CheckQuaternion(inputs);
+		CheckWrapperTypes();
+		TEST_CHECK_MESSAGE(WriteRecords(filePath), "cannot write %s", filePath);
+		return TEST_RESULT();
+	}
+
+	int CompareFiles(const char* filePath, const char* referencePath)
+	{
+		std::vector<Record> values, references;
+		TEST_CHECK_MESSAGE(ReadRecords(filePath,      values),     "cannot read %s", filePath);
+		TEST_CHECK_MESSAGE(ReadRecords(referencePath, references), "cannot read %s", referencePath);
+		TEST_CHECK(values.size() == references.size());
+
+		for (size_t i = 0; i < (std::min)(values.size(), references.size()); ++i)
+		{
+			const Record& value = values[i];
+			const Record& reference = references[i];
+			if (value.Name != reference.Name || value.Values.size() != reference.Values.size())
+			{
+				TEST_CHECK_MESSAGE(false, "record %zu : %s / %s", i, value.Name.c_str(), reference.Name.c_str());
+				continue;
+			}
+
+			int failed = 0;
+			for (size_t j = 0; j < value.Values.size(); ++j)
+			{
+				const bool isOK = value.Mode == Compare::Exact
+					? SameFloat(value.Values[j], reference.Values[j])
+					: Near(value.Values[j], reference.Values[j], BackendError);
+				if (!isOK && failed++ < 4)
+				{
+					std::printf("  %s[%zu] : %.9g / %.9g\n", value.Name.c_str(), j, value.Values[j], reference.Values[j]);
+				}
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "%s : %d value(s) differ between the backends", value.Name.c_str(), failed);
+		}
+		return TEST_RESULT();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const std::string mode = argc > 1 ? argv[1] : "";
+	if (mode == "dump"    && argc == 3) { return Dump(argv[2]); }
+	if (mode == "compare" && argc == 4) { return CompareFiles(argv[2], argv[3]); }
+	std::printf("usage : %s dump <file> | compare <file> <reference file>\n", argv[0]);
+	return 2;
+}
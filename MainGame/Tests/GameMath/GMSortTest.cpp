@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSortTest.cpp
+///             @brief  Sort : radix / intro / parallel sort against std::stable_sort and
+///                     the 1M elements benchmark on random, sorted and reverse sorted input
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMSort.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	enum class Pattern { Random, Sorted, Reverse, FewUnique, CountOf };
+	const char* g_patternName[] = { "random", "sorted", "reverse", "few unique" };
+
+	template<typename T>
+	std::vector<T> MakeInput(size_t count, Pattern pattern, test::Random& random)
+	{
+		std::vector<T> values(count);
+		for (T& value : values)
+		{
+			if constexpr (std::is_floating_point_v<T>) { value = static_cast<T>(random.Float(-1000.0f, 1000.0f)); }
+			else                                       { value = static_cast<T>(random.Next()); }
+			if (pattern == Pattern::FewUnique) { value = static_cast<T>(random.Range(4)); }
+		}
+		if (pattern == Pattern::Sorted)  { std::sort(values.begin(), values.end()); }
+		if (pattern == Pattern::Reverse) { std::sort(values.rbegin(), values.rend()); }
+		return values;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Radix (with and without payload) / Intro / Parallel give the std::stable_sort result.
+	-   The payload keeps the original order of the equal keys.
+	---------------------------------------------------------------------------*/
+	template<typename T>
+	void CheckSorts(const char* typeName, test::Random& random)
+	{
+		const size_t counts[] = { 0, 1, 2, 3, 23, 24, 25, 100, 129, 1000, 5000, 20000, 70001 };
+		for (size_t count : counts)
+		{
+			for (int p = 0; p < static_cast<int>(Pattern::CountOf); ++p)
+			{
+				const std::vector<T> input = MakeInput<T>(count, static_cast<Pattern>(p), random);
+				std::vector<T> ascend  = input; std::stable_sort(ascend.begin() , ascend.end());
+				std::vector<T> descend = input; std::stable_sort(descend.begin(), descend.end(), std::greater<T>());
+
+				std::vector<T> radix = input;            Sort<T>::RadixSortAscend(radix);
+				std::vector<T> radixDescend = input;     Sort<T>::RadixSortDescend(radixDescend);
+				std::vector<T> intro = input;            Sort<T>::IntroSort(intro);
+				std::vector<T> introDescend = input;     Sort<T>::IntroSort(introDescend, std::greater<T>());
+				std::vector<T> parallel = input;         Sort<T>::ParallelSort(parallel, std::less<T>(), 4);
+				std::vector<T> parallelDescend = input;  Sort<T>::ParallelSort(parallelDescend, std::greater<T>(), 3);
+
+				TEST_CHECK_MESSAGE(radix == ascend && radixDescend == descend, "%s radix : %zu %s", typeName, count, g_patternName[p]);
+				TEST_CHECK_MESSAGE(intro == ascend && introDescend == descend, "%s intro : %zu %s", typeName, count, g_patternName[p]);
+				TEST_CHECK_MESSAGE(parallel == ascend && parallelDescend == descend, "%s parallel : %zu %s", typeName, count, g_patternName[p]);
+
+				std::vector<int> payload(count), expected(count);
+				for (size_t i = 0; i < count; ++i) { payload[i] = expected[i] = static_cast<int>(i); }
+				std::vector<T> keys = input;
+				Sort<T>::RadixSortAscend(keys, payload);
+				std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) { return input[a] < input[b]; });
+				TEST_CHECK_MESSAGE(keys == ascend && payload == expected, "%s radix payload : %zu %s", typeName, count, g_patternName[p]);
+			}
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   QuickSort on [left, right] only touches the range
+	---------------------------------------------------------------------------*/
+	void CheckQuickSortRange(test::Random& random)
+	{
+		for (int round = 0; round < 50; ++round)
+		{
+			std::vector<int> input(300);
+			for (int& value : input) { value = static_cast<int>(random.Range(1000)); }
+			const int left  = static_cast<int>(random.Range(100));
+			const int right = 200 + static_cast<int>(random.Range(100));
+
+			std::vector<int> expected = input;
+			std::sort(expected.begin() + left, expected.begin() + right + 1);
+			std::vector<int> array  = input; Sort<int>::QuickSortAscend(array.data(), left, right);
+			std::vector<int> vector = input; Sort<int>::QuickSortAscend(vector, left, right);
+			TEST_CHECK_MESSAGE(array == expected && vector == expected, "round %d : [%d, %d]", round, left, right);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   1M floats (depth values) and 1M uint32 keys with payload (draw keys)
+	---------------------------------------------------------------------------*/
+	template<typename Function>
+	void BenchOne(const char* name, const std::vector<float>& input, int round, Function&& function)
+	{
+		double ms = 0.0;
+		for (int r = 0; r < round; ++r)
+		{
+			std::vector<float> values = input;
+			test::Timer timer;
+			function(values);
+			ms += timer.ElapsedMs();
+			test::DoNotOptimize(values[0]);
+		}
+		test::PrintBench(name, ms, input.size() * round, "element");
+	}
+
+	void Bench()
+	{
+		const size_t count = 1 << 20;
+		const int    round = 3 * test::BenchScale();
+		test::Random random(3300);
+		char label[96];
+
+		for (int p = 0; p < static_cast<int>(Pattern::FewUnique); ++p)
+		{
+			const std::vector<float> input = MakeInput<float>(count, static_cast<Pattern>(p), random);
+			const char* pattern = g_patternName[p];
+			std::snprintf(label, sizeof(label), "1M float %-8s : std::sort", pattern);
+			BenchOne(label, input, round, [](std::vector<float>& v) { std::sort(v.begin(), v.end()); });
+			std::snprintf(label, sizeof(label), "1M float %-8s : QuickSort", pattern);
+			BenchOne(label, input, round, [](std::vector<float>& v) { Sort<float>::QuickSortAscend(v, 0, static_cast<int>(v.size()) - 1); });
+			std::snprintf(label, sizeof(label), "1M float %-8s : IntroSort", pattern);
+			BenchOne(label, input, round, [](std::vector<float>& v) { Sort<float>::IntroSort(v); });
+			std::snprintf(label, sizeof(label), "1M float %-8s : RadixSort", pattern);
+			BenchOne(label, input, round, [](std::vector<float>& v) { Sort<float>::RadixSortAscend(v); });
+			std::snprintf(label, sizeof(label), "1M float %-8s : ParallelSort", pattern);
+			BenchOne(label, input, round, [](std::vector<float>& v) { Sort<float>::ParallelSort(v); });
+		}
+
+		const std::vector<std::uint32_t> keys = MakeInput<std::uint32_t>(count, Pattern::Random, random);
+		double ms = 0.0;
+		for (int r = 0; r < round; ++r)
+		{
+			std::vector<std::uint32_t> sorted = keys;
+			std::vector<std::uint32_t> drawIndex(count);
+			for (size_t i = 0; i < count; ++i) { drawIndex[i] = static_cast<std::uint32_t>(i); }
+			test::Timer timer;
+			Sort<std::uint32_t>::RadixSortAscend(sorted, drawIndex);
+			ms += timer.ElapsedMs();
+			test::DoNotOptimize(drawIndex[0]);
+		}
+		test::PrintBench("1M uint32 key + payload : RadixSort", ms, count * round, "element");
+	}
+}
+
+/* "stress" : skip the benchmark (used by the thread sanitizer build) */
+int main(int argc, char** argv)
+{
+	test::Random random(33);
+	CheckSorts<int>          ("int"     , random);
+	CheckSorts<unsigned int> ("unsigned", random);
+	CheckSorts<short>        ("short"   , random);
+	CheckSorts<std::int64_t> ("int64"   , random);
+	CheckSorts<float>        ("float"   , random);
+	CheckSorts<double>       ("double"  , random);
+	CheckQuickSortRange(random);
+
+	if (argc < 2 || std::strcmp(argv[1], "stress") != 0) { Bench(); }
+	return TEST_RESULT();
+}
@@ -0,0 +1,212 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMTransformTest.cpp
+///             @brief  Transform / TransformHierarchy : cached world matrices against the recursive
+///                     formula, and the deep chain / wide scene benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMTransform.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <memory>
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/* the old Transform::GetMatrix (every ancestor is rebuilt on each call) */
+	Matrix4 ReferenceMatrix(const Transform& transform)
+	{
+		const Matrix4 parent = transform.GetParent() != nullptr ? ReferenceMatrix(*transform.GetParent()) : Matrix4(kIdentity);
+		return Scaling(transform.LocalScale) * RotationQuaternion(transform.LocalRotation) * Translation(transform.LocalPosition) * parent;
+	}
+
+	bool IsSame(Matrix4 a, Matrix4 b)
+	{
+		const Float4x4 fa = a.ToFloat4x4(), fb = b.ToFloat4x4();
+		return std::memcmp(&fa, &fb, sizeof(Float4x4)) == 0;
+	}
+
+	void Move(Transform& transform, test::Random& random)
+	{
+		switch (random.Range(3))
+		{
+			case 0:  transform.LocalPosition = Vector3(random.Float(-5.0f, 5.0f), random.Float(-5.0f, 5.0f), random.Float(-5.0f, 5.0f)); break;
+			case 1:  transform.LocalRotation = Quaternion(random.Float(-3.0f, 3.0f), random.Float(-3.0f, 3.0f), random.Float(-3.0f, 3.0f)); break;
+			default: transform.LocalScale    = Vector3(random.Float(0.5f, 2.0f), random.Float(0.5f, 2.0f), random.Float(0.5f, 2.0f)); break;
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random forest : move, re-parent and destroy nodes, then compare
+	-   GetMatrix and TransformHierarchy with the recursive formula (bit exact)
+	---------------------------------------------------------------------------*/
+	void CheckAgainstReference()
+	{
+		test::Random random(36);
+		const size_t nodeCount = 300;
+		std::vector<std::unique_ptr<Transform>> nodes;
+		for (size_t i = 0; i < nodeCount; ++i)
+		{
+			nodes.push_back(std::make_unique<Transform>());
+			Move(*nodes.back(), random);
+			if (i > 0 && random.Range(8) != 0) { nodes.back()->SetParent(nodes[random.Range(static_cast<std::uint32_t>(i))].get()); }
+		}
+
+		TransformHierarchy hierarchy;
+		int failed = 0, hierarchyFailed = 0, orderFailed = 0;
+		for (int frame = 0; frame < 200; ++frame)
+		{
+			for (int i = 0; i < 20; ++i)
+			{
+				Transform* node = nodes[random.Range(nodeCount)].get();
+				if (node != nullptr) { Move(*node, random); }
+			}
+
+			/* parent only to a smaller index, so that there is no cycle */
+			const size_t child = 1 + random.Range(nodeCount - 1);
+			if (nodes[child] != nullptr)
+			{
+				Transform* parent = random.Range(4) == 0 ? nullptr : nodes[random.Range(static_cast<std::uint32_t>(child))].get();
+				nodes[child]->SetParent(parent);
+			}
+			if (frame % 25 == 24) { nodes[random.Range(nodeCount)].reset(); }
+
+			/* half of the frames query the nodes directly, the other half through the hierarchy */
+			if (frame % 2 == 0)
+			{
+				for (const auto& node : nodes)
+				{
+					if (node != nullptr && !IsSame(node->GetMatrix(), ReferenceMatrix(*node))) { failed++; }
+				}
+				continue;
+			}
+
+			std::vector<Transform*> roots;
+			for (const auto& node : nodes) { if (node != nullptr && node->GetParent() == nullptr) { roots.push_back(node.get()); } }
+			hierarchy.Build(roots);
+			hierarchy.UpdateWorldMatrices();
+
+			size_t liveCount = 0;
+			for (const auto& node : nodes) { liveCount += node != nullptr; }
+			if (hierarchy.Size() != liveCount) { hierarchyFailed++; }
+			for (size_t i = 0; i < hierarchy.Size(); ++i)
+			{
+				const int parentIndex = hierarchy.GetParentIndex(i);
+				if (parentIndex >= static_cast<int>(i)) { orderFailed++; }
+				if (!IsSame(hierarchy.GetWorldMatrix(i), ReferenceMatrix(*hierarchy.GetTransform(i)))) { hierarchyFailed++; }
+			}
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "%d GetMatrix result(s) differ from the recursive formula", failed);
+		TEST_CHECK_MESSAGE(hierarchyFailed == 0, "%d TransformHierarchy result(s) differ", hierarchyFailed);
+		TEST_CHECK_MESSAGE(orderFailed == 0, "%d parent(s) after their child", orderFailed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Deep chain : 64 nodes, the root moves and every node is queried each frame
+	-   Wide scene : 100 roots * 100 children, 10% of the nodes move each frame
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const int frame = 200 * test::BenchScale();
+		test::Random random(3600);
+		Matrix4 sink;
+
+		{
+			std::vector<std::unique_ptr<Transform>> chain;
+			for (int i = 0; i < 64; ++i)
+			{
+				chain.push_back(std::make_unique<Transform>(Vector3(0.0f, 1.0f, 0.0f)));
+				if (i > 0) { chain.back()->SetParent(chain[i - 1].get()); }
+			}
+			Transform* root = chain.front().get();
+			TransformHierarchy hierarchy;
+			hierarchy.Build(&root, 1);
+
+			test::Timer timer;
+			for (int f = 0; f < frame; ++f)
+			{
+				root->LocalPosition = Vector3(static_cast<float>(f), 0.0f, 0.0f);
+				for (const auto& node : chain) { sink = ReferenceMatrix(*node); test::DoNotOptimize(sink); }
+			}
+			test::PrintBench("deep chain 64 : recursive", timer.ElapsedMs(), static_cast<size_t>(frame) * 64, "node");
+			timer.Reset();
+			for (int f = 0; f < frame; ++f)
+			{
+				root->LocalPosition = Vector3(static_cast<float>(f), 0.0f, 0.0f);
+				for (const auto& node : chain) { sink = node->GetMatrix(); test::DoNotOptimize(sink); }
+			}
+			test::PrintBench("deep chain 64 : cached GetMatrix", timer.ElapsedMs(), static_cast<size_t>(frame) * 64, "node");
+			timer.Reset();
+			for (int f = 0; f < frame; ++f)
+			{
+				root->LocalPosition = Vector3(static_cast<float>(f), 1.0f, 0.0f);
+				hierarchy.UpdateWorldMatrices();
+				for (size_t i = 0; i < hierarchy.Size(); ++i) { sink = hierarchy.GetWorldMatrix(i); test::DoNotOptimize(sink); }
+			}
+			test::PrintBench("deep chain 64 : TransformHierarchy", timer.ElapsedMs(), static_cast<size_t>(frame) * 64, "node");
+		}
+
+		{
+			std::vector<std::unique_ptr<Transform>> roots, children;
+			std::vector<Transform*> rootPointers;
+			for (int r = 0; r < 100; ++r)
+			{
+				roots.push_back(std::make_unique<Transform>(Vector3(static_cast<float>(r), 0.0f, 0.0f)));
+				rootPointers.push_back(roots.back().get());
+				for (int c = 0; c < 100; ++c)
+				{
+					children.push_back(std::make_unique<Transform>(Vector3(0.0f, static_cast<float>(c), 0.0f)));
+					children.back()->SetParent(roots.back().get());
+				}
+			}
+			TransformHierarchy hierarchy;
+			hierarchy.Build(rootPointers);
+			const size_t nodeCount = roots.size() + children.size();
+			auto moveTenPercent = [&]()
+			{
+				for (size_t i = 0; i < nodeCount / 10; ++i)
+				{
+					const std::uint32_t index = random.Range(static_cast<std::uint32_t>(nodeCount));
+					Transform& node = index < roots.size() ? *roots[index] : *children[index - roots.size()];
+					node.LocalPosition = node.LocalPosition + Vector3(0.01f, 0.0f, 0.0f);
+				}
+			};
+
+			test::Timer timer;
+			double ms = 0.0;
+			for (int f = 0; f < frame; ++f)
+			{
+				moveTenPercent();
+				timer.Reset();
+				for (const auto& node : children) { sink = ReferenceMatrix(*node); test::DoNotOptimize(sink); }
+				ms += timer.ElapsedMs();
+			}
+			test::PrintBench("wide scene 100x100 : recursive", ms, static_cast<size_t>(frame) * nodeCount, "node");
+			ms = 0.0;
+			for (int f = 0; f < frame; ++f)
+			{
+				moveTenPercent();
+				timer.Reset();
+				hierarchy.UpdateWorldMatrices();
+				for (size_t i = 0; i < hierarchy.Size(); ++i) { sink = hierarchy.GetWorldMatrix(i); test::DoNotOptimize(sink); }
+				ms += timer.ElapsedMs();
+			}
+			test::PrintBench("wide scene 100x100 : TransformHierarchy", ms, static_cast<size_t>(frame) * nodeCount, "node");
+		}
+	}
+}
+
+int main()
+{
+	CheckAgainstReference();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,344 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CascadeShadowMapTest.cpp
+///             @brief  CascadeShadowMapMatrix : split scheme, every frustum slice inside its crop box,
+///                     texel snap (phase and texel size while the camera moves and turns),
+///                     caster planes and the near plane extension
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/CascadeShadowMapMatrix.hpp"
+#include "GameCore/Include/Camera.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <cmath>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	constexpr int CASCADE_COUNT = CascadeShadowMapMatrix::CASCADE_COUNT;
+	const int RESOLUTION[CASCADE_COUNT] = { 1024, 512, 256 };
+
+	Float3 Add  (const Float3& a, const Float3& b) { return Float3(a.x + b.x, a.y + b.y, a.z + b.z); }
+	Float3 Scale(const Float3& v, float s)         { return Float3(v.x * s, v.y * s, v.z * s); }
+	float  Dot  (const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	Float3 Cross(const Float3& a, const Float3& b) { return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+	Float3 Normalize(const Float3& v)              { return Scale(v, 1.0f / std::sqrt(Dot(v, v))); }
+
+	Float3 RandomDirection(test::Random& random)
+	{
+		for (;;)
+		{
+			const Float3 v(random.Float(-1, 1), random.Float(-1, 1), random.Float(-1, 1));
+			if (Dot(v, v) > 0.01f && Dot(v, v) <= 1.0f) { return Normalize(v); }
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Crop matrix (row vector, orthographic : w = 1)
+	---------------------------------------------------------------------------*/
+	Float4x4 GetCropMatrix(CascadeShadowMapMatrix& cascade, int index)
+	{
+		Matrix4 matrix = cascade.GetLightViewProjectionCropMatrix(index);
+		return matrix.ToFloat4x4();
+	}
+
+	Float3 Transform(const Float4x4& m, const Float3& p)
+	{
+		return Float3(p.x * m.m[0][0] + p.y * m.m[1][0] + p.z * m.m[2][0] + m.m[3][0],
+		              p.x * m.m[0][1] + p.y * m.m[1][1] + p.z * m.m[2][1] + m.m[3][1],
+		              p.x * m.m[0][2] + p.y * m.m[1][2] + p.z * m.m[2][2] + m.m[3][2]);
+	}
+
+	/* world position of the crop space point (x, y in [-1, 1], z in [0, 1] is the crop box) */
+	Float3 FromCropSpace(CascadeShadowMapMatrix& cascade, int index, const Float3& crop)
+	{
+		Float4x4 inverse = Inverse(cascade.GetLightViewProjectionCropMatrix(index)).ToFloat4x4();
+		return Transform(inverse, crop);
+	}
+
+	/* world size of one shadow map texel along the light right and up axes */
+	void GetTexelSize(const Float4x4& m, int resolution, float& outX, float& outY)
+	{
+		const float scaleX = std::sqrt(m.m[0][0] * m.m[0][0] + m.m[1][0] * m.m[1][0] + m.m[2][0] * m.m[2][0]);
+		const float scaleY = std::sqrt(m.m[0][1] * m.m[0][1] + m.m[1][1] * m.m[1][1] + m.m[2][1] * m.m[2][1]);
+		outX = 2.0f / (scaleX * resolution);
+		outY = 2.0f / (scaleY * resolution);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Corners of the view frustum between the depths (any roll around the look axis)
+	---------------------------------------------------------------------------*/
+	void GetSliceCorners(const Camera& camera, float roll, float nearDepth, float farDepth, Float3 outCorners[8])
+	{
+		const Float3 look    = camera.Look;
+		const Float3 worldUp = std::fabs(look.y) > 0.99f ? Float3(0.0f, 0.0f, 1.0f) : Float3(0.0f, 1.0f, 0.0f);
+		const Float3 right0  = Normalize(Cross(worldUp, look));
+		const Float3 up0     = Cross(look, right0);
+		const Float3 right   = Add(Scale(right0,  std::cos(roll)), Scale(up0, std::sin(roll)));
+		const Float3 up      = Add(Scale(right0, -std::sin(roll)), Scale(up0, std::cos(roll)));
+
+		const float tanHalfFov = std::tan(camera.FovVertical * 0.5f);
+		const float depths[2]  = { nearDepth, farDepth };
+		for (int d = 0; d < 2; ++d)
+		{
+			const float  halfHeight = depths[d] * tanHalfFov;
+			const float  halfWidth  = halfHeight * camera.Aspect;
+			const Float3 center     = Add(camera.Position, Scale(look, depths[d]));
+			for (int c = 0; c < 4; ++c)
+			{
+				const float sx = (c & 1) ? 1.0f : -1.0f;
+				const float sy = (c & 2) ? 1.0f : -1.0f;
+				outCorners[d * 4 + c] = Add(center, Add(Scale(right, sx * halfWidth), Scale(up, sy * halfHeight)));
+			}
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Practical split scheme : lambda blend of the logarithmic and the linear split
+	---------------------------------------------------------------------------*/
+	void CheckSplit()
+	{
+		Camera camera;
+		camera.NearZ = 0.5f;
+		camera.FarZ  = 800.0f;
+		const Float3 light(0.3f, -1.0f, 0.2f);
+
+		const float lambdas[] = { 0.0f, 0.5f, 0.75f, 1.0f };
+		for (float lambda : lambdas)
+		{
+			CascadeShadowMapMatrix cascade;
+			cascade.SetSplitLambda(lambda);
+			cascade.CalculateLightViewProjectionCropMatrix(camera, light, RESOLUTION);
+			float previous = camera.NearZ;
+			for (int i = 0; i < CASCADE_COUNT; ++i)
+			{
+				const float rate     = static_cast<float>(i + 1) / CASCADE_COUNT;
+				const float expected = lambda * camera.NearZ * std::pow(camera.FarZ / camera.NearZ, rate) + (1.0f - lambda) * (camera.NearZ + (camera.FarZ - camera.NearZ) * rate);
+				const float split    = cascade.GetSplitDistance(i);
+				TEST_CHECK_MESSAGE(std::fabs(split - expected) <= 1e-4f * expected, "lambda %f cascade %d : %f, expected %f", lambda, i, split, expected);
+				TEST_CHECK(split > previous);
+				previous = split;
+			}
+			TEST_CHECK(std::fabs(cascade.GetSplitDistance(CASCADE_COUNT - 1) - camera.FarZ) <= 1e-3f);
+		}
+
+		/* the shadow distance shortens the last split, but never beyond the far plane */
+		CascadeShadowMapMatrix cascade;
+		cascade.SetShadowDistance(120.0f);
+		cascade.CalculateLightViewProjectionCropMatrix(camera, light, RESOLUTION);
+		TEST_CHECK(std::fabs(cascade.GetSplitDistance(CASCADE_COUNT - 1) - 120.0f) <= 1e-3f);
+		cascade.SetShadowDistance(5000.0f);
+		cascade.CalculateLightViewProjectionCropMatrix(camera, light, RESOLUTION);
+		TEST_CHECK(std::fabs(cascade.GetSplitDistance(CASCADE_COUNT - 1) - camera.FarZ) <= 1e-3f);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Every corner of each slice (at any roll) is inside the crop box of the cascade,
+	-   and so is the bounding sphere of the slice
+	---------------------------------------------------------------------------*/
+	void CheckSliceContained()
+	{
+		test::Random random(44);
+		int outside = 0;
+		for (int trial = 0; trial < 300; ++trial)
+		{
+			Camera camera;
+			camera.Position    = Float3(random.Float(-200, 200), random.Float(-20, 80), random.Float(-200, 200));
+			camera.Look        = RandomDirection(random);
+			camera.NearZ       = random.Float(0.05f, 1.0f);
+			camera.FarZ        = random.Float(50.0f, 1500.0f);
+			camera.Aspect      = random.Float(0.5f, 2.5f);
+			camera.FovVertical = random.Float(0.3f, 1.8f);
+			const Float3 light = trial % 10 == 0 ? Float3(0.001f, -1.0f, 0.0005f) : RandomDirection(random); // also almost vertical
+
+			CascadeShadowMapMatrix cascade;
+			cascade.SetSplitLambda(random.Float(0.0f, 1.0f));
+			cascade.CalculateLightViewProjectionCropMatrix(camera, light, RESOLUTION);
+
+			float sliceNear = camera.NearZ;
+			for (int i = 0; i < CASCADE_COUNT; ++i)
+			{
+				const float    sliceFar = cascade.GetSplitDistance(i);
+				const Float4x4 crop     = GetCropMatrix(cascade, i);
+				for (int r = 0; r < 4; ++r)
+				{
+					Float3 corners[8];
+					GetSliceCorners(camera, random.Float(0.0f, 6.2831853f), sliceNear, sliceFar, corners);
+					for (const Float3& corner : corners)
+					{
+						const Float3 p = Transform(crop, corner);
+						const bool isInside = std::fabs(p.x) <= 1.0f + 1e-4f && std::fabs(p.y) <= 1.0f + 1e-4f && p.z >= -1e-4f && p.z <= 1.0f + 1e-4f;
+						if (!isInside && outside++ < 4) { std::printf("  trial %d cascade %d : corner at (%f, %f, %f)\n", trial, i, p.x, p.y, p.z); }
+					}
+				}
+				sliceNear = sliceFar;
+			}
+		}
+		TEST_CHECK_MESSAGE(outside == 0, "%d corner(s) outside the crop box", outside);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Texel snap : while the camera moves and turns, a fixed world point keeps its
+	-   position inside its texel (phase) and the texel keeps its world size
+	---------------------------------------------------------------------------*/
+	void CheckTexelSnap()
+	{
+		test::Random random(440);
+		const Float3 light    = Normalize(Float3(-0.4f, -1.0f, 0.7f));
+		const Float3 points[] = { Float3(13.7f, 2.1f, -5.3f), Float3(-40.25f, 0.0f, 17.5f), Float3(3.3f, 9.9f, 60.1f) };
+
+		Camera camera;
+		camera.Position = Float3(0.0f, 10.0f, -30.0f);
+		camera.Look     = Normalize(Float3(0.2f, -0.3f, 1.0f));
+		camera.FarZ     = 300.0f;
+
+		float firstTexel[CASCADE_COUNT] = {};
+		float previousPhase[CASCADE_COUNT][3][2] = {};
+		float maxPhaseChange = 0.0f, maxTexelChange = 0.0f;
+		for (int frame = 0; frame < 600; ++frame)
+		{
+			/* walk and turn a little every frame */
+			camera.Position = Add(camera.Position, Float3(random.Float(-0.05f, 0.05f), random.Float(-0.02f, 0.02f), random.Float(-0.05f, 0.05f)));
+			camera.Look     = Normalize(Add(camera.Look, Scale(RandomDirection(random), 0.01f)));
+
+			CascadeShadowMapMatrix cascade;
+			cascade.CalculateLightViewProjectionCropMatrix(camera, light, RESOLUTION);
+			for (int i = 0; i < CASCADE_COUNT; ++i)
+			{
+				const Float4x4 crop = GetCropMatrix(cascade, i);
+				float texelX = 0.0f, texelY = 0.0f;
+				GetTexelSize(crop, RESOLUTION[i], texelX, texelY);
+				if (frame == 0) { firstTexel[i] = texelX; }
+				maxTexelChange = (std::max)(maxTexelChange, std::fabs(texelX - firstTexel[i]) / firstTexel[i]);
+				maxTexelChange = (std::max)(maxTexelChange, std::fabs(texelY - firstTexel[i]) / firstTexel[i]);
+
+				for (int p = 0; p < 3; ++p)
+				{
+					const Float3 ndc = Transform(crop, points[p]);
+					const float  texel[2] = { (ndc.x * 0.5f + 0.5f) * RESOLUTION[i], (ndc.y * 0.5f + 0.5f) * RESOLUTION[i] };
+					for (int axis = 0; axis < 2; ++axis)
+					{
+						const float phase = texel[axis] - std::floor(texel[axis]);
+						if (frame > 0)
+						{
+							float change = std::fabs(phase - previousPhase[i][p][axis]);
+							change = (std::min)(change, 1.0f - change); // 0.999 -> 0.001 is the same phase
+							maxPhaseChange = (std::max)(maxPhaseChange, change);
+						}
+						previousPhase[i][p][axis] = phase;
+					}
+				}
+			}
+		}
+		TEST_CHECK_MESSAGE(maxPhaseChange <= 0.001f, "texel phase changed by %f texel", maxPhaseChange);
+		TEST_CHECK_MESSAGE(maxTexelChange <= 1e-5f, "texel size changed by %g", maxTexelChange);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Caster planes : casters in front of the crop box (toward the light) are kept,
+	-   the ones beside or behind it are rejected
+	---------------------------------------------------------------------------*/
+	bool IsInside(const FrustumPlanes& planes, const Float3& p, float radius)
+	{
+		for (const Float4& plane : planes.Planes)
+		{
+			if (plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w < -radius) { return false; }
+		}
+		return true;
+	}
+
+	void CheckCasterPlanes()
+	{
+		test::Random random(4400);
+		for (int trial = 0; trial < 100; ++trial)
+		{
+			Camera camera;
+			camera.Position = Float3(random.Float(-100, 100), random.Float(0, 50), random.Float(-100, 100));
+			camera.Look     = RandomDirection(random);
+			camera.FarZ     = random.Float(100.0f, 800.0f);
+
+			CascadeShadowMapMatrix cascade;
+			cascade.CalculateLightViewProjectionCropMatrix(camera, RandomDirection(random), RESOLUTION);
+			for (int i = 0; i < CASCADE_COUNT; ++i)
+			{
+				const FrustumPlanes& planes = cascade.GetCasterPlanes(i);
+				const Float3 forward = cascade.GetLightForward();
+				/* crop space scale : radius 0.02 of the box is a small caster */
+				const float boxSize = std::sqrt(Dot(Add(FromCropSpace(cascade, i, Float3(1, 0, 0)), Scale(FromCropSpace(cascade, i, Float3(-1, 0, 0)), -1.0f)),
+				                                    Add(FromCropSpace(cascade, i, Float3(1, 0, 0)), Scale(FromCropSpace(cascade, i, Float3(-1, 0, 0)), -1.0f))));
+				const float radius = 0.01f * boxSize;
+
+				/* inside, and in front of the box (the light passes through it before the box) */
+				TEST_CHECK(IsInside(planes, FromCropSpace(cascade, i, Float3(0.0f, 0.0f, 0.5f)), 0.0f));
+				TEST_CHECK(IsInside(planes, FromCropSpace(cascade, i, Float3(0.9f, -0.9f, 0.99f)), 0.0f));
+				const Float3 front = FromCropSpace(cascade, i, Float3(0.5f, -0.5f, -20.0f));
+				TEST_CHECK(Dot(front, forward) < Dot(FromCropSpace(cascade, i, Float3(0.5f, -0.5f, 0.0f)), forward));
+				TEST_CHECK(IsInside(planes, front, radius));
+				TEST_CHECK(IsInside(planes, FromCropSpace(cascade, i, Float3(-0.95f, 0.95f, -1000.0f)), radius));
+				/* a caster beside the box touching its side is kept */
+				TEST_CHECK(IsInside(planes, FromCropSpace(cascade, i, Float3(1.015f, 0.0f, 0.5f)), radius));
+
+				/* beside : right, left, up, down (also in front), and behind */
+				const Float3 rejected[] =
+				{
+					Float3( 1.1f,  0.0f,  0.5f), Float3(-1.1f, 0.3f, 0.5f), Float3(0.0f, 1.1f, -5.0f), Float3(0.2f, -1.1f, -50.0f),
+					Float3( 0.0f,  0.0f,  1.1f), Float3( 0.5f, 0.5f, 3.0f),
+				};
+				for (const Float3& crop : rejected)
+				{
+					TEST_CHECK_MESSAGE(!IsInside(planes, FromCropSpace(cascade, i, crop), radius), "trial %d cascade %d : (%f, %f, %f) kept", trial, i, crop.x, crop.y, crop.z);
+				}
+			}
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   ExtendNearPlane : the near plane moves toward the light, x, y are not changed
+	---------------------------------------------------------------------------*/
+	void CheckExtendNearPlane()
+	{
+		Camera camera;
+		camera.Position = Float3(5.0f, 3.0f, -10.0f);
+		camera.Look     = Normalize(Float3(0.3f, -0.2f, 1.0f));
+
+		CascadeShadowMapMatrix cascade;
+		cascade.CalculateLightViewProjectionCropMatrix(camera, Float3(0.5f, -1.0f, 0.3f), RESOLUTION);
+		const Float3   forward = cascade.GetLightForward();
+		const Float4x4 before  = GetCropMatrix(cascade, 0);
+		const Float3   nearPoint = FromCropSpace(cascade, 0, Float3(0.25f, -0.5f, 0.0f));
+		const Float3   farPoint  = FromCropSpace(cascade, 0, Float3(0.25f, -0.5f, 1.0f));
+
+		cascade.ExtendNearPlane(0, Dot(nearPoint, forward) + 10.0f); // not toward the light : nothing changes
+		const Float4x4 same = GetCropMatrix(cascade, 0);
+		bool isSame = true;
+		for (int r = 0; r < 4; ++r) { for (int c = 0; c < 4; ++c) { isSame &= same.m[r][c] == before.m[r][c]; } }
+		TEST_CHECK(isSame);
+
+		const float newNearZ = Dot(nearPoint, forward) - 50.0f;
+		cascade.ExtendNearPlane(0, newNearZ);
+		const Float4x4 after = GetCropMatrix(cascade, 0);
+		const Float3   moved = Add(nearPoint, Scale(forward, -50.0f));
+		const Float3   a     = Transform(after , moved);
+		const Float3   b     = Transform(before, nearPoint);
+		TEST_CHECK(std::fabs(a.z) < 1e-4f && std::fabs(Transform(after, farPoint).z - 1.0f) < 1e-4f);
+		TEST_CHECK(std::fabs(a.x - b.x) < 1e-5f && std::fabs(a.y - b.y) < 1e-5f);
+		TEST_CHECK(IsInside(cascade.GetCasterPlanes(0), moved, 0.0f)); // the planes are not changed by the extension
+	}
+}
+
+int main()
+{
+	CheckSplit();
+	CheckSliceContained();
+	CheckTexelSnap();
+	CheckCasterPlanes();
+	CheckExtendNearPlane();
+	return TEST_RESULT();
+}
@@ -0,0 +1,233 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   ClusteredLightingTest.cpp
+///             @brief  ClusteredLighting on the shared JobSystem against BuildReference,
+///                     the light lookup of lit points and the light binning benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/ClusteredLighting.hpp"
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	struct Scene
+	{
+		ClusterView             View;
+		std::vector<PointLight> PointLights;
+		std::vector<SpotLight>  SpotLights;
+	};
+
+	/* camera at the eye looking along the yaw direction (view = inverse of the camera transform) */
+	ClusterView MakeView(const gm::Float3& eye, float yaw)
+	{
+		const float c = std::cos(yaw), s = std::sin(yaw);
+		/* camera axes : right (c, 0, -s), up (0, 1, 0), forward (s, 0, c). The view matrix has them as columns. */
+		ClusterView view;
+		view.ViewMatrix = gm::Float4x4(
+			c   , 0.0f, s   , 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			-s  , 0.0f, c   , 0.0f,
+			-(eye.x * c - eye.z * s), -eye.y, -(eye.x * s + eye.z * c), 1.0f);
+		view.NearZ       = 0.5f;
+		view.FarZ        = 400.0f;
+		view.TanHalfFovY = 0.6f;
+		view.TanHalfFovX = 0.6f * 16.0f / 9.0f;
+		return view;
+	}
+
+	Scene MakeScene(size_t pointCount, size_t spotCount, test::Random& random)
+	{
+		Scene scene;
+		scene.View = MakeView(gm::Float3(random.Float(-20.0f, 20.0f), random.Float(0.0f, 5.0f), random.Float(-20.0f, 20.0f)), random.Float(0.0f, 6.28f));
+		for (size_t i = 0; i < pointCount; ++i)
+		{
+			const gm::Float3 position = gm::Float3(random.Float(-300.0f, 300.0f), random.Float(-20.0f, 40.0f), random.Float(-300.0f, 300.0f));
+			scene.PointLights.push_back(PointLight(position, random.Range(16) == 0 ? 0.0f : random.Float(0.5f, 25.0f)));
+		}
+		for (size_t i = 0; i < spotCount; ++i)
+		{
+			const gm::Float3 position  = gm::Float3(random.Float(-300.0f, 300.0f), random.Float(-20.0f, 40.0f), random.Float(-300.0f, 300.0f));
+			const float      x = random.Float(-1.0f, 1.0f), y = random.Float(-1.0f, 0.2f), z = random.Float(-1.0f, 1.0f);
+			const float      inverse   = 1.0f / std::sqrt(x * x + y * y + z * z + 1e-6f);
+			const float      outer     = random.Float(0.1f, 1.4f);
+			scene.SpotLights.push_back(SpotLight(position, random.Float(1.0f, 40.0f), 1.0f, gm::Float3(x * inverse, y * inverse, z * inverse),
+				gm::Float3(1.0f, 1.0f, 1.0f), outer * 0.5f, outer));
+		}
+		return scene;
+	}
+
+	struct Result
+	{
+		std::vector<ClusterLightRange> Ranges;
+		std::vector<std::uint32_t>     Indices;
+	};
+
+	Result Build(ClusteredLighting& clustered, const Scene& scene, bool isReference)
+	{
+		if (isReference)
+		{
+			clustered.BuildReference(scene.View, scene.PointLights.data(), scene.PointLights.size(), scene.SpotLights.data(), scene.SpotLights.size());
+		}
+		else
+		{
+			clustered.Build(scene.View, scene.PointLights.data(), scene.PointLights.size(), scene.SpotLights.data(), scene.SpotLights.size());
+		}
+		return Result{ clustered.GetLightRanges(), clustered.GetLightIndices() };
+	}
+
+	bool IsSameResult(const Result& a, const Result& b)
+	{
+		if (a.Ranges.size() != b.Ranges.size() || a.Indices != b.Indices) { return false; }
+		return a.Ranges.empty() || std::memcmp(a.Ranges.data(), b.Ranges.data(), a.Ranges.size() * sizeof(ClusterLightRange)) == 0;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Build on the calling thread and on the job system (shared with the culling
+	-   between the builds) outputs the same lists as the scalar reference
+	---------------------------------------------------------------------------*/
+	void CheckBuild()
+	{
+		JobSystem jobSystem;
+		jobSystem.Initialize(3);
+
+		ClusteredLighting serial, parallel, reference;
+		TEST_CHECK(serial   .Initialize(nullptr));
+		TEST_CHECK(parallel .Initialize(&jobSystem));
+		TEST_CHECK(reference.Initialize(nullptr));
+		TEST_CHECK(serial.GetWorkerCount() == 0 && parallel.GetWorkerCount() == 3);
+		TEST_CHECK(parallel.GetClusterCount() == CLUSTER_COUNT_X * CLUSTER_COUNT_Y * CLUSTER_COUNT_Z);
+
+		VisibilityCulling culling;
+		culling.Initialize(&jobSystem);
+		VisibilityBoundsArray bounds;
+		test::Random random(4900);
+		for (int i = 0; i < 20000; ++i) { bounds.AddSphere(gm::Float3(random.Float(-100.0f, 100.0f), 0.0f, random.Float(-100.0f, 100.0f)), 1.0f); }
+		FrustumPlanes everything;
+		for (gm::Float4& plane : everything.Planes) { plane = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f); }
+		culling.AddView(everything);
+
+		const size_t lightCounts[][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 100, 20 }, { 300, 100 }, { 1000, 250 }, { 3000, 500 } };
+		for (int scene = 0; scene < 12; ++scene)
+		{
+			const size_t* counts = lightCounts[scene % (sizeof(lightCounts) / sizeof(lightCounts[0]))];
+			const Scene   input  = MakeScene(counts[0], counts[1], random);
+
+			const Result expected = Build(reference, input, true);
+			TEST_CHECK_MESSAGE(IsSameResult(Build(serial  , input, false), expected), "scene %d (%zu + %zu lights) : calling thread", scene, counts[0], counts[1]);
+			culling.Execute(bounds);
+			TEST_CHECK_MESSAGE(IsSameResult(Build(parallel, input, false), expected), "scene %d (%zu + %zu lights) : job system"   , scene, counts[0], counts[1]);
+			TEST_CHECK(culling.GetVisibleList(0).size() == bounds.Size());
+
+			const ClusteredLighting::Statistics statistics = parallel.GetStatistics();
+			TEST_CHECK(statistics.PointLightCount == counts[0] && statistics.SpotLightCount == counts[1]);
+			TEST_CHECK(statistics.IndexCount == expected.Indices.size());
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   A point lit by a point light finds the light in the list of its cluster
+	---------------------------------------------------------------------------*/
+	void CheckLookup()
+	{
+		JobSystem jobSystem;
+		jobSystem.Initialize(2);
+		ClusteredLighting clustered;
+		clustered.Initialize(&jobSystem);
+
+		test::Random random(4901);
+		const Scene scene = MakeScene(2000, 0, random);
+		clustered.Build(scene.View, scene.PointLights.data(), scene.PointLights.size(), nullptr, 0);
+
+		const auto& m = scene.View.ViewMatrix.m;
+		size_t sampleCount = 0, missCount = 0;
+		for (size_t i = 0; i < scene.PointLights.size(); ++i)
+		{
+			const PointLight& light = scene.PointLights[i];
+			if (light.Range <= 0.0f) { continue; }
+			for (int sample = 0; sample < 32; ++sample)
+			{
+				const float x = light.Position.x + random.Float(-1.0f, 1.0f) * light.Range * 0.57f;
+				const float y = light.Position.y + random.Float(-1.0f, 1.0f) * light.Range * 0.57f;
+				const float z = light.Position.z + random.Float(-1.0f, 1.0f) * light.Range * 0.57f;
+				const float viewX = x * m[0][0] + y * m[1][0] + z * m[2][0] + m[3][0];
+				const float viewY = x * m[0][1] + y * m[1][1] + z * m[2][1] + m[3][1];
+				const float viewZ = x * m[0][2] + y * m[1][2] + z * m[2][2] + m[3][2];
+				const std::uint32_t cluster = clustered.GetClusterIndex(viewX, viewY, viewZ);
+				if (cluster == UINT32_MAX) { continue; }
+
+				const ClusterLightRange& range = clustered.GetLightRanges()[cluster];
+				const std::uint32_t* begin = clustered.GetLightIndices().data() + range.Offset;
+				sampleCount++;
+				if (std::find(begin, begin + range.PointCount, static_cast<std::uint32_t>(i)) == begin + range.PointCount) { missCount++; }
+			}
+		}
+		TEST_CHECK(sampleCount > 1000);
+		TEST_CHECK_MESSAGE(missCount == 0, "%zu of %zu lit points do not find their light", missCount, sampleCount);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Light binning per frame : scalar reference, calling thread, job system
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t lightCounts[] = { 1250, 5000, 20000 };
+		const int    frame = 10 * test::BenchScale();
+		test::Random random(4902);
+		char label[96];
+
+		JobSystem jobSystem;
+		jobSystem.Initialize((std::max)(static_cast<int>(std::thread::hardware_concurrency()), 2) - 1);
+		for (size_t lightCount : lightCounts)
+		{
+			const Scene scene = MakeScene(lightCount * 4 / 5, lightCount / 5, random);
+			if (lightCount <= 1250)
+			{
+				ClusteredLighting reference;
+				reference.Initialize(nullptr);
+				test::Timer timer;
+				Build(reference, scene, true);
+				std::snprintf(label, sizeof(label), "%5zu lights : scalar reference", lightCount);
+				test::PrintBench(label, timer.ElapsedMs(), 1, "frame");
+			}
+
+			JobSystem* jobSystems[] = { nullptr, &jobSystem };
+			for (JobSystem* system : jobSystems)
+			{
+				ClusteredLighting clustered;
+				clustered.Initialize(system);
+				Build(clustered, scene, false);
+
+				test::Timer timer;
+				for (int f = 0; f < frame; ++f)
+				{
+					clustered.Build(scene.View, scene.PointLights.data(), scene.PointLights.size(), scene.SpotLights.data(), scene.SpotLights.size());
+					test::DoNotOptimize(clustered.GetLightIndices());
+				}
+				std::snprintf(label, sizeof(label), "%5zu lights : simd, %d workers", lightCount, clustered.GetWorkerCount());
+				test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+			}
+		}
+	}
+}
+
+/* "stress" : skip the benchmark (used by the thread sanitizer build) */
+int main(int argc, char** argv)
+{
+	CheckBuild();
+	CheckLookup();
+	if (argc < 2 || std::strcmp(argv[1], "stress") != 0) { Bench(); }
+	return TEST_RESULT();
+}
@@ -0,0 +1,333 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VisibilityCullingTest.cpp
+///             @brief  JobSystem parallel for, VisibilityCulling against a scalar reference
+///                     (with and without workers) and the 100k bounds x 4 views benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Rendering/VisibilityCulling.hpp"
+#include "GameCore/Include/Core/JobSystem.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	struct Bound
+	{
+		gm::Float3 Center;
+		gm::Float3 Extent;
+		float      Radius;
+	};
+
+	gm::Float3 Normalize(float x, float y, float z)
+	{
+		const float inverse = 1.0f / std::sqrt(x * x + y * y + z * z);
+		return gm::Float3(x * inverse, y * inverse, z * inverse);
+	}
+
+	gm::Float4 Plane(const gm::Float3& normal, const gm::Float3& point)
+	{
+		return gm::Float4(normal.x, normal.y, normal.z, -(normal.x * point.x + normal.y * point.y + normal.z * point.z));
+	}
+
+	/* perspective frustum looking along the yaw direction in the xz plane (inside : dot(n, p) + w >= 0) */
+	FrustumPlanes MakeFrustum(const gm::Float3& eye, float yaw, float tanHalfFovX, float tanHalfFovY, float nearZ, float farZ)
+	{
+		const gm::Float3 f = gm::Float3(std::sin(yaw), 0.0f, std::cos(yaw));
+		const gm::Float3 r = gm::Float3(std::cos(yaw), 0.0f, -std::sin(yaw));
+		const gm::Float3 u = gm::Float3(0.0f, 1.0f, 0.0f);
+
+		FrustumPlanes frustum;
+		frustum.Planes[0] = Plane(Normalize( r.x + f.x * tanHalfFovX,  r.y + f.y * tanHalfFovX,  r.z + f.z * tanHalfFovX), eye);
+		frustum.Planes[1] = Plane(Normalize(-r.x + f.x * tanHalfFovX, -r.y + f.y * tanHalfFovX, -r.z + f.z * tanHalfFovX), eye);
+		frustum.Planes[2] = Plane(Normalize( u.x + f.x * tanHalfFovY,  u.y + f.y * tanHalfFovY,  u.z + f.z * tanHalfFovY), eye);
+		frustum.Planes[3] = Plane(Normalize(-u.x + f.x * tanHalfFovY, -u.y + f.y * tanHalfFovY, -u.z + f.z * tanHalfFovY), eye);
+		frustum.Planes[4] = Plane(f, gm::Float3(eye.x + f.x * nearZ, eye.y + f.y * nearZ, eye.z + f.z * nearZ));
+		frustum.Planes[5] = Plane(gm::Float3(-f.x, -f.y, -f.z), gm::Float3(eye.x + f.x * farZ, eye.y + f.y * farZ, eye.z + f.z * farZ));
+		return frustum;
+	}
+
+	std::vector<Bound> MakeBounds(size_t count, test::Random& random)
+	{
+		std::vector<Bound> bounds(count);
+		for (Bound& bound : bounds)
+		{
+			bound.Center = gm::Float3(random.Float(-500.0f, 500.0f), random.Float(-50.0f, 50.0f), random.Float(-500.0f, 500.0f));
+			bound.Extent = gm::Float3(random.Float(0.1f, 8.0f), random.Float(0.1f, 8.0f), random.Float(0.1f, 8.0f));
+			bound.Radius = std::sqrt(bound.Extent.x * bound.Extent.x + bound.Extent.y * bound.Extent.y + bound.Extent.z * bound.Extent.z);
+			if (random.Range(4) == 0) { bound.Radius *= random.Float(0.5f, 1.0f); } // tighter sphere than the box
+		}
+		return bounds;
+	}
+
+	std::vector<FrustumPlanes> MakeViews(size_t count, test::Random& random)
+	{
+		std::vector<FrustumPlanes> views;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const gm::Float3 eye = gm::Float3(random.Float(-100.0f, 100.0f), random.Float(-10.0f, 10.0f), random.Float(-100.0f, 100.0f));
+			views.push_back(MakeFrustum(eye, random.Float(0.0f, 6.28f), random.Float(0.5f, 1.5f), random.Float(0.4f, 1.0f), 0.5f, random.Float(100.0f, 600.0f)));
+		}
+		return views;
+	}
+
+	/* same arithmetic order as the simd kernel, so the result must match exactly */
+	bool IsVisibleReference(const FrustumPlanes& frustum, const Bound& bound)
+	{
+		for (const gm::Float4& plane : frustum.Planes)
+		{
+			const float distance = (plane.x * bound.Center.x + plane.y * bound.Center.y) + (plane.z * bound.Center.z + plane.w);
+			const float extent   = (std::fabs(plane.x) * bound.Extent.x + std::fabs(plane.y) * bound.Extent.y) + std::fabs(plane.z) * bound.Extent.z;
+			if (distance + (std::min)(bound.Radius, extent) < 0.0f) { return false; }
+		}
+		return true;
+	}
+
+	/* the former per actor test : sphere first, then the box */
+	bool IsVisibleAoS(const FrustumPlanes& frustum, const Bound& bound)
+	{
+		for (const gm::Float4& plane : frustum.Planes)
+		{
+			if (plane.x * bound.Center.x + plane.y * bound.Center.y + plane.z * bound.Center.z + plane.w < -bound.Radius) { return false; }
+		}
+		for (const gm::Float4& plane : frustum.Planes)
+		{
+			const float distance = plane.x * bound.Center.x + plane.y * bound.Center.y + plane.z * bound.Center.z + plane.w;
+			const float extent   = std::fabs(plane.x) * bound.Extent.x + std::fabs(plane.y) * bound.Extent.y + std::fabs(plane.z) * bound.Extent.z;
+			if (distance + extent < 0.0f) { return false; }
+		}
+		return true;
+	}
+
+	void ToBoundsArray(const std::vector<Bound>& source, VisibilityBoundsArray& bounds)
+	{
+		bounds.Clear();
+		bounds.Reserve(source.size());
+		for (const Bound& bound : source) { bounds.Add(bound.Center, bound.Extent, bound.Radius); }
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Every index runs exactly once, with and without workers,
+	-   also when several threads call ParallelFor at the same time
+	---------------------------------------------------------------------------*/
+	void CheckJobSystem(bool isStress)
+	{
+		const int workerCounts[] = { 0, 1, 3 };
+		for (int workerCount : workerCounts)
+		{
+			JobSystem jobSystem;
+			TEST_CHECK(jobSystem.Initialize(workerCount));
+			TEST_CHECK(jobSystem.GetWorkerCount() == workerCount);
+
+			std::vector<std::atomic<int>> counts(1000);
+			for (size_t jobCount = 0; jobCount <= counts.size(); jobCount += jobCount < 20 ? 1 : 97)
+			{
+				for (auto& count : counts) { count = 0; }
+				jobSystem.ParallelFor(jobCount, [&](size_t index) { counts[index].fetch_add(1, std::memory_order_relaxed); });
+				bool isOnce = true;
+				for (size_t i = 0; i < counts.size(); ++i) { isOnce &= counts[i].load() == (i < jobCount ? 1 : 0); }
+				TEST_CHECK_MESSAGE(isOnce, "%d workers, %zu jobs", workerCount, jobCount);
+			}
+
+			/*-------------------------------------------------------------------
+			-              Two callers share the pool
+			---------------------------------------------------------------------*/
+			const int repeat = isStress ? 2000 : 200;
+			std::atomic<std::uint64_t> sums[2] = { 0, 0 };
+			auto caller = [&](int id)
+			{
+				for (int i = 0; i < repeat; ++i)
+				{
+					jobSystem.ParallelFor(64, [&](size_t index) { sums[id].fetch_add(index + 1, std::memory_order_relaxed); });
+				}
+			};
+			std::thread other(caller, 1);
+			caller(0);
+			other.join();
+			TEST_CHECK(sums[0].load() == 2080ull * repeat && sums[1].load() == 2080ull * repeat);
+
+			jobSystem.Finalize();
+			TEST_CHECK(jobSystem.GetWorkerCount() == 0);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Boxes and spheres added to the array
+	---------------------------------------------------------------------------*/
+	void CheckBounds()
+	{
+		VisibilityBox box;
+		TEST_CHECK(box.IsEmpty());
+		box.Merge(gm::Float3(1.0f, 2.0f, 3.0f));
+		box.Merge(gm::Float3(-1.0f, 0.0f, 5.0f));
+		TEST_CHECK(!box.IsEmpty() && box.Min.x == -1.0f && box.Max.z == 5.0f);
+		box.Expand(1.0f);
+		TEST_CHECK(box.Min.y == -1.0f && box.Max.y == 3.0f);
+
+		/* rotation of 90 degrees about y (x -> -z, z -> x) and translation */
+		const gm::Float4x4 matrix(0.0f, 0.0f, -1.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,  1.0f, 0.0f, 0.0f, 0.0f,  10.0f, 20.0f, 30.0f, 1.0f);
+		const VisibilityBox moved = box.Transform(matrix);
+		TEST_CHECK(moved.Min.x == 12.0f && moved.Max.x == 16.0f);
+		TEST_CHECK(moved.Min.y == 19.0f && moved.Max.y == 23.0f);
+		TEST_CHECK(moved.Min.z == 28.0f && moved.Max.z == 32.0f);
+		TEST_CHECK(VisibilityBox().Transform(matrix).IsEmpty());
+
+		VisibilityBoundsArray bounds;
+		bounds.Add(box);
+		bounds.AddSphere(gm::Float3(5.0f, 6.0f, 7.0f), 2.0f);
+		TEST_CHECK(bounds.Size() == 2);
+		TEST_CHECK(bounds.CenterX[0] == 0.0f && bounds.ExtentZ[0] == 2.0f && bounds.Radius[0] == std::sqrt(12.0f));
+		TEST_CHECK(bounds.CenterZ[1] == 7.0f && bounds.ExtentX[1] == 2.0f && bounds.Radius[1] == 2.0f);
+		TEST_CHECK(bounds.CenterX.size() % VISIBILITY_LANE_COUNT == 0);
+		bounds.Clear();
+		TEST_CHECK(bounds.Size() == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Visible lists against the reference around the chunk and lane boundaries
+	---------------------------------------------------------------------------*/
+	void CheckCulling()
+	{
+		const size_t counts[] = { 0, 1, 7, 8, 9, 4095, 4096, 4097, 8191, 8192, 8193, 20000, 100003 };
+		test::Random random(4300);
+		const std::vector<FrustumPlanes> views = MakeViews(4, random);
+
+		JobSystem jobSystem;
+		jobSystem.Initialize(3);
+		JobSystem* jobSystems[] = { nullptr, &jobSystem };
+		for (JobSystem* system : jobSystems)
+		{
+			VisibilityCulling culling;
+			TEST_CHECK(culling.Initialize(system));
+			TEST_CHECK(culling.GetWorkerCount() == (system != nullptr ? 3 : 0));
+
+			VisibilityBoundsArray bounds;
+			for (size_t count : counts)
+			{
+				const std::vector<Bound> source = MakeBounds(count, random);
+				ToBoundsArray(source, bounds);
+
+				culling.ClearViews();
+				for (const FrustumPlanes& view : views) { culling.AddView(view); }
+				for (int repeat = 0; repeat < 2; ++repeat)
+				{
+					culling.Execute(bounds);
+					for (size_t view = 0; view < views.size(); ++view)
+					{
+						std::vector<std::uint32_t> expected;
+						for (size_t i = 0; i < count; ++i)
+						{
+							if (IsVisibleReference(views[view], source[i])) { expected.push_back(static_cast<std::uint32_t>(i)); }
+						}
+						TEST_CHECK_MESSAGE(culling.GetVisibleList(static_cast<int>(view)) == expected,
+							"%zu bounds, view %zu, %s : %zu visible, expected %zu", count, view, system != nullptr ? "workers" : "calling thread",
+							culling.GetVisibleList(static_cast<int>(view)).size(), expected.size());
+					}
+				}
+			}
+			culling.Finalize();
+		}
+
+		/*-------------------------------------------------------------------
+		-              Fewer views keep the lists of the removed ones out
+		---------------------------------------------------------------------*/
+		VisibilityCulling culling;
+		culling.Initialize(&jobSystem);
+		VisibilityBoundsArray bounds;
+		ToBoundsArray(MakeBounds(10000, random), bounds);
+		culling.AddView(views[0]);
+		culling.AddView(views[1]);
+		culling.Execute(bounds);
+		culling.ClearViews();
+		TEST_CHECK(culling.AddView(views[2]) == 0);
+		TEST_CHECK(culling.GetViewCount() == 1);
+		culling.Execute(bounds);
+		size_t expected = 0;
+		for (size_t i = 0; i < bounds.Size(); ++i)
+		{
+			const Bound bound = { gm::Float3(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]), gm::Float3(bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]), bounds.Radius[i] };
+			expected += IsVisibleReference(views[2], bound) ? 1 : 0;
+		}
+		TEST_CHECK(culling.GetVisibleList(0).size() == expected);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   100k bounds x 4 views : the per actor AoS test against the SoA kernel
+	-   on the calling thread and on the shared job system
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t count = 100000;
+		const int    frame = 20 * test::BenchScale();
+		test::Random random(4301);
+		const std::vector<Bound>         source = MakeBounds(count, random);
+		const std::vector<FrustumPlanes> views  = MakeViews(4, random);
+		char label[96];
+
+		VisibilityBoundsArray bounds;
+		ToBoundsArray(source, bounds);
+
+		std::vector<std::vector<std::uint32_t>> lists(views.size());
+		size_t visibleCount = 0;
+		test::Timer timer;
+		for (int f = 0; f < frame; ++f)
+		{
+			visibleCount = 0;
+			for (size_t view = 0; view < views.size(); ++view)
+			{
+				lists[view].clear();
+				for (size_t i = 0; i < count; ++i)
+				{
+					if (IsVisibleAoS(views[view], source[i])) { lists[view].push_back(static_cast<std::uint32_t>(i)); }
+				}
+				visibleCount += lists[view].size();
+			}
+			test::DoNotOptimize(lists[0]);
+		}
+		std::snprintf(label, sizeof(label), "100k x 4 : AoS scalar (%zu visible)", visibleCount);
+		test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+
+		const int workerCounts[] = { 0, static_cast<int>((std::max)(std::thread::hardware_concurrency(), 2u)) - 1 };
+		for (int workerCount : workerCounts)
+		{
+			JobSystem jobSystem;
+			jobSystem.Initialize(workerCount);
+			VisibilityCulling culling;
+			culling.Initialize(&jobSystem);
+			for (const FrustumPlanes& view : views) { culling.AddView(view); }
+
+			culling.Execute(bounds); // warm up the lists
+			timer.Reset();
+			for (int f = 0; f < frame; ++f)
+			{
+				culling.Execute(bounds);
+				test::DoNotOptimize(culling.GetVisibleList(0));
+			}
+			std::snprintf(label, sizeof(label), "100k x 4 : SoA simd, %d workers", workerCount);
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+		}
+	}
+}
+
+/* "stress" : skip the benchmark (used by the thread sanitizer build) */
+int main(int argc, char** argv)
+{
+	const bool isStress = argc >= 2 && std::strcmp(argv[1], "stress") == 0;
+	CheckJobSystem(isStress);
+	CheckBounds();
+	CheckCulling();
+	if (!isStress) { Bench(); }
+	return TEST_RESULT();
+}
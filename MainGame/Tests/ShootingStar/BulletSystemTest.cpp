@@ -0,0 +1,195 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BulletSystemTest.cpp
+///             @brief  BulletSystem : update / vertices against a scalar reference and the 50k bullets frame time
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MainGame/ShootingStar/Include/Bullet/BulletSystem.hpp"
+#include "GameCore/Include/Sprite/SpriteRenderer.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <vector>
+
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	const Float2 g_typeSize[] = { Float2(0.02f, 0.02f), Float2(0.05f, 0.01f), Float2(0.1f, 0.1f) };
+	constexpr int g_typeCount = static_cast<int>(_countof(g_typeSize));
+
+	/* one bullet of the reference (array of structures, same float operations as the kernels) */
+	struct ReferenceBullet
+	{
+		float X, Y, VelocityX, VelocityY, Lifetime;
+		int   TypeID;
+	};
+
+	void RegisterTypes(BulletSystem& bullets)
+	{
+		for (int type = 0; type < g_typeCount; ++type)
+		{
+			bullets.SetBulletSprite(type, g_typeSize[type], Float2(0.25f * type, 0.25f * type + 0.25f), Float2(0.0f, 1.0f), Float4(1.0f, 0.5f, 0.25f * type, 1.0f));
+		}
+	}
+
+	ReferenceBullet MakeBullet(test::Random& random)
+	{
+		ReferenceBullet bullet;
+		bullet.X         = random.Float(-1.0f, 1.0f);
+		bullet.Y         = random.Float(-1.0f, 1.0f);
+		bullet.VelocityX = random.Float(-0.5f, 0.5f);
+		bullet.VelocityY = random.Float(-0.5f, 0.5f);
+		bullet.Lifetime  = random.Bool() ? random.Float(0.0f, 2.0f) : FLT_MAX;
+		bullet.TypeID    = static_cast<int>(random.Range(g_typeCount));
+		return bullet;
+	}
+
+	void UpdateReference(std::vector<ReferenceBullet>& bullets, float deltaTime)
+	{
+		std::vector<ReferenceBullet> alive;
+		for (ReferenceBullet bullet : bullets)
+		{
+			bullet.X        = bullet.X + bullet.VelocityX * deltaTime;
+			bullet.Y        = bullet.Y + bullet.VelocityY * deltaTime;
+			bullet.Lifetime = bullet.Lifetime - deltaTime;
+			const float hw  = g_typeSize[bullet.TypeID].x / 2;
+			const float hh  = g_typeSize[bullet.TypeID].y / 2;
+			if (bullet.Lifetime > 0.0f && bullet.X + hw >= -1.0f && bullet.X - hw <= 1.0f && bullet.Y + hh >= -1.0f && bullet.Y - hh <= 1.0f)
+			{
+				alive.push_back(bullet);
+			}
+		}
+		bullets.swap(alive);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Update : same survivors in the same order, bit exact positions
+	-   WriteVertices : rect corners of Sprite::CreateRect order
+	---------------------------------------------------------------------------*/
+	void CheckAgainstReference()
+	{
+		test::Random random(30);
+		for (int round = 0; round < 16; ++round)
+		{
+			BulletSystem bullets;
+			RegisterTypes(bullets);
+			std::vector<ReferenceBullet> reference;
+
+			for (int frame = 0; frame < 90; ++frame)
+			{
+				const size_t spawnCount = random.Range(80);
+				for (size_t i = 0; i < spawnCount; ++i)
+				{
+					reference.push_back(MakeBullet(random));
+					const ReferenceBullet& b = reference.back();
+					TEST_CHECK(bullets.Spawn(Float2(b.X, b.Y), Float2(b.VelocityX, b.VelocityY), b.TypeID, b.Lifetime));
+				}
+				const float deltaTime = random.Float(0.005f, 0.05f);
+				bullets.Update(deltaTime);
+				UpdateReference(reference, deltaTime);
+			}
+
+			TEST_CHECK_MESSAGE(bullets.Size() == reference.size(), "round %d : %zu bullets, reference %zu", round, bullets.Size(), reference.size());
+			if (bullets.Size() != reference.size()) { continue; }
+
+			int failed = 0;
+			for (size_t i = 0; i < reference.size(); ++i)
+			{
+				const ReferenceBullet& b = reference[i];
+				if (bullets.GetPositionX()[i] != b.X || bullets.GetPositionY()[i] != b.Y ||
+					bullets.GetLifetime()[i] != b.Lifetime || bullets.GetTypeID()[i] != b.TypeID) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "round %d : %d bullet(s) differ from the reference", round, failed);
+
+			std::vector<VertexPositionNormalColorTexture> vertices(reference.size() * 4 + 4);
+			const size_t written = bullets.WriteVertices(vertices.data(), reference.size());
+			TEST_CHECK(written == reference.size());
+			failed = 0;
+			for (size_t i = 0; i < written; ++i)
+			{
+				const ReferenceBullet& b = reference[i];
+				const float hw = g_typeSize[b.TypeID].x / 2, hh = g_typeSize[b.TypeID].y / 2;
+				const VertexPositionNormalColorTexture* quad = &vertices[i * 4];
+				if (quad[0].Position.x != b.X - hw || quad[0].Position.y != b.Y - hh ||
+					quad[1].Position.x != b.X - hw || quad[1].Position.y != b.Y + hh ||
+					quad[2].Position.x != b.X + hw || quad[2].Position.y != b.Y + hh ||
+					quad[3].Position.x != b.X + hw || quad[3].Position.y != b.Y - hh ||
+					quad[0].UV.x != 0.25f * b.TypeID || quad[0].Color.z != 0.25f * b.TypeID) { failed++; }
+			}
+			TEST_CHECK_MESSAGE(failed == 0, "round %d : %d quad(s) differ", round, failed);
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Draw writes at most the free space of the renderer, and the errors are reported
+	---------------------------------------------------------------------------*/
+	void CheckDrawAndErrors()
+	{
+		BulletSystem bullets;
+		RegisterTypes(bullets);
+
+		const int errorCount = test_stub::DebugStringCount();
+		TEST_CHECK(!bullets.Spawn(Float2(0.0f, 0.0f), Float2(0.0f, 0.0f), 7));
+		TEST_CHECK(!bullets.SetBulletSprite(-1, Float2(1.0f, 1.0f), Float2(0.0f, 1.0f), Float2(0.0f, 1.0f)));
+		TEST_CHECK(test_stub::DebugStringCount() == errorCount + 2);
+
+		for (int i = 0; i < 100; ++i) { bullets.Spawn(Float2(0.0f, 0.0f), Float2(0.0f, 0.0f), 0); }
+
+		SpriteRenderer renderer(160);
+		TEST_CHECK(bullets.Draw(renderer, Texture(), Matrix4()));
+		TEST_CHECK(renderer.SpriteCount == 100);
+		TEST_CHECK(bullets.Draw(renderer, Texture(), Matrix4()));
+		TEST_CHECK(renderer.SpriteCount == 160 && renderer.DrawCallCount == 2);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   60k bullets per frame on one thread : Update + vertex write (+ respawn of the removed ones)
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t count = 60000;
+		const int    frame = 240 * test::BenchScale();
+		const float  deltaTime = 1.0f / 60.0f;
+		test::Random random(300);
+
+		BulletSystem bullets;
+		RegisterTypes(bullets);
+		bullets.Reserve(count);
+		std::vector<VertexPositionNormalColorTexture> vertices(count * 4);
+
+		double updateMs = 0.0, vertexMs = 0.0;
+		test::Timer timer;
+		for (int f = 0; f < frame; ++f)
+		{
+			while (bullets.Size() < count)
+			{
+				const ReferenceBullet b = MakeBullet(random);
+				bullets.Spawn(Float2(b.X, b.Y), Float2(b.VelocityX, b.VelocityY), b.TypeID, b.Lifetime);
+			}
+			timer.Reset();
+			bullets.Update(deltaTime);
+			updateMs += timer.ElapsedMs();
+			timer.Reset();
+			test::DoNotOptimize(bullets.WriteVertices(vertices.data(), count));
+			test::DoNotOptimize(vertices[0]);
+			vertexMs += timer.ElapsedMs();
+		}
+		test::PrintBench("60k bullets : Update", updateMs, count * frame, "bullet");
+		test::PrintBench("60k bullets : WriteVertices", vertexMs, count * frame, "bullet");
+		std::printf("[BENCH] 60k bullets : %.3f ms / frame (60 fps budget 16.7 ms)\n", (updateMs + vertexMs) / frame);
+	}
+}
+
+int main()
+{
+	CheckAgainstReference();
+	CheckDrawAndErrors();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,290 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SpriteBatcherTest.cpp
+///             @brief  SpriteBatcher : deferred / texture sorted batches, direct writes, growth,
+///                     the non temporal copies and the per frame submission benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Sprite/SpriteBatcher.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <algorithm>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	using Vertex = SpriteBatcher::Vertex;
+	constexpr size_t SPRITE_BYTE_SIZE = sizeof(Vertex) * SPRITE_VERTEX_COUNT;
+
+	/* one draw call of the game : spriteCount sprites of one texture */
+	struct Draw
+	{
+		std::uint64_t TextureKey;
+		std::uint32_t BlendType;
+		std::vector<Vertex> Vertices;
+	};
+
+	std::vector<Draw> MakeDraws(size_t drawCount, size_t spritesPerDraw, std::uint32_t textureCount, test::Random& random)
+	{
+		std::vector<Draw> draws(drawCount);
+		float id = 0.0f;
+		for (size_t d = 0; d < drawCount; ++d)
+		{
+			draws[d].TextureKey = 100 + random.Range(textureCount);
+			draws[d].BlendType  = random.Range(3) == 0 ? 1 : 0;
+			draws[d].Vertices.resize(spritesPerDraw * SPRITE_VERTEX_COUNT);
+			for (Vertex& vertex : draws[d].Vertices)
+			{
+				vertex.Position = gm::Float3(id, static_cast<float>(d), 0.0f);
+				vertex.Normal   = gm::Float3(0.0f, 0.0f, -1.0f);
+				vertex.Color    = gm::Float4(1.0f, 1.0f, 1.0f, static_cast<float>(draws[d].TextureKey));
+				vertex.UV       = gm::Float2(id * 0.5f, 1.0f);
+				id += 1.0f;
+			}
+		}
+		return draws;
+	}
+
+	bool IsSameSprites(const Vertex* a, const Vertex* b, size_t spriteCount)
+	{
+		return std::memcmp(a, b, SPRITE_BYTE_SIZE * spriteCount) == 0;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Deferred : the submission order is kept and adjacent draws of the same state merge.
+	-   Texture  : the batches follow the stable (blend, texture) order.
+	-   Both through staging and, for Deferred, straight into the destination.
+	---------------------------------------------------------------------------*/
+	void CheckBatches()
+	{
+		test::Random random(41);
+		SpriteBatcher batcher;
+		for (int round = 0; round < 50; ++round)
+		{
+			const size_t      drawCount = 1 + random.Range(64);
+			const std::vector<Draw> draws = MakeDraws(drawCount, 1 + random.Range(40), 1 + random.Range(4), random);
+			size_t totalSprites = 0;
+			for (const Draw& draw : draws) { totalSprites += draw.Vertices.size() / SPRITE_VERTEX_COUNT; }
+
+			/*-------------------------------------------------------------------
+			-              Expected output of both modes
+			---------------------------------------------------------------------*/
+			std::vector<Vertex> deferredExpected;
+			std::vector<SpriteDrawBatch> deferredBatches;
+			for (const Draw& draw : draws)
+			{
+				const std::uint32_t count = static_cast<std::uint32_t>(draw.Vertices.size() / SPRITE_VERTEX_COUNT);
+				if (!deferredBatches.empty() && deferredBatches.back().TextureKey == draw.TextureKey && deferredBatches.back().BlendType == draw.BlendType)
+				{
+					deferredBatches.back().SpriteCount += count;
+				}
+				else
+				{
+					deferredBatches.push_back({ draw.TextureKey, 0, draw.BlendType, static_cast<std::uint32_t>(deferredExpected.size() / SPRITE_VERTEX_COUNT), count });
+				}
+				deferredExpected.insert(deferredExpected.end(), draw.Vertices.begin(), draw.Vertices.end());
+			}
+
+			std::vector<size_t> order(drawCount);
+			for (size_t i = 0; i < drawCount; ++i) { order[i] = i; }
+			std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+			{
+				if (draws[a].BlendType != draws[b].BlendType) { return draws[a].BlendType < draws[b].BlendType; }
+				return draws[a].TextureKey < draws[b].TextureKey;
+			});
+			std::vector<Vertex> sortedExpected;
+			size_t sortedBatchCount = 0;
+			for (size_t i = 0; i < drawCount; ++i)
+			{
+				const Draw& draw = draws[order[i]];
+				if (i == 0 || draw.TextureKey != draws[order[i - 1]].TextureKey || draw.BlendType != draws[order[i - 1]].BlendType) { sortedBatchCount++; }
+				sortedExpected.insert(sortedExpected.end(), draw.Vertices.begin(), draw.Vertices.end());
+			}
+
+			/*-------------------------------------------------------------------
+			-              Deferred (staging), Deferred (direct), Texture
+			---------------------------------------------------------------------*/
+			const SpriteSortMode modes[] = { SpriteSortMode::Deferred, SpriteSortMode::Deferred, SpriteSortMode::Texture };
+			for (int m = 0; m < 3; ++m)
+			{
+				std::vector<Vertex> output(totalSprites * SPRITE_VERTEX_COUNT + SPRITE_VERTEX_COUNT);
+				batcher.Begin(modes[m], m == 1 ? output.data() : nullptr);
+				TEST_CHECK(batcher.IsDirect() == (m == 1));
+				for (size_t d = 0; d < drawCount; ++d)
+				{
+					const Draw& draw = draws[d];
+					const size_t count = draw.Vertices.size() / SPRITE_VERTEX_COUNT;
+					if (d % 2 == 0)
+					{
+						batcher.Add(draw.Vertices.data(), count, SPRITE_BYTE_SIZE, draw.TextureKey, static_cast<std::uint32_t>(d), draw.BlendType);
+						continue;
+					}
+					/* Reserve more than needed and commit only the written sprites */
+					Vertex* area = batcher.Reserve(count + 3);
+					std::memcpy(area, draw.Vertices.data(), SPRITE_BYTE_SIZE * count);
+					batcher.Commit(count, draw.TextureKey, static_cast<std::uint32_t>(d), draw.BlendType);
+				}
+				TEST_CHECK(batcher.GetSpriteCount() == totalSprites);
+
+				const std::vector<SpriteDrawBatch>& batches = batcher.End(m == 1 ? nullptr : output.data());
+				const std::vector<Vertex>& expected = modes[m] == SpriteSortMode::Texture ? sortedExpected : deferredExpected;
+				TEST_CHECK_MESSAGE(IsSameSprites(output.data(), expected.data(), totalSprites), "round %d mode %d : vertices differ", round, m);
+
+				bool batchFailed = modes[m] == SpriteSortMode::Texture ? batches.size() != sortedBatchCount : batches.size() != deferredBatches.size();
+				std::uint32_t first = 0;
+				for (size_t b = 0; b < batches.size() && !batchFailed; ++b)
+				{
+					if (batches[b].FirstSprite != first) { batchFailed = true; }
+					if (b > 0 && batches[b].TextureKey == batches[b - 1].TextureKey && batches[b].BlendType == batches[b - 1].BlendType) { batchFailed = true; }
+					if (modes[m] == SpriteSortMode::Deferred && (batches[b].SpriteCount != deferredBatches[b].SpriteCount || batches[b].TextureKey != deferredBatches[b].TextureKey)) { batchFailed = true; }
+					/* every sprite of the batch was drawn with its texture (Color.w) */
+					for (std::uint32_t s = 0; s < batches[b].SpriteCount; ++s)
+					{
+						if (output[(first + s) * SPRITE_VERTEX_COUNT].Color.w != static_cast<float>(batches[b].TextureKey)) { batchFailed = true; }
+					}
+					first += batches[b].SpriteCount;
+				}
+				TEST_CHECK_MESSAGE(!batchFailed && first == totalSprites, "round %d mode %d : batches differ", round, m);
+			}
+		}
+
+		/* an empty frame and zero sprite draws do not produce batches */
+		batcher.Begin(SpriteSortMode::Texture);
+		batcher.Add(nullptr, 0, SPRITE_BYTE_SIZE, 1, 0, 0);
+		batcher.Commit(0, 1, 0, 0);
+		TEST_CHECK(batcher.End(nullptr).empty() && batcher.GetCommandCount() == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   The staging grows past its minimum capacity and keeps the written sprites
+	---------------------------------------------------------------------------*/
+	void CheckGrowth()
+	{
+		test::Random random(410);
+		const std::vector<Draw> draws = MakeDraws(7, 10001, 3, random);
+		SpriteBatcher batcher;
+		batcher.Begin(SpriteSortMode::Deferred);
+		std::vector<Vertex> expected;
+		for (const Draw& draw : draws)
+		{
+			batcher.Add(draw.Vertices.data(), 10001, SPRITE_BYTE_SIZE, draw.TextureKey, 0, draw.BlendType);
+			expected.insert(expected.end(), draw.Vertices.begin(), draw.Vertices.end());
+		}
+		std::vector<Vertex> output(expected.size());
+		batcher.End(output.data());
+		TEST_CHECK(batcher.GetSpriteCount() == 70007 && IsSameSprites(output.data(), expected.data(), 70007));
+	}
+
+	/*---------------------------------------------------------------------------
+	-   CopyVertices / CopySprites : unaligned destinations, sizes around the
+	-   streaming threshold and sprites with a larger stride (Sprite objects)
+	---------------------------------------------------------------------------*/
+	void CheckCopies()
+	{
+		test::Random random(411);
+		std::vector<std::uint8_t> source(64 * 1024 + 64), destination(source.size() + 64), expected;
+		for (std::uint8_t& value : source) { value = static_cast<std::uint8_t>(random.Next()); }
+
+		int failed = 0;
+		const size_t sizes[] = { 0, 1, 15, 16, 63, 64, 255, 256, 257, 1000, 4096, 64 * 1024 + 7 };
+		for (size_t size : sizes)
+		{
+			for (size_t offset = 0; offset < 32; offset += 4)
+			{
+				std::fill(destination.begin(), destination.end(), 0xCD);
+				SpriteBatcher::CopyVertices(destination.data() + offset, source.data() + 3, size);
+				if (std::memcmp(destination.data() + offset, source.data() + 3, size) != 0) { failed++; }
+				if (destination[offset + size] != 0xCD || (offset > 0 && destination[offset - 1] != 0xCD)) { failed++; }
+			}
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "CopyVertices : %d copy(s) differ", failed);
+
+		/* stride : a sprite object with 4 vertices followed by other members */
+		const size_t stride = SPRITE_BYTE_SIZE + 40;
+		const size_t spriteCount = 100;
+		std::vector<std::uint8_t> sprites(stride * spriteCount);
+		for (std::uint8_t& value : sprites) { value = static_cast<std::uint8_t>(random.Next()); }
+		for (size_t offset = 0; offset < 32; offset += 16)
+		{
+			std::vector<std::uint8_t> packed(SPRITE_BYTE_SIZE * spriteCount + 32);
+			SpriteBatcher::CopySprites(packed.data() + offset, sprites.data(), spriteCount, stride);
+			for (size_t i = 0; i < spriteCount; ++i)
+			{
+				if (std::memcmp(packed.data() + offset + i * SPRITE_BYTE_SIZE, sprites.data() + i * stride, SPRITE_BYTE_SIZE) != 0) { failed++; }
+			}
+		}
+		TEST_CHECK_MESSAGE(failed == 0, "CopySprites : %d sprite(s) differ", failed);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   One frame of 128 draws : the old path (one copy and one draw per call)
+	-   against the deferred direct ring write and the texture sort
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t spriteCounts[] = { 2000, 10000, 100000 };
+		const size_t drawCount = 128;
+		const int    frame     = 50 * test::BenchScale();
+		test::Random random(4100);
+		char label[96];
+
+		for (size_t spriteCount : spriteCounts)
+		{
+			const std::vector<Draw> draws = MakeDraws(drawCount, spriteCount / drawCount, 8, random);
+			const size_t totalSprites = (spriteCount / drawCount) * drawCount;
+			std::vector<Vertex> ring(totalSprites * SPRITE_VERTEX_COUNT);
+			SpriteBatcher batcher;
+			size_t drawCalls = 0;
+
+			test::Timer timer;
+			for (int f = 0; f < frame; ++f)
+			{
+				size_t written = 0;
+				for (const Draw& draw : draws)
+				{
+					std::memcpy(ring.data() + written, draw.Vertices.data(), draw.Vertices.size() * sizeof(Vertex));
+					written += draw.Vertices.size();
+					drawCalls++;
+				}
+				test::DoNotOptimize(ring[0]);
+			}
+			std::snprintf(label, sizeof(label), "%6zu sprites : per call copy (128 draws)", totalSprites);
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+
+			const SpriteSortMode modes[] = { SpriteSortMode::Deferred, SpriteSortMode::Texture };
+			for (SpriteSortMode mode : modes)
+			{
+				size_t batchCount = 0;
+				timer.Reset();
+				for (int f = 0; f < frame; ++f)
+				{
+					batcher.Begin(mode, ring.data());
+					for (const Draw& draw : draws)
+					{
+						batcher.Add(draw.Vertices.data(), draw.Vertices.size() / SPRITE_VERTEX_COUNT, SPRITE_BYTE_SIZE, draw.TextureKey, 0, draw.BlendType);
+					}
+					batchCount = batcher.End(ring.data()).size();
+					test::DoNotOptimize(ring[0]);
+				}
+				std::snprintf(label, sizeof(label), "%6zu sprites : %s (%zu batches)", totalSprites, mode == SpriteSortMode::Deferred ? "deferred" : "texture", batchCount);
+				test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+			}
+			test::DoNotOptimize(drawCalls);
+		}
+	}
+}
+
+int main()
+{
+	CheckBatches();
+	CheckGrowth();
+	CheckCopies();
+	Bench();
+	return TEST_RESULT();
+}
@@ -0,0 +1,487 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   TextLayoutCacheTest.cpp
+///             @brief  GlyphAtlas packing / growth / reset and TextLayoutCache quads, cache hits,
+///                     digit updates, eviction and the per frame text benchmark
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Include/Sprite/GlyphAtlas.hpp"
+#include "GameCore/Include/Sprite/TextLayoutCache.hpp"
+#include "Tests/Common/TestCommon.hpp"
+#include <vector>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	using Vertex = TextLayoutCache::Vertex;
+
+	struct LiveGlyph
+	{
+		std::uint32_t CodePoint;
+		GlyphRect     Rect;
+	};
+
+	std::uint8_t CoverageValue(std::uint32_t codePoint, int x, int y)
+	{
+		return static_cast<std::uint8_t>((codePoint * 31 + x * 7 + y * 13) & 0xFF);
+	}
+
+	int PixelAlpha(const GlyphAtlas& atlas, int x, int y)
+	{
+		return static_cast<int>(atlas.GetPixels()[static_cast<size_t>(y) * atlas.GetWidth() + x] >> 24);
+	}
+
+	bool IsOverlapped(const GlyphRect& a, const GlyphRect& b)
+	{
+		return a.X < b.X + b.Width && b.X < a.X + a.Width && a.Y < b.Y + b.Height && b.Y < a.Y + a.Height;
+	}
+
+	bool IsSameVertices(const std::vector<Vertex>& a, const std::vector<Vertex>& b)
+	{
+		return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(Vertex)) == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Random cells against a model of the live glyphs :
+	-   in bounds, no overlap, coverage in the alpha, dirty rows, growth and reset
+	---------------------------------------------------------------------------*/
+	void CheckAtlas()
+	{
+		GlyphAtlas atlas;
+		TEST_CHECK(atlas.Initialize(256, 64, 256));
+		TEST_CHECK(atlas.GetHeight() == 64);
+
+		test::Random random(4200);
+		std::vector<LiveGlyph>    live;
+		std::vector<std::uint8_t> pixels(32 * 32);
+		int growCount  = 0;
+		int resetCount = 0;
+
+		for (std::uint32_t codePoint = 0; codePoint < 3000; ++codePoint)
+		{
+			const int width  = 4 + static_cast<int>(random.Range(21));
+			const int height = 4 + static_cast<int>(random.Range(21));
+			for (int y = 0; y < height; ++y)
+			{
+				for (int x = 0; x < width; ++x) { pixels[y * 32 + x] = CoverageValue(codePoint, x, y); }
+			}
+			GlyphCoverage coverage;
+			coverage.Pixels = pixels.data();
+			coverage.Pitch  = 32;
+			coverage.Width  = width;
+			coverage.Height = height;
+
+			const int           oldHeight     = atlas.GetHeight();
+			const std::uint32_t oldGeneration = atlas.GetGeneration();
+			atlas.ClearDirtyRows();
+			const GlyphRect* rect = atlas.Insert(0, codePoint, width, height, coverage);
+			TEST_CHECK(rect != nullptr);
+			if (rect == nullptr) { return; }
+
+			/*-------------------------------------------------------------------
+			-              Growth keeps the glyphs, reset removes them
+			---------------------------------------------------------------------*/
+			if (atlas.GetGlyphCount() != live.size() + 1)
+			{
+				TEST_CHECK(atlas.GetGlyphCount() == 1);
+				TEST_CHECK(atlas.GetGeneration() != oldGeneration);
+				live.clear();
+				++resetCount;
+			}
+			else if (atlas.GetHeight() != oldHeight)
+			{
+				TEST_CHECK(atlas.GetHeight() == oldHeight * 2);
+				TEST_CHECK(atlas.GetGeneration() != oldGeneration);
+				++growCount;
+			}
+			else
+			{
+				TEST_CHECK(atlas.GetGeneration() == oldGeneration);
+				TEST_CHECK(atlas.GetDirtyRowBegin() == rect->Y && atlas.GetDirtyRowEnd() == rect->Y + rect->Height);
+			}
+			TEST_CHECK(atlas.HasDirtyRows());
+			TEST_CHECK(atlas.GetDirtyRowBegin() <= rect->Y && rect->Y + rect->Height <= atlas.GetDirtyRowEnd());
+
+			TEST_CHECK(rect->Width == width && rect->Height == height);
+			TEST_CHECK(rect->X + rect->Width <= atlas.GetWidth() && rect->Y + rect->Height <= atlas.GetHeight());
+			for (const LiveGlyph& other : live)
+			{
+				TEST_CHECK_MESSAGE(!IsOverlapped(*rect, other.Rect), "glyph %u overlaps glyph %u", codePoint, other.CodePoint);
+			}
+			TEST_CHECK(PixelAlpha(atlas, rect->X + width - 1, rect->Y + height - 1) == CoverageValue(codePoint, width - 1, height - 1));
+			live.push_back(LiveGlyph{ codePoint, *rect });
+		}
+		TEST_CHECK(growCount == 2);
+		TEST_CHECK(resetCount > 0);
+
+		/*-------------------------------------------------------------------
+		-              All the live glyphs are still readable
+		---------------------------------------------------------------------*/
+		for (const LiveGlyph& glyph : live)
+		{
+			const GlyphRect* found = atlas.Find(0, glyph.CodePoint);
+			TEST_CHECK(found != nullptr);
+			if (found == nullptr) { return; }
+			TEST_CHECK(found->X == glyph.Rect.X && found->Y == glyph.Rect.Y);
+			bool isSame = true;
+			for (int y = 0; y < glyph.Rect.Height; ++y)
+			{
+				for (int x = 0; x < glyph.Rect.Width; ++x)
+				{
+					isSame &= PixelAlpha(atlas, glyph.Rect.X + x, glyph.Rect.Y + y) == CoverageValue(glyph.CodePoint, x, y);
+				}
+			}
+			TEST_CHECK_MESSAGE(isSame, "coverage of glyph %u", glyph.CodePoint);
+		}
+		TEST_CHECK(atlas.Find(1, live.back().CodePoint) == nullptr);
+
+		/*-------------------------------------------------------------------
+		-              Inserting again returns the same cell
+		---------------------------------------------------------------------*/
+		const std::uint32_t generation = atlas.GetGeneration();
+		const GlyphRect*    again      = atlas.Insert(0, live.back().CodePoint, 8, 8, GlyphCoverage());
+		TEST_CHECK(again != nullptr && again->X == live.back().Rect.X && again->Y == live.back().Rect.Y);
+		TEST_CHECK(atlas.GetGeneration() == generation);
+
+		/*-------------------------------------------------------------------
+		-              Rejected sizes (the cell needs one padding pixel)
+		---------------------------------------------------------------------*/
+		TEST_CHECK(atlas.Insert(2, 0, 256, 8, GlyphCoverage()) == nullptr);
+		TEST_CHECK(atlas.Insert(2, 1, 8, 256, GlyphCoverage()) == nullptr);
+		TEST_CHECK(atlas.Insert(2, 2, 0, 8, GlyphCoverage()) == nullptr);
+		TEST_CHECK(atlas.Insert(2, 3, 255, 255, GlyphCoverage()) != nullptr);
+		TEST_CHECK(atlas.GetGlyphCount() == 1);
+
+		atlas.Finalize();
+		TEST_CHECK(atlas.GetGlyphCount() == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Coverage larger than the cell and shifted by the offset is clipped to the cell
+	---------------------------------------------------------------------------*/
+	void CheckCoverageClip()
+	{
+		GlyphAtlas atlas;
+		TEST_CHECK(atlas.Initialize(64, 32, 32));
+
+		std::vector<std::uint8_t> pixels(20 * 20, 64);
+		GlyphCoverage coverage;
+		coverage.Pixels   = pixels.data();
+		coverage.Pitch    = 20;
+		coverage.Width    = 20;
+		coverage.Height   = 20;
+		coverage.OffsetX  = -2;
+		coverage.OffsetY  = 3;
+		coverage.MaxValue = 64;
+
+		const GlyphRect* rect = atlas.Insert(0, 'A', 10, 10, coverage);
+		TEST_CHECK(rect != nullptr);
+		if (rect == nullptr) { return; }
+		for (int y = 0; y < 12; ++y)
+		{
+			for (int x = 0; x < 12; ++x)
+			{
+				const bool inside = x < 10 && y >= 3 && y < 10;
+				TEST_CHECK_MESSAGE(PixelAlpha(atlas, rect->X + x, rect->Y + y) == (inside ? 255 : 0), "pixel (%d, %d)", x, y);
+			}
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Glyph of the test font : uv from the code, 'i' is narrow, '\n' is skipped
+	---------------------------------------------------------------------------*/
+	bool TestGlyph(wchar_t character, TextGlyph& glyph)
+	{
+		if (character == L'\n') { return false; }
+		const float u = static_cast<float>(character) * 0.001f;
+		glyph.U          = gm::Float2(u, u + 0.001f);
+		glyph.V          = gm::Float2(0.25f, 0.75f);
+		glyph.WidthScale = character == L'i' ? 0.5f : 1.0f;
+		return true;
+	}
+
+	bool TestDigit(int digit, TextGlyph& glyph)
+	{
+		glyph.U = gm::Float2(digit * 0.1f, digit * 0.1f + 0.1f);
+		glyph.V = gm::Float2(0.0f, 1.0f);
+		return true;
+	}
+
+	/* the former DrawString : one sprite quad per drawn character */
+	std::vector<Vertex> ReferenceString(const TextString& text, const gm::Float4& color)
+	{
+		std::vector<Vertex> vertices;
+		const gm::Float3 normal = gm::Float3(0.0f, 0.0f, 1.0f);
+		float left = text.StartPosition.x;
+		for (wchar_t character : text.String)
+		{
+			TextGlyph glyph;
+			if (!TestGlyph(character, glyph)) { continue; }
+			const float right  = left + text.SizePerChar.x * glyph.WidthScale;
+			const float bottom = text.StartPosition.y - 1.5f * text.SizePerChar.y;
+			const float top    = text.StartPosition.y - 0.5f * text.SizePerChar.y;
+			vertices.push_back(Vertex(gm::Float3(left , bottom, 0.0f), normal, color, gm::Float2(glyph.U.x, glyph.V.y)));
+			vertices.push_back(Vertex(gm::Float3(left , top   , 0.0f), normal, color, gm::Float2(glyph.U.x, glyph.V.x)));
+			vertices.push_back(Vertex(gm::Float3(right, top   , 0.0f), normal, color, gm::Float2(glyph.U.y, glyph.V.x)));
+			vertices.push_back(Vertex(gm::Float3(right, bottom, 0.0f), normal, color, gm::Float2(glyph.U.y, glyph.V.y)));
+			left = right + text.Space;
+		}
+		return vertices;
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Strings : the quads, cache hits, moves, recolors and generations
+	---------------------------------------------------------------------------*/
+	void CheckString()
+	{
+		TextLayoutCache cache;
+		cache.BeginFrame(1);
+		const gm::Float4 white = gm::Float4(1.0f, 1.0f, 1.0f, 1.0f);
+		const gm::Float4 red   = gm::Float4(1.0f, 0.0f, 0.0f, 0.5f);
+
+		TextString text(L"Hi\nthere", gm::Float2(16.0f, 20.0f), gm::Float3(100.0f, 200.0f, 0.0f), 2.0f);
+		const TextLayout* layout = &cache.GetString(0, 1, text, white, TestGlyph);
+		TEST_CHECK(layout->GetCharCount() == 7);
+		TEST_CHECK(IsSameVertices(layout->DrawVertices, ReferenceString(text, white)));
+		TEST_CHECK(cache.GetBuildCount() == 1);
+
+		/*-------------------------------------------------------------------
+		-              Same text : no rebuild
+		---------------------------------------------------------------------*/
+		layout = &cache.GetString(0, 1, text, white, TestGlyph);
+		TEST_CHECK(cache.GetBuildCount() == 1 && cache.GetLayoutCount() == 1);
+		TEST_CHECK(IsSameVertices(layout->DrawVertices, ReferenceString(text, white)));
+
+		/*-------------------------------------------------------------------
+		-              Moved and recolored : only the draw vertices change
+		---------------------------------------------------------------------*/
+		text.StartPosition = gm::Float3(-30.0f, 5.5f, 0.0f);
+		layout = &cache.GetString(0, 1, text, red, TestGlyph);
+		TEST_CHECK(cache.GetBuildCount() == 1);
+		TEST_CHECK(IsSameVertices(layout->DrawVertices, ReferenceString(text, red)));
+
+		/*-------------------------------------------------------------------
+		-              New generation, other font, other space : rebuilt
+		---------------------------------------------------------------------*/
+		layout = &cache.GetString(0, 2, text, red, TestGlyph);
+		TEST_CHECK(cache.GetBuildCount() == 2 && cache.GetLayoutCount() == 1);
+		TEST_CHECK(IsSameVertices(layout->DrawVertices, ReferenceString(text, red)));
+
+		cache.GetString(1, 2, text, red, TestGlyph);
+		text.Space = 3.0f;
+		layout = &cache.GetString(0, 2, text, red, TestGlyph);
+		TEST_CHECK(cache.GetBuildCount() == 4 && cache.GetLayoutCount() == 3);
+		TEST_CHECK(IsSameVertices(layout->DrawVertices, ReferenceString(text, red)));
+
+		/*-------------------------------------------------------------------
+		-              Empty and skipped only
+		---------------------------------------------------------------------*/
+		TEST_CHECK(cache.GetString(0, 2, TextString(L"", text.SizePerChar, text.StartPosition, 0.0f), red, TestGlyph).DrawVertices.empty());
+		TEST_CHECK(cache.GetString(0, 2, TextString(L"\n\n", text.SizePerChar, text.StartPosition, 0.0f), red, TestGlyph).DrawVertices.empty());
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Numbers : a value change rewrites only the uv of the changed digits
+	---------------------------------------------------------------------------*/
+	void CheckNumber()
+	{
+		TextLayoutCache cache;
+		cache.BeginFrame(1);
+		const gm::Float4 color = gm::Float4(0.0f, 1.0f, 0.0f, 1.0f);
+
+		int glyphCalls = 0;
+		auto countedDigit = [&](int digit, TextGlyph& glyph) { ++glyphCalls; return TestDigit(digit, glyph); };
+
+		TextNumber number = { 1234, 8, gm::Float2(10.0f, 12.0f), gm::Float3(50.0f, 60.0f, 0.0f), 1.0f };
+		cache.GetNumber(0, 1, number, color, countedDigit);
+		TEST_CHECK(glyphCalls == 8);
+
+		test::Random random(4201);
+		for (int i = 0; i < 200; ++i)
+		{
+			const UINT oldValue = number.Number;
+			number.Number = random.Bool() ? oldValue + random.Range(100) : random.Range(100000000);
+			int changed = 0;
+			for (UINT a = oldValue, b = number.Number, d = 0; d < 8; ++d, a /= 10, b /= 10) { changed += (a % 10) != (b % 10); }
+
+			glyphCalls = 0;
+			const TextLayout& layout = cache.GetNumber(0, 1, number, color, countedDigit);
+			TEST_CHECK_MESSAGE(glyphCalls == changed, "%u -> %u : %d glyphs for %d changed digits", oldValue, number.Number, glyphCalls, changed);
+
+			TextLayoutCache   fresh;
+			const TextLayout& expected = fresh.GetNumber(0, 1, number, color, TestDigit);
+			TEST_CHECK_MESSAGE(IsSameVertices(layout.Vertices, expected.Vertices) && IsSameVertices(layout.DrawVertices, expected.DrawVertices),
+				"number %u", number.Number);
+		}
+		TEST_CHECK(cache.GetLayoutCount() == 1);
+
+		/*-------------------------------------------------------------------
+		-              Same value : no glyph lookup, no build
+		---------------------------------------------------------------------*/
+		const std::size_t buildCount = cache.GetBuildCount();
+		glyphCalls = 0;
+		cache.GetNumber(0, 1, number, color, countedDigit);
+		TEST_CHECK(glyphCalls == 0 && cache.GetBuildCount() == buildCount);
+
+		/*-------------------------------------------------------------------
+		-              Digit wider than the small buffer, upper digits are 0
+		---------------------------------------------------------------------*/
+		TextNumber wide = { 42, 20, gm::Float2(10.0f, 12.0f), gm::Float3(0.0f, 0.0f, 0.0f), 0.0f };
+		const TextLayout& layout = cache.GetNumber(0, 1, wide, color, TestDigit);
+		TEST_CHECK(layout.GetCharCount() == 20);
+		TEST_CHECK(layout.Digits[0] == 0 && layout.Digits[18] == 4 && layout.Digits[19] == 2);
+		TEST_CHECK(layout.Vertices[19 * 4].Position.x == 190.0f);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Layouts unused for CACHE_LIFE_FRAME frames are removed
+	---------------------------------------------------------------------------*/
+	void CheckEviction()
+	{
+		TextLayoutCache cache;
+		const gm::Float4 white = gm::Float4(1.0f, 1.0f, 1.0f, 1.0f);
+		const TextString once (L"once" , gm::Float2(8.0f, 8.0f), gm::Float3(0.0f, 0.0f, 0.0f), 0.0f);
+		const TextString every(L"every", gm::Float2(8.0f, 8.0f), gm::Float3(0.0f, 0.0f, 0.0f), 0.0f);
+
+		cache.BeginFrame(1);
+		cache.GetString(0, 0, once , white, TestGlyph);
+		cache.GetString(0, 0, every, white, TestGlyph);
+
+		std::uint64_t frame = 2;
+		for (; frame <= TextLayoutCache::CACHE_LIFE_FRAME; ++frame)
+		{
+			cache.BeginFrame(frame);
+			cache.GetString(0, 0, every, white, TestGlyph);
+		}
+		TEST_CHECK(cache.GetLayoutCount() == 2);
+
+		for (; frame <= TextLayoutCache::CACHE_LIFE_FRAME * 3; ++frame)
+		{
+			cache.BeginFrame(frame);
+			cache.GetString(0, 0, every, white, TestGlyph);
+		}
+		TEST_CHECK(cache.GetLayoutCount() == 1);
+		TEST_CHECK(cache.GetBuildCount() == 2);
+
+		cache.GetString(0, 0, once, white, TestGlyph);
+		TEST_CHECK(cache.GetBuildCount() == 3);
+
+		cache.Clear();
+		TEST_CHECK(cache.GetLayoutCount() == 0);
+	}
+
+	/*---------------------------------------------------------------------------
+	-   One frame of labels and counters (10% of the counters change) :
+	-   rebuild every quad (the former DrawString / DrawNumber) against the cache
+	---------------------------------------------------------------------------*/
+	void Bench()
+	{
+		const size_t textCounts[] = { 200, 2000 };
+		const int    frame        = 200 * test::BenchScale();
+		const gm::Float4 white    = gm::Float4(1.0f, 1.0f, 1.0f, 1.0f);
+		test::Random random(4202);
+		char label[96];
+
+		for (size_t textCount : textCounts)
+		{
+			std::vector<TextString> labels(textCount);
+			std::vector<TextNumber> counters(textCount);
+			size_t charCount = 0;
+			for (size_t i = 0; i < textCount; ++i)
+			{
+				std::wstring string(8 + random.Range(17), L' ');
+				for (wchar_t& character : string) { character = static_cast<wchar_t>(L'a' + random.Range(26)); }
+				charCount += string.size();
+				const gm::Float3 position = gm::Float3(random.Float(0.0f, 1000.0f), random.Float(0.0f, 1000.0f), 0.0f);
+				labels[i]   = TextString(string, gm::Float2(16.0f, 20.0f), position, 1.0f);
+				counters[i] = TextNumber{ random.Range(100000000), 8, gm::Float2(12.0f, 16.0f), gm::Float3(position.x, position.y + 30.0f, 0.0f), 1.0f };
+			}
+			std::vector<Vertex> ring((charCount + textCount * 8) * 4);
+
+			/*-------------------------------------------------------------------
+			-              Rebuild every frame
+			---------------------------------------------------------------------*/
+			test::Random changeRandom(4203);
+			test::Timer  timer;
+			for (int f = 0; f < frame; ++f)
+			{
+				size_t written = 0;
+				for (size_t i = 0; i < textCount; ++i)
+				{
+					if (changeRandom.Range(10) == 0) { counters[i].Number++; }
+
+					const std::vector<Vertex> vertices = ReferenceString(labels[i], white);
+					std::memcpy(ring.data() + written, vertices.data(), vertices.size() * sizeof(Vertex));
+					written += vertices.size();
+
+					std::vector<Vertex> digits(32);
+					UINT value = counters[i].Number;
+					for (int d = 7; d >= 0; --d, value /= 10)
+					{
+						TextGlyph glyph;
+						TestDigit(static_cast<int>(value % 10), glyph);
+						const float left = counters[i].StartPosition.x + d * (counters[i].SizePerDigit.x + counters[i].Space);
+						const float right = left + counters[i].SizePerDigit.x;
+						const float bottom = counters[i].StartPosition.y - 1.5f * counters[i].SizePerDigit.y;
+						const float top = counters[i].StartPosition.y - 0.5f * counters[i].SizePerDigit.y;
+						const gm::Float3 normal = gm::Float3(0.0f, 0.0f, 1.0f);
+						digits[d * 4 + 0] = Vertex(gm::Float3(left , bottom, 0.0f), normal, white, gm::Float2(glyph.U.x, glyph.V.y));
+						digits[d * 4 + 1] = Vertex(gm::Float3(left , top   , 0.0f), normal, white, gm::Float2(glyph.U.x, glyph.V.x));
+						digits[d * 4 + 2] = Vertex(gm::Float3(right, top   , 0.0f), normal, white, gm::Float2(glyph.U.y, glyph.V.x));
+						digits[d * 4 + 3] = Vertex(gm::Float3(right, bottom, 0.0f), normal, white, gm::Float2(glyph.U.y, glyph.V.y));
+					}
+					std::memcpy(ring.data() + written, digits.data(), digits.size() * sizeof(Vertex));
+					written += digits.size();
+				}
+				test::DoNotOptimize(ring[0]);
+			}
+			std::snprintf(label, sizeof(label), "%4zu + %4zu : rebuild every frame", textCount, textCount);
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+
+			/*-------------------------------------------------------------------
+			-              Layout cache
+			---------------------------------------------------------------------*/
+			TextLayoutCache cache;
+			changeRandom = test::Random(4203);
+			timer.Reset();
+			for (int f = 0; f < frame; ++f)
+			{
+				cache.BeginFrame(static_cast<std::uint64_t>(f) + 1);
+				size_t written = 0;
+				for (size_t i = 0; i < textCount; ++i)
+				{
+					if (changeRandom.Range(10) == 0) { counters[i].Number++; }
+
+					const TextLayout& text = cache.GetString(0, 0, labels[i], white, TestGlyph);
+					std::memcpy(ring.data() + written, text.DrawVertices.data(), text.DrawVertices.size() * sizeof(Vertex));
+					written += text.DrawVertices.size();
+
+					const TextLayout& number = cache.GetNumber(0, 0, counters[i], white, TestDigit);
+					std::memcpy(ring.data() + written, number.DrawVertices.data(), number.DrawVertices.size() * sizeof(Vertex));
+					written += number.DrawVertices.size();
+				}
+				test::DoNotOptimize(ring[0]);
+			}
+			std::snprintf(label, sizeof(label), "%4zu + %4zu : layout cache", textCount, textCount);
+			test::PrintBench(label, timer.ElapsedMs(), static_cast<std::uint64_t>(frame), "frame");
+		}
+	}
+}
+
+int main()
+{
+	CheckAtlas();
+	CheckCoverageClip();
+	CheckString();
+	CheckNumber();
+	CheckEviction();
+	Bench();
+	return TEST_RESULT();
+}
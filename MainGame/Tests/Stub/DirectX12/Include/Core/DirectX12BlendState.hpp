@@ -0,0 +1,12 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12BlendState.hpp
+///             @brief  Stand-in of the blend state header for the headless tests.
+///                     GameObject includes it but does not use it.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_BLENDSTATE_HPP
+#define DIRECTX12_BLENDSTATE_HPP
+
+#endif
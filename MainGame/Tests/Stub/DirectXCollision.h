@@ -0,0 +1,414 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectXCollision.h
+///             @brief  Stand-in of <DirectXCollision.h> for the headless tests.
+///                     The bounding volumes have the members and the results of the SDK types
+///                     (a box or oriented box hit by a ray from inside returns a negative distance,
+///                     a sphere its exit distance, a frustum 0). The box, oriented box and frustum
+///                     are handled as one convex hexahedron (separating axes, clipping, distance),
+///                     so Collision.cpp and the trees built on it can run without the Windows SDK.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEST_STUB_DIRECTX_COLLISION_H
+#define TEST_STUB_DIRECTX_COLLISION_H
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectXMath.h"
+#include <cfloat>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace DirectX
+{
+	enum ContainmentType       { DISJOINT = 0, INTERSECTS = 1, CONTAINS = 2 };
+	enum PlaneIntersectionType { FRONT = 0, INTERSECTING = 1, BACK = 2 };
+
+	struct BoundingBox;
+	struct BoundingOrientedBox;
+	struct BoundingFrustum;
+
+	/*---------------------------------------------------------------------------
+	-   Convex hexahedron : corners [0, 4) and [4, 8) are two opposite faces in the same
+	-   winding, corner i + 4 faces corner i (the corner order of the SDK GetCorners)
+	---------------------------------------------------------------------------*/
+	namespace test_stub
+	{
+		struct Point { float x, y, z; };
+
+		inline Point  Sub  (const Point& a, const Point& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+		inline Point  Add  (const Point& a, const Point& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+		inline Point  Scale(const Point& a, float s)        { return { a.x * s, a.y * s, a.z * s }; }
+		inline float  Dot  (const Point& a, const Point& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+		inline Point  Cross(const Point& a, const Point& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+		inline Point  ToPoint(const XMFLOAT3& v) { return { v.x, v.y, v.z }; }
+
+		/* v rotated by the unit quaternion q */
+		inline Point Rotate(const Point& v, const XMFLOAT4& q)
+		{
+			const Point axis = { q.x, q.y, q.z };
+			const Point t    = Scale(Cross(axis, v), 2.0f);
+			return Add(Add(v, Scale(t, q.w)), Cross(axis, t));
+		}
+
+		struct Hexahedron
+		{
+			Point Corners[8];
+			Point Normals[6];   // outward
+			float Distances[6]; // dot(normal, p) + distance = 0 on the face
+
+			static constexpr int FACES[6][4] = { { 0, 1, 2, 3 }, { 4, 7, 6, 5 }, { 0, 4, 5, 1 }, { 1, 5, 6, 2 }, { 2, 6, 7, 3 }, { 3, 7, 4, 0 } };
+			static constexpr int EDGES[12][2] = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+
+			void Build()
+			{
+				Point centroid = { 0.0f, 0.0f, 0.0f };
+				for (const Point& corner : Corners) { centroid = Add(centroid, Scale(corner, 0.125f)); }
+				for (int f = 0; f < 6; ++f)
+				{
+					const Point& a = Corners[FACES[f][0]];
+					Point normal = Cross(Sub(Corners[FACES[f][1]], a), Sub(Corners[FACES[f][2]], a));
+					const float length = std::sqrt(Dot(normal, normal));
+					normal = length > 0.0f ? Scale(normal, 1.0f / length) : Point{ 0.0f, 0.0f, 0.0f };
+					if (Dot(normal, Sub(centroid, a)) > 0.0f) { normal = Scale(normal, -1.0f); }
+					Normals[f]   = normal;
+					Distances[f] = -Dot(normal, a);
+				}
+			}
+
+			void Project(const Point& axis, float& outMin, float& outMax) const
+			{
+				outMin = outMax = Dot(axis, Corners[0]);
+				for (int i = 1; i < 8; ++i)
+				{
+					const float d = Dot(axis, Corners[i]);
+					outMin = d < outMin ? d : outMin;
+					outMax = d > outMax ? d : outMax;
+				}
+			}
+
+			bool IsInside(const Point& p, float margin = 0.0f) const
+			{
+				for (int f = 0; f < 6; ++f) { if (Dot(Normals[f], p) + Distances[f] > -margin) { return false; } }
+				return true;
+			}
+
+			PlaneIntersectionType Classify(const XMFLOAT4& plane) const
+			{
+				bool isFront = false, isBack = false;
+				for (const Point& corner : Corners)
+				{
+					const float d = plane.x * corner.x + plane.y * corner.y + plane.z * corner.z + plane.w;
+					isFront |= d > 0.0f;
+					isBack  |= d < 0.0f;
+				}
+				return isFront && isBack ? INTERSECTING : (isFront ? FRONT : BACK);
+			}
+		};
+
+		/* separating axis test of two convex hexahedra (face normals and edge pairs) */
+		inline bool Intersects(const Hexahedron& a, const Hexahedron& b)
+		{
+			auto isSeparated = [&](const Point& axis)
+			{
+				if (Dot(axis, axis) < 1e-12f) { return false; }
+				float minA, maxA, minB, maxB;
+				a.Project(axis, minA, maxA);
+				b.Project(axis, minB, maxB);
+				return maxA < minB || maxB < minA;
+			};
+			for (int f = 0; f < 6; ++f) { if (isSeparated(a.Normals[f]) || isSeparated(b.Normals[f])) { return false; } }
+			for (const auto& edgeA : Hexahedron::EDGES)
+			{
+				for (const auto& edgeB : Hexahedron::EDGES)
+				{
+					const Point axis = Cross(Sub(a.Corners[edgeA[1]], a.Corners[edgeA[0]]), Sub(b.Corners[edgeB[1]], b.Corners[edgeB[0]]));
+					if (isSeparated(axis)) { return false; }
+				}
+			}
+			return true;
+		}
+
+		inline float SegmentDistanceSquared(const Point& p, const Point& a, const Point& b)
+		{
+			const Point ab = Sub(b, a);
+			const float lengthSq = Dot(ab, ab);
+			float t = lengthSq > 0.0f ? Dot(Sub(p, a), ab) / lengthSq : 0.0f;
+			t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+			const Point d = Sub(p, Add(a, Scale(ab, t)));
+			return Dot(d, d);
+		}
+
+		/* squared distance from the point to the solid hexahedron (0 inside) */
+		inline float DistanceSquared(const Hexahedron& h, const Point& p)
+		{
+			if (h.IsInside(p)) { return 0.0f; }
+			float best = FLT_MAX;
+			for (int f = 0; f < 6; ++f)
+			{
+				const float planeDistance = Dot(h.Normals[f], p) + h.Distances[f];
+				const Point projected     = Sub(p, Scale(h.Normals[f], planeDistance));
+				bool isPositive = false, isNegative = false; // the same side of every edge : inside the face
+				for (int e = 0; e < 4; ++e)
+				{
+					const Point& a = h.Corners[Hexahedron::FACES[f][e]];
+					const Point& b = h.Corners[Hexahedron::FACES[f][(e + 1) % 4]];
+					const float side = Dot(Cross(Sub(b, a), Sub(projected, a)), h.Normals[f]);
+					isPositive |= side > 0.0f;
+					isNegative |= side < 0.0f;
+				}
+				const bool isInFace = !(isPositive && isNegative);
+				float distanceSq = planeDistance * planeDistance;
+				if (!isInFace)
+				{
+					distanceSq = FLT_MAX;
+					for (int e = 0; e < 4; ++e)
+					{
+						const float d = SegmentDistanceSquared(p, h.Corners[Hexahedron::FACES[f][e]], h.Corners[Hexahedron::FACES[f][(e + 1) % 4]]);
+						distanceSq = d < distanceSq ? d : distanceSq;
+					}
+				}
+				best = distanceSq < best ? distanceSq : best;
+			}
+			return best;
+		}
+
+		/* clip the ray by the faces : the entry distance (negative when the origin is inside) */
+		inline bool Raycast(const Hexahedron& h, const Point& origin, const Point& direction, float& outEnter)
+		{
+			float enter = -FLT_MAX, exit = FLT_MAX;
+			for (int f = 0; f < 6; ++f)
+			{
+				const float denominator = Dot(h.Normals[f], direction);
+				const float numerator   = -(Dot(h.Normals[f], origin) + h.Distances[f]);
+				if (std::fabs(denominator) < 1e-20f)
+				{
+					if (numerator < 0.0f) { return false; }
+					continue;
+				}
+				const float t = numerator / denominator;
+				if (denominator < 0.0f) { enter = t > enter ? t : enter; }
+				else                    { exit  = t < exit  ? t : exit; }
+			}
+			if (enter > exit || exit < 0.0f) { return false; }
+			outEnter = enter;
+			return true;
+		}
+
+		inline Hexahedron FromCenter(const Point& center, const XMFLOAT3& extents, const XMFLOAT4& orientation)
+		{
+			static constexpr float OFFSETS[8][3] = { { -1, -1, 1 }, { 1, -1, 1 }, { 1, 1, 1 }, { -1, 1, 1 }, { -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 } };
+			Hexahedron h;
+			for (int i = 0; i < 8; ++i)
+			{
+				const Point local = { OFFSETS[i][0] * extents.x, OFFSETS[i][1] * extents.y, OFFSETS[i][2] * extents.z };
+				h.Corners[i] = Add(center, Rotate(local, orientation));
+			}
+			h.Build();
+			return h;
+		}
+	}
+
+	/*---------------------------------------------------------------------------
+	-   Sphere
+	---------------------------------------------------------------------------*/
+	struct BoundingSphere
+	{
+		XMFLOAT3 Center;
+		float    Radius;
+
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			const XMVECTOR delta      = XMVectorSubtract(XMLoadFloat3(&sphere.Center), XMLoadFloat3(&Center));
+			const float    distanceSq = XMVectorGetX(XMVector3Dot(delta, delta));
+			const float    radiusSum  = Radius + sphere.Radius;
+			return distanceSq <= radiusSum * radiusSum;
+		}
+		bool Intersects(const BoundingBox& box) const;
+		bool Intersects(const BoundingOrientedBox& box) const;
+		bool Intersects(const BoundingFrustum& frustum) const;
+		PlaneIntersectionType Intersects(XMVECTOR plane) const
+		{
+			XMFLOAT4 p; XMStoreFloat4(&p, plane);
+			const float d = p.x * Center.x + p.y * Center.y + p.z * Center.z + p.w;
+			return d > Radius ? FRONT : (d < -Radius ? BACK : INTERSECTING);
+		}
+		/* the exit distance when the origin is inside (as the SDK) */
+		bool Intersects(XMVECTOR origin, XMVECTOR direction, float& distance) const
+		{
+			XMFLOAT3 o, d; XMStoreFloat3(&o, origin); XMStoreFloat3(&d, direction);
+			const test_stub::Point l = test_stub::Sub(test_stub::ToPoint(Center), test_stub::ToPoint(o));
+			const float s  = test_stub::Dot(l, test_stub::ToPoint(d));
+			const float l2 = test_stub::Dot(l, l);
+			const float r2 = Radius * Radius;
+			const float m2 = l2 - s * s;
+			if ((s < 0.0f && l2 > r2) || m2 > r2) { return false; }
+			const float q = std::sqrt(r2 - m2);
+			distance = l2 <= r2 ? s + q : s - q;
+			return true;
+		}
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Axis aligned box
+	---------------------------------------------------------------------------*/
+	struct BoundingBox
+	{
+		XMFLOAT3 Center;
+		XMFLOAT3 Extents;
+
+		bool Intersects(const BoundingBox& box) const
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				const float minA = (&Center.x)[i] - (&Extents.x)[i], maxA = (&Center.x)[i] + (&Extents.x)[i];
+				const float minB = (&box.Center.x)[i] - (&box.Extents.x)[i], maxB = (&box.Center.x)[i] + (&box.Extents.x)[i];
+				if (minA > maxB || minB > maxA) { return false; }
+			}
+			return true;
+		}
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			float distanceSq = 0.0f;
+			for (int i = 0; i < 3; ++i)
+			{
+				const float center = (&sphere.Center.x)[i];
+				const float boxMin = (&Center.x)[i] - (&Extents.x)[i];
+				const float boxMax = (&Center.x)[i] + (&Extents.x)[i];
+				const float d      = center < boxMin ? center - boxMin : (center > boxMax ? center - boxMax : 0.0f);
+				distanceSq = i == 0 ? d * d : distanceSq + d * d;
+			}
+			return distanceSq <= sphere.Radius * sphere.Radius;
+		}
+		bool Intersects(const BoundingOrientedBox& box) const;
+		bool Intersects(const BoundingFrustum& frustum) const;
+		PlaneIntersectionType Intersects(XMVECTOR plane) const
+		{
+			XMFLOAT4 p; XMStoreFloat4(&p, plane);
+			const float d = p.x * Center.x + p.y * Center.y + p.z * Center.z + p.w;
+			const float r = std::fabs(p.x) * Extents.x + std::fabs(p.y) * Extents.y + std::fabs(p.z) * Extents.z;
+			return d > r ? FRONT : (d < -r ? BACK : INTERSECTING);
+		}
+		bool Intersects(XMVECTOR origin, XMVECTOR direction, float& distance) const
+		{
+			XMFLOAT3 o, d; XMStoreFloat3(&o, origin); XMStoreFloat3(&d, direction);
+			return test_stub::Raycast(GetHexahedron(), test_stub::ToPoint(o), test_stub::ToPoint(d), distance);
+		}
+		void GetCorners(XMFLOAT3* corners) const
+		{
+			const test_stub::Hexahedron h = GetHexahedron();
+			for (int i = 0; i < 8; ++i) { corners[i] = XMFLOAT3(h.Corners[i].x, h.Corners[i].y, h.Corners[i].z); }
+		}
+		test_stub::Hexahedron GetHexahedron() const { return test_stub::FromCenter(test_stub::ToPoint(Center), Extents, XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f)); }
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Oriented box
+	---------------------------------------------------------------------------*/
+	struct BoundingOrientedBox
+	{
+		XMFLOAT3 Center;
+		XMFLOAT3 Extents;
+		XMFLOAT4 Orientation;
+
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			return test_stub::DistanceSquared(GetHexahedron(), test_stub::ToPoint(sphere.Center)) <= sphere.Radius * sphere.Radius;
+		}
+		bool Intersects(const BoundingBox& box)         const { return test_stub::Intersects(GetHexahedron(), box.GetHexahedron()); }
+		bool Intersects(const BoundingOrientedBox& box) const { return test_stub::Intersects(GetHexahedron(), box.GetHexahedron()); }
+		bool Intersects(const BoundingFrustum& frustum) const;
+		PlaneIntersectionType Intersects(XMVECTOR plane) const { XMFLOAT4 p; XMStoreFloat4(&p, plane); return GetHexahedron().Classify(p); }
+		bool Intersects(XMVECTOR origin, XMVECTOR direction, float& distance) const
+		{
+			XMFLOAT3 o, d; XMStoreFloat3(&o, origin); XMStoreFloat3(&d, direction);
+			return test_stub::Raycast(GetHexahedron(), test_stub::ToPoint(o), test_stub::ToPoint(d), distance);
+		}
+		void GetCorners(XMFLOAT3* corners) const
+		{
+			const test_stub::Hexahedron h = GetHexahedron();
+			for (int i = 0; i < 8; ++i) { corners[i] = XMFLOAT3(h.Corners[i].x, h.Corners[i].y, h.Corners[i].z); }
+		}
+		test_stub::Hexahedron GetHexahedron() const { return test_stub::FromCenter(test_stub::ToPoint(Center), Extents, Orientation); }
+	};
+
+	/*---------------------------------------------------------------------------
+	-   Frustum (looks along +z of Orientation, slopes are x / z and y / z)
+	---------------------------------------------------------------------------*/
+	struct BoundingFrustum
+	{
+		XMFLOAT3 Origin;
+		XMFLOAT4 Orientation;
+		float RightSlope, LeftSlope, TopSlope, BottomSlope;
+		float Near, Far;
+
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			return test_stub::DistanceSquared(GetHexahedron(), test_stub::ToPoint(sphere.Center)) <= sphere.Radius * sphere.Radius;
+		}
+		bool Intersects(const BoundingBox& box)         const { return test_stub::Intersects(GetHexahedron(), box.GetHexahedron()); }
+		bool Intersects(const BoundingOrientedBox& box) const { return test_stub::Intersects(GetHexahedron(), box.GetHexahedron()); }
+		bool Intersects(const BoundingFrustum& frustum) const { return test_stub::Intersects(GetHexahedron(), frustum.GetHexahedron()); }
+		PlaneIntersectionType Intersects(XMVECTOR plane) const { XMFLOAT4 p; XMStoreFloat4(&p, plane); return GetHexahedron().Classify(p); }
+		/* 0 when the origin is inside (as the SDK) */
+		bool Intersects(XMVECTOR origin, XMVECTOR direction, float& distance) const
+		{
+			XMFLOAT3 o, d; XMStoreFloat3(&o, origin); XMStoreFloat3(&d, direction);
+			if (!test_stub::Raycast(GetHexahedron(), test_stub::ToPoint(o), test_stub::ToPoint(d), distance)) { return false; }
+			distance = distance < 0.0f ? 0.0f : distance;
+			return true;
+		}
+
+		ContainmentType Contains(const BoundingSphere& sphere) const
+		{
+			const test_stub::Hexahedron h = GetHexahedron();
+			if (h.IsInside(test_stub::ToPoint(sphere.Center), sphere.Radius)) { return CONTAINS; }
+			return test_stub::DistanceSquared(h, test_stub::ToPoint(sphere.Center)) <= sphere.Radius * sphere.Radius ? INTERSECTS : DISJOINT;
+		}
+		ContainmentType Contains(const BoundingBox& box)         const { return Contains(box.GetHexahedron()); }
+		ContainmentType Contains(const BoundingOrientedBox& box) const { return Contains(box.GetHexahedron()); }
+		ContainmentType Contains(const BoundingFrustum& frustum) const { return Contains(frustum.GetHexahedron()); }
+
+		void GetCorners(XMFLOAT3* corners) const
+		{
+			const test_stub::Hexahedron h = GetHexahedron();
+			for (int i = 0; i < 8; ++i) { corners[i] = XMFLOAT3(h.Corners[i].x, h.Corners[i].y, h.Corners[i].z); }
+		}
+		test_stub::Hexahedron GetHexahedron() const
+		{
+			const float slopes[4][2] = { { LeftSlope, TopSlope }, { RightSlope, TopSlope }, { RightSlope, BottomSlope }, { LeftSlope, BottomSlope } };
+			test_stub::Hexahedron h;
+			for (int i = 0; i < 8; ++i)
+			{
+				const float z = i < 4 ? Near : Far;
+				const test_stub::Point local = { slopes[i % 4][0] * z, slopes[i % 4][1] * z, z };
+				h.Corners[i] = test_stub::Add(test_stub::ToPoint(Origin), test_stub::Rotate(local, Orientation));
+			}
+			h.Build();
+			return h;
+		}
+
+	private:
+		ContainmentType Contains(const test_stub::Hexahedron& object) const
+		{
+			const test_stub::Hexahedron h = GetHexahedron();
+			bool isInside = true;
+			for (const test_stub::Point& corner : object.Corners) { isInside &= h.IsInside(corner, -1e-6f); }
+			if (isInside) { return CONTAINS; }
+			return test_stub::Intersects(h, object) ? INTERSECTS : DISJOINT;
+		}
+	};
+
+	inline bool BoundingSphere::Intersects(const BoundingBox& box)          const { return box.Intersects(*this); }
+	inline bool BoundingSphere::Intersects(const BoundingOrientedBox& box)  const { return box.Intersects(*this); }
+	inline bool BoundingSphere::Intersects(const BoundingFrustum& frustum)  const { return frustum.Intersects(*this); }
+	inline bool BoundingBox::Intersects(const BoundingOrientedBox& box)     const { return box.Intersects(*this); }
+	inline bool BoundingBox::Intersects(const BoundingFrustum& frustum)     const { return frustum.Intersects(*this); }
+	inline bool BoundingOrientedBox::Intersects(const BoundingFrustum& frustum) const { return frustum.Intersects(*this); }
+}
+
+#endif
@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectXMath.h
+///             @brief  Stand-in of <DirectXMath.h> for the headless tests.
+///                     Only the names used by the tested engine sources are defined,
+///                     all of them are forwarded to GameMath (gm::simd).
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEST_STUB_DIRECTX_MATH_H
+#define TEST_STUB_DIRECTX_MATH_H
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMSimdMath.hpp"
+
+#if GM_SIMD_DIRECTXMATH_INTEROP
+#error "Tests/Stub : build the tests with GM_SIMD_DIRECTXMATH_INTEROP=0"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define XM_CALLCONV
+#define XM_PI 3.141592654f
+
+namespace DirectX
+{
+	using XMVECTOR    = gm::simd::VectorRegister;
+	using FXMVECTOR   = gm::simd::VectorRegister;
+	using GXMVECTOR   = gm::simd::VectorRegister;
+	using XMMATRIX    = gm::simd::MatrixRegister;
+	using FXMMATRIX   = const gm::simd::MatrixRegister&;
+	using XMFLOAT2    = gm::simd::Float2Data;
+	using XMFLOAT3    = gm::simd::Float3Data;
+	using XMFLOAT4    = gm::simd::Float4Data;
+	using XMFLOAT4X4  = gm::simd::Float4x4Data;
+	using XMVECTORF32 = gm::simd::VectorF32;
+
+	inline XMVECTOR XMLoadFloat2 (const XMFLOAT2* source)               { return gm::simd::LoadFloat2(source); }
+	inline XMVECTOR XMLoadFloat3 (const XMFLOAT3* source)               { return gm::simd::LoadFloat3(source); }
+	inline XMVECTOR XMLoadFloat4 (const XMFLOAT4* source)               { return gm::simd::LoadFloat4(source); }
+	inline void     XMStoreFloat2(XMFLOAT2* destination, XMVECTOR v)    { gm::simd::StoreFloat2(destination, v); }
+	inline void     XMStoreFloat3(XMFLOAT3* destination, XMVECTOR v)    { gm::simd::StoreFloat3(destination, v); }
+	inline void     XMStoreFloat4(XMFLOAT4* destination, XMVECTOR v)    { gm::simd::StoreFloat4(destination, v); }
+	inline XMMATRIX XMLoadFloat4x4 (const XMFLOAT4X4* source)           { return gm::simd::LoadFloat4x4(source); }
+	inline void     XMStoreFloat4x4(XMFLOAT4X4* destination, const XMMATRIX& m) { gm::simd::StoreFloat4x4(destination, m); }
+
+	inline XMVECTOR XMVectorSet(float x, float y, float z, float w)    { return gm::simd::VectorSet(x, y, z, w); }
+	inline XMVECTOR XMVectorZero()                                      { return gm::simd::VectorZero(); }
+	inline XMVECTOR XMVectorAdd     (XMVECTOR a, XMVECTOR b)            { return gm::simd::VectorAdd(a, b); }
+	inline XMVECTOR XMVectorSubtract(XMVECTOR a, XMVECTOR b)            { return gm::simd::VectorSubtract(a, b); }
+	inline XMVECTOR XMVectorMultiply(XMVECTOR a, XMVECTOR b)            { return gm::simd::VectorMultiply(a, b); }
+	inline XMVECTOR XMVectorMin     (XMVECTOR a, XMVECTOR b)            { return gm::simd::VectorMin(a, b); }
+	inline XMVECTOR XMVectorMax     (XMVECTOR a, XMVECTOR b)            { return gm::simd::VectorMax(a, b); }
+	inline XMVECTOR XMVectorAbs     (XMVECTOR v)                        { return gm::simd::VectorAbs(v); }
+	inline XMVECTOR XMVectorScale   (XMVECTOR v, float scale)           { return gm::simd::VectorScale(v, scale); }
+	inline float    XMVectorGetX    (XMVECTOR v)                        { return gm::simd::VectorGetX(v); }
+	inline XMVECTOR XMVector3Dot    (XMVECTOR a, XMVECTOR b)            { return gm::simd::Vector3Dot(a, b); }
+	inline XMVECTOR XMVector3Cross  (XMVECTOR a, XMVECTOR b)            { return gm::simd::Vector3Cross(a, b); }
+	inline XMVECTOR XMVector3Normalize(XMVECTOR v)                      { return gm::simd::Vector3Normalize(v); }
+	inline XMVECTOR XMVector3Length (XMVECTOR v)                        { return gm::simd::Vector3Length(v); }
+	inline XMVECTOR XMVector3Transform(XMVECTOR v, const XMMATRIX& m)   { return gm::simd::Vector3Transform(v, m); }
+	inline XMVECTOR XMVector3TransformCoord(XMVECTOR v, const XMMATRIX& m) { return gm::simd::Vector3TransformCoord(v, m); }
+	inline XMVECTOR XMVector4Dot    (XMVECTOR a, XMVECTOR b)            { return gm::simd::Vector4Dot(a, b); }
+	inline bool     XMVector3IsNaN  (XMVECTOR v)                        { return gm::simd::Vector3IsNaN(v); }
+	inline XMVECTOR XMPlaneNormalize(XMVECTOR plane)                    { return gm::simd::PlaneNormalize(plane); }
+
+	/* (normal, -dot(normal, point)) */
+	inline XMVECTOR XMPlaneFromPointNormal(XMVECTOR point, XMVECTOR normal)
+	{
+		const XMVECTOR w = gm::simd::VectorNegate(gm::simd::Vector3Dot(point, normal));
+		return gm::simd::VectorSelect(w, normal, gm::simd::g_Select1110);
+	}
+
+	inline XMVECTOR XMPlaneFromPoints(XMVECTOR point1, XMVECTOR point2, XMVECTOR point3)
+	{
+		const XMVECTOR normal = gm::simd::Vector3Normalize(gm::simd::Vector3Cross(
+			gm::simd::VectorSubtract(point1, point2), gm::simd::VectorSubtract(point1, point3)));
+		return XMPlaneFromPointNormal(point1, normal);
+	}
+
+	/* line of two planes (two points on it), NaN when the planes are parallel */
+	inline void XMPlaneIntersectPlane(XMVECTOR* linePoint1, XMVECTOR* linePoint2, XMVECTOR plane1, XMVECTOR plane2)
+	{
+		const XMVECTOR direction = gm::simd::Vector3Cross(plane1, plane2);
+		const float    lengthSq  = gm::simd::VectorGetX(gm::simd::Vector3Dot(direction, direction));
+		if (lengthSq <= 1e-12f)
+		{
+			*linePoint1 = *linePoint2 = gm::simd::VectorRegister(gm::simd::g_QNaN);
+			return;
+		}
+		/* point = (d2 * n1 - d1 * n2) x direction / |direction|^2 with the planes n.p + d = 0 */
+		const XMVECTOR d1    = gm::simd::VectorSplatW(plane1);
+		const XMVECTOR d2    = gm::simd::VectorSplatW(plane2);
+		const XMVECTOR cross = gm::simd::Vector3Cross(gm::simd::VectorSubtract(gm::simd::VectorMultiply(d2, plane1), gm::simd::VectorMultiply(d1, plane2)), direction);
+		*linePoint1 = gm::simd::VectorScale(cross, 1.0f / lengthSq);
+		*linePoint2 = gm::simd::VectorAdd(*linePoint1, direction);
+	}
+}
+
+#endif
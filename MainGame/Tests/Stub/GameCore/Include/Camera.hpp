@@ -0,0 +1,44 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Camera.hpp
+///             @brief  Stand-in of the Camera for the headless tests.
+///                     FrustumPlanes is the same as the engine header (the culling tests use it),
+///                     the Camera has only the lens and the pose read by the cascade fitting; the test sets them directly.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameMath/Include/GMMatrix.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+struct FrustumPlanes
+{
+	static constexpr int PLANE_COUNT = 6;
+	gm::Float4 Planes[PLANE_COUNT];
+};
+
+class Camera
+{
+public:
+	gm::Float3 GetPosition3f () const { return Position; }
+	gm::Float3 GetLook3f     () const { return Look; }
+	float      GetNearZ      () const { return NearZ; }
+	float      GetFarZ       () const { return FarZ; }
+	float      GetAspect     () const { return Aspect; }
+	float      GetFovVertical() const { return FovVertical; }
+
+	gm::Float3 Position    = gm::Float3(0.0f, 0.0f, 0.0f);
+	gm::Float3 Look        = gm::Float3(0.0f, 0.0f, 1.0f); // unit length
+	float      NearZ       = 0.1f;
+	float      FarZ        = 1000.0f;
+	float      Aspect      = 16.0f / 9.0f;
+	float      FovVertical = 0.25f * 3.14159265f;
+};
+#endif
@@ -0,0 +1,19 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Sprite.hpp
+///             @brief  Stand-in of the Sprite header for the headless tests.
+///                     GameObject includes it but does not use it.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef SPLITE_HPP
+#define SPLITE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12VertexTypes.hpp"
+#include <string>
+#include <vector>
+
+#endif
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SpriteRenderer.hpp
+///             @brief  Stand-in of the SpriteRenderer for the headless tests.
+///                     Only the direct vertex write is implemented; the vertices go to
+///                     a CPU array instead of the upload heap and EndVertexWrite records the draw.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef SPRITE_RENDERER_HPP
+#define SPRITE_RENDERER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DirectX12/Include/Core/DirectX12VertexTypes.hpp"
+#include "GameMath/Include/GMMatrix.hpp"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+struct Texture {};
+
+class SpriteRenderer
+{
+public:
+	/* the staging buffer holds MaxSpriteCount sprites (4 vertices each) */
+	explicit SpriteRenderer(int maxSpriteCount) : MaxSpriteCount(maxSpriteCount), Vertices(static_cast<size_t>(maxSpriteCount) * 4) {}
+
+	VertexPositionNormalColorTexture* BeginVertexWrite(int& outWritableSpriteCount, int requestSpriteCount = 0)
+	{
+		(void)requestSpriteCount;
+		outWritableSpriteCount = MaxSpriteCount - SpriteCount;
+		return Vertices.data() + static_cast<size_t>(SpriteCount) * 4;
+	}
+	bool EndVertexWrite(int writtenSpriteCount, const Texture&, const gm::Matrix4&)
+	{
+		if (writtenSpriteCount < 0 || SpriteCount + writtenSpriteCount > MaxSpriteCount) { return false; }
+		SpriteCount += writtenSpriteCount;
+		DrawCallCount++;
+		return true;
+	}
+
+	int MaxSpriteCount = 0;
+	int SpriteCount    = 0;
+	int DrawCallCount  = 0;
+	std::vector<VertexPositionNormalColorTexture> Vertices;
+};
+
+#endif
@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Windows.h
+///             @brief  Stand-in of <Windows.h> for the headless tests.
+///                     Only the names used by the tested engine sources are defined.
+///                     OutputDebugString is counted so that the tests can check the error paths.
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEST_STUB_WINDOWS_H
+#define TEST_STUB_WINDOWS_H
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using BYTE    = std::uint8_t;
+using UINT    = unsigned int;
+using UINT8   = std::uint8_t;
+using UINT16  = std::uint16_t;
+using UINT32  = std::uint32_t;
+using UINT64  = std::uint64_t;
+using INT     = int;
+using LONG    = long;
+using HRESULT = long;
+using LPCWSTR = const wchar_t*;
+
+#ifndef _countof
+#define _countof(array) (sizeof(array) / sizeof((array)[0]))
+#endif
+
+namespace test_stub
+{
+	inline int& DebugStringCount() { static int count = 0; return count; }
+}
+
+inline void OutputDebugStringW(LPCWSTR) { ++test_stub::DebugStringCount(); }
+inline void OutputDebugStringA(const char*) { ++test_stub::DebugStringCount(); }
+#define OutputDebugString OutputDebugStringW
+
+#endif
@@ -0,0 +1,43 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   d3d12.h
+///             @brief  Stand-in of <d3d12.h> for the headless tests.
+///                     Only the types used by the tested engine sources are defined (no device).
+///             @author Toide Yutaro
+///             @date   2026_10_18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef TEST_STUB_D3D12_H
+#define TEST_STUB_D3D12_H
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "Windows.h"
+#include "DirectXMath.h"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using D3D12_GPU_VIRTUAL_ADDRESS = UINT64;
+
+enum DXGI_FORMAT { DXGI_FORMAT_UNKNOWN = 0 };
+enum D3D12_INPUT_CLASSIFICATION { D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA = 0, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA = 1 };
+
+struct D3D12_INPUT_ELEMENT_DESC
+{
+	const char*                SemanticName;
+	UINT                       SemanticIndex;
+	DXGI_FORMAT                Format;
+	UINT                       InputSlot;
+	UINT                       AlignedByteOffset;
+	D3D12_INPUT_CLASSIFICATION InputSlotClass;
+	UINT                       InstanceDataStepRate;
+};
+
+struct D3D12_INPUT_LAYOUT_DESC
+{
+	const D3D12_INPUT_ELEMENT_DESC* pInputElementDescs;
+	UINT                            NumElements;
+};
+
+#endif